@@ -17,6 +17,7 @@
 #ifndef CYBER_BASE_WAIT_STRATEGY_H_
 #define CYBER_BASE_WAIT_STRATEGY_H_
 
+#include <atomic>
 #include <chrono>
 #include <condition_variable>
 #include <cstdlib>
@@ -87,6 +88,66 @@ class BusySpinWaitStrategy : public WaitStrategy {
   bool EmptyWait() override { return true; }
 };
 
+// Busy-spins for a bounded number of rounds, then yields for a bounded
+// number of rounds, and only then blocks on a condition variable. Trades
+// one spinning core for sub-microsecond wakeup while work arrives
+// frequently, and degrades to BlockWaitStrategy cost when idle.
+class AdaptiveWaitStrategy : public WaitStrategy {
+ public:
+  AdaptiveWaitStrategy() {}
+  AdaptiveWaitStrategy(uint64_t spin_round, uint64_t yield_round)
+      : spin_round_(spin_round), yield_round_(yield_round) {}
+
+  void NotifyOne() override {
+    pending_.fetch_add(1, std::memory_order_release);
+    cv_.notify_one();
+  }
+
+  void BreakAllWait() override {
+    break_all_wait_.store(true, std::memory_order_release);
+    cv_.notify_all();
+  }
+
+  bool EmptyWait() override {
+    for (uint64_t i = 0; i < spin_round_; ++i) {
+      if (TryConsumePending()) {
+        return true;
+      }
+    }
+    for (uint64_t i = 0; i < yield_round_; ++i) {
+      if (TryConsumePending()) {
+        return true;
+      }
+      std::this_thread::yield();
+    }
+    std::unique_lock<std::mutex> lock(mutex_);
+    cv_.wait(lock, [this]() {
+      return pending_.load(std::memory_order_acquire) > 0 ||
+             break_all_wait_.load(std::memory_order_acquire);
+    });
+    return TryConsumePending();
+  }
+
+ private:
+  bool TryConsumePending() {
+    auto pending = pending_.load(std::memory_order_acquire);
+    while (pending > 0) {
+      if (pending_.compare_exchange_weak(pending, pending - 1,
+                                         std::memory_order_acq_rel)) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  uint64_t spin_round_ = 10000;
+  uint64_t yield_round_ = 100;
+  std::atomic<uint64_t> pending_ = {0};
+  std::atomic<bool> break_all_wait_ = {false};
+  std::mutex mutex_;
+  std::condition_variable cv_;
+};
+
 class TimeoutBlockWaitStrategy : public WaitStrategy {
  public:
   TimeoutBlockWaitStrategy() {}
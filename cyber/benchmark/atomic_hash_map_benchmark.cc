@@ -0,0 +1,74 @@
+/******************************************************************************
+ * Copyright 2021 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "cyber/base/atomic_hash_map.h"
+
+#include <cstdint>
+
+#include "benchmark/benchmark.h"
+
+namespace apollo {
+namespace cyber {
+namespace base {
+
+constexpr uint64_t kKeySpace = 1024;
+
+void BM_Set(benchmark::State& state) {
+  AtomicHashMap<uint64_t, uint64_t> map;
+  uint64_t key = 0;
+  for (auto _ : state) {
+    map.Set(key % kKeySpace, key);
+    ++key;
+  }
+}
+BENCHMARK(BM_Set);
+
+void BM_Get(benchmark::State& state) {
+  AtomicHashMap<uint64_t, uint64_t> map;
+  for (uint64_t key = 0; key < kKeySpace; ++key) {
+    map.Set(key, key);
+  }
+  uint64_t key = 0;
+  for (auto _ : state) {
+    uint64_t value = 0;
+    map.Get(key % kKeySpace, &value);
+    benchmark::DoNotOptimize(value);
+    ++key;
+  }
+}
+BENCHMARK(BM_Get);
+
+void BM_GetConcurrent(benchmark::State& state) {
+  static AtomicHashMap<uint64_t, uint64_t>* map = [] {
+    auto* instance = new AtomicHashMap<uint64_t, uint64_t>();
+    for (uint64_t key = 0; key < kKeySpace; ++key) {
+      instance->Set(key, key);
+    }
+    return instance;
+  }();
+  uint64_t key = static_cast<uint64_t>(state.thread_index);
+  for (auto _ : state) {
+    uint64_t value = 0;
+    map->Get(key % kKeySpace, &value);
+    benchmark::DoNotOptimize(value);
+    ++key;
+  }
+}
+BENCHMARK(BM_GetConcurrent)->Threads(2)->Threads(4)->Threads(8);
+
+}  // namespace base
+}  // namespace cyber
+}  // namespace apollo
@@ -0,0 +1,73 @@
+/******************************************************************************
+ * Copyright 2021 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "cyber/base/bounded_queue.h"
+
+#include <cstdint>
+
+#include "benchmark/benchmark.h"
+
+namespace apollo {
+namespace cyber {
+namespace base {
+
+void BM_Enqueue(benchmark::State& state) {
+  BoundedQueue<uint64_t> queue;
+  queue.Init(static_cast<uint64_t>(state.range(0)));
+  uint64_t value = 0;
+  for (auto _ : state) {
+    if (!queue.Enqueue(value)) {
+      // drain so the producer path stays hot instead of failing
+      state.PauseTiming();
+      while (queue.Dequeue(&value)) {
+      }
+      state.ResumeTiming();
+    }
+    ++value;
+  }
+}
+BENCHMARK(BM_Enqueue)->Arg(1024)->Arg(65536);
+
+void BM_EnqueueDequeuePair(benchmark::State& state) {
+  BoundedQueue<uint64_t> queue;
+  queue.Init(1024);
+  for (auto _ : state) {
+    queue.Enqueue(1);
+    uint64_t value = 0;
+    queue.Dequeue(&value);
+    benchmark::DoNotOptimize(value);
+  }
+}
+BENCHMARK(BM_EnqueueDequeuePair);
+
+void BM_EnqueueDequeueConcurrent(benchmark::State& state) {
+  static BoundedQueue<uint64_t>* queue = [] {
+    auto* instance = new BoundedQueue<uint64_t>();
+    instance->Init(65536);
+    return instance;
+  }();
+  for (auto _ : state) {
+    queue->Enqueue(1);
+    uint64_t value = 0;
+    queue->Dequeue(&value);
+    benchmark::DoNotOptimize(value);
+  }
+}
+BENCHMARK(BM_EnqueueDequeueConcurrent)->Threads(2)->Threads(4)->Threads(8);
+
+}  // namespace base
+}  // namespace cyber
+}  // namespace apollo
@@ -0,0 +1,86 @@
+/******************************************************************************
+ * Copyright 2021 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "cyber/scheduler/scheduler_factory.h"
+
+#include <atomic>
+#include <string>
+#include <thread>
+
+#include "benchmark/benchmark.h"
+
+#include "cyber/common/global_data.h"
+#include "cyber/croutine/croutine.h"
+#include "cyber/init.h"
+
+namespace apollo {
+namespace cyber {
+namespace scheduler {
+
+// Cost of dispatching a new croutine to a processor and tearing it down.
+void BM_CreateRemoveTask(benchmark::State& state) {
+  auto* sched = Instance();
+  const std::string task_name = "bench_create_remove";
+  for (auto _ : state) {
+    sched->CreateTask([]() {}, task_name);
+    sched->RemoveTask(task_name);
+  }
+}
+BENCHMARK(BM_CreateRemoveTask);
+
+// Wake-up latency of a parked task: one iteration notifies the croutine
+// and spins until a processor has actually run it.
+void BM_NotifyTask(benchmark::State& state) {
+  auto* sched = Instance();
+  const std::string task_name = "bench_notify";
+  std::atomic<uint64_t> runs(0);
+  sched->CreateTask(
+      [&runs]() {
+        while (true) {
+          runs.fetch_add(1, std::memory_order_release);
+          croutine::CRoutine::Yield(croutine::RoutineState::DATA_WAIT);
+        }
+      },
+      task_name);
+  const uint64_t task_id = common::GlobalData::RegisterTaskName(task_name);
+
+  // wait for the initial dispatch to park the croutine
+  while (runs.load(std::memory_order_acquire) == 0) {
+    std::this_thread::yield();
+  }
+
+  uint64_t expected = runs.load(std::memory_order_acquire);
+  for (auto _ : state) {
+    sched->NotifyTask(task_id);
+    ++expected;
+    while (runs.load(std::memory_order_acquire) < expected) {
+      std::this_thread::yield();
+    }
+  }
+  sched->RemoveTask(task_name);
+}
+BENCHMARK(BM_NotifyTask);
+
+}  // namespace scheduler
+}  // namespace cyber
+}  // namespace apollo
+
+int main(int argc, char** argv) {
+  benchmark::Initialize(&argc, argv);
+  apollo::cyber::Init(argv[0]);
+  benchmark::RunSpecifiedBenchmarks();
+  return 0;
+}
@@ -0,0 +1,98 @@
+/******************************************************************************
+ * Copyright 2021 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "cyber/transport/transport.h"
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+
+#include "benchmark/benchmark.h"
+
+#include "cyber/init.h"
+#include "cyber/proto/unit_test.pb.h"
+#include "cyber/transport/common/identity.h"
+
+namespace apollo {
+namespace cyber {
+namespace transport {
+
+// One iteration transmits a message and spins until the receiver callback
+// has observed it, so the reported time is the full one-way dispatch
+// latency of the selected transport.
+void TransportRoundTrip(benchmark::State& state, const OptionalMode& mode,
+                        const std::string& channel_name,
+                        const int payload_size) {
+  RoleAttributes attr;
+  attr.set_channel_name(channel_name);
+  Identity id;
+  attr.set_id(id.HashValue());
+
+  std::atomic<uint64_t> received(0);
+  auto listener = [&received](const std::shared_ptr<proto::UnitTest>&,
+                              const MessageInfo&, const RoleAttributes&) {
+    received.fetch_add(1, std::memory_order_release);
+  };
+  auto receiver = Transport::Instance()->CreateReceiver<proto::UnitTest>(
+      attr, listener, mode);
+  auto transmitter =
+      Transport::Instance()->CreateTransmitter<proto::UnitTest>(attr, mode);
+
+  auto msg = std::make_shared<proto::UnitTest>();
+  msg->set_class_name("transport_benchmark");
+  msg->set_case_name(std::string(payload_size, 'x'));
+
+  uint64_t expected = 0;
+  for (auto _ : state) {
+    transmitter->Transmit(msg);
+    ++expected;
+    while (received.load(std::memory_order_acquire) < expected) {
+      std::this_thread::yield();
+    }
+  }
+}
+
+void BM_IntraDispatch(benchmark::State& state) {
+  TransportRoundTrip(state, OptionalMode::INTRA, "bench_intra",
+                     static_cast<int>(state.range(0)));
+}
+BENCHMARK(BM_IntraDispatch)->Arg(64)->Arg(4096)->Arg(65536);
+
+void BM_ShmDispatch(benchmark::State& state) {
+  TransportRoundTrip(state, OptionalMode::SHM, "bench_shm",
+                     static_cast<int>(state.range(0)));
+}
+BENCHMARK(BM_ShmDispatch)->Arg(64)->Arg(4096)->Arg(65536);
+
+void BM_RtpsDispatch(benchmark::State& state) {
+  TransportRoundTrip(state, OptionalMode::RTPS, "bench_rtps",
+                     static_cast<int>(state.range(0)));
+}
+BENCHMARK(BM_RtpsDispatch)->Arg(64)->Arg(4096)->Arg(65536);
+
+}  // namespace transport
+}  // namespace cyber
+}  // namespace apollo
+
+int main(int argc, char** argv) {
+  benchmark::Initialize(&argc, argv);
+  apollo::cyber::Init(argv[0]);
+  apollo::cyber::transport::Transport::Instance();
+  benchmark::RunSpecifiedBenchmarks();
+  apollo::cyber::transport::Transport::Instance()->Shutdown();
+  return 0;
+}
@@ -17,9 +17,10 @@
 #ifndef CYBER_BLOCKER_BLOCKER_H_
 #define CYBER_BLOCKER_BLOCKER_H_
 
+#include <algorithm>
 #include <cstddef>
+#include <deque>
 #include <functional>
-#include <list>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -67,10 +68,14 @@ class Blocker : public BlockerBase {
  public:
   using MessageType = T;
   using MessagePtr = std::shared_ptr<T>;
-  using MessageQueue = std::list<MessagePtr>;
+  // The queues are ring-arrays: a deque keeps its elements in contiguous
+  // chunks, so indexed access is O(1) and iteration does not chase
+  // per-node pointers the way the previous std::list did.
+  using MessageQueue = std::deque<MessagePtr>;
   using Callback = std::function<void(const MessagePtr&)>;
   using CallbackMap = std::unordered_map<std::string, Callback>;
-  using Iterator = typename std::list<std::shared_ptr<T>>::const_iterator;
+  using Iterator = typename std::deque<std::shared_ptr<T>>::const_iterator;
+  using TimestampExtractor = std::function<double(const MessageType&)>;
 
   explicit Blocker(const BlockerAttr& attr);
   virtual ~Blocker();
@@ -92,6 +97,18 @@ class Blocker : public BlockerBase {
   const MessagePtr GetOldestObservedPtr() const;
   const MessagePtr GetLatestPublishedPtr() const;
 
+  // Indexed access into the observed history. Index 0 is the latest
+  // observed message; returns nullptr when out of range.
+  const MessagePtr GetObservedPtr(size_t index) const;
+  size_t ObservedSize() const;
+
+  // Binary-search the observed history for the newest message whose
+  // extracted timestamp is less than or equal to 'timestamp'. Requires
+  // messages to have been published in non-decreasing timestamp order;
+  // returns nullptr when every observed message is newer.
+  const MessagePtr FindObservedAtOrBefore(
+      double timestamp, const TimestampExtractor& extractor) const;
+
   Iterator ObservedBegin() const;
   Iterator ObservedEnd() const;
 
@@ -232,6 +249,39 @@ auto Blocker<T>::GetLatestPublishedPtr() const -> const MessagePtr {
   return published_msg_queue_.front();
 }
 
+template <typename T>
+auto Blocker<T>::GetObservedPtr(size_t index) const -> const MessagePtr {
+  std::lock_guard<std::mutex> lock(msg_mutex_);
+  if (index >= observed_msg_queue_.size()) {
+    return nullptr;
+  }
+  return observed_msg_queue_[index];
+}
+
+template <typename T>
+size_t Blocker<T>::ObservedSize() const {
+  std::lock_guard<std::mutex> lock(msg_mutex_);
+  return observed_msg_queue_.size();
+}
+
+template <typename T>
+auto Blocker<T>::FindObservedAtOrBefore(
+    double timestamp, const TimestampExtractor& extractor) const
+    -> const MessagePtr {
+  std::lock_guard<std::mutex> lock(msg_mutex_);
+  // The queue is ordered newest first, so extracted timestamps are
+  // non-increasing from begin() to end().
+  auto it = std::lower_bound(
+      observed_msg_queue_.begin(), observed_msg_queue_.end(), timestamp,
+      [&extractor](const MessagePtr& msg, double ts) {
+        return extractor(*msg) > ts;
+      });
+  if (it == observed_msg_queue_.end()) {
+    return nullptr;
+  }
+  return *it;
+}
+
 template <typename T>
 auto Blocker<T>::ObservedBegin() const -> Iterator {
   return observed_msg_queue_.begin();
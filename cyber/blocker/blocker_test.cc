@@ -17,6 +17,7 @@
 #include "cyber/blocker/blocker.h"
 
 #include <memory>
+#include <string>
 #include "gtest/gtest.h"
 
 #include "cyber/proto/unit_test.pb.h"
@@ -96,6 +97,49 @@ TEST(BlockerTest, publish) {
   EXPECT_TRUE(blocker.IsObservedEmpty());
 }
 
+TEST(BlockerTest, indexed_access) {
+  BlockerAttr attr(10, "channel");
+  Blocker<UnitTest> blocker(attr);
+
+  for (int i = 0; i < 3; ++i) {
+    auto msg = std::make_shared<UnitTest>();
+    msg->set_class_name("BlockerTest");
+    msg->set_case_name("publish_" + std::to_string(i));
+    blocker.Publish(msg);
+  }
+  blocker.Observe();
+
+  EXPECT_EQ(blocker.ObservedSize(), 3);
+  EXPECT_EQ(blocker.GetObservedPtr(0)->case_name(), "publish_2");
+  EXPECT_EQ(blocker.GetObservedPtr(2)->case_name(), "publish_0");
+  EXPECT_EQ(blocker.GetObservedPtr(3), nullptr);
+}
+
+TEST(BlockerTest, find_observed_at_or_before) {
+  BlockerAttr attr(10, "channel");
+  Blocker<UnitTest> blocker(attr);
+
+  auto extractor = [](const UnitTest& msg) {
+    return std::stod(msg.case_name());
+  };
+  EXPECT_EQ(blocker.FindObservedAtOrBefore(1.0, extractor), nullptr);
+
+  for (int i = 0; i < 5; ++i) {
+    auto msg = std::make_shared<UnitTest>();
+    msg->set_class_name("BlockerTest");
+    msg->set_case_name(std::to_string(i * 2));
+    blocker.Publish(msg);
+  }
+  blocker.Observe();
+
+  EXPECT_EQ(blocker.FindObservedAtOrBefore(-1.0, extractor), nullptr);
+  EXPECT_EQ(blocker.FindObservedAtOrBefore(0.0, extractor)->case_name(), "0");
+  EXPECT_EQ(blocker.FindObservedAtOrBefore(5.0, extractor)->case_name(), "4");
+  EXPECT_EQ(blocker.FindObservedAtOrBefore(6.0, extractor)->case_name(), "6");
+  EXPECT_EQ(blocker.FindObservedAtOrBefore(100.0, extractor)->case_name(),
+            "8");
+}
+
 TEST(BlockerTest, subscribe) {
   BlockerAttr attr(10, "channel");
   Blocker<UnitTest> blocker(attr);
@@ -15,6 +15,8 @@
  *****************************************************************************/
 #include "cyber/class_loader/class_loader.h"
 
+#include "cyber/class_loader/utility/registry_manifest.h"
+
 namespace apollo {
 namespace cyber {
 namespace class_loader {
@@ -22,7 +24,12 @@ ClassLoader::ClassLoader(const std::string& library_path)
     : library_path_(library_path),
       loadlib_ref_count_(0),
       classobj_ref_count_(0) {
-  LoadLibrary();
+  // When the registry manifest already describes this library, class
+  // validity queries are answered from the manifest and the dlopen is
+  // deferred until the first instantiation (see CreateClassObj).
+  if (!utility::IsLibraryInManifest(library_path)) {
+    LoadLibrary();
+  }
 }
 
 ClassLoader::~ClassLoader() { UnloadLibrary(); }
@@ -24,6 +24,7 @@
 #include <vector>
 
 #include "cyber/class_loader/class_loader_register_macro.h"
+#include "cyber/class_loader/utility/registry_manifest.h"
 
 namespace apollo {
 namespace cyber {
@@ -62,6 +63,15 @@ class ClassLoader {
 
 template <typename Base>
 std::vector<std::string> ClassLoader::GetValidClassNames() {
+  if (!IsLibraryLoaded()) {
+    // Library load deferred by the registry manifest: answer from the
+    // cached registration list without touching the dynamic linker.
+    std::vector<std::string> classes;
+    if (utility::LookupManifest(library_path_, typeid(Base).name(),
+                                &classes)) {
+      return classes;
+    }
+  }
   return (utility::GetValidClassNames<Base>(this));
 }
 
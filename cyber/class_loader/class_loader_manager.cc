@@ -25,10 +25,12 @@ ClassLoaderManager::~ClassLoaderManager() {}
 
 ClassLoader* ClassLoaderManager::GetClassLoaderByLibPath(
     const std::string& library_path) {
+  std::lock_guard<std::recursive_mutex> lock(libpath_loader_map_mutex_);
   return libpath_loader_map_[library_path];
 }
 
 std::vector<ClassLoader*> ClassLoaderManager::GetAllValidClassLoaders() {
+  std::lock_guard<std::recursive_mutex> lock(libpath_loader_map_mutex_);
   std::vector<ClassLoader*> class_loaders;
   for (auto& lib_class_loader : libpath_loader_map_) {
     class_loaders.emplace_back(lib_class_loader.second);
@@ -37,6 +39,7 @@ std::vector<ClassLoader*> ClassLoaderManager::GetAllValidClassLoaders() {
 }
 
 std::vector<std::string> ClassLoaderManager::GetAllValidLibPath() {
+  std::lock_guard<std::recursive_mutex> lock(libpath_loader_map_mutex_);
   std::vector<std::string> libpath;
   for (auto& lib_class_loader : libpath_loader_map_) {
     if (lib_class_loader.second != nullptr) {
@@ -54,7 +57,7 @@ bool ClassLoaderManager::IsLibraryValid(const std::string& library_name) {
 }
 
 bool ClassLoaderManager::LoadLibrary(const std::string& library_path) {
-  std::lock_guard<std::mutex> lck(libpath_loader_map_mutex_);
+  std::lock_guard<std::recursive_mutex> lck(libpath_loader_map_mutex_);
   if (!IsLibraryValid(library_path)) {
     libpath_loader_map_[library_path] =
         new class_loader::ClassLoader(library_path);
@@ -63,6 +66,7 @@ bool ClassLoaderManager::LoadLibrary(const std::string& library_path) {
 }
 
 int ClassLoaderManager::UnloadLibrary(const std::string& library_path) {
+  std::lock_guard<std::recursive_mutex> lck(libpath_loader_map_mutex_);
   int num_remain_unload = 0;
   if (IsLibraryValid(library_path)) {
     ClassLoader* class_loader = GetClassLoaderByLibPath(library_path);
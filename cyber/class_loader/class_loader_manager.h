@@ -54,7 +54,11 @@ class ClassLoaderManager {
   int UnloadLibrary(const std::string& library_path);
 
  private:
-  std::mutex libpath_loader_map_mutex_;
+  // Recursive so that the loaded-library queries can be reused from
+  // inside the locked load/unload paths. All accesses to
+  // libpath_loader_map_ take this mutex, which makes the manager safe
+  // for concurrent library loading during parallel module init.
+  std::recursive_mutex libpath_loader_map_mutex_;
   std::map<std::string, ClassLoader*> libpath_loader_map_;
 };
 
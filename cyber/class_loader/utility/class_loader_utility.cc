@@ -17,6 +17,7 @@
 #include "cyber/class_loader/utility/class_loader_utility.h"
 
 #include "cyber/class_loader/class_loader.h"
+#include "cyber/class_loader/utility/registry_manifest.h"
 
 namespace apollo {
 namespace cyber {
@@ -194,6 +195,14 @@ bool IsLibraryLoaded(const std::string& library_path,
 }
 
 bool LoadLibrary(const std::string& library_path, ClassLoader* loader) {
+  // The whole load is serialized so that concurrent loads issued by
+  // parallel module initialization cannot dlopen the same library twice:
+  // the loaded-library check stays atomic with the dlopen and the
+  // bookkeeping below, and the current-loader/current-library globals
+  // used during class registration are protected.
+  static std::recursive_mutex loader_mutex;
+  std::lock_guard<std::recursive_mutex> lock(loader_mutex);
+
   if (IsLibraryLoadedByAnybody(library_path)) {
     AINFO << "lib has been loaded by others,only attach to class factory obj."
           << library_path;
@@ -206,32 +215,33 @@ bool LoadLibrary(const std::string& library_path, ClassLoader* loader) {
   }
 
   PocoLibraryPtr poco_library = nullptr;
-  static std::recursive_mutex loader_mutex;
-  {
-    std::lock_guard<std::recursive_mutex> lck(loader_mutex);
-
-    try {
-      SetCurActiveClassLoader(loader);
-      SetCurLoadingLibraryName(library_path);
-      poco_library = PocoLibraryPtr(new Poco::SharedLibrary(library_path));
-    } catch (const Poco::LibraryLoadException& e) {
-      SetCurLoadingLibraryName("");
-      SetCurActiveClassLoader(nullptr);
-      AERROR << "poco LibraryLoadException: " << e.message();
-    } catch (const Poco::LibraryAlreadyLoadedException& e) {
-      SetCurLoadingLibraryName("");
-      SetCurActiveClassLoader(nullptr);
-      AERROR << "poco LibraryAlreadyLoadedException: " << e.message();
-    } catch (const Poco::NotFoundException& e) {
-      SetCurLoadingLibraryName("");
-      SetCurActiveClassLoader(nullptr);
-      AERROR << "poco NotFoundException: " << e.message();
-    }
-
+  // RTLD_GLOBAL is the historical default; --class_loader_rtld_local keeps
+  // the library's symbols out of the global namespace so that processes
+  // loading overlapping dependency chains do not interpose on each other.
+  const int load_flags =
+      FLAGS_class_loader_rtld_local ? Poco::SharedLibrary::SHLIB_LOCAL : 0;
+  try {
+    SetCurActiveClassLoader(loader);
+    SetCurLoadingLibraryName(library_path);
+    poco_library =
+        PocoLibraryPtr(new Poco::SharedLibrary(library_path, load_flags));
+  } catch (const Poco::LibraryLoadException& e) {
+    SetCurLoadingLibraryName("");
+    SetCurActiveClassLoader(nullptr);
+    AERROR << "poco LibraryLoadException: " << e.message();
+  } catch (const Poco::LibraryAlreadyLoadedException& e) {
     SetCurLoadingLibraryName("");
     SetCurActiveClassLoader(nullptr);
+    AERROR << "poco LibraryAlreadyLoadedException: " << e.message();
+  } catch (const Poco::NotFoundException& e) {
+    SetCurLoadingLibraryName("");
+    SetCurActiveClassLoader(nullptr);
+    AERROR << "poco NotFoundException: " << e.message();
   }
 
+  SetCurLoadingLibraryName("");
+  SetCurActiveClassLoader(nullptr);
+
   if (poco_library == nullptr) {
     AERROR << "poco shared library failed: " << library_path;
     return false;
@@ -242,10 +252,14 @@ bool LoadLibrary(const std::string& library_path, ClassLoader* loader) {
     AWARN << "Class factory objs counts is 0, maybe registerclass failed.";
   }
 
-  std::lock_guard<std::recursive_mutex> lck(GetLibPathPocoShareLibMutex());
-  LibpathPocolibVector& opened_libraries = GetLibPathPocoShareLibVector();
-  opened_libraries.emplace_back(
-      std::pair<std::string, PocoLibraryPtr>(library_path, poco_library));
+  {
+    std::lock_guard<std::recursive_mutex> lck(GetLibPathPocoShareLibMutex());
+    LibpathPocolibVector& opened_libraries = GetLibPathPocoShareLibVector();
+    opened_libraries.emplace_back(
+        std::pair<std::string, PocoLibraryPtr>(library_path, poco_library));
+  }
+  // let sibling processes skip this registration walk next bring-up
+  UpdateManifest(library_path);
   return true;
 }
 
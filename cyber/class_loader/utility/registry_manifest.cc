@@ -0,0 +1,179 @@
+/******************************************************************************
+ * Copyright 2021 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "cyber/class_loader/utility/registry_manifest.h"
+
+#include <sys/file.h>
+#include <unistd.h>
+
+#include <cstdio>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <set>
+#include <sstream>
+#include <utility>
+
+#include "cyber/class_loader/utility/class_loader_utility.h"
+
+DEFINE_string(class_loader_manifest, "",
+              "Path of the shared library-to-class-factory manifest; empty "
+              "disables the registry cache and every library is dlopened "
+              "eagerly.");
+DEFINE_bool(class_loader_rtld_local, false,
+            "Load component libraries RTLD_LOCAL instead of the default "
+            "RTLD_GLOBAL, keeping their symbols out of the global namespace "
+            "of processes that share overlapping dependency chains.");
+
+namespace apollo {
+namespace cyber {
+namespace class_loader {
+namespace utility {
+
+namespace {
+
+// library path -> base class typeid name -> registered class names
+using ManifestMap = std::map<std::string, std::map<std::string,
+                                                   std::set<std::string>>>;
+
+std::mutex& ManifestMutex() {
+  static std::mutex m;
+  return m;
+}
+
+void ParseManifestLine(const std::string& line, ManifestMap* manifest) {
+  std::istringstream iss(line);
+  std::string library_path;
+  std::string base_name;
+  std::string class_name;
+  if (std::getline(iss, library_path, '\t') &&
+      std::getline(iss, base_name, '\t') && std::getline(iss, class_name)) {
+    (*manifest)[library_path][base_name].insert(class_name);
+  }
+}
+
+// The manifest is read once per process; libraries loaded afterwards are
+// merged in by UpdateManifest.
+ManifestMap& GetManifestMap() {
+  static ManifestMap manifest;
+  static std::once_flag load_once;
+  std::call_once(load_once, []() {
+    if (!ManifestEnabled()) {
+      return;
+    }
+    std::ifstream ifs(FLAGS_class_loader_manifest);
+    if (!ifs) {
+      AINFO << "class loader manifest not found, will be created: "
+            << FLAGS_class_loader_manifest;
+      return;
+    }
+    std::string line;
+    while (std::getline(ifs, line)) {
+      ParseManifestLine(line, &manifest);
+    }
+    AINFO << "class loader manifest loaded, " << manifest.size()
+          << " libraries: " << FLAGS_class_loader_manifest;
+  });
+  return manifest;
+}
+
+}  // namespace
+
+bool ManifestEnabled() { return !FLAGS_class_loader_manifest.empty(); }
+
+bool IsLibraryInManifest(const std::string& library_path) {
+  if (!ManifestEnabled()) {
+    return false;
+  }
+  std::lock_guard<std::mutex> lock(ManifestMutex());
+  const ManifestMap& manifest = GetManifestMap();
+  return manifest.find(library_path) != manifest.end();
+}
+
+bool LookupManifest(const std::string& library_path,
+                    const std::string& typeid_base_class_name,
+                    std::vector<std::string>* class_names) {
+  if (!ManifestEnabled()) {
+    return false;
+  }
+  std::lock_guard<std::mutex> lock(ManifestMutex());
+  const ManifestMap& manifest = GetManifestMap();
+  auto library_itr = manifest.find(library_path);
+  if (library_itr == manifest.end()) {
+    return false;
+  }
+  auto base_itr = library_itr->second.find(typeid_base_class_name);
+  if (base_itr != library_itr->second.end()) {
+    class_names->assign(base_itr->second.begin(), base_itr->second.end());
+  }
+  return true;
+}
+
+void UpdateManifest(const std::string& library_path) {
+  if (!ManifestEnabled()) {
+    return;
+  }
+  // Collect what the library just registered, keyed the same way class
+  // factory lookups are: by the base class typeid name.
+  std::vector<std::pair<std::string, std::string>> entries;
+  {
+    std::lock_guard<std::recursive_mutex> lck(GetClassFactoryMapMapMutex());
+    for (auto& baseclass_map : GetClassFactoryMapMap()) {
+      for (auto& class_factory : baseclass_map.second) {
+        if (class_factory.second->GetRelativeLibraryPath() == library_path) {
+          entries.emplace_back(baseclass_map.first, class_factory.first);
+        }
+      }
+    }
+  }
+  if (entries.empty()) {
+    return;
+  }
+
+  std::lock_guard<std::mutex> lock(ManifestMutex());
+  ManifestMap& manifest = GetManifestMap();
+  auto& library_entry = manifest[library_path];
+  std::ostringstream new_lines;
+  for (const auto& entry : entries) {
+    if (library_entry[entry.first].insert(entry.second).second) {
+      new_lines << library_path << '\t' << entry.first << '\t' << entry.second
+                << '\n';
+    }
+  }
+  const std::string lines = new_lines.str();
+  if (lines.empty()) {
+    return;
+  }
+
+  // Serialize appends across the mainboard processes with an flock; each
+  // line is self-contained so interleaved writers stay parseable.
+  std::FILE* file = std::fopen(FLAGS_class_loader_manifest.c_str(), "a");
+  if (file == nullptr) {
+    AWARN << "cannot append to class loader manifest: "
+          << FLAGS_class_loader_manifest;
+    return;
+  }
+  flock(fileno(file), LOCK_EX);
+  std::fwrite(lines.data(), 1, lines.size(), file);
+  std::fflush(file);
+  flock(fileno(file), LOCK_UN);
+  std::fclose(file);
+}
+
+}  // namespace utility
+}  // namespace class_loader
+}  // namespace cyber
+}  // namespace apollo
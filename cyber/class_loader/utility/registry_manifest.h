@@ -0,0 +1,67 @@
+/******************************************************************************
+ * Copyright 2021 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#ifndef CYBER_CLASS_LOADER_UTILITY_REGISTRY_MANIFEST_H_
+#define CYBER_CLASS_LOADER_UTILITY_REGISTRY_MANIFEST_H_
+
+#include <string>
+#include <vector>
+
+#include "cyber/common/log.h"
+
+DECLARE_string(class_loader_manifest);
+DECLARE_bool(class_loader_rtld_local);
+
+/**
+ * Shared registry cache for the class loader. The manifest file maps each
+ * component library to the class factories it registers, keyed by the
+ * typeid name of the base class. With a populated manifest a ClassLoader
+ * can answer class validity queries without dlopening the library, so the
+ * dlopen (and its relocation work) is deferred until a class is actually
+ * instantiated; across the mainboard process set only the libraries a
+ * process really uses get mapped. The first process to load a library
+ * appends its entries under an exclusive flock, so concurrent bring-up is
+ * safe and later processes start with a warm cache.
+ */
+namespace apollo {
+namespace cyber {
+namespace class_loader {
+namespace utility {
+
+// Whether --class_loader_manifest points at a manifest file.
+bool ManifestEnabled();
+
+// True when the manifest has entries for the library, meaning the dlopen
+// can be deferred until the first instantiation.
+bool IsLibraryInManifest(const std::string& library_path);
+
+// Fill class_names with the classes the library registers for the given
+// base class typeid name. Returns false when the library is not covered
+// by the manifest.
+bool LookupManifest(const std::string& library_path,
+                    const std::string& typeid_base_class_name,
+                    std::vector<std::string>* class_names);
+
+// Record the factories the freshly loaded library registered. Appends
+// only missing entries, under an exclusive lock on the manifest file.
+void UpdateManifest(const std::string& library_path);
+
+}  // namespace utility
+}  // namespace class_loader
+}  // namespace cyber
+}  // namespace apollo
+
+#endif  // CYBER_CLASS_LOADER_UTILITY_REGISTRY_MANIFEST_H_
@@ -66,7 +66,14 @@ CRoutine::CRoutine(const std::function<void()> &func) : func_(func) {
   updated_.test_and_set(std::memory_order_release);
 }
 
-CRoutine::~CRoutine() { context_ = nullptr; }
+CRoutine::~CRoutine() {
+  if (context_ != nullptr) {
+    // Drop the dirty stack pages before the context goes back to the pool,
+    // otherwise every recycled context keeps its high-water stack resident.
+    ReclaimStack(context_.get());
+    context_ = nullptr;
+  }
+}
 
 RoutineState CRoutine::Resume() {
   if (cyber_unlikely(force_stop_)) {
@@ -79,9 +86,25 @@ RoutineState CRoutine::Resume() {
     return state_;
   }
 
+  const auto enter_time = std::chrono::steady_clock::now();
+  wait_time_ns_.fetch_add(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(enter_time -
+                                                           last_exit_time_)
+          .count(),
+      std::memory_order_relaxed);
+
   current_routine_ = this;
   SwapContext(GetMainStack(), GetStack());
   current_routine_ = nullptr;
+
+  const auto exit_time = std::chrono::steady_clock::now();
+  exec_time_ns_.fetch_add(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(exit_time -
+                                                           enter_time)
+          .count(),
+      std::memory_order_relaxed);
+  switch_count_.fetch_add(1, std::memory_order_relaxed);
+  last_exit_time_ = exit_time;
   return state_;
 }
 
@@ -88,6 +88,12 @@ class CRoutine {
 
   std::chrono::steady_clock::time_point wake_time() const;
 
+  // statistics; written only by the processor thread inside Resume(), atomic
+  // so the sysmo thread can read a consistent snapshot concurrently
+  uint64_t exec_time_ns() const;
+  uint64_t wait_time_ns() const;
+  uint64_t switch_count() const;
+
   void set_group_name(const std::string &group_name) {
     group_name_ = group_name;
   }
@@ -116,6 +122,12 @@ class CRoutine {
   uint32_t priority_ = 0;
   uint64_t id_ = 0;
 
+  std::atomic<uint64_t> exec_time_ns_ = {0};
+  std::atomic<uint64_t> wait_time_ns_ = {0};
+  std::atomic<uint64_t> switch_count_ = {0};
+  std::chrono::steady_clock::time_point last_exit_time_ =
+      std::chrono::steady_clock::now();
+
   std::string group_name_;
 
   static thread_local CRoutine *current_routine_;
@@ -159,6 +171,18 @@ inline void CRoutine::Sleep(const Duration &sleep_duration) {
   CRoutine::Yield(RoutineState::SLEEP);
 }
 
+inline uint64_t CRoutine::exec_time_ns() const {
+  return exec_time_ns_.load(std::memory_order_relaxed);
+}
+
+inline uint64_t CRoutine::wait_time_ns() const {
+  return wait_time_ns_.load(std::memory_order_relaxed);
+}
+
+inline uint64_t CRoutine::switch_count() const {
+  return switch_count_.load(std::memory_order_relaxed);
+}
+
 inline uint64_t CRoutine::id() const { return id_; }
 
 inline void CRoutine::set_id(uint64_t id) { id_ = id; }
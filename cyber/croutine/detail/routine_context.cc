@@ -16,6 +16,12 @@
 
 #include "cyber/croutine/detail/routine_context.h"
 
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstdint>
+
 namespace apollo {
 namespace cyber {
 namespace croutine {
@@ -50,6 +56,21 @@ void MakeContext(const func &f1, const void *arg, RoutineContext *ctx) {
   *reinterpret_cast<void **>(sp) = const_cast<void *>(arg);
 }
 
+void ReclaimStack(RoutineContext *ctx) {
+  static const uintptr_t page_size = sysconf(_SC_PAGESIZE);
+  // The stack member is not page aligned, only drop whole pages inside it.
+  uintptr_t begin = reinterpret_cast<uintptr_t>(ctx->stack);
+  uintptr_t aligned_begin = (begin + page_size - 1) & ~(page_size - 1);
+  uintptr_t aligned_end = (begin + STACK_SIZE) & ~(page_size - 1);
+  if (aligned_end <= aligned_begin) {
+    return;
+  }
+  if (madvise(reinterpret_cast<void *>(aligned_begin),
+              aligned_end - aligned_begin, MADV_DONTNEED) != 0) {
+    ADEBUG << "madvise stack failed, errno: " << errno;
+  }
+}
+
 }  // namespace croutine
 }  // namespace cyber
 }  // namespace apollo
@@ -50,6 +50,12 @@ struct RoutineContext {
 
 void MakeContext(const func& f1, const void* arg, RoutineContext* ctx);
 
+// Returns the dirty stack pages of a finished routine to the kernel with
+// madvise(MADV_DONTNEED), so recycled contexts do not pin one high-water
+// stack worth of RSS each. The zero pages fault back in lazily if the
+// context is reused.
+void ReclaimStack(RoutineContext* ctx);
+
 inline void SwapContext(char** src_sp, char** dest_sp) {
   ctx_swap(reinterpret_cast<void**>(src_sp), reinterpret_cast<void**>(dest_sp));
 }
@@ -22,10 +22,18 @@
 #include <mutex>
 #include <vector>
 
+#include "cyber/time/time.h"
+
 namespace apollo {
 namespace cyber {
 namespace data {
 
+// How Fill behaves when the buffer is full.
+enum class DropPolicy {
+  DROP_OLDEST = 0,  // overwrite the oldest entry (default)
+  DROP_NEWEST = 1,  // keep queued entries and drop the incoming one
+};
+
 template <typename T>
 class CacheBuffer {
  public:
@@ -45,6 +53,10 @@ class CacheBuffer {
     buffer_ = rhs.buffer_;
     capacity_ = rhs.capacity_;
     fusion_callback_ = rhs.fusion_callback_;
+    drop_policy_ = rhs.drop_policy_;
+    deadline_ns_ = rhs.deadline_ns_;
+    fill_time_ = rhs.fill_time_;
+    dropped_num_ = rhs.dropped_num_;
   }
 
   T& operator[](const uint64_t& pos) { return buffer_[GetIndex(pos)]; }
@@ -65,18 +77,44 @@ class CacheBuffer {
     fusion_callback_ = callback;
   }
 
+  void SetDropPolicy(DropPolicy policy) { drop_policy_ = policy; }
+  DropPolicy GetDropPolicy() const { return drop_policy_; }
+
+  // Entries queued for longer than deadline_ns are dropped on the next
+  // Fill; 0 disables the deadline.
+  void SetMessageDeadline(uint64_t deadline_ns) {
+    deadline_ns_ = deadline_ns;
+    if (deadline_ns_ > 0 && fill_time_.size() != capacity_) {
+      fill_time_.resize(capacity_, 0);
+    }
+  }
+  uint64_t GetMessageDeadline() const { return deadline_ns_; }
+
+  uint64_t GetDroppedNum() const { return dropped_num_; }
+
   void Fill(const T& value) {
     if (fusion_callback_) {
       fusion_callback_(value);
     } else {
+      if (deadline_ns_ > 0) {
+        DropExpired(Time::Now().ToNanosecond());
+      }
       if (Full()) {
+        if (drop_policy_ == DropPolicy::DROP_NEWEST) {
+          ++dropped_num_;
+          return;
+        }
         buffer_[GetIndex(head_)] = value;
         ++head_;
         ++tail_;
+        ++dropped_num_;
       } else {
         buffer_[GetIndex(tail_ + 1)] = value;
         ++tail_;
       }
+      if (deadline_ns_ > 0) {
+        fill_time_[GetIndex(tail_)] = Time::Now().ToNanosecond();
+      }
     }
   }
 
@@ -86,12 +124,24 @@ class CacheBuffer {
   CacheBuffer& operator=(const CacheBuffer& other) = delete;
   uint64_t GetIndex(const uint64_t& pos) const { return pos % capacity_; }
 
+  void DropExpired(uint64_t now) {
+    while (tail_ > head_ &&
+           fill_time_[GetIndex(head_ + 1)] + deadline_ns_ < now) {
+      ++head_;
+      ++dropped_num_;
+    }
+  }
+
   uint64_t head_ = 0;
   uint64_t tail_ = 0;
   uint64_t capacity_ = 0;
   std::vector<T> buffer_;
   mutable std::mutex mutex_;
   FusionCallback fusion_callback_;
+  DropPolicy drop_policy_ = DropPolicy::DROP_OLDEST;
+  uint64_t deadline_ns_ = 0;
+  std::vector<uint64_t> fill_time_;
+  uint64_t dropped_num_ = 0;
 };
 
 }  // namespace data
@@ -16,6 +16,7 @@
 
 #include "cyber/data/cache_buffer.h"
 
+#include <chrono>
 #include <mutex>
 #include <thread>
 #include <utility>
@@ -52,6 +53,42 @@ TEST(CacheBufferTest, cache_buffer_test) {
   EXPECT_TRUE(buffer1.Full());
 }
 
+TEST(CacheBufferTest, drop_oldest_counts_drops) {
+  CacheBuffer<int> buffer(2);
+  buffer.Fill(0);
+  buffer.Fill(1);
+  EXPECT_TRUE(buffer.Full());
+  EXPECT_EQ(0, buffer.GetDroppedNum());
+  buffer.Fill(2);
+  EXPECT_EQ(1, buffer.GetDroppedNum());
+  EXPECT_EQ(1, buffer.Front());
+  EXPECT_EQ(2, buffer.Back());
+}
+
+TEST(CacheBufferTest, drop_newest_keeps_queued_entries) {
+  CacheBuffer<int> buffer(2);
+  buffer.SetDropPolicy(DropPolicy::DROP_NEWEST);
+  buffer.Fill(0);
+  buffer.Fill(1);
+  EXPECT_TRUE(buffer.Full());
+  buffer.Fill(2);
+  EXPECT_EQ(1, buffer.GetDroppedNum());
+  EXPECT_EQ(0, buffer.Front());
+  EXPECT_EQ(1, buffer.Back());
+}
+
+TEST(CacheBufferTest, deadline_drops_stale_entries) {
+  CacheBuffer<int> buffer(4);
+  buffer.SetMessageDeadline(1000 * 1000);  // 1ms
+  buffer.Fill(0);
+  buffer.Fill(1);
+  std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  buffer.Fill(2);
+  EXPECT_EQ(2, buffer.GetDroppedNum());
+  EXPECT_EQ(1, buffer.Size());
+  EXPECT_EQ(2, buffer.Back());
+}
+
 }  // namespace data
 }  // namespace cyber
 }  // namespace apollo
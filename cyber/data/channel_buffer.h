@@ -45,6 +45,19 @@ class ChannelBuffer {
 
   bool FetchMulti(uint64_t fetch_size, std::vector<std::shared_ptr<T>>* vec);
 
+  void SetQos(DropPolicy drop_policy, uint64_t deadline_ns) {
+    std::lock_guard<std::mutex> lock(buffer_->Mutex());
+    buffer_->SetDropPolicy(drop_policy);
+    buffer_->SetMessageDeadline(deadline_ns);
+  }
+
+  // number of messages this channel dropped because its buffer was full or
+  // entries overstayed the deadline
+  uint64_t dropped_num() const {
+    std::lock_guard<std::mutex> lock(buffer_->Mutex());
+    return buffer_->GetDroppedNum();
+  }
+
   uint64_t channel_id() const { return channel_id_; }
   std::shared_ptr<BufferType> Buffer() const { return buffer_; }
 
@@ -36,8 +36,19 @@ namespace data {
 struct VisitorConfig {
   VisitorConfig(uint64_t id, uint32_t size)
       : channel_id(id), queue_size(size) {}
+  VisitorConfig(uint64_t id, uint32_t size, DropPolicy policy,
+                uint64_t deadline)
+      : channel_id(id),
+        queue_size(size),
+        drop_policy(policy),
+        deadline_ns(deadline) {}
   uint64_t channel_id;
   uint32_t queue_size;
+  // per channel QoS: how to evict when the buffer is full, and how long a
+  // message may stay queued before it is dropped (0 means no deadline);
+  // defaults keep the historical overwrite-oldest behavior
+  DropPolicy drop_policy = DropPolicy::DROP_OLDEST;
+  uint64_t deadline_ns = 0;
 };
 
 template <typename T>
@@ -56,6 +67,10 @@ class DataVisitor : public DataVisitorBase {
                    new BufferType<M2>(configs[2].queue_size)),
         buffer_m3_(configs[3].channel_id,
                    new BufferType<M3>(configs[3].queue_size)) {
+    buffer_m0_.SetQos(configs[0].drop_policy, configs[0].deadline_ns);
+    buffer_m1_.SetQos(configs[1].drop_policy, configs[1].deadline_ns);
+    buffer_m2_.SetQos(configs[2].drop_policy, configs[2].deadline_ns);
+    buffer_m3_.SetQos(configs[3].drop_policy, configs[3].deadline_ns);
     DataDispatcher<M0>::Instance()->AddBuffer(buffer_m0_);
     DataDispatcher<M1>::Instance()->AddBuffer(buffer_m1_);
     DataDispatcher<M2>::Instance()->AddBuffer(buffer_m2_);
@@ -99,6 +114,9 @@ class DataVisitor<M0, M1, M2, NullType> : public DataVisitorBase {
                    new BufferType<M1>(configs[1].queue_size)),
         buffer_m2_(configs[2].channel_id,
                    new BufferType<M2>(configs[2].queue_size)) {
+    buffer_m0_.SetQos(configs[0].drop_policy, configs[0].deadline_ns);
+    buffer_m1_.SetQos(configs[1].drop_policy, configs[1].deadline_ns);
+    buffer_m2_.SetQos(configs[2].drop_policy, configs[2].deadline_ns);
     DataDispatcher<M0>::Instance()->AddBuffer(buffer_m0_);
     DataDispatcher<M1>::Instance()->AddBuffer(buffer_m1_);
     DataDispatcher<M2>::Instance()->AddBuffer(buffer_m2_);
@@ -138,6 +156,8 @@ class DataVisitor<M0, M1, NullType, NullType> : public DataVisitorBase {
                    new BufferType<M0>(configs[0].queue_size)),
         buffer_m1_(configs[1].channel_id,
                    new BufferType<M1>(configs[1].queue_size)) {
+    buffer_m0_.SetQos(configs[0].drop_policy, configs[0].deadline_ns);
+    buffer_m1_.SetQos(configs[1].drop_policy, configs[1].deadline_ns);
     DataDispatcher<M0>::Instance()->AddBuffer(buffer_m0_);
     DataDispatcher<M1>::Instance()->AddBuffer(buffer_m1_);
     data_notifier_->AddNotifier(buffer_m0_.channel_id(), notifier_);
@@ -170,6 +190,7 @@ class DataVisitor<M0, NullType, NullType, NullType> : public DataVisitorBase {
  public:
   explicit DataVisitor(const VisitorConfig& configs)
       : buffer_(configs.channel_id, new BufferType<M0>(configs.queue_size)) {
+    buffer_.SetQos(configs.drop_policy, configs.deadline_ns);
     DataDispatcher<M0>::Instance()->AddBuffer(buffer_);
     data_notifier_->AddNotifier(buffer_.channel_id(), notifier_);
   }
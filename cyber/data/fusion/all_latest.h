@@ -52,6 +52,9 @@ class AllLatest : public DataFusion<M0, M1, M2, M3> {
         buffer_fusion_(buffer_m0_.channel_id(),
                        new CacheBuffer<std::shared_ptr<FusionDataType>>(
                            buffer_0.Buffer()->Capacity() - uint64_t(1))) {
+    // fused outputs replace raw M0 messages, so they inherit M0's QoS
+    buffer_fusion_.SetQos(buffer_0.Buffer()->GetDropPolicy(),
+                          buffer_0.Buffer()->GetMessageDeadline());
     buffer_m0_.Buffer()->SetFusionCallback(
         [this](const std::shared_ptr<M0>& m0) {
           std::shared_ptr<M1> m1;
@@ -104,6 +107,9 @@ class AllLatest<M0, M1, M2, NullType> : public DataFusion<M0, M1, M2> {
         buffer_fusion_(buffer_m0_.channel_id(),
                        new CacheBuffer<std::shared_ptr<FusionDataType>>(
                            buffer_0.Buffer()->Capacity() - uint64_t(1))) {
+    // fused outputs replace raw M0 messages, so they inherit M0's QoS
+    buffer_fusion_.SetQos(buffer_0.Buffer()->GetDropPolicy(),
+                          buffer_0.Buffer()->GetMessageDeadline());
     buffer_m0_.Buffer()->SetFusionCallback(
         [this](const std::shared_ptr<M0>& m0) {
           std::shared_ptr<M1> m1;
@@ -149,6 +155,9 @@ class AllLatest<M0, M1, NullType, NullType> : public DataFusion<M0, M1> {
         buffer_fusion_(buffer_m0_.channel_id(),
                        new CacheBuffer<std::shared_ptr<FusionDataType>>(
                            buffer_0.Buffer()->Capacity() - uint64_t(1))) {
+    // fused outputs replace raw M0 messages, so they inherit M0's QoS
+    buffer_fusion_.SetQos(buffer_0.Buffer()->GetDropPolicy(),
+                          buffer_0.Buffer()->GetMessageDeadline());
     buffer_m0_.Buffer()->SetFusionCallback(
         [this](const std::shared_ptr<M0>& m0) {
           std::shared_ptr<M1> m1;
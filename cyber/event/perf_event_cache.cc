@@ -17,12 +17,18 @@
 #include "cyber/event/perf_event_cache.h"
 
 #include <string>
+#include <vector>
 
 #include "cyber/common/global_data.h"
 #include "cyber/common/log.h"
 #include "cyber/state.h"
 #include "cyber/time/time.h"
 
+DEFINE_bool(perf_event_binary, false,
+            "capture sched/transport perf events into per-thread lock-free "
+            "rings flushed as fixed-width binary records; low enough overhead "
+            "for production, convert with cyber_perftrace");
+
 namespace apollo {
 namespace cyber {
 namespace event {
@@ -45,11 +51,34 @@ PerfEventCache::PerfEventCache() {
     }
     Start();
   }
+
+  binary_enable_ = FLAGS_perf_event_binary;
+  if (binary_enable_) {
+    StartBinary();
+  }
 }
 
 PerfEventCache::~PerfEventCache() { Shutdown(); }
 
 void PerfEventCache::Shutdown() {
+  if (binary_enable_ && !binary_shutdown_) {
+    binary_shutdown_ = true;
+    if (binary_thread_.joinable()) {
+      binary_thread_.join();
+    }
+    uint64_t dropped = 0;
+    {
+      std::lock_guard<std::mutex> lock(ring_mutex_);
+      for (const auto& ring : rings_) {
+        dropped += ring->Dropped();
+      }
+    }
+    if (dropped > 0) {
+      AWARN << "Binary perf capture dropped " << dropped << " events.";
+    }
+    binary_of_.close();
+  }
+
   if (!enable_) {
     return;
   }
@@ -68,6 +97,17 @@ void PerfEventCache::Shutdown() {
 void PerfEventCache::AddSchedEvent(const SchedPerf event_id,
                                    const uint64_t cr_id, const int proc_id,
                                    const int cr_state) {
+  if (binary_enable_) {
+    BinaryPerfEvent event;
+    event.stamp = Time::Now().ToNanosecond();
+    event.id = cr_id;
+    event.etype = static_cast<int32_t>(EventType::SCHED_EVENT);
+    event.eid = static_cast<int32_t>(event_id);
+    event.proc_id = proc_id;
+    event.cr_state = cr_state;
+    ThreadRing()->TryWrite(event);
+  }
+
   if (!enable_) {
     return;
   }
@@ -92,6 +132,16 @@ void PerfEventCache::AddTransportEvent(const TransPerf event_id,
                                        const uint64_t msg_seq,
                                        const uint64_t stamp,
                                        const std::string& adder) {
+  if (binary_enable_) {
+    BinaryPerfEvent event;
+    event.stamp = (stamp == 0) ? Time::Now().ToNanosecond() : stamp;
+    event.id = channel_id;
+    event.msg_seq = msg_seq;
+    event.etype = static_cast<int32_t>(EventType::TRANS_EVENT);
+    event.eid = static_cast<int32_t>(event_id);
+    ThreadRing()->TryWrite(event);
+  }
+
   if (!enable_) {
     return;
   }
@@ -141,6 +191,83 @@ void PerfEventCache::Start() {
   io_thread_ = std::thread(&PerfEventCache::Run, this);
 }
 
+PerfEventRing* PerfEventCache::ThreadRing() {
+  static thread_local PerfEventRing* ring = nullptr;
+  if (ring == nullptr) {
+    auto new_ring = std::make_shared<PerfEventRing>();
+    std::lock_guard<std::mutex> lock(ring_mutex_);
+    rings_.push_back(new_ring);
+    ring = new_ring.get();
+  }
+  return ring;
+}
+
+void PerfEventCache::StartBinary() {
+  auto now = Time::Now();
+  std::string binary_file = "cyber_perf_" + now.ToString() + ".bperf";
+  std::replace(binary_file.begin(), binary_file.end(), ' ', '_');
+  std::replace(binary_file.begin(), binary_file.end(), ':', '-');
+  binary_of_.open(binary_file, std::ios::trunc | std::ios::binary);
+  binary_of_.write(kBinaryPerfMagic, sizeof(kBinaryPerfMagic) - 1);
+  binary_file_ = binary_file;
+  binary_thread_ = std::thread(&PerfEventCache::RunBinaryFlush, this);
+}
+
+void PerfEventCache::RunBinaryFlush() {
+  std::vector<BinaryPerfEvent> batch(PerfEventRing::kCapacity);
+  while (!binary_shutdown_ && !apollo::cyber::IsShutdown()) {
+    std::this_thread::sleep_for(
+        std::chrono::milliseconds(kBinaryFlushIntervalMs));
+    FlushBinaryRings(&batch);
+  }
+  // final drain so events recorded right before shutdown are kept
+  FlushBinaryRings(&batch);
+  binary_of_.flush();
+}
+
+void PerfEventCache::FlushBinaryRings(
+    std::vector<BinaryPerfEvent>* const batch) {
+  std::vector<std::shared_ptr<PerfEventRing>> rings;
+  {
+    std::lock_guard<std::mutex> lock(ring_mutex_);
+    rings = rings_;
+  }
+  for (const auto& ring : rings) {
+    const uint64_t num = ring->Read(batch->data(), batch->size());
+    if (num == 0) {
+      continue;
+    }
+    for (uint64_t i = 0; i < num; ++i) {
+      WriteNameRecord((*batch)[i]);
+    }
+    binary_of_.write(
+        reinterpret_cast<const char*>(batch->data()),
+        static_cast<std::streamsize>(num * sizeof(BinaryPerfEvent)));
+  }
+}
+
+void PerfEventCache::WriteNameRecord(const BinaryPerfEvent& event) {
+  if (named_ids_.count(event.id) != 0) {
+    return;
+  }
+  named_ids_.insert(event.id);
+  std::string name;
+  if (event.etype == static_cast<int32_t>(EventType::SCHED_EVENT)) {
+    name = GlobalData::GetTaskNameById(event.id);
+  } else {
+    name = GlobalData::GetChannelById(event.id);
+  }
+  if (name.empty()) {
+    return;
+  }
+  BinaryPerfEvent record;
+  record.etype = kPerfNameRecord;
+  record.id = event.id;
+  record.msg_seq = name.size();
+  binary_of_.write(reinterpret_cast<const char*>(&record), sizeof(record));
+  binary_of_.write(name.data(), static_cast<std::streamsize>(name.size()));
+}
+
 }  // namespace event
 }  // namespace cyber
 }  // namespace apollo
@@ -20,12 +20,16 @@
 #include <chrono>
 #include <fstream>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <thread>
+#include <unordered_set>
+#include <vector>
 
 #include "cyber/base/bounded_queue.h"
 #include "cyber/common/macros.h"
 #include "cyber/event/perf_event.h"
+#include "cyber/event/perf_event_ring.h"
 #include "cyber/proto/perf_conf.pb.h"
 
 namespace apollo {
@@ -51,18 +55,35 @@ class PerfEventCache {
   void Start();
   void Run();
 
+  // binary capture path, enabled by --perf_event_binary
+  PerfEventRing* ThreadRing();
+  void StartBinary();
+  void RunBinaryFlush();
+  void FlushBinaryRings(std::vector<BinaryPerfEvent>* const batch);
+  void WriteNameRecord(const BinaryPerfEvent& event);
+
   std::thread io_thread_;
   std::ofstream of_;
 
   bool enable_ = false;
   bool shutdown_ = false;
 
+  bool binary_enable_ = false;
+  bool binary_shutdown_ = false;
+  std::thread binary_thread_;
+  std::ofstream binary_of_;
+  std::string binary_file_ = "";
+  std::mutex ring_mutex_;
+  std::vector<std::shared_ptr<PerfEventRing>> rings_;
+  std::unordered_set<uint64_t> named_ids_;
+
   proto::PerfConf perf_conf_;
   std::string perf_file_ = "";
   base::BoundedQueue<EventBasePtr> event_queue_;
 
   const int kFlushSize = 512;
   const uint64_t kEventQueueSize = 8192;
+  const int kBinaryFlushIntervalMs = 100;
 
   DECLARE_SINGLETON(PerfEventCache)
 };
@@ -0,0 +1,92 @@
+/******************************************************************************
+ * Copyright 2021 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#ifndef CYBER_EVENT_PERF_EVENT_RING_H_
+#define CYBER_EVENT_PERF_EVENT_RING_H_
+
+#include <atomic>
+#include <cstdint>
+
+namespace apollo {
+namespace cyber {
+namespace event {
+
+// magic at the head of binary perf capture files (*.bperf)
+const char kBinaryPerfMagic[] = "CPERF001";
+
+// record type beyond EventType, used only in the binary capture: a name
+// record maps an id hash to its task or channel name
+constexpr int32_t kPerfNameRecord = 100;
+
+// fixed-width record written verbatim to the capture file; for name records
+// msg_seq holds the number of name bytes that follow the record
+struct alignas(8) BinaryPerfEvent {
+  uint64_t stamp = 0;
+  uint64_t id = 0;  // cr_id or channel_id
+  uint64_t msg_seq = 0;
+  int32_t etype = 0;
+  int32_t eid = 0;
+  int32_t proc_id = 0;
+  int32_t cr_state = 0;
+};
+
+/**
+ * @brief Single-producer single-consumer event ring. The owning thread
+ * writes without locks, the flush thread drains in batches; when the ring
+ * is full new events are dropped and counted rather than blocking the
+ * producer.
+ */
+class PerfEventRing {
+ public:
+  static constexpr uint64_t kCapacity = 4096;  // power of two
+
+  bool TryWrite(const BinaryPerfEvent& event) {
+    const uint64_t head = head_.load(std::memory_order_acquire);
+    const uint64_t tail = tail_.load(std::memory_order_relaxed);
+    if (tail - head >= kCapacity) {
+      dropped_.fetch_add(1, std::memory_order_relaxed);
+      return false;
+    }
+    events_[tail & (kCapacity - 1)] = event;
+    tail_.store(tail + 1, std::memory_order_release);
+    return true;
+  }
+
+  uint64_t Read(BinaryPerfEvent* const out, const uint64_t max_num) {
+    const uint64_t tail = tail_.load(std::memory_order_acquire);
+    uint64_t head = head_.load(std::memory_order_relaxed);
+    uint64_t num = 0;
+    while (head < tail && num < max_num) {
+      out[num++] = events_[head++ & (kCapacity - 1)];
+    }
+    head_.store(head, std::memory_order_release);
+    return num;
+  }
+
+  uint64_t Dropped() const { return dropped_.load(std::memory_order_relaxed); }
+
+ private:
+  BinaryPerfEvent events_[kCapacity];
+  std::atomic<uint64_t> head_ = {0};  // advanced by the flush thread
+  std::atomic<uint64_t> tail_ = {0};  // advanced by the owning thread
+  std::atomic<uint64_t> dropped_ = {0};
+};
+
+}  // namespace event
+}  // namespace cyber
+}  // namespace apollo
+
+#endif  // CYBER_EVENT_PERF_EVENT_RING_H_
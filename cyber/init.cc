@@ -22,16 +22,20 @@
 #include <csignal>
 #include <cstdio>
 #include <ctime>
+#include <memory>
 #include <string>
 
 #include "cyber/binary.h"
 #include "cyber/common/global_data.h"
 #include "cyber/data/data_dispatcher.h"
 #include "cyber/logger/async_logger.h"
+#include "cyber/proto/clock.pb.h"
 #include "cyber/scheduler/scheduler.h"
 #include "cyber/service_discovery/topology_manager.h"
 #include "cyber/sysmo/sysmo.h"
 #include "cyber/task/task.h"
+#include "cyber/time/clock.h"
+#include "cyber/time/tsc_clock.h"
 #include "cyber/timer/timing_wheel.h"
 #include "cyber/transport/transport.h"
 
@@ -43,9 +47,34 @@ using apollo::cyber::service_discovery::TopologyManager;
 
 namespace {
 
+const char kClockChannel[] = "/clock";
+
 bool g_atexit_registered = false;
 std::mutex g_mutex;
 logger::AsyncLogger* async_logger = nullptr;
+std::shared_ptr<transport::Receiver<proto::Clock>> clock_receiver = nullptr;
+
+// In simulation mode the cyber clock follows the time published on
+// /clock (e.g. by cyber_recorder play --clock) instead of system time.
+void StartClockReceiver() {
+  proto::RoleAttributes attr;
+  attr.set_node_name("clock_receiver_" + std::to_string(getpid()));
+  attr.set_channel_name(kClockChannel);
+  attr.set_channel_id(common::GlobalData::RegisterChannel(kClockChannel));
+  attr.mutable_qos_profile()->CopyFrom(
+      transport::QosProfileConf::QOS_PROFILE_SYSTEM_DEFAULT);
+  auto transport = transport::Transport::Instance();
+  clock_receiver = transport->CreateReceiver<proto::Clock>(
+      attr,
+      [](const std::shared_ptr<proto::Clock>& msg,
+         const transport::MessageInfo&, const proto::RoleAttributes&) {
+        Clock::SetNow(Time(msg->clock()));
+      },
+      proto::OptionalMode::RTPS);
+  if (clock_receiver == nullptr) {
+    AWARN << "create clock receiver failed.";
+  }
+}
 
 void InitLogger(const char* binary_name) {
   const char* slash = strrchr(binary_name, '/');
@@ -92,7 +121,11 @@ bool Init(const char* binary_name) {
   InitLogger(binary_name);
   auto thread = const_cast<std::thread*>(async_logger->LogThread());
   scheduler::Instance()->SetInnerThreadAttr("async_log", thread);
+  TscClock::Init();  // no-op unless --tsc_clock
   SysMo::Instance();
+  if (!common::GlobalData::Instance()->IsRealityMode()) {
+    StartClockReceiver();
+  }
   std::signal(SIGINT, OnShutdown);
   // Register exit handlers
   if (!g_atexit_registered) {
@@ -112,6 +145,8 @@ void Clear() {
   if (GetState() == STATE_SHUTDOWN || GetState() == STATE_UNINITIALIZED) {
     return;
   }
+  clock_receiver = nullptr;
+  TscClock::Shutdown();
   SysMo::CleanUp();
   TaskManager::CleanUp();
   TimingWheel::CleanUp();
@@ -136,6 +136,26 @@ ssize_t Session::RecvFrom(void *buf, size_t len, int flags,
   return nbytes;
 }
 
+ssize_t Session::RecvMsg(struct msghdr *msg, int flags, int timeout_ms) {
+  ACHECK(msg != nullptr);
+  ACHECK(fd_ != -1);
+
+  ssize_t nbytes = recvmsg(fd_, msg, flags);
+  if (timeout_ms == 0) {
+    return nbytes;
+  }
+
+  while (nbytes == -1 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+    if (poll_handler_->Block(timeout_ms, true)) {
+      nbytes = recvmsg(fd_, msg, flags);
+    }
+    if (timeout_ms > 0) {
+      break;
+    }
+  }
+  return nbytes;
+}
+
 ssize_t Session::Send(const void *buf, size_t len, int flags, int timeout_ms) {
   ACHECK(buf != nullptr);
   ACHECK(fd_ != -1);
@@ -179,6 +199,26 @@ ssize_t Session::SendTo(const void *buf, size_t len, int flags,
   return nbytes;
 }
 
+ssize_t Session::SendMsg(const struct msghdr *msg, int flags, int timeout_ms) {
+  ACHECK(msg != nullptr);
+  ACHECK(fd_ != -1);
+
+  ssize_t nbytes = sendmsg(fd_, msg, flags);
+  if (timeout_ms == 0) {
+    return nbytes;
+  }
+
+  while ((nbytes == -1) && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+    if (poll_handler_->Block(timeout_ms, false)) {
+      nbytes = sendmsg(fd_, msg, flags);
+    }
+    if (timeout_ms > 0) {
+      break;
+    }
+  }
+  return nbytes;
+}
+
 ssize_t Session::Read(void *buf, size_t count, int timeout_ms) {
   ACHECK(buf != nullptr);
   ACHECK(fd_ != -1);
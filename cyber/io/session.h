@@ -51,11 +51,13 @@ class Session {
   ssize_t Recv(void *buf, size_t len, int flags, int timeout_ms = -1);
   ssize_t RecvFrom(void *buf, size_t len, int flags, struct sockaddr *src_addr,
                    socklen_t *addrlen, int timeout_ms = -1);
+  ssize_t RecvMsg(struct msghdr *msg, int flags, int timeout_ms = -1);
 
   ssize_t Send(const void *buf, size_t len, int flags, int timeout_ms = -1);
   ssize_t SendTo(const void *buf, size_t len, int flags,
                  const struct sockaddr *dest_addr, socklen_t addrlen,
                  int timeout_ms = -1);
+  ssize_t SendMsg(const struct msghdr *msg, int flags, int timeout_ms = -1);
 
   ssize_t Read(void *buf, size_t count, int timeout_ms = -1);
   ssize_t Write(const void *buf, size_t count, int timeout_ms = -1);
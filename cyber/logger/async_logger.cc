@@ -20,10 +20,18 @@
 #include <string>
 #include <thread>
 #include <unordered_map>
+#include <utility>
 
 #include "cyber/base/macros.h"
 #include "cyber/logger/logger_util.h"
 
+DEFINE_bool(async_log_binary, false,
+            "Write per-module logs as framed binary records (*.blog) instead "
+            "of glog text files; convert offline with cyber_logtext.");
+DEFINE_uint64(async_log_queue_size, 65536,
+              "Capacity of the lock-free async logging queue. Messages are "
+              "dropped (and counted) when the queue is full.");
+
 namespace apollo {
 namespace cyber {
 namespace logger {
@@ -31,9 +39,12 @@ namespace logger {
 static const std::unordered_map<char, int> log_level_map = {
     {'F', 3}, {'E', 2}, {'W', 1}, {'I', 0}};
 
+// Framing of one *.blog file: the magic header followed by records of
+// [uint64 timestamp][int32 level][uint32 length][length bytes of message].
+const char kBinaryLogMagic[] = "CBLOG001";
+
 AsyncLogger::AsyncLogger(google::base::Logger* wrapped) : wrapped_(wrapped) {
-  active_buf_.reset(new std::deque<Msg>());
-  flushing_buf_.reset(new std::deque<Msg>());
+  msg_queue_.Init(FLAGS_async_log_queue_size);
 }
 
 AsyncLogger::~AsyncLogger() { Stop(); }
@@ -51,9 +62,17 @@ void AsyncLogger::Stop() {
     log_thread_.join();
   }
 
-  FlushBuffer(active_buf_);
-  ACHECK(active_buf_->empty());
-  ACHECK(flushing_buf_->empty());
+  // The logger thread is gone; drain whatever it had not consumed yet.
+  Msg msg;
+  while (msg_queue_.Dequeue(&msg)) {
+    DispatchMsg(&msg);
+  }
+  Flush();
+  if (drop_count_.load(std::memory_order_relaxed) > 0) {
+    std::cerr << "Async logger dropped "
+              << drop_count_.load(std::memory_order_relaxed) << " messages"
+              << std::endl;
+  }
   // std::cout << "Async Logger Stop!" << std::endl;
 }
 
@@ -64,13 +83,13 @@ void AsyncLogger::Write(bool force_flush, time_t timestamp, const char* message,
     return;
   }
   if (message_len > 0) {
-    auto msg_str = std::string(message, message_len);
-    while (flag_.test_and_set(std::memory_order_acquire)) {
-      cpu_relax();
+    Msg msg(timestamp, std::string(message, message_len),
+            log_level_map.at(message[0]));
+    if (cyber_unlikely(!msg_queue_.Enqueue(std::move(msg)))) {
+      // Never block the producer on a full queue: the scheduler matters
+      // more than a log line during a burst.
+      drop_count_.fetch_add(1, std::memory_order_relaxed);
     }
-    active_buf_->emplace_back(timestamp, std::move(msg_str),
-                              log_level_map.at(message[0]));
-    flag_.clear(std::memory_order_release);
   }
 
   if (force_flush && timestamp == 0 && message && message_len == 0) {
@@ -82,46 +101,77 @@ void AsyncLogger::Flush() {
   for (auto& module_logger : module_logger_map_) {
     module_logger.second->Flush();
   }
+  for (auto& module_blog : module_blog_map_) {
+    module_blog.second.flush();
+  }
 }
 
 uint32_t AsyncLogger::LogSize() { return wrapped_->LogSize(); }
 
 void AsyncLogger::RunThread() {
+  Msg msg;
   while (state_ == RUNNING) {
-    while (flag_.test_and_set(std::memory_order_acquire)) {
-      cpu_relax();
+    bool dispatched = false;
+    while (msg_queue_.Dequeue(&msg)) {
+      DispatchMsg(&msg);
+      dispatched = true;
     }
-    active_buf_.swap(flushing_buf_);
-    flag_.clear(std::memory_order_release);
-    FlushBuffer(flushing_buf_);
-    if (active_buf_->size() < 800) {
-      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    if (dispatched) {
+      Flush();
+      flush_count_.fetch_add(1, std::memory_order_relaxed);
     }
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
   }
 }
 
-void AsyncLogger::FlushBuffer(const std::unique_ptr<std::deque<Msg>>& buffer) {
+void AsyncLogger::DispatchMsg(Msg* msg) {
   std::string module_name = "";
-  while (!buffer->empty()) {
-    auto& msg = buffer->front();
-    FindModuleName(&(msg.message), &module_name);
-
-    if (module_logger_map_.find(module_name) == module_logger_map_.end()) {
-      std::string file_name = module_name + ".log.INFO.";
-      if (!FLAGS_log_dir.empty()) {
-        file_name = FLAGS_log_dir + "/" + file_name;
-      }
-      module_logger_map_[module_name].reset(
-          new LogFileObject(google::INFO, file_name.c_str()));
-      module_logger_map_[module_name]->SetSymlinkBasename(module_name.c_str());
+  FindModuleName(&(msg->message), &module_name);
+
+  if (FLAGS_async_log_binary) {
+    WriteBinary(module_name, *msg);
+    return;
+  }
+
+  if (module_logger_map_.find(module_name) == module_logger_map_.end()) {
+    std::string file_name = module_name + ".log.INFO.";
+    if (!FLAGS_log_dir.empty()) {
+      file_name = FLAGS_log_dir + "/" + file_name;
     }
-    const bool force_flush = msg.level > 0;
-    module_logger_map_.find(module_name)
-        ->second->Write(force_flush, msg.ts, msg.message.data(),
-                        static_cast<int>(msg.message.size()));
-    buffer->pop_front();
+    module_logger_map_[module_name].reset(
+        new LogFileObject(google::INFO, file_name.c_str()));
+    module_logger_map_[module_name]->SetSymlinkBasename(module_name.c_str());
   }
-  Flush();
+  const bool force_flush = msg->level > 0;
+  module_logger_map_.find(module_name)
+      ->second->Write(force_flush, msg->ts, msg->message.data(),
+                      static_cast<int>(msg->message.size()));
+}
+
+void AsyncLogger::WriteBinary(const std::string& module_name, const Msg& msg) {
+  auto it = module_blog_map_.find(module_name);
+  if (it == module_blog_map_.end()) {
+    std::string file_name = module_name + ".blog";
+    if (!FLAGS_log_dir.empty()) {
+      file_name = FLAGS_log_dir + "/" + file_name;
+    }
+    it = module_blog_map_.emplace(module_name, std::ofstream()).first;
+    it->second.open(file_name, std::ios::binary | std::ios::app);
+    if (it->second.tellp() == 0) {
+      it->second.write(kBinaryLogMagic, sizeof(kBinaryLogMagic) - 1);
+    }
+  }
+  if (!it->second.is_open()) {
+    return;
+  }
+  const uint64_t timestamp = static_cast<uint64_t>(msg.ts);
+  const int32_t level = msg.level;
+  const uint32_t length = static_cast<uint32_t>(msg.message.size());
+  it->second.write(reinterpret_cast<const char*>(&timestamp),
+                   sizeof(timestamp));
+  it->second.write(reinterpret_cast<const char*>(&level), sizeof(level));
+  it->second.write(reinterpret_cast<const char*>(&length), sizeof(length));
+  it->second.write(msg.message.data(), length);
 }
 
 }  // namespace logger
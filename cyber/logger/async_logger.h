@@ -21,7 +21,7 @@
 #include <condition_variable>
 #include <cstdint>
 #include <ctime>
-#include <deque>
+#include <fstream>
 #include <iostream>
 #include <memory>
 #include <mutex>
@@ -34,6 +34,7 @@
 #include "cyber/common/macros.h"
 #include "glog/logging.h"
 
+#include "cyber/base/bounded_queue.h"
 #include "cyber/logger/log_file_object.h"
 
 namespace apollo {
@@ -45,16 +46,16 @@ namespace logger {
  * @brief .
  * Wrapper for a glog Logger which asynchronously writes log messages.
  * This class starts a new thread responsible for forwarding the messages
- * to the logger, and performs double buffering. Writers append to the
- * current buffer and then wake up the logger thread. The logger swaps in
- * a new buffer and writes any accumulated messages to the wrapped
- * Logger.
+ * to the logger. Writers enqueue onto a lock-free bounded queue, so the
+ * producer side never takes a lock and never blocks on IO; the logger
+ * thread drains the queue and writes the accumulated messages to the
+ * wrapped Logger.
  *
- * This double-buffering design dramatically improves performance, especially
- * for logging messages which require flushing the underlying file (i.e WARNING
- * and above for default). The flush can take a couple of milliseconds, and in
- * some cases can even block for hundreds of milliseconds or more. With the
- * double-buffered approach, threads can proceed with useful work while the IO
+ * This design dramatically improves performance, especially for logging
+ * messages which require flushing the underlying file (i.e WARNING and
+ * above for default). The flush can take a couple of milliseconds, and in
+ * some cases can even block for hundreds of milliseconds or more. With
+ * the queued approach, threads can proceed with useful work while the IO
  * thread blocks.
  *
  * The semantics provided by this wrapper are slightly weaker than the default
@@ -66,9 +67,11 @@ namespace logger {
  * worth it. We do take care that a glog FATAL message flushes all buffered log
  * messages before exiting.
  *
- * @warning The logger limits the total amount of buffer space, so if the
- * underlying log blocks for too long, eventually the threads generating the log
- * messages will block as well. This prevents runaway memory usage.
+ * @warning The queue capacity bounds the total amount of buffer space; if
+ * the underlying log blocks for too long and the queue fills up, further
+ * messages are dropped (and counted) rather than blocking the threads
+ * generating them. This prevents both runaway memory usage and producer
+ * stalls during log bursts.
  */
 class AsyncLogger : public google::base::Logger {
  public:
@@ -164,7 +167,12 @@ class AsyncLogger : public google::base::Logger {
   };
 
   void RunThread();
-  void FlushBuffer(const std::unique_ptr<std::deque<Msg>>& msg);
+  // Route one dequeued message to its module sink, creating the sink on
+  // first use. Only called from the logger thread (or from Stop() after
+  // the thread has been joined).
+  void DispatchMsg(Msg* msg);
+  // Append one record to the module's framed binary log.
+  void WriteBinary(const std::string& module_name, const Msg& msg);
 
   google::base::Logger* const wrapped_;
   std::thread log_thread_;
@@ -173,23 +181,20 @@ class AsyncLogger : public google::base::Logger {
   // 64 bits should be enough to never worry about overflow.
   std::atomic<uint64_t> flush_count_ = {0};
 
-  // Count of how many times the writer thread has dropped the log messages.
-  // 64 bits should be enough to never worry about overflow.
-  uint64_t drop_count_ = 0;
-
-  // The buffer to which application threads append new log messages.
-  std::unique_ptr<std::deque<Msg>> active_buf_;
+  // Count of how many messages producers have dropped because the queue
+  // was full. 64 bits should be enough to never worry about overflow.
+  std::atomic<uint64_t> drop_count_ = {0};
 
-  // The buffer currently being flushed by the logger thread, cleared
-  // after a successful flush.
-  std::unique_ptr<std::deque<Msg>> flushing_buf_;
+  // Lock-free multi-producer queue the application threads append to;
+  // the logger thread is the only consumer.
+  base::BoundedQueue<Msg> msg_queue_;
 
   // Trigger for the logger thread to stop.
   enum State { INITTED, RUNNING, STOPPED };
   std::atomic<State> state_ = {INITTED};
-  std::atomic_flag flag_ = ATOMIC_FLAG_INIT;
   std::unordered_map<std::string, std::unique_ptr<LogFileObject>>
       module_logger_map_;
+  std::unordered_map<std::string, std::ofstream> module_blog_map_;
 
   DISALLOW_COPY_AND_ASSIGN(AsyncLogger);
 };
@@ -34,6 +34,9 @@ void ModuleArgument::DisplayUsage() {
            "namespace for running this module, default in manager process\n"
         << "    -s, --sched_name=sched_name: sched policy "
            "conf for hole process, sched_name should be conf in cyber.pb.conf\n"
+        << "    -P, --parallel_init : initialize the module sections of all "
+           "dag files in parallel, components inside one section still "
+           "initialize in their declared order\n"
         << "Example:\n"
         << "    " << binary_name_ << " -h\n"
         << "    " << binary_name_ << " -d dag_conf_file1 -d dag_conf_file2 "
@@ -64,12 +67,13 @@ void ModuleArgument::ParseArgument(const int argc, char* const argv[]) {
 void ModuleArgument::GetOptions(const int argc, char* const argv[]) {
   opterr = 0;  // extern int opterr
   int long_index = 0;
-  const std::string short_opts = "hd:p:s:";
+  const std::string short_opts = "hd:p:s:P";
   static const struct option long_opts[] = {
       {"help", no_argument, nullptr, 'h'},
       {"dag_conf", required_argument, nullptr, 'd'},
       {"process_name", required_argument, nullptr, 'p'},
       {"sched_name", required_argument, nullptr, 's'},
+      {"parallel_init", no_argument, nullptr, 'P'},
       {NULL, no_argument, nullptr, 0}};
 
   // log command for info
@@ -108,6 +112,9 @@ void ModuleArgument::GetOptions(const int argc, char* const argv[]) {
       case 's':
         sched_name_ = std::string(optarg);
         break;
+      case 'P':
+        parallel_init_ = true;
+        break;
       case 'h':
         DisplayUsage();
         exit(0);
@@ -42,12 +42,14 @@ class ModuleArgument {
   const std::string& GetProcessGroup() const;
   const std::string& GetSchedName() const;
   const std::list<std::string>& GetDAGConfList() const;
+  bool GetParallelInit() const;
 
  private:
   std::list<std::string> dag_conf_list_;
   std::string binary_name_;
   std::string process_group_;
   std::string sched_name_;
+  bool parallel_init_ = false;
 };
 
 inline const std::string& ModuleArgument::GetBinaryName() const {
@@ -66,6 +68,8 @@ inline const std::list<std::string>& ModuleArgument::GetDAGConfList() const {
   return dag_conf_list_;
 }
 
+inline bool ModuleArgument::GetParallelInit() const { return parallel_init_; }
+
 }  // namespace mainboard
 }  // namespace cyber
 }  // namespace apollo
@@ -16,6 +16,7 @@
 
 #include "cyber/mainboard/module_controller.h"
 
+#include <future>
 #include <utility>
 
 #include "cyber/common/environment.h"
@@ -61,6 +62,17 @@ bool ModuleController::LoadAll() {
     total_component_nums += scheduler::Instance()->TaskPoolSize();
   }
   common::GlobalData::Instance()->SetComponentNums(total_component_nums);
+  if (args_.GetParallelInit()) {
+    std::vector<DagConfig> dag_configs(paths.size());
+    for (size_t i = 0; i < paths.size(); ++i) {
+      AINFO << "Start initialize dag: " << paths[i];
+      if (!common::GetProtoFromFile(paths[i], &dag_configs[i])) {
+        AERROR << "Get proto failed, file: " << paths[i];
+        return false;
+      }
+    }
+    return LoadModulesParallel(dag_configs);
+  }
   for (auto module_path : paths) {
     AINFO << "Start initialize dag: " << module_path;
     if (!LoadModule(module_path)) {
@@ -72,43 +84,80 @@ bool ModuleController::LoadAll() {
 }
 
 bool ModuleController::LoadModule(const DagConfig& dag_config) {
-  const std::string work_root = common::WorkRoot();
-
-  for (auto module_config : dag_config.module_config()) {
-    std::string load_path;
-    if (module_config.module_library().front() == '/') {
-      load_path = module_config.module_library();
-    } else {
-      load_path =
-          common::GetAbsolutePath(work_root, module_config.module_library());
+  for (auto& module_config : dag_config.module_config()) {
+    if (!InitModule(module_config)) {
+      return false;
     }
+  }
+  return true;
+}
 
-    if (!common::PathExists(load_path)) {
-      AERROR << "Path does not exist: " << load_path;
-      return false;
+bool ModuleController::LoadModulesParallel(
+    const std::vector<DagConfig>& dag_configs) {
+  // One task per module section, so total startup time approaches the
+  // slowest section instead of the sum. Components inside one section
+  // still initialize sequentially in their declared order, which is how
+  // init dependencies are expressed: components that must initialize
+  // after one another belong to the same section.
+  std::vector<std::future<bool>> results;
+  for (auto& dag_config : dag_configs) {
+    for (auto& module_config : dag_config.module_config()) {
+      results.emplace_back(
+          std::async(std::launch::async, [this, &module_config]() {
+            return InitModule(module_config);
+          }));
     }
+  }
+  bool all_initialized = true;
+  for (auto& result : results) {
+    if (!result.get()) {
+      all_initialized = false;
+    }
+  }
+  return all_initialized;
+}
 
-    class_loader_manager_.LoadLibrary(load_path);
+bool ModuleController::InitModule(const ModuleConfig& module_config) {
+  const std::string work_root = common::WorkRoot();
+  std::string load_path;
+  if (module_config.module_library().front() == '/') {
+    load_path = module_config.module_library();
+  } else {
+    load_path =
+        common::GetAbsolutePath(work_root, module_config.module_library());
+  }
 
-    for (auto& component : module_config.components()) {
-      const std::string& class_name = component.class_name();
-      std::shared_ptr<ComponentBase> base =
-          class_loader_manager_.CreateClassObj<ComponentBase>(class_name);
-      if (base == nullptr || !base->Initialize(component.config())) {
-        return false;
-      }
-      component_list_.emplace_back(std::move(base));
+  if (!common::PathExists(load_path)) {
+    AERROR << "Path does not exist: " << load_path;
+    return false;
+  }
+
+  class_loader_manager_.LoadLibrary(load_path);
+
+  std::vector<std::shared_ptr<ComponentBase>> components;
+  for (auto& component : module_config.components()) {
+    const std::string& class_name = component.class_name();
+    std::shared_ptr<ComponentBase> base =
+        class_loader_manager_.CreateClassObj<ComponentBase>(class_name);
+    if (base == nullptr || !base->Initialize(component.config())) {
+      return false;
     }
+    components.emplace_back(std::move(base));
+  }
 
-    for (auto& component : module_config.timer_components()) {
-      const std::string& class_name = component.class_name();
-      std::shared_ptr<ComponentBase> base =
-          class_loader_manager_.CreateClassObj<ComponentBase>(class_name);
-      if (base == nullptr || !base->Initialize(component.config())) {
-        return false;
-      }
-      component_list_.emplace_back(std::move(base));
+  for (auto& component : module_config.timer_components()) {
+    const std::string& class_name = component.class_name();
+    std::shared_ptr<ComponentBase> base =
+        class_loader_manager_.CreateClassObj<ComponentBase>(class_name);
+    if (base == nullptr || !base->Initialize(component.config())) {
+      return false;
     }
+    components.emplace_back(std::move(base));
+  }
+
+  std::lock_guard<std::mutex> lock(component_list_mutex_);
+  for (auto& component : components) {
+    component_list_.emplace_back(std::move(component));
   }
   return true;
 }
@@ -17,6 +17,7 @@
 #define CYBER_MAINBOARD_MODULE_CONTROLLER_H_
 
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -30,6 +31,7 @@ namespace cyber {
 namespace mainboard {
 
 using apollo::cyber::proto::DagConfig;
+using apollo::cyber::proto::ModuleConfig;
 
 class ModuleController {
  public:
@@ -43,12 +45,15 @@ class ModuleController {
  private:
   bool LoadModule(const std::string& path);
   bool LoadModule(const DagConfig& dag_config);
+  bool LoadModulesParallel(const std::vector<DagConfig>& dag_configs);
+  bool InitModule(const ModuleConfig& module_config);
   int GetComponentNum(const std::string& path);
   int total_component_nums = 0;
   bool has_timer_component = false;
 
   ModuleArgument args_;
   class_loader::ClassLoaderManager class_loader_manager_;
+  std::mutex component_list_mutex_;
   std::vector<std::shared_ptr<ComponentBase>> component_list_;
 };
 
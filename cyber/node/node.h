@@ -79,6 +79,36 @@ class Node {
   auto CreateWriter(const std::string& channel_name)
       -> std::shared_ptr<Writer<MessageT>>;
 
+  /**
+   * @brief Create a Writer with specific message type and qos profile.
+   * Pass QosProfileConf::QOS_PROFILE_LATCHED for a latched channel whose
+   * recent messages are replayed to late-joining readers.
+   *
+   * @tparam MessageT Message Type
+   * @param channel_name the channel name to be published.
+   * @param qos_profile the qos profile of the channel.
+   * @return std::shared_ptr<Writer<MessageT>> result Writer Object
+   */
+  template <typename MessageT>
+  auto CreateWriter(const std::string& channel_name,
+                    const proto::QosProfile& qos_profile)
+      -> std::shared_ptr<Writer<MessageT>>;
+
+  /**
+   * @brief Create a Writer that coalesces sends. Write is an in-process
+   * buffer append; a background thread flushes the batch to the transport
+   * once the coalescing window elapses or the byte threshold is reached.
+   * Intended for high-rate small-message channels where per-message
+   * transport cost dominates; adds up to one window of latency.
+   *
+   * @tparam MessageT Message Type
+   * @param channel_name the channel name to be published.
+   * @return std::shared_ptr<Writer<MessageT>> result Writer Object
+   */
+  template <typename MessageT>
+  auto CreateCoalescingWriter(const std::string& channel_name)
+      -> std::shared_ptr<Writer<MessageT>>;
+
   /**
    * @brief Create a Reader with specific message type with channel name
    * qos and other configs used will be default
@@ -196,6 +226,21 @@ auto Node::CreateWriter(const std::string& channel_name)
   return node_channel_impl_->template CreateWriter<MessageT>(channel_name);
 }
 
+template <typename MessageT>
+auto Node::CreateWriter(const std::string& channel_name,
+                        const proto::QosProfile& qos_profile)
+    -> std::shared_ptr<Writer<MessageT>> {
+  return node_channel_impl_->template CreateWriter<MessageT>(channel_name,
+                                                             qos_profile);
+}
+
+template <typename MessageT>
+auto Node::CreateCoalescingWriter(const std::string& channel_name)
+    -> std::shared_ptr<Writer<MessageT>> {
+  return node_channel_impl_->template CreateCoalescingWriter<MessageT>(
+      channel_name);
+}
+
 template <typename MessageT>
 auto Node::CreateReader(const proto::RoleAttributes& role_attr,
                         const CallbackFunc<MessageT>& reader_func)
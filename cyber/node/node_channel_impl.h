@@ -24,6 +24,7 @@
 #include "cyber/blocker/intra_writer.h"
 #include "cyber/common/global_data.h"
 #include "cyber/message/message_traits.h"
+#include "cyber/node/coalescing_writer.h"
 #include "cyber/node/reader.h"
 #include "cyber/node/writer.h"
 #include "cyber/proto/run_mode_conf.pb.h"
@@ -118,6 +119,19 @@ class NodeChannelImpl {
   auto CreateWriter(const std::string& channel_name)
       -> std::shared_ptr<Writer<MessageT>>;
 
+  template <typename MessageT>
+  auto CreateWriter(const std::string& channel_name,
+                    const proto::QosProfile& qos_profile)
+      -> std::shared_ptr<Writer<MessageT>>;
+
+  template <typename MessageT>
+  auto CreateCoalescingWriter(const std::string& channel_name)
+      -> std::shared_ptr<Writer<MessageT>>;
+
+  template <typename MessageT>
+  auto CreateCoalescingWriter(const proto::RoleAttributes& role_attr)
+      -> std::shared_ptr<Writer<MessageT>>;
+
   template <typename MessageT>
   auto CreateReader(const std::string& channel_name,
                     const CallbackFunc<MessageT>& reader_func)
@@ -177,6 +191,48 @@ auto NodeChannelImpl::CreateWriter(const std::string& channel_name)
   return this->CreateWriter<MessageT>(role_attr);
 }
 
+template <typename MessageT>
+auto NodeChannelImpl::CreateWriter(const std::string& channel_name,
+                                   const proto::QosProfile& qos_profile)
+    -> std::shared_ptr<Writer<MessageT>> {
+  proto::RoleAttributes role_attr;
+  role_attr.set_channel_name(channel_name);
+  role_attr.mutable_qos_profile()->CopyFrom(qos_profile);
+  return this->CreateWriter<MessageT>(role_attr);
+}
+
+template <typename MessageT>
+auto NodeChannelImpl::CreateCoalescingWriter(const std::string& channel_name)
+    -> std::shared_ptr<Writer<MessageT>> {
+  proto::RoleAttributes role_attr;
+  role_attr.set_channel_name(channel_name);
+  return this->CreateCoalescingWriter<MessageT>(role_attr);
+}
+
+template <typename MessageT>
+auto NodeChannelImpl::CreateCoalescingWriter(
+    const proto::RoleAttributes& role_attr)
+    -> std::shared_ptr<Writer<MessageT>> {
+  if (!role_attr.has_channel_name() || role_attr.channel_name().empty()) {
+    AERROR << "Can't create a writer with empty channel name!";
+    return nullptr;
+  }
+  proto::RoleAttributes new_attr(role_attr);
+  FillInAttr<MessageT>(&new_attr);
+
+  std::shared_ptr<Writer<MessageT>> writer_ptr = nullptr;
+  if (!is_reality_mode_) {
+    // simulation messages never cross a transport, nothing to coalesce
+    writer_ptr = std::make_shared<blocker::IntraWriter<MessageT>>(new_attr);
+  } else {
+    writer_ptr = std::make_shared<CoalescingWriter<MessageT>>(new_attr);
+  }
+
+  RETURN_VAL_IF_NULL(writer_ptr, nullptr);
+  RETURN_VAL_IF(!writer_ptr->Init(), nullptr);
+  return writer_ptr;
+}
+
 template <typename MessageT>
 auto NodeChannelImpl::CreateReader(const std::string& channel_name,
                                    const CallbackFunc<MessageT>& reader_func)
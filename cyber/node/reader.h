@@ -18,7 +18,6 @@
 #define CYBER_NODE_READER_H_
 
 #include <algorithm>
-#include <list>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -70,8 +69,7 @@ class Reader : public ReaderBase {
   using ReceiverPtr = std::shared_ptr<transport::Receiver<MessageT>>;
   using ChangeConnection =
       typename service_discovery::Manager::ChangeConnection;
-  using Iterator =
-      typename std::list<std::shared_ptr<MessageT>>::const_iterator;
+  using Iterator = typename blocker::Blocker<MessageT>::Iterator;
 
   /**
    * Constructor a Reader object.
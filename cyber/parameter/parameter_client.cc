@@ -32,10 +32,24 @@ ParameterClient::ParameterClient(const std::shared_ptr<Node>& node,
 
   list_parameters_client_ = node_->CreateClient<NodeName, Params>(
       FixParameterServiceName(service_node_name, LIST_PARAMETERS_SERVICE_NAME));
+
+  snapshot_reader_.reset(new ParameterSnapshotReader(service_node_name));
 }
 
 bool ParameterClient::GetParameter(const std::string& param_name,
                                    Parameter* parameter) {
+  // The snapshot carries the full parameter set, so a hit avoids the
+  // service round trip entirely; any miss falls through to the RPC.
+  Params snapshot;
+  if (snapshot_reader_->Read(&snapshot)) {
+    for (auto& param : snapshot.param()) {
+      if (param.name() == param_name) {
+        parameter->FromProtoParam(param);
+        return true;
+      }
+    }
+  }
+
   auto request = std::make_shared<ParamName>();
   request->set_value(param_name);
   auto response = get_parameter_client_->SendRequest(request);
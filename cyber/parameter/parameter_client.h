@@ -22,6 +22,7 @@
 #include <vector>
 
 #include "cyber/parameter/parameter.h"
+#include "cyber/parameter/parameter_snapshot.h"
 #include "cyber/proto/parameter.pb.h"
 #include "cyber/service/client.h"
 
@@ -55,7 +56,9 @@ class ParameterClient {
                   const std::string& service_node_name);
 
   /**
-   * @brief Get the Parameter object
+   * @brief Get the Parameter object. Served from the shared-memory
+   * snapshot the server publishes when one is readable; falls back to
+   * the service request otherwise.
    *
    * @param param_name
    * @param parameter the pointer to store
@@ -89,6 +92,7 @@ class ParameterClient {
   std::shared_ptr<GetParameterClient> get_parameter_client_;
   std::shared_ptr<SetParameterClient> set_parameter_client_;
   std::shared_ptr<ListParametersClient> list_parameters_client_;
+  std::unique_ptr<ParameterSnapshotReader> snapshot_reader_;
 };
 
 }  // namespace cyber
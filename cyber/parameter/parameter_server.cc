@@ -42,6 +42,7 @@ ParameterServer::ParameterServer(const std::shared_ptr<Node>& node)
              std::shared_ptr<BoolResult>& response) {
         std::lock_guard<std::mutex> lock(param_map_mutex_);
         param_map_[request->name()] = *request;
+        PublishSnapshot();
         response->set_value(true);
       });
 
@@ -55,11 +56,32 @@ ParameterServer::ParameterServer(const std::shared_ptr<Node>& node)
           param->CopyFrom(item.second);
         }
       });
+
+  snapshot_writer_.reset(new ParameterSnapshotWriter(name));
+  if (!snapshot_writer_->Init()) {
+    AWARN << "parameter snapshot disabled, clients use the service path.";
+    snapshot_writer_ = nullptr;
+  } else {
+    std::lock_guard<std::mutex> lock(param_map_mutex_);
+    PublishSnapshot();
+  }
+}
+
+void ParameterServer::PublishSnapshot() {
+  if (snapshot_writer_ == nullptr) {
+    return;
+  }
+  Params params;
+  for (auto& item : param_map_) {
+    params.add_param()->CopyFrom(item.second);
+  }
+  snapshot_writer_->Publish(params);
 }
 
 void ParameterServer::SetParameter(const Parameter& parameter) {
   std::lock_guard<std::mutex> lock(param_map_mutex_);
   param_map_[parameter.Name()] = parameter.ToProtoParam();
+  PublishSnapshot();
 }
 
 bool ParameterServer::GetParameter(const std::string& parameter_name,
@@ -23,6 +23,7 @@
 #include <vector>
 
 #include "cyber/parameter/parameter.h"
+#include "cyber/parameter/parameter_snapshot.h"
 #include "cyber/proto/parameter.pb.h"
 #include "cyber/service/service.h"
 
@@ -79,10 +80,15 @@ class ParameterServer {
   void ListParameters(std::vector<Parameter>* parameters);
 
  private:
+  // Republishes the whole parameter set into the shared-memory
+  // snapshot; call with param_map_mutex_ held.
+  void PublishSnapshot();
+
   std::shared_ptr<Node> node_;
   std::shared_ptr<Service<ParamName, Param>> get_parameter_service_;
   std::shared_ptr<Service<Param, BoolResult>> set_parameter_service_;
   std::shared_ptr<Service<NodeName, Params>> list_parameters_service_;
+  std::unique_ptr<ParameterSnapshotWriter> snapshot_writer_;
 
   std::mutex param_map_mutex_;
   std::unordered_map<std::string, Param> param_map_;
@@ -0,0 +1,193 @@
+/******************************************************************************
+ * Copyright 2020 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+#include "cyber/parameter/parameter_snapshot.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstddef>
+#include <cstring>
+#include <vector>
+
+#include "cyber/common/log.h"
+
+namespace apollo {
+namespace cyber {
+
+namespace {
+
+constexpr uint32_t kMaxReadAttempts = 8;
+
+size_t SnapshotBlockSize() {
+  return offsetof(ParameterSnapshotBlock, data) + kParameterSnapshotCapacity;
+}
+
+}  // namespace
+
+std::string ParameterSnapshotName(const std::string& node_name) {
+  std::string name = "/cyber_param_" + node_name;
+  // shm names are single path components; node names may carry slashes.
+  for (size_t i = 1; i < name.size(); ++i) {
+    if (name[i] == '/') {
+      name[i] = '_';
+    }
+  }
+  return name;
+}
+
+ParameterSnapshotWriter::ParameterSnapshotWriter(const std::string& node_name)
+    : shm_name_(ParameterSnapshotName(node_name)) {}
+
+ParameterSnapshotWriter::~ParameterSnapshotWriter() {
+  if (block_ != nullptr) {
+    // Zero the version before unlinking: readers that already mapped the
+    // segment keep their mapping after shm_unlink, and version 0 tells
+    // them to drop it and re-open by name, so they find the segment of a
+    // restarted server instead of serving frozen values forever.
+    block_->version.store(0, std::memory_order_release);
+    munmap(block_, SnapshotBlockSize());
+    block_ = nullptr;
+    shm_unlink(shm_name_.c_str());
+  }
+}
+
+bool ParameterSnapshotWriter::Init() {
+  int fd = shm_open(shm_name_.c_str(), O_CREAT | O_RDWR, 0644);
+  if (fd < 0) {
+    AERROR << "create parameter snapshot [" << shm_name_
+           << "] failed: " << strerror(errno);
+    return false;
+  }
+  if (ftruncate(fd, static_cast<off_t>(SnapshotBlockSize())) < 0) {
+    AERROR << "resize parameter snapshot [" << shm_name_
+           << "] failed: " << strerror(errno);
+    close(fd);
+    shm_unlink(shm_name_.c_str());
+    return false;
+  }
+  void* addr = mmap(nullptr, SnapshotBlockSize(), PROT_READ | PROT_WRITE,
+                    MAP_SHARED, fd, 0);
+  close(fd);
+  if (addr == MAP_FAILED) {
+    AERROR << "map parameter snapshot [" << shm_name_
+           << "] failed: " << strerror(errno);
+    shm_unlink(shm_name_.c_str());
+    return false;
+  }
+  block_ = reinterpret_cast<ParameterSnapshotBlock*>(addr);
+  block_->version.store(0, std::memory_order_release);
+  return true;
+}
+
+void ParameterSnapshotWriter::Publish(const proto::Params& params) {
+  if (block_ == nullptr) {
+    return;
+  }
+  std::string data;
+  if (!params.SerializeToString(&data) ||
+      data.size() > kParameterSnapshotCapacity) {
+    // Leave the version odd so readers keep using the service path.
+    AWARN << "parameter snapshot [" << shm_name_
+          << "] overflow, size: " << data.size();
+    block_->version.fetch_or(1, std::memory_order_release);
+    return;
+  }
+  const uint64_t version = block_->version.load(std::memory_order_relaxed);
+  // (version + 1) | 1 keeps the in-progress marker odd even when an
+  // earlier overflow left the version odd; a plain increment from an odd
+  // base would let readers see the write window as consistent.
+  const uint64_t begin = (version + 1) | 1;
+  block_->version.store(begin, std::memory_order_release);
+  std::atomic_thread_fence(std::memory_order_release);
+  block_->data_size = static_cast<uint32_t>(data.size());
+  memcpy(block_->data, data.data(), data.size());
+  std::atomic_thread_fence(std::memory_order_release);
+  block_->version.store(begin + 1, std::memory_order_release);
+}
+
+ParameterSnapshotReader::ParameterSnapshotReader(const std::string& node_name)
+    : shm_name_(ParameterSnapshotName(node_name)) {}
+
+ParameterSnapshotReader::~ParameterSnapshotReader() { Close(); }
+
+void ParameterSnapshotReader::Close() {
+  if (block_ != nullptr) {
+    munmap(block_, SnapshotBlockSize());
+    block_ = nullptr;
+  }
+}
+
+bool ParameterSnapshotReader::Open() {
+  if (block_ != nullptr) {
+    return true;
+  }
+  int fd = shm_open(shm_name_.c_str(), O_RDONLY, 0);
+  if (fd < 0) {
+    if (!open_failed_logged_) {
+      ADEBUG << "parameter snapshot [" << shm_name_
+             << "] not available: " << strerror(errno);
+      open_failed_logged_ = true;
+    }
+    return false;
+  }
+  void* addr = mmap(nullptr, SnapshotBlockSize(), PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+  if (addr == MAP_FAILED) {
+    AWARN << "map parameter snapshot [" << shm_name_
+          << "] failed: " << strerror(errno);
+    return false;
+  }
+  block_ = reinterpret_cast<ParameterSnapshotBlock*>(addr);
+  return true;
+}
+
+bool ParameterSnapshotReader::Read(proto::Params* params) {
+  if (!Open()) {
+    return false;
+  }
+  std::vector<char> buffer(kParameterSnapshotCapacity);
+  for (uint32_t attempt = 0; attempt < kMaxReadAttempts; ++attempt) {
+    uint64_t version = block_->version.load(std::memory_order_acquire);
+    if (version == 0) {
+      // Never published, or the writer zeroed the block on shutdown.
+      // Drop the mapping so the next Read re-opens by name and can find
+      // the fresh segment of a restarted server.
+      Close();
+      return false;
+    }
+    if ((version & 1) != 0) {
+      continue;
+    }
+    uint32_t data_size = block_->data_size;
+    if (data_size > kParameterSnapshotCapacity) {
+      return false;
+    }
+    memcpy(buffer.data(), block_->data, data_size);
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (block_->version.load(std::memory_order_acquire) != version) {
+      continue;
+    }
+    return params->ParseFromArray(buffer.data(),
+                                  static_cast<int>(data_size));
+  }
+  return false;
+}
+
+}  // namespace cyber
+}  // namespace apollo
@@ -0,0 +1,94 @@
+/******************************************************************************
+ * Copyright 2020 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#ifndef CYBER_PARAMETER_PARAMETER_SNAPSHOT_H_
+#define CYBER_PARAMETER_PARAMETER_SNAPSHOT_H_
+
+#include <atomic>
+#include <string>
+
+#include "cyber/proto/parameter.pb.h"
+
+namespace apollo {
+namespace cyber {
+
+// Shared-memory block layout of a parameter snapshot. The version field
+// works as a seqlock: odd while the server is writing, even when the
+// block is consistent, zero before the first publication.
+struct ParameterSnapshotBlock {
+  std::atomic<uint64_t> version;
+  uint32_t data_size;
+  char data[1];
+};
+
+constexpr uint32_t kParameterSnapshotCapacity = 64 * 1024;
+
+/**
+ * @class ParameterSnapshotWriter
+ * @brief Publishes the full parameter set of a ParameterServer into a
+ * read-only shared-memory snapshot, so clients in other processes can
+ * read parameters without a service round trip. Owned by the server;
+ * the segment is unlinked on destruction.
+ */
+class ParameterSnapshotWriter {
+ public:
+  explicit ParameterSnapshotWriter(const std::string& node_name);
+  ~ParameterSnapshotWriter();
+
+  bool Init();
+
+  /**
+   * @brief Publish the given parameter set as the new snapshot version.
+   * A set too large for the block leaves the snapshot marked dirty, so
+   * readers permanently fall back to the service path.
+   */
+  void Publish(const proto::Params& params);
+
+ private:
+  std::string shm_name_;
+  ParameterSnapshotBlock* block_ = nullptr;
+};
+
+/**
+ * @class ParameterSnapshotReader
+ * @brief Lock-free reader of the snapshot a ParameterSnapshotWriter
+ * publishes. Read() fails when the segment does not exist, the version
+ * changes mid-copy after retries, or the block is dirty; the caller
+ * then falls back to the parameter service.
+ */
+class ParameterSnapshotReader {
+ public:
+  explicit ParameterSnapshotReader(const std::string& node_name);
+  ~ParameterSnapshotReader();
+
+  bool Read(proto::Params* params);
+
+ private:
+  bool Open();
+  void Close();
+
+  std::string shm_name_;
+  ParameterSnapshotBlock* block_ = nullptr;
+  bool open_failed_logged_ = false;
+};
+
+// Both ends derive the segment name from the server's node name.
+std::string ParameterSnapshotName(const std::string& node_name);
+
+}  // namespace cyber
+}  // namespace apollo
+
+#endif  // CYBER_PARAMETER_PARAMETER_SNAPSHOT_H_
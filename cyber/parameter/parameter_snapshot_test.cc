@@ -0,0 +1,125 @@
+/******************************************************************************
+ * Copyright 2020 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "cyber/parameter/parameter_snapshot.h"
+
+#include <string>
+
+#include "gtest/gtest.h"
+
+namespace apollo {
+namespace cyber {
+
+TEST(ParameterSnapshotTest, read_before_publish) {
+  ParameterSnapshotReader reader("snapshot_test_node_absent");
+  proto::Params params;
+  EXPECT_FALSE(reader.Read(&params));
+}
+
+TEST(ParameterSnapshotTest, write_and_read) {
+  ParameterSnapshotWriter writer("snapshot_test_node");
+  ASSERT_TRUE(writer.Init());
+
+  ParameterSnapshotReader reader("snapshot_test_node");
+  proto::Params params;
+  // Created but never published yet.
+  EXPECT_FALSE(reader.Read(&params));
+
+  proto::Params published;
+  auto* param = published.add_param();
+  param->set_name("velocity");
+  param->set_type(proto::ParamType::DOUBLE);
+  param->set_double_value(5.0);
+  writer.Publish(published);
+
+  ASSERT_TRUE(reader.Read(&params));
+  ASSERT_EQ(params.param_size(), 1);
+  EXPECT_EQ(params.param(0).name(), "velocity");
+  EXPECT_DOUBLE_EQ(params.param(0).double_value(), 5.0);
+
+  // A republish replaces the snapshot wholesale.
+  published.mutable_param(0)->set_double_value(6.0);
+  writer.Publish(published);
+  ASSERT_TRUE(reader.Read(&params));
+  EXPECT_DOUBLE_EQ(params.param(0).double_value(), 6.0);
+}
+
+TEST(ParameterSnapshotTest, publish_after_overflow) {
+  ParameterSnapshotWriter writer("snapshot_test_node_overflow");
+  ASSERT_TRUE(writer.Init());
+  ParameterSnapshotReader reader("snapshot_test_node_overflow");
+
+  // An oversized set leaves the snapshot dirty.
+  proto::Params oversized;
+  auto* big_param = oversized.add_param();
+  big_param->set_name("big");
+  big_param->set_type(proto::ParamType::STRING);
+  big_param->set_string_value(std::string(kParameterSnapshotCapacity, 'x'));
+  writer.Publish(oversized);
+  proto::Params params;
+  EXPECT_FALSE(reader.Read(&params));
+
+  // A following publish that fits must restore even/odd parity, so the
+  // snapshot becomes readable again with the new values.
+  proto::Params small;
+  auto* param = small.add_param();
+  param->set_name("velocity");
+  param->set_type(proto::ParamType::DOUBLE);
+  param->set_double_value(7.0);
+  writer.Publish(small);
+  ASSERT_TRUE(reader.Read(&params));
+  ASSERT_EQ(params.param_size(), 1);
+  EXPECT_DOUBLE_EQ(params.param(0).double_value(), 7.0);
+}
+
+TEST(ParameterSnapshotTest, server_restart) {
+  ParameterSnapshotReader reader("snapshot_test_node_restart");
+  proto::Params params;
+
+  {
+    ParameterSnapshotWriter writer("snapshot_test_node_restart");
+    ASSERT_TRUE(writer.Init());
+    proto::Params published;
+    auto* param = published.add_param();
+    param->set_name("velocity");
+    param->set_type(proto::ParamType::DOUBLE);
+    param->set_double_value(5.0);
+    writer.Publish(published);
+    ASSERT_TRUE(reader.Read(&params));
+    EXPECT_DOUBLE_EQ(params.param(0).double_value(), 5.0);
+  }
+
+  // The writer is gone; the mapped reader must notice instead of
+  // serving the old values from the orphaned segment.
+  EXPECT_FALSE(reader.Read(&params));
+
+  // A restarted server publishes into a fresh segment under the same
+  // name; the reader re-opens and picks up the new values.
+  ParameterSnapshotWriter restarted("snapshot_test_node_restart");
+  ASSERT_TRUE(restarted.Init());
+  proto::Params published;
+  auto* param = published.add_param();
+  param->set_name("velocity");
+  param->set_type(proto::ParamType::DOUBLE);
+  param->set_double_value(9.0);
+  restarted.Publish(published);
+  ASSERT_TRUE(reader.Read(&params));
+  ASSERT_EQ(params.param_size(), 1);
+  EXPECT_DOUBLE_EQ(params.param(0).double_value(), 9.0);
+}
+
+}  // namespace cyber
+}  // namespace apollo
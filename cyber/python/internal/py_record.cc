@@ -18,6 +18,7 @@
 
 #include <set>
 #include <string>
+#include <vector>
 
 #include <Python.h>
 
@@ -120,6 +121,104 @@ PyObject *cyber_PyRecordReader_ReadMessage(PyObject *self, PyObject *args) {
   return pyobj_bag_message;
 }
 
+// Like ReadMessage, but "data" is a read-only memoryview over the
+// reader's internal buffer instead of a bytes copy. The view (and any
+// numpy array built on it) is only valid until the next read or Reset;
+// callers that need the payload afterwards must copy it themselves.
+PyObject *cyber_PyRecordReader_ReadMessageView(PyObject *self, PyObject *args) {
+  PyObject *pyobj_reader = nullptr;
+  uint64_t begin_time = 0;
+  uint64_t end_time = UINT64_MAX;
+  if (!PyArg_ParseTuple(
+          args, const_cast<char *>("OKK:PyRecordReader_ReadMessageView"),
+          &pyobj_reader, &begin_time, &end_time)) {
+    return nullptr;
+  }
+
+  auto *reader = reinterpret_cast<PyRecordReader *>(PyCapsule_GetPointer(
+      pyobj_reader, "apollo_cyber_record_pyrecordfilereader"));
+  if (nullptr == reader) {
+    AERROR << "PyRecordReader_ReadMessageView ptr is null!";
+    return nullptr;
+  }
+
+  const auto *result = reader->ReadMessageNoCopy(begin_time, end_time);
+  static char empty_buf = '\0';
+  PyObject *pyobj_bag_message = PyDict_New();
+
+  PyObject *bld_name =
+      Py_BuildValue("s", result ? result->channel_name.c_str() : "");
+  PyDict_SetItemString(pyobj_bag_message, "channel_name", bld_name);
+  Py_DECREF(bld_name);
+
+  PyObject *bld_data =
+      result ? PyMemoryView_FromMemory(const_cast<char *>(result->data.data()),
+                                       result->data.size(), PyBUF_READ)
+             : PyMemoryView_FromMemory(&empty_buf, 0, PyBUF_READ);
+  ACHECK(bld_data) << "PyMemoryView_FromMemory returns NULL.";
+  PyDict_SetItemString(pyobj_bag_message, "data", bld_data);
+  Py_DECREF(bld_data);
+
+  PyObject *bld_type =
+      Py_BuildValue("s", result ? result->data_type.c_str() : "");
+  PyDict_SetItemString(pyobj_bag_message, "data_type", bld_type);
+  Py_DECREF(bld_type);
+
+  PyObject *bld_rtime = Py_BuildValue("K", result ? result->timestamp : 0);
+  PyDict_SetItemString(pyobj_bag_message, "timestamp", bld_rtime);
+  Py_DECREF(bld_rtime);
+
+  PyDict_SetItemString(pyobj_bag_message, "end",
+                       result ? Py_False : Py_True);
+
+  return pyobj_bag_message;
+}
+
+// Reads up to batch_size messages in one call and returns a list of
+// (timestamp, channel_name, data view, data_type) tuples. The record is
+// decoded without the GIL held, and each data view is a read-only
+// memoryview over the reader's internal batch, valid until the next
+// batch read or Reset. An empty list marks end of record.
+PyObject *cyber_PyRecordReader_ReadMessages(PyObject *self, PyObject *args) {
+  PyObject *pyobj_reader = nullptr;
+  uint64_t batch_size = 0;
+  uint64_t begin_time = 0;
+  uint64_t end_time = UINT64_MAX;
+  if (!PyArg_ParseTuple(args,
+                        const_cast<char *>("OKKK:PyRecordReader_ReadMessages"),
+                        &pyobj_reader, &batch_size, &begin_time, &end_time)) {
+    return nullptr;
+  }
+
+  auto *reader = reinterpret_cast<PyRecordReader *>(PyCapsule_GetPointer(
+      pyobj_reader, "apollo_cyber_record_pyrecordfilereader"));
+  if (nullptr == reader) {
+    AERROR << "PyRecordReader_ReadMessages ptr is null!";
+    return nullptr;
+  }
+
+  const std::vector<apollo::cyber::record::BagMessage> *batch = nullptr;
+  Py_BEGIN_ALLOW_THREADS;
+  batch = &reader->ReadMessages(static_cast<size_t>(batch_size), begin_time,
+                                end_time);
+  Py_END_ALLOW_THREADS;
+
+  PyObject *pyobj_list = PyList_New(batch->size());
+  for (size_t i = 0; i < batch->size(); ++i) {
+    const auto &bag_message = (*batch)[i];
+    PyObject *bld_data = PyMemoryView_FromMemory(
+        const_cast<char *>(bag_message.data.data()), bag_message.data.size(),
+        PyBUF_READ);
+    ACHECK(bld_data) << "PyMemoryView_FromMemory returns NULL.";
+    PyList_SetItem(
+        pyobj_list, i,
+        Py_BuildValue("(KsNs)", bag_message.timestamp,
+                      bag_message.channel_name.c_str(), bld_data,
+                      bag_message.data_type.c_str()));
+  }
+  return pyobj_list;
+}
+
 PyObject *cyber_PyRecordReader_GetMessageNumber(PyObject *self,
                                                 PyObject *args) {
   PyObject *pyobj_reader = nullptr;
@@ -522,6 +621,10 @@ static PyMethodDef _cyber_record_methods[] = {
     {"delete_PyRecordReader", cyber_delete_PyRecordReader, METH_VARARGS, ""},
     {"PyRecordReader_ReadMessage", cyber_PyRecordReader_ReadMessage,
      METH_VARARGS, ""},
+    {"PyRecordReader_ReadMessageView", cyber_PyRecordReader_ReadMessageView,
+     METH_VARARGS, ""},
+    {"PyRecordReader_ReadMessages", cyber_PyRecordReader_ReadMessages,
+     METH_VARARGS, ""},
     {"PyRecordReader_GetMessageNumber", cyber_PyRecordReader_GetMessageNumber,
      METH_VARARGS, ""},
     {"PyRecordReader_GetMessageType", cyber_PyRecordReader_GetMessageType,
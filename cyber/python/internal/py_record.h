@@ -25,6 +25,8 @@
 #include <set>
 #include <string>
 #include <thread>
+#include <utility>
+#include <vector>
 
 #include "cyber/message/protobuf_factory.h"
 #include "cyber/message/py_message.h"
@@ -70,6 +72,48 @@ class PyRecordReader {
     return ret_msg;
   }
 
+  // Reads the next message into an internal slot that is reused across
+  // calls, so the payload can be exposed to python without a copy. The
+  // returned pointer stays valid until the next read or Reset, and is
+  // nullptr at end of record.
+  const BagMessage* ReadMessageNoCopy(uint64_t begin_time = 0,
+                                      uint64_t end_time = UINT64_MAX) {
+    RecordMessage record_message;
+    if (!record_reader_->ReadMessage(&record_message, begin_time, end_time)) {
+      return nullptr;
+    }
+    current_message_.end = false;
+    current_message_.timestamp = record_message.time;
+    current_message_.channel_name = std::move(record_message.channel_name);
+    current_message_.data = std::move(record_message.content);
+    current_message_.data_type =
+        record_reader_->GetMessageType(current_message_.channel_name);
+    return &current_message_;
+  }
+
+  // Reads up to batch_size messages into an internal batch that is
+  // reused across calls. The returned reference stays valid until the
+  // next batch read or Reset; an empty batch marks end of record.
+  const std::vector<BagMessage>& ReadMessages(size_t batch_size,
+                                              uint64_t begin_time = 0,
+                                              uint64_t end_time = UINT64_MAX) {
+    batch_messages_.clear();
+    RecordMessage record_message;
+    while (batch_messages_.size() < batch_size &&
+           record_reader_->ReadMessage(&record_message, begin_time,
+                                       end_time)) {
+      BagMessage bag_message;
+      bag_message.end = false;
+      bag_message.timestamp = record_message.time;
+      bag_message.channel_name = std::move(record_message.channel_name);
+      bag_message.data = std::move(record_message.content);
+      bag_message.data_type =
+          record_reader_->GetMessageType(bag_message.channel_name);
+      batch_messages_.push_back(std::move(bag_message));
+    }
+    return batch_messages_;
+  }
+
   uint64_t GetMessageNumber(const std::string& channel_name) {
     return record_reader_->GetMessageNumber(channel_name);
   }
@@ -96,6 +140,9 @@ class PyRecordReader {
 
  private:
   std::unique_ptr<RecordReader> record_reader_;
+  // backing storage for the zero-copy read APIs
+  BagMessage current_message_;
+  std::vector<BagMessage> batch_messages_;
 };
 
 class PyRecordWriter {
@@ -16,6 +16,11 @@
 
 #include "cyber/record/file/record_file_reader.h"
 
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include <cstring>
+
 #include "cyber/common/file.h"
 
 namespace apollo {
@@ -38,6 +43,23 @@ bool RecordFileReader::Open(const std::string& path) {
     return false;
   }
   end_of_file_ = false;
+
+  // Map the file so that seeking and re-reading chunks during playback hit
+  // the page cache instead of going through read(). Records still being
+  // written can grow beyond the mapping, ReadSection falls back to read()
+  // for any range outside of it.
+  struct stat st;
+  if (fstat(fd_, &st) == 0 && st.st_size > 0) {
+    void* addr = mmap(nullptr, st.st_size, PROT_READ, MAP_SHARED, fd_, 0);
+    if (addr != MAP_FAILED) {
+      mmap_addr_ = addr;
+      mmap_size_ = st.st_size;
+    } else {
+      ADEBUG << "mmap failed, fall back to read(), file: " << path_
+             << ", errno: " << errno;
+    }
+  }
+
   if (!ReadHeader()) {
     AERROR << "Read header section fail, file: " << path_;
     return false;
@@ -45,7 +67,30 @@ bool RecordFileReader::Open(const std::string& path) {
   return true;
 }
 
-void RecordFileReader::Close() { close(fd_); }
+RecordFileReader::~RecordFileReader() {
+  if (mmap_addr_ != nullptr) {
+    munmap(mmap_addr_, mmap_size_);
+    mmap_addr_ = nullptr;
+    mmap_size_ = 0;
+  }
+}
+
+void RecordFileReader::Close() {
+  if (mmap_addr_ != nullptr) {
+    munmap(mmap_addr_, mmap_size_);
+    mmap_addr_ = nullptr;
+    mmap_size_ = 0;
+  }
+  close(fd_);
+}
+
+bool RecordFileReader::InMappedRange(int64_t size) {
+  if (mmap_addr_ == nullptr) {
+    return false;
+  }
+  int64_t pos = CurrentPosition();
+  return pos >= 0 && size >= 0 && pos + size <= mmap_size_;
+}
 
 bool RecordFileReader::Reset() {
   if (!SetPosition(sizeof(struct Section) + HEADER_LENGTH)) {
@@ -110,6 +155,12 @@ bool RecordFileReader::ReadIndex() {
 }
 
 bool RecordFileReader::ReadSection(Section* section) {
+  if (InMappedRange(sizeof(struct Section))) {
+    int64_t pos = CurrentPosition();
+    memcpy(section, static_cast<const char*>(mmap_addr_) + pos,
+           sizeof(struct Section));
+    return SetPosition(pos + sizeof(struct Section));
+  }
   ssize_t count = read(fd_, section, sizeof(struct Section));
   if (count < 0) {
     AERROR << "Read fd failed, fd_: " << fd_ << ", errno: " << errno;
@@ -127,6 +178,33 @@ bool RecordFileReader::ReadSection(Section* section) {
   return true;
 }
 
+bool RecordFileReader::ReadRawSection(int64_t size, std::string* data) {
+  if (size < 0) {
+    AERROR << "Negative section size: " << size;
+    return false;
+  }
+  data->resize(size);
+  if (InMappedRange(size)) {
+    int64_t pos = CurrentPosition();
+    memcpy(&(*data)[0], static_cast<const char*>(mmap_addr_) + pos, size);
+    return SetPosition(pos + size);
+  }
+  int64_t offset = 0;
+  while (offset < size) {
+    ssize_t count = read(fd_, &(*data)[offset], size - offset);
+    if (count < 0) {
+      AERROR << "Read fd failed, fd_: " << fd_ << ", errno: " << errno;
+      return false;
+    } else if (count == 0) {
+      end_of_file_ = true;
+      AERROR << "Reach end of file before the section is complete.";
+      return false;
+    }
+    offset += count;
+  }
+  return true;
+}
+
 bool RecordFileReader::SkipSection(int64_t size) {
   int64_t pos = CurrentPosition();
   if (size > INT64_MAX - pos) {
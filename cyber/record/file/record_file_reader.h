@@ -44,7 +44,7 @@ using google::protobuf::io::ZeroCopyInputStream;
 class RecordFileReader : public RecordFileBase {
  public:
   RecordFileReader() = default;
-  virtual ~RecordFileReader() = default;
+  virtual ~RecordFileReader();
   bool Open(const std::string& path) override;
   void Close() override;
   bool Reset();
@@ -52,12 +52,23 @@ class RecordFileReader : public RecordFileBase {
   bool SkipSection(int64_t size);
   template <typename T>
   bool ReadSection(int64_t size, T* message);
+  // Read the raw bytes of a section body without parsing, so the parsing
+  // can happen on another thread.
+  bool ReadRawSection(int64_t size, std::string* data);
   bool ReadIndex();
   bool EndOfFile() { return end_of_file_; }
 
  private:
   bool ReadHeader();
+  // True if [CurrentPosition(), CurrentPosition() + size) is available
+  // through the mapping. A record still being written may grow beyond the
+  // mapping, in which case we fall back to read().
+  bool InMappedRange(int64_t size);
+
   bool end_of_file_ = false;
+  // Read-only mapping of the whole file, nullptr when mmap is unavailable.
+  void* mmap_addr_ = nullptr;
+  int64_t mmap_size_ = 0;
 };
 
 template <typename T>
@@ -66,6 +77,23 @@ bool RecordFileReader::ReadSection(int64_t size, T* message) {
     AERROR << "Size value greater than the range of int value.";
     return false;
   }
+  if (InMappedRange(size)) {
+    // Parse straight out of the page cache, no read() copy.
+    int64_t pos = CurrentPosition();
+    CodedInputStream coded_input(
+        reinterpret_cast<const uint8_t*>(mmap_addr_) + pos,
+        static_cast<int>(size));
+    if (!message->ParseFromCodedStream(&coded_input)) {
+      AERROR << "Parse section message failed.";
+      return false;
+    }
+    if (static_cast<int64_t>(message->ByteSizeLong()) != size) {
+      AERROR << "Message size is not consistent in section header"
+             << ", expect: " << size << ", actual: " << message->ByteSizeLong();
+      return false;
+    }
+    return SetPosition(pos + size);
+  }
   FileInputStream raw_input(fd_, static_cast<int>(size));
   CodedInputStream coded_input(&raw_input);
   CodedInputStream::Limit limit = coded_input.PushLimit(static_cast<int>(size));
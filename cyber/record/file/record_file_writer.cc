@@ -53,41 +53,38 @@ bool RecordFileWriter::Open(const std::string& path) {
     return false;
   }
   chunk_active_.reset(new Chunk());
-  chunk_flush_.reset(new Chunk());
+  next_enqueue_seq_ = 0;
+  next_commit_seq_ = 0;
+  inflight_chunk_number_ = 0;
+  stalled_chunk_number_ = 0;
   is_writing_ = true;
-  flush_thread_ = std::make_shared<std::thread>([this]() { this->Flush(); });
-  if (flush_thread_ == nullptr) {
-    AERROR << "Init flush thread error.";
-    return false;
+  for (uint64_t i = 0; i < kFlushThreadNum; ++i) {
+    flush_threads_.emplace_back([this]() { this->FlushRoutine(); });
   }
   return true;
 }
 
 void RecordFileWriter::Close() {
   if (is_writing_) {
-    // wait for the flush operation that may exist now
-    while (!chunk_flush_->empty()) {
-      std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    // flush the last partial chunk
+    if (!chunk_active_->empty()) {
+      EnqueueChunk();
     }
 
-    // last swap
+    // wait until all inflight chunks reach the file, then stop the workers
     {
       std::unique_lock<std::mutex> flush_lock(flush_mutex_);
-      chunk_flush_.swap(chunk_active_);
-      flush_cv_.notify_one();
-    }
-
-    // wait for the last flush operation
-    while (!chunk_flush_->empty()) {
-      std::this_thread::sleep_for(std::chrono::milliseconds(100));
+      flush_cv_.wait(flush_lock,
+                     [this] { return inflight_chunk_number_ == 0; });
+      is_writing_ = false;
+      flush_cv_.notify_all();
     }
-
-    is_writing_ = false;
-    flush_cv_.notify_all();
-    if (flush_thread_ && flush_thread_->joinable()) {
-      flush_thread_->join();
-      flush_thread_ = nullptr;
+    for (auto& flush_thread : flush_threads_) {
+      if (flush_thread.joinable()) {
+        flush_thread.join();
+      }
     }
+    flush_threads_.clear();
 
     if (!WriteIndex()) {
       AERROR << "Write index section failed, file: " << path_;
@@ -157,7 +154,7 @@ bool RecordFileWriter::WriteChannel(const Channel& channel) {
 }
 
 bool RecordFileWriter::WriteChunk(const ChunkHeader& chunk_header,
-                                  const ChunkBody& chunk_body) {
+                                  const std::string& chunk_body_buf) {
   std::lock_guard<std::mutex> lock(mutex_);
   uint64_t pos = CurrentPosition();
   if (!WriteSection<ChunkHeader>(chunk_header)) {
@@ -175,10 +172,34 @@ bool RecordFileWriter::WriteChunk(const ChunkHeader& chunk_header,
   single_index->set_allocated_chunk_header_cache(chunk_header_cache);
 
   pos = CurrentPosition();
-  if (!WriteSection<ChunkBody>(chunk_body)) {
-    AERROR << "Write chunk body fail";
+  // the body was serialized by a flush worker already, write it as is
+  Section section;
+  /// zero out whole struct even if padded
+  memset(&section, 0, sizeof(section));
+  section = {SectionType::SECTION_CHUNK_BODY,
+             static_cast<int64_t>(chunk_body_buf.size())};
+  ssize_t count = write(fd_, &section, sizeof(section));
+  if (count < 0) {
+    AERROR << "Write fd failed, fd: " << fd_ << ", errno: " << errno;
     return false;
   }
+  if (count != sizeof(section)) {
+    AERROR << "Write fd failed, fd: " << fd_
+           << ", expect count: " << sizeof(section)
+           << ", actual count: " << count;
+    return false;
+  }
+  size_t written = 0;
+  while (written < chunk_body_buf.size()) {
+    count = write(fd_, chunk_body_buf.data() + written,
+                  chunk_body_buf.size() - written);
+    if (count < 0) {
+      AERROR << "Write fd failed, fd: " << fd_ << ", errno: " << errno;
+      return false;
+    }
+    written += count;
+  }
+  header_.set_size(CurrentPosition());
   header_.set_chunk_number(header_.chunk_number() + 1);
   if (header_.begin_time() == 0) {
     header_.set_begin_time(chunk_header.begin_time());
@@ -190,7 +211,7 @@ bool RecordFileWriter::WriteChunk(const ChunkHeader& chunk_header,
   single_index->set_type(SectionType::SECTION_CHUNK_BODY);
   single_index->set_position(pos);
   ChunkBodyCache* chunk_body_cache = new ChunkBodyCache();
-  chunk_body_cache->set_message_number(chunk_body.messages_size());
+  chunk_body_cache->set_message_number(chunk_header.message_number());
   single_index->set_allocated_chunk_body_cache(chunk_body_cache);
   return true;
 }
@@ -217,32 +238,73 @@ bool RecordFileWriter::WriteMessage(const proto::SingleMessage& message) {
   if (!need_flush) {
     return true;
   }
-  {
-    std::unique_lock<std::mutex> flush_lock(flush_mutex_);
-    chunk_flush_.swap(chunk_active_);
-    flush_cv_.notify_one();
-  }
+  EnqueueChunk();
   return true;
 }
 
-void RecordFileWriter::Flush() {
-  while (is_writing_) {
-    std::unique_lock<std::mutex> flush_lock(flush_mutex_);
-    flush_cv_.wait(flush_lock,
-                   [this] { return !chunk_flush_->empty() || !is_writing_; });
-    if (!is_writing_) {
-      break;
+void RecordFileWriter::EnqueueChunk() {
+  std::unique_lock<std::mutex> flush_lock(flush_mutex_);
+  if (inflight_chunk_number_ >= kMaxInflightChunkNum) {
+    ++stalled_chunk_number_;
+    flush_cv_.wait(flush_lock, [this] {
+      return inflight_chunk_number_ < kMaxInflightChunkNum;
+    });
+  }
+  std::unique_ptr<FlushTask> task(new FlushTask());
+  task->seq = next_enqueue_seq_++;
+  task->header = chunk_active_->header_;
+  task->body = std::move(chunk_active_->body_);
+  chunk_active_->clear();
+  flush_queue_.emplace_back(std::move(task));
+  ++inflight_chunk_number_;
+  flush_cv_.notify_all();
+}
+
+void RecordFileWriter::FlushRoutine() {
+  while (true) {
+    std::unique_ptr<FlushTask> task = nullptr;
+    {
+      std::unique_lock<std::mutex> flush_lock(flush_mutex_);
+      flush_cv_.wait(flush_lock,
+                     [this] { return !flush_queue_.empty() || !is_writing_; });
+      if (flush_queue_.empty()) {
+        if (!is_writing_) {
+          break;
+        }
+        continue;
+      }
+      task = std::move(flush_queue_.front());
+      flush_queue_.pop_front();
     }
-    if (chunk_flush_->empty()) {
-      continue;
+    // serialize outside any lock, this is the expensive part and it runs
+    // concurrently on all flush workers
+    task->body->SerializeToString(&task->body_buf);
+    task->body.reset();
+    // commit in enqueue order so the file layout and the index stay
+    // identical to the single threaded writer
+    {
+      std::unique_lock<std::mutex> commit_lock(commit_mutex_);
+      commit_cv_.wait(commit_lock,
+                      [this, &task] { return next_commit_seq_ == task->seq; });
+      if (!WriteChunk(task->header, task->body_buf)) {
+        AERROR << "Write chunk fail.";
+      }
+      ++next_commit_seq_;
+      commit_cv_.notify_all();
     }
-    if (!WriteChunk(chunk_flush_->header_, *(chunk_flush_->body_.get()))) {
-      AERROR << "Write chunk fail.";
+    {
+      std::lock_guard<std::mutex> flush_lock(flush_mutex_);
+      --inflight_chunk_number_;
+      flush_cv_.notify_all();
     }
-    chunk_flush_->clear();
   }
 }
 
+uint64_t RecordFileWriter::GetInflightChunkNumber() {
+  std::lock_guard<std::mutex> flush_lock(flush_mutex_);
+  return inflight_chunk_number_;
+}
+
 uint64_t RecordFileWriter::GetMessageNumber(
     const std::string& channel_name) const {
   auto search = channel_message_number_map_.find(channel_name);
@@ -17,7 +17,9 @@
 #ifndef CYBER_RECORD_FILE_RECORD_FILE_WRITER_H_
 #define CYBER_RECORD_FILE_RECORD_FILE_WRITER_H_
 
+#include <atomic>
 #include <condition_variable>
+#include <deque>
 #include <fstream>
 #include <memory>
 #include <string>
@@ -25,6 +27,7 @@
 #include <type_traits>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "google/protobuf/io/zero_copy_stream_impl.h"
 #include "google/protobuf/message.h"
@@ -85,19 +88,54 @@ class RecordFileWriter : public RecordFileBase {
   bool WriteMessage(const proto::SingleMessage& message);
   uint64_t GetMessageNumber(const std::string& channel_name) const;
 
+  /**
+   * @brief Get the number of chunks queued behind the flush pipeline.
+   */
+  uint64_t GetInflightChunkNumber();
+
+  /**
+   * @brief Get how many times WriteMessage stalled because the flush
+   * pipeline was full; a growing value means the disk or the serialize
+   * workers cannot keep up with the incoming data rate.
+   */
+  uint64_t GetStalledChunkNumber() const { return stalled_chunk_number_; }
+
  private:
+  // A full chunk travelling through the flush pipeline: serialize workers
+  // turn body into body_buf in parallel, then commit the sections to the
+  // file in seq order so the on-disk layout matches the single threaded
+  // writer.
+  struct FlushTask {
+    uint64_t seq = 0;
+    proto::ChunkHeader header;
+    std::unique_ptr<proto::ChunkBody> body = nullptr;
+    std::string body_buf;
+  };
+
+  // number of serialize workers and the bound on chunks in flight; a full
+  // pipeline stalls WriteMessage instead of queueing without limit
+  static const uint64_t kFlushThreadNum = 2;
+  static const uint64_t kMaxInflightChunkNum = 8;
+
   bool WriteChunk(const proto::ChunkHeader& chunk_header,
-                  const proto::ChunkBody& chunk_body);
+                  const std::string& chunk_body_buf);
   template <typename T>
   bool WriteSection(const T& message);
   bool WriteIndex();
-  void Flush();
+  void EnqueueChunk();
+  void FlushRoutine();
   bool is_writing_ = false;
   std::unique_ptr<Chunk> chunk_active_ = nullptr;
-  std::unique_ptr<Chunk> chunk_flush_ = nullptr;
-  std::shared_ptr<std::thread> flush_thread_ = nullptr;
+  std::vector<std::thread> flush_threads_;
+  std::deque<std::unique_ptr<FlushTask>> flush_queue_;
+  uint64_t next_enqueue_seq_ = 0;
+  uint64_t next_commit_seq_ = 0;
+  uint64_t inflight_chunk_number_ = 0;
+  std::atomic<uint64_t> stalled_chunk_number_ = {0};
   std::mutex flush_mutex_;
   std::condition_variable flush_cv_;
+  std::mutex commit_mutex_;
+  std::condition_variable commit_cv_;
   std::unordered_map<std::string, uint64_t> channel_message_number_map_;
 };
 
@@ -16,6 +16,7 @@
 
 #include "cyber/record/record_reader.h"
 
+#include <algorithm>
 #include <utility>
 
 namespace apollo {
@@ -42,6 +43,12 @@ RecordReader::RecordReader(const std::string& file) {
     index_ = file_reader_->GetIndex();
     for (int i = 0; i < index_.indexes_size(); ++i) {
       auto single_idx = index_.mutable_indexes(i);
+      if (single_idx->type() == SectionType::SECTION_CHUNK_HEADER &&
+          single_idx->has_chunk_header_cache()) {
+        chunk_index_.push_back({single_idx->chunk_header_cache().end_time(),
+                                single_idx->position()});
+        continue;
+      }
       if (single_idx->type() != SectionType::SECTION_CHANNEL) {
         continue;
       }
@@ -53,6 +60,10 @@ RecordReader::RecordReader(const std::string& file) {
       channel_info_.insert(
           std::make_pair(channel_cache->name(), *channel_cache));
     }
+    std::sort(chunk_index_.begin(), chunk_index_.end(),
+              [](const ChunkIndexEntry& lhs, const ChunkIndexEntry& rhs) {
+                return lhs.position < rhs.position;
+              });
   }
   file_reader_->Reset();
 }
@@ -60,10 +71,33 @@ RecordReader::RecordReader(const std::string& file) {
 void RecordReader::Reset() {
   file_reader_->Reset();
   reach_end_ = false;
+  sought_ = false;
   message_index_ = 0;
   chunk_.reset(new ChunkBody());
 }
 
+void RecordReader::SeekToChunk(uint64_t begin_time) {
+  sought_ = true;
+  if (chunk_index_.empty()) {
+    return;
+  }
+  // Chunks are laid out in time order, find the first one that may still
+  // contain messages at or after begin_time.
+  auto itr = std::lower_bound(chunk_index_.begin(), chunk_index_.end(),
+                              begin_time,
+                              [](const ChunkIndexEntry& entry, uint64_t time) {
+                                return entry.end_time < time;
+                              });
+  if (itr == chunk_index_.begin() || itr == chunk_index_.end()) {
+    return;
+  }
+  if (!file_reader_->SetPosition(itr->position)) {
+    AERROR << "Failed to seek to chunk at position: " << itr->position;
+    Reset();
+    sought_ = true;
+  }
+}
+
 std::set<std::string> RecordReader::GetChannelList() const {
   std::set<std::string> channel_list;
   for (auto& item : channel_info_) {
@@ -82,6 +116,10 @@ bool RecordReader::ReadMessage(RecordMessage* message, uint64_t begin_time,
     return false;
   }
 
+  if (!sought_ && begin_time > header_.begin_time()) {
+    SeekToChunk(begin_time);
+  }
+
   while (message_index_ < chunk_->messages_size()) {
     const auto& next_message = chunk_->messages(message_index_);
     uint64_t time = next_message.time();
@@ -21,6 +21,7 @@
 #include <set>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include "cyber/proto/record.pb.h"
 #include "cyber/record/file/record_file_reader.h"
@@ -113,13 +114,23 @@ class RecordReader : public RecordBase {
 
  private:
   bool ReadNextChunk(uint64_t begin_time, uint64_t end_time);
+  // Jump to the first chunk whose time range may contain begin_time, using
+  // the persisted chunk header index instead of scanning every chunk.
+  void SeekToChunk(uint64_t begin_time);
+
+  struct ChunkIndexEntry {
+    uint64_t end_time;
+    uint64_t position;
+  };
 
   bool is_valid_ = false;
   bool reach_end_ = false;
+  bool sought_ = false;
   std::unique_ptr<proto::ChunkBody> chunk_ = nullptr;
   proto::Index index_;
   int message_index_ = 0;
   ChannelInfoMap channel_info_;
+  std::vector<ChunkIndexEntry> chunk_index_;
   FileReaderPtr file_reader_;
 };
 
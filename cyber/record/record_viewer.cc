@@ -73,6 +73,28 @@ bool RecordViewer::Update(RecordMessage* message) {
   return find;
 }
 
+uint64_t RecordViewer::ForEachMessage(
+    const std::function<bool(const RecordMessage&)>& callback) {
+  uint64_t count = 0;
+  if (!IsValid()) {
+    return count;
+  }
+  Reset();
+  bool stop = false;
+  while (!stop) {
+    if (msg_buffer_.empty() && !FillBuffer()) {
+      break;
+    }
+    const auto& msg = msg_buffer_.begin()->second;
+    if (channels_.empty() || channels_.count(msg->channel_name) == 1) {
+      ++count;
+      stop = !callback(*msg);
+    }
+    msg_buffer_.erase(msg_buffer_.begin());
+  }
+  return count;
+}
+
 RecordViewer::Iterator RecordViewer::begin() { return Iterator(this); }
 
 RecordViewer::Iterator RecordViewer::end() { return Iterator(this, true); }
@@ -100,6 +122,9 @@ void RecordViewer::Init() {
 }
 
 void RecordViewer::Reset() {
+  if (prefetch_future_.valid()) {
+    prefetch_future_.get();
+  }
   for (auto& reader : readers_) {
     reader->Reset();
   }
@@ -137,41 +162,77 @@ void RecordViewer::UpdateTime() {
 }
 
 bool RecordViewer::FillBuffer() {
+  if (prefetch_future_.valid()) {
+    MessageBuffer prefetched = prefetch_future_.get();
+    msg_buffer_.insert(prefetched.begin(), prefetched.end());
+  }
   while (curr_begin_time_ <= end_time_ && msg_buffer_.size() < kBufferMinSize) {
-    uint64_t this_begin_time = curr_begin_time_;
-    uint64_t this_end_time = this_begin_time + kStepTimeNanoSec;
-    if (this_end_time > end_time_) {
-      this_end_time = end_time_;
-    }
-
-    for (size_t i = 0; i < readers_.size(); ++i) {
-      if (!readers_finished_[i] &&
-          readers_[i]->GetHeader().end_time() < this_begin_time) {
-        readers_finished_[i] = true;
-        readers_[i]->Reset();
+    FillWindow(&msg_buffer_);
+  }
+  // readahead: fill the next buffer in the background while the caller
+  // drains this one, so iteration overlaps with disk reads; the readers are
+  // touched only by this future until the next FillBuffer or Reset waits on
+  // it
+  if (curr_begin_time_ <= end_time_) {
+    prefetch_future_ = std::async(std::launch::async, [this]() {
+      MessageBuffer buffer;
+      while (curr_begin_time_ <= end_time_ && buffer.size() < kBufferMinSize) {
+        FillWindow(&buffer);
       }
+      return buffer;
+    });
+  }
+
+  return !msg_buffer_.empty();
+}
+
+void RecordViewer::FillWindow(MessageBuffer* const buffer) {
+  uint64_t this_begin_time = curr_begin_time_;
+  uint64_t this_end_time = this_begin_time + kStepTimeNanoSec;
+  if (this_end_time > end_time_) {
+    this_end_time = end_time_;
+  }
+
+  for (size_t i = 0; i < readers_.size(); ++i) {
+    if (!readers_finished_[i] &&
+        readers_[i]->GetHeader().end_time() < this_begin_time) {
+      readers_finished_[i] = true;
+      readers_[i]->Reset();
     }
+  }
 
-    for (size_t i = 0; i < readers_.size(); ++i) {
-      if (readers_finished_[i]) {
-        continue;
-      }
-      auto& reader = readers_[i];
-      while (true) {
-        auto record_msg = std::make_shared<RecordMessage>();
-        if (!reader->ReadMessage(record_msg.get(), this_begin_time,
-                                 this_end_time)) {
-          break;
-        }
-        msg_buffer_.emplace(std::make_pair(record_msg->time, record_msg));
+  // segments that start after this window cannot contribute to it; track
+  // the earliest upcoming start so gaps between segments are jumped over
+  // instead of stepped through window by window
+  uint64_t next_segment_begin = UINT64_MAX;
+  bool any_active = false;
+  for (size_t i = 0; i < readers_.size(); ++i) {
+    if (readers_finished_[i]) {
+      continue;
+    }
+    auto& reader = readers_[i];
+    const uint64_t segment_begin = reader->GetHeader().begin_time();
+    if (segment_begin > this_end_time) {
+      next_segment_begin = std::min(next_segment_begin, segment_begin);
+      continue;
+    }
+    any_active = true;
+    while (true) {
+      auto record_msg = std::make_shared<RecordMessage>();
+      if (!reader->ReadMessage(record_msg.get(), this_begin_time,
+                               this_end_time)) {
+        break;
       }
+      buffer->emplace(std::make_pair(record_msg->time, record_msg));
     }
-
-    // because ReadMessage of RecordReader is closed interval, so we add 1 here
-    curr_begin_time_ = this_end_time + 1;
   }
 
-  return !msg_buffer_.empty();
+  // because ReadMessage of RecordReader is closed interval, so we add 1 here
+  curr_begin_time_ = this_end_time + 1;
+  if (!any_active && next_segment_begin != UINT64_MAX &&
+      next_segment_begin > curr_begin_time_) {
+    curr_begin_time_ = next_segment_begin;
+  }
 }
 
 RecordViewer::Iterator::Iterator(RecordViewer* viewer, bool end)
@@ -18,6 +18,8 @@
 #define CYBER_RECORD_RECORD_VIEWER_H_
 
 #include <cstddef>
+#include <functional>
+#include <future>
 #include <map>
 #include <memory>
 #include <set>
@@ -174,13 +176,29 @@ class RecordViewer {
    */
   Iterator end();
 
+  /**
+   * @brief Visit every message in time order. The messages are passed to
+   * the callback by reference instead of being copied out of the buffer
+   * the way the iterator API does. Return false from the callback to stop
+   * early.
+   *
+   * @param callback
+   *
+   * @return The number of messages passed to the callback.
+   */
+  uint64_t ForEachMessage(
+      const std::function<bool(const RecordMessage&)>& callback);
+
  private:
   friend class Iterator;
 
+  using MessageBuffer = std::multimap<uint64_t, std::shared_ptr<RecordMessage>>;
+
   void Init();
   void Reset();
   void UpdateTime();
   bool FillBuffer();
+  void FillWindow(MessageBuffer* const buffer);
   bool Update(RecordMessage* message);
 
   uint64_t begin_time_ = 0;
@@ -193,7 +211,9 @@ class RecordViewer {
   std::vector<bool> readers_finished_;
 
   uint64_t curr_begin_time_ = 0;
-  std::multimap<uint64_t, std::shared_ptr<RecordMessage>> msg_buffer_;
+  MessageBuffer msg_buffer_;
+  // readahead for the next buffer, filled while the caller drains msg_buffer_
+  std::future<MessageBuffer> prefetch_future_;
 
   const uint64_t kStepTimeNanoSec = 1000000000UL;  // 1 second
   const std::size_t kBufferMinSize = 128;
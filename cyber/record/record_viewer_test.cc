@@ -110,6 +110,37 @@ TEST(RecordTest, iterator_test) {
   ASSERT_FALSE(remove(kTestFile));
 }
 
+TEST(RecordTest, for_each_message_test) {
+  uint64_t msg_num = 200;
+  uint64_t begin_time = 100000000;
+  uint64_t step_time = 100000000;  // 100ms
+  ConstructRecord(msg_num, begin_time, step_time);
+
+  auto reader = std::make_shared<RecordReader>(kTestFile);
+  RecordViewer viewer(reader);
+  EXPECT_TRUE(viewer.IsValid());
+
+  uint64_t i = 0;
+  uint64_t count = viewer.ForEachMessage([&i](const RecordMessage& msg) {
+    EXPECT_EQ(kChannelName1, msg.channel_name);
+    EXPECT_EQ(std::to_string(i), msg.content);
+    i++;
+    return true;
+  });
+  EXPECT_EQ(msg_num, i);
+  EXPECT_EQ(msg_num, count);
+
+  // the callback can stop the traversal early
+  i = 0;
+  count = viewer.ForEachMessage([&i](const RecordMessage&) {
+    i++;
+    return i < 10;
+  });
+  EXPECT_EQ(10, i);
+  EXPECT_EQ(10, count);
+  ASSERT_FALSE(remove(kTestFile));
+}
+
 TEST(RecordTest, iterator_test_reverse) {
   uint64_t msg_num = 200;
   uint64_t begin_time = 1000;
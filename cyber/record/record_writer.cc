@@ -215,6 +215,22 @@ const std::string& RecordWriter::GetProtoDesc(
   return kEmptyString;
 }
 
+uint64_t RecordWriter::GetInflightChunkNumber() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (file_writer_ == nullptr) {
+    return 0;
+  }
+  return file_writer_->GetInflightChunkNumber();
+}
+
+uint64_t RecordWriter::GetStalledChunkNumber() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (file_writer_ == nullptr) {
+    return 0;
+  }
+  return file_writer_->GetStalledChunkNumber();
+}
+
 std::set<std::string> RecordWriter::GetChannelList() const {
   std::set<std::string> channel_list;
   for (const auto& item : channel_message_number_map_) {
@@ -168,6 +168,22 @@ class RecordWriter : public RecordBase {
    */
   bool IsNewChannel(const std::string& channel_name) const;
 
+  /**
+   * @brief Get the number of chunks queued behind the file flush pipeline.
+   *
+   * @return Inflight chunk number.
+   */
+  uint64_t GetInflightChunkNumber();
+
+  /**
+   * @brief Get how many chunk flushes stalled because the flush pipeline
+   * was full. A growing value means the disk cannot keep up with the
+   * incoming data rate.
+   *
+   * @return Stalled chunk number.
+   */
+  uint64_t GetStalledChunkNumber();
+
  private:
   bool WriteMessage(const proto::SingleMessage& single_msg);
   bool SplitOutfile();
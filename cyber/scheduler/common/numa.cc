@@ -0,0 +1,120 @@
+/******************************************************************************
+ * Copyright 2019 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "cyber/scheduler/common/numa.h"
+
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <fstream>
+#include <mutex>
+#include <sstream>
+#include <string>
+
+#include "cyber/common/log.h"
+#include "cyber/scheduler/common/pin_thread.h"
+
+// from linux/mempolicy.h, which libnuma-less systems may not install
+#ifndef MPOL_PREFERRED
+#define MPOL_PREFERRED 1
+#endif
+
+namespace apollo {
+namespace cyber {
+namespace scheduler {
+
+namespace {
+
+// cpu index -> node index, built from sysfs once
+std::vector<int> cpu_to_node;
+int node_count = 1;
+std::once_flag topology_init_flag;
+
+void InitTopology() {
+  for (int node = 0;; ++node) {
+    std::ifstream cpulist("/sys/devices/system/node/node" +
+                          std::to_string(node) + "/cpulist");
+    if (!cpulist.is_open()) {
+      node_count = node > 0 ? node : 1;
+      return;
+    }
+    std::string line;
+    if (!std::getline(cpulist, line) || line.empty()) {
+      continue;
+    }
+    std::vector<int> cpuset;
+    ParseCpuset(line, &cpuset);
+    for (auto cpu : cpuset) {
+      if (cpu >= static_cast<int>(cpu_to_node.size())) {
+        cpu_to_node.resize(cpu + 1, -1);
+      }
+      cpu_to_node[cpu] = node;
+    }
+  }
+}
+
+}  // namespace
+
+int NumaNodeCount() {
+  std::call_once(topology_init_flag, InitTopology);
+  return node_count;
+}
+
+int NumaNodeOfCpu(int cpu) {
+  std::call_once(topology_init_flag, InitTopology);
+  if (cpu < 0 || cpu >= static_cast<int>(cpu_to_node.size())) {
+    return -1;
+  }
+  return cpu_to_node[cpu];
+}
+
+int NumaNodeOfCpuset(const std::vector<int>& cpuset) {
+  if (cpuset.empty()) {
+    return -1;
+  }
+  int node = NumaNodeOfCpu(cpuset[0]);
+  for (auto cpu : cpuset) {
+    if (NumaNodeOfCpu(cpu) != node) {
+      return -1;
+    }
+  }
+  return node;
+}
+
+int NumaNodeOfProcessor(const std::vector<int>& cpuset,
+                        const std::string& affinity, uint32_t index) {
+  if (affinity == "1to1" && index < cpuset.size()) {
+    return NumaNodeOfCpu(cpuset[index]);
+  }
+  return NumaNodeOfCpuset(cpuset);
+}
+
+bool BindCurrentThreadToNumaNode(int node) {
+  if (node < 0 || NumaNodeCount() < 2) {
+    return false;
+  }
+  unsigned long nodemask = 1UL << node;  // NOLINT
+  if (syscall(SYS_set_mempolicy, MPOL_PREFERRED, &nodemask,
+              sizeof(nodemask) * 8) != 0) {
+    AWARN << "set_mempolicy to node " << node << " failed, errno: " << errno;
+    return false;
+  }
+  return true;
+}
+
+}  // namespace scheduler
+}  // namespace cyber
+}  // namespace apollo
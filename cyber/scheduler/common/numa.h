@@ -0,0 +1,56 @@
+/******************************************************************************
+ * Copyright 2019 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#ifndef CYBER_SCHEDULER_COMMON_NUMA_H_
+#define CYBER_SCHEDULER_COMMON_NUMA_H_
+
+#include <string>
+#include <vector>
+
+namespace apollo {
+namespace cyber {
+namespace scheduler {
+
+// NUMA helpers built on sysfs and raw kernel syscalls, so they work
+// without libnuma. All of them degrade to no-ops on single node hosts.
+
+// Number of online NUMA nodes, 1 on non-NUMA hosts.
+int NumaNodeCount();
+
+// Node owning the given cpu, -1 if unknown.
+int NumaNodeOfCpu(int cpu);
+
+// Node shared by every cpu in the set, -1 if the set is empty, spans
+// several nodes, or the topology is unknown.
+int NumaNodeOfCpuset(const std::vector<int>& cpuset);
+
+// Node for the index-th processor of a group given the group cpuset and
+// affinity mode: "1to1" pins processor index to cpuset[index], any other
+// mode lets it float over the whole set.
+int NumaNodeOfProcessor(const std::vector<int>& cpuset,
+                        const std::string& affinity, uint32_t index);
+
+// Prefer the given node for all future page allocations of the calling
+// thread, so first-touch memory (croutine stacks, channel buffers) lands
+// on the node the thread is pinned to. Returns false on single node
+// hosts or when the kernel rejects the policy.
+bool BindCurrentThreadToNumaNode(int node);
+
+}  // namespace scheduler
+}  // namespace cyber
+}  // namespace apollo
+
+#endif  // CYBER_SCHEDULER_COMMON_NUMA_H_
@@ -17,11 +17,19 @@
 #include "cyber/scheduler/policy/classic_context.h"
 
 #include <climits>
+#include <thread>
 
 namespace apollo {
 namespace cyber {
 namespace scheduler {
 
+namespace {
+// spin tier of the low latency wait covers a few microseconds on a
+// dedicated core, the yield tier bridges to the blocking wait
+constexpr uint32_t kWaitSpinRound = 5000;
+constexpr uint32_t kWaitYieldRound = 10;
+}  // namespace
+
 using apollo::cyber::base::AtomicRWLock;
 using apollo::cyber::base::ReadLockGuard;
 using apollo::cyber::base::WriteLockGuard;
@@ -33,6 +41,8 @@ alignas(CACHELINE_SIZE) GRP_WQ_CV ClassicContext::cv_wq_;
 alignas(CACHELINE_SIZE) RQ_LOCK_GROUP ClassicContext::rq_locks_;
 alignas(CACHELINE_SIZE) CR_GROUP ClassicContext::cr_group_;
 alignas(CACHELINE_SIZE) NOTIFY_GRP ClassicContext::notify_grp_;
+alignas(CACHELINE_SIZE) GRP_CTX ClassicContext::grp_ctxs_;
+alignas(CACHELINE_SIZE) AtomicRWLock ClassicContext::grp_ctx_lock_;
 
 ClassicContext::ClassicContext() { InitGroup(DEFAULT_GROUP_NAME); }
 
@@ -47,6 +57,30 @@ void ClassicContext::InitGroup(const std::string& group_name) {
   cw_ = &cv_wq_[group_name];
   notify_grp_[group_name] = 0;
   current_grp = group_name;
+  {
+    WriteLockGuard<AtomicRWLock> lk(grp_ctx_lock_);
+    grp_ctxs_[group_name].emplace_back(this);
+  }
+}
+
+std::shared_ptr<CRoutine> ClassicContext::NextLocalRoutine(
+    ClassicContext* ctx) {
+  for (int i = MAX_PRIO - 1; i >= 0; --i) {
+    ReadLockGuard<AtomicRWLock> lk(ctx->local_lq_.at(i));
+    for (auto& cr : ctx->local_rq_.at(i)) {
+      if (!cr->Acquire()) {
+        continue;
+      }
+
+      if (cr->UpdateState() == RoutineState::READY) {
+        return cr;
+      }
+
+      cr->Release();
+    }
+  }
+
+  return nullptr;
 }
 
 std::shared_ptr<CRoutine> ClassicContext::NextRoutine() {
@@ -54,25 +88,91 @@ std::shared_ptr<CRoutine> ClassicContext::NextRoutine() {
     return nullptr;
   }
 
+  // Own run queue first.
+  auto cr = NextLocalRoutine(this);
+  if (cr != nullptr) {
+    return cr;
+  }
+
+  // Steal from the other processors of the same group, so one bursting
+  // channel cannot leave siblings idle while this queue is drained.
+  {
+    ReadLockGuard<AtomicRWLock> lk(grp_ctx_lock_);
+    auto itr = grp_ctxs_.find(current_grp);
+    if (itr != grp_ctxs_.end()) {
+      for (auto ctx : itr->second) {
+        if (ctx == this) {
+          continue;
+        }
+        cr = NextLocalRoutine(ctx);
+        if (cr != nullptr) {
+          return cr;
+        }
+      }
+    }
+  }
+
+  // Shared group queue, still fed by the choreography pool and used before
+  // any processor of a group is up.
   for (int i = MAX_PRIO - 1; i >= 0; --i) {
     ReadLockGuard<AtomicRWLock> lk(lq_->at(i));
-    for (auto& cr : multi_pri_rq_->at(i)) {
-      if (!cr->Acquire()) {
+    for (auto& shared_cr : multi_pri_rq_->at(i)) {
+      if (!shared_cr->Acquire()) {
         continue;
       }
 
-      if (cr->UpdateState() == RoutineState::READY) {
-        return cr;
+      if (shared_cr->UpdateState() == RoutineState::READY) {
+        return shared_cr;
       }
 
-      cr->Release();
+      shared_cr->Release();
     }
   }
 
   return nullptr;
 }
 
+void ClassicContext::EnqueueLocal(const std::shared_ptr<CRoutine>& cr) {
+  static std::atomic<uint32_t> rr_seq = {0};
+  ClassicContext* target = nullptr;
+  {
+    ReadLockGuard<AtomicRWLock> lk(grp_ctx_lock_);
+    auto itr = grp_ctxs_.find(cr->group_name());
+    if (itr != grp_ctxs_.end() && !itr->second.empty()) {
+      target = itr->second[rr_seq.fetch_add(1) % itr->second.size()];
+    }
+  }
+
+  if (target == nullptr) {
+    WriteLockGuard<AtomicRWLock> lk(
+        rq_locks_[cr->group_name()].at(cr->priority()));
+    cr_group_[cr->group_name()].at(cr->priority()).emplace_back(cr);
+    return;
+  }
+
+  WriteLockGuard<AtomicRWLock> lk(target->local_lq_.at(cr->priority()));
+  target->local_rq_.at(cr->priority()).emplace_back(cr);
+}
+
 void ClassicContext::Wait() {
+  if (cyber_unlikely(low_latency_wait_)) {
+    // Bounded busy-spin and then bounded yield before touching the mutex;
+    // a notification arriving in either tier is consumed by the blocking
+    // section below without waiting, so dispatch skips the condition
+    // variable wakeup latency.
+    auto& pending = notify_grp_[current_grp];
+    bool notified = false;
+    for (uint32_t i = 0; i < kWaitSpinRound && !notified; ++i) {
+      notified = pending.load(std::memory_order_acquire) > 0;
+      if (!notified) {
+        cpu_relax();
+      }
+    }
+    for (uint32_t i = 0; i < kWaitYieldRound && !notified; ++i) {
+      std::this_thread::yield();
+      notified = pending.load(std::memory_order_acquire) > 0;
+    }
+  }
   std::unique_lock<std::mutex> lk(mtx_wrapper_->Mutex());
   cw_->Cv().wait_for(lk, std::chrono::milliseconds(1000),
                      [&]() { return notify_grp_[current_grp] > 0; });
@@ -96,13 +196,8 @@ void ClassicContext::Notify(const std::string& group_name) {
   cv_wq_[group_name].Cv().notify_one();
 }
 
-bool ClassicContext::RemoveCRoutine(const std::shared_ptr<CRoutine>& cr) {
-  auto grp = cr->group_name();
-  auto prio = cr->priority();
-  auto crid = cr->id();
-  WriteLockGuard<AtomicRWLock> lk(ClassicContext::rq_locks_[grp].at(prio));
-  auto& croutines = ClassicContext::cr_group_[grp].at(prio);
-  for (auto it = croutines.begin(); it != croutines.end(); ++it) {
+static bool RemoveFromQueue(CROUTINE_QUEUE* croutines, uint64_t crid) {
+  for (auto it = croutines->begin(); it != croutines->end(); ++it) {
     if ((*it)->id() == crid) {
       auto cr = *it;
       cr->Stop();
@@ -110,7 +205,7 @@ bool ClassicContext::RemoveCRoutine(const std::shared_ptr<CRoutine>& cr) {
         std::this_thread::sleep_for(std::chrono::microseconds(1));
         AINFO_EVERY(1000) << "waiting for task " << cr->name() << " completion";
       }
-      croutines.erase(it);
+      croutines->erase(it);
       cr->Release();
       return true;
     }
@@ -118,6 +213,31 @@ bool ClassicContext::RemoveCRoutine(const std::shared_ptr<CRoutine>& cr) {
   return false;
 }
 
+bool ClassicContext::RemoveCRoutine(const std::shared_ptr<CRoutine>& cr) {
+  auto grp = cr->group_name();
+  auto prio = cr->priority();
+  auto crid = cr->id();
+  {
+    WriteLockGuard<AtomicRWLock> lk(ClassicContext::rq_locks_[grp].at(prio));
+    if (RemoveFromQueue(&ClassicContext::cr_group_[grp].at(prio), crid)) {
+      return true;
+    }
+  }
+
+  // Not in the shared group queue, search the processor-local queues.
+  ReadLockGuard<AtomicRWLock> ctx_lk(grp_ctx_lock_);
+  auto itr = grp_ctxs_.find(grp);
+  if (itr != grp_ctxs_.end()) {
+    for (auto ctx : itr->second) {
+      WriteLockGuard<AtomicRWLock> lk(ctx->local_lq_.at(prio));
+      if (RemoveFromQueue(&ctx->local_rq_.at(prio), crid)) {
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
 }  // namespace scheduler
 }  // namespace cyber
 }  // namespace apollo
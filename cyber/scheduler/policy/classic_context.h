@@ -18,6 +18,7 @@
 #define CYBER_SCHEDULER_POLICY_CLASSIC_CONTEXT_H_
 
 #include <array>
+#include <atomic>
 #include <functional>
 #include <memory>
 #include <mutex>
@@ -47,7 +48,11 @@ using RQ_LOCK_GROUP = std::unordered_map<std::string, LOCK_QUEUE>;
 
 using GRP_WQ_MUTEX = std::unordered_map<std::string, MutexWrapper>;
 using GRP_WQ_CV = std::unordered_map<std::string, CvWrapper>;
-using NOTIFY_GRP = std::unordered_map<std::string, int>;
+// atomic so the low latency wait can poll it without taking the group mutex
+using NOTIFY_GRP = std::unordered_map<std::string, std::atomic<int>>;
+
+class ClassicContext;
+using GRP_CTX = std::unordered_map<std::string, std::vector<ClassicContext *>>;
 
 class ClassicContext : public ProcessorContext {
  public:
@@ -58,26 +63,47 @@ class ClassicContext : public ProcessorContext {
   void Wait() override;
   void Shutdown() override;
 
+  // Let Wait busy-spin briefly and then yield before blocking on the group
+  // condition variable. Meant for groups whose processors run a real-time
+  // policy on dedicated cores, where condition variable wakeup latency
+  // dominates the dispatch path.
+  void SetLowLatencyWait(bool enable) { low_latency_wait_ = enable; }
+
   static void Notify(const std::string &group_name);
   static bool RemoveCRoutine(const std::shared_ptr<CRoutine> &cr);
 
+  // Enqueue into a processor-local run queue of the croutine's group,
+  // round-robin across processors. Falls back to the shared group queue
+  // while the group has no processor yet.
+  static void EnqueueLocal(const std::shared_ptr<CRoutine> &cr);
+
   alignas(CACHELINE_SIZE) static CR_GROUP cr_group_;
   alignas(CACHELINE_SIZE) static RQ_LOCK_GROUP rq_locks_;
   alignas(CACHELINE_SIZE) static GRP_WQ_CV cv_wq_;
   alignas(CACHELINE_SIZE) static GRP_WQ_MUTEX mtx_wq_;
   alignas(CACHELINE_SIZE) static NOTIFY_GRP notify_grp_;
+  alignas(CACHELINE_SIZE) static GRP_CTX grp_ctxs_;
+  alignas(CACHELINE_SIZE) static base::AtomicRWLock grp_ctx_lock_;
 
  private:
   void InitGroup(const std::string &group_name);
+  static std::shared_ptr<CRoutine> NextLocalRoutine(ClassicContext *ctx);
 
   std::chrono::steady_clock::time_point wake_time_;
   bool need_sleep_ = false;
+  bool low_latency_wait_ = false;
 
   MULTI_PRIO_QUEUE *multi_pri_rq_ = nullptr;
   LOCK_QUEUE *lq_ = nullptr;
   MutexWrapper *mtx_wrapper_ = nullptr;
   CvWrapper *cw_ = nullptr;
 
+  // Processor-local run queue. Other processors of the same group may scan
+  // it in NextRoutine to steal work, croutine ownership is still arbitrated
+  // through CRoutine::Acquire.
+  MULTI_PRIO_QUEUE local_rq_;
+  LOCK_QUEUE local_lq_;
+
   std::string current_grp;
 };
 
@@ -22,6 +22,7 @@
 
 #include "cyber/common/environment.h"
 #include "cyber/common/file.h"
+#include "cyber/scheduler/common/numa.h"
 #include "cyber/scheduler/policy/choreography_context.h"
 #include "cyber/scheduler/policy/classic_context.h"
 #include "cyber/scheduler/processor.h"
@@ -97,6 +98,8 @@ void SchedulerChoreography::CreateProcessor() {
     auto proc = std::make_shared<Processor>();
     auto ctx = std::make_shared<ChoreographyContext>();
 
+    proc->SetPreferredNumaNode(NumaNodeOfProcessor(
+        choreography_cpuset_, choreography_affinity_, i));
     proc->BindContext(ctx);
     SetSchedAffinity(proc->Thread(), choreography_cpuset_,
                      choreography_affinity_, i);
@@ -110,6 +113,8 @@ void SchedulerChoreography::CreateProcessor() {
     auto proc = std::make_shared<Processor>();
     auto ctx = std::make_shared<ClassicContext>();
 
+    proc->SetPreferredNumaNode(
+        NumaNodeOfProcessor(pool_cpuset_, pool_affinity_, i));
     proc->BindContext(ctx);
     SetSchedAffinity(proc->Thread(), pool_cpuset_, pool_affinity_, i);
     SetSchedPolicy(proc->Thread(), pool_processor_policy_, pool_processor_prio_,
@@ -22,6 +22,7 @@
 
 #include "cyber/common/environment.h"
 #include "cyber/common/file.h"
+#include "cyber/scheduler/common/numa.h"
 #include "cyber/scheduler/policy/classic_context.h"
 #include "cyber/scheduler/processor.h"
 
@@ -95,11 +96,20 @@ void SchedulerClassic::CreateProcessor() {
     std::vector<int> cpuset;
     ParseCpuset(group.cpuset(), &cpuset);
 
+    // groups running a real-time policy dedicate cores to latency critical
+    // tasks (control, canbus); let their processors spin briefly before
+    // blocking so dispatch skips the condition variable wakeup
+    bool low_latency_wait =
+        (processor_policy == "SCHED_FIFO" || processor_policy == "SCHED_RR");
+
     for (uint32_t i = 0; i < proc_num; i++) {
       auto ctx = std::make_shared<ClassicContext>(group_name);
+      ctx->SetLowLatencyWait(low_latency_wait);
       pctxs_.emplace_back(ctx);
 
       auto proc = std::make_shared<Processor>();
+      // keep first-touch allocations on the node the group is pinned to
+      proc->SetPreferredNumaNode(NumaNodeOfProcessor(cpuset, affinity, i));
       proc->BindContext(ctx);
       SetSchedAffinity(proc->Thread(), cpuset, affinity, i);
       SetSchedPolicy(proc->Thread(), processor_policy, processor_prio,
@@ -147,14 +157,9 @@ bool SchedulerClassic::DispatchTask(const std::shared_ptr<CRoutine>& cr) {
     cr->set_priority(MAX_PRIO - 1);
   }
 
-  // Enqueue task.
-  {
-    WriteLockGuard<AtomicRWLock> lk(
-        ClassicContext::rq_locks_[cr->group_name()].at(cr->priority()));
-    ClassicContext::cr_group_[cr->group_name()]
-        .at(cr->priority())
-        .emplace_back(cr);
-  }
+  // Enqueue task on a processor-local run queue of its group; idle
+  // processors of the group steal from each other in NextRoutine.
+  ClassicContext::EnqueueLocal(cr);
 
   ClassicContext::Notify(cr->group_name());
   return true;
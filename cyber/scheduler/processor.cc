@@ -24,6 +24,7 @@
 #include "cyber/common/global_data.h"
 #include "cyber/common/log.h"
 #include "cyber/croutine/croutine.h"
+#include "cyber/scheduler/common/numa.h"
 #include "cyber/time/time.h"
 
 namespace apollo {
@@ -41,6 +42,12 @@ void Processor::Run() {
   AINFO << "processor_tid: " << tid_;
   snap_shot_->processor_id.store(tid_);
 
+  if (numa_node_ >= 0 && BindCurrentThreadToNumaNode(numa_node_)) {
+    // croutine stacks and buffers fault in on first touch from this
+    // thread, so they now land on the processor's own node
+    AINFO << "processor " << tid_ << " prefers numa node " << numa_node_;
+  }
+
   while (cyber_likely(running_.load())) {
     if (cyber_likely(context_ != nullptr)) {
       auto croutine = context_->NextRoutine();
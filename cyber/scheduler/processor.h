@@ -52,6 +52,10 @@ class Processor {
   std::thread* Thread() { return &thread_; }
   std::atomic<pid_t>& Tid();
 
+  // Prefer the given NUMA node for the processor thread's allocations;
+  // must be called before BindContext starts the thread. -1 disables it.
+  void SetPreferredNumaNode(int node) { numa_node_ = node; }
+
   std::shared_ptr<Snapshot> ProcSnapshot() { return snap_shot_; }
 
  private:
@@ -64,6 +68,7 @@ class Processor {
 
   std::atomic<pid_t> tid_{-1};
   std::atomic<bool> running_{false};
+  int numa_node_ = -1;
 
   std::shared_ptr<Snapshot> snap_shot_ = std::make_shared<Snapshot>();
 };
@@ -121,6 +121,24 @@ void Scheduler::CheckSchedStatus() {
   snap_info.clear();
 }
 
+void Scheduler::GetRoutineMetrics(proto::SchedulerMetrics* metrics) {
+  metrics->set_timestamp_ns(Time::Now().ToNanosecond());
+  metrics->set_process_id(getpid());
+  metrics->set_process_group(GlobalData::Instance()->ProcessGroup());
+  ReadLockGuard<AtomicRWLock> lk(id_cr_lock_);
+  for (auto& cr_pair : id_cr_) {
+    auto& cr = cr_pair.second;
+    auto* routine_metrics = metrics->add_routine_metrics();
+    routine_metrics->set_id(cr->id());
+    routine_metrics->set_name(cr->name());
+    routine_metrics->set_group_name(cr->group_name());
+    routine_metrics->set_processor_id(cr->processor_id());
+    routine_metrics->set_exec_time_ns(cr->exec_time_ns());
+    routine_metrics->set_wait_time_ns(cr->wait_time_ns());
+    routine_metrics->set_switch_count(cr->switch_count());
+  }
+}
+
 void Scheduler::Shutdown() {
   if (cyber_unlikely(stop_.exchange(true))) {
     return;
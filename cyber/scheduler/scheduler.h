@@ -35,6 +35,7 @@
 #include "cyber/croutine/croutine.h"
 #include "cyber/croutine/routine_factory.h"
 #include "cyber/proto/choreography_conf.pb.h"
+#include "cyber/proto/routine_metrics.pb.h"
 #include "cyber/scheduler/common/mutex_wrapper.h"
 #include "cyber/scheduler/common/pin_thread.h"
 
@@ -77,6 +78,10 @@ class Scheduler {
 
   void CheckSchedStatus();
 
+  // Snapshots the cumulative runtime statistics of every croutine managed by
+  // this scheduler; consumers diff two snapshots to derive rates.
+  void GetRoutineMetrics(proto::SchedulerMetrics* metrics);
+
   void SetInnerThreadConfs(
       const std::unordered_map<std::string, InnerThread>& confs) {
     inner_thr_confs_ = confs;
@@ -32,38 +32,47 @@ using proto::RoleAttributes;
 
 bool MultiValueWarehouse::Add(uint64_t key, const RolePtr& role,
                               bool ignore_if_exist) {
-  WriteLockGuard<AtomicRWLock> lock(rw_lock_);
+  auto& shard = ShardOf(key);
+  WriteLockGuard<AtomicRWLock> lock(shard.rw_lock);
   if (!ignore_if_exist) {
-    if (roles_.find(key) != roles_.end()) {
+    if (shard.roles.find(key) != shard.roles.end()) {
       return false;
     }
   }
   std::pair<uint64_t, RolePtr> role_pair(key, role);
-  roles_.insert(role_pair);
+  shard.roles.insert(role_pair);
   return true;
 }
 
 void MultiValueWarehouse::Clear() {
-  WriteLockGuard<AtomicRWLock> lock(rw_lock_);
-  roles_.clear();
+  for (auto& shard : shards_) {
+    WriteLockGuard<AtomicRWLock> lock(shard.rw_lock);
+    shard.roles.clear();
+  }
 }
 
 std::size_t MultiValueWarehouse::Size() {
-  ReadLockGuard<AtomicRWLock> lock(rw_lock_);
-  return roles_.size();
+  std::size_t size = 0;
+  for (auto& shard : shards_) {
+    ReadLockGuard<AtomicRWLock> lock(shard.rw_lock);
+    size += shard.roles.size();
+  }
+  return size;
 }
 
 void MultiValueWarehouse::Remove(uint64_t key) {
-  WriteLockGuard<AtomicRWLock> lock(rw_lock_);
-  roles_.erase(key);
+  auto& shard = ShardOf(key);
+  WriteLockGuard<AtomicRWLock> lock(shard.rw_lock);
+  shard.roles.erase(key);
 }
 
 void MultiValueWarehouse::Remove(uint64_t key, const RolePtr& role) {
-  WriteLockGuard<AtomicRWLock> lock(rw_lock_);
-  auto range = roles_.equal_range(key);
+  auto& shard = ShardOf(key);
+  WriteLockGuard<AtomicRWLock> lock(shard.rw_lock);
+  auto range = shard.roles.equal_range(key);
   for (auto it = range.first; it != range.second;) {
     if (it->second->Match(role->attributes())) {
-      it = roles_.erase(it);
+      it = shard.roles.erase(it);
     } else {
       ++it;
     }
@@ -71,13 +80,15 @@ void MultiValueWarehouse::Remove(uint64_t key, const RolePtr& role) {
 }
 
 void MultiValueWarehouse::Remove(const RoleAttributes& target_attr) {
-  WriteLockGuard<AtomicRWLock> lock(rw_lock_);
-  for (auto it = roles_.begin(); it != roles_.end();) {
-    auto curr_role = it->second;
-    if (curr_role->Match(target_attr)) {
-      it = roles_.erase(it);
-    } else {
-      ++it;
+  for (auto& shard : shards_) {
+    WriteLockGuard<AtomicRWLock> lock(shard.rw_lock);
+    for (auto it = shard.roles.begin(); it != shard.roles.end();) {
+      auto curr_role = it->second;
+      if (curr_role->Match(target_attr)) {
+        it = shard.roles.erase(it);
+      } else {
+        ++it;
+      }
     }
   }
 }
@@ -89,9 +100,10 @@ bool MultiValueWarehouse::Search(uint64_t key) {
 
 bool MultiValueWarehouse::Search(uint64_t key, RolePtr* first_matched_role) {
   RETURN_VAL_IF_NULL(first_matched_role, false);
-  ReadLockGuard<AtomicRWLock> lock(rw_lock_);
-  auto search = roles_.find(key);
-  if (search == roles_.end()) {
+  auto& shard = ShardOf(key);
+  ReadLockGuard<AtomicRWLock> lock(shard.rw_lock);
+  auto search = shard.roles.find(key);
+  if (search == shard.roles.end()) {
     return false;
   }
   *first_matched_role = search->second;
@@ -113,8 +125,9 @@ bool MultiValueWarehouse::Search(uint64_t key,
                                  std::vector<RolePtr>* matched_roles) {
   RETURN_VAL_IF_NULL(matched_roles, false);
   bool find = false;
-  ReadLockGuard<AtomicRWLock> lock(rw_lock_);
-  auto range = roles_.equal_range(key);
+  auto& shard = ShardOf(key);
+  ReadLockGuard<AtomicRWLock> lock(shard.rw_lock);
+  auto range = shard.roles.equal_range(key);
   for_each(range.first, range.second,
            [&matched_roles, &find](RoleMap::value_type& item) {
              matched_roles->emplace_back(item.second);
@@ -127,8 +140,9 @@ bool MultiValueWarehouse::Search(
     uint64_t key, std::vector<RoleAttributes>* matched_roles_attr) {
   RETURN_VAL_IF_NULL(matched_roles_attr, false);
   bool find = false;
-  ReadLockGuard<AtomicRWLock> lock(rw_lock_);
-  auto range = roles_.equal_range(key);
+  auto& shard = ShardOf(key);
+  ReadLockGuard<AtomicRWLock> lock(shard.rw_lock);
+  auto range = shard.roles.equal_range(key);
   for_each(range.first, range.second,
            [&matched_roles_attr, &find](RoleMap::value_type& item) {
              matched_roles_attr->emplace_back(item.second->attributes());
@@ -145,11 +159,13 @@ bool MultiValueWarehouse::Search(const RoleAttributes& target_attr) {
 bool MultiValueWarehouse::Search(const RoleAttributes& target_attr,
                                  RolePtr* first_matched_role) {
   RETURN_VAL_IF_NULL(first_matched_role, false);
-  ReadLockGuard<AtomicRWLock> lock(rw_lock_);
-  for (auto& item : roles_) {
-    if (item.second->Match(target_attr)) {
-      *first_matched_role = item.second;
-      return true;
+  for (auto& shard : shards_) {
+    ReadLockGuard<AtomicRWLock> lock(shard.rw_lock);
+    for (auto& item : shard.roles) {
+      if (item.second->Match(target_attr)) {
+        *first_matched_role = item.second;
+        return true;
+      }
     }
   }
   return false;
@@ -170,11 +186,13 @@ bool MultiValueWarehouse::Search(const RoleAttributes& target_attr,
                                  std::vector<RolePtr>* matched_roles) {
   RETURN_VAL_IF_NULL(matched_roles, false);
   bool find = false;
-  ReadLockGuard<AtomicRWLock> lock(rw_lock_);
-  for (auto& item : roles_) {
-    if (item.second->Match(target_attr)) {
-      matched_roles->emplace_back(item.second);
-      find = true;
+  for (auto& shard : shards_) {
+    ReadLockGuard<AtomicRWLock> lock(shard.rw_lock);
+    for (auto& item : shard.roles) {
+      if (item.second->Match(target_attr)) {
+        matched_roles->emplace_back(item.second);
+        find = true;
+      }
     }
   }
   return find;
@@ -185,11 +203,13 @@ bool MultiValueWarehouse::Search(
     std::vector<RoleAttributes>* matched_roles_attr) {
   RETURN_VAL_IF_NULL(matched_roles_attr, false);
   bool find = false;
-  ReadLockGuard<AtomicRWLock> lock(rw_lock_);
-  for (auto& item : roles_) {
-    if (item.second->Match(target_attr)) {
-      matched_roles_attr->emplace_back(item.second->attributes());
-      find = true;
+  for (auto& shard : shards_) {
+    ReadLockGuard<AtomicRWLock> lock(shard.rw_lock);
+    for (auto& item : shard.roles) {
+      if (item.second->Match(target_attr)) {
+        matched_roles_attr->emplace_back(item.second->attributes());
+        find = true;
+      }
     }
   }
   return find;
@@ -197,17 +217,21 @@ bool MultiValueWarehouse::Search(
 
 void MultiValueWarehouse::GetAllRoles(std::vector<RolePtr>* roles) {
   RETURN_IF_NULL(roles);
-  ReadLockGuard<AtomicRWLock> lock(rw_lock_);
-  for (auto& item : roles_) {
-    roles->emplace_back(item.second);
+  for (auto& shard : shards_) {
+    ReadLockGuard<AtomicRWLock> lock(shard.rw_lock);
+    for (auto& item : shard.roles) {
+      roles->emplace_back(item.second);
+    }
   }
 }
 
 void MultiValueWarehouse::GetAllRoles(std::vector<RoleAttributes>* roles_attr) {
   RETURN_IF_NULL(roles_attr);
-  ReadLockGuard<AtomicRWLock> lock(rw_lock_);
-  for (auto& item : roles_) {
-    roles_attr->emplace_back(item.second->attributes());
+  for (auto& shard : shards_) {
+    ReadLockGuard<AtomicRWLock> lock(shard.rw_lock);
+    for (auto& item : shard.roles) {
+      roles_attr->emplace_back(item.second->attributes());
+    }
   }
 }
 
@@ -67,8 +67,22 @@ class MultiValueWarehouse : public WarehouseBase {
   void GetAllRoles(std::vector<proto::RoleAttributes>* roles_attr) override;
 
  private:
-  RoleMap roles_;
-  base::AtomicRWLock rw_lock_;
+  // Roles are sharded by key so that concurrent updates and queries on
+  // different keys (channels or nodes) do not contend on a single lock.
+  // The shard count must be a power of two; keys are distributed with the
+  // same masking scheme as cyber/base/atomic_hash_map.h. Operations that
+  // take a key lock exactly one shard; whole-warehouse operations lock the
+  // shards one at a time, so they never block key-scoped readers globally.
+  static const std::size_t kShardNum = 16;
+
+  struct Shard {
+    RoleMap roles;
+    base::AtomicRWLock rw_lock;
+  };
+
+  Shard& ShardOf(uint64_t key) { return shards_[key & (kShardNum - 1)]; }
+
+  Shard shards_[kShardNum];
 };
 
 }  // namespace service_discovery
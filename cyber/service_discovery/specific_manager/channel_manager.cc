@@ -252,19 +252,29 @@ void ChannelManager::OnTopoModuleLeave(const std::string& host_name,
   std::vector<RolePtr> readers_to_remove;
   channel_readers_.Search(attr, &readers_to_remove);
 
+  // A process exit removes all of its roles at once. Apply the whole batch
+  // to the role stores first and notify listeners afterwards, so listeners
+  // querying the topology during a mass leave observe the final state
+  // instead of every intermediate one.
+  std::vector<ChangeMsg> msgs;
+  msgs.reserve(writers_to_remove.size() + readers_to_remove.size());
   ChangeMsg msg;
   for (auto& writer : writers_to_remove) {
     Convert(writer->attributes(), RoleType::ROLE_WRITER, OperateType::OPT_LEAVE,
             &msg);
     DisposeLeave(msg);
-    Notify(msg);
+    msgs.emplace_back(msg);
   }
 
   for (auto& reader : readers_to_remove) {
     Convert(reader->attributes(), RoleType::ROLE_READER, OperateType::OPT_LEAVE,
             &msg);
     DisposeLeave(msg);
-    Notify(msg);
+    msgs.emplace_back(msg);
+  }
+
+  for (auto& leave_msg : msgs) {
+    Notify(leave_msg);
   }
 }
 
@@ -0,0 +1,64 @@
+/******************************************************************************
+ * Copyright 2021 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "cyber/statistics/channel_statistics.h"
+
+namespace apollo {
+namespace cyber {
+namespace statistics {
+
+void EndpointCounters::Fill(proto::EndpointStats* stats) const {
+  stats->set_msg_count(msg_count_.load(std::memory_order_relaxed));
+  stats->set_byte_count(byte_count_.load(std::memory_order_relaxed));
+  stats->set_error_count(error_count_.load(std::memory_order_relaxed));
+  stats->set_drop_count(drop_count_.load(std::memory_order_relaxed));
+  for (int i = 0; i < kLatencyBuckets; ++i) {
+    stats->add_latency_hist(latency_hist_[i].load(std::memory_order_relaxed));
+  }
+}
+
+ChannelStatistics::ChannelStatistics() {}
+
+EndpointCounters* ChannelStatistics::GetCounters(
+    const std::string& channel_name, bool is_transmitter) {
+  const auto key = std::make_pair(channel_name, is_transmitter);
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = index_.find(key);
+  if (it != index_.end()) {
+    return &it->second->counters;
+  }
+  slots_.emplace_back();
+  Slot* slot = &slots_.back();
+  slot->channel_name = channel_name;
+  slot->is_transmitter = is_transmitter;
+  index_[key] = slot;
+  return &slot->counters;
+}
+
+void ChannelStatistics::FillReport(proto::ChannelStatsReport* report) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (const auto& slot : slots_) {
+    auto* stats = report->add_endpoint_stats();
+    stats->set_channel_name(slot.channel_name);
+    stats->set_role(slot.is_transmitter ? proto::EndpointStats::TRANSMITTER
+                                        : proto::EndpointStats::RECEIVER);
+    slot.counters.Fill(stats);
+  }
+}
+
+}  // namespace statistics
+}  // namespace cyber
+}  // namespace apollo
@@ -0,0 +1,142 @@
+/******************************************************************************
+ * Copyright 2021 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#ifndef CYBER_STATISTICS_CHANNEL_STATISTICS_H_
+#define CYBER_STATISTICS_CHANNEL_STATISTICS_H_
+
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+#include "cyber/common/macros.h"
+#include "cyber/proto/channel_stats.pb.h"
+
+namespace apollo {
+namespace cyber {
+namespace statistics {
+
+/**
+ * @brief Always-on counters for one (channel, role) pair within a process.
+ *
+ * The hot-path mutators are a handful of relaxed atomic increments on a
+ * dedicated cache line, so endpoints can call them on every message without
+ * measurable cost. Counters are cumulative; consumers diff two snapshots to
+ * derive rates, the same contract as SchedulerMetrics.
+ */
+class alignas(64) EndpointCounters {
+ public:
+  static const int kLatencyBuckets = 32;
+
+  EndpointCounters() {
+    for (int i = 0; i < kLatencyBuckets; ++i) {
+      latency_hist_[i].store(0, std::memory_order_relaxed);
+    }
+  }
+
+  void RecordMessage(uint64_t bytes, uint64_t latency_ns) {
+    msg_count_.fetch_add(1, std::memory_order_relaxed);
+    byte_count_.fetch_add(bytes, std::memory_order_relaxed);
+    latency_hist_[LatencyBucket(latency_ns)].fetch_add(
+        1, std::memory_order_relaxed);
+  }
+
+  void RecordError() { error_count_.fetch_add(1, std::memory_order_relaxed); }
+
+  /**
+   * @brief Track per-sender sequence numbers and count gaps as drops.
+   *
+   * Sequence numbers are monotonic per transmitter, so a jump larger than
+   * one means the skipped messages were lost on the wire. Out-of-order
+   * arrival of older messages is ignored.
+   */
+  void RecordSequence(uint64_t sender_hash, uint64_t seq_num) {
+    std::lock_guard<std::mutex> lock(seq_mutex_);
+    auto it = last_seq_num_.find(sender_hash);
+    if (it != last_seq_num_.end()) {
+      if (seq_num > it->second + 1) {
+        drop_count_.fetch_add(seq_num - it->second - 1,
+                              std::memory_order_relaxed);
+      }
+      if (seq_num > it->second) {
+        it->second = seq_num;
+      }
+    } else {
+      last_seq_num_[sender_hash] = seq_num;
+    }
+  }
+
+  void Fill(proto::EndpointStats* stats) const;
+
+ private:
+  static int LatencyBucket(uint64_t latency_ns) {
+    uint64_t us = latency_ns / 1000;
+    if (us == 0) {
+      return 0;
+    }
+    int bucket = 64 - __builtin_clzll(us);
+    return bucket < kLatencyBuckets ? bucket : kLatencyBuckets - 1;
+  }
+
+  std::atomic<uint64_t> msg_count_ = {0};
+  std::atomic<uint64_t> byte_count_ = {0};
+  std::atomic<uint64_t> error_count_ = {0};
+  std::atomic<uint64_t> drop_count_ = {0};
+  std::atomic<uint64_t> latency_hist_[kLatencyBuckets];
+
+  std::mutex seq_mutex_;
+  std::unordered_map<uint64_t, uint64_t> last_seq_num_;
+};
+
+/**
+ * @brief Process-wide registry of per-channel transport statistics.
+ *
+ * Transmitters and receivers fetch their counters slot once at construction
+ * and keep the raw pointer; slots live in a deque so the addresses stay
+ * stable for the life of the process. Endpoints of the same channel and role
+ * share one slot, which aggregates them per channel. sysmo snapshots the
+ * registry into a ChannelStatsReport published on /cyber/channel_stats.
+ */
+class ChannelStatistics {
+ public:
+  EndpointCounters* GetCounters(const std::string& channel_name,
+                                bool is_transmitter);
+
+  void FillReport(proto::ChannelStatsReport* report);
+
+ private:
+  struct Slot {
+    std::string channel_name;
+    bool is_transmitter;
+    EndpointCounters counters;
+  };
+
+  std::mutex mutex_;
+  std::deque<Slot> slots_;
+  std::map<std::pair<std::string, bool>, Slot*> index_;
+
+  DECLARE_SINGLETON(ChannelStatistics)
+};
+
+}  // namespace statistics
+}  // namespace cyber
+}  // namespace apollo
+
+#endif  // CYBER_STATISTICS_CHANNEL_STATISTICS_H_
@@ -16,13 +16,23 @@
 
 #include "cyber/sysmo/sysmo.h"
 
+#include <unistd.h>
+
 #include "cyber/common/environment.h"
+#include "cyber/common/global_data.h"
+#include "cyber/statistics/channel_statistics.h"
+#include "cyber/time/time.h"
 
 namespace apollo {
 namespace cyber {
 
 using apollo::cyber::common::GetEnv;
 
+namespace {
+const char kMetricsChannel[] = "/cyber/metrics";
+const char kChannelStatsChannel[] = "/cyber/channel_stats";
+}  // namespace
+
 SysMo::SysMo() { Start(); }
 
 void SysMo::Start() {
@@ -47,10 +57,63 @@ void SysMo::Shutdown() {
 void SysMo::Checker() {
   while (cyber_unlikely(!shut_down_.load())) {
     scheduler::Instance()->CheckSchedStatus();
+    if (++tick_count_ >= metrics_interval_ticks_) {
+      tick_count_ = 0;
+      PublishMetrics();
+      PublishChannelStats();
+    }
     std::unique_lock<std::mutex> lk(lk_);
     cv_.wait_for(lk, std::chrono::milliseconds(sysmo_interval_ms_));
   }
 }
 
+void SysMo::PublishMetrics() {
+  if (metrics_transmitter_ == nullptr) {
+    proto::RoleAttributes attr;
+    attr.set_node_name("sysmo");
+    attr.set_channel_name(kMetricsChannel);
+    attr.set_channel_id(common::GlobalData::RegisterChannel(kMetricsChannel));
+    attr.mutable_qos_profile()->CopyFrom(
+        transport::QosProfileConf::QOS_PROFILE_SYSTEM_DEFAULT);
+    metrics_transmitter_ =
+        transport::Transport::Instance()
+            ->CreateTransmitter<proto::SchedulerMetrics>(
+                attr, proto::OptionalMode::RTPS);
+    if (metrics_transmitter_ == nullptr) {
+      AWARN << "create metrics transmitter failed.";
+      return;
+    }
+  }
+  auto metrics = std::make_shared<proto::SchedulerMetrics>();
+  scheduler::Instance()->GetRoutineMetrics(metrics.get());
+  metrics_transmitter_->Transmit(metrics);
+}
+
+void SysMo::PublishChannelStats() {
+  if (channel_stats_transmitter_ == nullptr) {
+    proto::RoleAttributes attr;
+    attr.set_node_name("sysmo");
+    attr.set_channel_name(kChannelStatsChannel);
+    attr.set_channel_id(
+        common::GlobalData::RegisterChannel(kChannelStatsChannel));
+    attr.mutable_qos_profile()->CopyFrom(
+        transport::QosProfileConf::QOS_PROFILE_SYSTEM_DEFAULT);
+    channel_stats_transmitter_ =
+        transport::Transport::Instance()
+            ->CreateTransmitter<proto::ChannelStatsReport>(
+                attr, proto::OptionalMode::RTPS);
+    if (channel_stats_transmitter_ == nullptr) {
+      AWARN << "create channel stats transmitter failed.";
+      return;
+    }
+  }
+  auto report = std::make_shared<proto::ChannelStatsReport>();
+  report->set_timestamp_ns(Time::Now().ToNanosecond());
+  report->set_process_id(getpid());
+  report->set_process_group(common::GlobalData::Instance()->ProcessGroup());
+  statistics::ChannelStatistics::Instance()->FillReport(report.get());
+  channel_stats_transmitter_->Transmit(report);
+}
+
 }  // namespace cyber
 }  // namespace apollo
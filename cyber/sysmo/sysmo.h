@@ -20,11 +20,15 @@
 #include <chrono>
 #include <condition_variable>
 #include <list>
+#include <memory>
 #include <mutex>
 #include <string>
 #include <thread>
 
+#include "cyber/proto/channel_stats.pb.h"
+#include "cyber/proto/routine_metrics.pb.h"
 #include "cyber/scheduler/scheduler_factory.h"
+#include "cyber/transport/transport.h"
 
 namespace apollo {
 namespace cyber {
@@ -38,11 +42,21 @@ class SysMo {
 
  private:
   void Checker();
+  void PublishMetrics();
+  void PublishChannelStats();
 
   std::atomic<bool> shut_down_{false};
   bool start_ = false;
 
   int sysmo_interval_ms_ = 100;
+  // One metrics sample is published every metrics_interval_ticks_ checker
+  // wakeups, keeping the channel low rate.
+  int metrics_interval_ticks_ = 30;
+  int tick_count_ = 0;
+  std::shared_ptr<transport::Transmitter<proto::SchedulerMetrics>>
+      metrics_transmitter_;
+  std::shared_ptr<transport::Transmitter<proto::ChannelStatsReport>>
+      channel_stats_transmitter_;
   std::condition_variable cv_;
   std::mutex lk_;
   std::thread sysmo_;
@@ -0,0 +1,49 @@
+/******************************************************************************
+ * Copyright 2020 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#ifndef CYBER_TASK_CANCELLATION_TOKEN_H_
+#define CYBER_TASK_CANCELLATION_TOKEN_H_
+
+#include <atomic>
+#include <memory>
+
+namespace apollo {
+namespace cyber {
+
+/**
+ * @brief A copyable token shared between the issuer of an async task and
+ * the task itself. Copies share one flag: cancelling any copy cancels
+ * them all. A task that has not started when its token is cancelled is
+ * dropped by the task manager; a running task can poll IsCancelled() to
+ * stop cooperatively.
+ */
+class CancellationToken {
+ public:
+  CancellationToken()
+      : cancelled_(std::make_shared<std::atomic<bool>>(false)) {}
+
+  void Cancel() const { cancelled_->store(true); }
+
+  bool IsCancelled() const { return cancelled_->load(); }
+
+ private:
+  std::shared_ptr<std::atomic<bool>> cancelled_;
+};
+
+}  // namespace cyber
+}  // namespace apollo
+
+#endif  // CYBER_TASK_CANCELLATION_TOKEN_H_
@@ -17,10 +17,12 @@
 #ifndef CYBER_TASK_TASK_H_
 #define CYBER_TASK_TASK_H_
 
+#include <chrono>
 #include <future>
 #include <utility>
 
 #include "cyber/task/task_manager.h"
+#include "cyber/time/time.h"
 
 namespace apollo {
 namespace cyber {
@@ -38,6 +40,37 @@ static auto Async(F&& f, Args&&... args)
                    std::bind(std::forward<F>(f), std::forward<Args>(args)...));
 }
 
+/**
+ * @brief Run f asynchronously with a latency budget. The task is
+ * dispatched earliest-deadline-first ahead of the plain Async() backlog.
+ * If the token is cancelled, or the budget expires, before the task
+ * starts, the task is dropped and its future throws std::future_error
+ * (broken promise); a running task should poll token.IsCancelled() to
+ * stop cooperatively.
+ */
+template <typename F, typename... Args>
+static auto AsyncWithDeadline(const std::chrono::nanoseconds& budget,
+                              const CancellationToken& token, F&& f,
+                              Args&&... args)
+    -> std::future<typename std::result_of<F(Args...)>::type> {
+  if (GlobalData::Instance()->IsRealityMode()) {
+    const uint64_t deadline_ns = Time::Now().ToNanosecond() + budget.count();
+    return TaskManager::Instance()->EnqueueWithDeadline(
+        deadline_ns, token, std::forward<F>(f), std::forward<Args>(args)...);
+  }
+  return std::async(
+      std::launch::async,
+      std::bind(std::forward<F>(f), std::forward<Args>(args)...));
+}
+
+template <typename F, typename... Args>
+static auto AsyncWithDeadline(const std::chrono::nanoseconds& budget, F&& f,
+                              Args&&... args)
+    -> std::future<typename std::result_of<F(Args...)>::type> {
+  return AsyncWithDeadline(budget, CancellationToken(), std::forward<F>(f),
+                           std::forward<Args>(args)...);
+}
+
 static inline void Yield() {
   if (croutine::CRoutine::GetCurrentRoutine()) {
     croutine::CRoutine::Yield();
@@ -20,6 +20,7 @@
 #include "cyber/croutine/croutine.h"
 #include "cyber/croutine/routine_factory.h"
 #include "cyber/scheduler/scheduler_factory.h"
+#include "cyber/time/time.h"
 
 namespace apollo {
 namespace cyber {
@@ -37,6 +38,12 @@ TaskManager::TaskManager()
   auto func = [this]() {
     while (!stop_) {
       std::function<void()> task;
+      // Deadline-tagged tasks run earliest-deadline-first, ahead of the
+      // FIFO backlog.
+      if (DequeueDeadlineTask(&task)) {
+        task();
+        continue;
+      }
       if (!task_queue_->Dequeue(&task)) {
         auto routine = croutine::CRoutine::GetCurrentRoutine();
         routine->HangUp();
@@ -58,6 +65,30 @@ TaskManager::TaskManager()
   }
 }
 
+bool TaskManager::DequeueDeadlineTask(std::function<void()>* task) {
+  const uint64_t now_ns = Time::Now().ToNanosecond();
+  std::lock_guard<std::mutex> lock(deadline_mutex_);
+  while (!deadline_tasks_.empty()) {
+    auto it = deadline_tasks_.begin();
+    if (it->second.token.IsCancelled()) {
+      // Dropping the callable breaks the promise of the waiter.
+      deadline_tasks_.erase(it);
+      continue;
+    }
+    if (it->first < now_ns) {
+      // Too late to be useful. Cancel so cooperative callees observe it,
+      // then drop the task.
+      it->second.token.Cancel();
+      deadline_tasks_.erase(it);
+      continue;
+    }
+    *task = std::move(it->second.fn);
+    deadline_tasks_.erase(it);
+    return true;
+  }
+  return false;
+}
+
 TaskManager::~TaskManager() { Shutdown(); }
 
 void TaskManager::Shutdown() {
@@ -18,8 +18,11 @@
 #define CYBER_TASK_TASK_MANAGER_H_
 
 #include <atomic>
+#include <functional>
 #include <future>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <type_traits>
 #include <utility>
@@ -27,6 +30,7 @@
 
 #include "cyber/base/bounded_queue.h"
 #include "cyber/scheduler/scheduler_factory.h"
+#include "cyber/task/cancellation_token.h"
 
 namespace apollo {
 namespace cyber {
@@ -53,12 +57,54 @@ class TaskManager {
     return res;
   }
 
+  /**
+   * @brief Enqueue a task tagged with an absolute deadline. Deadline
+   * tasks are dispatched earliest-deadline-first ahead of the plain FIFO
+   * backlog, so a task gets elevated as its deadline nears. A task whose
+   * token is cancelled, or whose deadline has already passed when a
+   * worker picks it up, is dropped without running; its future then
+   * throws std::future_error (broken promise) and its token is cancelled
+   * so cooperative callees observe it.
+   */
+  template <typename F, typename... Args>
+  auto EnqueueWithDeadline(uint64_t deadline_ns,
+                           const CancellationToken& token, F&& func,
+                           Args&&... args)
+      -> std::future<typename std::result_of<F(Args...)>::type> {
+    using return_type = typename std::result_of<F(Args...)>::type;
+    auto task = std::make_shared<std::packaged_task<return_type()>>(
+        std::bind(std::forward<F>(func), std::forward<Args>(args)...));
+    std::future<return_type> res(task->get_future());
+    if (!stop_.load()) {
+      {
+        std::lock_guard<std::mutex> lock(deadline_mutex_);
+        deadline_tasks_.emplace(deadline_ns,
+                                DeadlineTask{token, [task]() { (*task)(); }});
+      }
+      for (auto& name : tasks_) {
+        scheduler::Instance()->NotifyTask(name);
+      }
+    }
+    return res;
+  }
+
  private:
+  struct DeadlineTask {
+    CancellationToken token;
+    std::function<void()> fn;
+  };
+
+  // Hand out the deadline task due first, dropping cancelled and expired
+  // ones on the way. Returns false when no deadline task is runnable.
+  bool DequeueDeadlineTask(std::function<void()>* task);
+
   uint32_t num_threads_ = 0;
   uint32_t task_queue_size_ = 1000;
   std::atomic<bool> stop_ = {false};
   std::vector<uint64_t> tasks_;
   std::shared_ptr<base::BoundedQueue<std::function<void()>>> task_queue_;
+  std::multimap<uint64_t, DeadlineTask> deadline_tasks_;
+  std::mutex deadline_mutex_;
   DECLARE_SINGLETON(TaskManager);
 };
 
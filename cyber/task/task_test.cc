@@ -97,6 +97,22 @@ TEST(AsyncTest, run_member_function) {
   foo.RunOnce();
 }
 
+TEST(AsyncTest, run_with_deadline) {
+  auto shared_msg = std::make_shared<Message>();
+  shared_msg->id = 7;
+  auto task = AsyncWithDeadline(std::chrono::seconds(10), &Task3, shared_msg);
+  EXPECT_EQ(task.get(), 7);
+}
+
+TEST(AsyncTest, cancellation_token) {
+  CancellationToken token;
+  EXPECT_FALSE(token.IsCancelled());
+  CancellationToken copy = token;
+  copy.Cancel();
+  EXPECT_TRUE(token.IsCancelled());
+  EXPECT_TRUE(copy.IsCancelled());
+}
+
 }  // namespace scheduler
 }  // namespace cyber
 }  // namespace apollo
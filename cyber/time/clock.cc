@@ -0,0 +1,43 @@
+/******************************************************************************
+ * Copyright 2020 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "cyber/time/clock.h"
+
+#include "cyber/common/global_data.h"
+
+namespace apollo {
+namespace cyber {
+
+Clock::Clock() {}
+
+Time Clock::Now() {
+  if (common::GlobalData::Instance()->IsRealityMode()) {
+    return Time::Now();
+  }
+  return Time(Instance()->mock_now_ns_.load(std::memory_order_acquire));
+}
+
+void Clock::SetNow(const Time& now) {
+  if (common::GlobalData::Instance()->IsRealityMode()) {
+    AWARN << "SetNow is only supported in simulation mode.";
+    return;
+  }
+  Instance()->mock_now_ns_.store(now.ToNanosecond(),
+                                 std::memory_order_release);
+}
+
+}  // namespace cyber
+}  // namespace apollo
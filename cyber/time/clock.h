@@ -0,0 +1,60 @@
+/******************************************************************************
+ * Copyright 2020 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#ifndef CYBER_TIME_CLOCK_H_
+#define CYBER_TIME_CLOCK_H_
+
+#include <atomic>
+
+#include "cyber/common/macros.h"
+#include "cyber/time/time.h"
+
+namespace apollo {
+namespace cyber {
+
+/**
+ * @brief a singleton clock that returns system time in reality mode and
+ * the time injected through SetNow() in simulation mode. Record playback
+ * tools drive the simulation time by publishing proto::Clock on the
+ * /clock channel, which Init() routes into SetNow().
+ */
+class Clock {
+ public:
+  /**
+   * @brief get the current time.
+   *
+   * @return Time::Now() in reality mode, the last mock time set by
+   * SetNow() in simulation mode.
+   */
+  static Time Now();
+
+  /**
+   * @brief set the mock time. Only effective in simulation mode.
+   *
+   * @param now the mock time.
+   */
+  static void SetNow(const Time& now);
+
+ private:
+  std::atomic<uint64_t> mock_now_ns_ = {0};
+
+  DECLARE_SINGLETON(Clock)
+};
+
+}  // namespace cyber
+}  // namespace apollo
+
+#endif  // CYBER_TIME_CLOCK_H_
@@ -0,0 +1,44 @@
+/******************************************************************************
+ * Copyright 2020 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "cyber/time/clock.h"
+
+#include "gtest/gtest.h"
+
+#include "cyber/common/global_data.h"
+
+namespace apollo {
+namespace cyber {
+
+TEST(ClockTest, reality_mode) {
+  ASSERT_TRUE(common::GlobalData::Instance()->IsRealityMode());
+  // SetNow is a no-op in reality mode, the clock tracks system time.
+  Clock::SetNow(Time(100UL));
+  EXPECT_NE(100UL, Clock::Now().ToNanosecond());
+  EXPECT_NE(0UL, Clock::Now().ToNanosecond());
+}
+
+TEST(ClockTest, simulation_mode) {
+  common::GlobalData::Instance()->EnableSimulationMode();
+  EXPECT_EQ(0UL, Clock::Now().ToNanosecond());
+  Clock::SetNow(Time(100UL));
+  EXPECT_EQ(100UL, Clock::Now().ToNanosecond());
+  Clock::SetNow(Time(1.0));
+  EXPECT_EQ(1000000000UL, Clock::Now().ToNanosecond());
+}
+
+}  // namespace cyber
+}  // namespace apollo
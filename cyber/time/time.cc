@@ -23,6 +23,8 @@
 #include <sstream>
 #include <thread>
 
+#include "cyber/time/tsc_clock.h"
+
 namespace apollo {
 namespace cyber {
 
@@ -55,6 +57,11 @@ Time& Time::operator=(const Time& other) {
 }
 
 Time Time::Now() {
+  // fast path: calibrated TSC when --tsc_clock is active
+  const uint64_t tsc_ns = TscClock::NowNs();
+  if (tsc_ns != 0) {
+    return Time(tsc_ns);
+  }
   auto now = high_resolution_clock::now();
   auto nano_time_point =
       std::chrono::time_point_cast<std::chrono::nanoseconds>(now);
@@ -0,0 +1,171 @@
+/******************************************************************************
+ * Copyright 2021 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "cyber/time/tsc_clock.h"
+
+#include <chrono>
+#include <ctime>
+
+#include "cyber/common/log.h"
+
+DEFINE_bool(tsc_clock, false,
+            "Serve cyber::Time::Now() from a calibrated TSC instead of "
+            "clock_gettime.");
+
+namespace apollo {
+namespace cyber {
+
+std::atomic<bool> TscClock::enabled_ = {false};
+std::atomic<bool> TscClock::shutdown_ = {false};
+std::atomic<uint32_t> TscClock::seq_ = {0};
+std::atomic<uint64_t> TscClock::base_tsc_ = {0};
+std::atomic<uint64_t> TscClock::base_ns_ = {0};
+std::atomic<double> TscClock::ns_per_cycle_ = {0.0};
+std::thread TscClock::drift_thread_;
+
+namespace {
+
+constexpr int kCalibrationSampleNum = 16;
+constexpr int kCalibrationIntervalMs = 50;
+constexpr int kDriftCorrectionIntervalMs = 1000;
+// Rate corrections are clamped to +/- 1000 ppm per period; a larger error
+// means the anchor is broken (suspend/resume, clock step) and we re-base.
+constexpr double kMaxRateAdjust = 1e-3;
+
+uint64_t RealtimeNs() {
+  struct timespec ts;
+  clock_gettime(CLOCK_REALTIME, &ts);
+  return static_cast<uint64_t>(ts.tv_sec) * 1000000000ULL + ts.tv_nsec;
+}
+
+#if defined(__x86_64__)
+// Pair a tsc reading with a realtime reading, keeping the attempt with the
+// smallest rdtsc bracket so the pairing error is a few cycles.
+void SamplePair(uint64_t* tsc, uint64_t* ns) {
+  uint64_t best_width = UINT64_MAX;
+  for (int i = 0; i < kCalibrationSampleNum; ++i) {
+    const uint64_t tsc_before = __rdtsc();
+    const uint64_t now_ns = RealtimeNs();
+    const uint64_t tsc_after = __rdtsc();
+    const uint64_t width = tsc_after - tsc_before;
+    if (width < best_width) {
+      best_width = width;
+      *tsc = tsc_before + width / 2;
+      *ns = now_ns;
+    }
+  }
+}
+#endif
+
+}  // namespace
+
+bool TscClock::Init() {
+#if defined(__x86_64__)
+  if (!FLAGS_tsc_clock) {
+    return false;
+  }
+  if (enabled_.load(std::memory_order_acquire)) {
+    return true;
+  }
+
+  uint64_t tsc_begin = 0;
+  uint64_t ns_begin = 0;
+  uint64_t tsc_end = 0;
+  uint64_t ns_end = 0;
+  SamplePair(&tsc_begin, &ns_begin);
+  std::this_thread::sleep_for(
+      std::chrono::milliseconds(kCalibrationIntervalMs));
+  SamplePair(&tsc_end, &ns_end);
+  if (tsc_end <= tsc_begin || ns_end <= ns_begin) {
+    AWARN << "TSC calibration failed, falling back to clock_gettime.";
+    return false;
+  }
+  const double ns_per_cycle = static_cast<double>(ns_end - ns_begin) /
+                              static_cast<double>(tsc_end - tsc_begin);
+  PublishAnchor(tsc_end, ns_end, ns_per_cycle);
+
+  shutdown_.store(false, std::memory_order_release);
+  drift_thread_ = std::thread(&TscClock::RunDriftCorrection);
+  enabled_.store(true, std::memory_order_release);
+  AINFO << "TSC clock enabled, " << 1.0 / ns_per_cycle << " GHz.";
+  return true;
+#else
+  if (FLAGS_tsc_clock) {
+    AWARN << "--tsc_clock is only supported on x86_64, using clock_gettime.";
+  }
+  return false;
+#endif
+}
+
+void TscClock::Shutdown() {
+  if (!enabled_.exchange(false, std::memory_order_acq_rel)) {
+    return;
+  }
+  shutdown_.store(true, std::memory_order_release);
+  if (drift_thread_.joinable()) {
+    drift_thread_.join();
+  }
+}
+
+void TscClock::PublishAnchor(uint64_t base_tsc, uint64_t base_ns,
+                             double ns_per_cycle) {
+  seq_.fetch_add(1, std::memory_order_acq_rel);  // odd: writer in progress
+  base_tsc_.store(base_tsc, std::memory_order_relaxed);
+  base_ns_.store(base_ns, std::memory_order_relaxed);
+  ns_per_cycle_.store(ns_per_cycle, std::memory_order_relaxed);
+  seq_.fetch_add(1, std::memory_order_acq_rel);  // even: consistent again
+}
+
+void TscClock::RunDriftCorrection() {
+#if defined(__x86_64__)
+  while (!shutdown_.load(std::memory_order_acquire)) {
+    std::this_thread::sleep_for(
+        std::chrono::milliseconds(kDriftCorrectionIntervalMs));
+    uint64_t sample_tsc = 0;
+    uint64_t sample_ns = 0;
+    SamplePair(&sample_tsc, &sample_ns);
+
+    const uint64_t base_tsc = base_tsc_.load(std::memory_order_relaxed);
+    const uint64_t base_ns = base_ns_.load(std::memory_order_relaxed);
+    const double rate = ns_per_cycle_.load(std::memory_order_relaxed);
+    const auto cycles = static_cast<int64_t>(sample_tsc - base_tsc);
+    const uint64_t extrapolated_ns =
+        base_ns + static_cast<int64_t>(static_cast<double>(cycles) * rate);
+    const auto error_ns =
+        static_cast<double>(static_cast<int64_t>(sample_ns - extrapolated_ns));
+
+    // Re-base on the extrapolated value so readers never see a step, and
+    // fold the observed error into the rate so the clock converges on
+    // CLOCK_REALTIME over the next period.
+    const double interval_cycles =
+        kDriftCorrectionIntervalMs * 1e6 / rate;
+    double rate_adjust = error_ns / interval_cycles;
+    const double max_adjust = rate * kMaxRateAdjust;
+    if (rate_adjust > max_adjust || rate_adjust < -max_adjust) {
+      // Beyond slewing range: the realtime clock was stepped or the host
+      // suspended. Step the anchor to the fresh sample instead.
+      AWARN << "TSC clock error " << error_ns << " ns exceeds slew range, "
+            << "re-basing.";
+      PublishAnchor(sample_tsc, sample_ns, rate);
+      continue;
+    }
+    PublishAnchor(sample_tsc, extrapolated_ns, rate + rate_adjust);
+  }
+#endif
+}
+
+}  // namespace cyber
+}  // namespace apollo
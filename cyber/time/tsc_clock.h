@@ -0,0 +1,109 @@
+/******************************************************************************
+ * Copyright 2021 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#ifndef CYBER_TIME_TSC_CLOCK_H_
+#define CYBER_TIME_TSC_CLOCK_H_
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+
+#if defined(__x86_64__)
+#include <x86intrin.h>
+#endif
+
+namespace apollo {
+namespace cyber {
+
+/**
+ * @class TscClock
+ * @brief A calibrated TSC-based realtime clock source. Reading it costs a
+ * few nanoseconds (one rdtsc plus a multiply) instead of a clock_gettime
+ * call per timestamp, which matters at the millions of Time::Now() calls
+ * per second the process set performs.
+ *
+ * The anchor (base tsc, base ns, ns per cycle) is published through a
+ * sequence lock and recalibrated once a second against CLOCK_REALTIME by
+ * a background thread. Corrections slew the rate instead of stepping the
+ * base, so the extrapolated time stays continuous while converging on the
+ * system clock within one correction period.
+ *
+ * Opt in with --tsc_clock; Init is called from cyber::Init and refuses to
+ * enable the fast path on hosts without a usable invariant TSC.
+ */
+class TscClock {
+ public:
+  /**
+   * @brief Calibrate against CLOCK_REALTIME and start the drift
+   * correction thread. Gated by --tsc_clock; idempotent.
+   * @return true when the TSC fast path is active.
+   */
+  static bool Init();
+
+  /**
+   * @brief Stop the drift correction thread and disable the fast path.
+   */
+  static void Shutdown();
+
+  /**
+   * @brief Current realtime in nanoseconds via the calibrated TSC.
+   * @return the timestamp, or 0 when the fast path is not active and the
+   * caller should fall back to the system clock.
+   */
+  static uint64_t NowNs() {
+#if defined(__x86_64__)
+    if (!enabled_.load(std::memory_order_acquire)) {
+      return 0;
+    }
+    uint32_t seq_begin = 0;
+    uint32_t seq_end = 0;
+    uint64_t base_tsc = 0;
+    uint64_t base_ns = 0;
+    double ns_per_cycle = 0.0;
+    do {
+      seq_begin = seq_.load(std::memory_order_acquire);
+      base_tsc = base_tsc_.load(std::memory_order_relaxed);
+      base_ns = base_ns_.load(std::memory_order_relaxed);
+      ns_per_cycle = ns_per_cycle_.load(std::memory_order_relaxed);
+      std::atomic_thread_fence(std::memory_order_acquire);
+      seq_end = seq_.load(std::memory_order_relaxed);
+    } while (seq_begin != seq_end || (seq_begin & 1) != 0);
+    const auto cycles = static_cast<int64_t>(__rdtsc() - base_tsc);
+    return base_ns +
+           static_cast<int64_t>(static_cast<double>(cycles) * ns_per_cycle);
+#else
+    return 0;
+#endif
+  }
+
+ private:
+  static void RunDriftCorrection();
+  static void PublishAnchor(uint64_t base_tsc, uint64_t base_ns,
+                            double ns_per_cycle);
+
+  static std::atomic<bool> enabled_;
+  static std::atomic<bool> shutdown_;
+  static std::atomic<uint32_t> seq_;
+  static std::atomic<uint64_t> base_tsc_;
+  static std::atomic<uint64_t> base_ns_;
+  static std::atomic<double> ns_per_cycle_;
+  static std::thread drift_thread_;
+};
+
+}  // namespace cyber
+}  // namespace apollo
+
+#endif  // CYBER_TIME_TSC_CLOCK_H_
@@ -60,6 +60,7 @@ bool Timer::InitTimerTask() {
   task_.reset(new TimerTask(timer_id_));
   task_->interval_ms = timer_opt_.period;
   task_->next_fire_duration_ms = task_->interval_ms;
+  task_->coalesce = timer_opt_.coalesce;
   if (timer_opt_.oneshot) {
     std::weak_ptr<TimerTask> task_weak_ptr = task_;
     task_->callback = [callback = this->timer_opt_.callback, task_weak_ptr]() {
@@ -40,6 +40,22 @@ struct TimerOption {
   TimerOption(uint32_t period, std::function<void()> callback, bool oneshot)
       : period(period), callback(callback), oneshot(oneshot) {}
 
+  /**
+   * @brief Construct a new Timer Option object
+   *
+   * @param period The period of the timer, unit is ms
+   * @param callback The task that the timer needs to perform
+   * @param oneshot Oneshot or period
+   * @param coalesce Batch this timer with other coalescing timers expiring
+   * on the same tick
+   */
+  TimerOption(uint32_t period, std::function<void()> callback, bool oneshot,
+              bool coalesce)
+      : period(period),
+        callback(callback),
+        oneshot(oneshot),
+        coalesce(coalesce) {}
+
   /**
    * @brief Default onstructor for initializer list
    *
@@ -61,6 +77,14 @@ struct TimerOption {
    * False: perform the callback every timed period
    */
   bool oneshot;
+
+  /**
+   * True: run this callback together with the other coalescing timers that
+   * expire on the same tick as one scheduler submission, which keeps many
+   * short periodic timers from flooding the scheduler with wakeups
+   * False: dispatch the callback as its own task (default)
+   */
+  bool coalesce = false;
 };
 
 /**
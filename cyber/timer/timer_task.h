@@ -29,6 +29,7 @@ struct TimerTask {
   explicit TimerTask(uint64_t timer_id) : timer_id_(timer_id) {}
   uint64_t timer_id_ = 0;
   std::function<void()> callback;
+  bool coalesce = false;
   uint64_t interval_ms = 0;
   uint64_t remainder_interval_ms = 0;
   uint64_t next_fire_duration_ms = 0;
@@ -66,6 +66,28 @@ TEST(TimerTest, cycle) {
   }
 }
 
+TEST(TimerTest, coalesce) {
+  using TimerPtr = std::shared_ptr<Timer>;
+  std::atomic<int> count = {0};
+  TimerPtr timers[100];
+  TimerOption opt;
+  opt.oneshot = false;
+  opt.coalesce = true;
+  opt.period = 10;
+  opt.callback = [&count] { count++; };
+  for (int i = 0; i < 100; i++) {
+    timers[i] = std::make_shared<Timer>();
+    timers[i]->SetTimerOption(opt);
+    timers[i]->Start();
+  }
+
+  std::this_thread::sleep_for(std::chrono::seconds(1));
+  for (int i = 0; i < 100; i++) {
+    timers[i]->Stop();
+  }
+  EXPECT_GT(count.load(), 0);
+}
+
 TEST(TimerTest, start_stop) {
   int count = 0;
   Timer timer(2, [count] { AINFO << count; }, false);
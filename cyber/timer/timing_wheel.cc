@@ -45,6 +45,9 @@ void TimingWheel::Tick() {
   {
     std::lock_guard<std::mutex> lock(bucket.mutex());
     auto ite = bucket.task_list().begin();
+    // Callbacks of coalescing timers that expire on this tick are batched
+    // into one scheduler submission instead of one wakeup per timer.
+    std::shared_ptr<std::vector<std::function<void()>*>> batch = nullptr;
     while (ite != bucket.task_list().end()) {
       auto task = ite->lock();
       if (task) {
@@ -52,14 +55,31 @@ void TimingWheel::Tick() {
                << " timer id: " << task->timer_id_;
         auto* callback =
             reinterpret_cast<std::function<void()>*>(&(task->callback));
-        cyber::Async([this, callback] {
-          if (this->running_) {
-            (*callback)();
+        if (task->coalesce) {
+          if (batch == nullptr) {
+            batch = std::make_shared<std::vector<std::function<void()>*>>();
           }
-        });
+          batch->emplace_back(callback);
+        } else {
+          cyber::Async([this, callback] {
+            if (this->running_) {
+              (*callback)();
+            }
+          });
+        }
       }
       ite = bucket.task_list().erase(ite);
     }
+    if (batch != nullptr) {
+      cyber::Async([this, batch] {
+        if (!this->running_) {
+          return;
+        }
+        for (auto* callback : *batch) {
+          (*callback)();
+        }
+      });
+    }
   }
 }
 
@@ -21,6 +21,7 @@
 #include <list>
 #include <memory>
 #include <thread>
+#include <vector>
 
 #include "cyber/common/log.h"
 #include "cyber/common/macros.h"
@@ -0,0 +1,219 @@
+/******************************************************************************
+ * Copyright 2021 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+/**
+ * @file
+ * @brief a top-style console for per-channel transport statistics.
+ * Subscribes to the ChannelStatsReport samples published on
+ * /cyber/channel_stats by every cyber process, diffs consecutive samples
+ * and shows message rate, bandwidth, drops and latency percentiles.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "cyber/common/global_data.h"
+#include "cyber/init.h"
+#include "cyber/proto/channel_stats.pb.h"
+#include "cyber/transport/transport.h"
+
+namespace {
+
+const char kChannelStatsChannel[] = "/cyber/channel_stats";
+
+using apollo::cyber::proto::ChannelStatsReport;
+using apollo::cyber::proto::EndpointStats;
+
+struct ChannelRow {
+  int process_id = 0;
+  std::string channel_name;
+  bool is_transmitter = false;
+  double msgs_per_sec = 0.0;
+  double kbytes_per_sec = 0.0;
+  double drops_per_sec = 0.0;
+  uint64_t error_count = 0;
+  double latency_p50_us = 0.0;
+  double latency_p99_us = 0.0;
+};
+
+// Upper bound in microseconds of bucket i of the log2 latency histogram.
+double BucketUpperBoundUs(int bucket) {
+  return static_cast<double>(1ull << bucket);
+}
+
+// Returns the upper bound of the bucket where the given quantile of the
+// histogram delta falls, or 0 if the delta is empty.
+double Percentile(const std::vector<uint64_t> &hist_delta, double quantile) {
+  uint64_t total = 0;
+  for (const auto count : hist_delta) {
+    total += count;
+  }
+  if (total == 0) {
+    return 0.0;
+  }
+  const double target = quantile * static_cast<double>(total);
+  uint64_t cumulative = 0;
+  for (size_t i = 0; i < hist_delta.size(); ++i) {
+    cumulative += hist_delta[i];
+    if (static_cast<double>(cumulative) >= target) {
+      return BucketUpperBoundUs(static_cast<int>(i));
+    }
+  }
+  return BucketUpperBoundUs(static_cast<int>(hist_delta.size()) - 1);
+}
+
+class StatsAggregator {
+ public:
+  void OnReport(const std::shared_ptr<ChannelStatsReport> &report) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto &previous = previous_samples_[report->process_id()];
+    if (previous != nullptr &&
+        report->timestamp_ns() > previous->timestamp_ns()) {
+      UpdateRows(*previous, *report);
+    }
+    previous = report;
+  }
+
+  void Render() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::vector<ChannelRow> rows;
+    for (const auto &process_rows : rows_) {
+      rows.insert(rows.end(), process_rows.second.begin(),
+                  process_rows.second.end());
+    }
+    std::sort(rows.begin(), rows.end(),
+              [](const ChannelRow &a, const ChannelRow &b) {
+                return a.kbytes_per_sec > b.kbytes_per_sec;
+              });
+    // clear screen and move the cursor home, like top does
+    std::printf("\033[2J\033[H");
+    std::printf("%-8s %-40s %-4s %9s %10s %8s %6s %9s %9s\n", "PID",
+                "CHANNEL", "ROLE", "MSG/S", "KB/S", "DROP/S", "ERR",
+                "P50(US)", "P99(US)");
+    for (const auto &row : rows) {
+      std::printf("%-8d %-40.40s %-4s %9.1f %10.1f %8.1f %6lu %9.0f %9.0f\n",
+                  row.process_id, row.channel_name.c_str(),
+                  row.is_transmitter ? "TX" : "RX", row.msgs_per_sec,
+                  row.kbytes_per_sec, row.drops_per_sec,
+                  static_cast<unsigned long>(row.error_count),
+                  row.latency_p50_us, row.latency_p99_us);
+    }
+    std::fflush(stdout);
+  }
+
+ private:
+  void UpdateRows(const ChannelStatsReport &previous,
+                  const ChannelStatsReport &current) {
+    std::map<std::pair<std::string, bool>, const EndpointStats *>
+        previous_stats;
+    for (const auto &stats : previous.endpoint_stats()) {
+      previous_stats[{stats.channel_name(),
+                      stats.role() == EndpointStats::TRANSMITTER}] = &stats;
+    }
+    const double interval_sec =
+        static_cast<double>(current.timestamp_ns() - previous.timestamp_ns()) /
+        1e9;
+    auto &rows = rows_[current.process_id()];
+    rows.clear();
+    for (const auto &stats : current.endpoint_stats()) {
+      const bool is_transmitter = stats.role() == EndpointStats::TRANSMITTER;
+      const auto previous_it =
+          previous_stats.find({stats.channel_name(), is_transmitter});
+      if (previous_it == previous_stats.end()) {
+        continue;
+      }
+      const auto *prev = previous_it->second;
+      ChannelRow row;
+      row.process_id = current.process_id();
+      row.channel_name = stats.channel_name();
+      row.is_transmitter = is_transmitter;
+      row.msgs_per_sec =
+          static_cast<double>(stats.msg_count() - prev->msg_count()) /
+          interval_sec;
+      row.kbytes_per_sec =
+          static_cast<double>(stats.byte_count() - prev->byte_count()) /
+          1024.0 / interval_sec;
+      row.drops_per_sec =
+          static_cast<double>(stats.drop_count() - prev->drop_count()) /
+          interval_sec;
+      row.error_count = stats.error_count();
+      std::vector<uint64_t> hist_delta;
+      const int buckets =
+          std::min(stats.latency_hist_size(), prev->latency_hist_size());
+      for (int i = 0; i < buckets; ++i) {
+        hist_delta.push_back(stats.latency_hist(i) - prev->latency_hist(i));
+      }
+      row.latency_p50_us = Percentile(hist_delta, 0.5);
+      row.latency_p99_us = Percentile(hist_delta, 0.99);
+      rows.push_back(std::move(row));
+    }
+  }
+
+  std::mutex mutex_;
+  std::map<int, std::shared_ptr<ChannelStatsReport>> previous_samples_;
+  std::map<int, std::vector<ChannelRow>> rows_;
+};
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  int interval_sec = 3;
+  if (argc > 1) {
+    interval_sec = std::max(1, std::atoi(argv[1]));
+  }
+
+  apollo::cyber::Init(argv[0]);
+
+  StatsAggregator aggregator;
+  apollo::cyber::proto::RoleAttributes attr;
+  attr.set_node_name("cyber_channel_stats");
+  attr.set_channel_name(kChannelStatsChannel);
+  attr.set_channel_id(apollo::cyber::common::GlobalData::RegisterChannel(
+      kChannelStatsChannel));
+  attr.mutable_qos_profile()->CopyFrom(
+      apollo::cyber::transport::QosProfileConf::QOS_PROFILE_SYSTEM_DEFAULT);
+  auto receiver =
+      apollo::cyber::transport::Transport::Instance()
+          ->CreateReceiver<ChannelStatsReport>(
+              attr,
+              [&aggregator](
+                  const std::shared_ptr<ChannelStatsReport> &report,
+                  const apollo::cyber::transport::MessageInfo &,
+                  const apollo::cyber::proto::RoleAttributes &) {
+                aggregator.OnReport(report);
+              },
+              apollo::cyber::proto::OptionalMode::RTPS);
+  if (receiver == nullptr) {
+    std::printf("failed to subscribe %s\n", kChannelStatsChannel);
+    return 1;
+  }
+
+  while (apollo::cyber::OK()) {
+    std::this_thread::sleep_for(std::chrono::seconds(interval_sec));
+    aggregator.Render();
+  }
+  return 0;
+}
@@ -0,0 +1,96 @@
+/******************************************************************************
+ * Copyright 2021 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+// Offline textualizer for the framed binary logs (*.blog) produced by the
+// async logger when --async_log_binary is enabled. Each record is
+// [uint64 timestamp][int32 level][uint32 length][length bytes of message];
+// the message payload is the glog-formatted line, so this tool simply
+// validates the framing and streams the payloads to stdout.
+//
+// Usage: cyber_logtext <file.blog> [<file.blog> ...]
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace {
+
+const char kBinaryLogMagic[] = "CBLOG001";
+constexpr uint32_t kMaxRecordLength = 64 * 1024 * 1024;
+
+bool Textualize(const std::string& file_name) {
+  std::ifstream stream(file_name, std::ios::binary);
+  if (!stream.is_open()) {
+    std::cerr << "failed to open: " << file_name << std::endl;
+    return false;
+  }
+  char magic[sizeof(kBinaryLogMagic) - 1] = {0};
+  stream.read(magic, sizeof(magic));
+  if (!stream.good() ||
+      memcmp(magic, kBinaryLogMagic, sizeof(magic)) != 0) {
+    std::cerr << "not a cyber binary log: " << file_name << std::endl;
+    return false;
+  }
+
+  uint64_t records = 0;
+  std::string message;
+  while (true) {
+    uint64_t timestamp = 0;
+    int32_t level = 0;
+    uint32_t length = 0;
+    stream.read(reinterpret_cast<char*>(&timestamp), sizeof(timestamp));
+    if (stream.eof()) {
+      break;
+    }
+    stream.read(reinterpret_cast<char*>(&level), sizeof(level));
+    stream.read(reinterpret_cast<char*>(&length), sizeof(length));
+    if (!stream.good() || length > kMaxRecordLength) {
+      std::cerr << "truncated or corrupt record #" << records << " in "
+                << file_name << std::endl;
+      return false;
+    }
+    message.resize(length);
+    stream.read(&message[0], length);
+    if (!stream.good()) {
+      std::cerr << "truncated message in record #" << records << " in "
+                << file_name << std::endl;
+      return false;
+    }
+    // The payload is the original glog line, newline included.
+    std::cout << message;
+    ++records;
+  }
+  std::cerr << file_name << ": " << records << " records" << std::endl;
+  return true;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  if (argc < 2) {
+    std::cerr << "Usage: " << argv[0] << " <file.blog> [<file.blog> ...]"
+              << std::endl;
+    return 1;
+  }
+  bool ok = true;
+  for (int i = 1; i < argc; ++i) {
+    ok = Textualize(argv[i]) && ok;
+  }
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,178 @@
+/******************************************************************************
+ * Copyright 2021 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+// Converter for the binary perf captures (*.bperf) produced by the cyber
+// perf event cache when --perf_event_binary is enabled. Emits Chrome trace
+// format (chrome://tracing, Perfetto) to stdout: coroutine swap-in/out
+// become duration events on the processor they ran on, everything else
+// becomes an instant event.
+//
+// Usage: cyber_perftrace <file.bperf> > trace.json
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <unordered_map>
+
+#include "cyber/event/perf_event_ring.h"
+
+namespace {
+
+using apollo::cyber::event::BinaryPerfEvent;
+using apollo::cyber::event::kBinaryPerfMagic;
+using apollo::cyber::event::kPerfNameRecord;
+
+constexpr int32_t kSchedEventType = 0;
+constexpr int32_t kTransEventType = 1;
+
+constexpr int32_t kSchedSwapIn = 1;
+constexpr int32_t kSchedSwapOut = 2;
+
+const char* SchedEventName(const int32_t eid) {
+  switch (eid) {
+    case 1:
+      return "swap_in";
+    case 2:
+      return "swap_out";
+    case 3:
+      return "notify_in";
+    case 4:
+      return "next_routine";
+    case 5:
+      return "routine_create";
+    default:
+      return "sched";
+  }
+}
+
+const char* TransEventName(const int32_t eid) {
+  static const char* names[] = {"transmit_begin", "serialize", "send",
+                                "message_arrive", "obtain",    "deserialize",
+                                "dispatch",       "notify",    "fetch",
+                                "callback"};
+  if (eid >= 0 && eid < static_cast<int32_t>(sizeof(names) / sizeof(*names))) {
+    return names[eid];
+  }
+  return "transport";
+}
+
+std::string JsonEscape(const std::string& input) {
+  std::string output;
+  for (const char c : input) {
+    if (c == '"' || c == '\\') {
+      output.push_back('\\');
+    }
+    output.push_back(c);
+  }
+  return output;
+}
+
+bool Convert(const std::string& file_name) {
+  std::ifstream stream(file_name, std::ios::binary);
+  if (!stream.is_open()) {
+    std::cerr << "failed to open: " << file_name << std::endl;
+    return false;
+  }
+  char magic[sizeof(kBinaryPerfMagic) - 1] = {0};
+  stream.read(magic, sizeof(magic));
+  if (!stream.good() || memcmp(magic, kBinaryPerfMagic, sizeof(magic)) != 0) {
+    std::cerr << "not a cyber perf capture: " << file_name << std::endl;
+    return false;
+  }
+
+  std::unordered_map<uint64_t, std::string> names;
+  std::unordered_map<uint64_t, int> channel_tids;
+  bool first = true;
+  std::cout << "[";
+  while (true) {
+    BinaryPerfEvent event;
+    stream.read(reinterpret_cast<char*>(&event), sizeof(event));
+    if (stream.eof()) {
+      break;
+    }
+    if (!stream.good()) {
+      std::cerr << "truncated record in: " << file_name << std::endl;
+      return false;
+    }
+    if (event.etype == kPerfNameRecord) {
+      std::string name(event.msg_seq, '\0');
+      stream.read(&name[0], static_cast<std::streamsize>(name.size()));
+      if (!stream.good()) {
+        std::cerr << "truncated name record in: " << file_name << std::endl;
+        return false;
+      }
+      names[event.id] = name;
+      continue;
+    }
+
+    const auto name_iter = names.find(event.id);
+    const std::string id_name = (name_iter != names.end())
+                                    ? JsonEscape(name_iter->second)
+                                    : std::to_string(event.id);
+    const double ts_us = static_cast<double>(event.stamp) / 1e3;
+    if (!first) {
+      std::cout << ",";
+    }
+    first = false;
+    std::cout << "\n{";
+    if (event.etype == kSchedEventType) {
+      const char* phase = event.eid == kSchedSwapIn
+                              ? "B"
+                              : (event.eid == kSchedSwapOut ? "E" : "i");
+      std::cout << "\"name\":\"" << id_name << "\",\"ph\":\"" << phase
+                << "\",\"ts\":" << ts_us << ",\"pid\":0,\"tid\":"
+                << event.proc_id << ",\"args\":{\"event\":\""
+                << SchedEventName(event.eid)
+                << "\",\"cr_state\":" << event.cr_state << "}";
+      if (phase[0] == 'i') {
+        std::cout << ",\"s\":\"t\"";
+      }
+    } else {
+      auto tid_iter = channel_tids.find(event.id);
+      if (tid_iter == channel_tids.end()) {
+        const int tid = static_cast<int>(channel_tids.size());
+        tid_iter = channel_tids.emplace(event.id, tid).first;
+        std::cout << "\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,"
+                  << "\"tid\":" << tid << ",\"args\":{\"name\":\"" << id_name
+                  << "\"}},\n{";
+      }
+      std::cout << "\"name\":\"" << TransEventName(event.eid)
+                << "\",\"ph\":\"i\",\"s\":\"t\",\"ts\":" << ts_us
+                << ",\"pid\":1,\"tid\":" << tid_iter->second
+                << ",\"args\":{\"channel\":\"" << id_name
+                << "\",\"msg_seq\":" << event.msg_seq << "}";
+    }
+    std::cout << "}";
+  }
+  std::cout << "\n]" << std::endl;
+  return true;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  if (argc < 2) {
+    std::cerr << "Usage: " << argv[0] << " <file.bperf> > trace.json"
+              << std::endl;
+    return 1;
+  }
+  if (!Convert(argv[1])) {
+    return 1;
+  }
+  return 0;
+}
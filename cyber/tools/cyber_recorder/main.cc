@@ -43,7 +43,7 @@ using apollo::cyber::record::Spliter;
 
 const char INFO_OPTIONS[] = "h";
 const char RECORD_OPTIONS[] = "o:ac:i:m:h";
-const char PLAY_OPTIONS[] = "f:ac:k:lr:b:e:s:d:p:h";
+const char PLAY_OPTIONS[] = "f:ac:k:lr:b:e:s:d:p:Ch";
 const char SPLIT_OPTIONS[] = "f:o:c:k:b:e:h";
 const char RECOVER_OPTIONS[] = "f:o:h";
 
@@ -137,6 +137,10 @@ void DisplayUsage(const std::string& binary, const std::string& command,
         std::cout << "\t-p, --preload <seconds>\t\t\t" << command
                   << " after trying to preload n second(s)" << std::endl;
         break;
+      case 'C':
+        std::cout << "\t-C, --clock\t\t\t\tpublish record time on /clock "
+                  << "while " << command << "ing" << std::endl;
+        break;
       case 'i':
         std::cout << "\t-i, --segment-interval <seconds>\t" << command
                   << " segmented every n second(s)" << std::endl;
@@ -170,7 +174,7 @@ int main(int argc, char** argv) {
   }
 
   int long_index = 0;
-  const std::string short_opts = "f:c:k:o:alr:b:e:s:d:p:i:m:h";
+  const std::string short_opts = "f:c:k:o:alr:b:e:s:d:p:i:m:Ch";
   static const struct option long_opts[] = {
       {"files", required_argument, nullptr, 'f'},
       {"white-channel", required_argument, nullptr, 'c'},
@@ -184,6 +188,7 @@ int main(int argc, char** argv) {
       {"start", required_argument, nullptr, 's'},
       {"delay", required_argument, nullptr, 'd'},
       {"preload", required_argument, nullptr, 'p'},
+      {"clock", no_argument, nullptr, 'C'},
       {"segment-interval", required_argument, nullptr, 'i'},
       {"segment-size", required_argument, nullptr, 'm'},
       {"help", no_argument, nullptr, 'h'}};
@@ -200,6 +205,7 @@ int main(int argc, char** argv) {
   uint64_t opt_start = 0;
   uint64_t opt_delay = 0;
   uint32_t opt_preload = 3;
+  bool opt_publish_clock = false;
   auto opt_header = HeaderBuilder::GetHeader();
 
   do {
@@ -248,6 +254,9 @@ int main(int argc, char** argv) {
       case 'l':
         opt_loop = true;
         break;
+      case 'C':
+        opt_publish_clock = true;
+        break;
       case 'r':
         try {
           opt_rate = std::stof(optarg);
@@ -398,6 +407,7 @@ int main(int argc, char** argv) {
     play_param.start_time_s = opt_start;
     play_param.delay_time_s = opt_delay;
     play_param.preload_time_s = opt_preload;
+    play_param.is_publish_clock = opt_publish_clock;
     play_param.files_to_play.insert(opt_file_vec.begin(), opt_file_vec.end());
     play_param.black_channels.insert(opt_black_channels.begin(),
                                      opt_black_channels.end());
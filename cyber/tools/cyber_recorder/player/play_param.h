@@ -28,6 +28,7 @@ namespace record {
 struct PlayParam {
   bool is_play_all_channels = false;
   bool is_loop_playback = false;
+  bool is_publish_clock = false;
   double play_rate = 1.0;
   uint64_t begin_time_ns = 0;
   uint64_t end_time_ns = UINT64_MAX;
@@ -25,6 +25,7 @@ namespace record {
 
 const uint64_t PlayTaskConsumer::kPauseSleepNanoSec = 100000000UL;
 const uint64_t PlayTaskConsumer::kWaitProduceSleepNanoSec = 5000000UL;
+const uint64_t PlayTaskConsumer::kClockIntervalNanoSec = 10000000UL;
 const uint64_t PlayTaskConsumer::MIN_SLEEP_DURATION_NS = 200000000UL;
 
 PlayTaskConsumer::PlayTaskConsumer(const TaskBufferPtr& task_buffer,
@@ -32,6 +33,8 @@ PlayTaskConsumer::PlayTaskConsumer(const TaskBufferPtr& task_buffer,
     : play_rate_(play_rate),
       consume_th_(nullptr),
       task_buffer_(task_buffer),
+      clock_writer_(nullptr),
+      last_clock_time_ns_(0),
       is_stopped_(true),
       is_paused_(false),
       is_playonce_(false),
@@ -114,6 +117,7 @@ void PlayTaskConsumer::ThreadFunc() {
       std::this_thread::sleep_for(std::chrono::nanoseconds(sleep_ns));
     }
 
+    PublishClock(task->msg_real_time_ns());
     task->Play();
     is_playonce_.store(false);
 
@@ -129,6 +133,22 @@ void PlayTaskConsumer::ThreadFunc() {
   }
 }
 
+void PlayTaskConsumer::PublishClock(uint64_t msg_real_time_ns) {
+  if (clock_writer_ == nullptr) {
+    return;
+  }
+  // The clock is published inline with the messages, right before the
+  // message it is paced by, so the published time never runs ahead of
+  // the played data no matter how large the play rate is.
+  if (msg_real_time_ns - last_clock_time_ns_ < kClockIntervalNanoSec) {
+    return;
+  }
+  auto clock_msg = std::make_shared<proto::Clock>();
+  clock_msg->set_clock(msg_real_time_ns);
+  clock_writer_->Write(clock_msg);
+  last_clock_time_ns_ = msg_real_time_ns;
+}
+
 }  // namespace record
 }  // namespace cyber
 }  // namespace apollo
@@ -22,6 +22,8 @@
 #include <memory>
 #include <thread>
 
+#include "cyber/node/writer.h"
+#include "cyber/proto/clock.pb.h"
 #include "cyber/tools/cyber_recorder/player/play_task_buffer.h"
 
 namespace apollo {
@@ -32,6 +34,7 @@ class PlayTaskConsumer {
  public:
   using ThreadPtr = std::unique_ptr<std::thread>;
   using TaskBufferPtr = std::shared_ptr<PlayTaskBuffer>;
+  using ClockWriterPtr = std::shared_ptr<Writer<proto::Clock>>;
 
   explicit PlayTaskConsumer(const TaskBufferPtr& task_buffer,
                             double play_rate = 1.0);
@@ -43,6 +46,10 @@ class PlayTaskConsumer {
   void PlayOnce() { is_playonce_.exchange(true); }
   void Continue() { is_paused_.exchange(false); }
 
+  void set_clock_writer(const ClockWriterPtr& clock_writer) {
+    clock_writer_ = clock_writer;
+  }
+
   uint64_t base_msg_play_time_ns() const { return base_msg_play_time_ns_; }
   uint64_t base_msg_real_time_ns() const { return base_msg_real_time_ns_; }
   uint64_t last_played_msg_real_time_ns() const {
@@ -51,10 +58,13 @@ class PlayTaskConsumer {
 
  private:
   void ThreadFunc();
+  void PublishClock(uint64_t msg_real_time_ns);
 
   double play_rate_;
   ThreadPtr consume_th_;
   TaskBufferPtr task_buffer_;
+  ClockWriterPtr clock_writer_;
+  uint64_t last_clock_time_ns_;
   std::atomic<bool> is_stopped_;
   std::atomic<bool> is_paused_;
   std::atomic<bool> is_playonce_;
@@ -64,6 +74,7 @@ class PlayTaskConsumer {
   uint64_t last_played_msg_real_time_ns_;
   static const uint64_t kPauseSleepNanoSec;
   static const uint64_t kWaitProduceSleepNanoSec;
+  static const uint64_t kClockIntervalNanoSec;
   static const uint64_t MIN_SLEEP_DURATION_NS;
 };
 
@@ -28,6 +28,10 @@ namespace apollo {
 namespace cyber {
 namespace record {
 
+namespace {
+const char kClockChannel[] = "/clock";
+}  // namespace
+
 const uint32_t PlayTaskProducer::kMinTaskBufferSize = 500;
 const uint32_t PlayTaskProducer::kPreloadTimeSec = 3;
 const uint64_t PlayTaskProducer::kSleepIntervalNanoSec = 1000000;
@@ -217,6 +221,14 @@ bool PlayTaskProducer::CreateWriters() {
     }
   }
 
+  if (play_param_.is_publish_clock) {
+    clock_writer_ = node_->CreateWriter<proto::Clock>(kClockChannel);
+    if (clock_writer_ == nullptr) {
+      AERROR << "create clock writer failed. channel name: " << kClockChannel;
+      return false;
+    }
+  }
+
   return true;
 }
 
@@ -30,6 +30,7 @@
 #include "cyber/message/raw_message.h"
 #include "cyber/node/node.h"
 #include "cyber/node/writer.h"
+#include "cyber/proto/clock.pb.h"
 #include "cyber/record/record_reader.h"
 #include "cyber/tools/cyber_recorder/player/play_param.h"
 #include "cyber/tools/cyber_recorder/player/play_task_buffer.h"
@@ -45,6 +46,7 @@ class PlayTaskProducer {
   using TaskBufferPtr = std::shared_ptr<PlayTaskBuffer>;
   using RecordReaderPtr = std::shared_ptr<RecordReader>;
   using WriterPtr = std::shared_ptr<Writer<message::RawMessage>>;
+  using ClockWriterPtr = std::shared_ptr<Writer<proto::Clock>>;
   using WriterMap = std::unordered_map<std::string, WriterPtr>;
   using MessageTypeMap = std::unordered_map<std::string, std::string>;
 
@@ -57,6 +59,7 @@ class PlayTaskProducer {
   void Stop();
 
   const PlayParam& play_param() const { return play_param_; }
+  const ClockWriterPtr& clock_writer() const { return clock_writer_; }
   bool is_stopped() const { return is_stopped_.load(); }
 
  private:
@@ -74,6 +77,7 @@ class PlayTaskProducer {
 
   NodePtr node_;
   WriterMap writers_;
+  ClockWriterPtr clock_writer_;
   MessageTypeMap msg_types_;
   std::vector<RecordReaderPtr> record_readers_;
 
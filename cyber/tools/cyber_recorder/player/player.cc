@@ -46,6 +46,7 @@ bool Player::Init() {
   }
 
   if (producer_->Init()) {
+    consumer_->set_clock_writer(producer_->clock_writer());
     return true;
   }
 
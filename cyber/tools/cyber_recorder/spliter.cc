@@ -36,6 +36,102 @@ Spliter::Spliter(const std::string& input_file, const std::string& output_file,
 
 Spliter::~Spliter() {}
 
+bool Spliter::KeepChannel(const std::string& channel_name) const {
+  if (!white_channels_.empty() &&
+      std::find(white_channels_.begin(), white_channels_.end(),
+                channel_name) == white_channels_.end()) {
+    return false;
+  }
+  return std::find(black_channels_.begin(), black_channels_.end(),
+                   channel_name) == black_channels_.end();
+}
+
+void Spliter::Fail() {
+  failed_ = true;
+  task_cv_.notify_all();
+  result_cv_.notify_all();
+}
+
+void Spliter::ParseRoutine() {
+  while (true) {
+    uint64_t seq = 0;
+    std::string raw;
+    {
+      std::unique_lock<std::mutex> lock(task_mutex_);
+      task_cv_.wait(lock, [this]() {
+        return !chunk_tasks_.empty() || done_reading_ || failed_;
+      });
+      if (failed_ || (chunk_tasks_.empty() && done_reading_)) {
+        return;
+      }
+      seq = chunk_tasks_.front().first;
+      raw = std::move(chunk_tasks_.front().second);
+      chunk_tasks_.pop_front();
+    }
+    // wake the reader if it stalled on a full queue
+    task_cv_.notify_all();
+
+    ChunkBody chunk_body;
+    if (!chunk_body.ParseFromString(raw)) {
+      AERROR << "parse chunk body section failed.";
+      Fail();
+      return;
+    }
+    FilteredSection result;
+    for (int idx = 0; idx < chunk_body.messages_size(); ++idx) {
+      auto* message = chunk_body.mutable_messages(idx);
+      if (!KeepChannel(message->channel_name())) {
+        continue;
+      }
+      if (message->time() < begin_time_ || message->time() > end_time_) {
+        continue;
+      }
+      result.messages.emplace_back();
+      result.messages.back().Swap(message);
+    }
+    {
+      std::lock_guard<std::mutex> lock(result_mutex_);
+      results_[seq] = std::move(result);
+    }
+    result_cv_.notify_all();
+  }
+}
+
+void Spliter::WriteRoutine() {
+  while (true) {
+    FilteredSection result;
+    {
+      std::unique_lock<std::mutex> lock(result_mutex_);
+      result_cv_.wait(lock, [this]() {
+        return failed_ || results_.count(next_write_seq_) > 0 ||
+               (done_enqueuing_ && next_write_seq_ >= total_section_num_);
+      });
+      if (failed_) {
+        return;
+      }
+      auto it = results_.find(next_write_seq_);
+      if (it == results_.end()) {
+        // all enqueued sections have been written
+        return;
+      }
+      result = std::move(it->second);
+      results_.erase(it);
+      ++next_write_seq_;
+    }
+    if (result.is_channel) {
+      writer_.WriteChannel(result.channel);
+      continue;
+    }
+    for (const auto& message : result.messages) {
+      if (!writer_.WriteMessage(message)) {
+        AERROR << "add new message failed.";
+        Fail();
+        return;
+      }
+    }
+  }
+}
+
 bool Spliter::Proc() {
   // check params
   if (begin_time_ >= end_time_) {
@@ -77,14 +173,31 @@ bool Spliter::Proc() {
     return false;
   }
 
+  // start the parse/filter pipeline: this thread reads raw sections off
+  // the disk in order, the parser threads decode and filter the chunks in
+  // parallel, and the writer thread re-encodes the surviving sections in
+  // the original order
+  failed_ = false;
+  done_reading_ = false;
+  done_enqueuing_ = false;
+  next_write_seq_ = 0;
+  total_section_num_ = 0;
+  std::vector<std::thread> parser_threads;
+  for (uint64_t i = 0; i < kParserThreadNum; ++i) {
+    parser_threads.emplace_back([this]() { ParseRoutine(); });
+  }
+  std::thread writer_thread([this]() { WriteRoutine(); });
+
   // read through record file
   bool skip_next_chunk_body(false);
+  uint64_t next_seq = 0;
   reader_.Reset();
-  while (!reader_.EndOfFile()) {
+  while (!reader_.EndOfFile() && !failed_) {
     Section section;
     if (!reader_.ReadSection(&section)) {
       AERROR << "read section failed.";
-      return false;
+      failed_ = true;
+      break;
     }
     if (section.type == SectionType::SECTION_INDEX) {
       break;
@@ -94,15 +207,18 @@ bool Spliter::Proc() {
         Channel chan;
         if (!reader_.ReadSection<Channel>(section.size, &chan)) {
           AERROR << "read channel section fail.";
-          return false;
+          failed_ = true;
+          break;
         }
-        if (white_channels_.empty() ||
-            std::find(white_channels_.begin(), white_channels_.end(),
-                      chan.name()) != white_channels_.end()) {
-          if (std::find(black_channels_.begin(), black_channels_.end(),
-                        chan.name()) == black_channels_.end()) {
-            writer_.WriteChannel(chan);
+        if (KeepChannel(chan.name())) {
+          FilteredSection result;
+          result.is_channel = true;
+          result.channel.Swap(&chan);
+          {
+            std::lock_guard<std::mutex> lock(result_mutex_);
+            results_[next_seq++] = std::move(result);
           }
+          result_cv_.notify_all();
         }
         break;
       }
@@ -110,7 +226,8 @@ bool Spliter::Proc() {
         ChunkHeader chdr;
         if (!reader_.ReadSection<ChunkHeader>(section.size, &chdr)) {
           AERROR << "read chunk header section fail.";
-          return false;
+          failed_ = true;
+          break;
         }
         if (begin_time_ > chdr.end_time() || end_time_ < chdr.begin_time()) {
           skip_next_chunk_body = true;
@@ -123,32 +240,23 @@ bool Spliter::Proc() {
           skip_next_chunk_body = false;
           break;
         }
-        ChunkBody cbd;
-        if (!reader_.ReadSection<ChunkBody>(section.size, &cbd)) {
+        std::string raw;
+        if (!reader_.ReadRawSection(section.size, &raw)) {
           AERROR << "read chunk body section fail.";
-          return false;
+          failed_ = true;
+          break;
         }
-        for (int idx = 0; idx < cbd.messages_size(); ++idx) {
-          if (!white_channels_.empty() &&
-              std::find(white_channels_.begin(), white_channels_.end(),
-                        cbd.messages(idx).channel_name()) ==
-                  white_channels_.end()) {
-            continue;
-          }
-          if (std::find(black_channels_.begin(), black_channels_.end(),
-                        cbd.messages(idx).channel_name()) !=
-              black_channels_.end()) {
-            continue;
-          }
-          if (cbd.messages(idx).time() < begin_time_ ||
-              cbd.messages(idx).time() > end_time_) {
-            continue;
-          }
-          if (!writer_.WriteMessage(cbd.messages(idx))) {
-            AERROR << "add new message failed.";
-            return false;
+        {
+          std::unique_lock<std::mutex> lock(task_mutex_);
+          task_cv_.wait(lock, [this]() {
+            return chunk_tasks_.size() < kMaxPendingChunkNum || failed_;
+          });
+          if (failed_) {
+            break;
           }
+          chunk_tasks_.emplace_back(next_seq++, std::move(raw));
         }
+        task_cv_.notify_all();
         break;
       }
       default: {
@@ -158,6 +266,28 @@ bool Spliter::Proc() {
       }
     }  // end for switch
   }    // end for while
+
+  // drain the pipeline before reporting the result
+  {
+    std::lock_guard<std::mutex> lock(task_mutex_);
+    done_reading_ = true;
+  }
+  task_cv_.notify_all();
+  for (auto& thread : parser_threads) {
+    thread.join();
+  }
+  {
+    std::lock_guard<std::mutex> lock(result_mutex_);
+    done_enqueuing_ = true;
+    total_section_num_ = next_seq;
+  }
+  result_cv_.notify_all();
+  writer_thread.join();
+
+  if (failed_) {
+    AERROR << "split record file failed.";
+    return false;
+  }
   AINFO << "split record file done.";
   return true;
 }  // end for Proc()
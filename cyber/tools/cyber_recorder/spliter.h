@@ -18,8 +18,15 @@
 #define CYBER_TOOLS_CYBER_RECORDER_SPLITER_H_
 
 #include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
+#include <utility>
 #include <vector>
 
 #include "cyber/common/log.h"
@@ -47,6 +54,27 @@ class Spliter {
   bool Proc();
 
  private:
+  // A section travelling through the parse/filter pipeline. Channel
+  // sections are routed through the same sequence as the chunk bodies so
+  // that every channel is still written before the messages that refer to
+  // it.
+  struct FilteredSection {
+    bool is_channel = false;
+    proto::Channel channel;
+    std::vector<proto::SingleMessage> messages;
+  };
+
+  // number of chunk parser threads and the bound on raw chunks waiting to
+  // be parsed; a full queue stalls the reader instead of loading the whole
+  // record into memory
+  static const uint64_t kParserThreadNum = 4;
+  static const uint64_t kMaxPendingChunkNum = 8;
+
+  bool KeepChannel(const std::string& channel_name) const;
+  void ParseRoutine();
+  void WriteRoutine();
+  void Fail();
+
   RecordFileReader reader_;
   RecordFileWriter writer_;
   std::string input_file_;
@@ -56,6 +84,22 @@ class Spliter {
   bool all_channels_;
   uint64_t begin_time_;
   uint64_t end_time_;
+
+  // raw chunk bodies read from the file, keyed by section sequence
+  std::deque<std::pair<uint64_t, std::string>> chunk_tasks_;
+  std::mutex task_mutex_;
+  std::condition_variable task_cv_;
+  bool done_reading_ = false;
+
+  // filtered sections waiting to be written in section sequence order
+  std::map<uint64_t, FilteredSection> results_;
+  std::mutex result_mutex_;
+  std::condition_variable result_cv_;
+  uint64_t next_write_seq_ = 0;
+  uint64_t total_section_num_ = 0;
+  bool done_enqueuing_ = false;
+
+  std::atomic<bool> failed_ = {false};
 };
 
 }  // namespace record
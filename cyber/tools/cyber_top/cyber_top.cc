@@ -0,0 +1,178 @@
+/******************************************************************************
+ * Copyright 2020 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+/**
+ * @file
+ * @brief a top-style console for croutines. Subscribes to the scheduler
+ * metrics published on /cyber/metrics by every cyber process and ranks
+ * croutines by CPU share derived from consecutive samples.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "cyber/common/global_data.h"
+#include "cyber/init.h"
+#include "cyber/proto/routine_metrics.pb.h"
+#include "cyber/transport/transport.h"
+
+namespace {
+
+const char kMetricsChannel[] = "/cyber/metrics";
+
+using apollo::cyber::proto::SchedulerMetrics;
+
+struct RoutineRow {
+  int process_id = 0;
+  std::string process_group;
+  std::string name;
+  std::string group_name;
+  int processor_id = -1;
+  double cpu_percent = 0.0;
+  double wait_percent = 0.0;
+  double switches_per_sec = 0.0;
+};
+
+class MetricsAggregator {
+ public:
+  void OnMetrics(const std::shared_ptr<SchedulerMetrics> &metrics) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto &previous = previous_samples_[metrics->process_id()];
+    if (previous != nullptr &&
+        metrics->timestamp_ns() > previous->timestamp_ns()) {
+      UpdateRows(*previous, *metrics);
+    }
+    previous = metrics;
+  }
+
+  void Render() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::vector<RoutineRow> rows;
+    for (const auto &process_rows : rows_) {
+      rows.insert(rows.end(), process_rows.second.begin(),
+                  process_rows.second.end());
+    }
+    std::sort(rows.begin(), rows.end(),
+              [](const RoutineRow &a, const RoutineRow &b) {
+                return a.cpu_percent > b.cpu_percent;
+              });
+    // clear screen and move the cursor home, like top does
+    std::printf("\033[2J\033[H");
+    std::printf("%-8s %-32s %-16s %-5s %8s %8s %8s\n", "PID", "NAME", "GROUP",
+                "PROC", "%CPU", "%WAIT", "SW/S");
+    for (const auto &row : rows) {
+      std::printf("%-8d %-32.32s %-16.16s %-5d %8.2f %8.2f %8.1f\n",
+                  row.process_id, row.name.c_str(), row.group_name.c_str(),
+                  row.processor_id, row.cpu_percent, row.wait_percent,
+                  row.switches_per_sec);
+    }
+    std::fflush(stdout);
+  }
+
+ private:
+  void UpdateRows(const SchedulerMetrics &previous,
+                  const SchedulerMetrics &current) {
+    std::map<uint64_t, const apollo::cyber::proto::RoutineMetrics *>
+        previous_routines;
+    for (const auto &routine : previous.routine_metrics()) {
+      previous_routines[routine.id()] = &routine;
+    }
+    const double interval_ns =
+        static_cast<double>(current.timestamp_ns() - previous.timestamp_ns());
+    auto &rows = rows_[current.process_id()];
+    rows.clear();
+    for (const auto &routine : current.routine_metrics()) {
+      const auto previous_it = previous_routines.find(routine.id());
+      if (previous_it == previous_routines.end()) {
+        continue;
+      }
+      const auto *previous_routine = previous_it->second;
+      RoutineRow row;
+      row.process_id = current.process_id();
+      row.process_group = current.process_group();
+      row.name = routine.name();
+      row.group_name = routine.group_name();
+      row.processor_id = routine.processor_id();
+      row.cpu_percent = 100.0 *
+                        static_cast<double>(routine.exec_time_ns() -
+                                            previous_routine->exec_time_ns()) /
+                        interval_ns;
+      row.wait_percent = 100.0 *
+                         static_cast<double>(routine.wait_time_ns() -
+                                             previous_routine->wait_time_ns()) /
+                         interval_ns;
+      row.switches_per_sec =
+          static_cast<double>(routine.switch_count() -
+                              previous_routine->switch_count()) *
+          1e9 / interval_ns;
+      rows.push_back(std::move(row));
+    }
+  }
+
+  std::mutex mutex_;
+  std::map<int, std::shared_ptr<SchedulerMetrics>> previous_samples_;
+  std::map<int, std::vector<RoutineRow>> rows_;
+};
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  int interval_sec = 3;
+  if (argc > 1) {
+    interval_sec = std::max(1, std::atoi(argv[1]));
+  }
+
+  apollo::cyber::Init(argv[0]);
+
+  MetricsAggregator aggregator;
+  apollo::cyber::proto::RoleAttributes attr;
+  attr.set_node_name("cyber_top");
+  attr.set_channel_name(kMetricsChannel);
+  attr.set_channel_id(
+      apollo::cyber::common::GlobalData::RegisterChannel(kMetricsChannel));
+  attr.mutable_qos_profile()->CopyFrom(
+      apollo::cyber::transport::QosProfileConf::QOS_PROFILE_SYSTEM_DEFAULT);
+  auto receiver =
+      apollo::cyber::transport::Transport::Instance()
+          ->CreateReceiver<SchedulerMetrics>(
+              attr,
+              [&aggregator](
+                  const std::shared_ptr<SchedulerMetrics> &metrics,
+                  const apollo::cyber::transport::MessageInfo &,
+                  const apollo::cyber::proto::RoleAttributes &) {
+                aggregator.OnMetrics(metrics);
+              },
+              apollo::cyber::proto::OptionalMode::RTPS);
+  if (receiver == nullptr) {
+    std::printf("failed to subscribe %s\n", kMetricsChannel);
+    return 1;
+  }
+
+  while (apollo::cyber::OK()) {
+    std::this_thread::sleep_for(std::chrono::seconds(interval_sec));
+    aggregator.Render();
+  }
+  return 0;
+}
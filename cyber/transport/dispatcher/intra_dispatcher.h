@@ -17,10 +17,12 @@
 #ifndef CYBER_TRANSPORT_DISPATCHER_INTRA_DISPATCHER_H_
 #define CYBER_TRANSPORT_DISPATCHER_INTRA_DISPATCHER_H_
 
+#include <atomic>
 #include <iostream>
 #include <map>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <utility>
 
 #include "cyber/base/atomic_rw_lock.h"
@@ -279,6 +281,9 @@ class IntraDispatcher : public Dispatcher {
   std::shared_ptr<ListenerHandler<MessageT>> GetHandler(uint64_t channel_id);
 
   ChannelChainPtr chain_;
+  // Bumped whenever a listener is added or removed, invalidates the
+  // per-thread typed handler caches used by the OnMessage fast path.
+  std::atomic<uint64_t> listener_change_seq_ = {0};
 };
 
 template <typename MessageT>
@@ -288,6 +293,29 @@ void IntraDispatcher::OnMessage(uint64_t channel_id,
   if (is_shutdown_.load()) {
     return;
   }
+
+  // Zero-copy fast path. The typed handler of a channel only changes when a
+  // listener is added or removed, so each transmitting thread caches it and
+  // hands the shared_ptr straight through, skipping the per-message handler
+  // lookup and RTTI cast.
+  thread_local std::unordered_map<uint64_t,
+                                  std::weak_ptr<ListenerHandler<MessageT>>>
+      handler_cache;
+  thread_local uint64_t cached_change_seq = 0;
+  uint64_t change_seq = listener_change_seq_.load(std::memory_order_acquire);
+  if (change_seq != cached_change_seq) {
+    handler_cache.clear();
+    cached_change_seq = change_seq;
+  }
+  auto cache_itr = handler_cache.find(channel_id);
+  if (cache_itr != handler_cache.end()) {
+    if (auto cached_handler = cache_itr->second.lock()) {
+      cached_handler->Run(message, message_info);
+      return;
+    }
+    handler_cache.erase(cache_itr);
+  }
+
   ListenerHandlerBasePtr* handler_base = nullptr;
   ADEBUG << "intra on message, channel:"
          << common::GlobalData::GetChannelById(channel_id);
@@ -295,6 +323,7 @@ void IntraDispatcher::OnMessage(uint64_t channel_id,
     auto handler =
         std::dynamic_pointer_cast<ListenerHandler<MessageT>>(*handler_base);
     if (handler) {
+      handler_cache[channel_id] = handler;
       handler->Run(message, message_info);
     } else {
       auto msg_size = message::FullByteSize(*message);
@@ -365,6 +394,7 @@ void IntraDispatcher::AddListener(const RoleAttributes& self_attr,
     };
     handler->Connect(self_id, listener_wrapper);
   }
+  listener_change_seq_.fetch_add(1, std::memory_order_release);
 }
 
 template <typename MessageT>
@@ -393,6 +423,7 @@ void IntraDispatcher::AddListener(const RoleAttributes& self_attr,
     };
     handler->Connect(self_id, oppo_id, listener_wrapper);
   }
+  listener_change_seq_.fetch_add(1, std::memory_order_release);
 }
 
 template <typename MessageT>
@@ -403,6 +434,7 @@ void IntraDispatcher::RemoveListener(const RoleAttributes& self_attr) {
   Dispatcher::RemoveListener<MessageT>(self_attr);
   chain_->RemoveListener<MessageT>(self_attr.id(), self_attr.channel_id(),
                                    message::GetMessageName<MessageT>());
+  listener_change_seq_.fetch_add(1, std::memory_order_release);
 }
 
 template <typename MessageT>
@@ -415,6 +447,7 @@ void IntraDispatcher::RemoveListener(const RoleAttributes& self_attr,
   chain_->RemoveListener<MessageT>(self_attr.id(), opposite_attr.id(),
                                    self_attr.channel_id(),
                                    message::GetMessageName<MessageT>());
+  listener_change_seq_.fetch_add(1, std::memory_order_release);
 }
 
 }  // namespace transport
@@ -29,6 +29,7 @@
 #include "cyber/common/macros.h"
 #include "cyber/message/message_traits.h"
 #include "cyber/transport/dispatcher/dispatcher.h"
+#include "cyber/transport/message/arena_message_pool.h"
 #include "cyber/transport/shm/notifier_factory.h"
 #include "cyber/transport/shm/segment_factory.h"
 
@@ -82,9 +83,11 @@ template <typename MessageT>
 void ShmDispatcher::AddListener(const RoleAttributes& self_attr,
                                 const MessageListener<MessageT>& listener) {
   // FIXME: make it more clean
-  auto listener_adapter = [listener](const std::shared_ptr<ReadableBlock>& rb,
-                                     const MessageInfo& msg_info) {
-    auto msg = std::make_shared<MessageT>();
+  auto pool = std::make_shared<ArenaMessagePool>();
+  auto listener_adapter = [listener, pool](
+                              const std::shared_ptr<ReadableBlock>& rb,
+                              const MessageInfo& msg_info) {
+    auto msg = pool->template CreateMessage<MessageT>();
     RETURN_IF(!message::ParseFromArray(
         rb->buf, static_cast<int>(rb->block->msg_size()), msg.get()));
     listener(msg, msg_info);
@@ -99,9 +102,11 @@ void ShmDispatcher::AddListener(const RoleAttributes& self_attr,
                                 const RoleAttributes& opposite_attr,
                                 const MessageListener<MessageT>& listener) {
   // FIXME: make it more clean
-  auto listener_adapter = [listener](const std::shared_ptr<ReadableBlock>& rb,
-                                     const MessageInfo& msg_info) {
-    auto msg = std::make_shared<MessageT>();
+  auto pool = std::make_shared<ArenaMessagePool>();
+  auto listener_adapter = [listener, pool](
+                              const std::shared_ptr<ReadableBlock>& rb,
+                              const MessageInfo& msg_info) {
+    auto msg = pool->template CreateMessage<MessageT>();
     RETURN_IF(!message::ParseFromArray(
         rb->buf, static_cast<int>(rb->block->msg_size()), msg.get()));
     listener(msg, msg_info);
@@ -0,0 +1,117 @@
+/******************************************************************************
+ * Copyright 2020 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#ifndef CYBER_TRANSPORT_MESSAGE_ARENA_MESSAGE_POOL_H_
+#define CYBER_TRANSPORT_MESSAGE_ARENA_MESSAGE_POOL_H_
+
+#include <atomic>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+
+#include "google/protobuf/arena.h"
+#include "google/protobuf/message.h"
+
+namespace apollo {
+namespace cyber {
+namespace transport {
+
+// Recycling pool of protobuf arenas for received messages. The dispatcher
+// thread of one channel allocates parsed messages out of the active arena;
+// after an arena has served kMessagesPerArena messages it is retired and
+// goes back to the free list once the last message allocated from it is
+// released, where one Arena::Reset frees the whole batch instead of one
+// heap free per message. Allocation is meant to happen on a single thread
+// (the dispatcher), releases may come from any thread.
+class ArenaMessagePool
+    : public std::enable_shared_from_this<ArenaMessagePool> {
+ public:
+  template <typename M,
+            typename std::enable_if<
+                std::is_base_of<google::protobuf::Message, M>::value,
+                int>::type = 0>
+  std::shared_ptr<M> CreateMessage() {
+    if (active_ == nullptr) {
+      active_ = AcquireSlot();
+    }
+    auto slot = active_;
+    M* msg = google::protobuf::Arena::CreateMessage<M>(&slot->arena);
+    slot->live_messages.fetch_add(1, std::memory_order_relaxed);
+    if (++slot->served >= kMessagesPerArena) {
+      slot->retired.store(true, std::memory_order_release);
+      active_ = nullptr;
+    }
+    std::weak_ptr<ArenaMessagePool> self = shared_from_this();
+    return std::shared_ptr<M>(msg, [slot, self](M*) {
+      if (slot->live_messages.fetch_sub(1, std::memory_order_acq_rel) == 1 &&
+          slot->retired.load(std::memory_order_acquire)) {
+        if (auto pool = self.lock()) {
+          pool->RecycleSlot(slot);
+        }
+      }
+    });
+  }
+
+  // Non-protobuf messages (e.g. RawMessage) cannot live in an arena, keep
+  // plain heap allocation for them.
+  template <typename M,
+            typename std::enable_if<
+                !std::is_base_of<google::protobuf::Message, M>::value,
+                int>::type = 0>
+  std::shared_ptr<M> CreateMessage() {
+    return std::make_shared<M>();
+  }
+
+ private:
+  struct ArenaSlot {
+    google::protobuf::Arena arena;
+    std::atomic<uint32_t> live_messages = {0};
+    std::atomic<bool> retired = {false};
+    uint32_t served = 0;
+  };
+
+  std::shared_ptr<ArenaSlot> AcquireSlot() {
+    std::lock_guard<std::mutex> lock(free_slots_mutex_);
+    if (!free_slots_.empty()) {
+      auto slot = free_slots_.front();
+      free_slots_.pop_front();
+      return slot;
+    }
+    return std::make_shared<ArenaSlot>();
+  }
+
+  void RecycleSlot(const std::shared_ptr<ArenaSlot>& slot) {
+    slot->arena.Reset();
+    slot->served = 0;
+    slot->retired.store(false, std::memory_order_release);
+    std::lock_guard<std::mutex> lock(free_slots_mutex_);
+    free_slots_.push_back(slot);
+  }
+
+  static const uint32_t kMessagesPerArena = 64;
+
+  std::shared_ptr<ArenaSlot> active_ = nullptr;
+  std::list<std::shared_ptr<ArenaSlot>> free_slots_;
+  std::mutex free_slots_mutex_;
+};
+
+}  // namespace transport
+}  // namespace cyber
+}  // namespace apollo
+
+#endif  // CYBER_TRANSPORT_MESSAGE_ARENA_MESSAGE_POOL_H_
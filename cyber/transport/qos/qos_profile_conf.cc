@@ -41,6 +41,12 @@ QosProfile QosProfileConf::CreateQosProfile(
 const uint32_t QosProfileConf::QOS_HISTORY_DEPTH_SYSTEM_DEFAULT = 0;
 const uint32_t QosProfileConf::QOS_MPS_SYSTEM_DEFAULT = 0;
 
+const uint32_t QosProfileConf::QOS_FC_FRAGMENT_SIZE = 64 * 1024;
+const uint32_t QosProfileConf::QOS_FC_PERIOD_MS = 10;
+
+const uint32_t QosProfileConf::QOS_COALESCE_WINDOW_US = 1000;
+const uint32_t QosProfileConf::QOS_COALESCE_MAX_BYTES = 64 * 1024;
+
 const QosProfile QosProfileConf::QOS_PROFILE_DEFAULT = CreateQosProfile(
     QosHistoryPolicy::HISTORY_KEEP_LAST, 1, QOS_MPS_SYSTEM_DEFAULT,
     QosReliabilityPolicy::RELIABILITY_RELIABLE,
@@ -51,6 +57,23 @@ const QosProfile QosProfileConf::QOS_PROFILE_SENSOR_DATA = CreateQosProfile(
     QosReliabilityPolicy::RELIABILITY_BEST_EFFORT,
     QosDurabilityPolicy::DURABILITY_VOLATILE);
 
+// For high-volume cross-host streams, e.g. camera frames to a remote
+// operator. The non-zero mps activates publisher-side rate shaping, so bulk
+// traffic cannot starve control channels sharing the link.
+const QosProfile QosProfileConf::QOS_PROFILE_BULK_DATA = CreateQosProfile(
+    QosHistoryPolicy::HISTORY_KEEP_LAST, 5, 256,
+    QosReliabilityPolicy::RELIABILITY_BEST_EFFORT,
+    QosDurabilityPolicy::DURABILITY_VOLATILE);
+
+// For one-shot state topics (routing response, map updates): the writer
+// keeps the last few messages and replays them to readers that join the
+// channel later, so a late starter does not have to poll for a message
+// published before it came up.
+const QosProfile QosProfileConf::QOS_PROFILE_LATCHED = CreateQosProfile(
+    QosHistoryPolicy::HISTORY_KEEP_LAST, 5, QOS_MPS_SYSTEM_DEFAULT,
+    QosReliabilityPolicy::RELIABILITY_RELIABLE,
+    QosDurabilityPolicy::DURABILITY_TRANSIENT_LOCAL);
+
 const QosProfile QosProfileConf::QOS_PROFILE_PARAMETERS = CreateQosProfile(
     QosHistoryPolicy::HISTORY_KEEP_LAST, 1000, QOS_MPS_SYSTEM_DEFAULT,
     QosReliabilityPolicy::RELIABILITY_RELIABLE,
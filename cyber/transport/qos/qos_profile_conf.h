@@ -43,8 +43,24 @@ class QosProfileConf {
   static const uint32_t QOS_HISTORY_DEPTH_SYSTEM_DEFAULT;
   static const uint32_t QOS_MPS_SYSTEM_DEFAULT;
 
+  // Flow control for shaped rtps publishers. A profile with a non-zero mps
+  // gets a throughput controller whose flush window is QOS_FC_PERIOD_MS and
+  // whose per-window byte budget is mps * QOS_FC_FRAGMENT_SIZE, scaled to the
+  // window. QOS_FC_FRAGMENT_SIZE is the datagram budget one sample fragment
+  // is assumed to occupy on the wire.
+  static const uint32_t QOS_FC_FRAGMENT_SIZE;
+  static const uint32_t QOS_FC_PERIOD_MS;
+
+  // Defaults for send coalescing (see CoalescingWriter). A batch is flushed
+  // once it is QOS_COALESCE_WINDOW_US old or holds QOS_COALESCE_MAX_BYTES of
+  // serialized payload, whichever comes first.
+  static const uint32_t QOS_COALESCE_WINDOW_US;
+  static const uint32_t QOS_COALESCE_MAX_BYTES;
+
   static const QosProfile QOS_PROFILE_DEFAULT;
   static const QosProfile QOS_PROFILE_SENSOR_DATA;
+  static const QosProfile QOS_PROFILE_LATCHED;
+  static const QosProfile QOS_PROFILE_BULK_DATA;
   static const QosProfile QOS_PROFILE_PARAMETERS;
   static const QosProfile QOS_PROFILE_SERVICES_DEFAULT;
   static const QosProfile QOS_PROFILE_PARAM_EVENT;
@@ -217,6 +217,8 @@ void HybridReceiver<M>::InitReceivers() {
             std::make_shared<RtpsReceiver<M>>(this->attr_, listener);
         break;
     }
+    // This hybrid receiver already counts every dispatched message.
+    receivers_[mode]->DisableStatistics();
   }
 }
 
@@ -274,6 +276,9 @@ void HybridReceiver<M>::ThreadFunc(const RoleAttributes& opposite_attr) {
   };
 
   auto receiver = std::make_shared<RtpsReceiver<M>>(attr, listener);
+  // The transient channel name here is synthesized per history handshake;
+  // keep it out of the per-channel statistics registry.
+  receiver->DisableStatistics();
   receiver->Enable();
 
   do {
@@ -17,9 +17,12 @@
 #ifndef CYBER_TRANSPORT_RECEIVER_RECEIVER_H_
 #define CYBER_TRANSPORT_RECEIVER_RECEIVER_H_
 
+#include <chrono>
 #include <functional>
 #include <memory>
 
+#include "cyber/message/message_traits.h"
+#include "cyber/statistics/channel_statistics.h"
 #include "cyber/transport/common/endpoint.h"
 #include "cyber/transport/message/history.h"
 #include "cyber/transport/message/message_info.h"
@@ -43,16 +46,25 @@ class Receiver : public Endpoint {
   virtual void Enable(const RoleAttributes& opposite_attr) = 0;
   virtual void Disable(const RoleAttributes& opposite_attr) = 0;
 
+  // Composite receivers like HybridReceiver wrap lower receivers of the same
+  // channel; only the outermost one should count, so it turns the inner
+  // receivers' statistics off.
+  void DisableStatistics() { counters_ = nullptr; }
+
  protected:
   void OnNewMessage(const MessagePtr& msg, const MessageInfo& msg_info);
 
   MessageListener msg_listener_;
+  statistics::EndpointCounters* counters_;
 };
 
 template <typename M>
 Receiver<M>::Receiver(const RoleAttributes& attr,
                       const MessageListener& msg_listener)
-    : Endpoint(attr), msg_listener_(msg_listener) {}
+    : Endpoint(attr),
+      msg_listener_(msg_listener),
+      counters_(statistics::ChannelStatistics::Instance()->GetCounters(
+          attr.channel_name(), false)) {}
 
 template <typename M>
 Receiver<M>::~Receiver() {}
@@ -60,8 +72,25 @@ Receiver<M>::~Receiver() {}
 template <typename M>
 void Receiver<M>::OnNewMessage(const MessagePtr& msg,
                                const MessageInfo& msg_info) {
+  if (counters_ == nullptr) {
+    if (msg_listener_ != nullptr) {
+      msg_listener_(msg, msg_info, attr_);
+    }
+    return;
+  }
+
+  counters_->RecordSequence(msg_info.sender_id().HashValue(),
+                            msg_info.seq_num());
   if (msg_listener_ != nullptr) {
+    const auto start = std::chrono::steady_clock::now();
     msg_listener_(msg, msg_info, attr_);
+    const uint64_t latency_ns = static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - start)
+            .count());
+    counters_->RecordMessage(message::ByteSize(*msg), latency_ns);
+  } else {
+    counters_->RecordMessage(message::ByteSize(*msg), 0);
   }
 }
 
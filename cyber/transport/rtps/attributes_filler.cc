@@ -105,6 +105,21 @@ bool AttributesFiller::FillInPubAttr(
 
     pub_attr->times.heartbeatPeriod.seconds = seconds;
     pub_attr->times.heartbeatPeriod.fraction = fraction;
+
+    // Shape the async writer as well: samples batch up in its history and are
+    // flushed at most QOS_FC_PERIOD_MS apart, each flush limited to the byte
+    // budget derived from mps. This keeps bulk channels at wire rate without
+    // starving low-rate control channels sharing the link.
+    uint64_t bytes_per_period = mps *
+                                QosProfileConf::QOS_FC_FRAGMENT_SIZE *
+                                QosProfileConf::QOS_FC_PERIOD_MS / 1000;
+    if (bytes_per_period < QosProfileConf::QOS_FC_FRAGMENT_SIZE) {
+      bytes_per_period = QosProfileConf::QOS_FC_FRAGMENT_SIZE;
+    }
+    pub_attr->throughputController.bytesPerPeriod =
+        static_cast<uint32_t>(bytes_per_period);
+    pub_attr->throughputController.periodMillisecs =
+        QosProfileConf::QOS_FC_PERIOD_MS;
   }
 
   pub_attr->qos.m_publishMode.kind =
@@ -107,6 +107,22 @@ void Participant::CreateFastRtpsParticipant(
   attr.rtps.builtin.leaseDuration_announcementperiod.seconds =
       part_attr_conf->announcement_period();
 
+  // Large samples are fragmented into datagrams; bigger socket buffers let a
+  // burst of fragments survive scheduling jitter on cross-host links. 0 keeps
+  // the system default.
+  uint32_t socket_buffer_size = 0;
+  const char* buf_val = ::getenv("CYBER_SOCKET_BUFFER_SIZE");
+  if (buf_val != nullptr) {
+    try {
+      socket_buffer_size = std::stoi(buf_val);
+    } catch (const std::exception& e) {
+      AERROR << "convert socket_buffer_size error " << e.what();
+      return;
+    }
+  }
+  attr.rtps.sendSocketBufferSize = socket_buffer_size;
+  attr.rtps.listenSocketBufferSize = socket_buffer_size;
+
   attr.rtps.setName(name.c_str());
 
   std::string ip_env("127.0.0.1");
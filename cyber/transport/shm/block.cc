@@ -72,6 +72,25 @@ void Block::ReleaseWriteLock() { lock_num_.fetch_add(1); }
 
 void Block::ReleaseReadLock() { lock_num_.fetch_sub(1); }
 
+void Block::BeginWrite() {
+  // even -> odd, content becomes unstable.
+  seq_num_.fetch_add(1, std::memory_order_acquire);
+}
+
+void Block::EndWrite() {
+  // odd -> even, content becomes stable again.
+  seq_num_.fetch_add(1, std::memory_order_release);
+}
+
+uint64_t Block::ReadBegin() const {
+  return seq_num_.load(std::memory_order_acquire);
+}
+
+bool Block::ReadRetry(uint64_t seq) const {
+  std::atomic_thread_fence(std::memory_order_acquire);
+  return seq_num_.load(std::memory_order_relaxed) != seq;
+}
+
 }  // namespace transport
 }  // namespace cyber
 }  // namespace apollo
@@ -43,6 +43,14 @@ class Block {
   static const int32_t kWriteExclusive;
   static const int32_t kMaxTryLockTimes;
 
+  // Seqlock protocol used by RingBufferSegment. The sequence number is odd
+  // while a writer owns the block and even once its content is stable, so a
+  // reader can detect a racing writer without ever making the writer wait.
+  void BeginWrite();
+  void EndWrite();
+  uint64_t ReadBegin() const;
+  bool ReadRetry(uint64_t seq) const;
+
  private:
   bool TryLockForWrite();
   bool TryLockForRead();
@@ -53,6 +61,10 @@ class Block {
 
   uint64_t msg_size_;
   uint64_t msg_info_size_;
+
+  // On its own cache line so concurrent transmitters touching adjacent
+  // blocks do not false-share the sequence words.
+  alignas(64) std::atomic<uint64_t> seq_num_ = {0};
 };
 
 }  // namespace transport
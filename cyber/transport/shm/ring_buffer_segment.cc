@@ -0,0 +1,137 @@
+/******************************************************************************
+ * Copyright 2020 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "cyber/transport/shm/ring_buffer_segment.h"
+
+#include <cstring>
+
+#include "cyber/common/log.h"
+#include "cyber/common/util.h"
+
+namespace apollo {
+namespace cyber {
+namespace transport {
+
+const uint32_t RingBufferSegment::kMaxReadRetryTimes = 3;
+
+RingBufferSegment::RingBufferSegment(uint64_t channel_id)
+    : XsiSegment(channel_id), read_buf_(), read_block_() {}
+
+RingBufferSegment::~RingBufferSegment() {}
+
+bool RingBufferSegment::AcquireBlockToWrite(std::size_t msg_size,
+                                            WritableBlock* writable_block) {
+  RETURN_VAL_IF_NULL(writable_block, false);
+  if (!init_ && !OpenOrCreate()) {
+    AERROR << "create shm failed, can't write now.";
+    return false;
+  }
+
+  bool result = true;
+  if (state_->need_remap()) {
+    result = Remap();
+  }
+
+  if (msg_size > conf_.ceiling_msg_size()) {
+    AINFO << "msg_size: " << msg_size
+          << " larger than current shm_buffer_size: "
+          << conf_.ceiling_msg_size() << " , need recreate.";
+    result = Recreate(msg_size);
+  }
+
+  if (!result) {
+    AERROR << "segment update failed.";
+    return false;
+  }
+
+  // Claim the next block in ring order. Unlike the default segment we never
+  // wait for readers, the block just becomes unstable until EndWrite.
+  uint32_t index = state_->FetchAddSeq(1) % conf_.block_num();
+  blocks_[index].BeginWrite();
+  writable_block->index = index;
+  writable_block->block = &blocks_[index];
+  writable_block->buf = block_buf_addrs_[index];
+  return true;
+}
+
+void RingBufferSegment::ReleaseWrittenBlock(
+    const WritableBlock& writable_block) {
+  auto index = writable_block.index;
+  if (index >= conf_.block_num()) {
+    return;
+  }
+  blocks_[index].EndWrite();
+}
+
+bool RingBufferSegment::AcquireBlockToRead(ReadableBlock* readable_block) {
+  RETURN_VAL_IF_NULL(readable_block, false);
+  if (!init_ && !OpenOnly()) {
+    AERROR << "failed to open shared memory, can't read now.";
+    return false;
+  }
+
+  auto index = readable_block->index;
+  if (index >= conf_.block_num()) {
+    AERROR << "invalid block_index[" << index << "].";
+    return false;
+  }
+
+  if (state_->need_remap() && !Remap()) {
+    AERROR << "segment update failed.";
+    return false;
+  }
+
+  Block* block = blocks_ + index;
+  uint8_t* src = block_buf_addrs_[index];
+  for (uint32_t i = 0; i < kMaxReadRetryTimes; ++i) {
+    uint64_t seq = block->ReadBegin();
+    if (seq & 1) {
+      // A writer owns the block right now.
+      continue;
+    }
+    uint64_t msg_size = block->msg_size();
+    uint64_t msg_info_size = block->msg_info_size();
+    if (msg_size + msg_info_size > conf_.block_buf_size()) {
+      // Torn metadata, the writer raced us.
+      continue;
+    }
+    if (read_buf_.size() < msg_size + msg_info_size) {
+      read_buf_.resize(msg_size + msg_info_size);
+    }
+    std::memcpy(read_buf_.data(), src, msg_size + msg_info_size);
+    if (block->ReadRetry(seq)) {
+      // Overwritten while copying, drop and retry.
+      continue;
+    }
+    read_block_.set_msg_size(msg_size);
+    read_block_.set_msg_info_size(msg_info_size);
+    readable_block->block = &read_block_;
+    readable_block->buf = read_buf_.data();
+    return true;
+  }
+
+  ADEBUG << "block " << index << " kept being overwritten by faster writers.";
+  return false;
+}
+
+void RingBufferSegment::ReleaseReadBlock(const ReadableBlock& readable_block) {
+  // Nothing is held, readers validated their copy in AcquireBlockToRead.
+  (void)readable_block;
+}
+
+}  // namespace transport
+}  // namespace cyber
+}  // namespace apollo
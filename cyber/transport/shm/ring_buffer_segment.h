@@ -0,0 +1,63 @@
+/******************************************************************************
+ * Copyright 2020 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#ifndef CYBER_TRANSPORT_SHM_RING_BUFFER_SEGMENT_H_
+#define CYBER_TRANSPORT_SHM_RING_BUFFER_SEGMENT_H_
+
+#include <cstdint>
+#include <vector>
+
+#include "cyber/transport/shm/xsi_segment.h"
+
+namespace apollo {
+namespace cyber {
+namespace transport {
+
+// A lock-free variant of the shared-memory segment. Writers claim blocks in
+// ring order through the global sequence counter and publish them with a
+// per-block seqlock, so a slow or stalled reader can never block a
+// transmitter. Readers copy the payload out of shared memory and validate
+// the block sequence afterwards; a message overwritten during the copy is
+// simply dropped, which matches the best-effort semantics of the shm
+// transport.
+class RingBufferSegment : public XsiSegment {
+ public:
+  explicit RingBufferSegment(uint64_t channel_id);
+  virtual ~RingBufferSegment();
+
+  static const char* Type() { return "ring"; }
+
+  bool AcquireBlockToWrite(std::size_t msg_size,
+                           WritableBlock* writable_block) override;
+  void ReleaseWrittenBlock(const WritableBlock& writable_block) override;
+
+  bool AcquireBlockToRead(ReadableBlock* readable_block) override;
+  void ReleaseReadBlock(const ReadableBlock& readable_block) override;
+
+  static const uint32_t kMaxReadRetryTimes;
+
+ private:
+  // Only the ShmDispatcher thread of one process reads a segment, so a
+  // single private scratch buffer per segment is enough.
+  std::vector<uint8_t> read_buf_;
+  Block read_block_;
+};
+
+}  // namespace transport
+}  // namespace cyber
+}  // namespace apollo
+
+#endif  // CYBER_TRANSPORT_SHM_RING_BUFFER_SEGMENT_H_
@@ -0,0 +1,96 @@
+/******************************************************************************
+ * Copyright 2020 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "cyber/transport/shm/ring_buffer_segment.h"
+
+#include <cstring>
+#include <string>
+
+#include "gtest/gtest.h"
+
+namespace apollo {
+namespace cyber {
+namespace transport {
+
+TEST(RingBufferSegmentTest, write_then_read) {
+  RingBufferSegment segment(11111);
+  const std::string msg("ring buffer segment test");
+
+  WritableBlock wb;
+  ASSERT_TRUE(segment.AcquireBlockToWrite(msg.size(), &wb));
+  ASSERT_NE(wb.buf, nullptr);
+  memcpy(wb.buf, msg.data(), msg.size());
+  wb.block->set_msg_size(msg.size());
+  wb.block->set_msg_info_size(0);
+  segment.ReleaseWrittenBlock(wb);
+
+  ReadableBlock rb;
+  rb.index = wb.index;
+  ASSERT_TRUE(segment.AcquireBlockToRead(&rb));
+  EXPECT_EQ(rb.block->msg_size(), msg.size());
+  EXPECT_EQ(memcmp(rb.buf, msg.data(), msg.size()), 0);
+  segment.ReleaseReadBlock(rb);
+}
+
+TEST(RingBufferSegmentTest, writer_never_blocks) {
+  RingBufferSegment segment(11112);
+  const std::string msg("payload");
+
+  // Acquire a block for reading and never release it. A subsequent writer
+  // must still be able to claim every block of the ring.
+  WritableBlock first;
+  ASSERT_TRUE(segment.AcquireBlockToWrite(msg.size(), &first));
+  memcpy(first.buf, msg.data(), msg.size());
+  first.block->set_msg_size(msg.size());
+  first.block->set_msg_info_size(0);
+  segment.ReleaseWrittenBlock(first);
+
+  ReadableBlock rb;
+  rb.index = first.index;
+  ASSERT_TRUE(segment.AcquireBlockToRead(&rb));
+
+  for (int i = 0; i < 1024; ++i) {
+    WritableBlock wb;
+    ASSERT_TRUE(segment.AcquireBlockToWrite(msg.size(), &wb));
+    memcpy(wb.buf, msg.data(), msg.size());
+    wb.block->set_msg_size(msg.size());
+    wb.block->set_msg_info_size(0);
+    segment.ReleaseWrittenBlock(wb);
+  }
+  segment.ReleaseReadBlock(rb);
+}
+
+TEST(RingBufferSegmentTest, overwritten_block_is_dropped) {
+  RingBufferSegment segment(11113);
+  const std::string msg("payload");
+
+  WritableBlock wb;
+  ASSERT_TRUE(segment.AcquireBlockToWrite(msg.size(), &wb));
+  memcpy(wb.buf, msg.data(), msg.size());
+  wb.block->set_msg_size(msg.size());
+  wb.block->set_msg_info_size(0);
+  // The writer has not released the block yet, so readers must back off.
+  ReadableBlock rb;
+  rb.index = wb.index;
+  EXPECT_FALSE(segment.AcquireBlockToRead(&rb));
+  segment.ReleaseWrittenBlock(wb);
+  EXPECT_TRUE(segment.AcquireBlockToRead(&rb));
+  segment.ReleaseReadBlock(rb);
+}
+
+}  // namespace transport
+}  // namespace cyber
+}  // namespace apollo
@@ -45,11 +45,12 @@ class Segment {
   explicit Segment(uint64_t channel_id);
   virtual ~Segment() {}
 
-  bool AcquireBlockToWrite(std::size_t msg_size, WritableBlock* writable_block);
-  void ReleaseWrittenBlock(const WritableBlock& writable_block);
+  virtual bool AcquireBlockToWrite(std::size_t msg_size,
+                                   WritableBlock* writable_block);
+  virtual void ReleaseWrittenBlock(const WritableBlock& writable_block);
 
-  bool AcquireBlockToRead(ReadableBlock* readable_block);
-  void ReleaseReadBlock(const ReadableBlock& readable_block);
+  virtual bool AcquireBlockToRead(ReadableBlock* readable_block);
+  virtual void ReleaseReadBlock(const ReadableBlock& readable_block);
 
  protected:
   virtual bool Destroy();
@@ -68,9 +69,10 @@ class Segment {
   std::mutex block_buf_lock_;
   std::unordered_map<uint32_t, uint8_t*> block_buf_addrs_;
 
- private:
   bool Remap();
   bool Recreate(const uint64_t& msg_size);
+
+ private:
   uint32_t GetNextWritableBlockIndex();
 };
 
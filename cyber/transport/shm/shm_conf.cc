@@ -58,6 +58,8 @@ const uint64_t ShmConf::MESSAGE_SIZE_16M = 1024 * 1024 * 16;
 const uint32_t ShmConf::BLOCK_NUM_MORE = 8;
 const uint64_t ShmConf::MESSAGE_SIZE_MORE = 1024 * 1024 * 32;
 
+const uint32_t ShmConf::BLOCK_NUM_HUGE = 4;
+
 uint64_t ShmConf::GetCeilingMessageSize(const uint64_t& real_msg_size) {
   uint64_t ceiling_msg_size = MESSAGE_SIZE_16K;
   if (real_msg_size <= MESSAGE_SIZE_16K) {
@@ -70,8 +72,14 @@ uint64_t ShmConf::GetCeilingMessageSize(const uint64_t& real_msg_size) {
     ceiling_msg_size = MESSAGE_SIZE_8M;
   } else if (real_msg_size <= MESSAGE_SIZE_16M) {
     ceiling_msg_size = MESSAGE_SIZE_16M;
-  } else {
+  } else if (real_msg_size <= MESSAGE_SIZE_MORE) {
     ceiling_msg_size = MESSAGE_SIZE_MORE;
+  } else {
+    // Huge messages get a ceiling rounded up to a multiple of
+    // MESSAGE_SIZE_MORE, so Segment::Recreate always produces a segment the
+    // message fits in, no matter how large it is.
+    ceiling_msg_size = (real_msg_size + MESSAGE_SIZE_MORE - 1) /
+                       MESSAGE_SIZE_MORE * MESSAGE_SIZE_MORE;
   }
   return ceiling_msg_size;
 }
@@ -102,7 +110,12 @@ uint32_t ShmConf::GetBlockNum(const uint64_t& ceiling_msg_size) {
       num = BLOCK_NUM_MORE;
       break;
     default:
-      AERROR << "unknown ceiling_msg_size[" << ceiling_msg_size << "]";
+      if (ceiling_msg_size > MESSAGE_SIZE_MORE &&
+          ceiling_msg_size % MESSAGE_SIZE_MORE == 0) {
+        num = BLOCK_NUM_HUGE;
+      } else {
+        AERROR << "unknown ceiling_msg_size[" << ceiling_msg_size << "]";
+      }
       break;
   }
   return num;
@@ -73,6 +73,9 @@ class ShmConf {
   // For message 10M+
   static const uint32_t BLOCK_NUM_MORE;
   static const uint64_t MESSAGE_SIZE_MORE;
+  // For message beyond MESSAGE_SIZE_MORE, the ceiling is rounded up from the
+  // real message size, so only a few huge blocks are kept resident.
+  static const uint32_t BLOCK_NUM_HUGE;
 };
 
 }  // namespace transport
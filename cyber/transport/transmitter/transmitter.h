@@ -17,11 +17,14 @@
 #ifndef CYBER_TRANSPORT_TRANSMITTER_TRANSMITTER_H_
 #define CYBER_TRANSPORT_TRANSMITTER_TRANSMITTER_H_
 
+#include <chrono>
 #include <cstdint>
 #include <memory>
 #include <string>
 
 #include "cyber/event/perf_event_cache.h"
+#include "cyber/message/message_traits.h"
+#include "cyber/statistics/channel_statistics.h"
 #include "cyber/transport/common/endpoint.h"
 #include "cyber/transport/message/message_info.h"
 
@@ -56,11 +59,15 @@ class Transmitter : public Endpoint {
  protected:
   uint64_t seq_num_;
   MessageInfo msg_info_;
+  statistics::EndpointCounters* counters_;
 };
 
 template <typename M>
 Transmitter<M>::Transmitter(const RoleAttributes& attr)
-    : Endpoint(attr), seq_num_(0) {
+    : Endpoint(attr),
+      seq_num_(0),
+      counters_(statistics::ChannelStatistics::Instance()->GetCounters(
+          attr.channel_name(), true)) {
   msg_info_.set_sender_id(this->id_);
   msg_info_.set_seq_num(this->seq_num_);
 }
@@ -73,7 +80,18 @@ bool Transmitter<M>::Transmit(const MessagePtr& msg) {
   msg_info_.set_seq_num(NextSeqNum());
   PerfEventCache::Instance()->AddTransportEvent(
       TransPerf::TRANSMIT_BEGIN, attr_.channel_id(), msg_info_.seq_num());
-  return Transmit(msg, msg_info_);
+  const auto start = std::chrono::steady_clock::now();
+  const bool ret = Transmit(msg, msg_info_);
+  const uint64_t latency_ns = static_cast<uint64_t>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(
+          std::chrono::steady_clock::now() - start)
+          .count());
+  if (ret) {
+    counters_->RecordMessage(message::ByteSize(*msg), latency_ns);
+  } else {
+    counters_->RecordError();
+  }
+  return ret;
 }
 
 template <typename M>
@@ -15,6 +15,7 @@
  *****************************************************************************/
 
 #include "modules/bridge/common/bridge_proto_diserialized_buf.h"
+#include "modules/bridge/common/bridge_proto_scattered_buf.h"
 #include "modules/bridge/common/bridge_proto_serialized_buf.h"
 
 #include "modules/planning/proto/planning.pb.h"
@@ -93,5 +94,39 @@ TEST(BridgeProtoBufTest, Simple) {
   }
 }
 
+TEST(BridgeProtoBufTest, Scattered) {
+  auto adc_trajectory = std::make_shared<planning::ADCTrajectory>();
+  for (size_t i = 0; i < 100; ++i) {
+    auto *point = adc_trajectory->add_trajectory_point();
+    double offset = 0.1 * static_cast<double>(i);
+    point->mutable_path_point()->set_x(1.0 + offset);
+    point->mutable_path_point()->set_y(1.0 + offset);
+  }
+  adc_trajectory->mutable_header()->set_sequence_num(123);
+
+  BridgeProtoSerializedBuf<planning::ADCTrajectory> serialized_buf;
+  serialized_buf.Serialize(adc_trajectory, "planning::ADCTrajectory");
+  BridgeProtoScatteredBuf<planning::ADCTrajectory> scattered_buf;
+  scattered_buf.Serialize(adc_trajectory, "planning::ADCTrajectory");
+
+  size_t frame_count = scattered_buf.GetFrameCount();
+  EXPECT_EQ(frame_count, serialized_buf.GetSerializedBufCount());
+  for (size_t i = 0; i < frame_count; i++) {
+    struct iovec iov[2];
+    EXPECT_TRUE(scattered_buf.FillIoVec(i, iov));
+    // Header + payload slice must match the contiguous framing byte for
+    // byte.
+    EXPECT_EQ(iov[0].iov_len + iov[1].iov_len,
+              serialized_buf.GetSerializedBufSize(i));
+    EXPECT_EQ(0, memcmp(iov[0].iov_base, serialized_buf.GetSerializedBuf(i),
+                        iov[0].iov_len));
+    EXPECT_EQ(0, memcmp(iov[1].iov_base,
+                        serialized_buf.GetSerializedBuf(i) + iov[0].iov_len,
+                        iov[1].iov_len));
+  }
+  struct iovec iov[2];
+  EXPECT_FALSE(scattered_buf.FillIoVec(frame_count, iov));
+}
+
 }  // namespace bridge
 }  // namespace apollo
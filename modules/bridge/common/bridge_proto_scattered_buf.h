@@ -0,0 +1,128 @@
+/******************************************************************************
+ * Copyright 2020 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#pragma once
+
+#include <sys/uio.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "modules/bridge/common/bridge_header.h"
+#include "modules/bridge/common/macro.h"
+
+namespace apollo {
+namespace bridge {
+
+/* Serializes a proto once and frames it for scatter-gather sending. The
+ * payload stays in one buffer; each frame is exposed as an iovec pair of
+ * its BridgeHeader and a slice of the payload, so the payload is never
+ * copied into per-frame buffers the way BridgeProtoSerializedBuf does.
+ */
+template <typename T>
+class BridgeProtoScatteredBuf {
+ public:
+  BridgeProtoScatteredBuf() {}
+  ~BridgeProtoScatteredBuf();
+
+  bool Serialize(const std::shared_ptr<T> &proto, const std::string &msg_name);
+
+  size_t GetFrameCount() const { return frames_.size(); }
+  /* Fills iov[0] with the frame header and iov[1] with the payload
+   * slice of the frame at index. iov must hold two entries.
+   */
+  bool FillIoVec(size_t index, struct iovec *iov) const;
+
+ private:
+  struct Frame {
+    char *header_buf_;
+    size_t header_len_;
+    bsize payload_pos_;
+    bsize payload_len_;
+  };
+
+ private:
+  char *payload_ = nullptr;
+  std::vector<Frame> frames_;
+};
+
+template <typename T>
+BridgeProtoScatteredBuf<T>::~BridgeProtoScatteredBuf() {
+  for (auto frame : frames_) {
+    FREE_ARRY(frame.header_buf_);
+  }
+  FREE_ARRY(payload_);
+}
+
+template <typename T>
+bool BridgeProtoScatteredBuf<T>::Serialize(const std::shared_ptr<T> &proto,
+                                           const std::string &msg_name) {
+  bsize msg_len = proto->ByteSize();
+  payload_ = new char[msg_len];
+  if (!proto->SerializeToArray(payload_, static_cast<int>(msg_len))) {
+    FREE_ARRY(payload_);
+    return false;
+  }
+  bsize offset = 0;
+  bsize frame_index = 0;
+  uint32_t total_frames = static_cast<uint32_t>(msg_len / FRAME_SIZE +
+                                                (msg_len % FRAME_SIZE ? 1 : 0));
+
+  while (offset < msg_len) {
+    bsize left = msg_len - frame_index * FRAME_SIZE;
+    bsize cpy_size = (left > FRAME_SIZE) ? FRAME_SIZE : left;
+
+    BridgeHeader header;
+    header.SetHeaderVer(0);
+    header.SetMsgName(msg_name);
+    header.SetMsgID(proto->header().sequence_num());
+    header.SetTimeStamp(proto->header().timestamp_sec());
+    header.SetMsgSize(msg_len);
+    header.SetTotalFrames(total_frames);
+    header.SetFrameSize(cpy_size);
+    header.SetIndex(frame_index);
+    header.SetFramePos(frame_index * FRAME_SIZE);
+    hsize header_size = header.GetHeaderSize();
+    Frame frame;
+    frame.header_buf_ = new char[header_size];
+    frame.header_len_ = header_size;
+    frame.payload_pos_ = frame_index * FRAME_SIZE;
+    frame.payload_len_ = cpy_size;
+    header.Serialize(frame.header_buf_, frame.header_len_);
+    frames_.push_back(frame);
+    frame_index++;
+    offset += cpy_size;
+  }
+  return true;
+}
+
+template <typename T>
+bool BridgeProtoScatteredBuf<T>::FillIoVec(size_t index,
+                                           struct iovec *iov) const {
+  if (index >= frames_.size() || !iov) {
+    return false;
+  }
+  const Frame &frame = frames_[index];
+  iov[0].iov_base = frame.header_buf_;
+  iov[0].iov_len = frame.header_len_;
+  iov[1].iov_base = payload_ + frame.payload_pos_;
+  iov[1].iov_len = frame.payload_len_;
+  return true;
+}
+
+}  // namespace bridge
+}  // namespace apollo
@@ -28,11 +28,11 @@
 #include "cyber/component/component.h"
 #include "cyber/cyber.h"
 #include "cyber/init.h"
+#include "cyber/io/session.h"
 #include "cyber/scheduler/scheduler_factory.h"
 #include "modules/bridge/common/bridge_gflags.h"
 #include "modules/bridge/common/bridge_header.h"
 #include "modules/bridge/common/bridge_proto_diserialized_buf.h"
-#include "modules/bridge/common/udp_listener.h"
 #include "modules/bridge/proto/udp_bridge_remote_info.pb.h"
 #include "modules/canbus/proto/chassis.pb.h"
 #include "modules/common/monitor_log/monitor_log_buffer.h"
@@ -52,15 +52,16 @@ class UDPBridgeMultiReceiverComponent final : public cyber::Component<> {
   bool IsTimeout(double time_stamp);
   void MsgDispatcher();
   bool InitSession(uint16_t port);
-  bool MsgHandle(int fd);
+  bool MsgHandle(const char *total_buf, int bytes);
 
  private:
+  void RecvLoop();
   bool RemoveInvalidBuf(uint32_t msg_id, const std::string &msg_name);
 
  private:
   common::monitor::MonitorLogBuffer monitor_logger_buffer_;
-  std::shared_ptr<UDPListener<UDPBridgeMultiReceiverComponent>> listener_ =
-      std::make_shared<UDPListener<UDPBridgeMultiReceiverComponent>>();
+  std::shared_ptr<cyber::io::Session> session_ =
+      std::make_shared<cyber::io::Session>();
   unsigned int bind_port_ = 0;
   bool enable_timeout_ = true;
   std::mutex mutex_;
@@ -30,6 +30,9 @@ UDPBridgeReceiverComponent<T>::UDPBridgeReceiverComponent()
 
 template <typename T>
 UDPBridgeReceiverComponent<T>::~UDPBridgeReceiverComponent() {
+  if (session_->fd() != -1) {
+    session_->Close();
+  }
   for (auto proto : proto_list_) {
     FREE_POINTER(proto);
   }
@@ -61,14 +64,49 @@ bool UDPBridgeReceiverComponent<T>::Init() {
 
 template <typename T>
 bool UDPBridgeReceiverComponent<T>::InitSession(uint16_t port) {
-  return listener_->Initialize(this, &UDPBridgeReceiverComponent<T>::MsgHandle,
-                               port);
+  if (session_->Socket(AF_INET, SOCK_DGRAM, 0) == -1) {
+    AERROR << "create socket failed";
+    return false;
+  }
+  int opt = 1;
+  setsockopt(session_->fd(), SOL_SOCKET, SO_REUSEADDR, &opt, sizeof(opt));
+
+  struct sockaddr_in server_addr;
+  server_addr.sin_family = AF_INET;
+  server_addr.sin_addr.s_addr = htonl(INADDR_ANY);
+  server_addr.sin_port = htons(port);
+  if (session_->Bind(reinterpret_cast<struct sockaddr *>(&server_addr),
+                     sizeof(server_addr)) < 0) {
+    AERROR << "bind to port[" << port << "] failed";
+    session_->Close();
+    return false;
+  }
+  return true;
 }
 
 template <typename T>
 void UDPBridgeReceiverComponent<T>::MsgDispatcher() {
   ADEBUG << "msg dispatcher start successful.";
-  listener_->Listen();
+  cyber::scheduler::Instance()->CreateTask(
+      [this]() { RecvLoop(); },
+      "udp_bridge_receiver_" + std::to_string(bind_port_));
+}
+
+template <typename T>
+void UDPBridgeReceiverComponent<T>::RecvLoop() {
+  struct sockaddr_in client_addr;
+  socklen_t sock_len = static_cast<socklen_t>(sizeof(client_addr));
+  char total_buf[2 * FRAME_SIZE] = {0};
+  while (!apollo::cyber::IsShutdown()) {
+    ssize_t bytes = session_->RecvFrom(
+        total_buf, sizeof(total_buf), 0,
+        reinterpret_cast<struct sockaddr *>(&client_addr), &sock_len);
+    ADEBUG << "total recv " << bytes;
+    if (bytes <= 0) {
+      continue;
+    }
+    MsgHandle(total_buf, static_cast<int>(bytes));
+  }
 }
 
 template <typename T>
@@ -130,17 +168,9 @@ bool UDPBridgeReceiverComponent<T>::IsTimeout(double time_stamp) {
 }
 
 template <typename T>
-bool UDPBridgeReceiverComponent<T>::MsgHandle(int fd) {
-  struct sockaddr_in client_addr;
-  socklen_t sock_len = static_cast<socklen_t>(sizeof(client_addr));
-  int bytes = 0;
-  int total_recv = 2 * FRAME_SIZE;
-  char total_buf[2 * FRAME_SIZE] = {0};
-  bytes =
-      static_cast<int>(recvfrom(fd, total_buf, total_recv, 0,
-                                (struct sockaddr *)&client_addr, &sock_len));
-  ADEBUG << "total recv " << bytes;
-  if (bytes <= 0 || bytes > total_recv) {
+bool UDPBridgeReceiverComponent<T>::MsgHandle(const char *total_buf,
+                                              int bytes) {
+  if (bytes <= 0 || bytes > 2 * FRAME_SIZE) {
     return false;
   }
   char header_flag[sizeof(BRIDGE_HEADER_FLAG) + 1] = {0};
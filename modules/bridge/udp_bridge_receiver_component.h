@@ -28,11 +28,11 @@
 #include "cyber/component/component.h"
 #include "cyber/cyber.h"
 #include "cyber/init.h"
+#include "cyber/io/session.h"
 #include "cyber/scheduler/scheduler_factory.h"
 #include "modules/bridge/common/bridge_gflags.h"
 #include "modules/bridge/common/bridge_header.h"
 #include "modules/bridge/common/bridge_proto_diserialized_buf.h"
-#include "modules/bridge/common/udp_listener.h"
 #include "modules/bridge/proto/udp_bridge_remote_info.pb.h"
 #include "modules/canbus/proto/chassis.pb.h"
 #include "modules/common/monitor_log/monitor_log_buffer.h"
@@ -52,11 +52,12 @@ class UDPBridgeReceiverComponent final : public cyber::Component<> {
   bool Init() override;
 
   std::string Name() const { return FLAGS_bridge_module_name; }
-  bool MsgHandle(int fd);
+  bool MsgHandle(const char *total_buf, int bytes);
 
  private:
   bool InitSession(uint16_t port);
   void MsgDispatcher();
+  void RecvLoop();
   bool IsProtoExist(const BridgeHeader &header);
   BridgeProtoDiserializedBuf<T> *CreateBridgeProtoBuf(
       const BridgeHeader &header);
@@ -72,8 +73,8 @@ class UDPBridgeReceiverComponent final : public cyber::Component<> {
   std::shared_ptr<cyber::Writer<T>> writer_;
   std::mutex mutex_;
 
-  std::shared_ptr<UDPListener<UDPBridgeReceiverComponent<T>>> listener_ =
-      std::make_shared<UDPListener<UDPBridgeReceiverComponent<T>>>();
+  std::shared_ptr<cyber::io::Session> session_ =
+      std::make_shared<cyber::io::Session>();
 
   std::vector<BridgeProtoDiserializedBuf<T> *> proto_list_;
 };
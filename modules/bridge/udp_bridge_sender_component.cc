@@ -15,7 +15,7 @@
  *****************************************************************************/
 
 #include "modules/bridge/udp_bridge_sender_component.h"
-#include "modules/bridge/common/bridge_proto_serialized_buf.h"
+#include "modules/bridge/common/bridge_proto_scattered_buf.h"
 #include "modules/bridge/common/macro.h"
 #include "modules/bridge/common/util.h"
 
@@ -46,17 +46,19 @@ bool UDPBridgeSenderComponent<T>::Init() {
 }
 
 template <typename T>
-bool UDPBridgeSenderComponent<T>::Proc(const std::shared_ptr<T> &pb_msg) {
-  if (remote_port_ == 0 || remote_ip_.empty()) {
-    AERROR << "remote info is invalid!";
-    return false;
+UDPBridgeSenderComponent<T>::~UDPBridgeSenderComponent() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (sock_fd_ >= 0) {
+    close(sock_fd_);
+    sock_fd_ = -1;
   }
+}
 
-  if (pb_msg == nullptr) {
-    AERROR << "proto msg is not ready!";
-    return false;
+template <typename T>
+bool UDPBridgeSenderComponent<T>::OpenSocket() {
+  if (sock_fd_ >= 0) {
+    return true;
   }
-
   struct sockaddr_in server_addr;
   server_addr.sin_addr.s_addr = inet_addr(remote_ip_.c_str());
   server_addr.sin_family = AF_INET;
@@ -69,17 +71,48 @@ bool UDPBridgeSenderComponent<T>::Proc(const std::shared_ptr<T> &pb_msg) {
     close(sock_fd);
     return false;
   }
+  sock_fd_ = sock_fd;
+  return true;
+}
 
-  BridgeProtoSerializedBuf<T> proto_buf;
+template <typename T>
+bool UDPBridgeSenderComponent<T>::Proc(const std::shared_ptr<T> &pb_msg) {
+  if (remote_port_ == 0 || remote_ip_.empty()) {
+    AERROR << "remote info is invalid!";
+    return false;
+  }
+
+  if (pb_msg == nullptr) {
+    AERROR << "proto msg is not ready!";
+    return false;
+  }
+
+  BridgeProtoScatteredBuf<T> proto_buf;
   proto_buf.Serialize(pb_msg, proto_name_);
-  for (size_t j = 0; j < proto_buf.GetSerializedBufCount(); j++) {
-    ssize_t nbytes = send(sock_fd, proto_buf.GetSerializedBuf(j),
-                          proto_buf.GetSerializedBufSize(j), 0);
-    if (nbytes != static_cast<ssize_t>(proto_buf.GetSerializedBufSize(j))) {
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (!OpenSocket()) {
+    AERROR << "connect to remote " << remote_ip_ << ":" << remote_port_
+           << " failed!";
+    return false;
+  }
+  for (size_t j = 0; j < proto_buf.GetFrameCount(); j++) {
+    struct iovec iov[2];
+    if (!proto_buf.FillIoVec(j, iov)) {
+      break;
+    }
+    struct msghdr msg;
+    memset(&msg, 0, sizeof(msg));
+    msg.msg_iov = iov;
+    msg.msg_iovlen = 2;
+    ssize_t nbytes = sendmsg(sock_fd_, &msg, 0);
+    if (nbytes != static_cast<ssize_t>(iov[0].iov_len + iov[1].iov_len)) {
+      // Reconnect on the next message in case the socket went bad.
+      close(sock_fd_);
+      sock_fd_ = -1;
       break;
     }
   }
-  close(sock_fd);
 
   return true;
 }
@@ -48,17 +48,23 @@ class UDPBridgeSenderComponent final : public cyber::Component<T> {
  public:
   UDPBridgeSenderComponent()
       : monitor_logger_buffer_(common::monitor::MonitorMessageItem::CONTROL) {}
+  ~UDPBridgeSenderComponent();
 
   bool Init() override;
   bool Proc(const std::shared_ptr<T> &pb_msg) override;
 
   std::string Name() const { return FLAGS_bridge_module_name; }
 
+ private:
+  // Opens and connects the sending socket once; later calls reuse it.
+  bool OpenSocket();
+
  private:
   common::monitor::MonitorLogBuffer monitor_logger_buffer_;
   unsigned int remote_port_ = 0;
   std::string remote_ip_ = "";
   std::string proto_name_ = "";
+  int sock_fd_ = -1;
   std::mutex mutex_;
 };
 
@@ -132,6 +132,11 @@ bool CanbusComponent::Init() {
 
   chassis_writer_ = node_->CreateWriter<Chassis>(FLAGS_chassis_topic);
 
+  if (FLAGS_enable_chassis_state_shm && !chassis_state_shm_.InitWriter()) {
+    AWARN << "Failed to init chassis state shared memory. "
+             "Chassis feedback is published on the channel only.";
+  }
+
   chassis_detail_writer_ =
       node_->CreateWriter<ChassisDetail>(FLAGS_chassis_detail_topic);
 
@@ -177,6 +182,11 @@ void CanbusComponent::Clear() {
 void CanbusComponent::PublishChassis() {
   Chassis chassis = vehicle_controller_->chassis();
   common::util::FillHeader(node_->Name(), &chassis);
+  // the shared-memory fast path goes first so the control loop sees the
+  // snapshot no later than the channel message
+  if (FLAGS_enable_chassis_state_shm) {
+    chassis_state_shm_.Write(chassis);
+  }
   chassis_writer_->Write(chassis);
   ADEBUG << chassis.ShortDebugString();
 }
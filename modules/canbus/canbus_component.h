@@ -34,6 +34,7 @@
 #include "modules/drivers/canbus/proto/can_card_parameter.pb.h"
 #include "modules/guardian/proto/guardian.pb.h"
 
+#include "modules/canbus/common/chassis_state_shm.h"
 #include "modules/canbus/vehicle/vehicle_controller.h"
 #include "modules/common/monitor_log/monitor_log_buffer.h"
 #include "modules/common/status/status.h"
@@ -104,6 +105,7 @@ class CanbusComponent final : public apollo::cyber::TimerComponent {
   ::apollo::common::monitor::MonitorLogBuffer monitor_logger_buffer_;
   std::shared_ptr<cyber::Writer<Chassis>> chassis_writer_;
   std::shared_ptr<cyber::Writer<ChassisDetail>> chassis_detail_writer_;
+  ChassisStateShm chassis_state_shm_;
 };
 
 CYBER_REGISTER_COMPONENT(CanbusComponent)
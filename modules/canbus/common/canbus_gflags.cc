@@ -46,3 +46,8 @@ DEFINE_int32(guardian_cmd_pending_queue_size, 10,
              "Max guardian cmd pending queue size");
 DEFINE_int32(control_cmd_pending_queue_size, 10,
              "Max control cmd pending queue size");
+
+// chassis state shared-memory fast path
+DEFINE_bool(enable_chassis_state_shm, false,
+            "Publish the hot chassis feedback fields into a shared-memory "
+            "block for the control loop, in addition to the channel.");
@@ -40,3 +40,6 @@ DECLARE_bool(receive_guardian);
 
 DECLARE_int32(guardian_cmd_pending_queue_size);
 DECLARE_int32(control_cmd_pending_queue_size);
+
+// chassis state shared-memory fast path
+DECLARE_bool(enable_chassis_state_shm);
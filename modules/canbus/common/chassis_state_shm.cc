@@ -0,0 +1,148 @@
+/******************************************************************************
+ * Copyright 2021 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "modules/canbus/common/chassis_state_shm.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#include <new>
+
+#include "cyber/common/log.h"
+
+namespace apollo {
+namespace canbus {
+
+namespace {
+
+constexpr char kChassisStateShmName[] = "/apollo_chassis_state";
+
+}  // namespace
+
+ChassisStateShm::~ChassisStateShm() {
+  if (segment_ != nullptr) {
+    // keep the segment linked so a restarting peer can re-attach
+    munmap(segment_, sizeof(Segment));
+    segment_ = nullptr;
+  }
+}
+
+bool ChassisStateShm::InitWriter() {
+  if (segment_ != nullptr) {
+    return true;
+  }
+  if (!OpenSegment(true)) {
+    return false;
+  }
+  new (segment_) Segment();
+  return true;
+}
+
+bool ChassisStateShm::InitReader() {
+  if (segment_ != nullptr) {
+    return true;
+  }
+  return OpenSegment(false);
+}
+
+bool ChassisStateShm::OpenSegment(const bool create) {
+  int fd = -1;
+  if (create) {
+    fd = shm_open(kChassisStateShmName, O_RDWR | O_CREAT, 0644);
+    if (fd < 0) {
+      AERROR << "create chassis state shm failed: " << strerror(errno);
+      return false;
+    }
+    if (ftruncate(fd, sizeof(Segment)) < 0) {
+      AERROR << "ftruncate chassis state shm failed: " << strerror(errno);
+      close(fd);
+      return false;
+    }
+  } else {
+    fd = shm_open(kChassisStateShmName, O_RDWR, 0644);
+    if (fd < 0) {
+      ADEBUG << "chassis state shm not available yet: " << strerror(errno);
+      return false;
+    }
+    struct stat file_attr;
+    if (fstat(fd, &file_attr) < 0 ||
+        static_cast<size_t>(file_attr.st_size) < sizeof(Segment)) {
+      AERROR << "chassis state shm has unexpected size.";
+      close(fd);
+      return false;
+    }
+  }
+
+  void *addr = mmap(nullptr, sizeof(Segment), PROT_READ | PROT_WRITE,
+                    MAP_SHARED, fd, 0);
+  close(fd);
+  if (addr == MAP_FAILED) {
+    AERROR << "attach chassis state shm failed: " << strerror(errno);
+    return false;
+  }
+  segment_ = reinterpret_cast<Segment *>(addr);
+  return true;
+}
+
+void ChassisStateShm::Write(const Chassis &chassis) {
+  if (segment_ == nullptr) {
+    return;
+  }
+  const uint32_t next = segment_->latest.load(std::memory_order_relaxed) ^ 1;
+  Slot &slot = segment_->slots[next];
+  const uint32_t seq = slot.seq.load(std::memory_order_relaxed);
+  // mark the slot as being written (odd), fill it, then publish (even)
+  slot.seq.store(seq + 1, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+  slot.block.timestamp_sec = chassis.header().timestamp_sec();
+  slot.block.speed_mps = chassis.speed_mps();
+  slot.block.throttle_percentage = chassis.throttle_percentage();
+  slot.block.brake_percentage = chassis.brake_percentage();
+  slot.block.steering_percentage = chassis.steering_percentage();
+  slot.block.gear_location = static_cast<int32_t>(chassis.gear_location());
+  slot.block.driving_mode = static_cast<int32_t>(chassis.driving_mode());
+  slot.seq.store(seq + 2, std::memory_order_release);
+  segment_->latest.store(next, std::memory_order_release);
+}
+
+bool ChassisStateShm::Read(ChassisStateBlock *block) const {
+  if (segment_ == nullptr || block == nullptr) {
+    return false;
+  }
+  // the writer flips slots at 100 Hz, so one retry per slot is plenty
+  constexpr int kMaxRetry = 4;
+  for (int i = 0; i < kMaxRetry; ++i) {
+    const uint32_t index = segment_->latest.load(std::memory_order_acquire);
+    const Slot &slot = segment_->slots[index];
+    const uint32_t seq_before = slot.seq.load(std::memory_order_acquire);
+    if (seq_before == 0 || (seq_before & 1) != 0) {
+      continue;
+    }
+    *block = slot.block;
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (slot.seq.load(std::memory_order_relaxed) == seq_before) {
+      return true;
+    }
+  }
+  return false;
+}
+
+}  // namespace canbus
+}  // namespace apollo
@@ -0,0 +1,110 @@
+/******************************************************************************
+ * Copyright 2021 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+/**
+ * @file
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+#include "modules/canbus/proto/chassis.pb.h"
+
+/**
+ * @namespace apollo::canbus
+ * @brief apollo::canbus
+ */
+namespace apollo {
+namespace canbus {
+
+/**
+ * @brief Fixed-size snapshot of the chassis feedback fields the control
+ * loop is latency-sensitive to. The full Chassis proto keeps flowing on
+ * the cyber channel for logging and every other consumer.
+ */
+struct ChassisStateBlock {
+  double timestamp_sec = 0.0;
+  float speed_mps = 0.0f;
+  float throttle_percentage = 0.0f;
+  float brake_percentage = 0.0f;
+  float steering_percentage = 0.0f;
+  int32_t gear_location = 0;
+  int32_t driving_mode = 0;
+};
+
+/**
+ * @class ChassisStateShm
+ *
+ * @brief Double-buffered shared-memory chassis state block with seqlock
+ * semantics. The canbus component publishes each chassis snapshot into the
+ * slot not being read, so the 100 Hz control loop can pick up the latest
+ * feedback without the serialization and scheduling latency of the cyber
+ * channel. A single writer is assumed; readers never block the writer.
+ */
+class ChassisStateShm {
+ public:
+  ChassisStateShm() = default;
+  ~ChassisStateShm();
+
+  /**
+   * @brief Create (or reuse) the shared-memory segment as the single
+   * writer. Not thread-safe; call once before Write().
+   * @return true on success.
+   */
+  bool InitWriter();
+
+  /**
+   * @brief Attach to the segment created by the writer. Idempotent, so the
+   * reader may retry every cycle until the writer side comes up.
+   * @return true once the segment is mapped.
+   */
+  bool InitReader();
+
+  /**
+   * @brief Publish a chassis snapshot into the back buffer and flip it to
+   * be the latest. Writer side only.
+   */
+  void Write(const Chassis &chassis);
+
+  /**
+   * @brief Copy out the latest consistent snapshot. Reader side only.
+   * @return false if the segment is not mapped or no consistent snapshot
+   * could be obtained.
+   */
+  bool Read(ChassisStateBlock *block) const;
+
+ private:
+  struct Slot {
+    // even: slot is stable; odd: a write is in progress
+    std::atomic<uint32_t> seq;
+    ChassisStateBlock block;
+  };
+
+  struct Segment {
+    // index of the most recently published slot
+    std::atomic<uint32_t> latest;
+    Slot slots[2];
+  };
+
+  bool OpenSegment(const bool create);
+
+  Segment *segment_ = nullptr;
+};
+
+}  // namespace canbus
+}  // namespace apollo
@@ -18,15 +18,30 @@
 
 #include <algorithm>
 #include <cmath>
+#include <limits>
 
 #include "cyber/common/file.h"
 #include "modules/common/configs/config_gflags.h"
+#include "modules/common/math/math_utils.h"
 
 namespace apollo {
 namespace common {
 
+namespace {
+
+// Bucket count of the swept-volume table. With a typical front wheel range
+// of +/- 0.5 rad this keeps neighboring buckets about 0.016 rad apart,
+// well below the steering resolution collision checks care about.
+constexpr int kSweptVolumeBucketNum = 65;
+
+}  // namespace
+
 VehicleConfig VehicleConfigHelper::vehicle_config_;
 bool VehicleConfigHelper::is_init_ = false;
+common::math::Polygon2d VehicleConfigHelper::ego_polygon_;
+std::vector<VehicleConfigHelper::SweptVolume>
+    VehicleConfigHelper::swept_volumes_;
+double VehicleConfigHelper::min_safe_turn_radius_ = 0.0;
 
 VehicleConfigHelper::VehicleConfigHelper() {}
 
@@ -41,9 +56,67 @@ void VehicleConfigHelper::Init(const std::string &config_file) {
 
 void VehicleConfigHelper::Init(const VehicleConfig &vehicle_params) {
   vehicle_config_ = vehicle_params;
+  PrecomputeGeometry();
   is_init_ = true;
 }
 
+void VehicleConfigHelper::PrecomputeGeometry() {
+  const auto &param = vehicle_config_.vehicle_param();
+
+  // Footprint in the vehicle frame, origin at the rear axle center,
+  // x forward, corners counterclockwise.
+  ego_polygon_ = common::math::Polygon2d(
+      {{param.front_edge_to_center(), -param.right_edge_to_center()},
+       {param.front_edge_to_center(), param.left_edge_to_center()},
+       {-param.back_edge_to_center(), param.left_edge_to_center()},
+       {-param.back_edge_to_center(), -param.right_edge_to_center()}});
+
+  double lat_edge_to_center =
+      std::max(param.left_edge_to_center(), param.right_edge_to_center());
+  double lon_edge_to_center =
+      std::max(param.front_edge_to_center(), param.back_edge_to_center());
+  min_safe_turn_radius_ =
+      std::sqrt((lat_edge_to_center + param.min_turn_radius()) *
+                    (lat_edge_to_center + param.min_turn_radius()) +
+                lon_edge_to_center * lon_edge_to_center);
+
+  swept_volumes_.clear();
+  if (param.steer_ratio() <= 0.0 || param.wheel_base() <= 0.0) {
+    // Configs without a steering model get a single straight-line bucket.
+    SweptVolume straight;
+    straight.turn_radius = std::numeric_limits<double>::infinity();
+    swept_volumes_.push_back(straight);
+    return;
+  }
+  const double max_wheel_angle = param.max_steer_angle() / param.steer_ratio();
+  const double step = 2.0 * max_wheel_angle / (kSweptVolumeBucketNum - 1);
+  swept_volumes_.reserve(kSweptVolumeBucketNum);
+  for (int i = 0; i < kSweptVolumeBucketNum; ++i) {
+    SweptVolume volume;
+    volume.front_wheel_angle = -max_wheel_angle + i * step;
+    const double abs_angle = std::fabs(volume.front_wheel_angle);
+    if (std::tan(abs_angle) < common::math::kMathEpsilon) {
+      volume.turn_radius = std::numeric_limits<double>::infinity();
+      volume.inner_radius = std::numeric_limits<double>::infinity();
+      volume.outer_radius = std::numeric_limits<double>::infinity();
+    } else {
+      volume.turn_radius = param.wheel_base() / std::tan(abs_angle);
+      // The edge toward the turn center sweeps the inner radius; the
+      // opposite front corner sweeps the outer one.
+      const double inner_edge = volume.front_wheel_angle > 0.0
+                                    ? param.left_edge_to_center()
+                                    : param.right_edge_to_center();
+      const double outer_edge = volume.front_wheel_angle > 0.0
+                                    ? param.right_edge_to_center()
+                                    : param.left_edge_to_center();
+      volume.inner_radius = std::max(volume.turn_radius - inner_edge, 0.0);
+      volume.outer_radius = std::hypot(volume.turn_radius + outer_edge,
+                                       param.front_edge_to_center());
+    }
+    swept_volumes_.push_back(volume);
+  }
+}
+
 const VehicleConfig &VehicleConfigHelper::GetConfig() {
   if (!is_init_) {
     Init();
@@ -52,14 +125,42 @@ const VehicleConfig &VehicleConfigHelper::GetConfig() {
 }
 
 double VehicleConfigHelper::MinSafeTurnRadius() {
-  const auto &param = vehicle_config_.vehicle_param();
-  double lat_edge_to_center =
-      std::max(param.left_edge_to_center(), param.right_edge_to_center());
-  double lon_edge_to_center =
-      std::max(param.front_edge_to_center(), param.back_edge_to_center());
-  return std::sqrt((lat_edge_to_center + param.min_turn_radius()) *
-                       (lat_edge_to_center + param.min_turn_radius()) +
-                   lon_edge_to_center * lon_edge_to_center);
+  if (!is_init_) {
+    Init();
+  }
+  return min_safe_turn_radius_;
+}
+
+const common::math::Polygon2d &VehicleConfigHelper::EgoPolygon() {
+  if (!is_init_) {
+    Init();
+  }
+  return ego_polygon_;
+}
+
+const std::vector<VehicleConfigHelper::SweptVolume>
+    &VehicleConfigHelper::SweptVolumeTable() {
+  if (!is_init_) {
+    Init();
+  }
+  return swept_volumes_;
+}
+
+const VehicleConfigHelper::SweptVolume &VehicleConfigHelper::GetSweptVolume(
+    double front_wheel_angle) {
+  const auto &volumes = SweptVolumeTable();
+  if (volumes.size() == 1) {
+    return volumes.front();
+  }
+  const double max_wheel_angle = volumes.back().front_wheel_angle;
+  const double step = 2.0 * max_wheel_angle /
+                      static_cast<double>(volumes.size() - 1);
+  const double clamped = common::math::Clamp(front_wheel_angle,
+                                             -max_wheel_angle,
+                                             max_wheel_angle);
+  const auto index = static_cast<size_t>(
+      std::lround((clamped + max_wheel_angle) / step));
+  return volumes[std::min(index, volumes.size() - 1)];
 }
 
 common::math::Box2d VehicleConfigHelper::GetBoundingBox(
@@ -21,12 +21,14 @@
 #pragma once
 
 #include <string>
+#include <vector>
 
 #include "modules/common/configs/proto/vehicle_config.pb.h"
 #include "modules/common/proto/pnc_point.pb.h"
 
 #include "cyber/common/macros.h"
 #include "modules/common/math/box2d.h"
+#include "modules/common/math/polygon2d.h"
 
 /**
  * @namespace apollo::common
@@ -44,6 +46,26 @@ namespace common {
  */
 class VehicleConfigHelper {
  public:
+  /**
+   * @struct SweptVolume
+   * @brief Envelope of the area the ego footprint sweeps while turning with
+   * a constant front wheel angle. The envelope is the annulus around the
+   * turn center between inner_radius and outer_radius; a point whose
+   * distance to the turn center is outside that band cannot be hit at this
+   * steering angle, which lets collision loops reject most obstacles
+   * without building any geometry.
+   */
+  struct SweptVolume {
+    /// Front wheel angle (rad), positive turns left.
+    double front_wheel_angle = 0.0;
+    /// Rear axle turn radius; infinity when driving straight.
+    double turn_radius = 0.0;
+    /// Distance from turn center to the closest swept point.
+    double inner_radius = 0.0;
+    /// Distance from turn center to the farthest swept point (corner AO).
+    double outer_radius = 0.0;
+  };
+
   /**
    * @brief Initialize vehicle configurations with default configuration file
    * pointed by gflags FLAGS_vehicle_config_path. The code will crash if
@@ -117,9 +139,40 @@ class VehicleConfigHelper {
   static common::math::Box2d GetBoundingBox(
       const common::PathPoint &path_point);
 
+  /**
+   * @brief Get the ego footprint polygon in the vehicle frame (origin at
+   * the rear axle center, x forward). Computed once at Init; hot collision
+   * loops should transform this polygon instead of rebuilding it from the
+   * raw dimensions per query.
+   * @return the precomputed footprint polygon reference.
+   */
+  static const common::math::Polygon2d &EgoPolygon();
+
+  /**
+   * @brief Get the swept-volume templates, one per front wheel angle
+   * bucket covering [-max, max] where max is
+   * max_steer_angle() / steer_ratio(). Computed once at Init.
+   * @return the precomputed template table reference.
+   */
+  static const std::vector<SweptVolume> &SweptVolumeTable();
+
+  /**
+   * @brief Get the swept-volume template of the bucket nearest to \p
+   * front_wheel_angle. Angles beyond the steering limit clamp to the
+   * boundary buckets.
+   * @param front_wheel_angle front wheel angle in radians.
+   * @return the matching template reference.
+   */
+  static const SweptVolume &GetSweptVolume(double front_wheel_angle);
+
  private:
+  static void PrecomputeGeometry();
+
   static VehicleConfig vehicle_config_;
   static bool is_init_;
+  static common::math::Polygon2d ego_polygon_;
+  static std::vector<SweptVolume> swept_volumes_;
+  static double min_safe_turn_radius_;
   DECLARE_SINGLETON(VehicleConfigHelper)
 };
 
@@ -38,6 +38,39 @@ class VehicleConfigHelperTest : public ::testing::Test {
   VehicleConfig config_;
 };
 
+TEST_F(VehicleConfigHelperTest, EgoPolygon) {
+  VehicleConfigHelper::Init(config_);
+  const auto &polygon = VehicleConfigHelper::EgoPolygon();
+  EXPECT_EQ(polygon.num_points(), 4);
+  EXPECT_TRUE(polygon.IsPointIn({1.9, 0.9}));
+  EXPECT_TRUE(polygon.IsPointIn({-0.9, -0.9}));
+  EXPECT_FALSE(polygon.IsPointIn({2.1, 0.0}));
+  EXPECT_FALSE(polygon.IsPointIn({-1.1, 0.0}));
+}
+
+TEST_F(VehicleConfigHelperTest, SweptVolume) {
+  config_.mutable_vehicle_param()->set_wheel_base(2.8);
+  config_.mutable_vehicle_param()->set_steer_ratio(16.0);
+  config_.mutable_vehicle_param()->set_max_steer_angle(8.0);
+  VehicleConfigHelper::Init(config_);
+
+  const auto &straight = VehicleConfigHelper::GetSweptVolume(0.0);
+  EXPECT_NEAR(straight.front_wheel_angle, 0.0, 1e-9);
+  EXPECT_TRUE(std::isinf(straight.turn_radius));
+
+  const double max_wheel_angle = 8.0 / 16.0;
+  const auto &left = VehicleConfigHelper::GetSweptVolume(max_wheel_angle);
+  const double radius = 2.8 / std::tan(max_wheel_angle);
+  EXPECT_DOUBLE_EQ(left.front_wheel_angle, max_wheel_angle);
+  EXPECT_DOUBLE_EQ(left.turn_radius, radius);
+  EXPECT_DOUBLE_EQ(left.inner_radius, radius - 1.0);
+  EXPECT_DOUBLE_EQ(left.outer_radius, std::hypot(radius + 1.0, 2.0));
+
+  // beyond the steering limit clamps to the boundary bucket
+  const auto &clamped = VehicleConfigHelper::GetSweptVolume(1.0);
+  EXPECT_DOUBLE_EQ(clamped.front_wheel_angle, max_wheel_angle);
+}
+
 TEST_F(VehicleConfigHelperTest, MinSafeTurnRadius) {
   config_.mutable_vehicle_param()->set_right_edge_to_center(0.5);
   config_.mutable_vehicle_param()->set_front_edge_to_center(3.0);
@@ -0,0 +1,133 @@
+/******************************************************************************
+ * Copyright 2020 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "modules/common/filters/digital_filter_bank.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "cyber/common/log.h"
+
+namespace {
+
+const double kDoubleEpsilon = 1.0e-6;
+
+}  // namespace
+
+namespace apollo {
+namespace common {
+
+void DigitalFilterBank::Init(const std::size_t num_filters,
+                             const std::size_t order) {
+  CHECK_GT(num_filters, 0U);
+  CHECK_GT(order, 0U);
+  num_filters_ = num_filters;
+  order_ = order;
+  head_ = 0;
+  denominators_.assign(num_filters_ * order_, 0.0);
+  numerators_.assign(num_filters_ * order_, 0.0);
+  x_values_.assign(num_filters_ * order_, 0.0);
+  y_values_.assign(num_filters_ * order_, 0.0);
+  dead_zones_.assign(num_filters_, 0.0);
+  last_.assign(num_filters_, 0.0);
+  x_side_.assign(num_filters_, 0.0);
+  y_side_.assign(num_filters_, 0.0);
+}
+
+bool DigitalFilterBank::set_coefficients(
+    const std::size_t index, const std::vector<double> &denominators,
+    const std::vector<double> &numerators) {
+  if (index >= num_filters_) {
+    AERROR << "Filter index " << index << " is out of range";
+    return false;
+  }
+  if (denominators.size() != order_ || numerators.size() != order_) {
+    AERROR << "Coefficient size does not match the bank order " << order_;
+    return false;
+  }
+  for (std::size_t j = 0; j < order_; ++j) {
+    denominators_[j * num_filters_ + index] = denominators[j];
+    numerators_[j * num_filters_ + index] = numerators[j];
+  }
+  return true;
+}
+
+void DigitalFilterBank::set_dead_zone(const std::size_t index,
+                                      const double deadzone) {
+  CHECK_LT(index, num_filters_);
+  dead_zones_[index] = std::fabs(deadzone);
+  AINFO << "Setting filter bank dead zone = " << dead_zones_[index]
+        << " for filter " << index;
+}
+
+bool DigitalFilterBank::Filter(const std::vector<double> &inputs,
+                               std::vector<double> *outputs) {
+  if (num_filters_ == 0) {
+    AERROR << "Filter bank is not initialized";
+    return false;
+  }
+  if (inputs.size() != num_filters_ || outputs == nullptr) {
+    AERROR << "Input size does not match the number of filters";
+    return false;
+  }
+  outputs->resize(num_filters_);
+
+  // Step the ring backwards so the oldest row becomes the latest one, then
+  // overwrite it with the new inputs.
+  head_ = (head_ + order_ - 1) % order_;
+  std::copy(inputs.begin(), inputs.end(),
+            x_values_.begin() + head_ * num_filters_);
+
+  std::fill(x_side_.begin(), x_side_.end(), 0.0);
+  std::fill(y_side_.begin(), y_side_.end(), 0.0);
+  for (std::size_t j = 0; j < order_; ++j) {
+    const std::size_t row = ((head_ + j) % order_) * num_filters_;
+    const double *num_row = &numerators_[j * num_filters_];
+    const double *x_row = &x_values_[row];
+    for (std::size_t i = 0; i < num_filters_; ++i) {
+      x_side_[i] += num_row[i] * x_row[i];
+    }
+    if (j > 0) {
+      const double *den_row = &denominators_[j * num_filters_];
+      const double *y_row = &y_values_[row];
+      for (std::size_t i = 0; i < num_filters_; ++i) {
+        y_side_[i] += den_row[i] * y_row[i];
+      }
+    }
+  }
+
+  double *y_insert_row = &y_values_[head_ * num_filters_];
+  for (std::size_t i = 0; i < num_filters_; ++i) {
+    double y_insert = 0.0;
+    if (std::fabs(denominators_[i]) > kDoubleEpsilon) {
+      y_insert = (x_side_[i] - y_side_[i]) / denominators_[i];
+    }
+    y_insert_row[i] = y_insert;
+    if (std::fabs(y_insert - last_[i]) >= dead_zones_[i]) {
+      last_[i] = y_insert;
+    }
+    (*outputs)[i] = last_[i];
+  }
+  return true;
+}
+
+void DigitalFilterBank::reset_values() {
+  std::fill(x_values_.begin(), x_values_.end(), 0.0);
+  std::fill(y_values_.begin(), y_values_.end(), 0.0);
+}
+
+}  // namespace common
+}  // namespace apollo
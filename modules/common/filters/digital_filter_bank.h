@@ -0,0 +1,127 @@
+/******************************************************************************
+ * Copyright 2020 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+/**
+ * @file
+ * @brief Defines the DigitalFilterBank class.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+/**
+ * @namespace apollo::common
+ * @brief apollo::common
+ */
+namespace apollo {
+namespace common {
+
+/**
+ * @class DigitalFilterBank
+ * @brief The DigitalFilterBank class updates several digital filters of the
+ * same order in lockstep. Filter states and coefficients are stored tap-major
+ * in contiguous blocks, so one Filter() call advances every filter with tight
+ * loops over adjacent memory, and a ring index replaces the per-sample deque
+ * shuffling of DigitalFilter. Each filter in the bank produces the same
+ * outputs as a standalone DigitalFilter with the same coefficients.
+ */
+class DigitalFilterBank {
+ public:
+  DigitalFilterBank() = default;
+
+  /**
+   * @brief Default destructor.
+   */
+  ~DigitalFilterBank() = default;
+
+  /**
+   * @brief Initializes the bank with a given size. All coefficients are
+   * zeroed; set them per filter with set_coefficients.
+   * @param num_filters The number of filters updated per Filter() call.
+   * @param order The shared tap count of denominators and numerators.
+   */
+  void Init(const std::size_t num_filters, const std::size_t order);
+
+  /**
+   * @brief set denominators and numerators of one filter in the bank.
+   * Both vectors must have exactly order() entries; shorter filters can be
+   * zero-padded at the tail by the caller.
+   * @param index The index of the filter in the bank.
+   * @param denominators The denominators of the filter.
+   * @param numerators The numerators of the filter.
+   */
+  bool set_coefficients(const std::size_t index,
+                        const std::vector<double> &denominators,
+                        const std::vector<double> &numerators);
+
+  /**
+   * @brief set deadzone of one filter in the bank
+   * @param index The index of the filter in the bank.
+   * @param deadzone The value of deadzone
+   */
+  void set_dead_zone(const std::size_t index, const double deadzone);
+
+  /**
+   * @brief Processes one new measurement per filter.
+   * @param inputs One input per filter; inputs[i] feeds filter i.
+   * @param outputs One output per filter; (*outputs)[i] is filter i's result.
+   */
+  bool Filter(const std::vector<double> &inputs, std::vector<double> *outputs);
+
+  /**
+   * @brief re-set the x and y state blocks
+   */
+  void reset_values();
+
+  /**
+   * @brief get the number of filters in the bank
+   * @return std::size_t The number of filters
+   */
+  std::size_t num_filters() const { return num_filters_; }
+
+  /**
+   * @brief get the shared filter order
+   * @return std::size_t The tap count of every filter
+   */
+  std::size_t order() const { return order_; }
+
+ private:
+  std::size_t num_filters_ = 0;
+  std::size_t order_ = 0;
+
+  // Ring index of the latest sample row; logical tap j of every filter lives
+  // in row (head_ + j) % order_.
+  std::size_t head_ = 0;
+
+  // Tap-major blocks: element [j * num_filters_ + i] is tap j of filter i.
+  std::vector<double> denominators_;
+  std::vector<double> numerators_;
+  std::vector<double> x_values_;
+  std::vector<double> y_values_;
+
+  // Per-filter threshold and last-filtered value of the deadzone.
+  std::vector<double> dead_zones_;
+  std::vector<double> last_;
+
+  // Per-filter accumulators reused across calls.
+  std::vector<double> x_side_;
+  std::vector<double> y_side_;
+};
+
+}  // namespace common
+}  // namespace apollo
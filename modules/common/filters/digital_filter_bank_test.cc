@@ -0,0 +1,113 @@
+/******************************************************************************
+ * Copyright 2020 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "modules/common/filters/digital_filter_bank.h"
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "modules/common/filters/digital_filter.h"
+
+namespace apollo {
+namespace common {
+
+class DigitalFilterBankTest : public ::testing::Test {
+ protected:
+  void SetUp() override {}
+};
+
+TEST_F(DigitalFilterBankTest, SetGet) {
+  DigitalFilterBank bank;
+  bank.Init(3, 4);
+  EXPECT_EQ(bank.num_filters(), 3U);
+  EXPECT_EQ(bank.order(), 4U);
+
+  const std::vector<double> denominators = {1.0, 0.5, 0.2, 0.1};
+  const std::vector<double> numerators = {0.2, 0.3, 0.4, 0.1};
+  EXPECT_TRUE(bank.set_coefficients(0, denominators, numerators));
+  EXPECT_FALSE(bank.set_coefficients(3, denominators, numerators));
+
+  const std::vector<double> short_coeffs = {1.0, 0.5};
+  EXPECT_FALSE(bank.set_coefficients(1, short_coeffs, short_coeffs));
+}
+
+TEST_F(DigitalFilterBankTest, MatchesDigitalFilter) {
+  const std::vector<double> denominators_one = {1.0, 0.5, 0.2};
+  const std::vector<double> numerators_one = {0.2, 0.3, 0.4};
+  const std::vector<double> denominators_two = {2.0, 0.1, 0.3};
+  const std::vector<double> numerators_two = {0.1, 0.2, 0.1};
+
+  DigitalFilter filter_one(denominators_one, numerators_one);
+  DigitalFilter filter_two(denominators_two, numerators_two);
+
+  DigitalFilterBank bank;
+  bank.Init(2, 3);
+  EXPECT_TRUE(bank.set_coefficients(0, denominators_one, numerators_one));
+  EXPECT_TRUE(bank.set_coefficients(1, denominators_two, numerators_two));
+
+  std::vector<double> inputs(2, 0.0);
+  std::vector<double> outputs;
+  for (int i = 0; i < 100; ++i) {
+    inputs[0] = 0.1 * i;
+    inputs[1] = 10.0 - 0.2 * i;
+    EXPECT_TRUE(bank.Filter(inputs, &outputs));
+    EXPECT_DOUBLE_EQ(outputs[0], filter_one.Filter(inputs[0]));
+    EXPECT_DOUBLE_EQ(outputs[1], filter_two.Filter(inputs[1]));
+  }
+
+  bank.reset_values();
+  filter_one.reset_values();
+  filter_two.reset_values();
+  inputs[0] = 1.0;
+  inputs[1] = -1.0;
+  EXPECT_TRUE(bank.Filter(inputs, &outputs));
+  EXPECT_DOUBLE_EQ(outputs[0], filter_one.Filter(inputs[0]));
+  EXPECT_DOUBLE_EQ(outputs[1], filter_two.Filter(inputs[1]));
+}
+
+TEST_F(DigitalFilterBankTest, DeadZone) {
+  const std::vector<double> denominators = {1.0, 0.0, 0.0};
+  const std::vector<double> numerators = {1.0, 0.0, 0.0};
+
+  DigitalFilter filter(denominators, numerators);
+  filter.set_dead_zone(0.5);
+
+  DigitalFilterBank bank;
+  bank.Init(1, 3);
+  EXPECT_TRUE(bank.set_coefficients(0, denominators, numerators));
+  bank.set_dead_zone(0, 0.5);
+
+  std::vector<double> outputs;
+  const std::vector<double> samples = {1.0, 1.2, 1.4, 2.5, 2.6};
+  for (const double sample : samples) {
+    EXPECT_TRUE(bank.Filter({sample}, &outputs));
+    EXPECT_DOUBLE_EQ(outputs[0], filter.Filter(sample));
+  }
+}
+
+TEST_F(DigitalFilterBankTest, Uninitialized) {
+  DigitalFilterBank bank;
+  std::vector<double> outputs;
+  EXPECT_FALSE(bank.Filter({1.0}, &outputs));
+
+  bank.Init(2, 3);
+  EXPECT_FALSE(bank.Filter({1.0}, &outputs));
+  EXPECT_FALSE(bank.Filter({1.0, 2.0}, nullptr));
+}
+
+}  // namespace common
+}  // namespace apollo
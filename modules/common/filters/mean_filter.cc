@@ -32,6 +32,7 @@ const uint8 kMaxWindowSize = std::numeric_limits<uint8>::max() / 2;
 MF::MeanFilter(const uint8 window_size) : window_size_(window_size) {
   CHECK_GT(window_size_, 0);
   CHECK_LE(window_size_, kMaxWindowSize);
+  values_.resize(window_size_, 0.0);
   initialized_ = true;
 }
 
@@ -53,20 +54,19 @@ double MF::GetMax() const {
 
 double MF::Update(const double measurement) {
   ACHECK(initialized_);
-  CHECK_LE(values_.size(), window_size_);
+  CHECK_LE(count_, window_size_);
   CHECK_LE(min_candidates_.size(), window_size_);
   CHECK_LE(max_candidates_.size(), window_size_);
   ++time_;
   time_ %= static_cast<std::uint_fast8_t>(2 * window_size_);
-  if (values_.size() == window_size_) {
+  if (count_ == window_size_) {
     RemoveEarliest();
   }
   Insert(measurement);
-  if (values_.size() > 2) {
-    return (sum_ - GetMin() - GetMax()) /
-           static_cast<double>(values_.size() - 2);
+  if (count_ > 2) {
+    return (sum_ - GetMin() - GetMax()) / static_cast<double>(count_ - 2);
   } else {
-    return sum_ / static_cast<double>(values_.size());
+    return sum_ / static_cast<double>(count_);
   }
 }
 
@@ -83,9 +83,10 @@ bool MF::ShouldPopOldestCandidate(const uint8 old_time) const {
 }
 
 void MF::RemoveEarliest() {
-  CHECK_EQ(values_.size(), window_size_);
-  double removed = values_.front();
-  values_.pop_front();
+  CHECK_EQ(count_, window_size_);
+  double removed = values_[head_];
+  head_ = static_cast<uint8>((head_ + 1) % window_size_);
+  --count_;
   sum_ -= removed;
   if (ShouldPopOldestCandidate(min_candidates_.front().first)) {
     min_candidates_.pop_front();
@@ -96,7 +97,8 @@ void MF::RemoveEarliest() {
 }
 
 void MF::Insert(const double value) {
-  values_.push_back(value);
+  values_[static_cast<uint8>((head_ + count_) % window_size_)] = value;
+  ++count_;
   sum_ += value;
   while (min_candidates_.size() > 0 && min_candidates_.back().second > value) {
     min_candidates_.pop_back();
@@ -73,8 +73,10 @@ class MeanFilter {
   std::uint_fast8_t window_size_ = 0;
   double sum_ = 0.0;
   std::uint_fast8_t time_ = 0;
-  // front = earliest
-  std::deque<double> values_;
+  // fixed-capacity ring over the window; head_ indexes the earliest sample
+  std::vector<double> values_;
+  std::uint_fast8_t head_ = 0;
+  std::uint_fast8_t count_ = 0;
   // front = min
   std::deque<std::pair<std::uint_fast8_t, double>> min_candidates_;
   // front = max
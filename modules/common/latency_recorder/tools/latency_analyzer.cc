@@ -0,0 +1,169 @@
+/******************************************************************************
+ * Copyright 2020 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+/**
+ * @file
+ * @brief a command line tool which subscribes to the latency recording
+ * channel, groups records by message id (the sensor timestamp carried in
+ * message headers across the chain) and reports per-stage and end-to-end
+ * latency distributions, flagging traces above a spike threshold.
+ */
+
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "cyber/cyber.h"
+#include "modules/common/adapters/adapter_gflags.h"
+#include "modules/common/latency_recorder/proto/latency_record.pb.h"
+
+DEFINE_double(latency_report_interval, 10.0,
+              "seconds between two printed latency reports");
+DEFINE_double(latency_spike_threshold_ms, 300.0,
+              "end-to-end latency above which a trace is reported in detail");
+
+namespace apollo {
+namespace common {
+namespace {
+
+// Time span of one processing stage, in nanoseconds since the unix epoch.
+struct StageSpan {
+  uint64_t begin_ns = 0;
+  uint64_t end_ns = 0;
+};
+
+class LatencyAnalyzer {
+ public:
+  void OnLatencyRecordMap(const std::shared_ptr<LatencyRecordMap> &records) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (const auto &record : records->latency_records()) {
+      if (record.message_id() == 0 ||
+          record.end_time() <= record.begin_time()) {
+        continue;
+      }
+      const double duration_ms =
+          static_cast<double>(record.end_time() - record.begin_time()) * 1e-6;
+      stage_durations_ms_[records->module_name()].push_back(duration_ms);
+      auto &span = traces_[record.message_id()][records->module_name()];
+      span.begin_ns = record.begin_time();
+      span.end_ns = record.end_time();
+    }
+  }
+
+  void PrintReport() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::cout << "====== latency report ======" << std::endl;
+    for (auto &stage : stage_durations_ms_) {
+      PrintDistribution(stage.first, &stage.second);
+    }
+
+    std::vector<double> end_to_end_ms;
+    std::vector<uint64_t> spikes;
+    for (const auto &trace : traces_) {
+      if (trace.second.size() < 2) {
+        continue;
+      }
+      uint64_t begin_ns = UINT64_MAX;
+      uint64_t end_ns = 0;
+      for (const auto &stage : trace.second) {
+        begin_ns = std::min(begin_ns, stage.second.begin_ns);
+        end_ns = std::max(end_ns, stage.second.end_ns);
+      }
+      const double span_ms = static_cast<double>(end_ns - begin_ns) * 1e-6;
+      end_to_end_ms.push_back(span_ms);
+      if (span_ms > FLAGS_latency_spike_threshold_ms) {
+        spikes.push_back(trace.first);
+      }
+    }
+    PrintDistribution("end_to_end", &end_to_end_ms);
+
+    for (const uint64_t message_id : spikes) {
+      std::cout << "spike trace " << message_id << ":" << std::endl;
+      for (const auto &stage : traces_[message_id]) {
+        const auto &span = stage.second;
+        std::cout << "  " << std::left << std::setw(40) << stage.first
+                  << " begin +"
+                  << static_cast<double>(span.begin_ns - message_id) * 1e-6
+                  << " ms, took "
+                  << static_cast<double>(span.end_ns - span.begin_ns) * 1e-6
+                  << " ms" << std::endl;
+      }
+    }
+
+    stage_durations_ms_.clear();
+    traces_.clear();
+  }
+
+ private:
+  static void PrintDistribution(const std::string &name,
+                                std::vector<double> *durations_ms) {
+    if (durations_ms->empty()) {
+      return;
+    }
+    std::sort(durations_ms->begin(), durations_ms->end());
+    const auto percentile = [durations_ms](const double p) {
+      const size_t index = std::min(
+          durations_ms->size() - 1,
+          static_cast<size_t>(p * static_cast<double>(durations_ms->size())));
+      return (*durations_ms)[index];
+    };
+    double sum = 0.0;
+    for (const double duration : *durations_ms) {
+      sum += duration;
+    }
+    std::cout << std::left << std::setw(40) << name << " count "
+              << std::setw(6) << durations_ms->size() << std::fixed
+              << std::setprecision(3) << " mean "
+              << sum / static_cast<double>(durations_ms->size()) << " p50 "
+              << percentile(0.5) << " p90 " << percentile(0.9) << " p99 "
+              << percentile(0.99) << " max " << durations_ms->back() << " ms"
+              << std::endl;
+  }
+
+  std::mutex mutex_;
+  std::map<std::string, std::vector<double>> stage_durations_ms_;
+  std::map<uint64_t, std::map<std::string, StageSpan>> traces_;
+};
+
+}  // namespace
+}  // namespace common
+}  // namespace apollo
+
+int main(int argc, char **argv) {
+  google::ParseCommandLineFlags(&argc, &argv, true);
+  apollo::cyber::Init(argv[0]);
+
+  apollo::common::LatencyAnalyzer analyzer;
+  const auto node = apollo::cyber::CreateNode("latency_analyzer");
+  const auto reader = node->CreateReader<apollo::common::LatencyRecordMap>(
+      FLAGS_latency_recording_topic,
+      [&analyzer](
+          const std::shared_ptr<apollo::common::LatencyRecordMap> &records) {
+        analyzer.OnLatencyRecordMap(records);
+      });
+
+  while (apollo::cyber::OK()) {
+    apollo::cyber::Duration(FLAGS_latency_report_interval).Sleep();
+    analyzer.PrintReport();
+  }
+  return 0;
+}
@@ -22,8 +22,11 @@
 #pragma once
 
 #include <algorithm>
+#include <future>
 #include <limits>
 #include <memory>
+#include <queue>
+#include <utility>
 #include <vector>
 
 #include "cyber/common/log.h"
@@ -52,6 +55,34 @@ struct AABoxKDTreeParams {
   double max_leaf_dimension = -1.0;
 };
 
+/**
+ * @struct AABoxKDTree2dFlatNode
+ * @brief A KD-tree node in the flattened layout used for queries. All nodes
+ *        of a tree live in one contiguous array and reference their
+ *        sub-nodes by index, so traversals stay within warm cache lines
+ *        instead of chasing individually allocated nodes.
+ */
+struct AABoxKDTree2dFlatNode {
+  // Boundary of the node.
+  double min_x = 0.0;
+  double max_x = 0.0;
+  double min_y = 0.0;
+  double max_y = 0.0;
+  double mid_x = 0.0;
+  double mid_y = 0.0;
+
+  double partition_position = 0.0;
+  bool is_partition_x = true;
+
+  // Range of the node's own objects in the flattened object arrays.
+  int objects_begin = 0;
+  int num_objects = 0;
+
+  // Indices of the sub-nodes in the flattened node array; -1 if absent.
+  int left_subnode = -1;
+  int right_subnode = -1;
+};
+
 /**
  * @class AABoxKDTree2dNode
  * @brief The class of KD-tree node of axis-aligned bounding box.
@@ -80,14 +111,30 @@ class AABoxKDTree2dNode {
       std::vector<ObjectPtr> right_subnode_objects;
       PartitionObjects(objects, &left_subnode_objects, &right_subnode_objects);
 
-      // Split to sub-nodes.
-      if (!left_subnode_objects.empty()) {
-        left_subnode_.reset(new AABoxKDTree2dNode<ObjectType>(
-            left_subnode_objects, params, depth + 1));
-      }
-      if (!right_subnode_objects.empty()) {
+      // Split to sub-nodes. Near the root the two subtrees are built
+      // concurrently; they partition disjoint object sets, so they share no
+      // state. Deeper levels stay sequential to bound the thread count.
+      constexpr int kMaxParallelDepth = 2;
+      if (depth < kMaxParallelDepth && !left_subnode_objects.empty() &&
+          !right_subnode_objects.empty()) {
+        auto left_future =
+            std::async(std::launch::async, [&left_subnode_objects, &params,
+                                            depth]() {
+              return new AABoxKDTree2dNode<ObjectType>(left_subnode_objects,
+                                                       params, depth + 1);
+            });
         right_subnode_.reset(new AABoxKDTree2dNode<ObjectType>(
             right_subnode_objects, params, depth + 1));
+        left_subnode_.reset(left_future.get());
+      } else {
+        if (!left_subnode_objects.empty()) {
+          left_subnode_.reset(new AABoxKDTree2dNode<ObjectType>(
+              left_subnode_objects, params, depth + 1));
+        }
+        if (!right_subnode_objects.empty()) {
+          right_subnode_.reset(new AABoxKDTree2dNode<ObjectType>(
+              right_subnode_objects, params, depth + 1));
+        }
       }
     } else {
       InitObjects(objects);
@@ -129,6 +176,66 @@ class AABoxKDTree2dNode {
     return AABox2d({min_x_, min_y_}, {max_x_, max_y_});
   }
 
+  /**
+   * @brief Append this node and its sub-nodes to a flattened tree in
+   *        depth-first pre-order. The per-node sorted object lists are
+   *        concatenated into the shared flat arrays.
+   * @param nodes The flattened node array to append to.
+   * @param objects_by_min Flat array of objects sorted by min bound.
+   * @param objects_by_max Flat array of objects sorted by max bound.
+   * @param bounds_by_min Flat array of min bounds, parallel to
+   *        objects_by_min.
+   * @param bounds_by_max Flat array of max bounds, parallel to
+   *        objects_by_max.
+   * @return The index of this node in the flattened node array.
+   */
+  int Flatten(std::vector<AABoxKDTree2dFlatNode> *const nodes,
+              std::vector<ObjectPtr> *const objects_by_min,
+              std::vector<ObjectPtr> *const objects_by_max,
+              std::vector<double> *const bounds_by_min,
+              std::vector<double> *const bounds_by_max) const {
+    const int index = static_cast<int>(nodes->size());
+    nodes->emplace_back();
+    AABoxKDTree2dFlatNode &flat_node = nodes->back();
+    flat_node.min_x = min_x_;
+    flat_node.max_x = max_x_;
+    flat_node.min_y = min_y_;
+    flat_node.max_y = max_y_;
+    flat_node.mid_x = mid_x_;
+    flat_node.mid_y = mid_y_;
+    flat_node.partition_position = partition_position_;
+    flat_node.is_partition_x = (partition_ == PARTITION_X);
+    flat_node.objects_begin = static_cast<int>(objects_by_min->size());
+    flat_node.num_objects = num_objects_;
+    objects_by_min->insert(objects_by_min->end(),
+                           objects_sorted_by_min_.begin(),
+                           objects_sorted_by_min_.end());
+    objects_by_max->insert(objects_by_max->end(),
+                           objects_sorted_by_max_.begin(),
+                           objects_sorted_by_max_.end());
+    bounds_by_min->insert(bounds_by_min->end(),
+                          objects_sorted_by_min_bound_.begin(),
+                          objects_sorted_by_min_bound_.end());
+    bounds_by_max->insert(bounds_by_max->end(),
+                          objects_sorted_by_max_bound_.begin(),
+                          objects_sorted_by_max_bound_.end());
+    // Sub-node recursion may reallocate the node array, so the sub-node
+    // indices are written back through the array afterwards.
+    int left_subnode_index = -1;
+    int right_subnode_index = -1;
+    if (left_subnode_ != nullptr) {
+      left_subnode_index = left_subnode_->Flatten(
+          nodes, objects_by_min, objects_by_max, bounds_by_min, bounds_by_max);
+    }
+    if (right_subnode_ != nullptr) {
+      right_subnode_index = right_subnode_->Flatten(
+          nodes, objects_by_min, objects_by_max, bounds_by_min, bounds_by_max);
+    }
+    (*nodes)[index].left_subnode = left_subnode_index;
+    (*nodes)[index].right_subnode = right_subnode_index;
+    return index;
+  }
+
  private:
   void InitObjects(const std::vector<ObjectPtr> &objects) {
     num_objects_ = static_cast<int>(objects.size());
@@ -409,7 +516,9 @@ class AABoxKDTree2dNode {
 
 /**
  * @class AABoxKDTree2d
- * @brief The class of KD-tree of Aligned Axis Bounding Box(AABox).
+ * @brief The class of KD-tree of Aligned Axis Bounding Box(AABox). The tree
+ *        is built with AABoxKDTree2dNode and then flattened into contiguous
+ *        arrays, which all queries run against.
  */
 template <class ObjectType>
 class AABoxKDTree2d {
@@ -427,7 +536,13 @@ class AABoxKDTree2d {
       for (const auto &object : objects) {
         object_ptrs.push_back(&object);
       }
-      root_.reset(new AABoxKDTree2dNode<ObjectType>(object_ptrs, params, 0));
+      const AABoxKDTree2dNode<ObjectType> root(object_ptrs, params, 0);
+      objects_by_min_.reserve(object_ptrs.size());
+      objects_by_max_.reserve(object_ptrs.size());
+      bounds_by_min_.reserve(object_ptrs.size());
+      bounds_by_max_.reserve(object_ptrs.size());
+      root.Flatten(&nodes_, &objects_by_min_, &objects_by_max_,
+                   &bounds_by_min_, &bounds_by_max_);
     }
   }
 
@@ -437,7 +552,35 @@ class AABoxKDTree2d {
    * @return The nearest object to the target point.
    */
   ObjectPtr GetNearestObject(const Vec2d &point) const {
-    return root_ == nullptr ? nullptr : root_->GetNearestObject(point);
+    ObjectPtr nearest_object = nullptr;
+    if (!nodes_.empty()) {
+      double min_distance_sqr = std::numeric_limits<double>::infinity();
+      GetNearestObjectInternal(0, point, &min_distance_sqr, &nearest_object);
+    }
+    return nearest_object;
+  }
+
+  /**
+   * @brief Get the k nearest objects to a target point, ordered by
+   *        increasing distance.
+   * @param point The target point. Search its nearest objects.
+   * @param k The maximum number of objects to return.
+   * @return Up to k objects nearest to the target point.
+   */
+  std::vector<ObjectPtr> GetKNearestObjects(const Vec2d &point,
+                                            const size_t k) const {
+    std::vector<ObjectPtr> result_objects;
+    if (nodes_.empty() || k == 0) {
+      return result_objects;
+    }
+    std::priority_queue<std::pair<double, ObjectPtr>> nearest_objects;
+    GetKNearestObjectsInternal(0, point, k, &nearest_objects);
+    result_objects.resize(nearest_objects.size());
+    for (size_t i = nearest_objects.size(); i > 0; --i) {
+      result_objects[i - 1] = nearest_objects.top().second;
+      nearest_objects.pop();
+    }
+    return result_objects;
   }
 
   /**
@@ -448,10 +591,12 @@ class AABoxKDTree2d {
    */
   std::vector<ObjectPtr> GetObjects(const Vec2d &point,
                                     const double distance) const {
-    if (root_ == nullptr) {
-      return {};
+    std::vector<ObjectPtr> result_objects;
+    if (!nodes_.empty()) {
+      GetObjectsInternal(0, point, distance, Square(distance),
+                         &result_objects);
     }
-    return root_->GetObjects(point, distance);
+    return result_objects;
   }
 
   /**
@@ -459,11 +604,219 @@ class AABoxKDTree2d {
    * @return The axis-aligned bounding box of the objects.
    */
   AABox2d GetBoundingBox() const {
-    return root_ == nullptr ? AABox2d() : root_->GetBoundingBox();
+    if (nodes_.empty()) {
+      return AABox2d();
+    }
+    return AABox2d({nodes_[0].min_x, nodes_[0].min_y},
+                   {nodes_[0].max_x, nodes_[0].max_y});
+  }
+
+ private:
+  static double LowerDistanceSquareToPoint(const AABoxKDTree2dFlatNode &node,
+                                           const Vec2d &point) {
+    double dx = 0.0;
+    if (point.x() < node.min_x) {
+      dx = node.min_x - point.x();
+    } else if (point.x() > node.max_x) {
+      dx = point.x() - node.max_x;
+    }
+    double dy = 0.0;
+    if (point.y() < node.min_y) {
+      dy = node.min_y - point.y();
+    } else if (point.y() > node.max_y) {
+      dy = point.y() - node.max_y;
+    }
+    return dx * dx + dy * dy;
+  }
+
+  static double UpperDistanceSquareToPoint(const AABoxKDTree2dFlatNode &node,
+                                           const Vec2d &point) {
+    const double dx = (point.x() > node.mid_x ? (point.x() - node.min_x)
+                                              : (point.x() - node.max_x));
+    const double dy = (point.y() > node.mid_y ? (point.y() - node.min_y)
+                                              : (point.y() - node.max_y));
+    return dx * dx + dy * dy;
+  }
+
+  void GetAllObjects(const int node_index,
+                     std::vector<ObjectPtr> *const result_objects) const {
+    const AABoxKDTree2dFlatNode &node = nodes_[node_index];
+    result_objects->insert(
+        result_objects->end(),
+        objects_by_min_.begin() + node.objects_begin,
+        objects_by_min_.begin() + node.objects_begin + node.num_objects);
+    if (node.left_subnode >= 0) {
+      GetAllObjects(node.left_subnode, result_objects);
+    }
+    if (node.right_subnode >= 0) {
+      GetAllObjects(node.right_subnode, result_objects);
+    }
+  }
+
+  void GetObjectsInternal(const int node_index, const Vec2d &point,
+                          const double distance, const double distance_sqr,
+                          std::vector<ObjectPtr> *const result_objects) const {
+    const AABoxKDTree2dFlatNode &node = nodes_[node_index];
+    if (LowerDistanceSquareToPoint(node, point) > distance_sqr) {
+      return;
+    }
+    if (UpperDistanceSquareToPoint(node, point) <= distance_sqr) {
+      GetAllObjects(node_index, result_objects);
+      return;
+    }
+    const double pvalue = (node.is_partition_x ? point.x() : point.y());
+    if (pvalue < node.partition_position) {
+      const double limit = pvalue + distance;
+      for (int i = 0; i < node.num_objects; ++i) {
+        if (bounds_by_min_[node.objects_begin + i] > limit) {
+          break;
+        }
+        ObjectPtr object = objects_by_min_[node.objects_begin + i];
+        if (object->DistanceSquareTo(point) <= distance_sqr) {
+          result_objects->push_back(object);
+        }
+      }
+    } else {
+      const double limit = pvalue - distance;
+      for (int i = 0; i < node.num_objects; ++i) {
+        if (bounds_by_max_[node.objects_begin + i] < limit) {
+          break;
+        }
+        ObjectPtr object = objects_by_max_[node.objects_begin + i];
+        if (object->DistanceSquareTo(point) <= distance_sqr) {
+          result_objects->push_back(object);
+        }
+      }
+    }
+    if (node.left_subnode >= 0) {
+      GetObjectsInternal(node.left_subnode, point, distance, distance_sqr,
+                         result_objects);
+    }
+    if (node.right_subnode >= 0) {
+      GetObjectsInternal(node.right_subnode, point, distance, distance_sqr,
+                         result_objects);
+    }
+  }
+
+  void GetNearestObjectInternal(const int node_index, const Vec2d &point,
+                                double *const min_distance_sqr,
+                                ObjectPtr *const nearest_object) const {
+    const AABoxKDTree2dFlatNode &node = nodes_[node_index];
+    if (LowerDistanceSquareToPoint(node, point) >=
+        *min_distance_sqr - kMathEpsilon) {
+      return;
+    }
+    const double pvalue = (node.is_partition_x ? point.x() : point.y());
+    const bool search_left_first = (pvalue < node.partition_position);
+    const int near_subnode =
+        (search_left_first ? node.left_subnode : node.right_subnode);
+    const int far_subnode =
+        (search_left_first ? node.right_subnode : node.left_subnode);
+    if (near_subnode >= 0) {
+      GetNearestObjectInternal(near_subnode, point, min_distance_sqr,
+                               nearest_object);
+    }
+    if (*min_distance_sqr <= kMathEpsilon) {
+      return;
+    }
+
+    if (search_left_first) {
+      for (int i = 0; i < node.num_objects; ++i) {
+        const double bound = bounds_by_min_[node.objects_begin + i];
+        if (bound > pvalue && Square(bound - pvalue) > *min_distance_sqr) {
+          break;
+        }
+        ObjectPtr object = objects_by_min_[node.objects_begin + i];
+        const double distance_sqr = object->DistanceSquareTo(point);
+        if (distance_sqr < *min_distance_sqr) {
+          *min_distance_sqr = distance_sqr;
+          *nearest_object = object;
+        }
+      }
+    } else {
+      for (int i = 0; i < node.num_objects; ++i) {
+        const double bound = bounds_by_max_[node.objects_begin + i];
+        if (bound < pvalue && Square(bound - pvalue) > *min_distance_sqr) {
+          break;
+        }
+        ObjectPtr object = objects_by_max_[node.objects_begin + i];
+        const double distance_sqr = object->DistanceSquareTo(point);
+        if (distance_sqr < *min_distance_sqr) {
+          *min_distance_sqr = distance_sqr;
+          *nearest_object = object;
+        }
+      }
+    }
+    if (*min_distance_sqr <= kMathEpsilon) {
+      return;
+    }
+    if (far_subnode >= 0) {
+      GetNearestObjectInternal(far_subnode, point, min_distance_sqr,
+                               nearest_object);
+    }
+  }
+
+  void GetKNearestObjectsInternal(
+      const int node_index, const Vec2d &point, const size_t k,
+      std::priority_queue<std::pair<double, ObjectPtr>> *const nearest_objects)
+      const {
+    const AABoxKDTree2dFlatNode &node = nodes_[node_index];
+    // Until k candidates are collected every object qualifies, so pruning
+    // only starts once the queue is full.
+    const double pruning_distance_sqr =
+        (nearest_objects->size() >= k
+             ? nearest_objects->top().first
+             : std::numeric_limits<double>::infinity());
+    if (LowerDistanceSquareToPoint(node, point) >=
+        pruning_distance_sqr - kMathEpsilon) {
+      return;
+    }
+    const double pvalue = (node.is_partition_x ? point.x() : point.y());
+    const bool search_left_first = (pvalue < node.partition_position);
+    const int near_subnode =
+        (search_left_first ? node.left_subnode : node.right_subnode);
+    const int far_subnode =
+        (search_left_first ? node.right_subnode : node.left_subnode);
+    if (near_subnode >= 0) {
+      GetKNearestObjectsInternal(near_subnode, point, k, nearest_objects);
+    }
+
+    for (int i = 0; i < node.num_objects; ++i) {
+      const double bound = (search_left_first
+                                ? bounds_by_min_[node.objects_begin + i]
+                                : bounds_by_max_[node.objects_begin + i]);
+      if (nearest_objects->size() >= k) {
+        const double worst_distance_sqr = nearest_objects->top().first;
+        if (search_left_first
+                ? (bound > pvalue &&
+                   Square(bound - pvalue) > worst_distance_sqr)
+                : (bound < pvalue &&
+                   Square(bound - pvalue) > worst_distance_sqr)) {
+          break;
+        }
+      }
+      ObjectPtr object = (search_left_first
+                              ? objects_by_min_[node.objects_begin + i]
+                              : objects_by_max_[node.objects_begin + i]);
+      const double distance_sqr = object->DistanceSquareTo(point);
+      if (nearest_objects->size() < k) {
+        nearest_objects->emplace(distance_sqr, object);
+      } else if (distance_sqr < nearest_objects->top().first) {
+        nearest_objects->pop();
+        nearest_objects->emplace(distance_sqr, object);
+      }
+    }
+    if (far_subnode >= 0) {
+      GetKNearestObjectsInternal(far_subnode, point, k, nearest_objects);
+    }
   }
 
  private:
-  std::unique_ptr<AABoxKDTree2dNode<ObjectType>> root_ = nullptr;
+  std::vector<AABoxKDTree2dFlatNode> nodes_;
+  std::vector<ObjectPtr> objects_by_min_;
+  std::vector<ObjectPtr> objects_by_max_;
+  std::vector<double> bounds_by_min_;
+  std::vector<double> bounds_by_max_;
 };
 
 }  // namespace math
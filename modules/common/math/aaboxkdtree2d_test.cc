@@ -16,6 +16,7 @@
 
 #include "modules/common/math/aaboxkdtree2d.h"
 
+#include <algorithm>
 #include <string>
 
 #include "gtest/gtest.h"
@@ -90,6 +91,25 @@ TEST(AABoxKDTree2dNode, OverallTests) {
         EXPECT_NEAR(actual_distance, expected_distance, 1e-3);
       }
     }
+    for (int i = 0; i < kNumQueries; ++i) {
+      const Vec2d point(RandomDouble(-kSize * 1.5, kSize * 1.5),
+                        RandomDouble(-kSize * 1.5, kSize * 1.5));
+      std::vector<double> expected_distances;
+      for (const auto &object : objects) {
+        expected_distances.push_back(object.DistanceTo(point));
+      }
+      std::sort(expected_distances.begin(), expected_distances.end());
+      const size_t num_nearest = std::min<size_t>(5, objects.size());
+      for (int k = 0; k < kNumTrees; ++k) {
+        std::vector<const Object *> nearest_objects =
+            kdtrees[k]->GetKNearestObjects(point, 5);
+        EXPECT_EQ(nearest_objects.size(), num_nearest);
+        for (size_t j = 0; j < nearest_objects.size(); ++j) {
+          EXPECT_NEAR(nearest_objects[j]->DistanceTo(point),
+                      expected_distances[j], 1e-3);
+        }
+      }
+    }
     for (int i = 0; i < kNumQueries; ++i) {
       const Vec2d point(RandomDouble(-kSize * 1.5, kSize * 1.5),
                         RandomDouble(-kSize * 1.5, kSize * 1.5));
@@ -19,6 +19,7 @@
 #include <cmath>
 
 #include "cyber/common/log.h"
+#include "modules/common/math/fast_math.h"
 #include "modules/common/math/math_utils.h"
 
 namespace apollo {
@@ -83,6 +84,58 @@ void CartesianFrenetConverter::cartesian_to_frenet(
   *ptr_s = rs;
 }
 
+void CartesianFrenetConverter::batch_cartesian_to_frenet(
+    const std::vector<CartesianState>& states,
+    std::vector<FrenetState>* const results) {
+  CHECK_NOTNULL(results);
+  const size_t n = states.size();
+  results->resize(n);
+  for (size_t i = 0; i < n; ++i) {
+    const CartesianState& in = states[i];
+    FrenetState& out = (*results)[i];
+
+    const double dx = in.x - in.rx;
+    const double dy = in.y - in.ry;
+
+    double cos_theta_r = 0.0;
+    double sin_theta_r = 0.0;
+    FastSinCos(in.rtheta, &sin_theta_r, &cos_theta_r);
+
+    const double cross_rd_nd = cos_theta_r * dy - sin_theta_r * dx;
+    out.d_condition[0] =
+        std::copysign(std::sqrt(dx * dx + dy * dy), cross_rd_nd);
+
+    const double delta_theta = in.theta - in.rtheta;
+    double sin_delta_theta = 0.0;
+    double cos_delta_theta = 0.0;
+    FastSinCos(delta_theta, &sin_delta_theta, &cos_delta_theta);
+    const double tan_delta_theta = sin_delta_theta / cos_delta_theta;
+
+    const double one_minus_kappa_r_d = 1 - in.rkappa * out.d_condition[0];
+    out.d_condition[1] = one_minus_kappa_r_d * tan_delta_theta;
+
+    const double kappa_r_d_prime =
+        in.rdkappa * out.d_condition[0] + in.rkappa * out.d_condition[1];
+
+    out.d_condition[2] =
+        -kappa_r_d_prime * tan_delta_theta +
+        one_minus_kappa_r_d / cos_delta_theta / cos_delta_theta *
+            (in.kappa * one_minus_kappa_r_d / cos_delta_theta - in.rkappa);
+
+    out.s_condition[0] = in.rs;
+
+    out.s_condition[1] = in.v * cos_delta_theta / one_minus_kappa_r_d;
+
+    const double delta_theta_prime =
+        one_minus_kappa_r_d / cos_delta_theta * in.kappa - in.rkappa;
+    out.s_condition[2] =
+        (in.a * cos_delta_theta -
+         out.s_condition[1] * out.s_condition[1] *
+             (out.d_condition[1] * delta_theta_prime - kappa_r_d_prime)) /
+        one_minus_kappa_r_d;
+  }
+}
+
 void CartesianFrenetConverter::frenet_to_cartesian(
     const double rs, const double rx, const double ry, const double rtheta,
     const double rkappa, const double rdkappa,
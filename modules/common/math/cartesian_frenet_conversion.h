@@ -21,6 +21,7 @@
 #pragma once
 
 #include <array>
+#include <vector>
 
 #include "modules/common/math/vec2d.h"
 
@@ -62,6 +63,37 @@ class CartesianFrenetConverter {
                                   const double x, const double y, double* ptr_s,
                                   double* ptr_d);
 
+  // Inputs of one full cartesian_to_frenet conversion: the matched
+  // reference point (r*) and the vehicle state.
+  struct CartesianState {
+    double rs = 0.0;
+    double rx = 0.0;
+    double ry = 0.0;
+    double rtheta = 0.0;
+    double rkappa = 0.0;
+    double rdkappa = 0.0;
+    double x = 0.0;
+    double y = 0.0;
+    double v = 0.0;
+    double a = 0.0;
+    double theta = 0.0;
+    double kappa = 0.0;
+  };
+
+  struct FrenetState {
+    std::array<double, 3> s_condition = {{0.0, 0.0, 0.0}};
+    std::array<double, 3> d_condition = {{0.0, 0.0, 0.0}};
+  };
+
+  /**
+   * Convert a batch of Cartesian states to Frenet frame in one call,
+   * using the fast trigonometric kernels in fast_math.h. Results match
+   * cartesian_to_frenet up to the accuracy bounds documented there.
+   */
+  static void batch_cartesian_to_frenet(
+      const std::vector<CartesianState>& states,
+      std::vector<FrenetState>* const results);
+
   /**
    * Convert a vehicle state in Frenet frame to Cartesian frame.
    * Combine two independent 1d movement w.r.t. reference line to a 2d movement.
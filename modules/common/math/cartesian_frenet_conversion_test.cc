@@ -18,6 +18,7 @@
 
 #include <array>
 #include <cmath>
+#include <vector>
 
 #include "gtest/gtest.h"
 
@@ -65,6 +66,43 @@ TEST(TestCartesianFrenetConversion, cartesian_to_frenet_test) {
   EXPECT_NEAR(a, a_out, 1.0e-6);
 }
 
+TEST(TestCartesianFrenetConversion, batch_cartesian_to_frenet_test) {
+  std::vector<CartesianFrenetConverter::CartesianState> states;
+  for (int i = 0; i < 100; ++i) {
+    CartesianFrenetConverter::CartesianState state;
+    state.rs = 10.0 + 0.1 * i;
+    state.rx = 0.1 * i;
+    state.ry = -0.05 * i;
+    state.rtheta = M_PI / 4.0 + 0.01 * i;
+    state.rkappa = 0.1;
+    state.rdkappa = 0.01;
+    state.x = state.rx - 1.0;
+    state.y = state.ry + 1.0;
+    state.v = 2.0;
+    state.a = 0.3;
+    state.theta = state.rtheta + 0.1;
+    state.kappa = 0.11;
+    states.push_back(state);
+  }
+
+  std::vector<CartesianFrenetConverter::FrenetState> results;
+  CartesianFrenetConverter::batch_cartesian_to_frenet(states, &results);
+  ASSERT_EQ(states.size(), results.size());
+
+  for (size_t i = 0; i < states.size(); ++i) {
+    const auto& in = states[i];
+    std::array<double, 3> s_conditions;
+    std::array<double, 3> d_conditions;
+    CartesianFrenetConverter::cartesian_to_frenet(
+        in.rs, in.rx, in.ry, in.rtheta, in.rkappa, in.rdkappa, in.x, in.y, in.v,
+        in.a, in.theta, in.kappa, &s_conditions, &d_conditions);
+    for (int k = 0; k < 3; ++k) {
+      EXPECT_NEAR(s_conditions[k], results[i].s_condition[k], 1.0e-9);
+      EXPECT_NEAR(d_conditions[k], results[i].d_condition[k], 1.0e-9);
+    }
+  }
+}
+
 }  // namespace math
 }  // namespace common
 }  // namespace apollo
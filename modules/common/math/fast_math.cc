@@ -0,0 +1,178 @@
+/******************************************************************************
+ * Copyright 2019 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "modules/common/math/fast_math.h"
+
+#include <cmath>
+#include <cstdint>
+
+namespace apollo {
+namespace common {
+namespace math {
+
+namespace {
+
+// Three-term Cody-Waite split of pi / 2 (fdlibm constants), so the range
+// reduction x - k * pi / 2 stays accurate for |k| up to ~2^20.
+constexpr double kTwoOverPi = 6.36619772367581382433e-01;
+constexpr double kPiOverTwo1 = 1.57079632673412561417e+00;
+constexpr double kPiOverTwo2 = 6.07710050650619224932e-11;
+constexpr double kPiOverTwo3 = 2.02226624879595063154e-21;
+
+// Minimax polynomials on [-pi / 4, pi / 4] (Cephes sin / cos coefficients).
+double SinPoly(const double r) {
+  const double z = r * r;
+  double p = 1.58962301576546568060e-10;
+  p = p * z - 2.50507477628578072866e-8;
+  p = p * z + 2.75573136213857245213e-6;
+  p = p * z - 1.98412698295895385996e-4;
+  p = p * z + 8.33333333332211858878e-3;
+  p = p * z - 1.66666666666666307295e-1;
+  return r + r * z * p;
+}
+
+double CosPoly(const double r) {
+  const double z = r * r;
+  double p = -1.13585365213876817300e-11;
+  p = p * z + 2.08757008419747316778e-9;
+  p = p * z - 2.75573141792967388112e-7;
+  p = p * z + 2.48015872888517179954e-5;
+  p = p * z - 1.38888888888730564116e-3;
+  p = p * z + 4.16666666666665929218e-2;
+  return 1.0 - 0.5 * z + z * z * p;
+}
+
+// Reduces x to r in [-pi / 4, pi / 4] and returns the quadrant index.
+uint64_t ReduceAngle(const double x, double *const r) {
+  const double k = std::floor(x * kTwoOverPi + 0.5);
+  *r = ((x - k * kPiOverTwo1) - k * kPiOverTwo2) - k * kPiOverTwo3;
+  return static_cast<uint64_t>(static_cast<int64_t>(k)) & 3;
+}
+
+// Minimax rational approximation of atan on [0, 0.66] (Cephes atan
+// coefficients).
+double AtanPoly(const double x) {
+  const double z = x * x;
+  double p = -8.750608600031904122785e-1;
+  p = p * z - 1.615753718733365076637e1;
+  p = p * z - 7.500855792314704667340e1;
+  p = p * z - 1.228866684490136173410e2;
+  p = p * z - 6.485021904942025371773e1;
+  double q = z + 2.485846490142306297962e1;
+  q = q * z + 1.650270098316988542046e2;
+  q = q * z + 4.328810604912902668951e2;
+  q = q * z + 4.853903996359136964868e2;
+  q = q * z + 1.945506571482613964425e2;
+  return x + x * z * (p / q);
+}
+
+// atan on [0, inf), reduced onto AtanPoly's interval.
+double FastAtanPositive(const double x) {
+  // tan(3 * pi / 8)
+  constexpr double kTan3PiOver8 = 2.41421356237309504880;
+  if (x > kTan3PiOver8) {
+    return M_PI_2 - AtanPoly(1.0 / x);
+  }
+  if (x > 0.66) {
+    return M_PI_4 + AtanPoly((x - 1.0) / (x + 1.0));
+  }
+  return AtanPoly(x);
+}
+
+}  // namespace
+
+double FastSin(const double x) {
+  double r = 0.0;
+  const uint64_t quadrant = ReduceAngle(x, &r);
+  switch (quadrant) {
+    case 0:
+      return SinPoly(r);
+    case 1:
+      return CosPoly(r);
+    case 2:
+      return -SinPoly(r);
+    default:
+      return -CosPoly(r);
+  }
+}
+
+double FastCos(const double x) {
+  double r = 0.0;
+  const uint64_t quadrant = ReduceAngle(x, &r);
+  switch (quadrant) {
+    case 0:
+      return CosPoly(r);
+    case 1:
+      return -SinPoly(r);
+    case 2:
+      return -CosPoly(r);
+    default:
+      return SinPoly(r);
+  }
+}
+
+void FastSinCos(const double x, double *const sin_x, double *const cos_x) {
+  double r = 0.0;
+  const uint64_t quadrant = ReduceAngle(x, &r);
+  const double s = SinPoly(r);
+  const double c = CosPoly(r);
+  switch (quadrant) {
+    case 0:
+      *sin_x = s;
+      *cos_x = c;
+      break;
+    case 1:
+      *sin_x = c;
+      *cos_x = -s;
+      break;
+    case 2:
+      *sin_x = -s;
+      *cos_x = -c;
+      break;
+    default:
+      *sin_x = -c;
+      *cos_x = s;
+      break;
+  }
+}
+
+void BatchSinCos(const std::vector<double> &angles,
+                 std::vector<double> *const sin_values,
+                 std::vector<double> *const cos_values) {
+  const size_t n = angles.size();
+  sin_values->resize(n);
+  cos_values->resize(n);
+  for (size_t i = 0; i < n; ++i) {
+    FastSinCos(angles[i], &(*sin_values)[i], &(*cos_values)[i]);
+  }
+}
+
+double FastAtan2(const double y, const double x) {
+  if (x == 0.0 && y == 0.0) {
+    return 0.0;
+  }
+  // abs_y / abs_x is +inf when x is 0, which FastAtanPositive folds to
+  // pi / 2 through its 1 / x branch.
+  double angle = FastAtanPositive(std::abs(y) / std::abs(x));
+  if (x < 0.0) {
+    angle = M_PI - angle;
+  }
+  return std::copysign(angle, y);
+}
+
+}  // namespace math
+}  // namespace common
+}  // namespace apollo
@@ -0,0 +1,76 @@
+/******************************************************************************
+ * Copyright 2019 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "modules/common/math/fast_math.h"
+
+#include <cmath>
+
+#include "gtest/gtest.h"
+
+namespace apollo {
+namespace common {
+namespace math {
+
+TEST(FastMathTest, SinCos) {
+  for (int i = -100000; i <= 100000; ++i) {
+    const double x = i * 0.1;
+    EXPECT_NEAR(FastSin(x), std::sin(x), 5e-16) << "x = " << x;
+    EXPECT_NEAR(FastCos(x), std::cos(x), 5e-16) << "x = " << x;
+    double s = 0.0;
+    double c = 0.0;
+    FastSinCos(x, &s, &c);
+    EXPECT_NEAR(s, std::sin(x), 5e-16) << "x = " << x;
+    EXPECT_NEAR(c, std::cos(x), 5e-16) << "x = " << x;
+  }
+}
+
+TEST(FastMathTest, BatchSinCos) {
+  std::vector<double> angles;
+  for (int i = -1000; i <= 1000; ++i) {
+    angles.push_back(i * 0.01);
+  }
+  std::vector<double> sin_values;
+  std::vector<double> cos_values;
+  BatchSinCos(angles, &sin_values, &cos_values);
+  ASSERT_EQ(angles.size(), sin_values.size());
+  ASSERT_EQ(angles.size(), cos_values.size());
+  for (size_t i = 0; i < angles.size(); ++i) {
+    EXPECT_NEAR(sin_values[i], std::sin(angles[i]), 5e-16);
+    EXPECT_NEAR(cos_values[i], std::cos(angles[i]), 5e-16);
+  }
+}
+
+TEST(FastMathTest, Atan2) {
+  for (int i = -200; i <= 200; ++i) {
+    for (int j = -200; j <= 200; ++j) {
+      const double y = i * 0.37;
+      const double x = j * 0.59;
+      if (x == 0.0 && y == 0.0) {
+        continue;
+      }
+      EXPECT_NEAR(FastAtan2(y, x), std::atan2(y, x), 5e-16)
+          << "y = " << y << ", x = " << x;
+    }
+  }
+  EXPECT_DOUBLE_EQ(FastAtan2(0.0, 0.0), 0.0);
+  EXPECT_DOUBLE_EQ(FastAtan2(0.0, -1.0), M_PI);
+  EXPECT_DOUBLE_EQ(FastAtan2(-1.0, 0.0), -M_PI_2);
+  EXPECT_DOUBLE_EQ(FastAtan2(1.0, 0.0), M_PI_2);
+}
+
+}  // namespace math
+}  // namespace common
+}  // namespace apollo
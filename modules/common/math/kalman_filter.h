@@ -21,8 +21,10 @@
 
 #pragma once
 
+#include <cmath>
 #include <sstream>
 #include <string>
+#include <vector>
 
 #include "Eigen/Dense"
 
@@ -37,6 +39,59 @@ namespace apollo {
 namespace common {
 namespace math {
 
+namespace internal {
+
+// Rounding threshold matching the default epsilon of PseudoInverse, so the
+// closed-form specializations below treat near-singular innovation
+// covariances the same way the SVD-based fallback does.
+constexpr double kInnovationEpsilon = 1.0e-6;
+
+/**
+ * @brief Inverts the innovation covariance in Correct(). The generic version
+ * uses the SVD-based pseudo-inverse; the specializations for the 1x1 and 2x2
+ * observation dimensions used by tracking filters expand the inverse in
+ * closed form and only fall back to the pseudo-inverse when the matrix is
+ * near singular.
+ */
+template <typename T, unsigned int ZN>
+struct InnovationInverse {
+  static Eigen::Matrix<T, ZN, ZN> Compute(const Eigen::Matrix<T, ZN, ZN> &S) {
+    return PseudoInverse<T, ZN>(S);
+  }
+};
+
+template <typename T>
+struct InnovationInverse<T, 1> {
+  static Eigen::Matrix<T, 1, 1> Compute(const Eigen::Matrix<T, 1, 1> &S) {
+    Eigen::Matrix<T, 1, 1> inverse;
+    if (std::fabs(S(0, 0)) > kInnovationEpsilon) {
+      inverse(0, 0) = static_cast<T>(1.0) / S(0, 0);
+    } else {
+      inverse(0, 0) = static_cast<T>(0.0);
+    }
+    return inverse;
+  }
+};
+
+template <typename T>
+struct InnovationInverse<T, 2> {
+  static Eigen::Matrix<T, 2, 2> Compute(const Eigen::Matrix<T, 2, 2> &S) {
+    const T det = S(0, 0) * S(1, 1) - S(0, 1) * S(1, 0);
+    if (std::fabs(det) <= kInnovationEpsilon) {
+      return PseudoInverse<T, 2>(S);
+    }
+    const T inv_det = static_cast<T>(1.0) / det;
+    Eigen::Matrix<T, 2, 2> inverse;
+    inverse(0, 0) = S(1, 1) * inv_det;
+    inverse(0, 1) = -S(0, 1) * inv_det;
+    inverse(1, 0) = -S(1, 0) * inv_det;
+    inverse(1, 1) = S(0, 0) * inv_det;
+    return inverse;
+  }
+};
+
+}  // namespace internal
+
 /**
  * @class KalmanFilter
  *
@@ -189,6 +244,20 @@ class KalmanFilter {
    */
   void Correct(const Eigen::Matrix<T, ZN, 1> &z);
 
+  /**
+   * @brief Corrects many independent filters in one sweep, with the
+   * observations stored as the columns of a single matrix. The filters do
+   * not interact; keeping the observations contiguous and the per-filter
+   * update a fixed-size closed-form expression lets the compiler vectorize
+   * across filters, which is the hot path when all radar tracks are
+   * corrected at once.
+   *
+   * @param filters Filters to correct; filters[i] consumes zs.col(i)
+   * @param zs Observations, one column per filter
+   */
+  static void CorrectBatch(const std::vector<KalmanFilter *> &filters,
+                           const Eigen::Matrix<T, ZN, Eigen::Dynamic> &zs);
+
   /**
    * @brief Gets mean of our current state belief distribution
    *
@@ -269,8 +338,8 @@ inline void KalmanFilter<T, XN, ZN, UN>::Correct(
 
   S_ = static_cast<Eigen::Matrix<T, ZN, ZN>>(H_ * P_ * H_.transpose() + R_);
 
-  K_ = static_cast<Eigen::Matrix<T, XN, ZN>>(P_ * H_.transpose() *
-                                             PseudoInverse<T, ZN>(S_));
+  K_ = static_cast<Eigen::Matrix<T, XN, ZN>>(
+      P_ * H_.transpose() * internal::InnovationInverse<T, ZN>::Compute(S_));
 
   x_ = x_ + K_ * y_;
 
@@ -278,6 +347,16 @@ inline void KalmanFilter<T, XN, ZN, UN>::Correct(
       (Eigen::Matrix<T, XN, XN>::Identity() - K_ * H_) * P_);
 }
 
+template <typename T, unsigned int XN, unsigned int ZN, unsigned int UN>
+inline void KalmanFilter<T, XN, ZN, UN>::CorrectBatch(
+    const std::vector<KalmanFilter *> &filters,
+    const Eigen::Matrix<T, ZN, Eigen::Dynamic> &zs) {
+  ACHECK(static_cast<Eigen::Index>(filters.size()) == zs.cols());
+  for (size_t i = 0; i < filters.size(); ++i) {
+    filters[i]->Correct(zs.col(static_cast<Eigen::Index>(i)));
+  }
+}
+
 template <typename T, unsigned int XN, unsigned int ZN, unsigned int UN>
 inline std::string KalmanFilter<T, XN, ZN, UN>::DebugString() const {
   Eigen::IOFormat clean_fmt(4, 0, ", ", " ", "[", "]");
@@ -101,6 +101,55 @@ TEST_F(KalmanFilterTest, SyntheticTrackingTest) {
   EXPECT_NEAR(0.08826, state_cov(1, 1), 0.001);
 }
 
+TEST_F(KalmanFilterTest, ClosedFormInnovationInverseTest) {
+  // The 1x1 and 2x2 closed-form inverses must match the SVD-based
+  // pseudo-inverse on well-conditioned inputs and round near-singular
+  // inputs to the same fallback.
+  Eigen::Matrix<double, 1, 1> s1;
+  s1(0, 0) = 0.35;
+  EXPECT_NEAR(internal::InnovationInverse<double, 1>::Compute(s1)(0, 0),
+              PseudoInverse<double, 1>(s1)(0, 0), 1e-12);
+  s1(0, 0) = 1e-9;
+  EXPECT_DOUBLE_EQ(internal::InnovationInverse<double, 1>::Compute(s1)(0, 0),
+                   0.0);
+
+  Eigen::Matrix<double, 2, 2> s2;
+  s2 << 0.5, 0.1, 0.1, 0.7;
+  const auto closed_form = internal::InnovationInverse<double, 2>::Compute(s2);
+  const auto pseudo = PseudoInverse<double, 2>(s2);
+  for (int i = 0; i < 2; ++i) {
+    for (int j = 0; j < 2; ++j) {
+      EXPECT_NEAR(closed_form(i, j), pseudo(i, j), 1e-9);
+    }
+  }
+  // A singular matrix takes the pseudo-inverse fallback and must not blow up.
+  s2 << 1.0, 2.0, 2.0, 4.0;
+  const auto singular = internal::InnovationInverse<double, 2>::Compute(s2);
+  EXPECT_TRUE(singular.allFinite());
+}
+
+TEST_F(KalmanFilterTest, CorrectBatchTest) {
+  KalmanFilter<double, 2, 1, 1> reference = kf_;
+  KalmanFilter<double, 2, 1, 1> batched_a = kf_;
+  KalmanFilter<double, 2, 1, 1> batched_b = kf_;
+
+  Eigen::Matrix<double, 1, 1> z;
+  z(0, 0) = 1.0;
+  reference.Correct(z);
+
+  Eigen::Matrix<double, 1, Eigen::Dynamic> zs(1, 2);
+  zs(0, 0) = 1.0;
+  zs(0, 1) = 1.0;
+  KalmanFilter<double, 2, 1, 1>::CorrectBatch({&batched_a, &batched_b}, zs);
+
+  for (int i = 0; i < 2; ++i) {
+    EXPECT_DOUBLE_EQ(batched_a.GetStateEstimate()(i, 0),
+                     reference.GetStateEstimate()(i, 0));
+    EXPECT_DOUBLE_EQ(batched_b.GetStateEstimate()(i, 0),
+                     reference.GetStateEstimate()(i, 0));
+  }
+}
+
 }  // namespace math
 }  // namespace common
 }  // namespace apollo
@@ -50,6 +50,32 @@ MpcOsqp::MpcOsqp(const Eigen::MatrixXd &matrix_a,
   num_param_ = state_dim_ * (horizon_ + 1) + control_dim_ * horizon_;
 }
 
+MpcOsqp::~MpcOsqp() { FreeWorkspace(); }
+
+void MpcOsqp::UpdateProblem(const Eigen::MatrixXd &matrix_a,
+                            const Eigen::MatrixXd &matrix_b,
+                            const Eigen::MatrixXd &matrix_q,
+                            const Eigen::MatrixXd &matrix_r,
+                            const Eigen::MatrixXd &matrix_initial_x,
+                            const Eigen::MatrixXd &matrix_u_lower,
+                            const Eigen::MatrixXd &matrix_u_upper,
+                            const Eigen::MatrixXd &matrix_x_lower,
+                            const Eigen::MatrixXd &matrix_x_upper,
+                            const Eigen::MatrixXd &matrix_x_ref) {
+  CHECK_EQ(static_cast<size_t>(matrix_b.rows()), state_dim_);
+  CHECK_EQ(static_cast<size_t>(matrix_b.cols()), control_dim_);
+  matrix_a_ = matrix_a;
+  matrix_b_ = matrix_b;
+  matrix_q_ = matrix_q;
+  matrix_r_ = matrix_r;
+  matrix_initial_x_ = matrix_initial_x;
+  matrix_u_lower_ = matrix_u_lower;
+  matrix_u_upper_ = matrix_u_upper;
+  matrix_x_lower_ = matrix_x_lower;
+  matrix_x_upper_ = matrix_x_upper;
+  matrix_x_ref_ = matrix_x_ref;
+}
+
 void MpcOsqp::CalculateKernel(std::vector<c_float> *P_data,
                               std::vector<c_int> *P_indices,
                               std::vector<c_int> *P_indptr) {
@@ -260,15 +286,74 @@ OSQPData *MpcOsqp::Data() {
   ADEBUG << "Get A matrix";
   data->l = lowerBound_.data();
   data->u = upperBound_.data();
+  // remember the patterns the workspace gets set up with, so later
+  // cycles can detect whether a value-only update is valid
+  p_indices_ = P_indices;
+  p_indptr_ = P_indptr;
+  a_indices_ = A_indices;
+  a_indptr_ = A_indptr;
   return data;
 }
 
 void MpcOsqp::FreeData(OSQPData *data) {
+  delete[] data->P->x;
+  delete[] data->P->i;
+  delete[] data->P->p;
+  delete[] data->A->x;
+  delete[] data->A->i;
+  delete[] data->A->p;
   c_free(data->A);
   c_free(data->P);
   c_free(data);
 }
 
+bool MpcOsqp::SetupWorkspace() {
+  osqp_data_ = Data();
+  osqp_settings_ = Settings();
+  osqp_workspace_ = osqp_setup(osqp_data_, osqp_settings_);
+  if (osqp_workspace_ == nullptr) {
+    AERROR << "OSQP workspace setup failed";
+    FreeWorkspace();
+    return false;
+  }
+  return true;
+}
+
+bool MpcOsqp::UpdateWorkspace() {
+  std::vector<c_float> P_data;
+  std::vector<c_int> P_indices;
+  std::vector<c_int> P_indptr;
+  CalculateKernel(&P_data, &P_indices, &P_indptr);
+  std::vector<c_float> A_data;
+  std::vector<c_int> A_indices;
+  std::vector<c_int> A_indptr;
+  CalculateEqualityConstraint(&A_data, &A_indices, &A_indptr);
+  if (P_indices != p_indices_ || P_indptr != p_indptr_ ||
+      A_indices != a_indices_ || A_indptr != a_indptr_) {
+    return false;
+  }
+  osqp_update_P(osqp_workspace_, P_data.data(), OSQP_NULL, P_data.size());
+  osqp_update_A(osqp_workspace_, A_data.data(), OSQP_NULL, A_data.size());
+  osqp_update_lin_cost(osqp_workspace_, gradient_.data());
+  osqp_update_bounds(osqp_workspace_, lowerBound_.data(), upperBound_.data());
+  return true;
+}
+
+void MpcOsqp::FreeWorkspace() {
+  if (osqp_workspace_ != nullptr) {
+    osqp_cleanup(osqp_workspace_);
+    osqp_workspace_ = nullptr;
+  }
+  if (osqp_data_ != nullptr) {
+    FreeData(osqp_data_);
+    osqp_data_ = nullptr;
+  }
+  if (osqp_settings_ != nullptr) {
+    c_free(osqp_settings_);
+    osqp_settings_ = nullptr;
+  }
+}
+
 bool MpcOsqp::Solve(std::vector<double> *control_cmd) {
   ADEBUG << "Before Calc Gradient";
   CalculateGradient();
@@ -276,57 +361,42 @@ bool MpcOsqp::Solve(std::vector<double> *control_cmd) {
   CalculateConstraintVectors();
   ADEBUG << "MPC2Matrix";
 
-  OSQPData *data = Data();
-  ADEBUG << "OSQP data done";
-  ADEBUG << "OSQP data n" << data->n;
-  ADEBUG << "OSQP data m" << data->m;
-  for (int i = 0; i < data->n; ++i) {
-    ADEBUG << "OSQP data q" << i << ":" << (data->q)[i];
-  }
-  ADEBUG << "OSQP data l" << data->l;
-  for (int i = 0; i < data->m; ++i) {
-    ADEBUG << "OSQP data l" << i << ":" << (data->l)[i];
-  }
-  ADEBUG << "OSQP data u" << data->u;
-  for (int i = 0; i < data->m; ++i) {
-    ADEBUG << "OSQP data u" << i << ":" << (data->u)[i];
+  if (osqp_workspace_ == nullptr) {
+    if (!SetupWorkspace()) {
+      return false;
+    }
+  } else if (!UpdateWorkspace()) {
+    // the sparsity pattern changed, fall back to a full re-setup
+    ADEBUG << "OSQP sparsity pattern changed, rebuilding workspace";
+    FreeWorkspace();
+    if (!SetupWorkspace()) {
+      return false;
+    }
   }
-
-  OSQPSettings *settings = Settings();
-  ADEBUG << "OSQP setting done";
-  OSQPWorkspace *osqp_workspace = nullptr;
-  // osqp_setup(&osqp_workspace, data, settings);
-  osqp_workspace = osqp_setup(data, settings);
   ADEBUG << "OSQP workspace ready";
-  osqp_solve(osqp_workspace);
+  // warm started from the previous cycle's solution kept in the
+  // workspace (warm_start is on by default in the OSQP settings)
+  osqp_solve(osqp_workspace_);
 
-  auto status = osqp_workspace->info->status_val;
+  auto status = osqp_workspace_->info->status_val;
   ADEBUG << "status:" << status;
   // check status
   if (status < 0 || (status != 1 && status != 2)) {
-    AERROR << "failed optimization status:\t" << osqp_workspace->info->status;
-    osqp_cleanup(osqp_workspace);
-    FreeData(data);
-    c_free(settings);
+    AERROR << "failed optimization status:\t" << osqp_workspace_->info->status;
+    // drop the stale workspace so the next cycle starts clean
+    FreeWorkspace();
     return false;
-  } else if (osqp_workspace->solution == nullptr) {
+  } else if (osqp_workspace_->solution == nullptr) {
     AERROR << "The solution from OSQP is nullptr";
-    osqp_cleanup(osqp_workspace);
-    FreeData(data);
-    c_free(settings);
+    FreeWorkspace();
     return false;
   }
 
   size_t first_control = state_dim_ * (horizon_ + 1);
   for (size_t i = 0; i < control_dim_; ++i) {
-    control_cmd->at(i) = osqp_workspace->solution->x[i + first_control];
+    control_cmd->at(i) = osqp_workspace_->solution->x[i + first_control];
     ADEBUG << "control_cmd:" << i << ":" << control_cmd->at(i);
   }
-
-  // Cleanup
-  osqp_cleanup(osqp_workspace);
-  FreeData(data);
-  c_free(settings);
   return true;
 }
 
@@ -52,9 +52,30 @@ class MpcOsqp {
           const Eigen::MatrixXd &matrix_x_ref, const int max_iter,
           const int horizon, const double eps_abs);
 
+  ~MpcOsqp();
+
   // control vector
+  // The first call sets up an OSQP workspace which is kept for the
+  // lifetime of the solver; later calls only push the changed problem
+  // data into it and hot-start from the previous solution.
   bool Solve(std::vector<double> *control_cmd);
 
+  /**
+   * @brief Update the time-varying problem data for the next control
+   *        cycle while keeping the cached workspace. Matrix dimensions
+   *        must match those used at construction.
+   */
+  void UpdateProblem(const Eigen::MatrixXd &matrix_a,
+                     const Eigen::MatrixXd &matrix_b,
+                     const Eigen::MatrixXd &matrix_q,
+                     const Eigen::MatrixXd &matrix_r,
+                     const Eigen::MatrixXd &matrix_initial_x,
+                     const Eigen::MatrixXd &matrix_u_lower,
+                     const Eigen::MatrixXd &matrix_u_upper,
+                     const Eigen::MatrixXd &matrix_x_lower,
+                     const Eigen::MatrixXd &matrix_x_upper,
+                     const Eigen::MatrixXd &matrix_x_ref);
+
  private:
   void CalculateKernel(std::vector<c_float> *P_data,
                        std::vector<c_int> *P_indices,
@@ -67,6 +88,12 @@ class MpcOsqp {
   OSQPSettings *Settings();
   OSQPData *Data();
   void FreeData(OSQPData *data);
+  bool SetupWorkspace();
+  // Pushes new matrix values, gradient and bounds into the cached
+  // workspace. Returns false when the sparsity pattern changed and a
+  // full re-setup is needed.
+  bool UpdateWorkspace();
+  void FreeWorkspace();
 
   template <typename T>
   T *CopyData(const std::vector<T> &vec) {
@@ -81,11 +108,11 @@ class MpcOsqp {
   Eigen::MatrixXd matrix_q_;
   Eigen::MatrixXd matrix_r_;
   Eigen::MatrixXd matrix_initial_x_;
-  const Eigen::MatrixXd matrix_u_lower_;
-  const Eigen::MatrixXd matrix_u_upper_;
-  const Eigen::MatrixXd matrix_x_lower_;
-  const Eigen::MatrixXd matrix_x_upper_;
-  const Eigen::MatrixXd matrix_x_ref_;
+  Eigen::MatrixXd matrix_u_lower_;
+  Eigen::MatrixXd matrix_u_upper_;
+  Eigen::MatrixXd matrix_x_lower_;
+  Eigen::MatrixXd matrix_x_upper_;
+  Eigen::MatrixXd matrix_x_ref_;
   int max_iteration_;
   size_t horizon_;
   double eps_abs_;
@@ -96,6 +123,16 @@ class MpcOsqp {
   Eigen::VectorXd gradient_;
   Eigen::VectorXd lowerBound_;
   Eigen::VectorXd upperBound_;
+  // Cached solver state reused across Solve calls.
+  OSQPWorkspace *osqp_workspace_ = nullptr;
+  OSQPData *osqp_data_ = nullptr;
+  OSQPSettings *osqp_settings_ = nullptr;
+  // Sparsity patterns the workspace was set up with; value-only updates
+  // are valid as long as these stay unchanged.
+  std::vector<c_int> p_indices_;
+  std::vector<c_int> p_indptr_;
+  std::vector<c_int> a_indices_;
+  std::vector<c_int> a_indptr_;
 };
 }  // namespace math
 }  // namespace common
@@ -201,6 +201,73 @@ TEST(MPCOSQPSolverTest, NullMatrix) {
   EXPECT_NEAR(0.0, control_cmd[0], 1e-7);
 }
 
+TEST(MPCOSQPSolverTest, WorkspaceReuse) {
+  const int states = 4;
+  const int controls = 2;
+  const int horizon = 3;
+  const int max_iter = 100;
+  const double eps = 0.001;
+  const double max = std::numeric_limits<double>::max();
+
+  Eigen::MatrixXd A(states, states);
+  A << 5., 6., 7., 8., 7., 8., 7., 8., 9., 10., 7., 8., 11., 4., 7., 8.;
+
+  Eigen::MatrixXd B(states, controls);
+  B << 2., 3, 2., 7, 2, 9, 3, 8;
+
+  Eigen::MatrixXd Q(states, states);
+  Q << 10., 0, 0, 0, 0, 10., 0, 0, 0, 0, 10.0, 0, 0, 0, 0, 10.0;
+
+  Eigen::MatrixXd R(controls, controls);
+  R << 0.1, 0, 0, 0.1;
+
+  Eigen::MatrixXd lower_control_bound(controls, 1);
+  lower_control_bound << 9.6 - 10.5916, 9.6 - 10.5916;
+
+  Eigen::MatrixXd upper_control_bound(controls, 1);
+  upper_control_bound << 13 - 10.5916, 13 - 10.5916;
+
+  Eigen::MatrixXd lower_state_bound(states, 1);
+  lower_state_bound << -M_PI / 6, -M_PI / 6, -1 * max, -1 * max;
+
+  Eigen::MatrixXd upper_state_bound(states, 1);
+  upper_state_bound << M_PI / 6, M_PI / 6, max, max;
+
+  Eigen::MatrixXd initial_state(states, 1);
+  initial_state << 0, 0, 0, 0;
+
+  Eigen::MatrixXd reference_state(states, 1);
+  reference_state << 0, 0, 1, 0;
+
+  std::vector<double> first_cmd(controls, 0);
+  std::vector<double> second_cmd(controls, 0);
+
+  MpcOsqp mpc_osqp_solver(A, B, Q, R, initial_state, lower_control_bound,
+                          upper_control_bound, lower_state_bound,
+                          upper_state_bound, reference_state, max_iter, horizon,
+                          eps);
+  EXPECT_TRUE(mpc_osqp_solver.Solve(&first_cmd));
+  EXPECT_NEAR(-0.0202, first_cmd[0], 1e-3);
+
+  // pushing identical data through the cached workspace must reproduce
+  // the one-shot result
+  mpc_osqp_solver.UpdateProblem(A, B, Q, R, initial_state, lower_control_bound,
+                                upper_control_bound, lower_state_bound,
+                                upper_state_bound, reference_state);
+  EXPECT_TRUE(mpc_osqp_solver.Solve(&second_cmd));
+  EXPECT_NEAR(first_cmd[0], second_cmd[0], 1e-3);
+
+  // perturbed dynamics with the same sparsity pattern still solve
+  Eigen::MatrixXd A2 = A * 1.01;
+  Eigen::MatrixXd initial_state2(states, 1);
+  initial_state2 << 0.01, 0, 0, 0;
+  mpc_osqp_solver.UpdateProblem(A2, B, Q, R, initial_state2,
+                                lower_control_bound, upper_control_bound,
+                                lower_state_bound, upper_state_bound,
+                                reference_state);
+  EXPECT_TRUE(mpc_osqp_solver.Solve(&second_cmd));
+}
+
 }  // namespace math
 }  // namespace common
 }  // namespace apollo
@@ -21,6 +21,7 @@
 #include <limits>
 #include <utility>
 
+#include "Eigen/Core"
 #include "absl/strings/str_cat.h"
 #include "absl/strings/str_join.h"
 #include "cyber/common/log.h"
@@ -31,6 +32,33 @@ namespace apollo {
 namespace common {
 namespace math {
 
+namespace {
+
+// Packs the axis-aligned bounding boxes of all pairs into Eigen arrays and
+// rejects separated pairs in one vectorized pass. mask(i) is true iff the
+// bounding boxes of the i-th pair touch or overlap.
+void AABoxOverlapMask(const std::vector<const Polygon2d *> &polygons1,
+                      const std::vector<const Polygon2d *> &polygons2,
+                      Eigen::Array<bool, Eigen::Dynamic, 1> *const mask) {
+  const int n = static_cast<int>(polygons1.size());
+  Eigen::ArrayXd min_x1(n), max_x1(n), min_y1(n), max_y1(n);
+  Eigen::ArrayXd min_x2(n), max_x2(n), min_y2(n), max_y2(n);
+  for (int i = 0; i < n; ++i) {
+    min_x1(i) = polygons1[i]->min_x();
+    max_x1(i) = polygons1[i]->max_x();
+    min_y1(i) = polygons1[i]->min_y();
+    max_y1(i) = polygons1[i]->max_y();
+    min_x2(i) = polygons2[i]->min_x();
+    max_x2(i) = polygons2[i]->max_x();
+    min_y2(i) = polygons2[i]->min_y();
+    max_y2(i) = polygons2[i]->max_y();
+  }
+  *mask = (max_x2 >= min_x1) && (min_x2 <= max_x1) && (max_y2 >= min_y1) &&
+          (min_y2 <= max_y1);
+}
+
+}  // namespace
+
 Polygon2d::Polygon2d(const Box2d &box) {
   box.GetAllCorners(&points_);
   BuildFromPoints();
@@ -355,6 +383,44 @@ double Polygon2d::ComputeIoU(const Polygon2d &other_polygon) const {
   return intersection_area / union_area;
 }
 
+void Polygon2d::BatchHasOverlap(const std::vector<const Polygon2d *> &polygons1,
+                                const std::vector<const Polygon2d *> &polygons2,
+                                std::vector<bool> *const flags) {
+  CHECK_NOTNULL(flags);
+  CHECK_EQ(polygons1.size(), polygons2.size());
+  const int n = static_cast<int>(polygons1.size());
+  flags->assign(n, false);
+  if (n == 0) {
+    return;
+  }
+  Eigen::Array<bool, Eigen::Dynamic, 1> candidate;
+  AABoxOverlapMask(polygons1, polygons2, &candidate);
+  for (int i = 0; i < n; ++i) {
+    if (candidate(i)) {
+      (*flags)[i] = polygons1[i]->HasOverlap(*polygons2[i]);
+    }
+  }
+}
+
+void Polygon2d::BatchComputeIoU(const std::vector<const Polygon2d *> &polygons1,
+                                const std::vector<const Polygon2d *> &polygons2,
+                                std::vector<double> *const ious) {
+  CHECK_NOTNULL(ious);
+  CHECK_EQ(polygons1.size(), polygons2.size());
+  const int n = static_cast<int>(polygons1.size());
+  ious->assign(n, 0.0);
+  if (n == 0) {
+    return;
+  }
+  Eigen::Array<bool, Eigen::Dynamic, 1> candidate;
+  AABoxOverlapMask(polygons1, polygons2, &candidate);
+  for (int i = 0; i < n; ++i) {
+    if (candidate(i)) {
+      (*ious)[i] = polygons1[i]->ComputeIoU(*polygons2[i]);
+    }
+  }
+}
+
 bool Polygon2d::HasOverlap(const LineSegment2d &line_segment) const {
   CHECK_GE(points_.size(), 3);
   if ((line_segment.start().x() < min_x_ && line_segment.end().x() < min_x_) ||
@@ -268,6 +268,36 @@ class Polygon2d {
    */
   double ComputeIoU(const Polygon2d &other_polygon) const;
 
+  /**
+   * @brief Check overlap for a batch of polygon pairs. A vectorized
+   *        axis-aligned bounding box prefilter rejects separated pairs in
+   *        one pass before running the exact per-edge overlap test, which
+   *        is much cheaper than calling HasOverlap pair by pair on dense
+   *        association workloads.
+   * @param polygons1 The first polygon of each pair.
+   * @param polygons2 The second polygon of each pair, same size as
+   *        polygons1.
+   * @param flags Output overlap flag of each pair.
+   */
+  static void BatchHasOverlap(const std::vector<const Polygon2d *> &polygons1,
+                              const std::vector<const Polygon2d *> &polygons2,
+                              std::vector<bool> *const flags);
+
+  // Only compute intersection over union between pairs of convex polygons.
+  /**
+   * @brief Compute intersection over union ratio for a batch of convex
+   *        polygon pairs. Pairs whose axis-aligned bounding boxes are
+   *        separated are rejected by the vectorized prefilter and reported
+   *        as 0.0 without running the clipping path.
+   * @param polygons1 The first polygon of each pair.
+   * @param polygons2 The second polygon of each pair, same size as
+   *        polygons1.
+   * @param ious Output intersection over union ratio of each pair.
+   */
+  static void BatchComputeIoU(const std::vector<const Polygon2d *> &polygons1,
+                              const std::vector<const Polygon2d *> &polygons2,
+                              std::vector<double> *const ious);
+
   /**
    * @brief Get the axis-aligned bound box of the polygon.
    * @return The axis-aligned bound box of the polygon.
@@ -595,6 +595,59 @@ TEST(Polygon2dTest, Overlap) {
   }
 }
 
+TEST(Polygon2dTest, BatchOverlap) {
+  const Polygon2d poly1(Box2d::CreateAABox({0, 0}, {2, 2}));
+  const Polygon2d poly2(Box2d::CreateAABox({1, 1}, {3, 3}));
+  const Polygon2d poly3(Box2d::CreateAABox({5, 5}, {6, 6}));
+  const Polygon2d poly4(Box2d({2, 2}, M_PI_4, sqrt(2.0), sqrt(2.0)));
+
+  std::vector<const Polygon2d *> polygons1 = {&poly1, &poly1, &poly2, &poly1};
+  std::vector<const Polygon2d *> polygons2 = {&poly2, &poly3, &poly4, &poly4};
+  std::vector<bool> flags;
+  Polygon2d::BatchHasOverlap(polygons1, polygons2, &flags);
+  ASSERT_EQ(4, flags.size());
+  EXPECT_TRUE(flags[0]);
+  EXPECT_FALSE(flags[1]);
+  EXPECT_TRUE(flags[2]);
+  EXPECT_TRUE(flags[3]);
+
+  std::vector<double> ious;
+  Polygon2d::BatchComputeIoU(polygons1, polygons2, &ious);
+  ASSERT_EQ(4, ious.size());
+  EXPECT_NEAR(ious[0], 0.1428, 1e-4);
+  EXPECT_NEAR(ious[1], 0.0, 1e-4);
+  EXPECT_NEAR(ious[2], 0.5, 1e-4);
+  EXPECT_NEAR(ious[3], 0.0909, 1e-4);
+
+  Polygon2d::BatchHasOverlap({}, {}, &flags);
+  EXPECT_TRUE(flags.empty());
+  Polygon2d::BatchComputeIoU({}, {}, &ious);
+  EXPECT_TRUE(ious.empty());
+
+  // The batched results must match the pairwise methods exactly.
+  std::vector<Polygon2d> random_polygons;
+  for (int i = 0; i < 200; ++i) {
+    const double x = RandomDouble(-10, 10);
+    const double y = RandomDouble(-10, 10);
+    const double heading = RandomDouble(0, M_PI * 2.0);
+    const double l = RandomDouble(1, 5);
+    const double w = RandomDouble(1, 5);
+    random_polygons.emplace_back(Box2d({x, y}, heading, l, w));
+  }
+  polygons1.clear();
+  polygons2.clear();
+  for (int i = 0; i + 1 < 200; i += 2) {
+    polygons1.push_back(&random_polygons[i]);
+    polygons2.push_back(&random_polygons[i + 1]);
+  }
+  Polygon2d::BatchHasOverlap(polygons1, polygons2, &flags);
+  Polygon2d::BatchComputeIoU(polygons1, polygons2, &ious);
+  for (size_t i = 0; i < polygons1.size(); ++i) {
+    EXPECT_EQ(flags[i], polygons1[i]->HasOverlap(*polygons2[i]));
+    EXPECT_NEAR(ious[i], polygons1[i]->ComputeIoU(*polygons2[i]), 1e-5);
+  }
+}
+
 TEST(Polygon2dTest, BoundingBox) {
   Polygon2d poly1(Box2d::CreateAABox({0, 0}, {2, 2}));
   Box2d box = poly1.BoundingBoxWithHeading(0.0);
@@ -48,28 +48,41 @@ ActiveSetQpSolver::ActiveSetQpSolver(
       debug_info_(FLAGS_default_enable_active_set_debug_info) {}
 
 bool ActiveSetQpSolver::Solve() {
-  ::qpOASES::QProblem qp_problem(num_param_, num_constraint_, hessian_type_);
-  ::qpOASES::Options my_options;
-
-  my_options.enableCholeskyRefactorisation = cholesky_refactorisation_freq_;
-  if (hessian_type_ == ::qpOASES::HST_POSDEF ||
-      hessian_type_ == ::qpOASES::HST_SEMIDEF) {
-    my_options.enableRegularisation = ::qpOASES::BT_TRUE;
-  }
-  my_options.epsNum = qp_eps_num_;
-  my_options.epsDen = qp_eps_den_;
-  my_options.epsIterRef = qp_eps_iter_ref_;
-  my_options.terminationTolerance = termination_tolerance_;
-  qp_problem.setOptions(my_options);
-  if (!debug_info_) {
-    qp_problem.setPrintLevel(qpOASES::PL_NONE);
-  }
   if (kernel_matrix_.rows() != kernel_matrix_.cols()) {
     AERROR << "kernel_matrix_.rows() [" << kernel_matrix_.rows()
            << "] and kernel_matrix_.cols() [" << kernel_matrix_.cols()
            << "] should be identical.";
     return false;
   }
+
+  // qpOASES keeps the projected Cholesky factor and the active set inside
+  // the SQProblem instance; reuse both when the problem structure matches
+  // the previous successful solve.
+  const bool use_hotstart =
+      FLAGS_default_enable_active_set_hotstart && last_problem_success_ &&
+      sqp_solver_ != nullptr && num_param_ == last_num_param_ &&
+      num_constraint_ == last_num_constraint_ &&
+      hessian_type_ == last_hessian_type_;
+
+  if (!use_hotstart) {
+    sqp_solver_.reset(
+        new ::qpOASES::SQProblem(num_param_, num_constraint_, hessian_type_));
+    ::qpOASES::Options my_options;
+
+    my_options.enableCholeskyRefactorisation = cholesky_refactorisation_freq_;
+    if (hessian_type_ == ::qpOASES::HST_POSDEF ||
+        hessian_type_ == ::qpOASES::HST_SEMIDEF) {
+      my_options.enableRegularisation = ::qpOASES::BT_TRUE;
+    }
+    my_options.epsNum = qp_eps_num_;
+    my_options.epsDen = qp_eps_den_;
+    my_options.epsIterRef = qp_eps_iter_ref_;
+    my_options.terminationTolerance = termination_tolerance_;
+    sqp_solver_->setOptions(my_options);
+    if (!debug_info_) {
+      sqp_solver_->setPrintLevel(qpOASES::PL_NONE);
+    }
+  }
   // definition of qpOASESproblem
   const auto kNumOfMatrixElements =
       kernel_matrix_.rows() * kernel_matrix_.cols();
@@ -132,9 +145,24 @@ bool ActiveSetQpSolver::Solve() {
   // initialize problem
   int max_iter = std::max(max_iteration_, num_constraint_);
 
-  auto ret = qp_problem.init(h_matrix, g_matrix, affine_constraint_matrix,
-                             lower_bound, upper_bound, constraint_lower_bound,
-                             constraint_upper_bound, max_iter);
+  ::qpOASES::returnValue ret;
+  if (use_hotstart) {
+    ADEBUG << "using active set hotstart.";
+    ret = sqp_solver_->hotstart(h_matrix, g_matrix, affine_constraint_matrix,
+                                lower_bound, upper_bound,
+                                constraint_lower_bound, constraint_upper_bound,
+                                max_iter);
+    if (ret != qpOASES::SUCCESSFUL_RETURN) {
+      AERROR << "Fail to hotstart active set QP, will use re-init instead.";
+      ret = sqp_solver_->init(h_matrix, g_matrix, affine_constraint_matrix,
+                              lower_bound, upper_bound, constraint_lower_bound,
+                              constraint_upper_bound, max_iter);
+    }
+  } else {
+    ret = sqp_solver_->init(h_matrix, g_matrix, affine_constraint_matrix,
+                            lower_bound, upper_bound, constraint_lower_bound,
+                            constraint_upper_bound, max_iter);
+  }
   if (ret != qpOASES::SUCCESSFUL_RETURN) {
     if (ret == qpOASES::RET_MAX_NWSR_REACHED) {
       AERROR << "qpOASES solver failed due to reached max iteration";
@@ -156,17 +184,42 @@ bool ActiveSetQpSolver::Solve() {
 
     ADEBUG << ss.str();
 
+    last_problem_success_ = false;
     return false;
   }
 
   double result[num_param_];  // NOLINT
-  qp_problem.getPrimalSolution(result);
+  sqp_solver_->getPrimalSolution(result);
 
   params_ = Eigen::MatrixXd::Zero(num_param_, 1);
   for (int i = 0; i < num_param_; ++i) {
     params_(i, 0) = result[i];
   }
-  return qp_problem.isSolved() == qpOASES::BT_TRUE;
+
+  const bool solved = sqp_solver_->isSolved() == qpOASES::BT_TRUE;
+  last_problem_success_ = solved;
+  last_num_param_ = num_param_;
+  last_num_constraint_ = num_constraint_;
+  last_hessian_type_ = hessian_type_;
+  return solved;
+}
+
+bool ActiveSetQpSolver::UpdateProblem(
+    const Eigen::MatrixXd& kernel_matrix, const Eigen::MatrixXd& offset,
+    const Eigen::MatrixXd& affine_inequality_matrix,
+    const Eigen::MatrixXd& affine_inequality_boundary,
+    const Eigen::MatrixXd& affine_equality_matrix,
+    const Eigen::MatrixXd& affine_equality_boundary) {
+  kernel_matrix_ = kernel_matrix;
+  offset_ = offset;
+  affine_inequality_matrix_ = affine_inequality_matrix;
+  affine_inequality_boundary_ = affine_inequality_boundary;
+  affine_equality_matrix_ = affine_equality_matrix;
+  affine_equality_boundary_ = affine_equality_boundary;
+  num_constraint_ = static_cast<int>(affine_equality_matrix_.rows() +
+                                     affine_inequality_matrix_.rows());
+  num_param_ = static_cast<int>(kernel_matrix.rows());
+  return sanity_check();
 }
 
 void ActiveSetQpSolver::set_qp_eps_num(const double eps) { qp_eps_num_ = eps; }
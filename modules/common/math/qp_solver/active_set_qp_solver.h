@@ -21,6 +21,8 @@
 
 #pragma once
 
+#include <memory>
+
 #include "qpOASES.hpp"
 
 #include "modules/common/math/qp_solver/qp_solver.h"
@@ -41,6 +43,19 @@ class ActiveSetQpSolver : public QpSolver {
 
   bool Solve() override;
 
+  /**
+   * @brief Replace the problem data while keeping the qpOASES instance.
+   * If the new problem has the same number of parameters and constraints as
+   * the previous successful solve, the next Solve() hotstarts from the
+   * previous factorization and active set instead of a cold init.
+   */
+  bool UpdateProblem(const Eigen::MatrixXd& kernel_matrix,
+                     const Eigen::MatrixXd& offset,
+                     const Eigen::MatrixXd& affine_inequality_matrix,
+                     const Eigen::MatrixXd& affine_inequality_boundary,
+                     const Eigen::MatrixXd& affine_equality_matrix,
+                     const Eigen::MatrixXd& affine_equality_boundary) override;
+
   void set_qp_eps_num(const double eps);
   void set_qp_eps_den(const double eps);
   void set_qp_eps_iter_ref(const double eps);
@@ -105,6 +120,14 @@ class ActiveSetQpSolver : public QpSolver {
   ::qpOASES::HessianType hessian_type_ = ::qpOASES::HST_UNKNOWN;
   int cholesky_refactorisation_freq_ = 0;
   double termination_tolerance_ = 1.0e-9;
+
+  // persistent qpOASES instance; kept across Solve() calls so an unchanged
+  // problem structure can hotstart from the previous factorization
+  std::unique_ptr<::qpOASES::SQProblem> sqp_solver_;
+  int last_num_param_ = 0;
+  int last_num_constraint_ = 0;
+  ::qpOASES::HessianType last_hessian_type_ = ::qpOASES::HST_UNKNOWN;
+  bool last_problem_success_ = false;
 };
 
 }  // namespace math
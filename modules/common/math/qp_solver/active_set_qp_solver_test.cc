@@ -28,6 +28,33 @@ namespace math {
 
 using Eigen::MatrixXd;
 
+TEST(ActiveSetQpSolver, hotstart_repeated_solve) {
+  MatrixXd kernel_matrix = MatrixXd::Zero(1, 1);
+  kernel_matrix(0, 0) = 1.0;
+  MatrixXd offset = MatrixXd::Zero(1, 1);
+  offset(0, 0) = -8.0;
+  MatrixXd affine_inequality_matrix;
+  MatrixXd affine_inequality_boundary;
+  MatrixXd affine_equality_matrix;
+  MatrixXd affine_equality_boundary;
+  ActiveSetQpSolver solver(kernel_matrix, offset, affine_inequality_matrix,
+                           affine_inequality_boundary, affine_equality_matrix,
+                           affine_equality_boundary);
+  EXPECT_TRUE(solver.Solve());
+  EXPECT_NEAR(solver.params()(0, 0), 8.0, 1e-9);
+
+  // Same structure, shifted offset: the second solve hotstarts from the
+  // previous factorization and must reach the new optimum.
+  offset(0, 0) = -6.0;
+  EXPECT_TRUE(solver.UpdateProblem(kernel_matrix, offset,
+                                   affine_inequality_matrix,
+                                   affine_inequality_boundary,
+                                   affine_equality_matrix,
+                                   affine_equality_boundary));
+  EXPECT_TRUE(solver.Solve());
+  EXPECT_NEAR(solver.params()(0, 0), 6.0, 1e-9);
+}
+
 TEST(ActiveSetQpSolver, simple_problem_01) {
   MatrixXd kernel_matrix = MatrixXd::Zero(1, 1);
   kernel_matrix(0, 0) = 1.0;
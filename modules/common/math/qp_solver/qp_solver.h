@@ -47,6 +47,15 @@ class QpSolver {
   virtual void SetTerminationTolerance(const double) {}
   virtual bool Solve() = 0;
 
+  // Replace the problem data while keeping the solver instance, so solvers
+  // with internal state can warm start the next Solve() from the previous
+  // solution. Returns false if the solver does not support it.
+  virtual bool UpdateProblem(const Eigen::MatrixXd&, const Eigen::MatrixXd&,
+                             const Eigen::MatrixXd&, const Eigen::MatrixXd&,
+                             const Eigen::MatrixXd&, const Eigen::MatrixXd&) {
+    return false;
+  }
+
   const Eigen::MatrixXd& params() const;
   const Eigen::MatrixXd& kernel_matrix() const;
   const Eigen::MatrixXd& offset() const;
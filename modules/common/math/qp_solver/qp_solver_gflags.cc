@@ -33,4 +33,7 @@ DEFINE_double(default_qp_smoothing_eps_iter_ref, 1e-7,
               "refinement");  // NOLINT
 DEFINE_bool(default_enable_active_set_debug_info, false,
             "Enable print information");
+DEFINE_bool(default_enable_active_set_hotstart, true,
+            "Reuse the qpOASES factorization and active set of the previous "
+            "solve when the problem structure is unchanged");
 DEFINE_int32(default_qp_iteration_num, 1000, "Default qp oases iteration time");
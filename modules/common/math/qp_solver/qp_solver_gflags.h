@@ -26,4 +26,5 @@ DECLARE_double(default_qp_smoothing_eps_num);
 DECLARE_double(default_qp_smoothing_eps_den);
 DECLARE_double(default_qp_smoothing_eps_iter_ref);
 DECLARE_bool(default_enable_active_set_debug_info);
+DECLARE_bool(default_enable_active_set_hotstart);
 DECLARE_int32(default_qp_iteration_num);
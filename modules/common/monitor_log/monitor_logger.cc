@@ -23,6 +23,19 @@ namespace apollo {
 namespace common {
 namespace monitor {
 
+namespace {
+
+// At most one batch per interval leaves through the writer unless an
+// ERROR or worse forces it out early.
+constexpr uint64_t kFlushIntervalNs = 100 * 1000 * 1000ULL;
+// A full batch is flushed regardless of the interval.
+constexpr int kMaxBatchItems = 32;
+// Per-source item budget per limiter window.
+constexpr uint64_t kRateLimitWindowNs = 1000 * 1000 * 1000ULL;
+constexpr int kMaxItemsPerWindow = 100;
+
+}  // namespace
+
 MonitorLogger::MonitorLogger() {
   const std::string node_name =
       absl::StrCat("monitor_logger", cyber::Time::Now().ToNanosecond());
@@ -33,23 +46,63 @@ MonitorLogger::MonitorLogger() {
   }
 }
 
+MonitorLogger::~MonitorLogger() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  FlushPending(cyber::Time::Now().ToNanosecond());
+}
+
 void MonitorLogger::Publish(const MonitorMessageItem::MessageSource &source,
                             const std::vector<MessageItem> &messages) const {
-  // compose a monitor message
   if (messages.empty()) {
     return;
   }
-  MonitorMessage monitor_msg;
+  const uint64_t now_ns = cyber::Time::Now().ToNanosecond();
+  std::lock_guard<std::mutex> lock(mutex_);
+
+  auto &state = rate_limit_states_[static_cast<int>(source)];
+  if (now_ns - state.window_start_ns >= kRateLimitWindowNs) {
+    if (state.suppressed_count > 0) {
+      MonitorMessageItem *summary = pending_msg_.add_item();
+      summary->set_source(source);
+      summary->set_log_level(MonitorMessageItem::WARN);
+      summary->set_msg(absl::StrCat("monitor rate limit suppressed ",
+                                    state.suppressed_count,
+                                    " message(s) in the last second"));
+    }
+    state.window_start_ns = now_ns;
+    state.item_count = 0;
+    state.suppressed_count = 0;
+  }
 
+  bool has_error = false;
   for (const auto &msg_item : messages) {
-    MonitorMessageItem *monitor_msg_item = monitor_msg.add_item();
+    if (state.item_count >= kMaxItemsPerWindow) {
+      ++state.suppressed_count;
+      continue;
+    }
+    ++state.item_count;
+    MonitorMessageItem *monitor_msg_item = pending_msg_.add_item();
     monitor_msg_item->set_source(source);
     monitor_msg_item->set_log_level(msg_item.first);
     monitor_msg_item->set_msg(msg_item.second);
+    has_error = has_error || msg_item.first >= MonitorMessageItem::ERROR;
+  }
+
+  // errors go out now; routine items ride the next interval boundary or
+  // a full batch
+  if (has_error || pending_msg_.item_size() >= kMaxBatchItems ||
+      now_ns - last_flush_ns_ >= kFlushIntervalNs) {
+    FlushPending(now_ns);
   }
+}
 
-  // publish monitor messages
-  DoPublish(&monitor_msg);
+void MonitorLogger::FlushPending(uint64_t now_ns) const {
+  if (pending_msg_.item_size() == 0) {
+    return;
+  }
+  DoPublish(&pending_msg_);
+  pending_msg_.Clear();
+  last_flush_ns_ = now_ns;
 }
 
 void MonitorLogger::DoPublish(MonitorMessage *message) const {
@@ -22,7 +22,9 @@
 #pragma once
 
 #include <memory>
+#include <mutex>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -47,10 +49,18 @@ using MessageItem = std::pair<MonitorMessageItem::LogLevel, std::string>;
  * topic. A module who wants to publish message can use macro
  * `MONITOR(log_level, log_msg)` to record messages, and call
  * Publish to broadcast the message to other modules.
+ *
+ * Publication is batched and rate limited so that fault storms have
+ * bounded cost: items are appended to one pending MonitorMessage which
+ * is flushed when an ERROR or worse arrives, when the batch is full, or
+ * when the flush interval has elapsed, and each source may contribute at
+ * most a fixed number of items per second. Items dropped by the limiter
+ * are counted and reported in a single summary item when the window
+ * rolls over.
  */
 class MonitorLogger {
  public:
-  virtual ~MonitorLogger() = default;
+  virtual ~MonitorLogger();
 
   /**
    * @brief Publish the messages.
@@ -60,12 +70,28 @@ class MonitorLogger {
                        const std::vector<MessageItem> &messages) const;
 
  private:
+  // Per-source budget bookkeeping for one limiter window.
+  struct RateLimitState {
+    uint64_t window_start_ns = 0;
+    int item_count = 0;
+    int suppressed_count = 0;
+  };
+
   virtual void DoPublish(MonitorMessage *message) const;
 
+  void FlushPending(uint64_t now_ns) const;
+
   MonitorMessageItem::MessageSource source_;
   std::unique_ptr<cyber::Node> node_;
   std::shared_ptr<cyber::Writer<MonitorMessage>> monitor_msg_writer_;
 
+  mutable std::mutex mutex_;
+  // Reused across flushes; protobuf keeps cleared repeated items pooled,
+  // so steady-state appends allocate nothing.
+  mutable MonitorMessage pending_msg_;
+  mutable uint64_t last_flush_ns_ = 0;
+  mutable std::unordered_map<int, RateLimitState> rate_limit_states_;
+
   DECLARE_SINGLETON(MonitorLogger)
 };
 
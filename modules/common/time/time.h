@@ -31,6 +31,7 @@
 #include "absl/time/clock.h"
 #include "absl/time/time.h"
 #include "cyber/common/macros.h"
+#include "cyber/time/clock.h"
 #include "cyber/time/time.h"
 
 #include "cyber/common/log.h"
@@ -86,7 +87,9 @@ class Clock {
       default:
         AFATAL << "Unsupported clock mode: " << mode();
     }
-    return absl::FromUnixNanos(cyber::Time::Now().ToNanosecond());
+    // cyber::Clock follows the simulation time published on /clock when
+    // the process runs in simulation mode, and system time otherwise.
+    return absl::FromUnixNanos(cyber::Clock::Now().ToNanosecond());
   }
 
   /**
@@ -70,17 +70,28 @@ double GetPathAngle(const Points &points, const size_t start,
 }
 
 /**
- * @brief Downsample the points on the path according to the angle.
- * @param points Points on the path.
+ * @brief Downsample strided coordinate arrays according to the angle.
+ *
+ * The per-segment unit directions are precomputed into contiguous scratch
+ * buffers in one tight pass that the compiler vectorizes; the sequential
+ * accumulate-and-reset decision loop then reads one dot product per point
+ * instead of recomputing two segment norms and vectors per candidate.
+ *
+ * @param x Pointer to the first x coordinate.
+ * @param y Pointer to the first y coordinate.
+ * @param num_points Number of points.
+ * @param stride Distance in doubles between consecutive coordinates; pass
+ * 1 for planar arrays, or the packed point size for interleaved layouts.
  * @param angle_threshold Points are sampled when the accumulated direction
  * change exceeds the threshold.
  * @return sampled_indices Indices of all sampled points, or empty when fail.
  */
-template <typename Points>
-std::vector<size_t> DownsampleByAngle(const Points &points,
-                                      const double angle_threshold) {
+inline std::vector<size_t> DownsampleByAngle(const double *x, const double *y,
+                                             const size_t num_points,
+                                             const size_t stride,
+                                             const double angle_threshold) {
   std::vector<size_t> sampled_indices;
-  if (points.empty()) {
+  if (num_points == 0) {
     return sampled_indices;
   }
 
@@ -88,14 +99,28 @@ std::vector<size_t> DownsampleByAngle(const Points &points,
     AERROR << "Input angle threshold is negative.";
     return sampled_indices;
   }
+  sampled_indices.reserve(num_points);
   sampled_indices.push_back(0);
-  if (points.size() > 1) {
+  if (num_points > 1) {
+    const size_t num_segments = num_points - 1;
+    std::vector<double> unit_x(num_segments);
+    std::vector<double> unit_y(num_segments);
+    for (size_t i = 0; i < num_segments; ++i) {
+      const double dx = x[(i + 1) * stride] - x[i * stride];
+      const double dy = y[(i + 1) * stride] - y[i * stride];
+      const double inv_norm = 1.0 / std::sqrt(dx * dx + dy * dy);
+      unit_x[i] = dx * inv_norm;
+      unit_y[i] = dy * inv_norm;
+    }
+
     size_t start = 0;
     size_t end = 1;
     double accum_degree = 0.0;
-    while (end + 1 < static_cast<size_t>(points.size())) {
-      const double angle = GetPathAngle(points, start, end);
-      accum_degree += std::fabs(angle);
+    while (end + 1 < num_points) {
+      const double dot_product =
+          unit_x[start] * unit_x[end] + unit_y[start] * unit_y[end];
+      const double angle = std::acos(dot_product);
+      accum_degree += std::isnan(angle) ? 0.0 : std::fabs(angle);
 
       if (accum_degree > angle_threshold) {
         sampled_indices.push_back(end);
@@ -107,38 +132,67 @@ std::vector<size_t> DownsampleByAngle(const Points &points,
     sampled_indices.push_back(end);
   }
 
-  ADEBUG << "Point Vector is downsampled from " << points.size() << " to "
+  ADEBUG << "Point Vector is downsampled from " << num_points << " to "
          << sampled_indices.size();
 
   return sampled_indices;
 }
 
 /**
- * @brief Downsample the points on the path based on distance.
+ * @brief Downsample the points on the path according to the angle.
  * @param points Points on the path.
+ * @param angle_threshold Points are sampled when the accumulated direction
+ * change exceeds the threshold.
+ * @return sampled_indices Indices of all sampled points, or empty when fail.
+ */
+template <typename Points>
+std::vector<size_t> DownsampleByAngle(const Points &points,
+                                      const double angle_threshold) {
+  // Gather the coordinates once; proto repeated fields are not contiguous,
+  // and one linear copy is cheaper than the per-candidate math it replaces.
+  const size_t num_points = points.size();
+  std::vector<double> x(num_points);
+  std::vector<double> y(num_points);
+  for (size_t i = 0; i < num_points; ++i) {
+    x[i] = points[i].x();
+    y[i] = points[i].y();
+  }
+  return DownsampleByAngle(x.data(), y.data(), num_points, 1, angle_threshold);
+}
+
+/**
+ * @brief Downsample strided coordinate arrays based on distance.
+ *
+ * Segment lengths are precomputed into a contiguous scratch buffer in one
+ * vectorizable pass before the sequential accumulate-and-reset loop.
+ *
+ * @param x Pointer to the first x coordinate.
+ * @param y Pointer to the first y coordinate.
+ * @param num_points Number of points.
+ * @param stride Distance in doubles between consecutive coordinates; pass
+ * 1 for planar arrays, or the packed point size for interleaved layouts.
  * @param downsampleDistance downsample rate for a normal path
  * @param steepTurnDownsampleDistance downsample rate for a steep turn path
  * @return sampled_indices Indices of all sampled points, or empty when fail.
  */
-template <typename Points>
-std::vector<size_t> DownsampleByDistance(const Points &points,
-                                         int downsampleDistance,
-                                         int steepTurnDownsampleDistance) {
+inline std::vector<size_t> DownsampleByDistance(
+    const double *x, const double *y, const size_t num_points,
+    const size_t stride, int downsampleDistance,
+    int steepTurnDownsampleDistance) {
   std::vector<size_t> sampled_indices;
-  if (points.size() <= 4) {
+  if (num_points <= 4) {
     // No need to downsample if there are not too many points.
-    for (size_t i = 0; i < points.size(); ++i) {
+    for (size_t i = 0; i < num_points; ++i) {
       sampled_indices.push_back(i);
     }
     return sampled_indices;
   }
 
   using apollo::common::math::Vec2d;
-  Vec2d v_start =
-      Vec2d(points[1].x() - points[0].x(), points[1].y() - points[0].y());
+  Vec2d v_start = Vec2d(x[stride] - x[0], y[stride] - y[0]);
   Vec2d v_end =
-      Vec2d(points[points.size() - 1].x() - points[points.size() - 2].x(),
-            points[points.size() - 1].y() - points[points.size() - 2].y());
+      Vec2d(x[(num_points - 1) * stride] - x[(num_points - 2) * stride],
+            y[(num_points - 1) * stride] - y[(num_points - 2) * stride]);
   v_start.Normalize();
   v_end.Normalize();
   // If the angle exceeds 80 degree, it's a steep turn
@@ -146,14 +200,21 @@ std::vector<size_t> DownsampleByDistance(const Points &points,
   int downsampleRate =
       is_steep_turn ? steepTurnDownsampleDistance : downsampleDistance;
 
+  const size_t num_segments = num_points - 1;
+  std::vector<double> segment_length(num_segments);
+  for (size_t i = 0; i < num_segments; ++i) {
+    const double dx = x[(i + 1) * stride] - x[i * stride];
+    const double dy = y[(i + 1) * stride] - y[i * stride];
+    segment_length[i] = std::sqrt(dx * dx + dy * dy);
+  }
+
   // Make sure the first point is included
+  sampled_indices.reserve(num_points);
   sampled_indices.push_back(0);
 
   double accum_distance = 0.0;
-  for (size_t pos = 1; pos < points.size() - 1; ++pos) {
-    Vec2d point_start = Vec2d(points[pos - 1].x(), points[pos - 1].y());
-    Vec2d point_end = Vec2d(points[pos].x(), points[pos].y());
-    accum_distance += point_start.DistanceTo(point_end);
+  for (size_t pos = 1; pos < num_points - 1; ++pos) {
+    accum_distance += segment_length[pos - 1];
 
     if (accum_distance > downsampleRate) {
       sampled_indices.push_back(pos);
@@ -162,10 +223,32 @@ std::vector<size_t> DownsampleByDistance(const Points &points,
   }
 
   // Make sure the last point is included
-  sampled_indices.push_back(points.size() - 1);
+  sampled_indices.push_back(num_points - 1);
   return sampled_indices;
 }
 
+/**
+ * @brief Downsample the points on the path based on distance.
+ * @param points Points on the path.
+ * @param downsampleDistance downsample rate for a normal path
+ * @param steepTurnDownsampleDistance downsample rate for a steep turn path
+ * @return sampled_indices Indices of all sampled points, or empty when fail.
+ */
+template <typename Points>
+std::vector<size_t> DownsampleByDistance(const Points &points,
+                                         int downsampleDistance,
+                                         int steepTurnDownsampleDistance) {
+  const size_t num_points = points.size();
+  std::vector<double> x(num_points);
+  std::vector<double> y(num_points);
+  for (size_t i = 0; i < num_points; ++i) {
+    x[i] = points[i].x();
+    y[i] = points[i].y();
+  }
+  return DownsampleByDistance(x.data(), y.data(), num_points, 1,
+                              downsampleDistance, steepTurnDownsampleDistance);
+}
+
 }  // namespace util
 }  // namespace common
 }  // namespace apollo
@@ -49,6 +49,34 @@ TEST(DownSamplerTest, DownsampleByAngle) {
   EXPECT_EQ(12, sampled_indices[1]);
 }
 
+TEST(DownSamplerTest, DownsampleByAngleStrided) {
+  // Same path as DownsampleByAngle, stored interleaved as x0 y0 x1 y1 ...
+  std::vector<double> xy = {
+      -405.778, -134.969, -403.919, -127.696, -400.635, -115.407, -397.997,
+      -105.291, -395.801, -96.8637, -392.889, -86.1015, -388.054, -67.9935,
+      -385.994, -60.1831, -378.213, -30.2776, -376.702, -24.5804, -373.825,
+      -13.3855, -367.583, 10.4028,  -363.025, 27.4212};
+
+  std::vector<size_t> sampled_indices =
+      DownsampleByAngle(&xy[0], &xy[1], xy.size() / 2, 2, 0.1);
+  EXPECT_EQ(2, sampled_indices.size());
+  EXPECT_EQ(0, sampled_indices[0]);
+  EXPECT_EQ(12, sampled_indices[1]);
+}
+
+TEST(DownSamplerTest, DownsampleByDistanceStrided) {
+  std::vector<double> x = {0, 0, 0, 0, 0, 0};
+  std::vector<double> y = {0, 4, 8, 12, 16, 20};
+
+  std::vector<size_t> sampled_indices =
+      DownsampleByDistance(x.data(), y.data(), x.size(), 1, 5, 1);
+  EXPECT_EQ(4, sampled_indices.size());
+  EXPECT_EQ(0, sampled_indices[0]);
+  EXPECT_EQ(2, sampled_indices[1]);
+  EXPECT_EQ(4, sampled_indices[2]);
+  EXPECT_EQ(5, sampled_indices[3]);
+}
+
 TEST(DownSamplerTest, DownsampleByDistanceNormal) {
   std::vector<Vec2d> points;
   points.emplace_back(0, 0);
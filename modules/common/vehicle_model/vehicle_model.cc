@@ -22,6 +22,29 @@
 namespace apollo {
 namespace common {
 
+namespace {
+
+// The model config does not change at runtime, so it is loaded from file
+// once and shared by all predictions.
+const VehicleModelConfig& GetVehicleModelConfig() {
+  static const VehicleModelConfig* const vehicle_model_config = [] {
+    auto* config = new VehicleModelConfig();
+    ACHECK(cyber::common::GetProtoFromFile(FLAGS_vehicle_model_config_filename,
+                                           config))
+        << "Failed to load vehicle model config file "
+        << FLAGS_vehicle_model_config_filename;
+
+    // Some models not supported for now
+    ACHECK(config->model_type() !=
+           VehicleModelConfig::COM_CENTERED_DYNAMIC_BICYCLE_MODEL);
+    ACHECK(config->model_type() != VehicleModelConfig::MLP_MODEL);
+    return config;
+  }();
+  return *vehicle_model_config;
+}
+
+}  // namespace
+
 void VehicleModel::RearCenteredKinematicBicycleModel(
     const VehicleModelConfig& vehicle_model_config,
     const double predicted_time_horizon, const VehicleState& cur_vehicle_state,
@@ -56,12 +79,10 @@ void VehicleModel::RearCenteredKinematicBicycleModel(
     }
     double intermidiate_phi =
         cur_phi + 0.5 * dt * cur_v * cur_vehicle_state.kappa();
-    next_phi =
-        cur_phi + dt * (cur_v + 0.5 * dt * cur_a) * cur_vehicle_state.kappa();
-    next_x =
-        cur_x + dt * (cur_v + 0.5 * dt * cur_a) * std::cos(intermidiate_phi);
-    next_y =
-        cur_y + dt * (cur_v + 0.5 * dt * cur_a) * std::sin(intermidiate_phi);
+    const double ds = dt * (cur_v + 0.5 * dt * cur_a);
+    next_phi = cur_phi + ds * cur_vehicle_state.kappa();
+    next_x = cur_x + ds * std::cos(intermidiate_phi);
+    next_y = cur_y + ds * std::sin(intermidiate_phi);
 
     next_v = cur_v + dt * cur_a;
     cur_x = next_x;
@@ -82,17 +103,7 @@ void VehicleModel::RearCenteredKinematicBicycleModel(
 
 VehicleState VehicleModel::Predict(const double predicted_time_horizon,
                                    const VehicleState& cur_vehicle_state) {
-  VehicleModelConfig vehicle_model_config;
-
-  ACHECK(cyber::common::GetProtoFromFile(FLAGS_vehicle_model_config_filename,
-                                         &vehicle_model_config))
-      << "Failed to load vehicle model config file "
-      << FLAGS_vehicle_model_config_filename;
-
-  // Some models not supported for now
-  ACHECK(vehicle_model_config.model_type() !=
-         VehicleModelConfig::COM_CENTERED_DYNAMIC_BICYCLE_MODEL);
-  ACHECK(vehicle_model_config.model_type() != VehicleModelConfig::MLP_MODEL);
+  const VehicleModelConfig& vehicle_model_config = GetVehicleModelConfig();
 
   VehicleState predicted_vehicle_state;
   if (vehicle_model_config.model_type() ==
@@ -105,5 +116,28 @@ VehicleState VehicleModel::Predict(const double predicted_time_horizon,
   return predicted_vehicle_state;
 }
 
+std::vector<VehicleState> VehicleModel::PredictSteps(
+    const double step_time_horizon, const size_t num_steps,
+    const VehicleState& cur_vehicle_state) {
+  const VehicleModelConfig& vehicle_model_config = GetVehicleModelConfig();
+
+  std::vector<VehicleState> predicted_vehicle_states;
+  predicted_vehicle_states.reserve(num_steps);
+  if (vehicle_model_config.model_type() ==
+      VehicleModelConfig::REAR_CENTERED_KINEMATIC_BICYCLE_MODEL) {
+    VehicleState vehicle_state = cur_vehicle_state;
+    for (size_t i = 0; i < num_steps; ++i) {
+      VehicleState predicted_vehicle_state;
+      RearCenteredKinematicBicycleModel(vehicle_model_config,
+                                        step_time_horizon, vehicle_state,
+                                        &predicted_vehicle_state);
+      predicted_vehicle_states.push_back(predicted_vehicle_state);
+      vehicle_state = predicted_vehicle_state;
+    }
+  }
+
+  return predicted_vehicle_states;
+}
+
 }  // namespace common
 }  // namespace apollo
@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include <vector>
+
 #include "modules/common/configs/vehicle_config_helper.h"
 #include "modules/common/vehicle_model/proto/vehicle_model_config.pb.h"
 #include "modules/common/vehicle_state/proto/vehicle_state.pb.h"
@@ -30,6 +32,17 @@ class VehicleModel {
   static VehicleState Predict(const double predicted_time_horizon,
                               const VehicleState& cur_vehicle_state);
 
+  /**
+   * @brief Predict a sequence of future vehicle states in one call. The
+   *        i-th returned state is the prediction at (i + 1) *
+   *        step_time_horizon ahead of cur_vehicle_state; every step
+   *        continues the rollout from the previous predicted state, and
+   *        the model is selected once for the whole rollout.
+   */
+  static std::vector<VehicleState> PredictSteps(
+      const double step_time_horizon, const size_t num_steps,
+      const VehicleState& cur_vehicle_state);
+
  private:
   static void RearCenteredKinematicBicycleModel(
       const VehicleModelConfig& vehicle_model_config,
@@ -78,5 +78,34 @@ TEST_F(VehicleModelTest, RearCenteredKinematicBicycleModel) {
   EXPECT_NEAR(expected_vehicle_state_.linear_velocity(),
               predicted_vehicle_state_.linear_velocity(), 2e-2);
 }
+
+TEST_F(VehicleModelTest, PredictSteps) {
+  auto vehicle_state_provider =
+      std::make_shared<common::VehicleStateProvider>();
+  vehicle_state_provider->Update(localization_pre_, chassis_pre_);
+  cur_vehicle_state_ = vehicle_state_provider->vehicle_state();
+
+  const double step_time_horizon = 0.1;
+  const size_t num_steps = 3;
+  std::vector<VehicleState> predicted_vehicle_states =
+      VehicleModel::PredictSteps(step_time_horizon, num_steps,
+                                 cur_vehicle_state_);
+  ASSERT_EQ(predicted_vehicle_states.size(), num_steps);
+
+  // The batched rollout matches chained single-step predictions.
+  VehicleState chained_vehicle_state = cur_vehicle_state_;
+  for (size_t i = 0; i < num_steps; ++i) {
+    chained_vehicle_state =
+        VehicleModel::Predict(step_time_horizon, chained_vehicle_state);
+    EXPECT_DOUBLE_EQ(predicted_vehicle_states[i].x(),
+                     chained_vehicle_state.x());
+    EXPECT_DOUBLE_EQ(predicted_vehicle_states[i].y(),
+                     chained_vehicle_state.y());
+    EXPECT_DOUBLE_EQ(predicted_vehicle_states[i].heading(),
+                     chained_vehicle_state.heading());
+    EXPECT_DOUBLE_EQ(predicted_vehicle_states[i].linear_velocity(),
+                     chained_vehicle_state.linear_velocity());
+  }
+}
 }  // namespace common
 }  // namespace apollo
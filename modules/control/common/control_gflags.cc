@@ -121,3 +121,14 @@ DEFINE_bool(use_control_submodules, false,
 
 DEFINE_bool(use_system_time_in_control, true,
             "use system time for time latency in control module");
+
+DEFINE_bool(use_chassis_state_shm, false,
+            "read the hot chassis feedback fields from the shared-memory "
+            "block written by canbus instead of the channel message only");
+
+DEFINE_bool(enable_control_deadline, false,
+            "run the controller chain under a per-cycle deadline and hold the "
+            "previous actuation command when a controller overruns");
+
+DEFINE_double(control_deadline_ms, 10.0,
+              "deadline in milliseconds for one pass of the controller chain");
@@ -82,3 +82,8 @@ DECLARE_bool(use_osqp_solver);
 DECLARE_bool(use_control_submodules);
 
 DECLARE_bool(use_system_time_in_control);
+
+DECLARE_bool(use_chassis_state_shm);
+
+DECLARE_bool(enable_control_deadline);
+DECLARE_double(control_deadline_ms);
@@ -16,11 +16,44 @@
 
 #pragma once
 
+#include "modules/common/proto/pnc_point.pb.h"
 #include "modules/common/vehicle_state/vehicle_state_provider.h"
 
 namespace apollo {
 namespace control {
 
+/**
+ * @brief Per-cycle vehicle state projections shared between the control
+ * submodules and controllers running in the same process. A cycle is
+ * identified by the planning trajectory sequence number together with
+ * the vehicle state timestamp; consumers check IsCurrent() before
+ * reading and fill the cache after computing, so the Frenet projection
+ * of the vehicle position is computed at most once per cycle.
+ */
+struct ComputedStateCache {
+  uint32_t trajectory_sequence_num = 0;
+  double vehicle_state_timestamp = 0.0;
+
+  bool frenet_valid = false;
+  common::PathPoint matched_path_point;
+  double station = 0.0;
+  double station_dot = 0.0;
+  double lateral = 0.0;
+  double lateral_dot = 0.0;
+  double heading_error = 0.0;
+
+  bool IsCurrent(const uint32_t sequence_num, const double timestamp) const {
+    return trajectory_sequence_num == sequence_num &&
+           vehicle_state_timestamp == timestamp;
+  }
+
+  void ResetCycle(const uint32_t sequence_num, const double timestamp) {
+    trajectory_sequence_num = sequence_num;
+    vehicle_state_timestamp = timestamp;
+    frenet_valid = false;
+  }
+};
+
 class DependencyInjector {
  public:
   DependencyInjector() = default;
@@ -31,8 +64,11 @@ class DependencyInjector {
     return &vehicle_state_;
   }
 
+  ComputedStateCache* computed_state_cache() { return &computed_state_cache_; }
+
  private:
   apollo::common::VehicleStateProvider vehicle_state_;
+  ComputedStateCache computed_state_cache_;
 };
 
 }  // namespace control
@@ -16,6 +16,7 @@
 
 #include "modules/control/common/interpolation_2d.h"
 
+#include <algorithm>
 #include <cmath>
 
 #include "cyber/common/log.h"
@@ -24,6 +25,36 @@ namespace {
 
 const double kDoubleEpsilon = 1.0e-6;
 
+// Detects an evenly spaced axis, which allows a direct index computation
+// instead of a binary search.
+bool IsUniformAxis(const std::vector<double> &axis, double *inv_step) {
+  if (axis.size() < 2) {
+    return false;
+  }
+  const double step =
+      (axis.back() - axis.front()) / static_cast<double>(axis.size() - 1);
+  for (size_t i = 0; i + 1 < axis.size(); ++i) {
+    const double gap = axis[i + 1] - axis[i];
+    if (std::fabs(gap - step) > 1.0e-9 * std::max(1.0, std::fabs(step))) {
+      return false;
+    }
+  }
+  *inv_step = 1.0 / step;
+  return true;
+}
+
+// Fraction of value inside cell [axis[index], axis[index + 1]], clamped
+// to [0, 1] with fmin/fmax so out-of-range keys saturate at the table
+// edge without branching.
+double CellFraction(const std::vector<double> &axis, const size_t index,
+                    const double value) {
+  if (index + 1 >= axis.size()) {
+    return 0.0;
+  }
+  const double t = (value - axis[index]) / (axis[index + 1] - axis[index]);
+  return std::fmin(std::fmax(t, 0.0), 1.0);
+}
+
 }  // namespace
 
 namespace apollo {
@@ -34,13 +65,111 @@ bool Interpolation2D::Init(const DataType &xyz) {
     AERROR << "empty input.";
     return false;
   }
+  xyz_.clear();
   for (const auto &t : xyz) {
     xyz_[std::get<0>(t)][std::get<1>(t)] = std::get<2>(t);
   }
+  grid_valid_ = BuildGrid();
+  return true;
+}
+
+bool Interpolation2D::BuildGrid() {
+  grid_x_.clear();
+  grid_y_.clear();
+  values_.clear();
+  hint_x_ = 0;
+  hint_y_ = 0;
+
+  const auto &first_row = xyz_.begin()->second;
+  grid_y_.reserve(first_row.size());
+  for (const auto &yz : first_row) {
+    grid_y_.push_back(yz.first);
+  }
+  grid_x_.reserve(xyz_.size());
+  values_.reserve(xyz_.size() * grid_y_.size());
+  for (const auto &row : xyz_) {
+    if (row.second.size() != grid_y_.size()) {
+      return false;
+    }
+    grid_x_.push_back(row.first);
+    size_t iy = 0;
+    for (const auto &yz : row.second) {
+      if (yz.first != grid_y_[iy]) {
+        return false;
+      }
+      values_.push_back(yz.second);
+      ++iy;
+    }
+  }
+  uniform_x_ = IsUniformAxis(grid_x_, &inv_step_x_);
+  uniform_y_ = IsUniformAxis(grid_y_, &inv_step_y_);
   return true;
 }
 
 double Interpolation2D::Interpolate(const KeyType &xy) const {
+  if (grid_valid_) {
+    return InterpolateGrid(xy);
+  }
+  return InterpolateMap(xy);
+}
+
+void Interpolation2D::InterpolateBatch(const std::vector<KeyType> &xys,
+                                       std::vector<double> *results) const {
+  results->resize(xys.size());
+  for (size_t i = 0; i < xys.size(); ++i) {
+    (*results)[i] = Interpolate(xys[i]);
+  }
+}
+
+size_t Interpolation2D::FindCell(const std::vector<double> &axis,
+                                 const bool uniform, const double inv_step,
+                                 const double value, size_t *hint) const {
+  if (axis.size() < 2) {
+    return 0;
+  }
+  const size_t last_cell = axis.size() - 2;
+  if (uniform) {
+    const double pos = std::fmin(
+        std::fmax((value - axis.front()) * inv_step, 0.0),
+        static_cast<double>(last_cell));
+    return static_cast<size_t>(pos);
+  }
+  const size_t cached = *hint;
+  if (cached <= last_cell && axis[cached] <= value &&
+      value < axis[cached + 1]) {
+    return cached;
+  }
+  auto iter = std::upper_bound(axis.begin(), axis.end(), value);
+  size_t index = iter == axis.begin()
+                     ? 0
+                     : static_cast<size_t>(iter - axis.begin()) - 1;
+  index = std::min(index, last_cell);
+  *hint = index;
+  return index;
+}
+
+double Interpolation2D::InterpolateGrid(const KeyType &xy) const {
+  const size_t ix =
+      FindCell(grid_x_, uniform_x_, inv_step_x_, xy.first, &hint_x_);
+  const size_t iy =
+      FindCell(grid_y_, uniform_y_, inv_step_y_, xy.second, &hint_y_);
+  const double tx = CellFraction(grid_x_, ix, xy.first);
+  const double ty = CellFraction(grid_y_, iy, xy.second);
+
+  const size_t ny = grid_y_.size();
+  const size_t ix1 = std::min(ix + 1, grid_x_.size() - 1);
+  const size_t iy1 = std::min(iy + 1, ny - 1);
+  const double v00 = values_[ix * ny + iy];
+  const double v01 = values_[ix * ny + iy1];
+  const double v10 = values_[ix1 * ny + iy];
+  const double v11 = values_[ix1 * ny + iy1];
+
+  const double z0 = (1.0 - ty) * v00 + ty * v01;
+  const double z1 = (1.0 - ty) * v10 + ty * v11;
+  return (1.0 - tx) * z0 + tx * z1;
+}
+
+double Interpolation2D::InterpolateMap(const KeyType &xy) const {
   double max_x = xyz_.rbegin()->first;
   double min_x = xyz_.begin()->first;
   if (xy.first >= max_x - kDoubleEpsilon) {
@@ -58,7 +58,27 @@ class Interpolation2D {
    */
   double Interpolate(const KeyType &xy) const;
 
+  /**
+   * @brief linear interpolate a batch of 2D keys, e.g. the gains along
+   * the preview horizon. Consecutive keys usually land in the same grid
+   * cell, so the batch reuses the cached cell lookup.
+   * @param xys batch of interpolation keys
+   * @param results one interpolated value per key
+   */
+  void InterpolateBatch(const std::vector<KeyType> &xys,
+                        std::vector<double> *results) const;
+
  private:
+  bool BuildGrid();
+
+  double InterpolateGrid(const KeyType &xy) const;
+
+  double InterpolateMap(const KeyType &xy) const;
+
+  size_t FindCell(const std::vector<double> &axis, const bool uniform,
+                  const double inv_step, const double value,
+                  size_t *hint) const;
+
   double InterpolateYz(const std::map<double, double> &yz_table,
                        double y) const;
 
@@ -67,6 +87,25 @@ class Interpolation2D {
                           const double dist_after) const;
 
   std::map<double, std::map<double, double>> xyz_;
+
+  // Flattened rectangular grid built at Init when every x row shares the
+  // same y keys; falls back to the nested maps otherwise. values_ is
+  // row-major with x as the slow axis.
+  bool grid_valid_ = false;
+  bool uniform_x_ = false;
+  bool uniform_y_ = false;
+  double inv_step_x_ = 0.0;
+  double inv_step_y_ = 0.0;
+  std::vector<double> grid_x_;
+  std::vector<double> grid_y_;
+  std::vector<double> values_;
+
+  // Last-cell hints: gain lookups in consecutive control cycles almost
+  // always hit the same cell. The hints are plain caches matching the
+  // controllers' single-threaded query pattern; they are not
+  // synchronized for concurrent queries.
+  mutable size_t hint_x_ = 0;
+  mutable size_t hint_y_ = 0;
 };
 
 }  // namespace control
@@ -18,6 +18,7 @@
 
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "cyber/common/file.h"
 #include "cyber/common/log.h"
@@ -70,6 +71,37 @@ TEST_F(Interpolation2DTest, normal) {
   EXPECT_DOUBLE_EQ(30.5, estimator.Interpolate(std::make_pair(40, 40)));
 }
 
+TEST_F(Interpolation2DTest, rectangular_grid) {
+  // A complete rectangular table takes the flattened-grid fast path.
+  Interpolation2D::DataType xyz{
+      std::make_tuple(0.0, 0.0, 1.0), std::make_tuple(0.0, 2.0, 3.0),
+      std::make_tuple(10.0, 0.0, 5.0), std::make_tuple(10.0, 2.0, 7.0),
+      std::make_tuple(20.0, 0.0, 9.0), std::make_tuple(20.0, 2.0, 11.0)};
+
+  Interpolation2D estimator;
+  EXPECT_TRUE(estimator.Init(xyz));
+
+  for (const auto &elem : xyz) {
+    EXPECT_DOUBLE_EQ(std::get<2>(elem),
+                     estimator.Interpolate(
+                         std::make_pair(std::get<0>(elem), std::get<1>(elem))));
+  }
+
+  // bilinear interior point and out-of-range clamping
+  EXPECT_DOUBLE_EQ(4.0, estimator.Interpolate(std::make_pair(5.0, 1.0)));
+  EXPECT_DOUBLE_EQ(1.0, estimator.Interpolate(std::make_pair(-1.0, -1.0)));
+  EXPECT_DOUBLE_EQ(11.0, estimator.Interpolate(std::make_pair(30.0, 3.0)));
+
+  const std::vector<Interpolation2D::KeyType> keys{
+      {5.0, 1.0}, {5.0, 1.0}, {15.0, 1.0}, {30.0, 3.0}};
+  std::vector<double> results;
+  estimator.InterpolateBatch(keys, &results);
+  ASSERT_EQ(keys.size(), results.size());
+  for (size_t i = 0; i < keys.size(); ++i) {
+    EXPECT_DOUBLE_EQ(estimator.Interpolate(keys[i]), results[i]);
+  }
+}
+
 TEST_F(Interpolation2DTest, calibration_table) {
   const auto &calibration_table =
       control_conf_.lon_controller_conf().calibration_table();
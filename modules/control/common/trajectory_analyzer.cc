@@ -18,6 +18,7 @@
 
 #include <algorithm>
 #include <cmath>
+#include <limits>
 #include <utility>
 
 #include "Eigen/Core"
@@ -65,14 +66,25 @@ TrajectoryAnalyzer::TrajectoryAnalyzer(
   }
 }
 
-PathPoint TrajectoryAnalyzer::QueryMatchedPathPoint(const double x,
-                                                    const double y) const {
-  CHECK_GT(trajectory_points_.size(), 0);
-
-  double d_min = PointDistanceSquare(trajectory_points_.front(), x, y);
-  size_t index_min = 0;
+// Finds the index of the nearest trajectory point, scanning only a
+// window around the previous match when one exists. When the minimum
+// lands on the window border the window may have missed the true
+// nearest point, so the search falls back to a full scan.
+size_t TrajectoryAnalyzer::SearchNearestIndex(const double x,
+                                              const double y) const {
+  const size_t size = trajectory_points_.size();
+  size_t begin = 0;
+  size_t end = size;
+  if (last_index_min_ < size) {
+    begin = last_index_min_ > kNearestSearchBackward
+                ? last_index_min_ - kNearestSearchBackward
+                : 0;
+    end = std::min(size, last_index_min_ + kNearestSearchForward);
+  }
 
-  for (size_t i = 1; i < trajectory_points_.size(); ++i) {
+  double d_min = PointDistanceSquare(trajectory_points_[begin], x, y);
+  size_t index_min = begin;
+  for (size_t i = begin + 1; i < end; ++i) {
     double d_temp = PointDistanceSquare(trajectory_points_[i], x, y);
     if (d_temp < d_min) {
       d_min = d_temp;
@@ -80,19 +92,55 @@ PathPoint TrajectoryAnalyzer::QueryMatchedPathPoint(const double x,
     }
   }
 
+  if ((index_min == begin && begin != 0) ||
+      (index_min + 1 == end && end != size)) {
+    d_min = PointDistanceSquare(trajectory_points_.front(), x, y);
+    index_min = 0;
+    for (size_t i = 1; i < size; ++i) {
+      double d_temp = PointDistanceSquare(trajectory_points_[i], x, y);
+      if (d_temp < d_min) {
+        d_min = d_temp;
+        index_min = i;
+      }
+    }
+  }
+
+  last_index_min_ = index_min;
+  return index_min;
+}
+
+PathPoint TrajectoryAnalyzer::QueryMatchedPathPoint(const double x,
+                                                    const double y) const {
+  CHECK_GT(trajectory_points_.size(), 0);
+
+  // reuse the interpolated point when the same position is matched
+  // again, e.g. by another controller in the same cycle
+  if (matched_point_valid_ && x == matched_point_x_ && y == matched_point_y_) {
+    return matched_point_;
+  }
+
+  size_t index_min = SearchNearestIndex(x, y);
+
   size_t index_start = index_min == 0 ? index_min : index_min - 1;
   size_t index_end =
       index_min + 1 == trajectory_points_.size() ? index_min : index_min + 1;
 
   const double kEpsilon = 0.001;
+  PathPoint matched_point;
   if (index_start == index_end ||
       std::fabs(trajectory_points_[index_start].path_point().s() -
                 trajectory_points_[index_end].path_point().s()) <= kEpsilon) {
-    return TrajectoryPointToPathPoint(trajectory_points_[index_start]);
+    matched_point = TrajectoryPointToPathPoint(trajectory_points_[index_start]);
+  } else {
+    matched_point = FindMinDistancePoint(trajectory_points_[index_start],
+                                         trajectory_points_[index_end], x, y);
   }
 
-  return FindMinDistancePoint(trajectory_points_[index_start],
-                              trajectory_points_[index_end], x, y);
+  matched_point_valid_ = true;
+  matched_point_x_ = x;
+  matched_point_y_ = y;
+  matched_point_ = matched_point;
+  return matched_point;
 }
 
 // reference: Optimal trajectory generation for dynamic street scenarios in a
@@ -183,17 +231,21 @@ TrajectoryPoint TrajectoryAnalyzer::QueryNearestPointByRelativeTime(
 
 TrajectoryPoint TrajectoryAnalyzer::QueryNearestPointByPosition(
     const double x, const double y) const {
-  double d_min = PointDistanceSquare(trajectory_points_.front(), x, y);
-  size_t index_min = 0;
+  return trajectory_points_[SearchNearestIndex(x, y)];
+}
 
-  for (size_t i = 1; i < trajectory_points_.size(); ++i) {
-    double d_temp = PointDistanceSquare(trajectory_points_[i], x, y);
-    if (d_temp < d_min) {
-      d_min = d_temp;
-      index_min = i;
-    }
+std::vector<TrajectoryPoint> TrajectoryAnalyzer::QueryNearestPointsByPositions(
+    const std::vector<std::pair<double, double>> &positions) const {
+  std::vector<TrajectoryPoint> nearest_points;
+  nearest_points.reserve(positions.size());
+  // each search starts from the previous match, so an ordered batch
+  // walks the trajectory once
+  for (const auto &position : positions) {
+    nearest_points.push_back(
+        trajectory_points_[SearchNearestIndex(position.first,
+                                              position.second)]);
   }
-  return trajectory_points_[index_min];
+  return nearest_points;
 }
 
 const std::vector<TrajectoryPoint> &TrajectoryAnalyzer::trajectory_points()
@@ -238,6 +290,9 @@ PathPoint TrajectoryAnalyzer::FindMinDistancePoint(const TrajectoryPoint &p0,
 void TrajectoryAnalyzer::TrajectoryTransformToCOM(
     const double rear_to_com_distance) {
   CHECK_GT(trajectory_points_.size(), 0);
+  // the point coordinates change, drop the position-derived caches
+  last_index_min_ = std::numeric_limits<size_t>::max();
+  matched_point_valid_ = false;
   for (size_t i = 0; i < trajectory_points_.size(); ++i) {
     auto com = ComputeCOMPosition(rear_to_com_distance,
                                   trajectory_points_[i].path_point());
@@ -21,6 +21,8 @@
 
 #pragma once
 
+#include <limits>
+#include <utility>
 #include <vector>
 
 #include "modules/planning/proto/planning.pb.h"
@@ -65,7 +67,7 @@ class TrajectoryAnalyzer {
    * @brief get sequence number of the trajectory
    * @return sequence number.
    */
-  unsigned int seq_num() { return seq_num_; }
+  unsigned int seq_num() const { return seq_num_; }
 
   /**
    * @brief query a point of trajectory that its absolute time is closest
@@ -93,6 +95,17 @@ class TrajectoryAnalyzer {
   common::TrajectoryPoint QueryNearestPointByPosition(const double x,
                                                       const double y) const;
 
+  /**
+   * @brief query nearest trajectory points for an ordered sequence of
+   * positions, e.g. sampled along the preview horizon. The search for
+   * each position starts from the previous match, so the whole batch
+   * costs one forward pass over the trajectory.
+   * @param positions (x, y) pairs ordered along the driving direction
+   * @return the nearest trajectory point for each position
+   */
+  std::vector<common::TrajectoryPoint> QueryNearestPointsByPositions(
+      const std::vector<std::pair<double, double>> &positions) const;
+
   /**
    * @brief query a point on trajectory that its position is closest
    * to the given position.
@@ -148,12 +161,32 @@ class TrajectoryAnalyzer {
   const std::vector<common::TrajectoryPoint> &trajectory_points() const;
 
  private:
+  // Scan window around the last matched index. The query position moves
+  // continuously between 10ms control cycles, so the nearest point is
+  // expected close to the previous match.
+  static constexpr size_t kNearestSearchBackward = 10;
+  static constexpr size_t kNearestSearchForward = 40;
+
   common::PathPoint FindMinDistancePoint(const common::TrajectoryPoint &p0,
                                          const common::TrajectoryPoint &p1,
                                          const double x, const double y) const;
 
+  size_t SearchNearestIndex(const double x, const double y) const;
+
   std::vector<common::TrajectoryPoint> trajectory_points_;
 
+  // Last matched index used to narrow the nearest-point search. The
+  // analyzer is only used by a single controller thread, so the mutable
+  // caches need no locking.
+  mutable size_t last_index_min_ = std::numeric_limits<size_t>::max();
+  // Cache of the last matched path point; controllers may match the
+  // same vehicle position several times within one cycle and the
+  // interpolation behind it is comparatively expensive.
+  mutable bool matched_point_valid_ = false;
+  mutable double matched_point_x_ = 0.0;
+  mutable double matched_point_y_ = 0.0;
+  mutable common::PathPoint matched_point_;
+
   double header_time_ = 0.0;
   unsigned int seq_num_ = 0;
 };
@@ -322,6 +322,25 @@ bool ControlComponent::Proc() {
     }
   }
 
+  // overlay the hot chassis feedback fields from the shared-memory block
+  // written by canbus when it carries a newer snapshot than the channel
+  if (FLAGS_use_chassis_state_shm && chassis_state_shm_.InitReader()) {
+    canbus::ChassisStateBlock block;
+    if (chassis_state_shm_.Read(&block) &&
+        block.timestamp_sec >=
+            local_view_.chassis().header().timestamp_sec()) {
+      auto *chassis = local_view_.mutable_chassis();
+      chassis->set_speed_mps(block.speed_mps);
+      chassis->set_throttle_percentage(block.throttle_percentage);
+      chassis->set_brake_percentage(block.brake_percentage);
+      chassis->set_steering_percentage(block.steering_percentage);
+      chassis->set_gear_location(
+          static_cast<Chassis::GearPosition>(block.gear_location));
+      chassis->set_driving_mode(
+          static_cast<Chassis::DrivingMode>(block.driving_mode));
+    }
+  }
+
   // use control submodules
   if (FLAGS_use_control_submodules) {
     local_view_.mutable_header()->set_lidar_timestamp(
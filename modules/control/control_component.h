@@ -22,6 +22,7 @@
 #include "cyber/class_loader/class_loader.h"
 #include "cyber/component/timer_component.h"
 
+#include "modules/canbus/common/chassis_state_shm.h"
 #include "modules/canbus/proto/chassis.pb.h"
 #include "modules/common/monitor_log/monitor_log_buffer.h"
 #include "modules/control/proto/control_cmd.pb.h"
@@ -105,6 +106,8 @@ class ControlComponent final : public apollo::cyber::TimerComponent {
   std::mutex mutex_;
 
   std::shared_ptr<cyber::Reader<apollo::canbus::Chassis>> chassis_reader_;
+  // shared-memory fast path for the hot chassis feedback fields
+  canbus::ChassisStateShm chassis_state_shm_;
   std::shared_ptr<cyber::Reader<PadMessage>> pad_msg_reader_;
   std::shared_ptr<cyber::Reader<apollo::localization::LocalizationEstimate>>
       localization_reader_;
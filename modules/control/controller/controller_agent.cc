@@ -16,9 +16,11 @@
 
 #include "modules/control/controller/controller_agent.h"
 
+#include <chrono>
 #include <utility>
 
 #include "cyber/common/log.h"
+#include "cyber/task/task.h"
 #include "modules/common/time/time.h"
 #include "modules/control/common/control_gflags.h"
 #include "modules/control/controller/lat_controller.h"
@@ -93,6 +95,15 @@ Status ControllerAgent::Init(std::shared_ptr<DependencyInjector> injector,
     }
     AINFO << "Controller <" << controller->Name() << "> init done!";
   }
+  if (FLAGS_enable_control_deadline) {
+    pending_runs_.resize(controller_list_.size());
+    for (auto &controller : controller_list_) {
+      latency_recorders_.emplace_back(
+          new common::LatencyRecorder("control_" + controller->Name()));
+    }
+    AINFO << "Controller deadline mode enabled, budget is "
+          << FLAGS_control_deadline_ms << " ms.";
+  }
   return Status::OK();
 }
 
@@ -100,6 +111,10 @@ Status ControllerAgent::ComputeControlCommand(
     const localization::LocalizationEstimate *localization,
     const canbus::Chassis *chassis, const planning::ADCTrajectory *trajectory,
     control::ControlCommand *cmd) {
+  if (FLAGS_enable_control_deadline) {
+    return ComputeControlCommandWithDeadline(localization, chassis, trajectory,
+                                             cmd);
+  }
   for (auto &controller : controller_list_) {
     ADEBUG << "controller:" << controller->Name() << " processing ...";
     double start_timestamp = Clock::NowInSeconds();
@@ -114,6 +129,105 @@ Status ControllerAgent::ComputeControlCommand(
   return Status::OK();
 }
 
+Status ControllerAgent::ComputeControlCommandWithDeadline(
+    const localization::LocalizationEstimate *localization,
+    const canbus::Chassis *chassis, const planning::ADCTrajectory *trajectory,
+    control::ControlCommand *cmd) {
+  const absl::Time chain_start = absl::Now();
+  const absl::Duration budget = absl::Milliseconds(FLAGS_control_deadline_ms);
+  const uint64_t message_id = trajectory->header().lidar_timestamp();
+
+  // Inputs are copied once per cycle so a solve running past its deadline
+  // never reads the next cycle's messages.
+  auto localization_copy =
+      std::make_shared<localization::LocalizationEstimate>(*localization);
+  auto chassis_copy = std::make_shared<canbus::Chassis>(*chassis);
+  auto trajectory_copy =
+      std::make_shared<planning::ADCTrajectory>(*trajectory);
+
+  bool overrun = false;
+  for (size_t i = 0; i < controller_list_.size(); ++i) {
+    auto *controller = controller_list_[i].get();
+    auto &pending = pending_runs_[i];
+    if (pending.future.valid()) {
+      if (pending.future.wait_for(std::chrono::seconds(0)) !=
+          std::future_status::ready) {
+        // A controller must never run concurrently with itself; keep
+        // falling back until the late solve finishes.
+        AWARN << "controller: " << controller->Name()
+              << " still running past its deadline, skipped this cycle.";
+        overrun = true;
+        continue;
+      }
+      // Collect the late result: the stale command is discarded, but the
+      // full solve time still reaches the latency histogram.
+      pending.future.get();
+      latency_recorders_[i]->AppendLatencyRecord(pending.message_id,
+                                                 pending.begin_time,
+                                                 absl::Now());
+      pending.scratch = nullptr;
+    }
+
+    auto scratch = std::make_shared<ControlCommand>(*cmd);
+    pending.begin_time = absl::Now();
+    pending.message_id = message_id;
+    pending.scratch = scratch;
+    pending.future = cyber::Async([controller, localization_copy, chassis_copy,
+                                   trajectory_copy, scratch]() {
+      return controller->ComputeControlCommand(localization_copy.get(),
+                                               chassis_copy.get(),
+                                               trajectory_copy.get(),
+                                               scratch.get());
+    });
+
+    const absl::Duration remaining = budget - (absl::Now() - chain_start);
+    if (remaining <= absl::ZeroDuration() ||
+        pending.future.wait_for(std::chrono::microseconds(
+            absl::ToInt64Microseconds(remaining))) !=
+            std::future_status::ready) {
+      AWARN << "controller: " << controller->Name() << " missed the "
+            << FLAGS_control_deadline_ms << " ms deadline.";
+      overrun = true;
+      continue;
+    }
+
+    Status status = pending.future.get();
+    const absl::Time end_time = absl::Now();
+    latency_recorders_[i]->AppendLatencyRecord(pending.message_id,
+                                               pending.begin_time, end_time);
+    const double time_diff_ms =
+        absl::ToDoubleMilliseconds(end_time - pending.begin_time);
+    ADEBUG << "controller: " << controller->Name()
+           << " calculation time is: " << time_diff_ms << " ms.";
+    cmd->mutable_latency_stats()->add_controller_time_ms(time_diff_ms);
+    if (!status.ok()) {
+      return status;
+    }
+    cmd->CopyFrom(*scratch);
+    pending.scratch = nullptr;
+  }
+
+  if (!overrun) {
+    last_cmd_.CopyFrom(*cmd);
+    has_last_cmd_ = true;
+    return Status::OK();
+  }
+  if (!has_last_cmd_) {
+    return Status(ErrorCode::CONTROL_COMPUTE_ERROR,
+                  "Controller deadline missed with no previous command");
+  }
+  // Zero-order hold of the previous cycle's actuation: a one-cycle-old
+  // command tracks the same trajectory, while a partially refreshed one
+  // could pair stale steering with fresh acceleration.
+  cmd->set_steering_target(last_cmd_.steering_target());
+  cmd->set_steering_rate(last_cmd_.steering_rate());
+  cmd->set_throttle(last_cmd_.throttle());
+  cmd->set_brake(last_cmd_.brake());
+  cmd->set_acceleration(last_cmd_.acceleration());
+  cmd->set_gear_location(last_cmd_.gear_location());
+  return Status::OK();
+}
+
 Status ControllerAgent::Reset() {
   for (auto &controller : controller_list_) {
     ADEBUG << "controller:" << controller->Name() << " reset...";
@@ -21,9 +21,11 @@
 
 #pragma once
 
+#include <future>
 #include <memory>
 #include <vector>
 
+#include "modules/common/latency_recorder/latency_recorder.h"
 #include "modules/common/util/factory.h"
 #include "modules/control/common/dependency_injector.h"
 #include "modules/control/controller/controller.h"
@@ -83,11 +85,41 @@ class ControllerAgent {
 
   common::Status InitializeConf(const ControlConf *control_conf);
 
+  /**
+   * @brief run the controller chain under a per-cycle deadline. Each
+   *        controller solves into a scratch command on a cyber task; a solve
+   *        that misses the deadline keeps running in the background and its
+   *        stale result is discarded, while the published command falls back
+   *        to the previous cycle's actuation.
+   */
+  common::Status ComputeControlCommandWithDeadline(
+      const localization::LocalizationEstimate *localization,
+      const canbus::Chassis *chassis, const planning::ADCTrajectory *trajectory,
+      control::ControlCommand *cmd);
+
+  /**
+   * @struct PendingControllerRun
+   * @brief bookkeeping of one in-flight controller solve.
+   */
+  struct PendingControllerRun {
+    std::future<common::Status> future;
+    std::shared_ptr<ControlCommand> scratch;
+    absl::Time begin_time;
+    uint64_t message_id = 0;
+  };
+
   const ControlConf *control_conf_ = nullptr;
   common::util::Factory<ControlConf::ControllerType, Controller>
       controller_factory_;
   std::vector<std::unique_ptr<Controller>> controller_list_;
   std::shared_ptr<DependencyInjector> injector_ = nullptr;
+
+  // Deadline mode state; sized with controller_list_ when
+  // FLAGS_enable_control_deadline is set.
+  std::vector<PendingControllerRun> pending_runs_;
+  std::vector<std::unique_ptr<common::LatencyRecorder>> latency_recorders_;
+  ControlCommand last_cmd_;
+  bool has_last_cmd_ = false;
 };
 
 }  // namespace control
@@ -397,13 +397,37 @@ void LonController::ComputeLongitudinalErrors(
   double d_dot_matched = 0.0;
 
   auto vehicle_state = injector_->vehicle_state();
-  auto matched_point = trajectory_analyzer->QueryMatchedPathPoint(
-      vehicle_state->x(), vehicle_state->y());
-
-  trajectory_analyzer->ToTrajectoryFrame(
-      vehicle_state->x(), vehicle_state->y(), vehicle_state->heading(),
-      vehicle_state->linear_velocity(), matched_point, &s_matched,
-      &s_dot_matched, &d_matched, &d_dot_matched);
+  auto *state_cache = injector_->computed_state_cache();
+
+  common::PathPoint matched_point;
+  if (state_cache->IsCurrent(trajectory_analyzer->seq_num(),
+                             vehicle_state->timestamp()) &&
+      state_cache->frenet_valid) {
+    // another consumer already projected this vehicle state onto the
+    // trajectory within this cycle
+    matched_point = state_cache->matched_path_point;
+    s_matched = state_cache->station;
+    s_dot_matched = state_cache->station_dot;
+    d_matched = state_cache->lateral;
+    d_dot_matched = state_cache->lateral_dot;
+  } else {
+    matched_point = trajectory_analyzer->QueryMatchedPathPoint(
+        vehicle_state->x(), vehicle_state->y());
+
+    trajectory_analyzer->ToTrajectoryFrame(
+        vehicle_state->x(), vehicle_state->y(), vehicle_state->heading(),
+        vehicle_state->linear_velocity(), matched_point, &s_matched,
+        &s_dot_matched, &d_matched, &d_dot_matched);
+
+    state_cache->ResetCycle(trajectory_analyzer->seq_num(),
+                            vehicle_state->timestamp());
+    state_cache->frenet_valid = true;
+    state_cache->matched_path_point = matched_point;
+    state_cache->station = s_matched;
+    state_cache->station_dot = s_dot_matched;
+    state_cache->lateral = d_matched;
+    state_cache->lateral_dot = d_dot_matched;
+  }
 
   double current_control_time = Clock::NowInSeconds();
   double preview_control_time = current_control_time + preview_time;
@@ -434,6 +458,7 @@ void LonController::ComputeLongitudinalErrors(
 
   double heading_error = common::math::NormalizeAngle(vehicle_state->heading() -
                                                       matched_point.theta());
+  state_cache->heading_error = heading_error;
   double lon_speed = vehicle_state->linear_velocity() * std::cos(heading_error);
   double lon_acceleration =
       vehicle_state->linear_acceleration() * std::cos(heading_error);
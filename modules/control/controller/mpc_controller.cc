@@ -394,12 +394,19 @@ Status MPCController::ComputeControlCommand(
 
   std::vector<double> control_cmd(controls_, 0);
   if (FLAGS_use_osqp_solver) {
-    apollo::common::math::MpcOsqp mpc_osqp(
-        matrix_ad_, matrix_bd_, matrix_q_updated_, matrix_r_updated_,
-        matrix_state_, lower_bound, upper_bound, lower_state_bound,
-        upper_state_bound, reference_state, mpc_max_iteration_, horizon_,
-        mpc_eps_);
-    if (!mpc_osqp.Solve(&control_cmd)) {
+    if (mpc_osqp_ == nullptr) {
+      mpc_osqp_.reset(new apollo::common::math::MpcOsqp(
+          matrix_ad_, matrix_bd_, matrix_q_updated_, matrix_r_updated_,
+          matrix_state_, lower_bound, upper_bound, lower_state_bound,
+          upper_state_bound, reference_state, mpc_max_iteration_, horizon_,
+          mpc_eps_));
+    } else {
+      mpc_osqp_->UpdateProblem(matrix_ad_, matrix_bd_, matrix_q_updated_,
+                               matrix_r_updated_, matrix_state_, lower_bound,
+                               upper_bound, lower_state_bound,
+                               upper_state_bound, reference_state);
+    }
+    if (!mpc_osqp_->Solve(&control_cmd)) {
       AERROR << "MPC OSQP solver failed";
     } else {
       ADEBUG << "MPC OSQP problem solved! ";
@@ -548,6 +555,9 @@ Status MPCController::ComputeControlCommand(
 Status MPCController::Reset() {
   previous_heading_error_ = 0.0;
   previous_lateral_error_ = 0.0;
+  // drop the cached osqp workspace; its warm start would be stale after
+  // a reset
+  mpc_osqp_.reset();
   return Status::OK();
 }
 
@@ -691,14 +701,38 @@ void MPCController::ComputeLongitudinalErrors(
   double d_matched = 0.0;
   double d_dot_matched = 0.0;
 
-  const auto matched_point = trajectory_analyzer->QueryMatchedPathPoint(
-      injector_->vehicle_state()->x(), injector_->vehicle_state()->y());
-
-  trajectory_analyzer->ToTrajectoryFrame(
-      injector_->vehicle_state()->x(), injector_->vehicle_state()->y(),
-      injector_->vehicle_state()->heading(),
-      injector_->vehicle_state()->linear_velocity(), matched_point, &s_matched,
-      &s_dot_matched, &d_matched, &d_dot_matched);
+  auto *state_cache = injector_->computed_state_cache();
+
+  common::PathPoint matched_point;
+  if (state_cache->IsCurrent(trajectory_analyzer->seq_num(),
+                             injector_->vehicle_state()->timestamp()) &&
+      state_cache->frenet_valid) {
+    // another consumer already projected this vehicle state onto the
+    // trajectory within this cycle
+    matched_point = state_cache->matched_path_point;
+    s_matched = state_cache->station;
+    s_dot_matched = state_cache->station_dot;
+    d_matched = state_cache->lateral;
+    d_dot_matched = state_cache->lateral_dot;
+  } else {
+    matched_point = trajectory_analyzer->QueryMatchedPathPoint(
+        injector_->vehicle_state()->x(), injector_->vehicle_state()->y());
+
+    trajectory_analyzer->ToTrajectoryFrame(
+        injector_->vehicle_state()->x(), injector_->vehicle_state()->y(),
+        injector_->vehicle_state()->heading(),
+        injector_->vehicle_state()->linear_velocity(), matched_point,
+        &s_matched, &s_dot_matched, &d_matched, &d_dot_matched);
+
+    state_cache->ResetCycle(trajectory_analyzer->seq_num(),
+                            injector_->vehicle_state()->timestamp());
+    state_cache->frenet_valid = true;
+    state_cache->matched_path_point = matched_point;
+    state_cache->station = s_matched;
+    state_cache->station_dot = s_dot_matched;
+    state_cache->lateral = d_matched;
+    state_cache->lateral_dot = d_dot_matched;
+  }
 
   const double current_control_time = Clock::NowInSeconds();
 
@@ -713,6 +747,7 @@ void MPCController::ComputeLongitudinalErrors(
   const double linear_a = injector_->vehicle_state()->linear_acceleration();
   double heading_error = common::math::NormalizeAngle(
       injector_->vehicle_state()->heading() - matched_point.theta());
+  state_cache->heading_error = heading_error;
   double lon_speed = linear_v * std::cos(heading_error);
   double lon_acceleration = linear_a * std::cos(heading_error);
   double one_minus_kappa_lat_error = 1 - reference_point.path_point().kappa() *
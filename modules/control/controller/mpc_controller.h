@@ -230,6 +230,10 @@ class MPCController : public Controller {
   // parameters for mpc solver; threshold for computation
   double mpc_eps_ = 0.0;
 
+  // osqp solver kept across control cycles, so the workspace is set up
+  // once and later cycles only update problem data and hot-start
+  std::unique_ptr<common::math::MpcOsqp> mpc_osqp_;
+
   common::DigitalFilter digital_filter_;
 
   std::unique_ptr<Interpolation1D> lat_err_interpolation_;
@@ -133,6 +133,14 @@ Status LatLonControllerSubmodule::ProduceControlCoreCommand(
     AINFO_EVERY(100) << "Reset Controllers in Manual Mode";
   }
 
+  // refresh the shared vehicle state once per cycle; both controllers
+  // and the computed-state cache work off this update
+  injector_->vehicle_state()->Update(local_view.localization(),
+                                     local_view.chassis());
+  injector_->computed_state_cache()->ResetCycle(
+      local_view.trajectory().header().sequence_num(),
+      injector_->vehicle_state()->timestamp());
+
   // fill out control command sequentially
   Status lateral_status = lateral_controller_.ComputeControlCommand(
       &local_view.localization(), &local_view.chassis(),
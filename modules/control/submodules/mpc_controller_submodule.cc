@@ -120,6 +120,14 @@ Status MPCControllerSubmodule::ProduceControlCoreCommand(
     AINFO_EVERY(100) << "Reset Controllers in Manual Mode";
   }
 
+  // refresh the shared vehicle state once per cycle; the controller and
+  // the computed-state cache work off this update
+  injector_->vehicle_state()->Update(local_view.localization(),
+                                     local_view.chassis());
+  injector_->computed_state_cache()->ResetCycle(
+      local_view.trajectory().header().sequence_num(),
+      injector_->vehicle_state()->timestamp());
+
   Status status = mpc_controller_.ComputeControlCommand(
       &local_view.localization(), &local_view.chassis(),
       &local_view.trajectory(), control_core_command);
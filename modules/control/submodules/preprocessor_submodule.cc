@@ -222,7 +222,11 @@ Status PreprocessorSubmodule::CheckInput(LocalView *local_view) {
   }
   {
     std::lock_guard<std::mutex> lock(mutex_);
-    for (auto trajectory_point : local_view->trajectory().trajectory_point()) {
+    // clamp trivial speeds in place; the points used to be copied one
+    // by one, which dropped the clamping and cost a full pass of
+    // trajectory point copies per cycle
+    for (auto &trajectory_point :
+         *local_view->mutable_trajectory()->mutable_trajectory_point()) {
       if (std::abs(trajectory_point.v()) <
               control_common_conf_.minimum_speed_resolution() &&
           std::abs(trajectory_point.a()) <
@@ -234,6 +238,11 @@ Status PreprocessorSubmodule::CheckInput(LocalView *local_view) {
   }
   injector_->vehicle_state()->Update(local_view->localization(),
                                      local_view->chassis());
+  // stamp the computed-state cache for this cycle; in-process consumers
+  // fill it on first use
+  injector_->computed_state_cache()->ResetCycle(
+      local_view->trajectory().header().sequence_num(),
+      injector_->vehicle_state()->timestamp());
 
   return Status::OK();
 }
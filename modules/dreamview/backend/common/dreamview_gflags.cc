@@ -58,6 +58,15 @@ DEFINE_double(sim_map_radius, 200.0,
               "The radius within which Dreamview will find all the map "
               "elements around the car.");
 
+DEFINE_double(sim_map_element_update_distance, 2.0,
+              "The distance the car has to move away from the last map "
+              "element collection before the surrounding element ids are "
+              "collected again.");
+
+DEFINE_double(sim_map_element_max_age_sec, 5.0,
+              "Maximum age of the cached surrounding map element ids before "
+              "they are collected again regardless of movement.");
+
 DEFINE_bool(enable_update_size_check, true,
             "True to check if the update byte number is less than threshold");
 
@@ -76,6 +85,11 @@ DEFINE_double(voxel_filter_size, 0.3, "VoxelGrid pointcloud filter leaf size");
 DEFINE_double(voxel_filter_height, 0.2,
               "VoxelGrid pointcloud filter leaf height");
 
+DEFINE_double(point_cloud_downsample_voxel_size, 0.3,
+              "Edge length in meters of the voxels used to downsample the "
+              "point cloud streamed to the frontend. Zero streams the full "
+              "cloud. Clients may override this at runtime.");
+
 DEFINE_double(system_status_lifetime_seconds, 30,
               "Lifetime of a valid SystemStatus message. It's more like a "
               "replay message if the timestamp is old, where we should ignore "
@@ -38,6 +38,10 @@ DECLARE_string(ssl_certificate);
 
 DECLARE_double(sim_map_radius);
 
+DECLARE_double(sim_map_element_update_distance);
+
+DECLARE_double(sim_map_element_max_age_sec);
+
 DECLARE_int32(dreamview_worker_num);
 
 DECLARE_bool(enable_update_size_check);
@@ -52,6 +56,8 @@ DECLARE_double(voxel_filter_size);
 
 DECLARE_double(voxel_filter_height);
 
+DECLARE_double(point_cloud_downsample_voxel_size);
+
 DECLARE_double(system_status_lifetime_seconds);
 
 DECLARE_string(lidar_height_yaml);
@@ -125,6 +125,7 @@ void DataCollectionMonitor::LoadConfiguration() {
       << data_collection_config_path;
 
   ConstructCategories();
+  CompileCategories();
 
   ADEBUG << "Configuration loaded.";
 }
@@ -175,11 +176,82 @@ void DataCollectionMonitor::ConstructCategoriesHelper(
   }
 }
 
+// Resolves every criterion once: the chassis field descriptor is looked
+// up by name here instead of on every message, and target values coming
+// from the vehicle configuration are fixed since the configuration does
+// not change while the monitor runs. Categories referencing unknown or
+// unsupported fields are marked invalid and never comply.
+void DataCollectionMonitor::CompileCategories() {
+  scenario_to_compiled_categories_.clear();
+  criterion_fields_.clear();
+
+  const auto& vehicle_param = VehicleConfigHelper::GetConfig().vehicle_param();
+  const auto* vehicle_param_descriptor = vehicle_param.GetDescriptor();
+  const auto* vehicle_param_reflection = vehicle_param.GetReflection();
+  const auto* chassis_descriptor = Chassis::descriptor();
+
+  std::unordered_map<std::string, int> field_index_by_name;
+  for (const auto& scenario_iter : scenario_to_categories_) {
+    for (const auto& category_iter : scenario_iter.second) {
+      CompiledCategory& compiled =
+          scenario_to_compiled_categories_[scenario_iter.first]
+                                          [category_iter.first];
+      for (const auto& range : category_iter.second) {
+        for (const auto& criterion : range.criterion()) {
+          const auto* field_descriptor =
+              chassis_descriptor->FindFieldByName(criterion.field());
+          if (field_descriptor == nullptr) {
+            AERROR << "Chassis has no field named " << criterion.field();
+            compiled.valid = false;
+            continue;
+          }
+          const auto cpp_type = field_descriptor->cpp_type();
+          if (cpp_type != FieldDescriptor::CppType::CPPTYPE_FLOAT &&
+              cpp_type != FieldDescriptor::CppType::CPPTYPE_DOUBLE &&
+              cpp_type != FieldDescriptor::CppType::CPPTYPE_ENUM) {
+            AERROR << criterion.field()
+                   << " has unsupported conversion type: " << cpp_type;
+            compiled.valid = false;
+            continue;
+          }
+
+          CompiledCriterion compiled_criterion;
+          auto index_iter = field_index_by_name.find(criterion.field());
+          if (index_iter == field_index_by_name.end()) {
+            compiled_criterion.field_index =
+                static_cast<int>(criterion_fields_.size());
+            field_index_by_name[criterion.field()] =
+                compiled_criterion.field_index;
+            criterion_fields_.push_back(field_descriptor);
+          } else {
+            compiled_criterion.field_index = index_iter->second;
+          }
+          compiled_criterion.comparison_operator =
+              criterion.comparison_operator();
+
+          if (criterion.has_value()) {
+            compiled_criterion.target_value = criterion.value();
+          } else if (!GetProtobufFloatByFieldName(
+                         vehicle_param, vehicle_param_descriptor,
+                         vehicle_param_reflection, criterion.vehicle_config(),
+                         &compiled_criterion.target_value)) {
+            compiled.valid = false;
+            continue;
+          }
+          compiled.criteria.push_back(compiled_criterion);
+        }
+      }
+    }
+  }
+}
+
 void DataCollectionMonitor::Start() {
   if (!enabled_) {
     category_consecutive_frame_count_.clear();
     category_frame_count_.clear();
     current_progress_json_.clear();
+    pending_progress_.clear();
+    frames_since_snapshot_ = 0;
     LoadConfiguration();
   }
   enabled_ = true;
@@ -197,22 +269,47 @@ void DataCollectionMonitor::OnChassis(const std::shared_ptr<Chassis>& chassis) {
     return;
   }
 
+  // Extract every referenced chassis field once per message instead of
+  // once per (category, criterion)
+  std::vector<float> field_values(criterion_fields_.size(), 0.0f);
+  const auto* chassis_reflection = chassis->GetReflection();
+  for (size_t i = 0; i < criterion_fields_.size(); ++i) {
+    const auto* field_descriptor = criterion_fields_[i];
+    switch (field_descriptor->cpp_type()) {
+      case FieldDescriptor::CppType::CPPTYPE_FLOAT:
+        field_values[i] =
+            chassis_reflection->GetFloat(*chassis, field_descriptor);
+        break;
+      case FieldDescriptor::CppType::CPPTYPE_DOUBLE:
+        field_values[i] = static_cast<float>(
+            chassis_reflection->GetDouble(*chassis, field_descriptor));
+        break;
+      case FieldDescriptor::CppType::CPPTYPE_ENUM:
+        field_values[i] = static_cast<float>(
+            chassis_reflection->GetEnumValue(*chassis, field_descriptor));
+        break;
+      default:
+        break;
+    }
+  }
+
+  std::vector<ProgressUpdate> changed;
   const size_t frame_threshold = data_collection_table_.frame_threshold();
   const auto total_frames = data_collection_table_.total_frames();
-  for (const auto& scenario_iter : scenario_to_categories_) {
+  for (const auto& scenario_iter : scenario_to_compiled_categories_) {
     const std::string& scenario_name = scenario_iter.first;
     const auto& categories = scenario_iter.second;
 
     for (const auto& category_iter : categories) {
       const std::string& category_name = category_iter.first;
-      const Category& category = category_iter.second;
+      const CompiledCategory& category = category_iter.second;
 
       // This category is done, skip
       if (category_frame_count_[scenario_name][category_name] >= total_frames) {
         continue;
       }
 
-      if (!IsCompliedWithCriteria(chassis, category)) {
+      if (!IsCompliedWithCriteria(field_values, category)) {
         category_consecutive_frame_count_[scenario_name][category_name] = 0;
         continue;
       }
@@ -227,61 +324,59 @@ void DataCollectionMonitor::OnChassis(const std::shared_ptr<Chassis>& chassis) {
         category_frame_count_[scenario_name][category_name] += 1;
       }
 
-      // Update category progress
+      // Record the category progress change; the json is only touched
+      // when a snapshot is published
       const double progress_percentage =
           100.0 *
           static_cast<double>(
               category_frame_count_[scenario_name][category_name]) /
           static_cast<double>(total_frames);
-      {
-        boost::unique_lock<boost::shared_mutex> writer_lock(mutex_);
-        current_progress_json_[scenario_name][category_name] =
-            progress_percentage;
-      }
+      changed.push_back({&scenario_name, &category_name, progress_percentage});
+    }
+  }
+
+  ++frames_since_snapshot_;
+  if (changed.empty() && frames_since_snapshot_ < kSnapshotIntervalFrames) {
+    return;
+  }
+  {
+    boost::unique_lock<boost::shared_mutex> writer_lock(mutex_);
+    pending_progress_.insert(pending_progress_.end(), changed.begin(),
+                             changed.end());
+    if (frames_since_snapshot_ >= kSnapshotIntervalFrames) {
+      frames_since_snapshot_ = 0;
+      PublishProgressSnapshot();
     }
   }
 }
 
 bool DataCollectionMonitor::IsCompliedWithCriteria(
-    const std::shared_ptr<Chassis>& chassis, const Category& category) {
-  const auto& vehicle_param = VehicleConfigHelper::GetConfig().vehicle_param();
-  const auto* vehicle_param_descriptor = vehicle_param.GetDescriptor();
-  const auto* vehicle_param_reflection = vehicle_param.GetReflection();
-
-  const auto* chassis_descriptor = chassis->GetDescriptor();
-  const auto* chassis_reflection = chassis->GetReflection();
-
-  for (const auto& range : category) {
-    for (const auto& criterion : range.criterion()) {
-      float target_value;
-      if (criterion.has_value()) {
-        target_value = criterion.value();
-      } else if (!GetProtobufFloatByFieldName(
-                     vehicle_param, vehicle_param_descriptor,
-                     vehicle_param_reflection, criterion.vehicle_config(),
-                     &target_value)) {
-        return false;
-      }
-
-      float actual_value;
-      if (!GetProtobufFloatByFieldName(*chassis, chassis_descriptor,
-                                       chassis_reflection, criterion.field(),
-                                       &actual_value)) {
-        return false;
-      }
-
-      if (!IsCompliedWithCriterion(
-              actual_value, criterion.comparison_operator(), target_value)) {
-        return false;
-      }
+    const std::vector<float>& field_values, const CompiledCategory& category) {
+  if (!category.valid) {
+    return false;
+  }
+  for (const auto& criterion : category.criteria) {
+    if (!IsCompliedWithCriterion(field_values[criterion.field_index],
+                                 criterion.comparison_operator,
+                                 criterion.target_value)) {
+      return false;
     }
   }
-
   return true;
 }
 
+void DataCollectionMonitor::PublishProgressSnapshot() {
+  for (const auto& update : pending_progress_) {
+    current_progress_json_[*update.scenario_name][*update.category_name] =
+        update.percentage;
+  }
+  pending_progress_.clear();
+}
+
 nlohmann::json DataCollectionMonitor::GetProgressAsJson() {
   boost::unique_lock<boost::shared_mutex> reader_lock(mutex_);
+  // publish on demand so readers never see a stale snapshot
+  PublishProgressSnapshot();
   return current_progress_json_;
 }
 
@@ -26,6 +26,7 @@
 #include <vector>
 #include <boost/thread/shared_mutex.hpp>
 
+#include "google/protobuf/descriptor.h"
 #include "gtest/gtest_prod.h"
 #include "nlohmann/json.hpp"
 
@@ -78,6 +79,33 @@ class DataCollectionMonitor {
   nlohmann::json GetProgressAsJson();
 
  private:
+  /**
+   * @brief A criterion compiled at configuration load time: the chassis
+   * field descriptor and the target value (literal or vehicle_param
+   * lookup) are resolved once, so evaluating a category on the 100Hz
+   * chassis path reduces to a few float comparisons.
+   */
+  struct CompiledCriterion {
+    int field_index = -1;
+    ComparisonOperator comparison_operator = ComparisonOperator::EQUAL;
+    float target_value = 0.0f;
+  };
+  struct CompiledCategory {
+    bool valid = true;
+    std::vector<CompiledCriterion> criteria;
+  };
+
+  // A progress change not yet published into current_progress_json_;
+  // the name pointers refer to keys of scenario_to_compiled_categories_
+  struct ProgressUpdate {
+    const std::string* scenario_name;
+    const std::string* category_name;
+    double percentage;
+  };
+
+  // Number of chassis messages between two snapshot publications
+  static constexpr size_t kSnapshotIntervalFrames = 20;
+
   void InitReaders();
   void LoadConfiguration();
   void ConstructCategories();
@@ -85,10 +113,13 @@ class DataCollectionMonitor {
                                  const Scenario& scenario, int feature_idx,
                                  std::string current_category_name,
                                  const Category& current_category);
+  void CompileCategories();
   void OnChassis(const std::shared_ptr<apollo::canbus::Chassis>& chassis);
-  bool IsCompliedWithCriteria(
-      const std::shared_ptr<apollo::canbus::Chassis>& chassis,
-      const Category& category);
+  bool IsCompliedWithCriteria(const std::vector<float>& field_values,
+                              const CompiledCategory& category);
+  // Flushes pending progress updates into current_progress_json_.
+  // The caller must hold a unique lock on mutex_.
+  void PublishProgressSnapshot();
 
   std::unique_ptr<cyber::Node> node_;
 
@@ -103,6 +134,16 @@ class DataCollectionMonitor {
   std::unordered_map<std::string, std::unordered_map<std::string, Category>>
       scenario_to_categories_;
 
+  // Same structure as scenario_to_categories_ with every criterion
+  // pre-resolved for the chassis path
+  std::unordered_map<std::string,
+                     std::unordered_map<std::string, CompiledCategory>>
+      scenario_to_compiled_categories_;
+
+  // Distinct chassis fields referenced by any criterion; their values
+  // are extracted through reflection once per message
+  std::vector<const google::protobuf::FieldDescriptor*> criterion_fields_;
+
   // Number of frames that has been collected for each (scenario, category)
   std::unordered_map<std::string, std::unordered_map<std::string, size_t>>
       category_frame_count_;
@@ -115,6 +156,12 @@ class DataCollectionMonitor {
   // Store overall and each category progress in percentage
   nlohmann::json current_progress_json_;
 
+  // Progress changes accumulated since the last snapshot publication,
+  // protected by mutex_
+  std::vector<ProgressUpdate> pending_progress_;
+  // Only touched by the chassis callback
+  size_t frames_since_snapshot_ = 0;
+
   // Mutex to protect concurrent access to current_progress_json_.
   // NOTE: Use boost until we have std version of rwlock support.
   boost::shared_mutex mutex_;
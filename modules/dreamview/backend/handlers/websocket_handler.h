@@ -132,6 +132,14 @@ class WebSocketHandler : public CivetWebSocketHandler {
   bool SendBinaryData(Connection *conn, const std::string &data,
                       bool skippable = false);
 
+  /**
+   * @brief Returns true if at least one client is currently connected.
+   */
+  bool HasConnections() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return !connections_.empty();
+  }
+
   /**
    * @brief Add a new message handler for a message type.
    * @param type The name/key to identify the message type.
@@ -17,6 +17,7 @@
 #include "modules/dreamview/backend/map/map_service.h"
 
 #include <algorithm>
+#include <cmath>
 #include <fstream>
 #include <utility>
 
@@ -79,9 +80,81 @@ void ExtractRoadAndLaneIds(const std::vector<LaneInfoConstPtr> &lanes,
   std::sort(road_ids->begin(), road_ids->end());
 }
 
+// Simplification tolerances in meters of the precomputed levels; level 0
+// keeps the full resolution geometry.
+constexpr double
+    kSimplificationToleranceM[MapService::kSimplificationLevelNum] = {0.0, 0.5,
+                                                                      2.0};
+
+double PointToSegmentDistance(const PointENU &point, const PointENU &start,
+                              const PointENU &end) {
+  const double dx = end.x() - start.x();
+  const double dy = end.y() - start.y();
+  const double length_sqr = dx * dx + dy * dy;
+  if (length_sqr <= 1e-12) {
+    return std::hypot(point.x() - start.x(), point.y() - start.y());
+  }
+  double t = ((point.x() - start.x()) * dx + (point.y() - start.y()) * dy) /
+             length_sqr;
+  t = std::max(0.0, std::min(1.0, t));
+  return std::hypot(point.x() - (start.x() + t * dx),
+                    point.y() - (start.y() + t * dy));
+}
+
+// Douglas-Peucker: keep the point furthest away from the simplified
+// segment and recurse on both sides until every dropped point is within
+// the tolerance.
+void SimplifyPoints(const double tolerance,
+                    RepeatedPtrField<PointENU> *points) {
+  const int point_num = points->size();
+  if (point_num <= 2) {
+    return;
+  }
+  std::vector<bool> keep(point_num, false);
+  keep.front() = keep.back() = true;
+  std::vector<std::pair<int, int>> pending = {{0, point_num - 1}};
+  while (!pending.empty()) {
+    const int start = pending.back().first;
+    const int end = pending.back().second;
+    pending.pop_back();
+    double max_distance = 0.0;
+    int max_index = -1;
+    for (int i = start + 1; i < end; ++i) {
+      const double distance = PointToSegmentDistance(
+          points->Get(i), points->Get(start), points->Get(end));
+      if (distance > max_distance) {
+        max_distance = distance;
+        max_index = i;
+      }
+    }
+    if (max_index >= 0 && max_distance > tolerance) {
+      keep[max_index] = true;
+      pending.emplace_back(start, max_index);
+      pending.emplace_back(max_index, end);
+    }
+  }
+  RepeatedPtrField<PointENU> simplified;
+  for (int i = 0; i < point_num; ++i) {
+    if (keep[i]) {
+      *simplified.Add() = points->Get(i);
+    }
+  }
+  points->Swap(&simplified);
+}
+
+void SimplifyCurve(const double tolerance, hdmap::Curve *curve) {
+  for (auto &segment : *curve->mutable_segment()) {
+    if (segment.has_line_segment()) {
+      SimplifyPoints(tolerance,
+                     segment.mutable_line_segment()->mutable_point());
+    }
+  }
+}
+
 }  // namespace
 
 const char MapService::kMetaFileName[] = "/metaInfo.json";
+constexpr int MapService::kSimplificationLevelNum;
 
 MapService::MapService(bool use_sim_map) : use_sim_map_(use_sim_map) {
   ReloadMap(false);
@@ -94,6 +167,14 @@ bool MapService::ReloadMap(bool force_reload) {
     ret = HDMapUtil::ReloadMaps();
   }
 
+  // Drop the simplified lane caches built from the previous map.
+  {
+    std::lock_guard<std::mutex> cache_lock(lane_cache_mutex_);
+    for (auto &lanes : simplified_lanes_) {
+      lanes.clear();
+    }
+  }
+
   // Update the x,y-offsets if present.
   UpdateOffsets();
   return ret;
@@ -225,6 +306,11 @@ void MapService::CollectMapElementIds(const PointENU &point, double radius,
 }
 
 Map MapService::RetrieveMapElements(const MapElementIds &ids) const {
+  return RetrieveMapElements(ids, 0);
+}
+
+Map MapService::RetrieveMapElements(const MapElementIds &ids,
+                                    int simplification_level) const {
   boost::shared_lock<boost::shared_mutex> reader_lock(mutex_);
 
   Map result;
@@ -233,16 +319,13 @@ Map MapService::RetrieveMapElements(const MapElementIds &ids) const {
   }
   Id map_id;
 
+  const int level = std::max(
+      0, std::min(simplification_level, kSimplificationLevelNum - 1));
   for (const auto &id : ids.lane()) {
     map_id.set_id(id);
-    auto element = SimMap()->GetLaneById(map_id);
-    if (element) {
-      auto lane = element->lane();
-      lane.clear_left_sample();
-      lane.clear_right_sample();
-      lane.clear_left_road_sample();
-      lane.clear_right_road_sample();
-      *result.add_lane() = lane;
+    const auto *lane = GetSimplifiedLane(map_id, level);
+    if (lane != nullptr) {
+      *result.add_lane() = *lane;
     }
   }
 
@@ -329,6 +412,53 @@ Map MapService::RetrieveMapElements(const MapElementIds &ids) const {
   return result;
 }
 
+const hdmap::Lane *MapService::GetSimplifiedLane(const Id &map_id,
+                                                 int level) const {
+  {
+    std::lock_guard<std::mutex> cache_lock(lane_cache_mutex_);
+    auto iter = simplified_lanes_[level].find(map_id.id());
+    if (iter != simplified_lanes_[level].end()) {
+      return &iter->second;
+    }
+  }
+
+  auto element = SimMap()->GetLaneById(map_id);
+  if (!element) {
+    return nullptr;
+  }
+  auto lane = element->lane();
+  lane.clear_left_sample();
+  lane.clear_right_sample();
+  lane.clear_left_road_sample();
+  lane.clear_right_road_sample();
+  const double tolerance = kSimplificationToleranceM[level];
+  if (tolerance > 0.0) {
+    SimplifyCurve(tolerance, lane.mutable_central_curve());
+    if (lane.has_left_boundary()) {
+      SimplifyCurve(tolerance, lane.mutable_left_boundary()->mutable_curve());
+    }
+    if (lane.has_right_boundary()) {
+      SimplifyCurve(tolerance, lane.mutable_right_boundary()->mutable_curve());
+    }
+  }
+
+  std::lock_guard<std::mutex> cache_lock(lane_cache_mutex_);
+  // References into the cache stay valid while more lanes are inserted.
+  return &simplified_lanes_[level]
+              .emplace(map_id.id(), std::move(lane))
+              .first->second;
+}
+
+int MapService::SimplificationLevelForScale(double meters_per_pixel) {
+  int level = 0;
+  for (int i = 1; i < kSimplificationLevelNum; ++i) {
+    if (kSimplificationToleranceM[i] <= meters_per_pixel) {
+      level = i;
+    }
+  }
+  return level;
+}
+
 bool MapService::GetNearestLane(const double x, const double y,
                                 LaneInfoConstPtr *nearest_lane,
                                 double *nearest_s, double *nearest_l) const {
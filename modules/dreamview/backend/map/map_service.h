@@ -20,7 +20,9 @@
 
 #pragma once
 
+#include <mutex>
 #include <string>
+#include <unordered_map>
 #include <vector>
 #include <boost/thread/locks.hpp>
 #include <boost/thread/shared_mutex.hpp>
@@ -49,11 +51,29 @@ class MapService {
   bool GetPathsFromRouting(const apollo::routing::RoutingResponse &routing,
                            std::vector<apollo::hdmap::Path> *paths) const;
 
+  // Number of precomputed simplification levels of the lane geometries.
+  // Level 0 keeps the full resolution, higher levels are coarser.
+  static constexpr int kSimplificationLevelNum = 3;
+
   // The returned value is of a hdmap::Map proto. This
   // makes it easy to convert to a JSON object and to send to the
   // javascript clients.
   hdmap::Map RetrieveMapElements(const MapElementIds &ids) const;
 
+  /**
+   * @brief Same as above, with the lane geometries taken from the cached
+   * simplified copies of the given level, so that zoomed-out map windows
+   * do not re-serialize the full resolution polylines on every pan.
+   */
+  hdmap::Map RetrieveMapElements(const MapElementIds &ids,
+                                 int simplification_level) const;
+
+  /**
+   * @brief Select the simplification level for a viewport scale, in
+   * meters per pixel: geometry finer than one pixel is invisible.
+   */
+  static int SimplificationLevelForScale(double meters_per_pixel);
+
   bool GetPoseWithRegardToLane(const double x, const double y, double *theta,
                                double *s) const;
 
@@ -109,9 +129,21 @@ class MapService {
   const hdmap::HDMap *SimMap() const;
   bool MapReady() const;
 
+  // Get the lane of the given id with its sample debug info dropped and
+  // its curves simplified to the given level. The lanes are built on
+  // first retrieval and cached until the map is reloaded. Returns nullptr
+  // when the lane is unknown.
+  const hdmap::Lane *GetSimplifiedLane(const hdmap::Id &map_id,
+                                       int level) const;
+
   double x_offset_ = 0.0;
   double y_offset_ = 0.0;
 
+  // Per-level caches of the simplified lanes, keyed by lane id.
+  mutable std::unordered_map<std::string, hdmap::Lane>
+      simplified_lanes_[kSimplificationLevelNum];
+  mutable std::mutex lane_cache_mutex_;
+
   // RW lock to protect map data
   mutable boost::shared_mutex mutex_;
 };
@@ -62,6 +62,31 @@ TEST_F(MapServiceTest, RetrieveMapElements) {
   EXPECT_EQ("l1", map.lane(0).id().id());
 }
 
+TEST_F(MapServiceTest, RetrieveSimplifiedMapElements) {
+  MapElementIds map_element_ids;
+  map_element_ids.add_lane("l1");
+
+  Map full = map_service->RetrieveMapElements(map_element_ids, 0);
+  ASSERT_EQ(1, full.lane_size());
+  const auto &full_curve = full.lane(0).central_curve();
+
+  Map coarse = map_service->RetrieveMapElements(
+      map_element_ids, MapService::kSimplificationLevelNum - 1);
+  ASSERT_EQ(1, coarse.lane_size());
+  const auto &coarse_curve = coarse.lane(0).central_curve();
+
+  ASSERT_EQ(full_curve.segment_size(), coarse_curve.segment_size());
+  for (int i = 0; i < full_curve.segment_size(); ++i) {
+    const auto &full_segment = full_curve.segment(i).line_segment();
+    const auto &coarse_segment = coarse_curve.segment(i).line_segment();
+    EXPECT_LE(coarse_segment.point_size(), full_segment.point_size());
+    EXPECT_GE(coarse_segment.point_size(), 2);
+  }
+
+  EXPECT_EQ(0, MapService::SimplificationLevelForScale(0.1));
+  EXPECT_LT(0, MapService::SimplificationLevelForScale(4.0));
+}
+
 TEST_F(MapServiceTest, GetStartPoint) {
   PointENU start_point;
   EXPECT_TRUE(map_service->GetStartPoint(&start_point));
@@ -73,6 +73,9 @@ void PerceptionCameraUpdater::Stop() {
     localization_queue_.clear();
     image_buffer_.clear();
     tf_static_.clear();
+    encoded_update_.clear();
+    update_consumed_ = true;
+    skipped_frames_ = 0;
     current_image_timestamp_ = 0.0;
   }
   enabled_ = false;
@@ -160,6 +163,19 @@ void PerceptionCameraUpdater::OnImage(
     return;
   }
 
+  {
+    // Clients poll more slowly than the camera publishes. When no client
+    // has fetched the previously encoded update yet, transcoding this
+    // frame is wasted work, so shed it; the cap on consecutive sheds
+    // keeps the cached frame from going stale.
+    std::lock_guard<std::mutex> lock(image_mutex_);
+    if (!update_consumed_ && skipped_frames_ < kMaxSkippedFrames) {
+      ++skipped_frames_;
+      return;
+    }
+    skipped_frames_ = 0;
+  }
+
   std::vector<uint8_t> compressed_raw_data(compressed_image->data().begin(),
                                            compressed_image->data().end());
   cv::Mat mat_image = cv::imdecode(compressed_raw_data, CV_LOAD_IMAGE_COLOR);
@@ -173,7 +189,8 @@ void PerceptionCameraUpdater::OnImage(
                       static_cast<int>(mat_image.rows * kImageScale)),
              0, 0, CV_INTER_LINEAR);
   std::vector<uint8_t> tmp_buffer;
-  cv::imencode(".jpg", mat_image, tmp_buffer, std::vector<int>() /* params */);
+  cv::imencode(".jpg", mat_image, tmp_buffer,
+               std::vector<int>{CV_IMWRITE_JPEG_QUALITY, kJpegQuality});
 
   double next_image_timestamp;
   if (compressed_image->has_measurement_time()) {
@@ -182,7 +199,9 @@ void PerceptionCameraUpdater::OnImage(
     next_image_timestamp = compressed_image->header().timestamp_sec();
   }
 
-  std::lock_guard<std::mutex> lock(image_mutex_);
+  std::lock(image_mutex_, localization_mutex_);
+  std::lock_guard<std::mutex> lock1(image_mutex_, std::adopt_lock);
+  std::lock_guard<std::mutex> lock2(localization_mutex_, std::adopt_lock);
   if (next_image_timestamp < current_image_timestamp_) {
     // If replay different bags, the timestamp may jump to earlier time and
     // we need to clear the localization queue
@@ -191,6 +210,18 @@ void PerceptionCameraUpdater::OnImage(
   current_image_timestamp_ = next_image_timestamp;
   camera_update_.set_image(&(tmp_buffer[0]), tmp_buffer.size());
   camera_update_.set_image_aspect_ratio(static_cast<double>(width) / height);
+
+  std::vector<double> localization;
+  GetImageLocalization(&localization);
+  *camera_update_.mutable_localization() = {localization.begin(),
+                                            localization.end()};
+  std::vector<double> localization2camera_tf;
+  GetLocalization2CameraTF(&localization2camera_tf);
+  *camera_update_.mutable_localization2camera_tf() = {
+      localization2camera_tf.begin(), localization2camera_tf.end()};
+  // Serialize once per frame; every client gets the same buffer
+  camera_update_.SerializeToString(&encoded_update_);
+  update_consumed_ = false;
 }
 
 void PerceptionCameraUpdater::OnLocalization(
@@ -218,23 +249,17 @@ void PerceptionCameraUpdater::InitReaders() {
 }
 
 void PerceptionCameraUpdater::GetUpdate(std::string *camera_update) {
-  {
-    std::lock(image_mutex_, localization_mutex_);
-    std::lock_guard<std::mutex> lock1(image_mutex_, std::adopt_lock);
-    std::lock_guard<std::mutex> lock2(localization_mutex_, std::adopt_lock);
-
-    std::vector<double> localization;
-    GetImageLocalization(&localization);
-    *camera_update_.mutable_localization() = {localization.begin(),
-                                              localization.end()};
-    std::vector<double> localization2camera_tf;
-    GetLocalization2CameraTF(&localization2camera_tf);
-    *camera_update_.mutable_localization2camera_tf() = {
-        localization2camera_tf.begin(), localization2camera_tf.end()};
-    // Concurrently modify protobuf msg can cause ByteSizeConsistencyError
-    // when serializing, so we need lock.
+  // The update is assembled and serialized once per processed frame in
+  // OnImage; every client shares the cached buffer instead of paying
+  // for its own serialization.
+  std::lock_guard<std::mutex> lock(image_mutex_);
+  if (encoded_update_.empty()) {
+    // no frame processed yet
     camera_update_.SerializeToString(camera_update);
+    return;
   }
+  update_consumed_ = true;
+  *camera_update = encoded_update_;
 }
 
 }  // namespace dreamview
@@ -55,6 +55,11 @@ class PerceptionCameraUpdater {
 
  private:
   static constexpr double kImageScale = 0.6;
+  // JPEG re-encode quality for the scaled-down websocket image
+  static constexpr int kJpegQuality = 75;
+  // maximum consecutive frames shed before one is processed regardless,
+  // so the cached update recovers when a client starts polling again
+  static constexpr int kMaxSkippedFrames = 10;
 
   void InitReaders();
   void OnImage(const std::shared_ptr<apollo::drivers::CompressedImage> &image);
@@ -87,6 +92,12 @@ class PerceptionCameraUpdater {
   std::vector<uint8_t> image_buffer_;
   std::vector<double> tf_static_;
 
+  // serialized update shared by all clients, rebuilt once per frame
+  std::string encoded_update_;
+  // whether any client fetched encoded_update_ since it was rebuilt
+  bool update_consumed_ = true;
+  int skipped_frames_ = 0;
+
   std::mutex image_mutex_;
   std::mutex localization_mutex_;
 };
@@ -16,6 +16,9 @@
 
 #include "modules/dreamview/backend/point_cloud/point_cloud_updater.h"
 
+#include <algorithm>
+#include <cmath>
+#include <unordered_set>
 #include <utility>
 
 #include "cyber/common/file.h"
@@ -43,7 +46,9 @@ PointCloudUpdater::PointCloudUpdater(WebSocketHandler *websocket,
       websocket_(websocket),
       point_cloud_str_(""),
       future_ready_(true),
-      simworld_updater_(simworld_updater) {
+      simworld_updater_(simworld_updater),
+      downsample_voxel_size_(
+          static_cast<float>(FLAGS_point_cloud_downsample_voxel_size)) {
   RegisterMessageHandlers();
 }
 
@@ -98,6 +103,18 @@ void PointCloudUpdater::RegisterMessageHandlers() {
         }
         websocket_->SendBinaryData(conn, to_send, true);
       });
+  websocket_->RegisterMessageHandler(
+      "SetPointCloudDensity",
+      [this](const Json &json, WebSocketHandler::Connection *conn) {
+        auto voxel_size = json.find("voxelSize");
+        if (voxel_size != json.end() && voxel_size->is_number()) {
+          downsample_voxel_size_.store(
+              std::max(0.0f, static_cast<float>(voxel_size->get<double>())));
+        } else {
+          AWARN << "Failed to set point cloud density: voxelSize is "
+                   "missing or not a number.";
+        }
+      });
   websocket_->RegisterMessageHandler(
       "TogglePointCloud",
       [this](const Json &json, WebSocketHandler::Connection *conn) {
@@ -187,8 +204,64 @@ void PointCloudUpdater::UpdatePointCloud(
       async_future_ = std::move(f);
     }
   } else {
-    pcl_ptr = ConvertPCLPointCloud(point_cloud);
-    this->FilterPointCloud(pcl_ptr);
+    DownsamplePointCloud(point_cloud);
+  }
+}
+
+void PointCloudUpdater::DownsamplePointCloud(
+    const std::shared_ptr<drivers::PointCloud> &point_cloud) {
+  const float voxel_size = downsample_voxel_size_.load();
+  float z_offset;
+  {
+    boost::shared_lock<boost::shared_mutex> reader_lock(mutex_);
+    z_offset = lidar_height_;
+  }
+
+  apollo::dreamview::PointCloud point_cloud_pb;
+  if (voxel_size > 0.0f) {
+    // Keep the first point of each occupied voxel. Unlike pcl::VoxelGrid,
+    // this works directly on the drivers::PointCloud and needs a single
+    // hash probe per point, which is fast enough to run at full frame rate.
+    const float inv_voxel_size = 1.0f / voxel_size;
+    std::unordered_set<uint64_t> occupied_voxels;
+    occupied_voxels.reserve(point_cloud->point_size());
+    for (const auto &point : point_cloud->point()) {
+      if (std::isnan(point.x()) || std::isnan(point.y()) ||
+          std::isnan(point.z())) {
+        continue;
+      }
+      // Quantize each coordinate to a signed 21-bit voxel index and pack
+      // the three indices into one 64-bit key.
+      const uint64_t ix = static_cast<uint64_t>(static_cast<int64_t>(
+                              std::lround(point.x() * inv_voxel_size))) &
+                          0x1FFFFF;
+      const uint64_t iy = static_cast<uint64_t>(static_cast<int64_t>(
+                              std::lround(point.y() * inv_voxel_size))) &
+                          0x1FFFFF;
+      const uint64_t iz = static_cast<uint64_t>(static_cast<int64_t>(
+                              std::lround(point.z() * inv_voxel_size))) &
+                          0x1FFFFF;
+      const uint64_t voxel_key = (ix << 42) | (iy << 21) | iz;
+      if (!occupied_voxels.insert(voxel_key).second) {
+        continue;
+      }
+      point_cloud_pb.add_num(point.x());
+      point_cloud_pb.add_num(point.y());
+      point_cloud_pb.add_num(point.z() + z_offset);
+    }
+  } else {
+    for (const auto &point : point_cloud->point()) {
+      if (!std::isnan(point.x()) && !std::isnan(point.y()) &&
+          !std::isnan(point.z())) {
+        point_cloud_pb.add_num(point.x());
+        point_cloud_pb.add_num(point.y());
+        point_cloud_pb.add_num(point.z() + z_offset);
+      }
+    }
+  }
+  {
+    boost::unique_lock<boost::shared_mutex> writer_lock(mutex_);
+    point_cloud_pb.SerializeToString(&point_cloud_str_);
   }
 }
 
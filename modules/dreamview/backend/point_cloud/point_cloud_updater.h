@@ -83,6 +83,9 @@ class PointCloudUpdater {
 
   void FilterPointCloud(pcl::PointCloud<pcl::PointXYZ>::Ptr pcl_ptr);
 
+  void DownsamplePointCloud(
+      const std::shared_ptr<drivers::PointCloud> &point_cloud);
+
   void UpdateLocalizationTime(
       const std::shared_ptr<apollo::localization::LocalizationEstimate>
           &localization);
@@ -111,6 +114,10 @@ class PointCloudUpdater {
   double last_localization_time_ = 0.0;
   SimulationWorldUpdater *simworld_updater_;
   bool enable_voxel_filter_ = false;
+  // Edge length of the downsample voxels in meters. Zero disables the
+  // downsampling and streams the full cloud. Clients may override the
+  // default via the SetPointCloudDensity websocket message.
+  std::atomic<float> downsample_voxel_size_;
 };
 }  // namespace dreamview
 }  // namespace apollo
@@ -263,12 +263,70 @@ void SimControl::Start() {
   }
 }
 
+void SimControl::StartStepped() {
+  std::lock_guard<std::mutex> lock(mutex_);
+
+  if (!enabled_) {
+    localization_reader_->Observe();
+    Init(localization_reader_->Empty(),
+         next_point_.has_v() ? next_point_.v() : 0.0,
+         next_point_.has_a() ? next_point_.a() : 0.0);
+
+    InternalReset();
+    // No timers in stepped mode: the model only moves when the external
+    // tick service calls RunStepped().
+    stepped_time_ = Clock::NowInSeconds();
+    stepped_mode_ = true;
+    enabled_ = true;
+  }
+}
+
+void SimControl::RunStepped(int num_steps, double step_time_sec) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    if (!enabled_ || !stepped_mode_) {
+      AERROR << "RunStepped is only valid after StartStepped.";
+      return;
+    }
+    if (num_steps <= 0 || step_time_sec <= 0.0) {
+      AERROR << "Invalid step request, num_steps: " << num_steps
+             << ", step_time_sec: " << step_time_sec;
+      return;
+    }
+
+    for (int i = 0; i < num_steps; ++i) {
+      stepped_time_ += step_time_sec;
+      if (Clock::mode() == Clock::MOCK) {
+        Clock::SetNowInSeconds(stepped_time_);
+      }
+
+      TrajectoryPoint trajectory_point;
+      Chassis::GearPosition gear_position;
+      if (!PerfectControlModel(&trajectory_point, &gear_position,
+                               stepped_time_)) {
+        AERROR << "Failed to calculate next point with perfect control model";
+        return;
+      }
+
+      PublishChassis(trajectory_point.v(), gear_position);
+      PublishLocalization(trajectory_point);
+    }
+  }
+  // The wall-clock prediction timer is not running in stepped mode, so
+  // refresh the dummy prediction once per batch.
+  PublishDummyPrediction();
+}
+
 void SimControl::Stop() {
   std::lock_guard<std::mutex> lock(mutex_);
 
   if (enabled_) {
-    sim_control_timer_->Stop();
-    sim_prediction_timer_->Stop();
+    if (!stepped_mode_) {
+      sim_control_timer_->Stop();
+      sim_prediction_timer_->Stop();
+    }
+    stepped_mode_ = false;
     enabled_ = false;
   }
 }
@@ -304,7 +362,8 @@ void SimControl::RunOnce() {
 
   TrajectoryPoint trajectory_point;
   Chassis::GearPosition gear_position;
-  if (!PerfectControlModel(&trajectory_point, &gear_position)) {
+  if (!PerfectControlModel(&trajectory_point, &gear_position,
+                           Clock::NowInSeconds())) {
     AERROR << "Failed to calculate next point with perfect control model";
     return;
   }
@@ -314,9 +373,9 @@ void SimControl::RunOnce() {
 }
 
 bool SimControl::PerfectControlModel(TrajectoryPoint* point,
-                                     Chassis::GearPosition* gear_position) {
+                                     Chassis::GearPosition* gear_position,
+                                     double current_time) {
   // Result of the interpolation.
-  auto current_time = Clock::NowInSeconds();
   const auto& trajectory = current_trajectory_->trajectory_point();
   *gear_position = current_trajectory_->gear();
 
@@ -71,6 +71,22 @@ class SimControl : SimControlInterface {
    */
   void Start() override;
 
+  /**
+   * @brief Starts sim control in stepped mode. The model is only advanced
+   * by RunStepped() calls from an external tick service instead of the
+   * wall-clock timer, so scenario suites can run faster than real time.
+   */
+  void StartStepped();
+
+  /**
+   * @brief Advances the perfect control model by num_steps steps of
+   * step_time_sec seconds each and publishes the localization and chassis
+   * of every step in one batch. Only valid after StartStepped(). When the
+   * global clock runs in MOCK mode, e.g. driven by the record player's
+   * virtual clock, the clock is advanced along with the model.
+   */
+  void RunStepped(int num_steps, double step_time_sec);
+
   /**
    * @brief Stops the timer.
    */
@@ -96,11 +112,13 @@ class SimControl : SimControlInterface {
           &obstacles);
 
   /**
-   * @brief Predict the next trajectory point using perfect control model
+   * @brief Predict the trajectory point at current_time using perfect
+   * control model
    */
   bool PerfectControlModel(
       apollo::common::TrajectoryPoint *point,
-      apollo::canbus::Chassis::GearPosition *gear_position);
+      apollo::canbus::Chassis::GearPosition *gear_position,
+      double current_time);
 
   void PublishChassis(double cur_speed,
                       apollo::canbus::Chassis::GearPosition gear_position);
@@ -170,6 +188,12 @@ class SimControl : SimControlInterface {
   // Whether the sim control is enabled.
   bool enabled_ = false;
 
+  // Whether the model is advanced by RunStepped() instead of the timer.
+  bool stepped_mode_ = false;
+
+  // Simulation time cursor of the stepped mode, in seconds.
+  double stepped_time_ = 0.0;
+
   // Whether start point is initialized from actual localization data
   bool start_point_from_localization_ = false;
 
@@ -188,6 +212,7 @@ class SimControl : SimControlInterface {
   std::mutex mutex_;
 
   FRIEND_TEST(SimControlTest, Test);
+  FRIEND_TEST(SimControlTest, TestStepped);
   FRIEND_TEST(SimControlTest, TestDummyPrediction);
 };
 
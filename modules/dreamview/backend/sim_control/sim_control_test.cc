@@ -165,6 +165,61 @@ TEST_F(SimControlTest, Test) {
   }
 }
 
+TEST_F(SimControlTest, TestStepped) {
+  Clock::SetMode(Clock::MOCK);
+  Clock::SetNowInSeconds(100.0);
+
+  sim_control_->Init(false);
+  sim_control_->enabled_ = true;
+  sim_control_->stepped_mode_ = true;
+  sim_control_->stepped_time_ = 100.0;
+
+  planning::ADCTrajectory adc_trajectory;
+  std::vector<double> xs(5);
+  std::vector<double> ys(5);
+  std::vector<double> ss(5);
+  std::vector<double> vs(5);
+  std::vector<double> as = {0.0, 0.0, 0.0, 0.0, 0.0};
+  std::vector<double> ths = {M_PI / 4.0, M_PI / 4.0, M_PI / 4.0, M_PI / 4.0,
+                             M_PI / 4.0};
+  std::vector<double> kappa_s = {0.0, 0.0, 0.0, 0.0, 0.0};
+  std::vector<double> ts = {0.0, 0.1, 0.2, 0.3, 0.4};
+  ss[0] = 0.0;
+  xs[0] = 0.0;
+  ys[0] = 0.0;
+  vs[0] = 10.0;
+  for (std::size_t i = 1; i < ts.size(); ++i) {
+    vs[i] = vs[i - 1] + as[i - 1] * ts[i];
+    ss[i] = (vs[i - 1] + 0.5 * vs[i]) * ts[i];
+    xs[i] = std::sqrt(ss[i] * ss[i] / 2.0);
+    ys[i] = std::sqrt(ss[i] * ss[i] / 2.0);
+  }
+
+  SetTrajectory(xs, ys, ss, vs, as, ths, kappa_s, ts, &adc_trajectory);
+
+  const double timestamp = 100.0;
+  adc_trajectory.mutable_header()->set_timestamp_sec(timestamp);
+
+  sim_control_->SetStartPoint(adc_trajectory.trajectory_point(0));
+  sim_control_->OnPlanning(std::make_shared<ADCTrajectory>(adc_trajectory));
+
+  // Two steps of 50ms land the model on the second trajectory point, and
+  // the mock clock moves along with the model.
+  sim_control_->RunStepped(2, 0.05);
+  EXPECT_NEAR(Clock::NowInSeconds(), 100.1, 1e-9);
+
+  BlockerManager::Instance()->Observe();
+  auto localization =
+      BlockerManager::Instance()
+          ->GetBlocker<LocalizationEstimate>(FLAGS_localization_topic)
+          ->GetLatestObservedPtr();
+
+  const auto &pose = localization->pose();
+  EXPECT_NEAR(pose.position().x(), xs[1], 1e-6);
+  EXPECT_NEAR(pose.position().y(), ys[1], 1e-6);
+  EXPECT_NEAR(pose.heading(), M_PI / 4.0, 1e-6);
+}
+
 TEST_F(SimControlTest, TestDummyPrediction) {
   Clock::SetMode(Clock::MOCK);
 
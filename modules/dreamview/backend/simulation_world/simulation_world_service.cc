@@ -16,6 +16,7 @@
 
 #include "modules/dreamview/backend/simulation_world/simulation_world_service.h"
 
+#include <cmath>
 #include <unordered_set>
 
 #include "absl/strings/str_split.h"
@@ -434,10 +435,30 @@ void SimulationWorldService::GetMapElementIds(double radius,
 }
 
 void SimulationWorldService::PopulateMapInfo(double radius) {
+  const auto &adc = world_.auto_driving_car();
+  const double current_time = Clock::NowInSeconds();
+  const double moved_distance =
+      std::hypot(adc.position_x() - map_info_position_x_,
+                 adc.position_y() - map_info_position_y_);
+  // The collected element ids stay valid while the ADC remains close to the
+  // anchor of the previous collection, so skip the map query then. A
+  // periodic recollection bounds the staleness regardless of movement.
+  if (map_info_timestamp_sec_ > 0.0 && map_info_radius_ == radius &&
+      moved_distance < FLAGS_sim_map_element_update_distance &&
+      current_time - map_info_timestamp_sec_ <
+          FLAGS_sim_map_element_max_age_sec) {
+    return;
+  }
+
   world_.clear_map_element_ids();
   GetMapElementIds(radius, world_.mutable_map_element_ids());
   world_.set_map_hash(map_service_->CalculateMapHash(world_.map_element_ids()));
   world_.set_map_radius(radius);
+
+  map_info_position_x_ = adc.position_x();
+  map_info_position_y_ = adc.position_y();
+  map_info_radius_ = radius;
+  map_info_timestamp_sec_ = current_time;
 }
 
 const Map &SimulationWorldService::GetRelativeMap() const {
@@ -314,6 +314,13 @@ class SimulationWorldService {
   // SimulationWorldService instance.
   SimulationWorld world_;
 
+  // Anchor of the last map element collection, so PopulateMapInfo can skip
+  // the spatial query while the ADC stays close to it.
+  double map_info_position_x_ = 0.0;
+  double map_info_position_y_ = 0.0;
+  double map_info_radius_ = 0.0;
+  double map_info_timestamp_sec_ = 0.0;
+
   // Downsampled route paths to be rendered in frontend.
   mutable boost::shared_mutex route_paths_mutex_;
   std::vector<RoutePath> route_paths_;
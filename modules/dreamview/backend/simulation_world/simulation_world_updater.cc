@@ -69,9 +69,19 @@ void SimulationWorldUpdater::RegisterMessageHandlers() {
       [this](const Json &json, WebSocketHandler::Connection *conn) {
         auto iter = json.find("elements");
         if (iter != json.end()) {
+          // Clients may report their viewport scale in meters per pixel,
+          // in which case a precomputed simplified geometry level is
+          // served instead of the full resolution one.
+          int simplification_level = 0;
+          auto scale_iter = json.find("metersPerPixel");
+          if (scale_iter != json.end() && scale_iter->is_number()) {
+            simplification_level =
+                MapService::SimplificationLevelForScale(*scale_iter);
+          }
           MapElementIds map_element_ids;
           if (JsonStringToMessage(iter->dump(), &map_element_ids).ok()) {
-            auto retrieved = map_service_->RetrieveMapElements(map_element_ids);
+            auto retrieved = map_service_->RetrieveMapElements(
+                map_element_ids, simplification_level);
 
             std::string retrieved_map_string;
             retrieved.SerializeToString(&retrieved_map_string);
@@ -181,6 +191,11 @@ void SimulationWorldUpdater::RegisterMessageHandlers() {
           to_send = enable_pnc_monitor ? simulation_world_with_planning_data_
                                        : simulation_world_;
         }
+        if (to_send.empty()) {
+          // The cached update has not been built yet, e.g. right after the
+          // first client connected; the next timer tick will fill it.
+          return;
+        }
         if (FLAGS_enable_update_size_check && !enable_pnc_monitor &&
             to_send.size() > FLAGS_max_update_size) {
           AWARN << "update size is too big:" << to_send.size();
@@ -410,15 +425,27 @@ void SimulationWorldUpdater::Start() {
 void SimulationWorldUpdater::OnTimer() {
   sim_world_service_.Update();
 
+  const bool has_sim_world_clients = websocket_->HasConnections();
+  const bool has_map_clients = map_ws_->HasConnections();
+  if (!has_sim_world_clients && !has_map_clients) {
+    // Nobody is listening; skip the serialization work. The first tick
+    // after a client connects rebuilds the cached strings.
+    return;
+  }
+
   {
     boost::unique_lock<boost::shared_mutex> writer_lock(mutex_);
     last_pushed_adc_timestamp_sec_ =
         sim_world_service_.world().auto_driving_car().timestamp_sec();
-    sim_world_service_.GetWireFormatString(
-        FLAGS_sim_map_radius, &simulation_world_,
-        &simulation_world_with_planning_data_);
-    sim_world_service_.GetRelativeMap().SerializeToString(
-        &relative_map_string_);
+    if (has_sim_world_clients) {
+      sim_world_service_.GetWireFormatString(
+          FLAGS_sim_map_radius, &simulation_world_,
+          &simulation_world_with_planning_data_);
+    }
+    if (has_map_clients) {
+      sim_world_service_.GetRelativeMap().SerializeToString(
+          &relative_map_string_);
+    }
   }
 }
 
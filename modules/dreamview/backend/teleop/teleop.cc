@@ -50,6 +50,30 @@ static const unsigned int kWriteWaitMs = 50;
 
 const std::string start_cmd = "start";
 const std::string stop_cmd = "kill";
+// prefix of the daemon command that re-targets an encoder's bitrate;
+// the daemon passes the command through to the video driver
+const std::string bitrate_cmd_prefix = "bitrate ";
+
+// per-level encoder bitrate targets in kbps; column i drives encoder<i>.
+// The control-relevant front camera (encoder0) degrades last and is
+// never dropped; 0 stops the encoder at that level.
+static const unsigned int kBitrateLevelCount = 4;
+static const unsigned int
+    kEncoderBitratesKbps[kBitrateLevelCount][kEncoderCount] = {
+        {2500, 2500, 2500},
+        {2000, 1200, 1200},
+        {1500, 800, 0},
+        {1000, 0, 0},
+};
+// aggregate uplink throughput required to sustain each level, kbps
+static const double kLevelMinThroughputKbps[kBitrateLevelCount] = {
+    9000.0, 6000.0, 3500.0, 0.0};
+// extra headroom required before stepping back up to a better level
+static const double kUpgradeHeadroom = 1.25;
+// minimum time between two upgrades; downgrades act immediately
+static const double kLevelHoldSec = 3.0;
+// smoothing factor for the uplink throughput estimate
+static const double kThroughputAlpha = 0.3;
 
 // channels
 const std::string modem0_channel = "/apollo/teleop/modem/modem0";
@@ -77,6 +101,7 @@ TeleopService::TeleopService(WebSocketHandler *websocket)
   teleop_status_["video"] = false;
   teleop_status_["video_starting"] = false;
   teleop_status_["video_stopping"] = false;
+  teleop_status_["bitrate_level"] = 0;
   teleop_status_["pulling_over"] = false;
   teleop_status_["e_stopping"] = false;
   teleop_status_["resuming_autonomy"] = false;
@@ -273,24 +298,145 @@ void TeleopService::UpdateModem(const std::string &modem_id,
   if (modem_info->has_technology()) {
     // teleop_status_["modems"][modem_info->provider()] =
     //  modem_info->technology();
+    {
+      boost::unique_lock<boost::shared_mutex> writer_lock(mutex_);
+      std::string str;
+      std::stringstream ss(str);
+      double rx = 1.0 * modem_info->rx() / (1024 * 1024);
+      double tx = 1.0 * modem_info->tx() / (1024 * 1024);
+
+      ss << modem_info->technology();
+      ss << std::fixed << std::setw(6) << std::setprecision(2)
+         << std::setfill('0');
+      ss << " rank: " << modem_info->rank();
+      ss << " sig: " << modem_info->signal();
+      ss << " q: " << modem_info->quality();
+      ss << " rx: " << rx << " MB";
+      ss << " tx: " << tx << " MB";
+      teleop_status_["modems"][modem_id] = ss.str();
+      UpdateLinkEstimate(modem_id, *modem_info);
+    }
+    // any encoder commands this issues are written outside of the lock
+    UpdateBitrateLevel();
+  }
+}
+
+// derive an uplink throughput estimate from the cumulative tx byte
+// counter; the delta between two reports over the report interval is
+// the throughput the modem actually delivered, which tracks the link
+// capacity while the encoders are saturating the uplink
+void TeleopService::UpdateLinkEstimate(const std::string &modem_id,
+                                       const ModemInfo &modem_info) {
+  const double now = Time::Now().ToSecond();
+  LinkEstimate &link = link_estimates_[modem_id];
+  if (link.last_update_sec > 0.0 && now > link.last_update_sec &&
+      modem_info.tx() >= link.last_tx_bytes) {
+    const double interval = now - link.last_update_sec;
+    const double kbps =
+        8.0 * static_cast<double>(modem_info.tx() - link.last_tx_bytes) /
+        interval / 1000.0;
+    link.throughput_kbps = kThroughputAlpha * kbps +
+                           (1.0 - kThroughputAlpha) * link.throughput_kbps;
+  }
+  link.last_update_sec = now;
+  link.last_tx_bytes = modem_info.tx();
+  teleop_status_["link_kbps"][modem_id] =
+      static_cast<int>(link.throughput_kbps);
+}
+
+void TeleopService::UpdateBitrateLevel() {
+  const double now = Time::Now().ToSecond();
+  int previous_level = 0;
+  int level = 0;
+  bool apply = false;
+  {
     boost::unique_lock<boost::shared_mutex> writer_lock(mutex_);
-    std::string str;
-    std::stringstream ss(str);
-    double rx = 1.0 * modem_info->rx() / (1024 * 1024);
-    double tx = 1.0 * modem_info->tx() / (1024 * 1024);
-
-    ss << modem_info->technology();
-    ss << std::fixed << std::setw(6) << std::setprecision(2)
-       << std::setfill('0');
-    ss << " rank: " << modem_info->rank();
-    ss << " sig: " << modem_info->signal();
-    ss << " q: " << modem_info->quality();
-    ss << " rx: " << rx << " MB";
-    ss << " tx: " << tx << " MB";
-    teleop_status_["modems"][modem_id] = ss.str();
+    // the daemon bonds the modems, so the encoders share their
+    // combined uplink throughput
+    double total_kbps = 0.0;
+    for (const auto &link : link_estimates_) {
+      total_kbps += link.second.throughput_kbps;
+    }
+    // pick the best level the link sustains; moving back up needs
+    // extra headroom so we do not oscillate around a threshold
+    level = static_cast<int>(kBitrateLevelCount) - 1;
+    for (unsigned int i = 0; i < kBitrateLevelCount; i++) {
+      double required = kLevelMinThroughputKbps[i];
+      if (static_cast<int>(i) < bitrate_level_) {
+        required *= kUpgradeHeadroom;
+      }
+      if (total_kbps >= required) {
+        level = static_cast<int>(i);
+        break;
+      }
+    }
+    if (level == bitrate_level_) {
+      return;
+    }
+    // downgrades act immediately, upgrades wait out the hold time
+    if (level < bitrate_level_ &&
+        now - last_level_change_sec_ < kLevelHoldSec) {
+      return;
+    }
+    previous_level = bitrate_level_;
+    bitrate_level_ = level;
+    last_level_change_sec_ = now;
+    teleop_status_["bitrate_level"] = level;
+    // only running encoders need re-targeting
+    apply = teleop_status_["video"];
+  }
+  AINFO << "bitrate level " << previous_level << " -> " << level;
+  if (apply) {
+    ApplyBitrateLevel(previous_level, level);
+  }
+}
+
+void TeleopService::ApplyBitrateLevel(int previous_level, int level) {
+  bool first_write = true;
+  for (unsigned int i = 0; i < kEncoderCount; i++) {
+    const unsigned int kbps = kEncoderBitratesKbps[level][i];
+    const unsigned int previous_kbps = kEncoderBitratesKbps[previous_level][i];
+    if (kbps == previous_kbps) {
+      continue;
+    }
+    if (!first_write) {
+      // delay between sending 2 messages to ensure they are received
+      std::this_thread::sleep_for(std::chrono::milliseconds(kWriteWaitMs));
+    }
+    first_write = false;
+    // an encoder dropped at the previous level has to be restarted
+    // before it accepts a new rate
+    if (kbps > 0 && previous_kbps == 0) {
+      DaemonCmd msg;
+      msg.set_cmd(start_cmd);
+      char encoderName[20];
+      snprintf(encoderName, 20, "encoder%u", i);
+      msg.set_service(encoderName);
+      common::util::FillHeader("dreamview", &msg);
+      remote_daemon_cmd_writer_->Write(msg);
+      AINFO << encoderName << " " << msg.cmd();
+      std::this_thread::sleep_for(std::chrono::milliseconds(kWriteWaitMs));
+    }
+    SendEncoderBitrateCmd(i, kbps);
   }
 }
 
+void TeleopService::SendEncoderBitrateCmd(unsigned int encoder_id,
+                                          unsigned int kbps) {
+  DaemonCmd msg;
+  if (kbps == 0) {
+    msg.set_cmd(stop_cmd);
+  } else {
+    msg.set_cmd(bitrate_cmd_prefix + std::to_string(kbps));
+  }
+  char encoderName[20];
+  snprintf(encoderName, 20, "encoder%u", encoder_id);
+  msg.set_service(encoderName);
+  common::util::FillHeader("dreamview", &msg);
+  remote_daemon_cmd_writer_->Write(msg);
+  AINFO << encoderName << " " << msg.cmd();
+}
+
 // callback for messages that originate from the remote computer
 void TeleopService::UpdateCarDaemonRpt(
     const std::shared_ptr<DaemonRpt> &daemon_rpt) {
@@ -309,9 +455,6 @@ void TeleopService::UpdateCarDaemonRpt(
       }
     }
 
-    // all  video encoders are running.
-    videoIsRunning = runningEncoders >= kEncoderCount;
-
     // we may need to write commands to start/stop the video stream
     bool sendStartVideo = false;
     bool sendStopVideo = false;
@@ -321,6 +464,15 @@ void TeleopService::UpdateCarDaemonRpt(
     // scope for the lock
     {
       boost::unique_lock<boost::shared_mutex> writer_lock(mutex_);
+      // encoders dropped by the bitrate controller are not expected
+      // to be running
+      unsigned int expectedEncoders = 0;
+      for (unsigned int i = 0; i < kEncoderCount; i++) {
+        if (kEncoderBitratesKbps[bitrate_level_][i] > 0) {
+          expectedEncoders++;
+        }
+      }
+      videoIsRunning = runningEncoders >= expectedEncoders;
       teleop_status_["video"] = videoIsRunning;
       teleop_status_["audio"] = voipIsRunning;
 
@@ -418,6 +570,13 @@ void TeleopService::UpdateOperatorDaemonRpt(
 }
 
 void TeleopService::SendVideoStreamCmd(bool start_stop) {
+  unsigned int bitrates[kEncoderCount];
+  {
+    boost::shared_lock<boost::shared_mutex> reader_lock(mutex_);
+    for (unsigned int i = 0; i < kEncoderCount; i++) {
+      bitrates[i] = kEncoderBitratesKbps[bitrate_level_][i];
+    }
+  }
   DaemonCmd msg;
   if (start_stop) {
     msg.set_cmd(start_cmd);
@@ -426,6 +585,10 @@ void TeleopService::SendVideoStreamCmd(bool start_stop) {
   }
   // we send a message to each encoder.
   for (unsigned int i = 0; i < kEncoderCount; i++) {
+    // encoders dropped at the current bitrate level stay stopped
+    if (start_stop && bitrates[i] == 0) {
+      continue;
+    }
     if (i > 0) {
       // delay between sending 2 messages to ensure they are received
       std::this_thread::sleep_for(std::chrono::milliseconds(kWriteWaitMs));
@@ -436,6 +599,12 @@ void TeleopService::SendVideoStreamCmd(bool start_stop) {
     common::util::FillHeader("dreamview", &msg);
     remote_daemon_cmd_writer_->Write(msg);
     AINFO << encoderName << " " << msg.cmd();
+    // started encoders come up at their default rate; re-target them
+    // when the link already forced a reduced level
+    if (start_stop && bitrates[i] != kEncoderBitratesKbps[0][i]) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(kWriteWaitMs));
+      SendEncoderBitrateCmd(i, bitrates[i]);
+    }
   }
 }
 
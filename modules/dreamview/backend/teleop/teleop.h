@@ -16,6 +16,9 @@
 
 #pragma once
 
+#include <map>
+#include <string>
+
 #include <boost/thread/locks.hpp>
 #include <boost/thread/shared_mutex.hpp>
 
@@ -51,6 +54,11 @@ class TeleopService {
   void SendAudioStreamCmd(bool start_stop);
   void SendMicStreamCmd(bool start_stop);
   void SendVideoStreamCmd(bool start_stop);
+  // adaptive bitrate control: re-target or stop individual encoders so
+  // the teleop link degrades gracefully when uplink capacity drops
+  void UpdateBitrateLevel();
+  void ApplyBitrateLevel(int previous_level, int level);
+  void SendEncoderBitrateCmd(unsigned int encoder_id, unsigned int kbps);
   // planner commands
   void SendEstopCmd();
   void SendPullOverCmd();
@@ -100,6 +108,22 @@ class TeleopService {
       pad_message_writer_;
   void UpdatePlanning(
       const std::shared_ptr<apollo::planning::ADCTrajectory> &msg);
+
+  // per-modem uplink state derived from successive ModemInfo reports
+  struct LinkEstimate {
+    double last_update_sec = 0.0;
+    uint64_t last_tx_bytes = 0;
+    // exponentially smoothed uplink throughput in kbps
+    double throughput_kbps = 0.0;
+  };
+  // assumes the caller holds a unique lock on mutex_
+  void UpdateLinkEstimate(
+      const std::string &modem_id,
+      const modules::teleop::modem::ModemInfo &modem_info);
+  std::map<std::string, LinkEstimate> link_estimates_;
+  // index into the encoder bitrate tables, 0 is full quality
+  int bitrate_level_ = 0;
+  double last_level_change_sec_ = 0.0;
 #endif
 
   // Store teleop status
@@ -140,6 +140,9 @@ void CanReceiver<SensorType>::RecvThreadFunc() {
   int32_t receive_none_count = 0;
   const int32_t ERROR_COUNT_MAX = 10;
   auto default_period = 10 * 1000;
+  // Reused across wakeups so steady-state batching does not allocate.
+  std::vector<CanFrameView> frame_views;
+  frame_views.reserve(MAX_CAN_RECV_FRAME_LEN);
 
   while (IsRunning()) {
     std::vector<CanFrame> buf;
@@ -169,15 +172,14 @@ void CanReceiver<SensorType>::RecvThreadFunc() {
     }
     receive_none_count = 0;
 
+    frame_views.clear();
     for (const auto &frame : buf) {
-      uint8_t len = frame.len;
-      uint32_t uid = frame.id;
-      const uint8_t *data = frame.data;
-      pt_manager_->Parse(uid, data, len);
+      frame_views.push_back({frame.id, frame.data, frame.len});
       if (enable_log_) {
         ADEBUG << "recv_can_frame#" << frame.CanFrameString();
       }
     }
+    pt_manager_->ParseBatch(frame_views);
     cyber::Yield();
   }
   AINFO << "Can client receiver thread stopped.";
@@ -20,6 +20,7 @@
  */
 #pragma once
 
+#include <array>
 #include <condition_variable>
 #include <memory>
 #include <mutex>
@@ -58,6 +59,19 @@ struct CheckIdArg {
   int32_t error_count = 0;
 };
 
+/**
+ * @struct CanFrameView
+ *
+ * @brief a borrowed reference to one received CAN frame, used to hand a block
+ * of frames to the message manager in a single call. The referenced data must
+ * stay valid for the duration of the call.
+ */
+struct CanFrameView {
+  uint32_t message_id = 0;
+  const uint8_t *data = nullptr;
+  int32_t length = 0;
+};
+
 /**
  * @class MessageManager
  *
@@ -85,6 +99,14 @@ class MessageManager {
   virtual void Parse(const uint32_t message_id, const uint8_t *data,
                      int32_t length);
 
+  /**
+   * @brief parse a block of CAN frames in one pass. The sensor data lock is
+   * taken once for the whole block instead of once per frame, so the cost no
+   * longer scales with bus load.
+   * @param frames the views of the frames received in one wakeup
+   */
+  virtual void ParseBatch(const std::vector<CanFrameView> &frames);
+
   void ClearSensorData();
 
   std::condition_variable *GetMutableCVar();
@@ -116,9 +138,22 @@ class MessageManager {
   template <class T, bool need_check>
   void AddSendProtocolData();
 
+  /**
+   * @brief update the received-id bookkeeping and the period check of one
+   * message id.
+   */
+  void UpdateReceivedInfo(const uint32_t message_id);
+
+  // Every in-tree vehicle protocol uses standard 11-bit CAN ids, so indexing
+  // this table by the raw id is a minimal perfect hash for them; extended ids
+  // fall back to the hash map below.
+  static constexpr uint32_t kDispatchTableSize = 2048;
+
   std::vector<std::unique_ptr<ProtocolData<SensorType>>> send_protocol_data_;
   std::vector<std::unique_ptr<ProtocolData<SensorType>>> recv_protocol_data_;
 
+  std::array<ProtocolData<SensorType> *, kDispatchTableSize> dispatch_table_ =
+      {};
   std::unordered_map<uint32_t, ProtocolData<SensorType> *> protocol_data_map_;
   std::unordered_map<uint32_t, CheckIdArg> check_ids_;
   std::set<uint32_t> received_ids_;
@@ -139,6 +174,9 @@ void MessageManager<SensorType>::AddRecvProtocolData() {
     return;
   }
   protocol_data_map_[T::ID] = dt;
+  if (static_cast<uint32_t>(T::ID) < kDispatchTableSize) {
+    dispatch_table_[T::ID] = dt;
+  }
   if (need_check) {
     check_ids_[T::ID].period = dt->GetPeriod();
     check_ids_[T::ID].real_period = 0;
@@ -156,6 +194,9 @@ void MessageManager<SensorType>::AddSendProtocolData() {
     return;
   }
   protocol_data_map_[T::ID] = dt;
+  if (static_cast<uint32_t>(T::ID) < kDispatchTableSize) {
+    dispatch_table_[T::ID] = dt;
+  }
   if (need_check) {
     check_ids_[T::ID].period = dt->GetPeriod();
     check_ids_[T::ID].real_period = 0;
@@ -168,6 +209,14 @@ template <typename SensorType>
 ProtocolData<SensorType>
     *MessageManager<SensorType>::GetMutableProtocolDataById(
         const uint32_t message_id) {
+  if (message_id < kDispatchTableSize) {
+    ProtocolData<SensorType> *dt = dispatch_table_[message_id];
+    if (dt == nullptr) {
+      ADEBUG << "Unable to get protocol data because of invalid message_id:"
+             << Byte::byte_to_hex(message_id);
+    }
+    return dt;
+  }
   if (protocol_data_map_.find(message_id) == protocol_data_map_.end()) {
     ADEBUG << "Unable to get protocol data because of invalid message_id:"
            << Byte::byte_to_hex(message_id);
@@ -188,6 +237,33 @@ void MessageManager<SensorType>::Parse(const uint32_t message_id,
     std::lock_guard<std::mutex> lock(sensor_data_mutex_);
     protocol_data->Parse(data, length, &sensor_data_);
   }
+  UpdateReceivedInfo(message_id);
+}
+
+template <typename SensorType>
+void MessageManager<SensorType>::ParseBatch(
+    const std::vector<CanFrameView> &frames) {
+  {
+    std::lock_guard<std::mutex> lock(sensor_data_mutex_);
+    for (const auto &frame : frames) {
+      ProtocolData<SensorType> *protocol_data =
+          GetMutableProtocolDataById(frame.message_id);
+      if (protocol_data == nullptr) {
+        continue;
+      }
+      protocol_data->Parse(frame.data, frame.length, &sensor_data_);
+    }
+  }
+  for (const auto &frame : frames) {
+    if (GetMutableProtocolDataById(frame.message_id) == nullptr) {
+      continue;
+    }
+    UpdateReceivedInfo(frame.message_id);
+  }
+}
+
+template <typename SensorType>
+void MessageManager<SensorType>::UpdateReceivedInfo(const uint32_t message_id) {
   received_ids_.insert(message_id);
   // check if need to check period
   const auto it = check_ids_.find(message_id);
@@ -18,6 +18,7 @@
 
 #include <memory>
 #include <set>
+#include <vector>
 
 #include "gtest/gtest.h"
 
@@ -58,6 +59,22 @@ TEST(MessageManagerTest, GetMutableProtocolDataById) {
   EXPECT_EQ(manager.GetSensorData(nullptr), ErrorCode::CANBUS_ERROR);
 }
 
+TEST(MessageManagerTest, ParseBatch) {
+  uint8_t mock_data = 1;
+  MockMessageManager manager;
+  std::vector<CanFrameView> frames;
+  frames.push_back({MockProtocolData::ID, &mock_data, 8});
+  // Unknown ids are skipped without disturbing the rest of the block.
+  frames.push_back({0x7FF, &mock_data, 8});
+  frames.push_back({MockProtocolData::ID, &mock_data, 8});
+  manager.ParseBatch(frames);
+  EXPECT_NE(manager.GetMutableProtocolDataById(MockProtocolData::ID), nullptr);
+  EXPECT_EQ(manager.GetMutableProtocolDataById(0x7FF), nullptr);
+
+  ::apollo::canbus::ChassisDetail chassis_detail;
+  EXPECT_EQ(manager.GetSensorData(&chassis_detail), ErrorCode::OK);
+}
+
 }  // namespace canbus
 }  // namespace drivers
 }  // namespace apollo
@@ -102,6 +102,18 @@ bool DataParser::Init() {
   rawimu_writer_ = node_->CreateWriter<Imu>(FLAGS_raw_imu_topic);
   gps_writer_ = node_->CreateWriter<Gps>(FLAGS_gps_topic);
 
+  rawimu_pool_.reset(new cyber::base::CCObjectPool<Imu>(pool_size_));
+  rawimu_pool_->ConstructAll();
+  corrimu_pool_.reset(new cyber::base::CCObjectPool<CorrectedImu>(pool_size_));
+  corrimu_pool_->ConstructAll();
+  gps_pool_.reset(new cyber::base::CCObjectPool<Gps>(pool_size_));
+  gps_pool_->ConstructAll();
+  insstat_pool_.reset(new cyber::base::CCObjectPool<InsStat>(pool_size_));
+  insstat_pool_->ConstructAll();
+  observation_pool_.reset(
+      new cyber::base::CCObjectPool<EpochObservation>(pool_size_));
+  observation_pool_->ConstructAll();
+
   common::util::FillHeader("gnss", &ins_status_);
   insstatus_writer_->Write(ins_status_);
   common::util::FillHeader("gnss", &gnss_status_);
@@ -223,7 +235,13 @@ void DataParser::DispatchMessage(Parser::MessageType type, MessagePtr message) {
 }
 
 void DataParser::PublishInsStat(const MessagePtr message) {
-  auto ins_stat = std::make_shared<InsStat>(*As<InsStat>(message));
+  auto ins_stat = insstat_pool_->GetObject();
+  if (ins_stat == nullptr) {
+    AWARN << "ins stat pool return nullptr, will be create new.";
+    ins_stat = std::make_shared<InsStat>();
+  }
+  ins_stat->Clear();
+  ins_stat->CopyFrom(*As<InsStat>(message));
   common::util::FillHeader("gnss", ins_stat.get());
   insstat_writer_->Write(ins_stat);
 }
@@ -235,7 +253,13 @@ void DataParser::PublishBestpos(const MessagePtr message) {
 }
 
 void DataParser::PublishImu(const MessagePtr message) {
-  auto raw_imu = std::make_shared<Imu>(*As<Imu>(message));
+  auto raw_imu = rawimu_pool_->GetObject();
+  if (raw_imu == nullptr) {
+    AWARN << "raw imu pool return nullptr, will be create new.";
+    raw_imu = std::make_shared<Imu>();
+  }
+  raw_imu->Clear();
+  raw_imu->CopyFrom(*As<Imu>(message));
   Imu *imu = As<Imu>(message);
 
   raw_imu->mutable_linear_acceleration()->set_x(
@@ -253,7 +277,12 @@ void DataParser::PublishImu(const MessagePtr message) {
 
 void DataParser::PublishOdometry(const MessagePtr message) {
   Ins *ins = As<Ins>(message);
-  auto gps = std::make_shared<Gps>();
+  auto gps = gps_pool_->GetObject();
+  if (gps == nullptr) {
+    AWARN << "gps pool return nullptr, will be create new.";
+    gps = std::make_shared<Gps>();
+  }
+  gps->Clear();
 
   double unix_sec = apollo::drivers::util::gps2unix(ins->measurement_time());
   gps->mutable_header()->set_timestamp_sec(unix_sec);
@@ -297,7 +326,12 @@ void DataParser::PublishOdometry(const MessagePtr message) {
 
 void DataParser::PublishCorrimu(const MessagePtr message) {
   Ins *ins = As<Ins>(message);
-  auto imu = std::make_shared<CorrectedImu>();
+  auto imu = corrimu_pool_->GetObject();
+  if (imu == nullptr) {
+    AWARN << "corrected imu pool return nullptr, will be create new.";
+    imu = std::make_shared<CorrectedImu>();
+  }
+  imu->Clear();
   double unix_sec = apollo::drivers::util::gps2unix(ins->measurement_time());
   imu->mutable_header()->set_timestamp_sec(unix_sec);
 
@@ -325,8 +359,13 @@ void DataParser::PublishEphemeris(const MessagePtr message) {
 }
 
 void DataParser::PublishObservation(const MessagePtr message) {
-  auto observation =
-      std::make_shared<EpochObservation>(*As<EpochObservation>(message));
+  auto observation = observation_pool_->GetObject();
+  if (observation == nullptr) {
+    AWARN << "observation pool return nullptr, will be create new.";
+    observation = std::make_shared<EpochObservation>();
+  }
+  observation->Clear();
+  observation->CopyFrom(*As<EpochObservation>(message));
   epochobservation_writer_->Write(observation);
 }
 
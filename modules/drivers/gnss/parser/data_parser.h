@@ -21,6 +21,7 @@
 
 #include <proj_api.h>
 
+#include "cyber/base/concurrent_object_pool.h"
 #include "cyber/cyber.h"
 #include "modules/transform/transform_broadcaster.h"
 
@@ -94,6 +95,22 @@ class DataParser {
   std::shared_ptr<apollo::cyber::Writer<EpochObservation>>
       epochobservation_writer_ = nullptr;
   std::shared_ptr<apollo::cyber::Writer<Heading>> heading_writer_ = nullptr;
+
+  // message pools for the high-rate outputs, messages are recycled once
+  // every reader releases them, so steady-state publishing does not hit
+  // the allocator
+  int pool_size_ = 8;
+  std::shared_ptr<apollo::cyber::base::CCObjectPool<Imu>> rawimu_pool_ =
+      nullptr;
+  std::shared_ptr<
+      apollo::cyber::base::CCObjectPool<apollo::localization::CorrectedImu>>
+      corrimu_pool_ = nullptr;
+  std::shared_ptr<apollo::cyber::base::CCObjectPool<apollo::localization::Gps>>
+      gps_pool_ = nullptr;
+  std::shared_ptr<apollo::cyber::base::CCObjectPool<InsStat>> insstat_pool_ =
+      nullptr;
+  std::shared_ptr<apollo::cyber::base::CCObjectPool<EpochObservation>>
+      observation_pool_ = nullptr;
 };
 
 }  // namespace gnss
@@ -32,9 +32,12 @@ bool HesaiDriver::Init() {
     return false;
   }
 
+  int max_packets = 0;
   if (conf_.model() == HESAI40P) {
+    max_packets = HESAI40_MAX_PACKETS;
     pkt_buffer_capacity_ = HESAI40_MAX_PACKETS * 10;
   } else if (conf_.model() == HESAI64) {
+    max_packets = HESAI64_MAX_PACKETS;
     pkt_buffer_capacity_ = HESAI64_MAX_PACKETS * 10;
   } else {
     AERROR << "Not support model:" << conf_.model();
@@ -59,11 +62,18 @@ bool HesaiDriver::Init() {
       AERROR << "make scan buffer error";
       return false;
     }
+    // prewarm one sweep worth of firing packet slots per scan, the
+    // per-packet append in ProcessThread then runs without allocating
+    for (int j = 0; j < max_packets; ++j) {
+      scan_buffer_[i]->add_firing_pkts()->mutable_data()->resize(ETHERNET_MTU);
+    }
+    RecycleScan(scan_buffer_[i]);
   }
   tz_second_ = conf_.time_zone() * 3600;
   input_.reset(new Input(conf_.lidar_recv_port(), conf_.gps_recv_port()));
   poll_thread_ = std::thread(&HesaiDriver::PollThread, this);
   process_thread_ = std::thread(&HesaiDriver::ProcessThread, this);
+  publish_thread_ = std::thread(&HesaiDriver::PublishThread, this);
   return true;
 }
 
@@ -177,16 +187,48 @@ void HesaiDriver::ProcessThread() {
       scan_buffer_[index_]->mutable_header()->set_sequence_num(seq++);
       scan_buffer_[index_]->set_model(conf_.model());
       scan_buffer_[index_]->set_basetime(0);
-      scan_writer_->Write(scan_buffer_[index_]);
-      AINFO << "publish scan size:" << scan_buffer_[index_]->firing_pkts_size()
-            << ", index:" << index_;
+      {
+        std::lock_guard<std::mutex> lck(scan_mutex_);
+        scan_queue_.push_back(scan_buffer_[index_]);
+        scan_condition_.notify_all();
+      }
       ++index_;
       index_ = index_ % scan_buffer_size_;
-      scan_buffer_[index_]->Clear();
+      RecycleScan(scan_buffer_[index_]);
     }
   }
 }
 
+void HesaiDriver::PublishThread() {
+  std::shared_ptr<HesaiScan> scan = nullptr;
+  AINFO << "scan publish thread start";
+  while (running_) {
+    {
+      std::unique_lock<std::mutex> lck(scan_mutex_);
+      if (scan_queue_.empty()) {
+        scan_condition_.wait(lck);
+      }
+      if (scan_queue_.empty()) {
+        // exit notify empty
+        continue;
+      }
+      scan = scan_queue_.front();
+      scan_queue_.pop_front();
+    }
+    scan_writer_->Write(scan);
+    AINFO << "publish scan size:" << scan->firing_pkts_size();
+  }
+}
+
+void HesaiDriver::RecycleScan(const std::shared_ptr<HesaiScan>& scan) {
+  // return the firing packet slots to the repeated field's cleared
+  // element cache, the next add_firing_pkts() hands them back with
+  // their buffers intact instead of reallocating
+  while (scan->firing_pkts_size() > 0) {
+    scan->mutable_firing_pkts()->RemoveLast();
+  }
+}
+
 }  // namespace hesai
 }  // namespace drivers
 }  // namespace apollo
@@ -61,8 +61,11 @@ class HesaiDriver {
   std::shared_ptr<Writer<HesaiScan>> scan_writer_ = nullptr;
   std::mutex packet_mutex_;
   std::condition_variable packet_condition_;
+  std::mutex scan_mutex_;
+  std::condition_variable scan_condition_;
   std::thread poll_thread_;
   std::thread process_thread_;
+  std::thread publish_thread_;
   std::atomic<bool> running_ = {true};
   std::deque<std::shared_ptr<HesaiScan>> scan_buffer_;
   int scan_buffer_size_ = 10;
@@ -72,22 +75,29 @@ class HesaiDriver {
   int pkt_index_ = 0;
   int pkt_buffer_capacity_ = 0;
   std::list<std::shared_ptr<HesaiPacket>> pkt_queue_;
+  std::deque<std::shared_ptr<HesaiScan>> scan_queue_;
 
  private:
   void PollThread();
   void ProcessThread();
+  void PublishThread();
   void ProcessGps(const HesaiPacket& pkt);
+  void RecycleScan(const std::shared_ptr<HesaiScan>& scan);
 
   void Stop() {
     AINFO << "driver stoping...";
     running_.store(false);
     packet_condition_.notify_all();
+    scan_condition_.notify_all();
     if (poll_thread_.joinable()) {
       poll_thread_.join();
     }
     if (process_thread_.joinable()) {
       process_thread_.join();
     }
+    if (publish_thread_.joinable()) {
+      publish_thread_.join();
+    }
   }
 };
 
@@ -187,6 +187,10 @@ void Hesai40Parser::CalcPointXYZIT(Hesai40Packet *pkt, int blockid) {
     if (unit.distance <= 0.5 || unit.distance > 200.0) {
       continue;
     }
+    /* optional coarse downsampling, keep every Nth point */
+    if (downsample_factor_ > 1 && point_index_++ % downsample_factor_ != 0) {
+      continue;
+    }
     double xyDistance =
         unit.distance * cosf(degreeToRadian(elev_angle_map_[i]));
     float x = static_cast<float>(
@@ -221,6 +221,10 @@ void Hesai64Parser::CalcPointXYZIT(Hesai64Packet *pkt, int blockid,
     if (unit.distance < 0.1 || unit.distance > 200.0) {
       continue;
     }
+    /* optional coarse downsampling, keep every Nth point */
+    if (downsample_factor_ > 1 && point_index_++ % downsample_factor_ != 0) {
+      continue;
+    }
 
     double xyDistance =
         unit.distance * cosf(degreeToRadian(elev_angle_map_[i]));
@@ -52,6 +52,11 @@ class Parser {
   void Parse(const uint8_t* data, int size, bool* is_end);
   bool Parse(const std::shared_ptr<HesaiScan>& scan);
   bool Init();
+  // @brief keep only every Nth point at parse time, coarse thinning for
+  //        hosts which cannot keep up with full sweeps. 1 keeps all points.
+  void SetDownsampleFactor(int factor) {
+    downsample_factor_ = factor < 1 ? 1 : factor;
+  }
 
  private:
   std::thread online_calibration_thread_;
@@ -90,6 +95,8 @@ class Parser {
   uint32_t min_packets_ = HESAI40_MIN_PACKETS;
   uint32_t max_packets_ = HESAI40_MAX_PACKETS;
   uint32_t packet_nums_ = 0;
+  int downsample_factor_ = 1;
+  uint32_t point_index_ = 0;
 
   double elev_angle_map_[LASER_COUNT_L64] = {0};
   double horizatal_azimuth_offset_map_[LASER_COUNT_L64] = {0};
@@ -157,6 +157,15 @@ void Compensator::MotionCompensation(
     double theta = acos(abs_d);
     double sin_theta = sin(theta);
     double c1_sign = (d > 0) ? 1 : -1;
+    msg_compensated->mutable_point()->Reserve(msg->point_size());
+    // All points of one firing share a timestamp, so the interpolated pose
+    // only has to be evaluated once per distinct timestamp. Keeping it as a
+    // rotation matrix also lets Eigen vectorize the per-point transform
+    // instead of rebuilding an Affine3d from a quaternion every point.
+    uint64_t cached_tp = 0;
+    bool has_cached_pose = false;
+    Eigen::Matrix3d rotation = Eigen::Matrix3d::Identity();
+    Eigen::Vector3d translation_t = Eigen::Vector3d::Zero();
     for (const auto& point : msg->point()) {
       float x_scalar = point.x();
       if (std::isnan(x_scalar)) {
@@ -173,16 +182,18 @@ void Compensator::MotionCompensation(
       Eigen::Vector3d p(x_scalar, y_scalar, z_scalar);
 
       uint64_t tp = point.timestamp();
-      double t = static_cast<double>(timestamp_max - tp) * f;
-
-      Eigen::Translation3d ti(t * translation);
-
-      double c0 = sin((1 - t) * theta) / sin_theta;
-      double c1 = sin(t * theta) / sin_theta * c1_sign;
-      Eigen::Quaterniond qi(c0 * q0.coeffs() + c1 * q1.coeffs());
+      if (!has_cached_pose || tp != cached_tp) {
+        double t = static_cast<double>(timestamp_max - tp) * f;
+        double c0 = sin((1 - t) * theta) / sin_theta;
+        double c1 = sin(t * theta) / sin_theta * c1_sign;
+        Eigen::Quaterniond qi(c0 * q0.coeffs() + c1 * q1.coeffs());
+        rotation = qi.toRotationMatrix();
+        translation_t = t * translation;
+        cached_tp = tp;
+        has_cached_pose = true;
+      }
 
-      Eigen::Affine3d trans = ti * qi;
-      p = trans * p;
+      p = rotation * p + translation_t;
 
       auto* point_new = msg_compensated->add_point();
       point_new->set_intensity(point.intensity());
@@ -194,6 +205,7 @@ void Compensator::MotionCompensation(
     return;
   }
   // Not a "significant" rotation. Do translation only.
+  msg_compensated->mutable_point()->Reserve(msg->point_size());
   for (auto& point : msg->point()) {
     float x_scalar = point.x();
     if (std::isnan(x_scalar)) {
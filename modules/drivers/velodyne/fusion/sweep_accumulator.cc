@@ -0,0 +1,115 @@
+/******************************************************************************
+ * Copyright 2020 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "modules/drivers/velodyne/fusion/sweep_accumulator.h"
+
+#include <cmath>
+
+#include "cyber/common/log.h"
+
+namespace apollo {
+namespace drivers {
+namespace velodyne {
+
+SweepAccumulator::SweepAccumulator(size_t sweep_num,
+                                   size_t max_points_per_sweep)
+    : sweep_capacity_(sweep_num), slot_capacity_(max_points_per_sweep) {
+  CHECK_GT(sweep_capacity_, 0U);
+  CHECK_GT(slot_capacity_, 0U);
+  slab_.resize(sweep_capacity_ * slot_capacity_);
+  slots_.resize(sweep_capacity_);
+}
+
+void SweepAccumulator::AddSweep(const PointCloud& cloud,
+                                const Eigen::Affine3d& pose) {
+  auto& slot = slots_[next_slot_];
+  SweepPoint* slot_data = &slab_[next_slot_ * slot_capacity_];
+
+  size_t size = static_cast<size_t>(cloud.point_size());
+  if (size > slot_capacity_) {
+    AWARN << "Sweep with " << size << " points exceeds slot capacity "
+          << slot_capacity_ << ", dropping the excess points";
+    size = slot_capacity_;
+  }
+
+  const bool has_pose = !std::isnan(pose(0, 0));
+  for (size_t i = 0; i < size; ++i) {
+    const auto& point = cloud.point(static_cast<int>(i));
+    auto& slab_point = slot_data[i];
+    slab_point.intensity = static_cast<float>(point.intensity());
+    slab_point.timestamp = point.timestamp();
+    if (has_pose && !std::isnan(point.x())) {
+      Eigen::Matrix<float, 3, 1> pt(point.x(), point.y(), point.z());
+      slab_point.x = static_cast<float>(
+          pose(0, 0) * pt.coeffRef(0) + pose(0, 1) * pt.coeffRef(1) +
+          pose(0, 2) * pt.coeffRef(2) + pose(0, 3));
+      slab_point.y = static_cast<float>(
+          pose(1, 0) * pt.coeffRef(0) + pose(1, 1) * pt.coeffRef(1) +
+          pose(1, 2) * pt.coeffRef(2) + pose(1, 3));
+      slab_point.z = static_cast<float>(
+          pose(2, 0) * pt.coeffRef(0) + pose(2, 1) * pt.coeffRef(1) +
+          pose(2, 2) * pt.coeffRef(2) + pose(2, 3));
+    } else {
+      slab_point.x = point.x();
+      slab_point.y = point.y();
+      slab_point.z = point.z();
+    }
+  }
+
+  slot.size = size;
+  slot.pose = pose;
+  slot.measurement_time = cloud.measurement_time();
+  slot.valid = true;
+
+  next_slot_ = (next_slot_ + 1) % sweep_capacity_;
+  if (valid_num_ < sweep_capacity_) {
+    ++valid_num_;
+  }
+}
+
+std::vector<SweepView> SweepAccumulator::GetSweepViews() const {
+  std::vector<SweepView> views;
+  views.reserve(valid_num_);
+  // the oldest sweep lives in the slot that is overwritten next
+  size_t slot_index =
+      (next_slot_ + sweep_capacity_ - valid_num_) % sweep_capacity_;
+  for (size_t i = 0; i < valid_num_; ++i) {
+    const auto& slot = slots_[slot_index];
+    if (slot.valid) {
+      SweepView view;
+      view.points = &slab_[slot_index * slot_capacity_];
+      view.size = slot.size;
+      view.pose = slot.pose;
+      view.measurement_time = slot.measurement_time;
+      views.push_back(view);
+    }
+    slot_index = (slot_index + 1) % sweep_capacity_;
+  }
+  return views;
+}
+
+void SweepAccumulator::Clear() {
+  for (auto& slot : slots_) {
+    slot.size = 0;
+    slot.valid = false;
+  }
+  next_slot_ = 0;
+  valid_num_ = 0;
+}
+
+}  // namespace velodyne
+}  // namespace drivers
+}  // namespace apollo
@@ -0,0 +1,102 @@
+/******************************************************************************
+ * Copyright 2020 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "Eigen/Eigen"
+
+// Eigen 3.3.7: #define ALIVE (0)
+// fastrtps: enum ChangeKind_t { ALIVE, ... };
+#if defined(ALIVE)
+#   undef ALIVE
+#endif
+
+#include "modules/drivers/proto/pointcloud.pb.h"
+
+namespace apollo {
+namespace drivers {
+namespace velodyne {
+
+// Point layout inside the accumulation slab. Plain data so a whole sweep
+// segment can be handed out as a contiguous array without per-point
+// protobuf accessor calls.
+struct SweepPoint {
+  float x = 0.0f;
+  float y = 0.0f;
+  float z = 0.0f;
+  float intensity = 0.0f;
+  uint64_t timestamp = 0;
+};
+
+// Read-only view of one accumulated sweep. The points pointer references
+// the accumulator slab directly; it stays valid until the slot is
+// overwritten by a later sweep, i.e. for sweep_num more AddSweep calls.
+struct SweepView {
+  const SweepPoint* points = nullptr;
+  size_t size = 0;
+  // pose that moved this sweep into the accumulation frame
+  Eigen::Affine3d pose = Eigen::Affine3d::Identity();
+  double measurement_time = 0.0;
+};
+
+// Ring buffer of the last N motion-compensated sweeps, stored in one
+// preallocated slab partitioned into fixed-capacity slots. Each sweep is
+// transformed into a common accumulation frame exactly once on insert and
+// tagged with its pose, so in-process consumers that densify over
+// multiple sweeps read the slab in place instead of re-copying clouds.
+class SweepAccumulator {
+ public:
+  SweepAccumulator(size_t sweep_num, size_t max_points_per_sweep);
+  ~SweepAccumulator() = default;
+
+  // Transforms the cloud by pose into the accumulation frame and stores
+  // it, overwriting the oldest sweep when the ring is full. A NaN pose
+  // stores the points untransformed, matching the fusion component's
+  // append behavior. Points beyond the slot capacity are dropped.
+  void AddSweep(const PointCloud& cloud, const Eigen::Affine3d& pose);
+
+  // views of the held sweeps, ordered from oldest to newest
+  std::vector<SweepView> GetSweepViews() const;
+
+  size_t SweepNum() const { return valid_num_; }
+  size_t SweepCapacity() const { return sweep_capacity_; }
+
+  void Clear();
+
+ private:
+  struct Slot {
+    size_t size = 0;
+    Eigen::Affine3d pose = Eigen::Affine3d::Identity();
+    double measurement_time = 0.0;
+    bool valid = false;
+  };
+
+  size_t sweep_capacity_ = 0;
+  size_t slot_capacity_ = 0;
+  // sweep_capacity_ * slot_capacity_ points, allocated once
+  std::vector<SweepPoint> slab_;
+  std::vector<Slot> slots_;
+  // slot the next sweep is written into
+  size_t next_slot_ = 0;
+  size_t valid_num_ = 0;
+};
+
+}  // namespace velodyne
+}  // namespace drivers
+}  // namespace apollo
@@ -24,6 +24,13 @@ Velodyne128Parser::Velodyne128Parser(const Config& config)
     : VelodyneParser(config), previous_packet_stamp_(0), gps_base_usec_(0) {
   inner_time_ = &velodyne::INNER_TIME_128;
   need_two_pt_correction_ = false;
+  raw_distance_batch_.resize(SCANS_PER_PACKET);
+  rotation_batch_.resize(SCANS_PER_PACKET);
+  laser_id_batch_.resize(SCANS_PER_PACKET);
+  point_index_batch_.resize(SCANS_PER_PACKET);
+  x_batch_.resize(SCANS_PER_PACKET);
+  y_batch_.resize(SCANS_PER_PACKET);
+  z_batch_.resize(SCANS_PER_PACKET);
 }
 
 void Velodyne128Parser::GeneratePointcloud(
@@ -77,6 +84,7 @@ void Velodyne128Parser::Unpack(const VelodynePacket& pkt,
   uint16_t azimuth_corrected = 0;
   const RawPacket* raw = (const RawPacket*)pkt.data().c_str();
   double basetime = raw->gps_timestamp;
+  size_t batch_size = 0;
 
   for (int block = 0; block < BLOCKS_PER_PACKET; block++) {
     // Calculate difference between current and next block's azimuth angle.
@@ -101,7 +109,6 @@ void Velodyne128Parser::Unpack(const VelodynePacket& pkt,
       uint8_t chan_id = static_cast<uint8_t>(j + group * 32);
       uint8_t firing_order = chan_id / 8;
       firing_order = 0;
-      LaserCorrection& corrections = calibration_.laser_corrections_[chan_id];
       // distance extraction
       // union two_bytes tmp;
       union RawDistance raw_distance;
@@ -110,7 +117,7 @@ void Velodyne128Parser::Unpack(const VelodynePacket& pkt,
 
       float real_distance =
           raw_distance.raw_distance * VSL128_DISTANCE_RESOLUTION;
-      float distance = real_distance + corrections.dist_correction;
+      float distance = real_distance + laser_table_.dist_correction[chan_id];
 
       uint64_t timestamp = static_cast<uint64_t>(GetTimestamp(
           basetime, (*inner_time_)[block][j], static_cast<uint16_t>(block)));
@@ -138,27 +145,42 @@ void Velodyne128Parser::Unpack(const VelodynePacket& pkt,
       azimuth_corrected =
           (static_cast<uint16_t>(round(azimuth_corrected_f))) % 36000;
 
-      // add new point
+      // add new point, coords are filled in by the batched pass below
       PointXYZIT* point_new = pc->add_point();
 
       // compute time , time offset is zero
       point_new->set_timestamp(timestamp);
-      ComputeCoords(real_distance, corrections, azimuth_corrected, point_new);
-
-      intensity = IntensityCompensate(corrections, raw_distance.raw_distance,
+      intensity = IntensityCompensate(chan_id, raw_distance.raw_distance,
                                       intensity);
       point_new->set_intensity(intensity);
+
+      raw_distance_batch_[batch_size] = real_distance;
+      rotation_batch_[batch_size] = azimuth_corrected;
+      laser_id_batch_[batch_size] = chan_id;
+      point_index_batch_[batch_size] = pc->point_size() - 1;
+      ++batch_size;
     }
     // }
   }
+
+  // one vectorizable pass over the whole packet instead of per-point
+  // trigonometry and calibration map lookups
+  ComputeCoordsBatch(batch_size, raw_distance_batch_.data(),
+                     rotation_batch_.data(), laser_id_batch_.data(),
+                     x_batch_.data(), y_batch_.data(), z_batch_.data());
+  for (size_t i = 0; i < batch_size; ++i) {
+    PointXYZIT* point = pc->mutable_point(point_index_batch_[i]);
+    point->set_x(x_batch_[i]);
+    point->set_y(y_batch_[i]);
+    point->set_z(z_batch_[i]);
+  }
 }
 
-int Velodyne128Parser::IntensityCompensate(const LaserCorrection& corrections,
+int Velodyne128Parser::IntensityCompensate(uint16_t laser_id,
                                            const uint16_t raw_distance,
                                            int intensity) {
-  float focal_offset = 256 * (1 - corrections.focal_distance / 13100) *
-                       (1 - corrections.focal_distance / 13100);
-  float focal_slope = corrections.focal_slope;
+  float focal_offset = laser_table_.focal_offset[laser_id];
+  float focal_slope = laser_table_.focal_slope[laser_id];
 
   intensity += static_cast<int>(
       focal_slope *
@@ -167,12 +189,12 @@ int Velodyne128Parser::IntensityCompensate(const LaserCorrection& corrections,
           256.0f * (1.0f - static_cast<float>(raw_distance) / 65535.0f) *
               (1.0f - static_cast<float>(raw_distance) / 65535.0f))));
 
-  if (intensity < corrections.min_intensity) {
-    intensity = corrections.min_intensity;
+  if (intensity < laser_table_.min_intensity[laser_id]) {
+    intensity = laser_table_.min_intensity[laser_id];
   }
 
-  if (intensity > corrections.max_intensity) {
-    intensity = corrections.max_intensity;
+  if (intensity > laser_table_.max_intensity[laser_id]) {
+    intensity = laser_table_.max_intensity[laser_id];
   }
   return intensity;
 }
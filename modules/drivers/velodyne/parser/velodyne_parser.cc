@@ -14,6 +14,8 @@
  * limitations under the License.
  *****************************************************************************/
 
+#include <algorithm>
+
 #include "cyber/cyber.h"
 
 #include "modules/drivers/velodyne/parser/util.h"
@@ -54,6 +56,48 @@ uint64_t VelodyneParser::GetGpsStamp(double current_packet_stamp,
   return gps_stamp;
 }
 
+void LaserCorrectionTable::Build(const Calibration &calibration) {
+  // sized from the laser ids actually present, num_lasers_ is not set
+  // before the calibration is read
+  size_t num_lasers = 0;
+  for (const auto &correction : calibration.laser_corrections_) {
+    if (correction.first >= 0) {
+      num_lasers = std::max(num_lasers,
+                            static_cast<size_t>(correction.first) + 1);
+    }
+  }
+  cos_rot_correction.assign(num_lasers, 0.0f);
+  sin_rot_correction.assign(num_lasers, 0.0f);
+  cos_vert_correction.assign(num_lasers, 1.0f);
+  sin_vert_correction.assign(num_lasers, 0.0f);
+  dist_correction.assign(num_lasers, 0.0f);
+  horiz_offset_correction.assign(num_lasers, 0.0f);
+  vert_offset_correction.assign(num_lasers, 0.0f);
+  focal_offset.assign(num_lasers, 0.0f);
+  focal_slope.assign(num_lasers, 0.0f);
+  min_intensity.assign(num_lasers, 0);
+  max_intensity.assign(num_lasers, 255);
+  for (const auto &correction : calibration.laser_corrections_) {
+    const int id = correction.first;
+    if (id < 0 || id >= static_cast<int>(num_lasers)) {
+      continue;
+    }
+    const LaserCorrection &laser = correction.second;
+    cos_rot_correction[id] = laser.cos_rot_correction;
+    sin_rot_correction[id] = laser.sin_rot_correction;
+    cos_vert_correction[id] = laser.cos_vert_correction;
+    sin_vert_correction[id] = laser.sin_vert_correction;
+    dist_correction[id] = laser.dist_correction;
+    horiz_offset_correction[id] = laser.horiz_offset_correction;
+    vert_offset_correction[id] = laser.vert_offset_correction;
+    focal_offset[id] = 256.0f * (1.0f - laser.focal_distance / 13100.0f) *
+                       (1.0f - laser.focal_distance / 13100.0f);
+    focal_slope[id] = laser.focal_slope;
+    min_intensity[id] = laser.min_intensity;
+    max_intensity[id] = laser.max_intensity;
+  }
+}
+
 PointXYZIT VelodyneParser::get_nan_point(uint64_t timestamp) {
   PointXYZIT nan_point;
   nan_point.set_timestamp(timestamp);
@@ -103,6 +147,7 @@ void VelodyneParser::setup() {
   init_angle_params(config_.view_direction(), config_.view_width());
   init_sin_cos_rot_table(sin_rot_table_, cos_rot_table_, ROTATION_MAX_UNITS,
                          ROTATION_RESOLUTION);
+  laser_table_.Build(calibration_);
 }
 
 bool VelodyneParser::is_scan_valid(int rotation, float range) {
@@ -200,6 +245,40 @@ void VelodyneParser::ComputeCoords(const float &raw_distance,
   point->set_z(static_cast<float>(z));
 }
 
+void VelodyneParser::ComputeCoordsBatch(size_t n, const float *raw_distances,
+                                        const uint16_t *rotations,
+                                        const uint16_t *laser_ids, float *xs,
+                                        float *ys, float *zs) {
+  const float *cos_rot_corr = laser_table_.cos_rot_correction.data();
+  const float *sin_rot_corr = laser_table_.sin_rot_correction.data();
+  const float *cos_vert_corr = laser_table_.cos_vert_correction.data();
+  const float *sin_vert_corr = laser_table_.sin_vert_correction.data();
+  const float *dist_corr = laser_table_.dist_correction.data();
+  const float *horiz_offset = laser_table_.horiz_offset_correction.data();
+  const float *vert_offset = laser_table_.vert_offset_correction.data();
+  for (size_t i = 0; i < n; ++i) {
+    const uint16_t rotation = rotations[i];
+    const uint16_t id = laser_ids[i];
+    // cos(a-b) = cos(a)*cos(b) + sin(a)*sin(b)
+    // sin(a-b) = sin(a)*cos(b) - cos(a)*sin(b)
+    const float cos_rot_angle = cos_rot_table_[rotation] * cos_rot_corr[id] +
+                                sin_rot_table_[rotation] * sin_rot_corr[id];
+    const float sin_rot_angle = sin_rot_table_[rotation] * cos_rot_corr[id] -
+                                cos_rot_table_[rotation] * sin_rot_corr[id];
+    const float distance = raw_distances[i] + dist_corr[id];
+    const float xy_distance = distance * cos_vert_corr[id];
+    const float x =
+        xy_distance * sin_rot_angle - horiz_offset[id] * cos_rot_angle;
+    const float y =
+        xy_distance * cos_rot_angle + horiz_offset[id] * sin_rot_angle;
+    const float z = distance * sin_vert_corr[id] + vert_offset[id];
+    // standard ROS coordinate system (right-hand rule)
+    xs[i] = y;
+    ys[i] = -x;
+    zs[i] = z;
+  }
+}
+
 VelodyneParser *VelodyneParserFactory::CreateParser(Config source_config) {
   Config config = source_config;
   if (config.model() == VLP16) {
@@ -56,6 +56,7 @@
 #include <limits>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include <boost/format.hpp>
 
@@ -219,6 +220,33 @@ struct RawPacket {
 
 static const float nan = std::numeric_limits<float>::signaling_NaN();
 
+/** \brief Per-laser calibration constants in structure-of-arrays form.
+ *
+ *  Calibration::laser_corrections_ is a std::map, so reading it per point
+ *  costs a tree walk per firing.  This table flattens the constants the
+ *  coordinate and intensity computations need into contiguous arrays
+ *  indexed by laser id, which the batched unpack path reads with plain
+ *  loads in a loop the compiler can vectorize.
+ */
+struct LaserCorrectionTable {
+  std::vector<float> cos_rot_correction;
+  std::vector<float> sin_rot_correction;
+  std::vector<float> cos_vert_correction;
+  std::vector<float> sin_vert_correction;
+  std::vector<float> dist_correction;
+  std::vector<float> horiz_offset_correction;
+  std::vector<float> vert_offset_correction;
+  // 256 * (1 - focal_distance / 13100)^2, hoisted out of the per-point
+  // intensity compensation
+  std::vector<float> focal_offset;
+  std::vector<float> focal_slope;
+  std::vector<int> min_intensity;
+  std::vector<int> max_intensity;
+
+  void Build(const Calibration& calibration);
+  size_t size() const { return dist_correction.size(); }
+};
+
 /** \brief Velodyne data conversion class */
 class VelodyneParser {
  public:
@@ -250,6 +278,8 @@ class VelodyneParser {
   const float (*inner_time_)[12][32];
 
   Calibration calibration_;
+  // flattened view of calibration_, rebuilt in setup()
+  LaserCorrectionTable laser_table_;
   float sin_rot_table_[ROTATION_MAX_UNITS];
   float cos_rot_table_[ROTATION_MAX_UNITS];
   double last_time_stamp_;
@@ -270,6 +300,24 @@ class VelodyneParser {
                      const LaserCorrection& corrections,
                      const uint16_t rotation, PointXYZIT* point);
 
+  /**
+   * \brief Compute coords for a whole batch of firings in one pass
+   *
+   * Single-precision port of ComputeCoords over the flattened
+   * calibration table; the error stays far below the 2 mm sensor
+   * resolution.  The two-point distance correction is not applied, so
+   * parsers with need_two_pt_correction_ must keep using ComputeCoords.
+   *
+   * @param n Number of firings in the batch
+   * @param raw_distances Distances in meters, one per firing
+   * @param rotations Corrected azimuths in hundredths of degrees
+   * @param laser_ids Laser id of each firing, indexes laser_table_
+   * @param xs,ys,zs Output coords in the ROS coordinate system
+   */
+  void ComputeCoordsBatch(size_t n, const float* raw_distances,
+                          const uint16_t* rotations, const uint16_t* laser_ids,
+                          float* xs, float* ys, float* zs);
+
   bool is_scan_valid(int rotation, float distance);
 
   /**
@@ -364,12 +412,22 @@ class Velodyne128Parser : public VelodyneParser {
   uint64_t GetTimestamp(double base_time, float time_offset,
                         uint16_t laser_block_id);
   void Unpack(const VelodynePacket& pkt, std::shared_ptr<PointCloud> pc);
-  int IntensityCompensate(const LaserCorrection& corrections,
-                          const uint16_t raw_distance, int intensity);
+  int IntensityCompensate(uint16_t laser_id, const uint16_t raw_distance,
+                          int intensity);
   // Previous Velodyne packet time stamp. (offset to the top hour)
   double previous_packet_stamp_;
   uint64_t gps_base_usec_;  // full time
-};                          // class Velodyne128Parser
+
+  // per-packet scratch buffers for the batched coordinate computation,
+  // preallocated to SCANS_PER_PACKET so Unpack never allocates
+  std::vector<float> raw_distance_batch_;
+  std::vector<uint16_t> rotation_batch_;
+  std::vector<uint16_t> laser_id_batch_;
+  std::vector<int> point_index_batch_;
+  std::vector<float> x_batch_;
+  std::vector<float> y_batch_;
+  std::vector<float> z_batch_;
+};  // class Velodyne128Parser
 
 class VelodyneParserFactory {
  public:
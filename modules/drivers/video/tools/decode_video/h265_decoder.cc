@@ -27,9 +27,22 @@ namespace video {
 // gets stable
 #pragma GCC diagnostic ignored "-Wdeprecated-declarations"
 
-bool H265Decoder::Init() {
+bool H265Decoder::Init(bool try_hw_decoder) {
   avcodec_register_all();
-  AVCodec* codec_h265 = avcodec_find_decoder(AV_CODEC_ID_H265);
+  AVCodec* codec_h265 = nullptr;
+  bool using_hw_decoder = false;
+  if (try_hw_decoder) {
+    // ffmpeg's NVDEC wrapper, offloads the decode to the GPU video
+    // engine when the build and the machine have it
+    codec_h265 = avcodec_find_decoder_by_name("hevc_cuvid");
+    using_hw_decoder = codec_h265 != nullptr;
+    if (!using_hw_decoder) {
+      AINFO << "hevc_cuvid decoder not available, using software decoder";
+    }
+  }
+  if (codec_h265 == nullptr) {
+    codec_h265 = avcodec_find_decoder(AV_CODEC_ID_H265);
+  }
   if (codec_h265 == nullptr) {
     AERROR << "error: codec not found";
     return false;
@@ -40,9 +53,16 @@ bool H265Decoder::Init() {
     return false;
   }
   if (avcodec_open2(codec_ctx_h265_, codec_h265, nullptr) < 0) {
+    if (using_hw_decoder) {
+      // the wrapper exists but the hardware refused, retry in software
+      AWARN << "could not open hevc_cuvid, falling back to software decoder";
+      avcodec_free_context(&codec_ctx_h265_);
+      return Init(false);
+    }
     AERROR << "error: could not open codec";
     return false;
   }
+  AINFO << "h265 decoder in use: " << codec_h265->name;
   yuv_frame_ = av_frame_alloc();
   if (yuv_frame_ == nullptr) {
     AERROR << "error: could not alloc yuv frame";
@@ -82,15 +102,59 @@ void H265Decoder::Release() {
     av_frame_free(&yuv_frame_);
     yuv_frame_ = nullptr;
   }
+  if (conv_frame_ != nullptr) {
+    av_frame_free(&conv_frame_);
+    conv_frame_ = nullptr;
+  }
+  if (sws_ctx_ != nullptr) {
+    sws_freeContext(sws_ctx_);
+    sws_ctx_ = nullptr;
+  }
   if (codec_ctx_jpeg_ != nullptr) {
     avcodec_free_context(&codec_ctx_jpeg_);
     codec_ctx_jpeg_ = nullptr;
   }
 }
 
+AVFrame* H265Decoder::ConvertForEncoder(AVFrame* frame) {
+  if (frame->format == codec_ctx_jpeg_->pix_fmt) {
+    return frame;
+  }
+  if (conv_frame_ == nullptr) {
+    // pooled conversion frame, allocated once and reused
+    conv_frame_ = av_frame_alloc();
+    if (conv_frame_ == nullptr) {
+      AERROR << "error: could not alloc conversion frame";
+      return nullptr;
+    }
+    conv_frame_->format = codec_ctx_jpeg_->pix_fmt;
+    conv_frame_->width = frame->width;
+    conv_frame_->height = frame->height;
+    if (av_image_alloc(conv_frame_->data, conv_frame_->linesize, frame->width,
+                       frame->height, codec_ctx_jpeg_->pix_fmt, 32) < 0) {
+      AERROR << "error: could not alloc conversion frame buffer";
+      av_frame_free(&conv_frame_);
+      return nullptr;
+    }
+  }
+  sws_ctx_ = sws_getCachedContext(
+      sws_ctx_, frame->width, frame->height,
+      static_cast<AVPixelFormat>(frame->format), conv_frame_->width,
+      conv_frame_->height, codec_ctx_jpeg_->pix_fmt, SWS_BILINEAR, nullptr,
+      nullptr, nullptr);
+  if (sws_ctx_ == nullptr) {
+    AERROR << "error: could not get sws context";
+    return nullptr;
+  }
+  sws_scale(sws_ctx_, frame->data, frame->linesize, 0, frame->height,
+            conv_frame_->data, conv_frame_->linesize);
+  conv_frame_->pts = frame->pts;
+  return conv_frame_;
+}
+
 H265Decoder::DecodingResult H265Decoder::Process(
     const uint8_t* indata, const int32_t insize,
-    std::vector<uint8_t>* outdata) const {
+    std::vector<uint8_t>* outdata) {
   AVPacket apt;
   outdata->clear();
   av_init_packet(&apt);
@@ -113,8 +177,13 @@ H265Decoder::DecodingResult H265Decoder::Process(
     return H265Decoder::DecodingResult::WARN;
   }
   av_packet_unref(&apt);
+  AVFrame* encode_frame = ConvertForEncoder(yuv_frame_);
+  if (encode_frame == nullptr) {
+    return H265Decoder::DecodingResult::FATAL;
+  }
   got_picture = 0;
-  ret = avcodec_encode_video2(codec_ctx_jpeg_, &apt, yuv_frame_, &got_picture);
+  ret =
+      avcodec_encode_video2(codec_ctx_jpeg_, &apt, encode_frame, &got_picture);
   if (ret < 0) {
     AERROR << "error: jpeg encode failed, error code = " << ret;
     return H265Decoder::DecodingResult::FATAL;
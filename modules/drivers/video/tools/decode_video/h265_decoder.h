@@ -45,12 +45,14 @@ class H265Decoder {
  public:
   H265Decoder() = default;
 
-  // Init decoder by acquiring resources
-  bool Init();
+  // Init decoder by acquiring resources. Prefers ffmpeg's NVDEC-backed
+  // hevc_cuvid decoder when present and falls back to the software
+  // decoder otherwise; pass false to force the software path.
+  bool Init(bool try_hw_decoder = true);
 
   // Process frames according to input data, and output converted data
   DecodingResult Process(const uint8_t* indata, const int32_t insize,
-                         std::vector<uint8_t>* outdata) const;
+                         std::vector<uint8_t>* outdata);
 
   // Destructor, releasing the resources
   ~H265Decoder() { Release(); }
@@ -61,9 +63,16 @@ class H265Decoder {
  private:
   void Release();
 
+  // Returns the frame to feed the jpeg encoder. The hardware decoder
+  // outputs NV12, which is converted into a pooled yuv422p frame that
+  // is allocated once and reused across Process calls.
+  AVFrame* ConvertForEncoder(AVFrame* frame);
+
   AVCodecContext* codec_ctx_h265_ = nullptr;
   AVCodecContext* codec_ctx_jpeg_ = nullptr;
   AVFrame* yuv_frame_ = nullptr;
+  AVFrame* conv_frame_ = nullptr;
+  struct SwsContext* sws_ctx_ = nullptr;
 };
 
 }  // namespace video
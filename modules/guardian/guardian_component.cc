@@ -43,8 +43,17 @@ bool GuardianComponent::Init() {
       FLAGS_control_command_topic,
       [this](const std::shared_ptr<ControlCommand>& cmd) {
         ADEBUG << "Received control data: run control callback.";
-        std::lock_guard<std::mutex> lock(mutex_);
-        control_cmd_.CopyFrom(*cmd);
+        // The relay path does not take the module mutex: the command is
+        // swapped in atomically and the fields watched on the safety
+        // path are latched through the lock-free buffer.
+        std::atomic_store(&latest_control_cmd_, cmd);
+        ControlCommandSnapshot snapshot;
+        snapshot.timestamp_sec = cmd->header().timestamp_sec();
+        snapshot.throttle = cmd->throttle();
+        snapshot.brake = cmd->brake();
+        snapshot.steering_target = cmd->steering_target();
+        snapshot.steering_rate = cmd->steering_rate();
+        control_latch_.Write(snapshot);
       });
 
   system_status_reader_ = node_->CreateReader<SystemStatus>(
@@ -65,14 +74,24 @@ bool GuardianComponent::Proc() {
   ADEBUG << "Timer is triggered: publish GuardianComponent result";
   bool safety_mode_triggered = false;
   if (guardian_conf_.guardian_enable()) {
-    std::lock_guard<std::mutex> lock(mutex_);
     static constexpr double kSecondsTillTimeout(2.5);
-    if (cyber::Time::Now().ToSecond() - last_status_received_s_ >
-        kSecondsTillTimeout) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (cyber::Time::Now().ToSecond() - last_status_received_s_ >
+          kSecondsTillTimeout) {
+        safety_mode_triggered = true;
+      }
+      safety_mode_triggered = safety_mode_triggered ||
+                              system_status_.has_safety_mode_trigger_time();
+    }
+    // Watchdog on the latched command itself: a command that stopped
+    // refreshing means control died since the last system status.
+    ControlCommandSnapshot snapshot;
+    if (control_latch_.Read(&snapshot) &&
+        cyber::Time::Now().ToSecond() - snapshot.timestamp_sec >
+            kSecondsTillTimeout) {
       safety_mode_triggered = true;
     }
-    safety_mode_triggered =
-        safety_mode_triggered || system_status_.has_safety_mode_trigger_time();
   }
 
   if (safety_mode_triggered) {
@@ -89,8 +108,10 @@ bool GuardianComponent::Proc() {
 }
 
 void GuardianComponent::PassThroughControlCommand() {
-  std::lock_guard<std::mutex> lock(mutex_);
-  guardian_cmd_.mutable_control_command()->CopyFrom(control_cmd_);
+  const auto control_cmd = std::atomic_load(&latest_control_cmd_);
+  if (control_cmd != nullptr) {
+    guardian_cmd_.mutable_control_command()->CopyFrom(*control_cmd);
+  }
 }
 
 void GuardianComponent::TriggerSafetyMode() {
@@ -20,6 +20,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <memory>
 
 #include "cyber/common/macros.h"
@@ -28,6 +29,7 @@
 
 #include "modules/canbus/proto/chassis.pb.h"
 #include "modules/control/proto/control_cmd.pb.h"
+#include "modules/guardian/latched_command_buffer.h"
 #include "modules/guardian/proto/guardian.pb.h"
 #include "modules/guardian/proto/guardian_conf.pb.h"
 #include "modules/monitor/proto/system_status.pb.h"
@@ -39,6 +41,16 @@
 namespace apollo {
 namespace guardian {
 
+// Fixed-size snapshot of the control command fields watched on the
+// safety path, latched lock-free between the control callback and Proc.
+struct ControlCommandSnapshot {
+  double timestamp_sec = 0.0;
+  double throttle = 0.0;
+  double brake = 0.0;
+  double steering_target = 0.0;
+  double steering_rate = 0.0;
+};
+
 class GuardianComponent : public apollo::cyber::TimerComponent {
  public:
   bool Init() override;
@@ -51,9 +63,16 @@ class GuardianComponent : public apollo::cyber::TimerComponent {
   apollo::guardian::GuardianConf guardian_conf_;
   apollo::canbus::Chassis chassis_;
   apollo::monitor::SystemStatus system_status_;
-  apollo::control::ControlCommand control_cmd_;
   apollo::guardian::GuardianCommand guardian_cmd_;
 
+  // The latest full control command, swapped in atomically by the
+  // control callback and copied out only on the pass-through path.
+  std::shared_ptr<apollo::control::ControlCommand> latest_control_cmd_;
+
+  // Lock-free latch of the safety-relevant control fields, so the
+  // braking path never contends on the module mutex.
+  LatchedCommandBuffer<ControlCommandSnapshot> control_latch_;
+
   double last_status_received_s_{};
 
   std::shared_ptr<apollo::cyber::Reader<apollo::canbus::Chassis>>
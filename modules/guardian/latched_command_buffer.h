@@ -0,0 +1,103 @@
+/******************************************************************************
+ * Copyright 2020 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+/**
+ * @file
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <type_traits>
+
+/**
+ * @namespace apollo::guardian
+ * @brief apollo::guardian
+ */
+namespace apollo {
+namespace guardian {
+
+/**
+ * @class LatchedCommandBuffer
+ * @brief A wait-free latched double buffer for one writer and any number
+ * of readers. The writer publishes a fixed-size command into the back
+ * slot under a seqlock and then flips the latest-slot index, so readers
+ * on the safety path never block on the writer and always see the most
+ * recently completed command.
+ */
+template <typename Command>
+class LatchedCommandBuffer {
+ public:
+  static_assert(std::is_trivially_copyable<Command>::value,
+                "The latched command must be trivially copyable.");
+
+  /**
+   * @brief Latch a new command. Must be called from a single writer.
+   */
+  void Write(const Command& command) {
+    const uint32_t back = 1 - latest_.load(std::memory_order_relaxed);
+    Slot& slot = slots_[back];
+    // An odd sequence marks the slot as being written.
+    slot.sequence.store(slot.sequence.load(std::memory_order_relaxed) + 1,
+                        std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    slot.command = command;
+    std::atomic_thread_fence(std::memory_order_release);
+    slot.sequence.store(slot.sequence.load(std::memory_order_relaxed) + 1,
+                        std::memory_order_relaxed);
+    latest_.store(back, std::memory_order_release);
+  }
+
+  /**
+   * @brief Copy out the most recently latched command.
+   * @return False when nothing has been latched yet or the slot kept
+   * being rewritten under the reader.
+   */
+  bool Read(Command* command) const {
+    const Slot& slot = slots_[latest_.load(std::memory_order_acquire)];
+    for (int attempt = 0; attempt < kMaxReadAttempts; ++attempt) {
+      const uint32_t sequence_begin =
+          slot.sequence.load(std::memory_order_acquire);
+      if (sequence_begin == 0) {
+        return false;
+      }
+      if ((sequence_begin & 1) != 0) {
+        continue;
+      }
+      *command = slot.command;
+      std::atomic_thread_fence(std::memory_order_acquire);
+      if (slot.sequence.load(std::memory_order_relaxed) == sequence_begin) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+ private:
+  struct Slot {
+    std::atomic<uint32_t> sequence = {0};
+    Command command;
+  };
+
+  static constexpr int kMaxReadAttempts = 8;
+
+  Slot slots_[2];
+  std::atomic<uint32_t> latest_ = {0};
+};
+
+}  // namespace guardian
+}  // namespace apollo
@@ -16,6 +16,10 @@
 
 #include "modules/localization/msf/local_integ/localization_lidar.h"
 
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
 namespace apollo {
 namespace localization {
 namespace msf {
@@ -63,7 +67,9 @@ bool LocalizationLidar::Init(const std::string& map_path,
     return false;
   }
   map_node_pool_.Initial(&(map_.GetMapConfig()));
-  map_.InitMapNodeCaches(12, 24);
+  map_.InitMapNodeCaches(
+      static_cast<int>(map_.GetMapConfig().node_cache_l1_size_),
+      static_cast<int>(map_.GetMapConfig().node_cache_l2_size_));
   map_.AttachMapNodePool(&map_node_pool_);
 
   // init locator
@@ -304,29 +310,75 @@ void LocalizationLidar::ComposeMapNode(const Eigen::Vector3d& trans) {
   unsigned int coord_x = 0;
   unsigned int coord_y = 0;
   map_node[0][0]->GetCoordinate(left_top_corner, &coord_x, &coord_y);
+  const Eigen::Vector2d pre_left_top_corner = map_left_top_corner_;
   map_left_top_corner_ = map_node[0][0]->GetCoordinate(coord_x, coord_y);
 
   int coord_xi = coord_x;
   int coord_yi = coord_y;
+
+  // the map cells are immutable, so the mosaic composed for the previous
+  // frame stays valid wherever it overlaps the new one; shift the overlap in
+  // place and recompose only the newly exposed strips
+  if (is_composed_map_valid_) {
+    const int delta_x = static_cast<int>(std::lround(
+        (map_left_top_corner_(0) - pre_left_top_corner(0)) / resolution_));
+    const int delta_y = static_cast<int>(std::lround(
+        (map_left_top_corner_(1) - pre_left_top_corner(1)) / resolution_));
+    if (delta_x == 0 && delta_y == 0) {
+      return;
+    }
+    if (std::abs(delta_x) < node_size_x_ && std::abs(delta_y) < node_size_y_) {
+      ShiftComposedCells(delta_x, delta_y);
+      const int x0 = std::max(0, -delta_x);
+      const int x1 = std::min(node_size_x_, node_size_x_ - delta_x);
+      const int y0 = std::max(0, -delta_y);
+      const int y1 = std::min(node_size_y_, node_size_y_ - delta_y);
+      if (y0 > 0) {
+        ComposeMapCells(map_node, coord_xi, coord_yi, 0, 0, node_size_x_, y0);
+      }
+      if (y1 < node_size_y_) {
+        ComposeMapCells(map_node, coord_xi, coord_yi, 0, y1, node_size_x_,
+                        node_size_y_);
+      }
+      if (x0 > 0) {
+        ComposeMapCells(map_node, coord_xi, coord_yi, 0, y0, x0, y1);
+      }
+      if (x1 < node_size_x_) {
+        ComposeMapCells(map_node, coord_xi, coord_yi, x1, y0, node_size_x_,
+                        y1);
+      }
+      return;
+    }
+  }
+
+  ComposeMapCells(map_node, coord_xi, coord_yi, 0, 0, node_size_x_,
+                  node_size_y_);
+  is_composed_map_valid_ = true;
+}
+
+void LocalizationLidar::ComposeMapCells(PyramidMapNode* map_node[2][2],
+                                        const int coord_x, const int coord_y,
+                                        const int clip_x0, const int clip_y0,
+                                        const int clip_x1, const int clip_y1) {
   int range_xs[2][2] = {0};
   int range_ys[2][2] = {0};
-  range_xs[0][0] = node_size_x_ - coord_xi;
-  range_xs[1][0] = node_size_x_ - coord_xi;
-  range_xs[0][1] = coord_xi;
-  range_xs[1][1] = coord_xi;
-  range_ys[0][0] = node_size_y_ - coord_yi;
-  range_ys[0][1] = node_size_y_ - coord_yi;
-  range_ys[1][0] = coord_yi;
-  range_ys[1][1] = coord_yi;
+  range_xs[0][0] = node_size_x_ - coord_x;
+  range_xs[1][0] = node_size_x_ - coord_x;
+  range_xs[0][1] = coord_x;
+  range_xs[1][1] = coord_x;
+  range_ys[0][0] = node_size_y_ - coord_y;
+  range_ys[0][1] = node_size_y_ - coord_y;
+  range_ys[1][0] = coord_y;
+  range_ys[1][1] = coord_y;
 
   int src_xs[2][2] = {0};
   int src_ys[2][2] = {0};
-  src_xs[0][0] = coord_xi;
-  src_xs[1][0] = coord_xi;
+  src_xs[0][0] = coord_x;
+  src_xs[1][0] = coord_x;
   src_xs[0][1] = 0;
   src_xs[1][1] = 0;
-  src_ys[0][0] = coord_yi;
-  src_ys[0][1] = coord_yi;
+  src_ys[0][0] = coord_y;
+  src_ys[0][1] = coord_y;
   src_ys[1][0] = 0;
   src_ys[1][1] = 0;
 
@@ -334,45 +386,83 @@ void LocalizationLidar::ComposeMapNode(const Eigen::Vector3d& trans) {
   int dst_ys[2][2] = {0};
   dst_xs[0][0] = 0;
   dst_xs[1][0] = 0;
-  dst_xs[0][1] = node_size_x_ - coord_xi;
-  dst_xs[1][1] = node_size_x_ - coord_xi;
+  dst_xs[0][1] = node_size_x_ - coord_x;
+  dst_xs[1][1] = node_size_x_ - coord_x;
   dst_ys[0][0] = 0;
   dst_ys[0][1] = 0;
-  dst_ys[1][0] = node_size_y_ - coord_yi;
-  dst_ys[1][1] = node_size_y_ - coord_yi;
+  dst_ys[1][0] = node_size_y_ - coord_y;
+  dst_ys[1][1] = node_size_y_ - coord_y;
 
   for (int i = 0; i < 2; ++i) {
     for (int j = 0; j < 2; ++j) {
-      int range_x = range_xs[i][j];
-      int range_y = range_ys[i][j];
-      int src_x = src_xs[i][j];
-      int src_y = src_ys[i][j];
-      int dst_x = dst_xs[i][j];
-      int dst_y = dst_ys[i][j];
+      // clip this quadrant's destination rectangle
+      int dst_x0 = std::max(dst_xs[i][j], clip_x0);
+      int dst_x1 = std::min(dst_xs[i][j] + range_xs[i][j], clip_x1);
+      int dst_y0 = std::max(dst_ys[i][j], clip_y0);
+      int dst_y1 = std::min(dst_ys[i][j] + range_ys[i][j], clip_y1);
+      if (dst_x0 >= dst_x1 || dst_y0 >= dst_y1) {
+        continue;
+      }
+      int src_x = src_xs[i][j] + dst_x0 - dst_xs[i][j];
+      int src_y = src_ys[i][j] + dst_y0 - dst_ys[i][j];
       PyramidMapMatrix& map_cells =
           static_cast<PyramidMapMatrix&>(map_node[i][j]->GetMapCellMatrix());
       FloatMatrix* intensity_matrix = map_cells.GetIntensityMatrix(0);
       FloatMatrix* intensity_var_matrix = map_cells.GetIntensityVarMatrix(0);
       FloatMatrix* altitude_matrix = map_cells.GetAltitudeMatrix(0);
       UIntMatrix* count_matrix = map_cells.GetCountMatrix(0);
-      for (int y = 0; y < range_y; ++y) {
-        int dst_base_x = (dst_y + y) * node_size_x_ + dst_x;
-        for (int x = 0; x < range_x; ++x) {
-          int dst_idx = dst_base_x + x;
-          lidar_map_node_->intensities[dst_idx] =
-              (*intensity_matrix)[src_y + y][src_x + x];
-          lidar_map_node_->intensities_var[dst_idx] =
-              (*intensity_var_matrix)[src_y + y][src_x + x];
-          lidar_map_node_->altitudes[dst_idx] =
-              (*altitude_matrix)[src_y + y][src_x + x];
-          lidar_map_node_->count[dst_idx] =
-              (*count_matrix)[src_y + y][src_x + x];
-        }
+      // rows are contiguous in both the matrices and the composed planes, so
+      // each row moves as one memcpy
+      const size_t row_cells = static_cast<size_t>(dst_x1 - dst_x0);
+      for (int y = 0; y < dst_y1 - dst_y0; ++y) {
+        int dst_idx = (dst_y0 + y) * node_size_x_ + dst_x0;
+        memcpy(lidar_map_node_->intensities + dst_idx,
+               &(*intensity_matrix)[src_y + y][src_x],
+               row_cells * sizeof(float));
+        memcpy(lidar_map_node_->intensities_var + dst_idx,
+               &(*intensity_var_matrix)[src_y + y][src_x],
+               row_cells * sizeof(float));
+        memcpy(lidar_map_node_->altitudes + dst_idx,
+               &(*altitude_matrix)[src_y + y][src_x],
+               row_cells * sizeof(float));
+        memcpy(lidar_map_node_->count + dst_idx,
+               &(*count_matrix)[src_y + y][src_x],
+               row_cells * sizeof(unsigned int));
       }
     }
   }
 }
 
+void LocalizationLidar::ShiftComposedCells(const int delta_x,
+                                           const int delta_y) {
+  const int x0 = std::max(0, -delta_x);
+  const int x1 = std::min(node_size_x_, node_size_x_ - delta_x);
+  const int y0 = std::max(0, -delta_y);
+  const int y1 = std::min(node_size_y_, node_size_y_ - delta_y);
+  if (x0 >= x1 || y0 >= y1) {
+    return;
+  }
+  const size_t row_cells = static_cast<size_t>(x1 - x0);
+  // iterate toward the shift so source rows are read before being overwritten
+  const bool forward = delta_y >= 0;
+  for (int i = 0; i < y1 - y0; ++i) {
+    const int dst_y = forward ? y0 + i : y1 - 1 - i;
+    const int src_y = dst_y + delta_y;
+    const int dst_idx = dst_y * node_size_x_ + x0;
+    const int src_idx = src_y * node_size_x_ + x0 + delta_x;
+    memmove(lidar_map_node_->intensities + dst_idx,
+            lidar_map_node_->intensities + src_idx, row_cells * sizeof(float));
+    memmove(lidar_map_node_->intensities_var + dst_idx,
+            lidar_map_node_->intensities_var + src_idx,
+            row_cells * sizeof(float));
+    memmove(lidar_map_node_->altitudes + dst_idx,
+            lidar_map_node_->altitudes + src_idx, row_cells * sizeof(float));
+    memmove(lidar_map_node_->count + dst_idx,
+            lidar_map_node_->count + src_idx,
+            row_cells * sizeof(unsigned int));
+  }
+}
+
 }  // namespace msf
 }  // namespace localization
 }  // namespace apollo
@@ -118,6 +118,16 @@ class LocalizationLidar {
  protected:
   void ComposeMapNode(const Eigen::Vector3d& trans);
 
+  /**@brief Copy the clipped destination rectangle of the composed map from
+   * the 2x2 source map nodes, row by row. */
+  void ComposeMapCells(PyramidMapNode* map_node[2][2], const int coord_x,
+                       const int coord_y, const int clip_x0, const int clip_y0,
+                       const int clip_x1, const int clip_y1);
+
+  /**@brief Shift the retained composed map in place by the given cell
+   * deltas; cells shifted out of range are left for ComposeMapCells. */
+  void ShiftComposedCells(const int delta_x, const int delta_y);
+
   void RefineAltitudeFromMap(Eigen::Affine3d* pose);
 
  protected:
@@ -133,6 +143,7 @@ class LocalizationLidar {
   PyramidMap map_;
   PyramidMapNodePool map_node_pool_;
   Eigen::Vector2d map_left_top_corner_;
+  bool is_composed_map_valid_ = false;
   unsigned int resolution_id_ = 0;
   int zone_id_ = 50;
   bool is_map_loaded_ = false;
@@ -16,6 +16,7 @@
 
 #include "modules/localization/msf/local_pyramid_map/base_map/base_map.h"
 
+#include <algorithm>
 #include <set>
 #include <string>
 
@@ -341,44 +342,63 @@ void BaseMap::PreloadMapArea(const Eigen::Vector3d& location,
   map_id = MapNodeIndex::GetMapNodeIndex(*map_config_, pt_bottom_right,
                                          resolution_id, zone_id);
   map_ids.insert(map_id);
-  for (int i = -1; i < 2; ++i) {
-    Eigen::Vector3d pt;
-    pt[0] = location[0] + x_direction * 1.5 *
-                              this->map_config_->map_node_size_x_ *
-                              map_pixel_resolution;
-    pt[1] = location[1] + static_cast<double>(i) *
-                              this->map_config_->map_node_size_y_ *
-                              map_pixel_resolution;
-    pt[2] = 0;
-    map_id =
-        MapNodeIndex::GetMapNodeIndex(*map_config_, pt, resolution_id, zone_id);
-    map_ids.insert(map_id);
+  // Extrapolate the recent motion to decide how many node boundaries ahead
+  // to prefetch, so at speed the loading tasks are already issued when the
+  // vehicle arrives. The horizon is capped so the preload set still fits the
+  // default L2 cache capacity.
+  static constexpr double kPreloadCyclesAhead = 100.0;
+  static constexpr int kMaxLookAheadSteps = 2;
+  const double node_span =
+      std::min(this->map_config_->map_node_size_x_ * map_pixel_resolution,
+               this->map_config_->map_node_size_y_ * map_pixel_resolution);
+  int look_ahead_steps = 1;
+  if (node_span > 0.0) {
+    const double trans_distance = trans_diff.head(2).norm();
+    look_ahead_steps += static_cast<int>(trans_distance * kPreloadCyclesAhead /
+                                         node_span);
+    look_ahead_steps = std::min(look_ahead_steps, kMaxLookAheadSteps);
   }
-  for (int i = -1; i < 2; ++i) {
-    Eigen::Vector3d pt;
-    pt[0] = location[0] + static_cast<double>(i) *
-                              this->map_config_->map_node_size_x_ *
-                              map_pixel_resolution;
-    pt[1] = location[1] + y_direction * 1.5 *
-                              this->map_config_->map_node_size_y_ *
-                              map_pixel_resolution;
-    pt[2] = 0;
-    map_id =
-        MapNodeIndex::GetMapNodeIndex(*map_config_, pt, resolution_id, zone_id);
-    map_ids.insert(map_id);
-  }
-  {
-    Eigen::Vector3d pt;
-    pt[0] = location[0] + x_direction * 1.5 *
-                              this->map_config_->map_node_size_x_ *
-                              map_pixel_resolution;
-    pt[1] = location[1] + y_direction * 1.5 *
-                              this->map_config_->map_node_size_y_ *
-                              map_pixel_resolution;
-    pt[2] = 0;
-    map_id =
-        MapNodeIndex::GetMapNodeIndex(*map_config_, pt, resolution_id, zone_id);
-    map_ids.insert(map_id);
+  for (int step = 1; step <= look_ahead_steps; ++step) {
+    const double ahead_factor = 0.5 + static_cast<double>(step);
+    for (int i = -1; i < 2; ++i) {
+      Eigen::Vector3d pt;
+      pt[0] = location[0] + x_direction * ahead_factor *
+                                this->map_config_->map_node_size_x_ *
+                                map_pixel_resolution;
+      pt[1] = location[1] + static_cast<double>(i) *
+                                this->map_config_->map_node_size_y_ *
+                                map_pixel_resolution;
+      pt[2] = 0;
+      map_id = MapNodeIndex::GetMapNodeIndex(*map_config_, pt, resolution_id,
+                                             zone_id);
+      map_ids.insert(map_id);
+    }
+    for (int i = -1; i < 2; ++i) {
+      Eigen::Vector3d pt;
+      pt[0] = location[0] + static_cast<double>(i) *
+                                this->map_config_->map_node_size_x_ *
+                                map_pixel_resolution;
+      pt[1] = location[1] + y_direction * ahead_factor *
+                                this->map_config_->map_node_size_y_ *
+                                map_pixel_resolution;
+      pt[2] = 0;
+      map_id = MapNodeIndex::GetMapNodeIndex(*map_config_, pt, resolution_id,
+                                             zone_id);
+      map_ids.insert(map_id);
+    }
+    {
+      Eigen::Vector3d pt;
+      pt[0] = location[0] + x_direction * ahead_factor *
+                                this->map_config_->map_node_size_x_ *
+                                map_pixel_resolution;
+      pt[1] = location[1] + y_direction * ahead_factor *
+                                this->map_config_->map_node_size_y_ *
+                                map_pixel_resolution;
+      pt[2] = 0;
+      map_id = MapNodeIndex::GetMapNodeIndex(*map_config_, pt, resolution_id,
+                                             zone_id);
+      map_ids.insert(map_id);
+    }
   }
 
   this->PreloadMapNodes(&map_ids);
@@ -75,6 +75,8 @@ bool BaseMapConfig::CreateXml(boost::property_tree::ptree *config) const {
   config->put("map.map_config.compression", map_is_compression_);
   config->put("map.map_runtime.map_ground_height_offset",
               map_ground_height_offset_);
+  config->put("map.map_runtime.node_cache.l1_size", node_cache_l1_size_);
+  config->put("map.map_runtime.node_cache.l2_size", node_cache_l2_size_);
   for (size_t i = 0; i < map_resolutions_.size(); ++i) {
     config->add("map.map_config.resolutions.resolution", map_resolutions_[i]);
   }
@@ -151,6 +153,16 @@ bool BaseMapConfig::LoadXml(const boost::property_tree::ptree &config) {
   if (map_is_compression) {
     map_is_compression_ = map_is_compression.get();
   }
+  auto node_cache_l1_size =
+      config.get_optional<unsigned int>("map.map_runtime.node_cache.l1_size");
+  if (node_cache_l1_size) {
+    node_cache_l1_size_ = node_cache_l1_size.get();
+  }
+  auto node_cache_l2_size =
+      config.get_optional<unsigned int>("map.map_runtime.node_cache.l2_size");
+  if (node_cache_l2_size) {
+    node_cache_l2_size_ = node_cache_l2_size.get();
+  }
 
   auto resolutions = config.get_child_optional("map.map_config.resolutions");
   if (resolutions) {
@@ -90,6 +90,12 @@ class BaseMapConfig {
   /**@brief Enable the compression. */
   bool map_is_compression_ = false;
 
+  /**@brief The capacity of the L1 map node LRU cache. */
+  unsigned int node_cache_l1_size_ = 12;
+  /**@brief The capacity of the L2 map node LRU cache. Larger values allow a
+   * deeper preload horizon at the cost of memory. */
+  unsigned int node_cache_l2_size_ = 24;
+
   /**@brief The map folder path. */
   std::string map_folder_path_ = "";
   /**@brief The datasets that contributed to the map. */
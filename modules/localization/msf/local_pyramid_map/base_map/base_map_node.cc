@@ -16,6 +16,11 @@
 
 #include "modules/localization/msf/local_pyramid_map/base_map/base_map_node.h"
 
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
 #include <cstdio>
 #include <memory>
 #include <string>
@@ -161,17 +166,43 @@ bool BaseMapNode::Load() {
 bool BaseMapNode::Load(const char* filename) {
   data_is_ready_ = false;
 
-  FILE* file = fopen(filename, "rb");
-  if (file) {
+  // Map the node file instead of streaming it, so the header and body are
+  // parsed straight out of the page cache and the kernel can fault the file
+  // in ahead of the parser.
+  int fd = open(filename, O_RDONLY);
+  if (fd < 0) {
+    AERROR << "Can't find the file: " << filename;
+    return false;
+  }
+  struct stat file_stat;
+  if (fstat(fd, &file_stat) < 0 || file_stat.st_size <= 0) {
+    AERROR << "Can't stat the file: " << filename;
+    close(fd);
+    return false;
+  }
+  const size_t file_size = static_cast<size_t>(file_stat.st_size);
+  void* mapped = mmap(nullptr, file_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (mapped == MAP_FAILED) {
+    // Fall back to buffered reads, e.g. on file systems without mmap.
+    FILE* file = fopen(filename, "rb");
+    if (file == nullptr) {
+      AERROR << "Can't find the file: " << filename;
+      return false;
+    }
     bool success = LoadBinary(file);
     fclose(file);
     is_changed_ = false;
     data_is_ready_ = success;
     return success;
-  } else {
-    AERROR << "Can't find the file: " << filename;
-    return false;
   }
+  madvise(mapped, file_size, MADV_WILLNEED);
+  bool success =
+      LoadBinary(static_cast<const unsigned char*>(mapped), file_size);
+  munmap(mapped, file_size);
+  is_changed_ = false;
+  data_is_ready_ = success;
+  return success;
 }
 
 bool BaseMapNode::LoadBinary(FILE* file) {
@@ -199,6 +230,29 @@ bool BaseMapNode::LoadBinary(FILE* file) {
   return true;
 }
 
+bool BaseMapNode::LoadBinary(const unsigned char* buf, size_t buf_size) {
+  // Load the header
+  size_t header_size = GetHeaderBinarySize();
+  if (buf_size < header_size) {
+    return false;
+  }
+  size_t processed_size = LoadHeaderBinary(buf);
+  if (processed_size != header_size) {
+    return false;
+  }
+  // Load the body
+  if (buf_size < header_size + file_body_binary_size_) {
+    return false;
+  }
+  std::vector<unsigned char> body_buf(
+      buf + header_size, buf + header_size + file_body_binary_size_);
+  processed_size = LoadBodyBinary(&body_buf);
+  if (processed_size != uncompressed_file_body_size_) {
+    return false;
+  }
+  return true;
+}
+
 bool BaseMapNode::CreateBinary(FILE* file) const {
   size_t buf_size = GetBinarySize();
   std::vector<unsigned char> buffer;
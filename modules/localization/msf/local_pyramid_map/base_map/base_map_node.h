@@ -150,6 +150,8 @@ class BaseMapNode {
   /**@brief Load the map cell from a binary chunk.
    */
   virtual bool LoadBinary(FILE* file);
+  /**@brief Load the map node from a memory-mapped binary chunk. */
+  virtual bool LoadBinary(const unsigned char* buf, size_t buf_size);
   /**@brief Create the binary. Serialization of the object.
    */
   virtual bool CreateBinary(FILE* file) const;
@@ -18,7 +18,9 @@
 
 #include "yaml-cpp/yaml.h"
 
+#include "cyber/base/wait_strategy.h"
 #include "cyber/common/file.h"
+#include "cyber/task/task.h"
 #include "modules/common/math/euler_angles_zxy.h"
 #include "modules/common/math/math_utils.h"
 #include "modules/common/math/quaternion.h"
@@ -38,10 +40,31 @@ MSFLocalization::MSFLocalization()
       localization_state_(msf::LocalizationMeasureState::OK),
       pcd_msg_index_(-1) {}
 
+MSFLocalization::~MSFLocalization() {
+  if (lidar_loop_running_.exchange(false)) {
+    lidar_msg_queue_.BreakAllWait();
+    lidar_process_loop_.wait();
+  }
+}
+
 Status MSFLocalization::Init() {
   InitParams();
 
-  return localization_integ_.Init(localization_param_);
+  auto state = localization_integ_.Init(localization_param_);
+  if (!state.ok()) {
+    return state;
+  }
+
+  // Two slots are enough for one frame in flight plus one pending; older
+  // frames are stale for registration anyway and get dropped.
+  if (!lidar_msg_queue_.Init(2, new cyber::base::BlockWaitStrategy())) {
+    return Status(common::LOCALIZATION_ERROR,
+                  "Failed to init lidar message queue.");
+  }
+  lidar_loop_running_.store(true);
+  lidar_process_loop_ = cyber::Async(&MSFLocalization::LidarProcessLoop, this);
+
+  return Status::OK();
 }
 
 void MSFLocalization::InitParams() {
@@ -192,6 +215,29 @@ void MSFLocalization::OnPointCloud(
     return;
   }
 
+  // Hand the frame over to the registration loop; the reader callback must
+  // return immediately so the scheduler can keep serving the imu and gnss
+  // callbacks during a long lidar match.
+  if (!lidar_msg_queue_.Enqueue(message)) {
+    AWARN << "Lidar registration is behind, dropping point cloud with "
+          << "timestamp: " << message->header().timestamp_sec();
+  }
+}
+
+void MSFLocalization::LidarProcessLoop() {
+  AINFO << "Started lidar registration loop";
+  while (lidar_loop_running_.load()) {
+    std::shared_ptr<drivers::PointCloud> message = nullptr;
+    if (!lidar_msg_queue_.WaitDequeue(&message)) {
+      continue;
+    }
+    LidarProcess(message);
+  }
+  AINFO << "Exited lidar registration loop";
+}
+
+void MSFLocalization::LidarProcess(
+    const std::shared_ptr<drivers::PointCloud> &message) {
   localization_integ_.PcdProcess(*message);
 
   const auto &result = localization_integ_.GetLastestLidarLocalization();
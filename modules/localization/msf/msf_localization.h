@@ -21,6 +21,8 @@
 
 #pragma once
 
+#include <atomic>
+#include <future>
 #include <memory>
 #include <string>
 
@@ -35,6 +37,7 @@
 #include "modules/drivers/proto/pointcloud.pb.h"
 #include "modules/localization/proto/localization.pb.h"
 
+#include "cyber/base/bounded_queue.h"
 #include "cyber/common/log.h"
 #include "modules/common/monitor_log/monitor_log_buffer.h"
 #include "modules/common/status/status.h"
@@ -60,6 +63,7 @@ class MSFLocalization {
 
  public:
   MSFLocalization();
+  ~MSFLocalization();
 
   apollo::common::Status Init();
   void InitParams();
@@ -86,6 +90,8 @@ class MSFLocalization {
                                double *quat_qw);
   bool LoadZoneIdFromFolder(const std::string &folder_path, int *zone_id);
   void CompensateImuVehicleExtrinsic(LocalizationEstimate *local_result);
+  void LidarProcess(const std::shared_ptr<drivers::PointCloud> &message);
+  void LidarProcessLoop();
 
  private:
   apollo::common::monitor::MonitorLogBuffer monitor_logger_;
@@ -100,6 +106,15 @@ class MSFLocalization {
   Eigen::Quaternion<double> imu_vehicle_quat_;
 
   std::shared_ptr<LocalizationMsgPublisher> publisher_;
+
+  // Single-producer single-consumer handoff from the lidar reader callback
+  // to the dedicated registration loop, so a slow lidar match never blocks
+  // the high rate imu path. Stale frames are dropped when the loop is
+  // behind.
+  cyber::base::BoundedQueue<std::shared_ptr<drivers::PointCloud>>
+      lidar_msg_queue_;
+  std::future<void> lidar_process_loop_;
+  std::atomic<bool> lidar_loop_running_ = {false};
 };
 
 }  // namespace localization
@@ -254,13 +254,29 @@ class NormalDistributionsTransform {
                             Eigen::Matrix<double, 6, 1> *p,
                             bool ComputeHessian = true);
 
+  /**@brief Evaluate one transformed point against its neighboring voxels and
+   * fold the score terms into the gradient and hessian. The Mahalanobis
+   * exponents of up to kScoreTermBatchSize neighbors are evaluated in a
+   * single vectorized pass. */
+  double UpdateNeighborhoodDerivatives(
+      Eigen::Matrix<double, 6, 1> *score_gradient,
+      Eigen::Matrix<double, 6, 6> *hessian, const Eigen::Vector3d &x_trans,
+      const std::vector<TargetGridLeafConstPtr> &neighborhood,
+      const Eigen::Matrix<double, 3, 6> &point_gradient,
+      const Eigen::Matrix<double, 18, 6> &point_hessian,
+      bool ComputeHessian = true) const;
+
   /**@brief Compute individual point contributions to derivatives of
-   * probability function w.r.t. the transformation vector. */
-  double UpdateDerivatives(Eigen::Matrix<double, 6, 1> *score_gradient,
-                           Eigen::Matrix<double, 6, 6> *hessian,
-                           const Eigen::Vector3d &x_trans,
-                           const Eigen::Matrix3d &c_inv,
-                           bool ComputeHessian = true);
+   * probability function w.r.t. the transformation vector. The factor
+   * e_x_cov_x is the precomputed d1 * d2 * exp term of Equation 6.12
+   * [Magnusson 2009]. */
+  void UpdateDerivatives(Eigen::Matrix<double, 6, 1> *score_gradient,
+                         Eigen::Matrix<double, 6, 6> *hessian,
+                         const Eigen::Vector3d &x_trans,
+                         const Eigen::Matrix3d &c_inv, double e_x_cov_x,
+                         const Eigen::Matrix<double, 3, 6> &point_gradient,
+                         const Eigen::Matrix<double, 18, 6> &point_hessian,
+                         bool ComputeHessian = true) const;
 
   /**@brief Precompute anglular components of derivatives. */
   void ComputeAngleDerivatives(const Eigen::Matrix<double, 6, 1> &p,
@@ -268,7 +284,9 @@ class NormalDistributionsTransform {
 
   /**@brief Compute point derivatives. */
   void ComputePointDerivatives(const Eigen::Vector3d &x,
-                               bool ComputeHessian = true);
+                               Eigen::Matrix<double, 3, 6> *point_gradient,
+                               Eigen::Matrix<double, 18, 6> *point_hessian,
+                               bool ComputeHessian = true) const;
 
   /**@brief Compute hessian of probability function w.r.t. the transformation
    * vector. */
@@ -280,7 +298,9 @@ class NormalDistributionsTransform {
    * function. */
   void UpdateHessian(Eigen::Matrix<double, 6, 6> *hessian,
                      const Eigen::Vector3d &x_trans,
-                     const Eigen::Matrix3d &c_inv);
+                     const Eigen::Matrix3d &c_inv,
+                     const Eigen::Matrix<double, 3, 6> &point_gradient,
+                     const Eigen::Matrix<double, 18, 6> &point_hessian) const;
 
   /**@brief Compute line search step length and update transform and probability
    * derivatives. */
@@ -363,12 +383,10 @@ class NormalDistributionsTransform {
   Eigen::Vector3d h_ang_a2_, h_ang_a3_, h_ang_b2_, h_ang_b3_, h_ang_c2_,
       h_ang_c3_, h_ang_d1_, h_ang_d2_, h_ang_d3_, h_ang_e1_, h_ang_e2_,
       h_ang_e3_, h_ang_f1_, h_ang_f2_, h_ang_f3_;
-  /**@brief The first order derivative of the transformation of a point
-   * w.r.t. the transform vector, Equation 6.18 [Magnusson 2009]. */
-  Eigen::Matrix<double, 3, 6> point_gradient_;
-  /**@brief The second order derivative of the transformation of a point
-   * w.r.t. the transform vector, Equation 6.20 [Magnusson 2009]. */
-  Eigen::Matrix<double, 18, 6> point_hessian_;
+  /**@brief Number of point-to-voxel score terms whose Mahalanobis exponents
+   * are evaluated per batch. Eight doubles fill two AVX2 registers when
+   * Eigen's packet math is enabled. */
+  static constexpr int kScoreTermBatchSize = 8;
 
  public:
   EIGEN_MAKE_ALIGNED_OPERATOR_NEW
@@ -191,9 +191,7 @@ NormalDistributionsTransform<PointSource,
       h_ang_e3_(),
       h_ang_f1_(),
       h_ang_f2_(),
-      h_ang_f3_(),
-      point_gradient_(),
-      point_hessian_() {
+      h_ang_f3_() {
   double gauss_c1, gauss_c2, gauss_d3;
 
   // Initializes the guassian fitting parameters (eq. 6.8) [Magnusson 2009]
@@ -234,11 +232,6 @@ void NormalDistributionsTransform<PointSource, PointTarget>::
     transformPointCloud(*output, *output, guess);
   }
 
-  // Initialize Point Gradient and Hessian
-  point_gradient_.setZero();
-  point_gradient_.block<3, 3>(0, 0).setIdentity();
-  point_hessian_.setZero();
-
   Eigen::Transform<float, 3, Eigen::Affine, Eigen::ColMajor> eig_transformation;
   eig_transformation.matrix() = final_transformation_;
 
@@ -324,15 +317,6 @@ NormalDistributionsTransform<PointSource, PointTarget>::ComputeDerivatives(
     Eigen::Matrix<double, 6, 1> *score_gradient,
     Eigen::Matrix<double, 6, 6> *hessian, PointCloudSourcePtr trans_cloud,
     Eigen::Matrix<double, 6, 1> *p, bool compute_hessian) {
-  // Original Point and Transformed Point
-  PointSource x_pt, x_trans_pt;
-  // Original Point and Transformed Point (for math)
-  Eigen::Vector3d x, x_trans;
-  // Occupied Voxel
-  TargetGridLeafConstPtr cell;
-  // Inverse Covariance of Occupied Voxel
-  Eigen::Matrix3d c_inv;
-
   score_gradient->setZero();
   hessian->setZero();
   double score = 0;
@@ -340,40 +324,61 @@ NormalDistributionsTransform<PointSource, PointTarget>::ComputeDerivatives(
   // Precompute Angular Derivatives (eq. 6.19 and 6.21)[Magnusson 2009]
   ComputeAngleDerivatives(*p);
 
+  const int num_points = static_cast<int>(input_->points.size());
+
   // Update gradient and hessian for each point, line 17 in Algorithm 2
-  // [Magnusson 2009]
-  for (size_t idx = 0; idx < input_->points.size(); idx++) {
-    x_trans_pt = trans_cloud->points[idx];
+  // [Magnusson 2009]. Points are distributed across threads and each thread
+  // folds its contributions into private partials which are reduced below.
+#pragma omp parallel num_threads(4) reduction(+ : score)
+  {
+    Eigen::Matrix<double, 6, 1> local_gradient;
+    Eigen::Matrix<double, 6, 6> local_hessian;
+    local_gradient.setZero();
+    local_hessian.setZero();
+    // The first and second order derivatives of the transformation of a
+    // point w.r.t. the transform vector, Equations 6.18 and 6.20
+    // [Magnusson 2009]
+    Eigen::Matrix<double, 3, 6> point_gradient;
+    Eigen::Matrix<double, 18, 6> point_hessian;
+    point_gradient.setZero();
+    point_gradient.block<3, 3>(0, 0).setIdentity();
+    point_hessian.setZero();
 
-    // Find neighbors (Radius search has been experimentally faster than
-    // direct neighbor checking.
     std::vector<TargetGridLeafConstPtr> neighborhood;
     std::vector<float> distances;
-    target_cells_.RadiusSearch(x_trans_pt, resolution_, &neighborhood,
-                               &distances);
 
-    for (typename std::vector<TargetGridLeafConstPtr>::iterator
-             neighborhood_it = neighborhood.begin();
-         neighborhood_it != neighborhood.end(); neighborhood_it++) {
-      cell = *neighborhood_it;
-      x_pt = input_->points[idx];
-      x = Eigen::Vector3d(x_pt.x, x_pt.y, x_pt.z);
+#pragma omp for schedule(dynamic, 256)
+    for (int idx = 0; idx < num_points; idx++) {
+      const PointSource &x_trans_pt = trans_cloud->points[idx];
 
-      x_trans = Eigen::Vector3d(x_trans_pt.x, x_trans_pt.y, x_trans_pt.z);
+      // Find neighbors (Radius search has been experimentally faster than
+      // direct neighbor checking.
+      target_cells_.RadiusSearch(x_trans_pt, resolution_, &neighborhood,
+                                 &distances);
+      if (neighborhood.empty()) {
+        continue;
+      }
 
-      // Denorm point, x_k' in Equations 6.12 and 6.13 [Magnusson 2009]
-      x_trans -= cell->GetMean();
-      // Uses precomputed covariance for speed.
-      c_inv = cell->GetInverseCov();
+      const PointSource &x_pt = input_->points[idx];
+      const Eigen::Vector3d x(x_pt.x, x_pt.y, x_pt.z);
+      const Eigen::Vector3d x_trans(x_trans_pt.x, x_trans_pt.y, x_trans_pt.z);
 
       // Compute derivative of transform function w.r.t. transform vector,
       // J_E and H_E in Equations 6.18 and 6.20 [Magnusson 2009]
-      ComputePointDerivatives(x);
+      ComputePointDerivatives(x, &point_gradient, &point_hessian,
+                              compute_hessian);
       // Update score, gradient and hessian, lines 19-21 in Algorithm 2,
       // according to Equations 6.10, 6.12 and 6.13, respectively [Magnusson
       // 2009]
-      score += UpdateDerivatives(score_gradient, hessian, x_trans, c_inv,
-                                 compute_hessian);
+      score += UpdateNeighborhoodDerivatives(
+          &local_gradient, &local_hessian, x_trans, neighborhood,
+          point_gradient, point_hessian, compute_hessian);
+    }
+
+#pragma omp critical(ndt_derivative_reduction)
+    {
+      *score_gradient += local_gradient;
+      *hessian += local_hessian;
     }
   }
   return (score);
@@ -450,20 +455,22 @@ void NormalDistributionsTransform<PointSource, PointTarget>::
 }
 
 template <typename PointSource, typename PointTarget>
-void NormalDistributionsTransform<
-    PointSource, PointTarget>::ComputePointDerivatives(const Eigen::Vector3d &x,
-                                                       bool compute_hessian) {
+void NormalDistributionsTransform<PointSource, PointTarget>::
+    ComputePointDerivatives(const Eigen::Vector3d &x,
+                            Eigen::Matrix<double, 3, 6> *point_gradient,
+                            Eigen::Matrix<double, 18, 6> *point_hessian,
+                            bool compute_hessian) const {
   // Calculate first derivative of Transformation Equation 6.17 w.r.t. transform
   // vector p. Derivative w.r.t. ith element of transform vector corresponds to
   // column i, Equation 6.18 and 6.19 [Magnusson 2009]
-  point_gradient_(1, 3) = x.dot(j_ang_a_);
-  point_gradient_(2, 3) = x.dot(j_ang_b_);
-  point_gradient_(0, 4) = x.dot(j_ang_c_);
-  point_gradient_(1, 4) = x.dot(j_ang_d_);
-  point_gradient_(2, 4) = x.dot(j_ang_e_);
-  point_gradient_(0, 5) = x.dot(j_ang_f_);
-  point_gradient_(1, 5) = x.dot(j_ang_g_);
-  point_gradient_(2, 5) = x.dot(j_ang_h_);
+  (*point_gradient)(1, 3) = x.dot(j_ang_a_);
+  (*point_gradient)(2, 3) = x.dot(j_ang_b_);
+  (*point_gradient)(0, 4) = x.dot(j_ang_c_);
+  (*point_gradient)(1, 4) = x.dot(j_ang_d_);
+  (*point_gradient)(2, 4) = x.dot(j_ang_e_);
+  (*point_gradient)(0, 5) = x.dot(j_ang_f_);
+  (*point_gradient)(1, 5) = x.dot(j_ang_g_);
+  (*point_gradient)(2, 5) = x.dot(j_ang_h_);
 
   if (compute_hessian) {
     // Vectors from Equation 6.21 [Magnusson 2009]
@@ -480,46 +487,91 @@ void NormalDistributionsTransform<
     // transform vector p. Derivative w.r.t. ith and jth elements of transform
     // vector corresponds to the 3x1 block matrix starting at (3i,j),
     // Equation 6.20 and 6.21 [Magnusson 2009]
-    point_hessian_.block<3, 1>(9, 3) = a;
-    point_hessian_.block<3, 1>(12, 3) = b;
-    point_hessian_.block<3, 1>(15, 3) = c;
-    point_hessian_.block<3, 1>(9, 4) = b;
-    point_hessian_.block<3, 1>(12, 4) = d;
-    point_hessian_.block<3, 1>(15, 4) = e;
-    point_hessian_.block<3, 1>(9, 5) = c;
-    point_hessian_.block<3, 1>(12, 5) = e;
-    point_hessian_.block<3, 1>(15, 5) = f;
+    point_hessian->block<3, 1>(9, 3) = a;
+    point_hessian->block<3, 1>(12, 3) = b;
+    point_hessian->block<3, 1>(15, 3) = c;
+    point_hessian->block<3, 1>(9, 4) = b;
+    point_hessian->block<3, 1>(12, 4) = d;
+    point_hessian->block<3, 1>(15, 4) = e;
+    point_hessian->block<3, 1>(9, 5) = c;
+    point_hessian->block<3, 1>(12, 5) = e;
+    point_hessian->block<3, 1>(15, 5) = f;
   }
 }
 
 template <typename PointSource, typename PointTarget>
-double
-NormalDistributionsTransform<PointSource, PointTarget>::UpdateDerivatives(
-    Eigen::Matrix<double, 6, 1> *score_gradient,
-    Eigen::Matrix<double, 6, 6> *hessian, const Eigen::Vector3d &x_trans,
-    const Eigen::Matrix3d &c_inv, bool compute_hessian) {
-  Eigen::Vector3d cov_dxd_pi;
-  // e^(-d_2/2 * (x_k - mu_k)^T Sigma_k^-1 (x_k - mu_k)) Equation 6.9 [Magnusson
-  // 2009]
-  double e_x_cov_x = exp(-gauss_d2_ * x_trans.dot(c_inv * x_trans) / 2);
-  // Calculate probability of transtormed points existence, Equation 6.9
-  // [Magnusson 2009]
-  double score_inc = -gauss_d1_ * e_x_cov_x;
+double NormalDistributionsTransform<PointSource, PointTarget>::
+    UpdateNeighborhoodDerivatives(
+        Eigen::Matrix<double, 6, 1> *score_gradient,
+        Eigen::Matrix<double, 6, 6> *hessian, const Eigen::Vector3d &x_trans,
+        const std::vector<TargetGridLeafConstPtr> &neighborhood,
+        const Eigen::Matrix<double, 3, 6> &point_gradient,
+        const Eigen::Matrix<double, 18, 6> &point_hessian,
+        bool compute_hessian) const {
+  double score = 0;
+  Eigen::Matrix<double, 3, kScoreTermBatchSize> batch_x_trans;
+  Eigen::Array<double, kScoreTermBatchSize, 1> batch_mahalanobis;
+
+  const size_t num_neighbors = neighborhood.size();
+  for (size_t base = 0; base < num_neighbors; base += kScoreTermBatchSize) {
+    const int batch_size = static_cast<int>(std::min<size_t>(
+        static_cast<size_t>(kScoreTermBatchSize), num_neighbors - base));
+
+    // Denorm point, x_k' in Equations 6.12 and 6.13 [Magnusson 2009], and
+    // gather the Mahalanobis terms of the batch. Uses precomputed
+    // covariance for speed.
+    for (int i = 0; i < batch_size; i++) {
+      const TargetGridLeafConstPtr &cell = neighborhood[base + i];
+      const Eigen::Vector3d denormed = x_trans - cell->GetMean();
+      batch_x_trans.col(i) = denormed;
+      batch_mahalanobis(i) = denormed.dot(cell->GetInverseCov() * denormed);
+    }
+    for (int i = batch_size; i < kScoreTermBatchSize; i++) {
+      batch_mahalanobis(i) = 0;
+    }
 
-  e_x_cov_x = gauss_d2_ * e_x_cov_x;
+    // e^(-d_2/2 * (x_k - mu_k)^T Sigma_k^-1 (x_k - mu_k)) Equation 6.9
+    // [Magnusson 2009], evaluated for the whole batch in one vectorized pass.
+    const Eigen::Array<double, kScoreTermBatchSize, 1> batch_e_x_cov_x =
+        (-gauss_d2_ * batch_mahalanobis / 2).exp();
 
-  // Error checking for invalid values.
-  if (e_x_cov_x > 1 || e_x_cov_x < 0 || e_x_cov_x != e_x_cov_x) {
-    return 0;
+    for (int i = 0; i < batch_size; i++) {
+      double e_x_cov_x = gauss_d2_ * batch_e_x_cov_x(i);
+
+      // Error checking for invalid values.
+      if (e_x_cov_x > 1 || e_x_cov_x < 0 || e_x_cov_x != e_x_cov_x) {
+        continue;
+      }
+
+      // Calculate probability of transtormed points existence, Equation 6.9
+      // [Magnusson 2009]
+      score += -gauss_d1_ * batch_e_x_cov_x(i);
+
+      // Reusable portion of Equation 6.12 and 6.13 [Magnusson 2009]
+      e_x_cov_x *= gauss_d1_;
+
+      UpdateDerivatives(score_gradient, hessian, batch_x_trans.col(i),
+                        neighborhood[base + i]->GetInverseCov(), e_x_cov_x,
+                        point_gradient, point_hessian, compute_hessian);
+    }
   }
+  return score;
+}
 
-  // Reusable portion of Equation 6.12 and 6.13 [Magnusson 2009]
-  e_x_cov_x *= gauss_d1_;
+template <typename PointSource, typename PointTarget>
+void NormalDistributionsTransform<PointSource, PointTarget>::UpdateDerivatives(
+    Eigen::Matrix<double, 6, 1> *score_gradient,
+    Eigen::Matrix<double, 6, 6> *hessian, const Eigen::Vector3d &x_trans,
+    const Eigen::Matrix3d &c_inv, double e_x_cov_x,
+    const Eigen::Matrix<double, 3, 6> &point_gradient,
+    const Eigen::Matrix<double, 18, 6> &point_hessian,
+    bool compute_hessian) const {
+  Eigen::Vector3d cov_dxd_pi;
 
   for (int i = 0; i < 6; i++) {
     // Sigma_k^-1 d(T(x,p))/dpi, Reusable portion of Equation 6.12 and 6.13
     // [Magnusson 2009]
-    cov_dxd_pi = c_inv * point_gradient_.col(i);
+    cov_dxd_pi = c_inv * point_gradient.col(i);
 
     // Update gradient, Equation 6.12 [Magnusson 2009]
     (*score_gradient)(i) += x_trans.dot(cov_dxd_pi) * e_x_cov_x;
@@ -530,77 +582,86 @@ NormalDistributionsTransform<PointSource, PointTarget>::UpdateDerivatives(
         (*hessian)(i, j) +=
             e_x_cov_x *
             (-gauss_d2_ * x_trans.dot(cov_dxd_pi) *
-                 x_trans.dot(c_inv * point_gradient_.col(j)) +
-             x_trans.dot(c_inv * point_hessian_.block<3, 1>(3 * i, j)) +
-             point_gradient_.col(j).dot(cov_dxd_pi));
+                 x_trans.dot(c_inv * point_gradient.col(j)) +
+             x_trans.dot(c_inv * point_hessian.block<3, 1>(3 * i, j)) +
+             point_gradient.col(j).dot(cov_dxd_pi));
       }
     }
   }
-
-  return score_inc;
 }
 
 template <typename PointSource, typename PointTarget>
 void NormalDistributionsTransform<PointSource, PointTarget>::ComputeHessian(
     Eigen::Matrix<double, 6, 6> *hessian, const PointCloudSource &trans_cloud,
     Eigen::Matrix<double, 6, 1> *p) {
-  // Original Point and Transformed Point
-  PointSource x_pt, x_trans_pt;
-  // Original Point and Transformed Point (for math)
-  Eigen::Vector3d x, x_trans;
-  // Occupied Voxel
-  TargetGridLeafConstPtr cell;
-  // Inverse Covariance of Occupied Voxel
-  Eigen::Matrix3d c_inv;
-
   hessian->setZero();
 
+  const int num_points = static_cast<int>(input_->points.size());
+
   // Precompute Angular Derivatives unnecessary because only used after regular
   // derivative calculation
 
-  // Update hessian for each point, line 17 in Algorithm 2 [Magnusson 2009]
-  for (size_t idx = 0; idx < input_->points.size(); idx++) {
-    x_trans_pt = trans_cloud.points[idx];
+  // Update hessian for each point, line 17 in Algorithm 2 [Magnusson 2009],
+  // with the same per-thread partials as ComputeDerivatives.
+#pragma omp parallel num_threads(4)
+  {
+    Eigen::Matrix<double, 6, 6> local_hessian;
+    local_hessian.setZero();
+    Eigen::Matrix<double, 3, 6> point_gradient;
+    Eigen::Matrix<double, 18, 6> point_hessian;
+    point_gradient.setZero();
+    point_gradient.block<3, 3>(0, 0).setIdentity();
+    point_hessian.setZero();
 
-    // Find neighbors (Radius search has been experimentally faster than
-    // direct neighbor checking.
     std::vector<TargetGridLeafConstPtr> neighborhood;
     std::vector<float> distances;
-    target_cells_.RadiusSearch(x_trans_pt, resolution_, &neighborhood,
-                               &distances);
 
-    for (typename std::vector<TargetGridLeafConstPtr>::iterator
-             neighborhood_it = neighborhood.begin();
-         neighborhood_it != neighborhood.end(); neighborhood_it++) {
-      cell = *neighborhood_it;
-      {
-        x_pt = input_->points[idx];
-        x = Eigen::Vector3d(x_pt.x, x_pt.y, x_pt.z);
+#pragma omp for schedule(dynamic, 256)
+    for (int idx = 0; idx < num_points; idx++) {
+      const PointSource &x_trans_pt = trans_cloud.points[idx];
+
+      // Find neighbors (Radius search has been experimentally faster than
+      // direct neighbor checking.
+      target_cells_.RadiusSearch(x_trans_pt, resolution_, &neighborhood,
+                                 &distances);
 
-        x_trans = Eigen::Vector3d(x_trans_pt.x, x_trans_pt.y, x_trans_pt.z);
+      for (typename std::vector<TargetGridLeafConstPtr>::iterator
+               neighborhood_it = neighborhood.begin();
+           neighborhood_it != neighborhood.end(); neighborhood_it++) {
+        const TargetGridLeafConstPtr &cell = *neighborhood_it;
+        const PointSource &x_pt = input_->points[idx];
+        const Eigen::Vector3d x(x_pt.x, x_pt.y, x_pt.z);
+
+        Eigen::Vector3d x_trans(x_trans_pt.x, x_trans_pt.y, x_trans_pt.z);
 
         // Denorm point, x_k' in Equations 6.12 and 6.13 [Magnusson
         // 2009]
         x_trans -= cell->GetMean();
         // Uses precomputed covariance for speed.
-        c_inv = cell->GetInverseCov();
+        const Eigen::Matrix3d c_inv = cell->GetInverseCov();
 
         // Compute derivative of transform function w.r.t. transform
         // vector, J_E and H_E in Equations 6.18 and 6.20 [Magnusson
         // 2009]
-        ComputePointDerivatives(x);
+        ComputePointDerivatives(x, &point_gradient, &point_hessian);
         // Update hessian, lines 21 in Algorithm 2, according to
         // Equations 6.10, 6.12 and 6.13, respectively [Magnusson 2009]
-        UpdateHessian(hessian, x_trans, c_inv);
+        UpdateHessian(&local_hessian, x_trans, c_inv, point_gradient,
+                      point_hessian);
       }
     }
+
+#pragma omp critical(ndt_hessian_reduction)
+    { *hessian += local_hessian; }
   }
 }
 
 template <typename PointSource, typename PointTarget>
 void NormalDistributionsTransform<PointSource, PointTarget>::UpdateHessian(
     Eigen::Matrix<double, 6, 6> *hessian, const Eigen::Vector3d &x_trans,
-    const Eigen::Matrix3d &c_inv) {
+    const Eigen::Matrix3d &c_inv,
+    const Eigen::Matrix<double, 3, 6> &point_gradient,
+    const Eigen::Matrix<double, 18, 6> &point_hessian) const {
   Eigen::Vector3d cov_dxd_pi;
   // e^(-d_2/2 * (x_k - mu_k)^T Sigma_k^-1 (x_k - mu_k)) Equation 6.9
   // [Magnusson 2009]
@@ -618,16 +679,16 @@ void NormalDistributionsTransform<PointSource, PointTarget>::UpdateHessian(
   for (int i = 0; i < 6; i++) {
     // Sigma_k^-1 d(T(x,p))/dpi, Reusable portion of Equation 6.12 and 6.13
     // [Magnusson 2009]
-    cov_dxd_pi = c_inv * point_gradient_.col(i);
+    cov_dxd_pi = c_inv * point_gradient.col(i);
 
     for (int j = 0; j < hessian->cols(); j++) {
       // Update hessian, Equation 6.13 [Magnusson 2009]
       (*hessian)(i, j) +=
           e_x_cov_x *
           (-gauss_d2_ * x_trans.dot(cov_dxd_pi) *
-               x_trans.dot(c_inv * point_gradient_.col(j)) +
-           x_trans.dot(c_inv * point_hessian_.block<3, 1>(3 * i, j)) +
-           point_gradient_.col(j).dot(cov_dxd_pi));
+               x_trans.dot(c_inv * point_gradient.col(j)) +
+           x_trans.dot(c_inv * point_hessian.block<3, 1>(3 * i, j)) +
+           point_gradient.col(j).dot(cov_dxd_pi));
     }
   }
 }
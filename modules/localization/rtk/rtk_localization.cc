@@ -31,10 +31,14 @@ using ::Eigen::Vector3d;
 RTKLocalization::RTKLocalization()
     : map_offset_{0.0, 0.0, 0.0},
       monitor_logger_(
-          apollo::common::monitor::MonitorMessageItem::LOCALIZATION) {}
+          apollo::common::monitor::MonitorMessageItem::LOCALIZATION) {
+  imu_ring_.SetCapacity(imu_list_max_size_);
+  gps_status_ring_.SetCapacity(gps_status_list_max_size_);
+}
 
 void RTKLocalization::InitConfig(const rtk_config::Config &config) {
   imu_list_max_size_ = config.imu_list_max_size();
+  imu_ring_.SetCapacity(imu_list_max_size_);
   gps_imu_time_diff_threshold_ = config.gps_imu_time_diff_threshold();
   map_offset_[0] = config.map_offset_x();
   map_offset_[1] = config.map_offset_y();
@@ -54,9 +58,9 @@ void RTKLocalization::GpsCallback(
   }
 
   {
-    std::unique_lock<std::mutex> lock(imu_list_mutex_);
+    std::unique_lock<std::mutex> lock(imu_ring_mutex_);
 
-    if (imu_list_.empty()) {
+    if (imu_ring_.Empty()) {
       AERROR << "IMU message buffer is empty.";
       if (service_started_) {
         monitor_logger_.ERROR("IMU message buffer is empty.");
@@ -66,9 +70,9 @@ void RTKLocalization::GpsCallback(
   }
 
   {
-    std::unique_lock<std::mutex> lock(gps_status_list_mutex_);
+    std::unique_lock<std::mutex> lock(gps_status_ring_mutex_);
 
-    if (gps_status_list_.empty()) {
+    if (gps_status_ring_.Empty()) {
       AERROR << "Gps status message buffer is empty.";
       if (service_started_) {
         monitor_logger_.ERROR("Gps status message buffer is empty.");
@@ -93,24 +97,14 @@ void RTKLocalization::GpsCallback(
 
 void RTKLocalization::GpsStatusCallback(
     const std::shared_ptr<drivers::gnss::InsStat> &status_msg) {
-  std::unique_lock<std::mutex> lock(gps_status_list_mutex_);
-  if (gps_status_list_.size() < gps_status_list_max_size_) {
-    gps_status_list_.push_back(*status_msg);
-  } else {
-    gps_status_list_.pop_front();
-    gps_status_list_.push_back(*status_msg);
-  }
+  std::unique_lock<std::mutex> lock(gps_status_ring_mutex_);
+  gps_status_ring_.Append(*status_msg, status_msg->header().timestamp_sec());
 }
 
 void RTKLocalization::ImuCallback(
     const std::shared_ptr<localization::CorrectedImu> &imu_msg) {
-  std::unique_lock<std::mutex> lock(imu_list_mutex_);
-  if (imu_list_.size() < imu_list_max_size_) {
-    imu_list_.push_back(*imu_msg);
-  } else {
-    imu_list_.pop_front();
-    imu_list_.push_back(*imu_msg);
-  }
+  std::unique_lock<std::mutex> lock(imu_ring_mutex_);
+  imu_ring_.Append(*imu_msg, imu_msg->header().timestamp_sec());
 }
 
 bool RTKLocalization::IsServiceStarted() { return service_started_; }
@@ -147,8 +141,8 @@ void RTKLocalization::RunWatchDog(double gps_timestamp) {
   }
 
   // check IMU time stamp against system time
-  std::unique_lock<std::mutex> lock(imu_list_mutex_);
-  auto imu_msg = imu_list_.back();
+  std::unique_lock<std::mutex> lock(imu_ring_mutex_);
+  auto imu_msg = imu_ring_.Back();
   lock.unlock();
   double imu_delay_sec =
       common::time::Clock::NowInSeconds() - imu_msg.header().timestamp_sec();
@@ -328,55 +322,45 @@ bool RTKLocalization::FindMatchingIMU(const double gps_timestamp_sec,
     return false;
   }
 
-  std::unique_lock<std::mutex> lock(imu_list_mutex_);
-  auto imu_list = imu_list_;
-  lock.unlock();
+  std::unique_lock<std::mutex> lock(imu_ring_mutex_);
 
-  if (imu_list.empty()) {
+  if (imu_ring_.Empty()) {
     AERROR << "Cannot find Matching IMU. "
            << "IMU message Queue is empty! GPS timestamp[" << gps_timestamp_sec
            << "]";
     return false;
   }
 
-  // scan imu buffer, find first imu message that is newer than the given
-  // timestamp
-  auto imu_it = imu_list.begin();
-  for (; imu_it != imu_list.end(); ++imu_it) {
-    if ((*imu_it).header().timestamp_sec() - gps_timestamp_sec >
-        std::numeric_limits<double>::min()) {
-      break;
-    }
-  }
+  // binary-search the ring for the first imu message that is newer than the
+  // given timestamp; only the bracketing pair is copied under the lock
+  const size_t upper = imu_ring_.UpperBound(gps_timestamp_sec);
 
-  if (imu_it != imu_list.end()) {  // found one
-    if (imu_it == imu_list.begin()) {
+  if (upper < imu_ring_.Size()) {  // found one
+    if (upper == 0) {
       AERROR << "IMU queue too short or request too old. "
-             << "Oldest timestamp[" << imu_list.front().header().timestamp_sec()
+             << "Oldest timestamp[" << imu_ring_.TimestampAt(0)
              << "], Newest timestamp["
-             << imu_list.back().header().timestamp_sec() << "], GPS timestamp["
-             << gps_timestamp_sec << "]";
-      *imu_msg = imu_list.front();  // the oldest imu
+             << imu_ring_.TimestampAt(imu_ring_.Size() - 1)
+             << "], GPS timestamp[" << gps_timestamp_sec << "]";
+      *imu_msg = imu_ring_.Front();  // the oldest imu
     } else {
       // here is the normal case
-      auto imu_it_1 = imu_it;
-      imu_it_1--;
-      if (!(*imu_it).has_header() || !(*imu_it_1).has_header()) {
-        AERROR << "imu1 and imu_it_1 must both have header.";
+      const CorrectedImu imu_before = imu_ring_.At(upper - 1);
+      const CorrectedImu imu_after = imu_ring_.At(upper);
+      lock.unlock();
+      if (!imu_after.has_header() || !imu_before.has_header()) {
+        AERROR << "imu_before and imu_after must both have header.";
         return false;
       }
-      if (!InterpolateIMU(*imu_it_1, *imu_it, gps_timestamp_sec, imu_msg)) {
+      if (!InterpolateIMU(imu_before, imu_after, gps_timestamp_sec, imu_msg)) {
         AERROR << "failed to interpolate IMU";
         return false;
       }
     }
   } else {
     // give the newest imu, without extrapolation
-    *imu_msg = imu_list.back();
-    if (imu_msg == nullptr) {
-      AERROR << "Fail to get latest observed imu_msg.";
-      return false;
-    }
+    *imu_msg = imu_ring_.Back();
+    lock.unlock();
 
     if (!imu_msg->has_header()) {
       AERROR << "imu_msg must have header.";
@@ -387,7 +371,7 @@ bool RTKLocalization::FindMatchingIMU(const double gps_timestamp_sec,
         gps_imu_time_diff_threshold_) {
       // 20ms threshold to report error
       AERROR << "Cannot find Matching IMU. IMU messages too old. "
-             << "Newest timestamp[" << imu_list.back().header().timestamp_sec()
+             << "Newest timestamp[" << imu_msg->header().timestamp_sec()
              << "], GPS timestamp[" << gps_timestamp_sec << "]";
     }
   }
@@ -471,30 +455,31 @@ bool RTKLocalization::FindNearestGpsStatus(const double gps_timestamp_sec,
                                            drivers::gnss::InsStat *status) {
   CHECK_NOTNULL(status);
 
-  std::unique_lock<std::mutex> lock(gps_status_list_mutex_);
-  auto gps_status_list = gps_status_list_;
-  lock.unlock();
+  std::unique_lock<std::mutex> lock(gps_status_ring_mutex_);
 
-  double timestamp_diff_sec = 1e8;
-  auto nearest_itr = gps_status_list.end();
-  for (auto itr = gps_status_list.begin(); itr != gps_status_list.end();
-       ++itr) {
-    double diff = std::abs(itr->header().timestamp_sec() - gps_timestamp_sec);
-    if (diff < timestamp_diff_sec) {
-      timestamp_diff_sec = diff;
-      nearest_itr = itr;
-    }
+  if (gps_status_ring_.Empty()) {
+    return false;
   }
 
-  if (nearest_itr == gps_status_list.end()) {
-    return false;
+  // the nearest entry is one of the two bracketing the timestamp
+  const size_t upper = gps_status_ring_.UpperBound(gps_timestamp_sec);
+  size_t nearest = (upper == 0) ? 0 : upper - 1;
+  double timestamp_diff_sec =
+      std::abs(gps_status_ring_.TimestampAt(nearest) - gps_timestamp_sec);
+  if (upper < gps_status_ring_.Size()) {
+    const double upper_diff =
+        std::abs(gps_status_ring_.TimestampAt(upper) - gps_timestamp_sec);
+    if (upper_diff < timestamp_diff_sec) {
+      timestamp_diff_sec = upper_diff;
+      nearest = upper;
+    }
   }
 
   if (timestamp_diff_sec > gps_status_time_diff_threshold_) {
     return false;
   }
 
-  *status = *nearest_itr;
+  *status = gps_status_ring_.At(nearest);
   return true;
 }
 
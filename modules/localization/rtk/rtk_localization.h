@@ -16,8 +16,8 @@
 
 #pragma once
 
-#include <list>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -33,6 +33,83 @@
 namespace apollo {
 namespace localization {
 
+/**
+ * @brief Fixed-capacity ring of timestamped messages. Appends overwrite the
+ * oldest entry once the ring is full, so steady-state writes never allocate.
+ * Timestamps are kept in a parallel ring so bracketing lookups binary-search
+ * plain doubles instead of walking message headers.
+ */
+template <class MessageT>
+class TimedMessageRing {
+ public:
+  void SetCapacity(const size_t capacity) {
+    capacity_ = capacity;
+    messages_.resize(capacity);
+    timestamps_.resize(capacity);
+    head_ = 0;
+    size_ = 0;
+  }
+
+  void Append(const MessageT &message, const double timestamp) {
+    if (size_ > 0 &&
+        timestamp < timestamps_[(head_ + size_ - 1) % capacity_]) {
+      // time went backwards (e.g. a bag replay restarted); restart the ring
+      // so lookups stay time-ordered
+      head_ = 0;
+      size_ = 0;
+    }
+    const size_t index = (head_ + size_) % capacity_;
+    if (size_ < capacity_) {
+      ++size_;
+    } else {
+      head_ = (head_ + 1) % capacity_;
+    }
+    messages_[index] = message;
+    timestamps_[index] = timestamp;
+  }
+
+  bool Empty() const { return size_ == 0; }
+
+  size_t Size() const { return size_; }
+
+  const MessageT &At(const size_t i) const {
+    return messages_[(head_ + i) % capacity_];
+  }
+
+  double TimestampAt(const size_t i) const {
+    return timestamps_[(head_ + i) % capacity_];
+  }
+
+  const MessageT &Front() const { return At(0); }
+
+  const MessageT &Back() const { return At(size_ - 1); }
+
+  /**
+   * @brief Index of the first entry with a timestamp greater than the given
+   * one; Size() if no such entry exists.
+   */
+  size_t UpperBound(const double timestamp) const {
+    size_t lo = 0;
+    size_t hi = size_;
+    while (lo < hi) {
+      const size_t mid = lo + (hi - lo) / 2;
+      if (TimestampAt(mid) > timestamp) {
+        hi = mid;
+      } else {
+        lo = mid + 1;
+      }
+    }
+    return lo;
+  }
+
+ private:
+  std::vector<MessageT> messages_;
+  std::vector<double> timestamps_;
+  size_t capacity_ = 0;
+  size_t head_ = 0;
+  size_t size_ = 0;
+};
+
 class RTKLocalization {
  public:
   RTKLocalization();
@@ -74,13 +151,13 @@ class RTKLocalization {
  private:
   std::string module_name_ = "localization";
 
-  std::list<localization::CorrectedImu> imu_list_;
+  TimedMessageRing<localization::CorrectedImu> imu_ring_;
   size_t imu_list_max_size_ = 50;
-  std::mutex imu_list_mutex_;
+  std::mutex imu_ring_mutex_;
 
-  std::list<drivers::gnss::InsStat> gps_status_list_;
+  TimedMessageRing<drivers::gnss::InsStat> gps_status_ring_;
   size_t gps_status_list_max_size_ = 10;
-  std::mutex gps_status_list_mutex_;
+  std::mutex gps_status_ring_mutex_;
 
   std::vector<double> map_offset_;
 
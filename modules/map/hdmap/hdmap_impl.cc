@@ -15,7 +15,14 @@ limitations under the License.
 
 #include "modules/map/hdmap/hdmap_impl.h"
 
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
 #include <algorithm>
+#include <cmath>
+#include <future>
 #include <limits>
 #include <mutex>
 #include <set>
@@ -45,6 +52,33 @@ constexpr double kLanesSearchRange = 10.0;
 // backward search distance in GetForwardNearestSignalsOnLane
 constexpr int kBackwardDistance = 4;
 
+// Parse a binary map by mapping the file instead of streaming it through an
+// ifstream. The parse reads straight out of the page cache, which both skips
+// one full copy of a multi-hundred-MB file and lets processes loading the
+// same map share the file pages physically. Returns false on any error so
+// the caller can fall back to the stream-based loader.
+bool ParseMapFromMappedFile(const std::string& map_filename, Map* map_proto) {
+  const int fd = open(map_filename.c_str(), O_RDONLY);
+  if (fd < 0) {
+    return false;
+  }
+  struct stat file_stat;
+  if (fstat(fd, &file_stat) != 0 || file_stat.st_size <= 0 ||
+      file_stat.st_size > std::numeric_limits<int>::max()) {
+    close(fd);
+    return false;
+  }
+  void* addr = mmap(nullptr, file_stat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (addr == MAP_FAILED) {
+    return false;
+  }
+  const bool ret =
+      map_proto->ParseFromArray(addr, static_cast<int>(file_stat.st_size));
+  munmap(addr, file_stat.st_size);
+  return ret;
+}
+
 }  // namespace
 
 int HDMapImpl::LoadMapFromFile(const std::string& map_filename) {
@@ -55,6 +89,11 @@ int HDMapImpl::LoadMapFromFile(const std::string& map_filename) {
     if (!adapter::OpendriveAdapter::LoadData(map_filename, &map_)) {
       return -1;
     }
+  } else if (absl::EndsWith(map_filename, ".bin")) {
+    if (!ParseMapFromMappedFile(map_filename, &map_) &&
+        !cyber::common::GetProtoFromFile(map_filename, &map_)) {
+      return -1;
+    }
   } else if (!cyber::common::GetProtoFromFile(map_filename, &map_)) {
     return -1;
   }
@@ -133,16 +172,33 @@ int HDMapImpl::LoadMapFromProto(const Map& map_proto) {
   for (const auto& stop_sign_ptr_pair : stop_sign_table_) {
     stop_sign_ptr_pair.second->PostProcess(*this);
   }
-  BuildLaneSegmentKDTree();
-  BuildJunctionPolygonKDTree();
-  BuildSignalSegmentKDTree();
-  BuildCrosswalkPolygonKDTree();
-  BuildStopSignSegmentKDTree();
-  BuildYieldSignSegmentKDTree();
-  BuildClearAreaPolygonKDTree();
-  BuildSpeedBumpSegmentKDTree();
-  BuildParkingSpacePolygonKDTree();
-  BuildPNCJunctionPolygonKDTree();
+  // Each builder fills only its own box vector and tree, so the per-type
+  // trees can be constructed concurrently. The lane segment tree dominates
+  // load time by an order of magnitude, hence it goes first.
+  std::vector<std::future<void>> kdtree_futures;
+  kdtree_futures.emplace_back(std::async(
+      std::launch::async, &HDMapImpl::BuildLaneSegmentKDTree, this));
+  kdtree_futures.emplace_back(std::async(
+      std::launch::async, &HDMapImpl::BuildJunctionPolygonKDTree, this));
+  kdtree_futures.emplace_back(std::async(
+      std::launch::async, &HDMapImpl::BuildSignalSegmentKDTree, this));
+  kdtree_futures.emplace_back(std::async(
+      std::launch::async, &HDMapImpl::BuildCrosswalkPolygonKDTree, this));
+  kdtree_futures.emplace_back(std::async(
+      std::launch::async, &HDMapImpl::BuildStopSignSegmentKDTree, this));
+  kdtree_futures.emplace_back(std::async(
+      std::launch::async, &HDMapImpl::BuildYieldSignSegmentKDTree, this));
+  kdtree_futures.emplace_back(std::async(
+      std::launch::async, &HDMapImpl::BuildClearAreaPolygonKDTree, this));
+  kdtree_futures.emplace_back(std::async(
+      std::launch::async, &HDMapImpl::BuildSpeedBumpSegmentKDTree, this));
+  kdtree_futures.emplace_back(std::async(
+      std::launch::async, &HDMapImpl::BuildParkingSpacePolygonKDTree, this));
+  kdtree_futures.emplace_back(std::async(
+      std::launch::async, &HDMapImpl::BuildPNCJunctionPolygonKDTree, this));
+  for (auto& future : kdtree_futures) {
+    future.get();
+  }
   return 0;
 }
 
@@ -1297,21 +1353,50 @@ void HDMapImpl::BuildPNCJunctionPolygonKDTree() {
 template <class KDTree>
 int HDMapImpl::SearchObjects(const Vec2d& center, const double radius,
                              const KDTree& kdtree,
-                             std::vector<std::string>* const results) {
-  static std::mutex mutex_search_object;
-  UNIQUE_LOCK_MULTITHREAD(mutex_search_object);
+                             std::vector<std::string>* const results) const {
   if (results == nullptr) {
     return -1;
   }
-  auto objects = kdtree.GetObjects(center, radius);
-  std::unordered_set<std::string> result_ids;
-  result_ids.reserve(objects.size());
-  for (const auto* object_ptr : objects) {
-    result_ids.insert(object_ptr->object()->id().id());
+  // Quantize the query onto a 0.1m grid; the kd-tree is searched from the
+  // cell center with the radius inflated by the quantization margin, so the
+  // cached result is a valid (marginally conservative) answer for every
+  // query landing in the same cell.
+  constexpr double kCacheGridSize = 0.1;
+  SpatialQueryKey key;
+  key.kdtree = &kdtree;
+  key.x = std::lround(center.x() / kCacheGridSize);
+  key.y = std::lround(center.y() / kCacheGridSize);
+  key.radius = std::lround(radius / kCacheGridSize);
+  auto& shard =
+      spatial_query_cache_[std::hash<SpatialQueryKey>()(key) %
+                           kSpatialQueryCacheShardNum];
+  {
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    if (shard.cache.GetCopy(key, results)) {
+      return 0;
+    }
+  }
+
+  const Vec2d quantized_center(static_cast<double>(key.x) * kCacheGridSize,
+                               static_cast<double>(key.y) * kCacheGridSize);
+  const double quantized_radius =
+      static_cast<double>(key.radius) * kCacheGridSize + 1.5 * kCacheGridSize;
+  std::vector<std::string> ids;
+  {
+    static std::mutex mutex_search_object;
+    UNIQUE_LOCK_MULTITHREAD(mutex_search_object);
+    auto objects = kdtree.GetObjects(quantized_center, quantized_radius);
+    std::unordered_set<std::string> result_ids;
+    result_ids.reserve(objects.size());
+    for (const auto* object_ptr : objects) {
+      result_ids.insert(object_ptr->object()->id().id());
+    }
+    ids.assign(result_ids.begin(), result_ids.end());
   }
 
-  results->reserve(result_ids.size());
-  results->assign(result_ids.begin(), result_ids.end());
+  *results = ids;
+  std::lock_guard<std::mutex> lock(shard.mutex);
+  shard.cache.Put(key, std::move(ids));
   return 0;
 }
 
@@ -1344,6 +1429,10 @@ void HDMapImpl::Clear() {
   parking_space_polygon_kdtree_.reset(nullptr);
   pnc_junction_polygon_boxes_.clear();
   pnc_junction_polygon_kdtree_.reset(nullptr);
+  for (auto& shard : spatial_query_cache_) {
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    shard.cache.Clear();
+  }
 }
 
 }  // namespace hdmap
@@ -15,13 +15,16 @@ limitations under the License.
 
 #pragma once
 
+#include <array>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <utility>
 #include <vector>
 
 #include "modules/common/math/aabox2d.h"
+#include "modules/common/util/lru_cache.h"
 #include "modules/common/math/aaboxkdtree2d.h"
 #include "modules/common/math/line_segment2d.h"
 #include "modules/common/math/polygon2d.h"
@@ -48,6 +51,43 @@ limitations under the License.
 namespace apollo {
 namespace hdmap {
 
+/**
+ * @brief Key of one cached spatial query: the queried kd-tree plus the query
+ *        center and radius quantized onto a small grid. All queries landing
+ *        in the same cell share one cached result.
+ */
+struct SpatialQueryKey {
+  const void* kdtree = nullptr;
+  int64_t x = 0;
+  int64_t y = 0;
+  int64_t radius = 0;
+
+  bool operator==(const SpatialQueryKey& other) const {
+    return kdtree == other.kdtree && x == other.x && y == other.y &&
+           radius == other.radius;
+  }
+};
+
+}  // namespace hdmap
+}  // namespace apollo
+
+namespace std {
+template <>
+struct hash<apollo::hdmap::SpatialQueryKey> {
+  size_t operator()(const apollo::hdmap::SpatialQueryKey& key) const {
+    size_t seed = hash<const void*>()(key.kdtree);
+    seed ^= hash<int64_t>()(key.x) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+    seed ^= hash<int64_t>()(key.y) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+    seed ^=
+        hash<int64_t>()(key.radius) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+    return seed;
+  }
+};
+}  // namespace std
+
+namespace apollo {
+namespace hdmap {
+
 /**
  * @class HDMapImpl
  *
@@ -388,13 +428,25 @@ class HDMapImpl {
   void BuildPNCJunctionPolygonKDTree();
 
   template <class KDTree>
-  static int SearchObjects(const apollo::common::math::Vec2d& center,
-                           const double radius, const KDTree& kdtree,
-                           std::vector<std::string>* const results);
+  int SearchObjects(const apollo::common::math::Vec2d& center,
+                    const double radius, const KDTree& kdtree,
+                    std::vector<std::string>* const results) const;
 
   void Clear();
 
  private:
+  static constexpr size_t kSpatialQueryCacheShardNum = 8;
+  static constexpr size_t kSpatialQueryCacheShardCapacity = 128;
+
+  // LRU-cached kd-tree query results, sharded by key hash so the hot 10 Hz
+  // queries from different modules rarely contend on the same mutex. Cleared
+  // on every map (re)load.
+  struct SpatialQueryCacheShard {
+    std::mutex mutex;
+    apollo::common::util::LRUCache<SpatialQueryKey, std::vector<std::string>>
+        cache{kSpatialQueryCacheShardCapacity};
+  };
+
   Map map_;
   LaneTable lane_table_;
   JunctionTable junction_table_;
@@ -438,6 +490,9 @@ class HDMapImpl {
 
   std::vector<PNCJunctionPolygonBox> pnc_junction_polygon_boxes_;
   std::unique_ptr<PNCJunctionPolygonKDTree> pnc_junction_polygon_kdtree_;
+
+  mutable std::array<SpatialQueryCacheShard, kSpatialQueryCacheShardNum>
+      spatial_query_cache_;
 };
 
 }  // namespace hdmap
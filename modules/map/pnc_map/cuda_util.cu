@@ -16,6 +16,8 @@
 
 #include "modules/map/pnc_map/cuda_util.h"
 
+#include <algorithm>
+
 #include "cyber/common/log.h"
 
 #include <cuda_runtime_api.h>
@@ -105,6 +107,394 @@ __global__ void DistanceSquare(double x, double y, CudaLineSegment2d* dev_seg,
   }
 }
 
+namespace {
+
+// Polygons larger than this are handled by the CPU fallback.
+constexpr std::size_t kMaxPolygonVertices = 256;
+// Footprints stage four corners per box.
+constexpr std::size_t kPointsPerFootprint = 4;
+
+__device__ double CrossProduct(double ax, double ay, double bx, double by,
+                               double cx, double cy) {
+  return (bx - ax) * (cy - ay) - (by - ay) * (cx - ax);
+}
+
+__device__ bool IsPointInPolygonDevice(const CudaPoint2d* polygon,
+                                       int32_t num_vertices, double x,
+                                       double y) {
+  // Ray casting along +x; boundary points may land on either side, which
+  // is acceptable for collision checks where the distance is 0 anyway.
+  bool is_inside = false;
+  for (int32_t i = 0, j = num_vertices - 1; i < num_vertices; j = i++) {
+    if ((polygon[i].y > y) != (polygon[j].y > y) &&
+        x < (polygon[j].x - polygon[i].x) * (y - polygon[i].y) /
+                    (polygon[j].y - polygon[i].y) +
+                polygon[i].x) {
+      is_inside = !is_inside;
+    }
+  }
+  return is_inside;
+}
+
+__device__ double PointSegmentDistanceSquare(double x, double y, double x1,
+                                             double y1, double x2, double y2) {
+  const double dx = x2 - x1;
+  const double dy = y2 - y1;
+  const double length_sqr = dx * dx + dy * dy;
+  const double dot = (x - x1) * dx + (y - y1) * dy;
+  if (length_sqr < 1e-20 || dot <= 0.0) {
+    return (x - x1) * (x - x1) + (y - y1) * (y - y1);
+  }
+  if (dot >= length_sqr) {
+    return (x - x2) * (x - x2) + (y - y2) * (y - y2);
+  }
+  const double prod = (x - x1) * dy - (y - y1) * dx;
+  return prod * prod / length_sqr;
+}
+
+// Whether point p, known to be (nearly) collinear with segment ab, lies
+// within the bounding box of ab.
+__device__ bool IsOnSegmentDevice(double px, double py, double ax, double ay,
+                                  double bx, double by) {
+  constexpr double kEpsilon = 1e-10;
+  return fmin(ax, bx) - kEpsilon <= px && px <= fmax(ax, bx) + kEpsilon &&
+         fmin(ay, by) - kEpsilon <= py && py <= fmax(ay, by) + kEpsilon;
+}
+
+__device__ bool SegmentsIntersectDevice(double ax, double ay, double bx,
+                                        double by, double cx, double cy,
+                                        double dx, double dy) {
+  constexpr double kEpsilon = 1e-10;
+  const double d1 = CrossProduct(cx, cy, dx, dy, ax, ay);
+  const double d2 = CrossProduct(cx, cy, dx, dy, bx, by);
+  const double d3 = CrossProduct(ax, ay, bx, by, cx, cy);
+  const double d4 = CrossProduct(ax, ay, bx, by, dx, dy);
+  if (((d1 > kEpsilon && d2 < -kEpsilon) ||
+       (d1 < -kEpsilon && d2 > kEpsilon)) &&
+      ((d3 > kEpsilon && d4 < -kEpsilon) ||
+       (d3 < -kEpsilon && d4 > kEpsilon))) {
+    return true;
+  }
+  // Collinear or touching cases.
+  if (fabs(d1) <= kEpsilon && IsOnSegmentDevice(ax, ay, cx, cy, dx, dy)) {
+    return true;
+  }
+  if (fabs(d2) <= kEpsilon && IsOnSegmentDevice(bx, by, cx, cy, dx, dy)) {
+    return true;
+  }
+  if (fabs(d3) <= kEpsilon && IsOnSegmentDevice(cx, cy, ax, ay, bx, by)) {
+    return true;
+  }
+  if (fabs(d4) <= kEpsilon && IsOnSegmentDevice(dx, dy, ax, ay, bx, by)) {
+    return true;
+  }
+  return false;
+}
+
+__global__ void PointPolygonDistanceKernel(const CudaPoint2d* polygon,
+                                           int32_t num_vertices,
+                                           const CudaPoint2d* points,
+                                           double* dist, int32_t size) {
+  const int32_t index = blockDim.x * blockIdx.x + threadIdx.x;
+  if (index >= size) {
+    return;
+  }
+  const double x = points[index].x;
+  const double y = points[index].y;
+  if (IsPointInPolygonDevice(polygon, num_vertices, x, y)) {
+    dist[index] = 0.0;
+    return;
+  }
+  double min_dist_sqr = 1e100;
+  for (int32_t i = 0, j = num_vertices - 1; i < num_vertices; j = i++) {
+    const double d = PointSegmentDistanceSquare(
+        x, y, polygon[j].x, polygon[j].y, polygon[i].x, polygon[i].y);
+    min_dist_sqr = fmin(min_dist_sqr, d);
+  }
+  dist[index] = sqrt(min_dist_sqr);
+}
+
+__global__ void SegmentPolygonOverlapKernel(const CudaPoint2d* polygon,
+                                            int32_t num_vertices,
+                                            const CudaPoint2d* endpoints,
+                                            unsigned char* flags,
+                                            int32_t size) {
+  const int32_t index = blockDim.x * blockIdx.x + threadIdx.x;
+  if (index >= size) {
+    return;
+  }
+  const CudaPoint2d a = endpoints[2 * index];
+  const CudaPoint2d b = endpoints[2 * index + 1];
+  if (IsPointInPolygonDevice(polygon, num_vertices, a.x, a.y) ||
+      IsPointInPolygonDevice(polygon, num_vertices, b.x, b.y)) {
+    flags[index] = 1;
+    return;
+  }
+  for (int32_t i = 0, j = num_vertices - 1; i < num_vertices; j = i++) {
+    if (SegmentsIntersectDevice(a.x, a.y, b.x, b.y, polygon[j].x, polygon[j].y,
+                                polygon[i].x, polygon[i].y)) {
+      flags[index] = 1;
+      return;
+    }
+  }
+  flags[index] = 0;
+}
+
+__global__ void FootprintPolygonOverlapKernel(const CudaPoint2d* polygon,
+                                              int32_t num_vertices,
+                                              const CudaPoint2d* corners,
+                                              unsigned char* flags,
+                                              int32_t size) {
+  const int32_t index = blockDim.x * blockIdx.x + threadIdx.x;
+  if (index >= size) {
+    return;
+  }
+  const CudaPoint2d* quad = corners + kPointsPerFootprint * index;
+  // Overlap iff a footprint corner is inside the polygon, a polygon vertex
+  // is inside the footprint, or any pair of edges intersects.
+  for (int32_t k = 0; k < static_cast<int32_t>(kPointsPerFootprint); ++k) {
+    if (IsPointInPolygonDevice(polygon, num_vertices, quad[k].x, quad[k].y)) {
+      flags[index] = 1;
+      return;
+    }
+  }
+  if (IsPointInPolygonDevice(quad, kPointsPerFootprint, polygon[0].x,
+                             polygon[0].y)) {
+    flags[index] = 1;
+    return;
+  }
+  for (int32_t k = 0; k < static_cast<int32_t>(kPointsPerFootprint); ++k) {
+    const CudaPoint2d a = quad[k];
+    const CudaPoint2d b = quad[(k + 1) % kPointsPerFootprint];
+    for (int32_t i = 0, j = num_vertices - 1; i < num_vertices; j = i++) {
+      if (SegmentsIntersectDevice(a.x, a.y, b.x, b.y, polygon[j].x,
+                                  polygon[j].y, polygon[i].x, polygon[i].y)) {
+        flags[index] = 1;
+        return;
+      }
+    }
+  }
+  flags[index] = 0;
+}
+
+}  // namespace
+
+CudaPolygonQuery::CudaPolygonQuery() {
+  // Allocation failures only disable the device path; queries then run on
+  // the CPU fallback.
+  device_ready_ =
+      cudaMallocHost(reinterpret_cast<void**>(&host_points_),
+                     sizeof(CudaPoint2d) * kPointsPerFootprint *
+                         kDeviceVecSize) == cudaSuccess &&
+      cudaMallocHost(reinterpret_cast<void**>(&host_dist_),
+                     sizeof(double) * kDeviceVecSize) == cudaSuccess &&
+      cudaMallocHost(reinterpret_cast<void**>(&host_flags_),
+                     sizeof(unsigned char) * kDeviceVecSize) == cudaSuccess &&
+      cudaMalloc(reinterpret_cast<void**>(&dev_polygon_),
+                 sizeof(CudaPoint2d) * kMaxPolygonVertices) == cudaSuccess &&
+      cudaMalloc(reinterpret_cast<void**>(&dev_points_),
+                 sizeof(CudaPoint2d) * kPointsPerFootprint *
+                     kDeviceVecSize) == cudaSuccess &&
+      cudaMalloc(reinterpret_cast<void**>(&dev_dist_),
+                 sizeof(double) * kDeviceVecSize) == cudaSuccess &&
+      cudaMalloc(reinterpret_cast<void**>(&dev_flags_),
+                 sizeof(unsigned char) * kDeviceVecSize) == cudaSuccess;
+  if (!device_ready_) {
+    AWARN << "Failed to allocate device buffers, "
+             "polygon queries will run on CPU.";
+  }
+}
+
+CudaPolygonQuery::~CudaPolygonQuery() {
+  cudaFreeHost(host_points_);
+  cudaFreeHost(host_dist_);
+  cudaFreeHost(host_flags_);
+  cudaFree(dev_polygon_);
+  cudaFree(dev_points_);
+  cudaFree(dev_dist_);
+  cudaFree(dev_flags_);
+}
+
+bool CudaPolygonQuery::UpdatePolygon(
+    const std::vector<apollo::common::math::Vec2d>& points) {
+  if (points.size() < 3) {
+    AERROR << "Polygon needs at least 3 points, got " << points.size();
+    return false;
+  }
+  polygon_points_ = points;
+  num_vertices_ = points.size();
+  polygon_uploaded_ = false;
+  return true;
+}
+
+bool CudaPolygonQuery::UploadPolygon() {
+  if (polygon_uploaded_) {
+    return true;
+  }
+  if (!device_ready_ || num_vertices_ > kMaxPolygonVertices) {
+    return false;
+  }
+  for (std::size_t i = 0; i < num_vertices_; ++i) {
+    host_points_[i].x = polygon_points_[i].x();
+    host_points_[i].y = polygon_points_[i].y();
+  }
+  if (cudaMemcpy(dev_polygon_, host_points_,
+                 sizeof(CudaPoint2d) * num_vertices_,
+                 cudaMemcpyHostToDevice) != cudaSuccess) {
+    AWARN << "Failed to upload polygon to device.";
+    return false;
+  }
+  polygon_uploaded_ = true;
+  return true;
+}
+
+bool CudaPolygonQuery::DistanceToPoints(
+    const std::vector<apollo::common::math::Vec2d>& points,
+    std::vector<double>* distances) {
+  if (polygon_points_.empty() || distances == nullptr) {
+    return false;
+  }
+  distances->resize(points.size());
+  if (UploadPolygon()) {
+    bool device_ok = true;
+    for (std::size_t offset = 0; offset < points.size() && device_ok;
+         offset += kDeviceVecSize) {
+      const std::size_t chunk =
+          std::min(kDeviceVecSize, points.size() - offset);
+      for (std::size_t i = 0; i < chunk; ++i) {
+        host_points_[i].x = points[offset + i].x();
+        host_points_[i].y = points[offset + i].y();
+      }
+      device_ok =
+          cudaMemcpy(dev_points_, host_points_, sizeof(CudaPoint2d) * chunk,
+                     cudaMemcpyHostToDevice) == cudaSuccess;
+      if (device_ok) {
+        PointPolygonDistanceKernel<<<(chunk + 511) / 512, 512>>>(
+            dev_polygon_, static_cast<int32_t>(num_vertices_), dev_points_,
+            dev_dist_, static_cast<int32_t>(chunk));
+        device_ok = cudaMemcpy(host_dist_, dev_dist_, sizeof(double) * chunk,
+                               cudaMemcpyDeviceToHost) == cudaSuccess;
+      }
+      if (device_ok) {
+        for (std::size_t i = 0; i < chunk; ++i) {
+          (*distances)[offset + i] = host_dist_[i];
+        }
+      }
+    }
+    if (device_ok) {
+      return true;
+    }
+    AWARN << "Device point-polygon distance failed, falling back to CPU.";
+  }
+  const apollo::common::math::Polygon2d polygon(polygon_points_);
+  for (std::size_t i = 0; i < points.size(); ++i) {
+    (*distances)[i] = polygon.DistanceTo(points[i]);
+  }
+  return true;
+}
+
+bool CudaPolygonQuery::SegmentsOverlap(
+    const std::vector<apollo::common::math::LineSegment2d>& segments,
+    std::vector<bool>* overlaps) {
+  if (polygon_points_.empty() || overlaps == nullptr) {
+    return false;
+  }
+  overlaps->resize(segments.size());
+  if (UploadPolygon()) {
+    bool device_ok = true;
+    const std::size_t chunk_capacity = kDeviceVecSize / 2;
+    for (std::size_t offset = 0; offset < segments.size() && device_ok;
+         offset += chunk_capacity) {
+      const std::size_t chunk =
+          std::min(chunk_capacity, segments.size() - offset);
+      for (std::size_t i = 0; i < chunk; ++i) {
+        const auto& segment = segments[offset + i];
+        host_points_[2 * i].x = segment.start().x();
+        host_points_[2 * i].y = segment.start().y();
+        host_points_[2 * i + 1].x = segment.end().x();
+        host_points_[2 * i + 1].y = segment.end().y();
+      }
+      device_ok =
+          cudaMemcpy(dev_points_, host_points_,
+                     sizeof(CudaPoint2d) * 2 * chunk,
+                     cudaMemcpyHostToDevice) == cudaSuccess;
+      if (device_ok) {
+        SegmentPolygonOverlapKernel<<<(chunk + 511) / 512, 512>>>(
+            dev_polygon_, static_cast<int32_t>(num_vertices_), dev_points_,
+            dev_flags_, static_cast<int32_t>(chunk));
+        device_ok =
+            cudaMemcpy(host_flags_, dev_flags_, sizeof(unsigned char) * chunk,
+                       cudaMemcpyDeviceToHost) == cudaSuccess;
+      }
+      if (device_ok) {
+        for (std::size_t i = 0; i < chunk; ++i) {
+          (*overlaps)[offset + i] = (host_flags_[i] != 0);
+        }
+      }
+    }
+    if (device_ok) {
+      return true;
+    }
+    AWARN << "Device segment-polygon overlap failed, falling back to CPU.";
+  }
+  const apollo::common::math::Polygon2d polygon(polygon_points_);
+  for (std::size_t i = 0; i < segments.size(); ++i) {
+    (*overlaps)[i] = polygon.HasOverlap(segments[i]);
+  }
+  return true;
+}
+
+bool CudaPolygonQuery::FootprintSweepOverlap(
+    const std::vector<apollo::common::math::Box2d>& footprints,
+    std::vector<bool>* overlaps) {
+  if (polygon_points_.empty() || overlaps == nullptr) {
+    return false;
+  }
+  overlaps->resize(footprints.size());
+  if (UploadPolygon()) {
+    bool device_ok = true;
+    for (std::size_t offset = 0; offset < footprints.size() && device_ok;
+         offset += kDeviceVecSize) {
+      const std::size_t chunk =
+          std::min(kDeviceVecSize, footprints.size() - offset);
+      std::vector<apollo::common::math::Vec2d> corners;
+      for (std::size_t i = 0; i < chunk; ++i) {
+        footprints[offset + i].GetAllCorners(&corners);
+        for (std::size_t k = 0; k < kPointsPerFootprint; ++k) {
+          host_points_[kPointsPerFootprint * i + k].x = corners[k].x();
+          host_points_[kPointsPerFootprint * i + k].y = corners[k].y();
+        }
+      }
+      device_ok = cudaMemcpy(dev_points_, host_points_,
+                             sizeof(CudaPoint2d) * kPointsPerFootprint * chunk,
+                             cudaMemcpyHostToDevice) == cudaSuccess;
+      if (device_ok) {
+        FootprintPolygonOverlapKernel<<<(chunk + 511) / 512, 512>>>(
+            dev_polygon_, static_cast<int32_t>(num_vertices_), dev_points_,
+            dev_flags_, static_cast<int32_t>(chunk));
+        device_ok =
+            cudaMemcpy(host_flags_, dev_flags_, sizeof(unsigned char) * chunk,
+                       cudaMemcpyDeviceToHost) == cudaSuccess;
+      }
+      if (device_ok) {
+        for (std::size_t i = 0; i < chunk; ++i) {
+          (*overlaps)[offset + i] = (host_flags_[i] != 0);
+        }
+      }
+    }
+    if (device_ok) {
+      return true;
+    }
+    AWARN << "Device footprint-polygon overlap failed, falling back to CPU.";
+  }
+  const apollo::common::math::Polygon2d polygon(polygon_points_);
+  for (std::size_t i = 0; i < footprints.size(); ++i) {
+    (*overlaps)[i] =
+        polygon.HasOverlap(apollo::common::math::Polygon2d(footprints[i]));
+  }
+  return true;
+}
+
 int CudaNearestSegment::FindNearestSegment(double x, double y) {
   DistanceSquare<<<(kDeviceVecSize + 511) / 512, 512>>>(x, y, dev_seg_,
                                                         dev_dist_, size_);
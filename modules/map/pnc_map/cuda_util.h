@@ -18,7 +18,9 @@
 
 #include <cublas_v2.h>
 
+#include "modules/common/math/box2d.h"
 #include "modules/common/math/line_segment2d.h"
+#include "modules/common/math/polygon2d.h"
 #include "modules/common/math/vec2d.h"
 
 namespace apollo {
@@ -31,6 +33,11 @@ struct CudaLineSegment2d {
   double y2;
 };
 
+struct CudaPoint2d {
+  double x;
+  double y;
+};
+
 class CudaNearestSegment {
  public:
   CudaNearestSegment();
@@ -50,5 +57,65 @@ class CudaNearestSegment {
   cublasHandle_t handle_;
 };
 
+/**
+ * @class CudaPolygonQuery
+ * @brief Batched geometry queries of many points, segments or swept box
+ *        footprints against one polygon. The polygon is uploaded once and
+ *        the batches are staged through pinned host memory. Every query
+ *        falls back to the CPU geometry in common::math when the device
+ *        is unavailable, so callers always get results.
+ */
+class CudaPolygonQuery {
+ public:
+  CudaPolygonQuery();
+
+  ~CudaPolygonQuery();
+
+  /**
+   * @brief Set the polygon the following queries run against.
+   */
+  bool UpdatePolygon(const std::vector<apollo::common::math::Vec2d>& points);
+
+  /**
+   * @brief Distance from every point to the polygon; 0.0 for points inside.
+   */
+  bool DistanceToPoints(const std::vector<apollo::common::math::Vec2d>& points,
+                        std::vector<double>* distances);
+
+  /**
+   * @brief Whether each segment overlaps the polygon.
+   */
+  bool SegmentsOverlap(
+      const std::vector<apollo::common::math::LineSegment2d>& segments,
+      std::vector<bool>* overlaps);
+
+  /**
+   * @brief Whether each box footprint of a swept vehicle path overlaps the
+   *        polygon.
+   */
+  bool FootprintSweepOverlap(
+      const std::vector<apollo::common::math::Box2d>& footprints,
+      std::vector<bool>* overlaps);
+
+ private:
+  bool UploadPolygon();
+
+  // Polygon kept on the host for the CPU fallback path.
+  std::vector<apollo::common::math::Vec2d> polygon_points_;
+  std::size_t num_vertices_ = 0;
+  bool device_ready_ = false;
+  bool polygon_uploaded_ = false;
+
+  // Pinned staging buffers.
+  CudaPoint2d* host_points_ = nullptr;
+  double* host_dist_ = nullptr;
+  unsigned char* host_flags_ = nullptr;
+
+  CudaPoint2d* dev_polygon_ = nullptr;
+  CudaPoint2d* dev_points_ = nullptr;
+  double* dev_dist_ = nullptr;
+  unsigned char* dev_flags_ = nullptr;
+};
+
 }  // namespace pnc_map
 }  // namespace apollo
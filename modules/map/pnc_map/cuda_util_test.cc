@@ -43,5 +43,39 @@ TEST(CudaUtil, CudaNearestSegment) {
   EXPECT_EQ(1, nearest_index);
 }
 
+TEST(CudaUtil, CudaPolygonQuery) {
+  using apollo::common::math::Box2d;
+
+  CudaPolygonQuery query;
+  std::vector<Vec2d> polygon = {{0, 0}, {4, 0}, {4, 4}, {0, 4}};
+  ASSERT_TRUE(query.UpdatePolygon(polygon));
+
+  std::vector<Vec2d> points = {{2, 2}, {6, 2}, {-3, 0}};
+  std::vector<double> distances;
+  ASSERT_TRUE(query.DistanceToPoints(points, &distances));
+  ASSERT_EQ(points.size(), distances.size());
+  EXPECT_NEAR(0.0, distances[0], 1e-6);
+  EXPECT_NEAR(2.0, distances[1], 1e-6);
+  EXPECT_NEAR(3.0, distances[2], 1e-6);
+
+  std::vector<LineSegment2d> segments;
+  segments.emplace_back(Vec2d(-1, 2), Vec2d(5, 2));
+  segments.emplace_back(Vec2d(5, 5), Vec2d(6, 6));
+  std::vector<bool> segment_overlaps;
+  ASSERT_TRUE(query.SegmentsOverlap(segments, &segment_overlaps));
+  ASSERT_EQ(segments.size(), segment_overlaps.size());
+  EXPECT_TRUE(segment_overlaps[0]);
+  EXPECT_FALSE(segment_overlaps[1]);
+
+  std::vector<Box2d> footprints;
+  footprints.emplace_back(Vec2d(2, 2), 0.0, 1.0, 1.0);
+  footprints.emplace_back(Vec2d(10, 10), 0.0, 1.0, 1.0);
+  std::vector<bool> footprint_overlaps;
+  ASSERT_TRUE(query.FootprintSweepOverlap(footprints, &footprint_overlaps));
+  ASSERT_EQ(footprints.size(), footprint_overlaps.size());
+  EXPECT_TRUE(footprint_overlaps[0]);
+  EXPECT_FALSE(footprint_overlaps[1]);
+}
+
 }  // namespace pnc_map
 }  // namespace apollo
@@ -20,6 +20,7 @@
 #include <limits>
 #include <unordered_map>
 
+#include "Eigen/Dense"
 #include "absl/strings/str_cat.h"
 #include "absl/strings/str_join.h"
 #include "modules/common/math/line_segment2d.h"
@@ -353,6 +354,23 @@ void Path::Init() {
   InitPointIndex();
   InitWidth();
   InitOverlaps();
+  InitProjectionKernel();
+}
+
+void Path::InitProjectionKernel() {
+  segment_start_x_.resize(num_segments_);
+  segment_start_y_.resize(num_segments_);
+  segment_unit_x_.resize(num_segments_);
+  segment_unit_y_.resize(num_segments_);
+  segment_length_.resize(num_segments_);
+  for (int i = 0; i < num_segments_; ++i) {
+    const auto& segment = segments_[i];
+    segment_start_x_[i] = segment.start().x();
+    segment_start_y_[i] = segment.start().y();
+    segment_unit_x_[i] = segment.unit_direction().x();
+    segment_unit_y_[i] = segment.unit_direction().y();
+    segment_length_[i] = segment.length();
+  }
 }
 
 void Path::InitPoints() {
@@ -610,6 +628,19 @@ MapPathPoint Path::GetSmoothPoint(double s) const {
   return GetSmoothPoint(GetIndexFromS(s));
 }
 
+void Path::GetSmoothPoints(const std::vector<double>& accumulate_s,
+                           std::vector<MapPathPoint>* const points) const {
+  CHECK_NOTNULL(points);
+  points->clear();
+  points->reserve(accumulate_s.size());
+  int hint_id = 0;
+  for (const double s : accumulate_s) {
+    const InterpolatedIndex index = GetIndexFromSWithHint(s, hint_id);
+    hint_id = index.id;
+    points->push_back(GetSmoothPoint(index));
+  }
+}
+
 double Path::GetSFromIndex(const InterpolatedIndex& index) const {
   if (index.id < 0) {
     return 0.0;
@@ -648,6 +679,28 @@ InterpolatedIndex Path::GetIndexFromS(double s) const {
   return {low, s - accumulated_s_[low]};
 }
 
+InterpolatedIndex Path::GetIndexFromSWithHint(double s, int hint_id) const {
+  if (s <= 0.0) {
+    return {0, 0.0};
+  }
+  CHECK_GT(num_points_, 0);
+  if (s >= length_) {
+    return {num_points_ - 1, 0.0};
+  }
+  // Only walk forward when the hint is behind the target and reasonably
+  // close; otherwise the binary search is cheaper.
+  const double kMaxHintWalkDistance = 10.0 * kSampleDistance;
+  if (hint_id < 0 || hint_id >= num_points_ || accumulated_s_[hint_id] > s ||
+      s - accumulated_s_[hint_id] > kMaxHintWalkDistance) {
+    return GetIndexFromS(s);
+  }
+  int low = hint_id;
+  while (low + 1 < num_points_ && accumulated_s_[low + 1] <= s) {
+    ++low;
+  }
+  return {low, s - accumulated_s_[low]};
+}
+
 InterpolatedIndex Path::GetLaneIndexFromS(double s) const {
   if (s <= 0.0) {
     return {0, 0.0};
@@ -829,6 +882,79 @@ bool Path::GetProjection(const Vec2d& point, double* accumulate_s,
   return true;
 }
 
+bool Path::GetProjections(const std::vector<Vec2d>& points,
+                          std::vector<double>* accumulate_s,
+                          std::vector<double>* laterals) const {
+  if (accumulate_s == nullptr || laterals == nullptr) {
+    return false;
+  }
+  if (segments_.empty()) {
+    return false;
+  }
+  const size_t num_queries = points.size();
+  accumulate_s->resize(num_queries);
+  laterals->resize(num_queries);
+  if (use_path_approximation_) {
+    for (size_t i = 0; i < num_queries; ++i) {
+      double distance = 0.0;
+      if (!approximation_.GetProjection(*this, points[i], &(*accumulate_s)[i],
+                                        &(*laterals)[i], &distance)) {
+        return false;
+      }
+    }
+    return true;
+  }
+  CHECK_GE(num_points_, 2);
+  const Eigen::Map<const Eigen::ArrayXd> start_x(segment_start_x_.data(),
+                                                 num_segments_);
+  const Eigen::Map<const Eigen::ArrayXd> start_y(segment_start_y_.data(),
+                                                 num_segments_);
+  const Eigen::Map<const Eigen::ArrayXd> unit_x(segment_unit_x_.data(),
+                                                num_segments_);
+  const Eigen::Map<const Eigen::ArrayXd> unit_y(segment_unit_y_.data(),
+                                                num_segments_);
+  const Eigen::Map<const Eigen::ArrayXd> length(segment_length_.data(),
+                                                num_segments_);
+  Eigen::ArrayXd rel_x(num_segments_);
+  Eigen::ArrayXd rel_y(num_segments_);
+  Eigen::ArrayXd proj(num_segments_);
+  Eigen::ArrayXd distance_sqr(num_segments_);
+  for (size_t i = 0; i < num_queries; ++i) {
+    rel_x = points[i].x() - start_x;
+    rel_y = points[i].y() - start_y;
+    proj = (rel_x * unit_x + rel_y * unit_y).min(length).max(0.0);
+    distance_sqr = (rel_x - proj * unit_x).square() +
+                   (rel_y - proj * unit_y).square();
+    Eigen::Index min_index = 0;
+    const double min_distance = std::sqrt(distance_sqr.minCoeff(&min_index));
+    const auto& nearest_seg = segments_[min_index];
+    const auto prod = nearest_seg.ProductOntoUnit(points[i]);
+    const auto projection = nearest_seg.ProjectOntoUnit(points[i]);
+    if (min_index == 0) {
+      (*accumulate_s)[i] = std::min(projection, nearest_seg.length());
+      if (projection < 0) {
+        (*laterals)[i] = prod;
+      } else {
+        (*laterals)[i] = (prod > 0.0 ? 1 : -1) * min_distance;
+      }
+    } else if (min_index == num_segments_ - 1) {
+      (*accumulate_s)[i] =
+          accumulated_s_[min_index] + std::max(0.0, projection);
+      if (projection > 0) {
+        (*laterals)[i] = prod;
+      } else {
+        (*laterals)[i] = (prod > 0.0 ? 1 : -1) * min_distance;
+      }
+    } else {
+      (*accumulate_s)[i] =
+          accumulated_s_[min_index] +
+          std::max(0.0, std::min(projection, nearest_seg.length()));
+      (*laterals)[i] = (prod > 0.0 ? 1 : -1) * min_distance;
+    }
+  }
+  return true;
+}
+
 bool Path::GetHeadingAlongPath(const Vec2d& point, double* heading) const {
   if (heading == nullptr) {
     return false;
@@ -236,6 +236,15 @@ class Path {
   MapPathPoint GetSmoothPoint(const InterpolatedIndex& index) const;
   MapPathPoint GetSmoothPoint(double s) const;
 
+  /**
+   * @brief Batch version of GetSmoothPoint(s). The index of each query is
+   * used as a search hint for the next one, so a monotonically increasing
+   * s sequence is resolved with one forward sweep instead of a binary
+   * search per point.
+   */
+  void GetSmoothPoints(const std::vector<double>& accumulate_s,
+                       std::vector<MapPathPoint>* const points) const;
+
   // Compute accumulate s value of the index.
   double GetSFromIndex(const InterpolatedIndex& index) const;
   // Compute interpolated index by accumulate_s.
@@ -261,6 +270,15 @@ class Path {
   bool GetProjection(const common::math::Vec2d& point, double* accumulate_s,
                      double* lateral, double* distance) const;
 
+  /**
+   * @brief Batch version of GetProjection(). Each query point is projected
+   * with one vectorized pass over the segment table, which amortizes the
+   * per-call overhead when callers project thousands of points per cycle.
+   */
+  bool GetProjections(const std::vector<common::math::Vec2d>& points,
+                      std::vector<double>* accumulate_s,
+                      std::vector<double>* laterals) const;
+
   bool GetHeadingAlongPath(const common::math::Vec2d& point,
                            double* heading) const;
 
@@ -338,6 +356,11 @@ class Path {
   void InitWidth();
   void InitPointIndex();
   void InitOverlaps();
+  void InitProjectionKernel();
+
+  // Same as GetIndexFromS, but tries a forward walk from hint_id before
+  // falling back to the binary search.
+  InterpolatedIndex GetIndexFromSWithHint(double s, int hint_id) const;
 
   double GetSample(const std::vector<double>& samples, const double s) const;
 
@@ -357,6 +380,13 @@ class Path {
   double length_ = 0.0;
   std::vector<double> accumulated_s_;
   std::vector<common::math::LineSegment2d> segments_;
+  // Structure-of-arrays copy of segments_ used by the batch projection
+  // kernel; laid out so the per-segment distance loop vectorizes.
+  std::vector<double> segment_start_x_;
+  std::vector<double> segment_start_y_;
+  std::vector<double> segment_unit_x_;
+  std::vector<double> segment_unit_y_;
+  std::vector<double> segment_length_;
   bool use_path_approximation_ = false;
   PathApproximation approximation_;
 
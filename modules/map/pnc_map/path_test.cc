@@ -764,6 +764,49 @@ TEST(TestSuite, hdmap_path_get_smooth_point) {
   EXPECT_NEAR(path.GetSFromIndex(index), segment_length * kNumSegments, 1e-6);
 }
 
+TEST(TestSuite, hdmap_path_batch_queries) {
+  const double kRadius = 50.0;
+  const int kNumSegments = 100;
+  std::vector<MapPathPoint> points;
+  for (int i = 0; i <= kNumSegments; ++i) {
+    const double p =
+        M_PI_2 * static_cast<double>(i) / static_cast<double>(kNumSegments);
+    points.push_back(MakeMapPathPoint(kRadius * cos(p), kRadius * sin(p)));
+  }
+  const Path path(points);
+
+  std::vector<Vec2d> query_points;
+  for (int case_id = 0; case_id < 100; ++case_id) {
+    query_points.emplace_back(RandomDouble(-kRadius * 0.5, kRadius * 1.5),
+                              RandomDouble(-kRadius * 0.5, kRadius * 1.5));
+  }
+  std::vector<double> batch_s;
+  std::vector<double> batch_l;
+  EXPECT_TRUE(path.GetProjections(query_points, &batch_s, &batch_l));
+  EXPECT_EQ(batch_s.size(), query_points.size());
+  EXPECT_EQ(batch_l.size(), query_points.size());
+  for (size_t i = 0; i < query_points.size(); ++i) {
+    double accumulate_s = 0.0;
+    double lateral = 0.0;
+    EXPECT_TRUE(path.GetProjection(query_points[i], &accumulate_s, &lateral));
+    EXPECT_NEAR(batch_s[i], accumulate_s, 1e-6);
+    EXPECT_NEAR(batch_l[i], lateral, 1e-6);
+  }
+
+  std::vector<double> query_s;
+  for (int i = 0; i <= 100; ++i) {
+    query_s.push_back(path.length() * static_cast<double>(i) / 100.0);
+  }
+  std::vector<MapPathPoint> batch_points;
+  path.GetSmoothPoints(query_s, &batch_points);
+  ASSERT_EQ(batch_points.size(), query_s.size());
+  for (size_t i = 0; i < query_s.size(); ++i) {
+    const auto point = path.GetSmoothPoint(query_s[i]);
+    EXPECT_NEAR(batch_points[i].x(), point.x(), 1e-6);
+    EXPECT_NEAR(batch_points[i].y(), point.y(), 1e-6);
+  }
+}
+
 TEST(TestSuite, compute_lane_segments_from_points) {
   std::vector<MapPathPoint> points{
       MakeMapPathPoint(2, 0), MakeMapPathPoint(2, 1), MakeMapPathPoint(2, 2)};
@@ -25,6 +25,8 @@
 #include "modules/map/proto/map_id.pb.h"
 
 #include "cyber/common/log.h"
+#include "modules/common/math/aaboxkdtree2d.h"
+#include "modules/common/math/math_utils.h"
 #include "modules/common/util/point_factory.h"
 #include "modules/common/util/string_util.h"
 #include "modules/common/util/util.h"
@@ -253,12 +255,73 @@ bool PncMap::UpdateRoutingResponse(const routing::RoutingResponse &routing) {
       ++i;
     }
   }
+  BuildRouteLaneSegmentKDTree();
+
   routing_ = routing;
   adc_waypoint_ = LaneWaypoint();
   stop_for_destination_ = false;
   return true;
 }
 
+void PncMap::BuildRouteLaneSegmentKDTree() {
+  route_lane_table_.clear();
+  route_lane_segment_boxes_.clear();
+  route_lane_segment_kdtree_.reset();
+  for (const auto &route_index : route_indices_) {
+    const auto &lane = route_index.segment.lane;
+    route_lane_table_.emplace(lane->id().id(), lane);
+  }
+  for (const auto &entry : route_lane_table_) {
+    const auto *lane = entry.second.get();
+    for (size_t id = 0; id < lane->segments().size(); ++id) {
+      const auto &segment = lane->segments()[id];
+      route_lane_segment_boxes_.emplace_back(
+          common::math::AABox2d(segment.start(), segment.end()), lane, &segment,
+          static_cast<int>(id));
+    }
+  }
+  if (route_lane_segment_boxes_.empty()) {
+    return;
+  }
+  common::math::AABoxKDTreeParams params;
+  params.max_leaf_dimension = 5.0;  // meters.
+  params.max_leaf_size = 16;
+  route_lane_segment_kdtree_.reset(
+      new LaneSegmentKDTree(route_lane_segment_boxes_, params));
+}
+
+int PncMap::GetRouteLanesWithHeading(
+    const common::math::Vec2d &point, const double distance,
+    const double central_heading, const double max_heading_difference,
+    std::vector<LaneInfoConstPtr> *lanes) const {
+  CHECK_NOTNULL(lanes);
+  lanes->clear();
+  if (route_lane_segment_kdtree_ == nullptr) {
+    return -1;
+  }
+  const auto boxes = route_lane_segment_kdtree_->GetObjects(point, distance);
+  std::unordered_set<std::string> candidate_ids;
+  for (const auto *box : boxes) {
+    candidate_ids.insert(box->object()->id().id());
+  }
+  for (const auto &lane_id : candidate_ids) {
+    const auto &lane = route_lane_table_.at(lane_id);
+    common::math::Vec2d proj_pt(0.0, 0.0);
+    double s_offset = 0.0;
+    int s_offset_index = 0;
+    double dis = lane->DistanceTo(point, &proj_pt, &s_offset, &s_offset_index);
+    if (dis <= distance) {
+      double heading_diff =
+          fabs(lane->headings()[s_offset_index] - central_heading);
+      if (fabs(common::math::NormalizeAngle(heading_diff)) <=
+          max_heading_difference) {
+        lanes->push_back(lane);
+      }
+    }
+  }
+  return 0;
+}
+
 const routing::RoutingResponse &PncMap::routing_response() const {
   return routing_;
 }
@@ -495,9 +558,16 @@ bool PncMap::GetNearestPointFromRouting(const VehicleState &state,
   waypoint->lane = nullptr;
   std::vector<LaneInfoConstPtr> lanes;
   const auto point = PointFactory::ToPointENU(state);
-  const int status =
-      hdmap_->GetLanesWithHeading(point, kMaxDistance, state.heading(),
-                                  M_PI / 2.0 + kHeadingBuffer, &lanes);
+  // Query the route-local segment kd-tree first; it only holds the routed
+  // lanes, so candidates do not need to be fished out of a map-wide result.
+  int status =
+      GetRouteLanesWithHeading({point.x(), point.y()}, kMaxDistance,
+                               state.heading(), M_PI / 2.0 + kHeadingBuffer,
+                               &lanes);
+  if (status < 0) {
+    status = hdmap_->GetLanesWithHeading(point, kMaxDistance, state.heading(),
+                                         M_PI / 2.0 + kHeadingBuffer, &lanes);
+  }
   ADEBUG << "lanes:" << lanes.size();
   if (status < 0) {
     AERROR << "Failed to get lane from point: " << point.ShortDebugString();
@@ -21,7 +21,9 @@
 #pragma once
 
 #include <list>
+#include <memory>
 #include <string>
+#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
@@ -157,6 +159,24 @@ class PncMap {
 
   void UpdateRoutingRange(int adc_index);
 
+  /**
+   * @brief Rebuild the spatial index over the lane segments of all routed
+   * lanes. Called from UpdateRoutingResponse() so that per-cycle position
+   * queries do not need to go through the map-wide lane kd-tree.
+   */
+  void BuildRouteLaneSegmentKDTree();
+
+  /**
+   * @brief Route-local equivalent of HDMap::GetLanesWithHeading(). Only lanes
+   * on the current routing are considered.
+   * @return 0 on success, -1 if the route index has not been built.
+   */
+  int GetRouteLanesWithHeading(const common::math::Vec2d &point,
+                               const double distance,
+                               const double central_heading,
+                               const double max_heading_difference,
+                               std::vector<LaneInfoConstPtr> *lanes) const;
+
  private:
   routing::RoutingResponse routing_;
   struct RouteIndex {
@@ -170,6 +190,13 @@ class PncMap {
   std::unordered_set<std::string> range_lane_ids_;
   std::unordered_set<std::string> all_lane_ids_;
 
+  // Spatial index over the lane segments of all routed lanes. The lane table
+  // keeps the LaneInfo objects referenced by the boxes alive across routing
+  // updates.
+  std::unordered_map<std::string, LaneInfoConstPtr> route_lane_table_;
+  std::vector<LaneSegmentBox> route_lane_segment_boxes_;
+  std::unique_ptr<LaneSegmentKDTree> route_lane_segment_kdtree_;
+
   /**
    * The routing request waypoints
    */
@@ -32,3 +32,11 @@ DEFINE_bool(enable_cyclic_rerouting, false,
 
 DEFINE_bool(relative_map_generate_left_boundray, true,
             "Generate left boundary for detected lanes.");
+
+DEFINE_bool(enable_relative_map_caching, false,
+            "Reuse the last generated relative map when the vehicle has "
+            "barely moved and no new navigation line has arrived.");
+
+DEFINE_double(relative_map_regen_distance, 0.05,
+              "Displacement in meters beyond which a cached relative map "
+              "must be regenerated.");
@@ -23,3 +23,5 @@ DECLARE_string(navigator_config_filename);
 DECLARE_int32(relative_map_loop_rate);
 DECLARE_bool(enable_cyclic_rerouting);
 DECLARE_bool(relative_map_generate_left_boundray);
+DECLARE_bool(enable_relative_map_caching);
+DECLARE_double(relative_map_regen_distance);
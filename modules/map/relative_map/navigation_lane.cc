@@ -48,8 +48,8 @@ namespace {
  * @brief Create a single lane map.
  * @param navi_path_tuple A navigation path tuple.
  * @param map_config Map generation configuration information.
- * @param perception_obstacles The Perceived obstacle information and the lane
- * markings are used here.
+ * @param lane_markers The perceived lane markings, used for the boundary
+ * types.
  * @param hdmap The output single lane map in high-definition map format in the
  * relative map.
  * @param navigation_path The output navigation path map in the relative map.
@@ -57,8 +57,7 @@ namespace {
  */
 bool CreateSingleLaneMap(
     const NaviPathTuple &navi_path_tuple, const MapGenerationParam &map_config,
-    const perception::PerceptionObstacles &perception_obstacles,
-    hdmap::Map *const hdmap,
+    const perception::LaneMarkers &lane_markers, hdmap::Map *const hdmap,
     google::protobuf::Map<std::string, NavigationPath> *const navigation_path) {
   CHECK_NOTNULL(hdmap);
   CHECK_NOTNULL(navigation_path);
@@ -93,7 +92,7 @@ bool CreateSingleLaneMap(
     left_boundary->set_virtual_(false);
     left_boundary_type->set_s(0.0);
     left_boundary_type->add_types(
-        perception_obstacles.lane_marker().left_lane_marker().lane_type());
+        lane_markers.left_lane_marker().lane_type());
     left_segment =
         left_boundary->mutable_curve()->add_segment()->mutable_line_segment();
   }
@@ -104,7 +103,7 @@ bool CreateSingleLaneMap(
   right_boundary->set_virtual_(false);
   right_boundary_type->set_s(0.0);
   right_boundary_type->add_types(
-      perception_obstacles.lane_marker().right_lane_marker().lane_type());
+      lane_markers.right_lane_marker().lane_type());
   auto *right_segment =
       right_boundary->mutable_curve()->add_segment()->mutable_line_segment();
 
@@ -167,7 +166,7 @@ bool NavigationLane::GeneratePath() {
   original_pose_ = vehicle_state_provider_->original_pose();
 
   int navigation_line_num = navigation_info_.navigation_path_size();
-  const auto &lane_marker = perception_obstacles_.lane_marker();
+  const auto &lane_marker = lane_markers_;
 
   auto generate_path_on_perception_func = [this, &lane_marker]() {
     auto current_navi_path = std::make_shared<NavigationPath>();
@@ -366,13 +365,12 @@ void NavigationLane::MergeNavigationLineAndLaneMarker(
   // navigation path based on perceived lane markers.
   if (path->path_point_size() < 2) {
     path->Clear();
-    ConvertLaneMarkerToPath(perception_obstacles_.lane_marker(), path);
+    ConvertLaneMarkerToPath(lane_markers_, path);
     return;
   }
 
   common::Path lane_marker_path;
-  ConvertLaneMarkerToPath(perception_obstacles_.lane_marker(),
-                          &lane_marker_path);
+  ConvertLaneMarkerToPath(lane_markers_, &lane_marker_path);
 
   // If the size of lane marker path points is smaller than 2, merging is not
   // required.
@@ -744,7 +742,7 @@ bool NavigationLane::CreateMap(const MapGenerationParam &map_config,
   auto *hdmap = map_msg->mutable_hdmap();
   auto *lane_marker = map_msg->mutable_lane_marker();
 
-  lane_marker->CopyFrom(perception_obstacles_.lane_marker());
+  lane_marker->CopyFrom(lane_markers_);
 
   // If no navigation path is generated based on navigation lines, we try to
   // create map with "current_navi_path_tuple_" which is generated based on
@@ -753,7 +751,7 @@ bool NavigationLane::CreateMap(const MapGenerationParam &map_config,
     if (std::get<3>(current_navi_path_tuple_) != nullptr) {
       FLAGS_relative_map_generate_left_boundray = true;
       return CreateSingleLaneMap(current_navi_path_tuple_, map_config,
-                                 perception_obstacles_, hdmap, navigation_path);
+                                 lane_markers_, hdmap, navigation_path);
     } else {
       return false;
     }
@@ -764,7 +762,7 @@ bool NavigationLane::CreateMap(const MapGenerationParam &map_config,
   for (auto iter = navigation_path_list_.cbegin();
        iter != navigation_path_list_.cend(); ++iter) {
     std::size_t index = std::distance(navigation_path_list_.cbegin(), iter);
-    if (!CreateSingleLaneMap(*iter, map_config, perception_obstacles_, hdmap,
+    if (!CreateSingleLaneMap(*iter, map_config, lane_markers_, hdmap,
                              navigation_path)) {
       AWARN << "Failed to generate lane: " << index;
       ++fail_num;
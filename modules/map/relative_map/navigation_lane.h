@@ -142,7 +142,18 @@ class NavigationLane {
    */
   void UpdatePerception(
       const perception::PerceptionObstacles& perception_obstacles) {
-    perception_obstacles_ = perception_obstacles;
+    // only the lane markers are consumed here; copying the whole
+    // obstacle message every cycle is wasted work
+    lane_markers_ = perception_obstacles.lane_marker();
+  }
+
+  /**
+   * @brief Update perceived lane marker information directly.
+   * @param lane_markers Perceived lane markers to be updated.
+   * @return None.
+   */
+  void UpdateLaneMarkers(const perception::LaneMarkers& lane_markers) {
+    lane_markers_ = lane_markers;
   }
 
   /**
@@ -268,8 +279,8 @@ class NavigationLane {
   // the configuration information required by the `NavigationLane`
   NavigationLaneConfig config_;
 
-  // received from topic: /apollo/perception_obstacles
-  perception::PerceptionObstacles perception_obstacles_;
+  // lane markers received from topic: /apollo/perception_obstacles
+  perception::LaneMarkers lane_markers_;
 
   // received from topic: /apollo/navigation
   NavigationInfo navigation_info_;
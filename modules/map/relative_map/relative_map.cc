@@ -16,7 +16,10 @@
 
 #include "modules/map/relative_map/relative_map.h"
 
+#include <cmath>
+
 #include "cyber/common/file.h"
+#include "modules/common/math/math_utils.h"
 #include "modules/common/math/vec2d.h"
 #include "modules/common/util/util.h"
 #include "modules/common/vehicle_state/vehicle_state_provider.h"
@@ -76,15 +79,50 @@ apollo::common::Status RelativeMap::Start() {
 bool RelativeMap::Process(MapMsg* const map_msg) {
   {
     std::lock_guard<std::mutex> lock(navigation_lane_mutex_);
-    CreateMapFromNavigationLane(map_msg);
+    if (FLAGS_enable_relative_map_caching && CanReuseCachedMap()) {
+      // the geometry is unchanged within the regeneration delta, only
+      // the dynamic fields need a refresh
+      map_msg->CopyFrom(cached_map_msg_);
+      map_msg->mutable_localization()->CopyFrom(localization_);
+      map_msg->mutable_lane_marker()->CopyFrom(lane_markers_);
+      return true;
+    }
+    if (CreateMapFromNavigationLane(map_msg)) {
+      cached_map_msg_.CopyFrom(*map_msg);
+      cached_map_x_ = localization_.pose().position().x();
+      cached_map_y_ = localization_.pose().position().y();
+      cached_map_heading_ = localization_.pose().heading();
+      has_cached_map_ = true;
+      navigation_dirty_ = false;
+    } else {
+      has_cached_map_ = false;
+    }
   }
   return true;
 }
 
+bool RelativeMap::CanReuseCachedMap() const {
+  if (!has_cached_map_ || navigation_dirty_) {
+    return false;
+  }
+  // relative maps are expressed in the vehicle's FLU frame, so reuse is
+  // only safe while the pose the map was generated at still holds
+  constexpr double kMaxCachedHeadingDiff = 0.002;  // rad
+  const auto& position = localization_.pose().position();
+  const double dx = position.x() - cached_map_x_;
+  const double dy = position.y() - cached_map_y_;
+  const double heading_diff = common::math::NormalizeAngle(
+      localization_.pose().heading() - cached_map_heading_);
+  return dx * dx + dy * dy < FLAGS_relative_map_regen_distance *
+                                 FLAGS_relative_map_regen_distance &&
+         std::fabs(heading_diff) < kMaxCachedHeadingDiff;
+}
+
 void RelativeMap::OnNavigationInfo(const NavigationInfo& navigation_info) {
   {
     std::lock_guard<std::mutex> lock(navigation_lane_mutex_);
     navigation_lane_.UpdateNavigationInfo(navigation_info);
+    navigation_dirty_ = true;
   }
 }
 
@@ -92,7 +130,8 @@ void RelativeMap::OnPerception(
     const PerceptionObstacles& perception_obstacles) {
   {
     std::lock_guard<std::mutex> lock(navigation_lane_mutex_);
-    perception_obstacles_.CopyFrom(perception_obstacles);
+    // only the lane markers are consumed by the map generation
+    lane_markers_.CopyFrom(perception_obstacles.lane_marker());
   }
 }
 
@@ -120,10 +159,9 @@ bool RelativeMap::CreateMapFromNavigationLane(MapMsg* map_msg) {
   vehicle_state_provider_->Update(localization, chassis);
   map_msg->mutable_localization()->CopyFrom(localization_);
 
-  // update navigation_lane from perception_obstacles (lane marker)
-  PerceptionObstacles const& perception = perception_obstacles_;
-  navigation_lane_.UpdatePerception(perception);
-  map_msg->mutable_lane_marker()->CopyFrom(perception_obstacles_.lane_marker());
+  // update navigation_lane from the perceived lane markers
+  navigation_lane_.UpdateLaneMarkers(lane_markers_);
+  map_msg->mutable_lane_marker()->CopyFrom(lane_markers_);
 
   if (!navigation_lane_.GeneratePath()) {
     LogErrorStatus(map_msg, "Failed to generate a navigation path.");
@@ -75,14 +75,26 @@ class RelativeMap {
 
  private:
   bool CreateMapFromNavigationLane(MapMsg* map_msg);
+  // whether the cached map is still valid for the current pose, i.e. the
+  // vehicle has barely moved and no new navigation line has arrived
+  bool CanReuseCachedMap() const;
   RelativeMapConfig config_;
   apollo::common::monitor::MonitorLogBuffer monitor_logger_buffer_;
 
   NavigationLane navigation_lane_;
-  perception::PerceptionObstacles perception_obstacles_;
+  perception::LaneMarkers lane_markers_;
   canbus::Chassis chassis_;
   localization::LocalizationEstimate localization_;
 
+  // last generated map and the pose it was generated at, reused while
+  // the odometry delta stays below FLAGS_relative_map_regen_distance
+  MapMsg cached_map_msg_;
+  bool has_cached_map_ = false;
+  bool navigation_dirty_ = false;
+  double cached_map_x_ = 0.0;
+  double cached_map_y_ = 0.0;
+  double cached_map_heading_ = 0.0;
+
   std::mutex navigation_lane_mutex_;
   common::VehicleStateProvider* vehicle_state_provider_;
 };
@@ -0,0 +1,85 @@
+/******************************************************************************
+ * Copyright 2021 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+/**
+ * Content-hash helpers for the map generation tools. A derived artifact
+ * (sim_map, base_map.bin) records the hash of its inputs next to itself;
+ * when the recorded hash matches on the next run, regeneration is
+ * skipped. The hash covers file content, not timestamps, so re-unpacked
+ * map drops with fresh mtimes but identical data still skip.
+ */
+namespace apollo {
+namespace hdmap {
+
+/**
+ * @brief 64-bit FNV-1a over a byte sequence.
+ */
+inline uint64_t ContentHash(const std::string& content) {
+  uint64_t hash = 0xcbf29ce484222325ULL;
+  for (const char c : content) {
+    hash ^= static_cast<unsigned char>(c);
+    hash *= 0x100000001b3ULL;
+  }
+  return hash;
+}
+
+/**
+ * @brief Hash the content of a file, plus a salt describing the
+ * generation parameters so changed flags invalidate the artifact.
+ * @return the hash as a hex string, or an empty string when the file
+ * cannot be read.
+ */
+inline std::string ContentHashOfFile(const std::string& file_path,
+                                     const std::string& salt) {
+  std::ifstream ifs(file_path, std::ios::binary);
+  if (!ifs) {
+    return "";
+  }
+  std::ostringstream oss;
+  oss << ifs.rdbuf();
+  std::ostringstream hex;
+  hex << std::hex << ContentHash(oss.str() + salt);
+  return hex.str();
+}
+
+/**
+ * @brief Read a previously recorded hash.
+ */
+inline std::string ReadRecordedHash(const std::string& hash_file) {
+  std::ifstream ifs(hash_file);
+  std::string hash;
+  ifs >> hash;
+  return hash;
+}
+
+/**
+ * @brief Record the hash next to the generated artifact.
+ */
+inline void WriteRecordedHash(const std::string& hash_file,
+                              const std::string& hash) {
+  std::ofstream ofs(hash_file);
+  ofs << hash << std::endl;
+}
+
+}  // namespace hdmap
+}  // namespace apollo
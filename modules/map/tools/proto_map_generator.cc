@@ -20,12 +20,16 @@ limitations under the License.
 #include "modules/map/hdmap/adapter/opendrive_adapter.h"
 #include "modules/map/hdmap/hdmap_util.h"
 #include "modules/map/proto/map.pb.h"
+#include "modules/map/tools/content_hash.h"
 
 /**
  * A map tool to transform opendrive map to pb map
  */
 
 DEFINE_string(output_dir, "/tmp", "output map directory");
+DEFINE_bool(proto_map_force_rebuild, false,
+            "regenerate the pb map even when the recorded content hash of "
+            "the opendrive map matches");
 
 int main(int argc, char **argv) {
   google::InitGoogleLogging(argv[0]);
@@ -34,6 +38,19 @@ int main(int argc, char **argv) {
   google::ParseCommandLineFlags(&argc, &argv, true);
 
   const auto map_filename = FLAGS_map_dir + "/base_map.xml";
+
+  // Skip the conversion when the opendrive map content is unchanged
+  // since the last run.
+  const std::string hash = apollo::hdmap::ContentHashOfFile(map_filename, "");
+  const std::string hash_file = FLAGS_output_dir + "/base_map.hash";
+  if (!FLAGS_proto_map_force_rebuild && !hash.empty() &&
+      hash == apollo::hdmap::ReadRecordedHash(hash_file) &&
+      apollo::cyber::common::PathExists(FLAGS_output_dir + "/base_map.bin")) {
+    AINFO << "pb map is up to date (opendrive map hash " << hash
+          << " unchanged), skipping regeneration.";
+    return 0;
+  }
+
   apollo::hdmap::Map pb_map;
   ACHECK(
       apollo::hdmap::adapter::OpendriveAdapter::LoadData(map_filename, &pb_map))
@@ -51,6 +68,9 @@ int main(int argc, char **argv) {
   ACHECK(apollo::cyber::common::GetProtoFromFile(output_bin_file, &pb_map))
       << "failed to load map";
 
+  if (!hash.empty()) {
+    apollo::hdmap::WriteRecordedHash(hash_file, hash);
+  }
   AINFO << "load map success";
 
   return 0;
@@ -14,6 +14,10 @@
  * limitations under the License.
  *****************************************************************************/
 
+#include <algorithm>
+#include <future>
+#include <thread>
+
 #include "gflags/gflags.h"
 
 #include "absl/strings/match.h"
@@ -24,6 +28,7 @@
 #include "modules/map/hdmap/adapter/opendrive_adapter.h"
 #include "modules/map/hdmap/hdmap_util.h"
 #include "modules/map/proto/map.pb.h"
+#include "modules/map/tools/content_hash.h"
 
 /**
  * A map tool to generate a downsampled map to be displayed by dreamview
@@ -37,6 +42,9 @@ DEFINE_double(angle_threshold, 1. / 180 * M_PI, /* 1 degree */
 DEFINE_int32(downsample_distance, 5, "downsample rate for a normal path");
 DEFINE_int32(steep_turn_downsample_distance, 1,
              "downsample rate for a steep turn path");
+DEFINE_bool(sim_map_force_rebuild, false,
+            "regenerate sim_map even when the recorded content hash of the "
+            "base map matches");
 
 using apollo::common::PointENU;
 using apollo::common::util::DownsampleByAngle;
@@ -72,23 +80,46 @@ static void DownsampleCurve(Curve* curve) {
   size_t new_size = line_segment->point_size();
   CHECK_GT(new_size, 1);
 
-  AINFO << "Lane curve downsampled from " << points.size() << " points to "
-        << new_size << " points.";
+  ADEBUG << "Lane curve downsampled from " << points.size() << " points to "
+         << new_size << " points.";
 }
 
 static void DownsampleMap(Map* map_pb) {
-  for (int i = 0; i < map_pb->lane_size(); ++i) {
-    auto* lane = map_pb->mutable_lane(i);
-    lane->clear_left_sample();
-    lane->clear_right_sample();
-    lane->clear_left_road_sample();
-    lane->clear_right_road_sample();
-
-    AINFO << "Downsampling lane " << lane->id().id();
-    DownsampleCurve(lane->mutable_central_curve());
-    DownsampleCurve(lane->mutable_left_boundary()->mutable_curve());
-    DownsampleCurve(lane->mutable_right_boundary()->mutable_curve());
+  // Lanes are independent, so they are downsampled in place by a pool of
+  // workers; every lane keeps its slot, which keeps the output identical
+  // to a sequential run.
+  const int lane_num = map_pb->lane_size();
+  if (lane_num == 0) {
+    return;
+  }
+  const int worker_num = std::max(
+      1, std::min(static_cast<int>(std::thread::hardware_concurrency()),
+                  lane_num));
+  std::vector<std::future<void>> workers;
+  workers.reserve(worker_num);
+  for (int worker = 0; worker < worker_num; ++worker) {
+    workers.emplace_back(
+        std::async(std::launch::async, [map_pb, lane_num, worker_num,
+                                        worker]() {
+          for (int i = worker; i < lane_num; i += worker_num) {
+            auto* lane = map_pb->mutable_lane(i);
+            lane->clear_left_sample();
+            lane->clear_right_sample();
+            lane->clear_left_road_sample();
+            lane->clear_right_road_sample();
+
+            ADEBUG << "Downsampling lane " << lane->id().id();
+            DownsampleCurve(lane->mutable_central_curve());
+            DownsampleCurve(lane->mutable_left_boundary()->mutable_curve());
+            DownsampleCurve(lane->mutable_right_boundary()->mutable_curve());
+          }
+        }));
   }
+  for (auto& worker : workers) {
+    worker.get();
+  }
+  AINFO << "Downsampled " << lane_num << " lanes with " << worker_num
+        << " workers.";
 }
 
 static void OutputMap(const Map& map_pb) {
@@ -112,6 +143,22 @@ int main(int32_t argc, char** argv) {
 
   Map map_pb;
   const auto map_file = apollo::hdmap::BaseMapFile();
+
+  // Skip regeneration when the base map content and the downsampling
+  // parameters are unchanged since the last run.
+  const std::string salt = std::to_string(FLAGS_angle_threshold) + "|" +
+                           std::to_string(FLAGS_downsample_distance) + "|" +
+                           std::to_string(FLAGS_steep_turn_downsample_distance);
+  const std::string hash = apollo::hdmap::ContentHashOfFile(map_file, salt);
+  const std::string hash_file = FLAGS_output_dir + "/sim_map.hash";
+  if (!FLAGS_sim_map_force_rebuild && !hash.empty() &&
+      hash == apollo::hdmap::ReadRecordedHash(hash_file) &&
+      apollo::cyber::common::PathExists(FLAGS_output_dir + "/sim_map.bin")) {
+    AINFO << "sim_map is up to date (base map hash " << hash
+          << " unchanged), skipping regeneration.";
+    return 0;
+  }
+
   if (absl::EndsWith(map_file, ".xml")) {
     ACHECK(OpendriveAdapter::LoadData(map_file, &map_pb));
   } else {
@@ -120,6 +167,9 @@ int main(int32_t argc, char** argv) {
 
   DownsampleMap(&map_pb);
   OutputMap(map_pb);
+  if (!hash.empty()) {
+    apollo::hdmap::WriteRecordedHash(hash_file, hash);
+  }
   AINFO << "sim_map generated at:" << FLAGS_output_dir;
 
   return 0;
@@ -0,0 +1,136 @@
+/******************************************************************************
+ * Copyright 2021 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "modules/monitor/common/heartbeat_board.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+
+#include "cyber/common/log.h"
+#include "modules/common/time/time.h"
+
+namespace apollo {
+namespace monitor {
+namespace {
+
+constexpr char kHeartbeatShmName[] = "/apollo.monitor.heartbeat";
+
+}  // namespace
+
+HeartbeatBoard::HeartbeatBoard() {}
+
+void HeartbeatBoard::Stamp(const std::string& name) {
+  auto* board = Instance();
+  Entry* entry = board->FindOrClaim(name);
+  if (entry != nullptr) {
+    entry->timestamp_sec.store(apollo::common::time::Clock::NowInSeconds(),
+                               std::memory_order_relaxed);
+  }
+}
+
+void HeartbeatBoard::Snapshot(std::map<std::string, double>* heartbeats) {
+  heartbeats->clear();
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (!Attach()) {
+    return;
+  }
+  for (size_t i = 0; i < kMaxEntries; ++i) {
+    Entry& entry = entries_[i];
+    if (entry.state.load(std::memory_order_acquire) == Entry::READY) {
+      heartbeats->emplace(
+          entry.name, entry.timestamp_sec.load(std::memory_order_relaxed));
+    }
+  }
+}
+
+bool HeartbeatBoard::Attach() {
+  if (entries_ != nullptr) {
+    return true;
+  }
+  if (attach_failed_) {
+    return false;
+  }
+  const size_t size = sizeof(Entry) * kMaxEntries;
+  // The segment outlives all processes; the kernel zero-fills it on
+  // creation, which leaves every entry in the FREE state.
+  const int fd = shm_open(kHeartbeatShmName, O_CREAT | O_RDWR, 0666);
+  if (fd < 0 || ftruncate(fd, size) != 0) {
+    AERROR << "Failed to open heartbeat shared memory " << kHeartbeatShmName
+           << ": " << strerror(errno);
+    if (fd >= 0) {
+      close(fd);
+    }
+    attach_failed_ = true;
+    return false;
+  }
+  void* addr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  close(fd);
+  if (addr == MAP_FAILED) {
+    AERROR << "Failed to map heartbeat shared memory: " << strerror(errno);
+    attach_failed_ = true;
+    return false;
+  }
+  entries_ = static_cast<Entry*>(addr);
+  return true;
+}
+
+HeartbeatBoard::Entry* HeartbeatBoard::FindOrClaim(const std::string& name) {
+  if (name.empty() || name.size() > kMaxNameLength) {
+    AERROR_EVERY(1000) << "Invalid heartbeat name: " << name;
+    return nullptr;
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  const auto cached = claimed_entries_.find(name);
+  if (cached != claimed_entries_.end()) {
+    return cached->second;
+  }
+  if (!Attach()) {
+    return nullptr;
+  }
+  for (size_t i = 0; i < kMaxEntries; ++i) {
+    Entry& entry = entries_[i];
+    uint32_t state = entry.state.load(std::memory_order_acquire);
+    if (state == Entry::READY) {
+      if (name == entry.name) {
+        claimed_entries_.emplace(name, &entry);
+        return &entry;
+      }
+      continue;
+    }
+    uint32_t expected = Entry::FREE;
+    if (state == Entry::FREE &&
+        entry.state.compare_exchange_strong(expected, Entry::CLAIMING,
+                                            std::memory_order_acq_rel)) {
+      std::snprintf(entry.name, sizeof(entry.name), "%s", name.c_str());
+      entry.timestamp_sec.store(0.0, std::memory_order_relaxed);
+      entry.state.store(Entry::READY, std::memory_order_release);
+      claimed_entries_.emplace(name, &entry);
+      return &entry;
+    }
+    // Another process is mid-claim on this slot; skip it and let the next
+    // stamp retry the scan.
+  }
+  AERROR_EVERY(1000) << "Heartbeat board is full, cannot stamp " << name;
+  return nullptr;
+}
+
+}  // namespace monitor
+}  // namespace apollo
@@ -0,0 +1,78 @@
+/******************************************************************************
+ * Copyright 2021 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#pragma once
+
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "cyber/common/macros.h"
+
+/**
+ * @namespace apollo::monitor
+ * @brief apollo::monitor
+ */
+namespace apollo {
+namespace monitor {
+
+// A fixed-size board of per-component heartbeat timestamps in POSIX shared
+// memory. Components stamp their slot directly with a single atomic store,
+// so stamping costs no IPC and can be done every cycle; the monitor process
+// maps the same segment and reads all slots to catch sub-second stalls that
+// channel-rate checks miss.
+class HeartbeatBoard {
+ public:
+  static const size_t kMaxEntries = 64;
+  static const size_t kMaxNameLength = 47;
+
+  // Stamp the named component's heartbeat with the current time. Claims a
+  // free slot on first use; does nothing if the board is unavailable or
+  // full. Safe to call from any thread or process.
+  static void Stamp(const std::string& name);
+
+  // Read all stamped heartbeats into *heartbeats as name -> timestamp in
+  // seconds.
+  void Snapshot(std::map<std::string, double>* heartbeats);
+
+ private:
+  struct Entry {
+    // FREE -> CLAIMING (CAS winner writes name) -> READY.
+    enum State : uint32_t { FREE = 0, CLAIMING = 1, READY = 2 };
+    std::atomic<uint32_t> state;
+    char name[kMaxNameLength + 1];
+    std::atomic<double> timestamp_sec;
+  };
+
+  // Map (and create if needed) the shared segment. Returns false on error.
+  bool Attach();
+  // Find the entry stamped under this name, claiming a free slot when the
+  // name is new. Returns nullptr if the board is unavailable or full.
+  Entry* FindOrClaim(const std::string& name);
+
+  Entry* entries_ = nullptr;
+  bool attach_failed_ = false;
+  // Cache of claimed slots, so repeated stamps skip the board scan.
+  std::unordered_map<std::string, Entry*> claimed_entries_;
+  std::mutex mutex_;
+
+  DECLARE_SINGLETON(HeartbeatBoard)
+};
+
+}  // namespace monitor
+}  // namespace apollo
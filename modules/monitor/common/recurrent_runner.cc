@@ -22,15 +22,28 @@ namespace apollo {
 namespace monitor {
 
 RecurrentRunner::RecurrentRunner(const std::string &name, const double interval)
-    : name_(name), interval_(interval) {}
+    : name_(name), interval_(interval), min_interval_(interval * 0.25) {}
 
 void RecurrentRunner::Tick(const double current_time) {
-  if (next_round_ <= current_time) {
-    ++round_count_;
-    AINFO_EVERY(100) << name_ << " is running round #" << round_count_;
-    next_round_ = current_time + interval_;
-    RunOnce(current_time);
+  if (next_round_ > current_time) {
+    // Not due yet; only run early for a pending notification, and no more
+    // often than the rate limit allows. An over-eager notification stays
+    // pending until enough time has passed.
+    if (!notified_.load(std::memory_order_relaxed) ||
+        last_round_ + min_interval_ > current_time) {
+      return;
+    }
   }
+  notified_.store(false, std::memory_order_relaxed);
+  ++round_count_;
+  AINFO_EVERY(100) << name_ << " is running round #" << round_count_;
+  last_round_ = current_time;
+  next_round_ = current_time + interval_;
+  RunOnce(current_time);
+}
+
+void RecurrentRunner::Notify() {
+  notified_.store(true, std::memory_order_relaxed);
 }
 
 }  // namespace monitor
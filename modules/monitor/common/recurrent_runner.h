@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <string>
 
 /**
@@ -31,9 +32,15 @@ class RecurrentRunner {
   virtual ~RecurrentRunner() = default;
 
   // Tick once, which may or may not execute the RunOnce() function, based on
-  // the interval setting.
+  // the interval setting and pending notifications.
   void Tick(const double current_time);
 
+  // Request an early evaluation, e.g. from an event callback. The next Tick()
+  // will execute RunOnce() without waiting for the interval to elapse, rate
+  // limited to at most one extra round per quarter interval so event bursts
+  // cannot turn the runner into a busy loop. Safe to call from any thread.
+  void Notify();
+
   // Do the actual work.
   virtual void RunOnce(const double current_time) = 0;
 
@@ -43,7 +50,10 @@ class RecurrentRunner {
 
  private:
   double interval_;
+  double min_interval_;
   double next_round_ = 0;
+  double last_round_ = 0;
+  std::atomic<bool> notified_ = {false};
 };
 
 }  // namespace monitor
@@ -48,5 +48,24 @@ TEST(RecurrentRunnerTest, Tick) {
   EXPECT_EQ(3, runner.GetRoundCount());
 }
 
+TEST(RecurrentRunnerTest, Notify) {
+  DummyRecurrentRunner runner(1);
+  runner.Tick(0.1);  // Triggered. Next trigger time: 1.1
+  EXPECT_EQ(1, runner.GetRoundCount());
+
+  runner.Notify();
+  runner.Tick(0.2);  // Rate limited. Notification stays pending.
+  EXPECT_EQ(1, runner.GetRoundCount());
+
+  runner.Tick(0.4);  // Quarter interval passed. Triggered early.
+  EXPECT_EQ(2, runner.GetRoundCount());
+
+  runner.Tick(0.8);  // Notification consumed. Not triggered.
+  EXPECT_EQ(2, runner.GetRoundCount());
+
+  runner.Tick(1.4);  // Triggered. Next trigger time: 2.4
+  EXPECT_EQ(3, runner.GetRoundCount());
+}
+
 }  // namespace monitor
 }  // namespace apollo
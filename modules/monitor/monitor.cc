@@ -23,6 +23,7 @@
 #include "modules/monitor/hardware/socket_can_monitor.h"
 #include "modules/monitor/software/channel_monitor.h"
 #include "modules/monitor/software/functional_safety_monitor.h"
+#include "modules/monitor/software/heartbeat_monitor.h"
 #include "modules/monitor/software/latency_monitor.h"
 #include "modules/monitor/software/localization_monitor.h"
 #include "modules/monitor/software/process_monitor.h"
@@ -48,7 +49,19 @@ bool Monitor::Init() {
   // FLAGS_localization_component_name to the mode's monitored_components.
   runners_.emplace_back(new LocalizationMonitor());
   // Monitor if processes are running.
-  runners_.emplace_back(new ProcessMonitor());
+  const std::shared_ptr<ProcessMonitor> process_monitor(new ProcessMonitor());
+  runners_.emplace_back(process_monitor);
+  // Re-check processes as soon as the cyber topology changes, instead of
+  // waiting out the polling interval. The connection lives as long as this
+  // component.
+  topology_conn_ =
+      apollo::cyber::service_discovery::TopologyManager::Instance()
+          ->AddChangeListener(
+              [process_monitor](const apollo::cyber::proto::ChangeMsg&) {
+                process_monitor->Notify();
+              });
+  // Monitor heartbeats that components stamp onto the shared-memory board.
+  runners_.emplace_back(new HeartbeatMonitor());
   // Monitor message processing latencies across modules
   const std::shared_ptr<LatencyMonitor> latency_monitor(new LatencyMonitor());
   runners_.emplace_back(latency_monitor);
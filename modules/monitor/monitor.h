@@ -21,6 +21,7 @@
 
 #include "cyber/component/timer_component.h"
 #include "cyber/cyber.h"
+#include "cyber/service_discovery/topology_manager.h"
 #include "modules/monitor/common/recurrent_runner.h"
 
 /**
@@ -37,6 +38,8 @@ class Monitor : public apollo::cyber::TimerComponent {
 
  private:
   std::vector<std::shared_ptr<RecurrentRunner>> runners_;
+  apollo::cyber::service_discovery::TopologyManager::ChangeConnection
+      topology_conn_;
 };
 
 CYBER_REGISTER_COMPONENT(Monitor)
@@ -0,0 +1,71 @@
+/******************************************************************************
+ * Copyright 2021 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "modules/monitor/software/heartbeat_monitor.h"
+
+#include <map>
+#include <string>
+
+#include "absl/strings/str_cat.h"
+#include "gflags/gflags.h"
+#include "modules/common/util/map_util.h"
+#include "modules/monitor/common/heartbeat_board.h"
+#include "modules/monitor/common/monitor_manager.h"
+#include "modules/monitor/software/summary_monitor.h"
+
+DEFINE_string(heartbeat_monitor_name, "HeartbeatMonitor",
+              "Name of the heartbeat monitor.");
+
+DEFINE_double(heartbeat_monitor_interval, 0.25,
+              "Heartbeat checking interval in seconds.");
+
+DEFINE_double(heartbeat_stall_threshold, 0.5,
+              "Escalate a component status if its heartbeat stamp is older "
+              "than this many seconds.");
+
+namespace apollo {
+namespace monitor {
+
+HeartbeatMonitor::HeartbeatMonitor()
+    : RecurrentRunner(FLAGS_heartbeat_monitor_name,
+                      FLAGS_heartbeat_monitor_interval) {}
+
+void HeartbeatMonitor::RunOnce(const double current_time) {
+  std::map<std::string, double> heartbeats;
+  HeartbeatBoard::Instance()->Snapshot(&heartbeats);
+
+  auto* components = MonitorManager::Instance()->GetStatus()
+                         ->mutable_components();
+  for (const auto& heartbeat : heartbeats) {
+    const std::string& name = heartbeat.first;
+    if (!apollo::common::util::ContainsKey(*components, name)) {
+      continue;
+    }
+    auto* status = components->at(name).mutable_other_status();
+    const double age = current_time - heartbeat.second;
+    if (age > FLAGS_heartbeat_stall_threshold) {
+      SummaryMonitor::EscalateStatus(
+          ComponentStatus::ERROR,
+          absl::StrCat(name, " heartbeat stalled for ", age, " seconds"),
+          status);
+    } else {
+      SummaryMonitor::EscalateStatus(ComponentStatus::OK, "", status);
+    }
+  }
+}
+
+}  // namespace monitor
+}  // namespace apollo
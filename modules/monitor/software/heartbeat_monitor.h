@@ -0,0 +1,36 @@
+/******************************************************************************
+ * Copyright 2021 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#pragma once
+
+#include "modules/monitor/common/recurrent_runner.h"
+
+namespace apollo {
+namespace monitor {
+
+// Checks the shared-memory heartbeat board at a fast rate and escalates the
+// status of monitored components whose stamps stall, catching sub-second
+// process hangs that the process and channel monitors miss between rounds.
+// Stamping is opt-in: only components that call HeartbeatBoard::Stamp() are
+// checked.
+class HeartbeatMonitor : public RecurrentRunner {
+ public:
+  HeartbeatMonitor();
+  void RunOnce(const double current_time) override;
+};
+
+}  // namespace monitor
+}  // namespace apollo
@@ -15,6 +15,7 @@
  *****************************************************************************/
 #pragma once
 
+#include <atomic>
 #include <deque>
 #include <list>
 #include <memory>
@@ -24,7 +25,9 @@
 
 #include "modules/perception/base/object_pool.h"
 
-#define PERCEPTION_BASE_DISABLE_POOL
+// Define PERCEPTION_BASE_DISABLE_POOL (e.g. through copts) to bypass the
+// freelist and allocate every object from the heap. Occupancy metrics are
+// maintained in both modes.
 namespace apollo {
 namespace perception {
 namespace base {
@@ -51,7 +54,7 @@ class ConcurrentObjectPool : public BaseObjectPool<ObjectType> {
   }
   // @brief overrided function to get object smart pointer
   std::shared_ptr<ObjectType> Get() override {
-// TODO(All): remove conditional build
+    OnGet(1);
 #ifndef PERCEPTION_BASE_DISABLE_POOL
     ObjectType* ptr = nullptr;
     {
@@ -66,11 +69,16 @@ class ConcurrentObjectPool : public BaseObjectPool<ObjectType> {
     // after releasing the mutex
     kInitializer(ptr);
     return std::shared_ptr<ObjectType>(ptr, [&](ObjectType* obj_ptr) {
+      OnRelease(1);
       std::lock_guard<std::mutex> lock(mutex_);
       queue_.push(obj_ptr);
     });
 #else
-    return std::shared_ptr<ObjectType>(new ObjectType);
+    return std::shared_ptr<ObjectType>(new ObjectType,
+                                       [this](ObjectType* obj_ptr) {
+                                         OnRelease(1);
+                                         delete obj_ptr;
+                                       });
 #endif
   }
   // @brief overrided function to get batch of smart pointers
@@ -78,6 +86,7 @@ class ConcurrentObjectPool : public BaseObjectPool<ObjectType> {
   // @params[OUT] data: vector container to store the pointers
   void BatchGet(size_t num,
                 std::vector<std::shared_ptr<ObjectType>>* data) override {
+    OnGet(num);
 #ifndef PERCEPTION_BASE_DISABLE_POOL
     std::vector<ObjectType*> buffer(num, nullptr);
     {
@@ -96,13 +105,17 @@ class ConcurrentObjectPool : public BaseObjectPool<ObjectType> {
       kInitializer(buffer[i]);
       data->emplace_back(
           std::shared_ptr<ObjectType>(buffer[i], [&](ObjectType* obj_ptr) {
+            OnRelease(1);
             std::lock_guard<std::mutex> lock(mutex_);
             queue_.push(obj_ptr);
           }));
     }
 #else
     for (size_t i = 0; i < num; ++i) {
-      data->emplace_back(new ObjectType);
+      data->emplace_back(new ObjectType, [this](ObjectType* obj_ptr) {
+        OnRelease(1);
+        delete obj_ptr;
+      });
     }
 #endif
   }
@@ -112,6 +125,7 @@ class ConcurrentObjectPool : public BaseObjectPool<ObjectType> {
   // @params[OUT] data: list container to store the pointers
   void BatchGet(size_t num, bool is_front,
                 std::list<std::shared_ptr<ObjectType>>* data) override {
+    OnGet(num);
 #ifndef PERCEPTION_BASE_DISABLE_POOL
     std::vector<ObjectType*> buffer(num, nullptr);
     {
@@ -131,20 +145,25 @@ class ConcurrentObjectPool : public BaseObjectPool<ObjectType> {
       is_front ? data->emplace_front(std::shared_ptr<ObjectType>(
                      buffer[i],
                      [&](ObjectType* obj_ptr) {
+                       OnRelease(1);
                        std::lock_guard<std::mutex> lock(mutex_);
                        queue_.push(obj_ptr);
                      }))
                : data->emplace_back(std::shared_ptr<ObjectType>(
                      buffer[i], [&](ObjectType* obj_ptr) {
+                       OnRelease(1);
                        std::lock_guard<std::mutex> lock(mutex_);
                        queue_.push(obj_ptr);
                      }));
     }
 #else
     for (size_t i = 0; i < num; ++i) {
-      is_front
-          ? data->emplace_front(new ObjectType)
-          : data->emplace_back(new ObjectType);
+      auto deleter = [this](ObjectType* obj_ptr) {
+        OnRelease(1);
+        delete obj_ptr;
+      };
+      is_front ? data->emplace_front(new ObjectType, deleter)
+               : data->emplace_back(new ObjectType, deleter);
     }
 #endif
   }
@@ -154,6 +173,7 @@ class ConcurrentObjectPool : public BaseObjectPool<ObjectType> {
   // @params[OUT] data: deque container to store the pointers
   void BatchGet(size_t num, bool is_front,
                 std::deque<std::shared_ptr<ObjectType>>* data) override {
+    OnGet(num);
 #ifndef PERCEPTION_BASE_DISABLE_POOL
     std::vector<ObjectType*> buffer(num, nullptr);
     {
@@ -171,20 +191,25 @@ class ConcurrentObjectPool : public BaseObjectPool<ObjectType> {
       is_front ? data->emplace_front(std::shared_ptr<ObjectType>(
                      buffer[i],
                      [&](ObjectType* obj_ptr) {
+                       OnRelease(1);
                        std::lock_guard<std::mutex> lock(mutex_);
                        queue_.push(obj_ptr);
                      }))
                : data->emplace_back(std::shared_ptr<ObjectType>(
                      buffer[i], [&](ObjectType* obj_ptr) {
+                       OnRelease(1);
                        std::lock_guard<std::mutex> lock(mutex_);
                        queue_.push(obj_ptr);
                      }));
     }
 #else
     for (size_t i = 0; i < num; ++i) {
-      is_front
-          ? data->emplace_front(new ObjectType)
-          : data->emplace_back(new ObjectType);
+      auto deleter = [this](ObjectType* obj_ptr) {
+        OnRelease(1);
+        delete obj_ptr;
+      };
+      is_front ? data->emplace_front(new ObjectType, deleter)
+               : data->emplace_back(new ObjectType, deleter);
     }
 #endif
   }
@@ -199,6 +224,16 @@ class ConcurrentObjectPool : public BaseObjectPool<ObjectType> {
   // @brief get remained object number
   size_t RemainedNum() override { return queue_.size(); }
 #endif
+  // @brief occupancy metrics, updated on every get and release
+  size_t InUseNum() const {
+    return in_use_num_.load(std::memory_order_relaxed);
+  }
+  size_t PeakInUseNum() const {
+    return peak_in_use_num_.load(std::memory_order_relaxed);
+  }
+  uint64_t TotalGetNum() const {
+    return total_get_num_.load(std::memory_order_relaxed);
+  }
   // @brief destructor to release the cached memory
   ~ConcurrentObjectPool() override {
     if (cache_) {
@@ -234,6 +269,20 @@ class ConcurrentObjectPool : public BaseObjectPool<ObjectType> {
     capacity_ = kDefaultCacheSize;
 #endif
   }
+  // @brief account for num objects handed out, tracking the peak
+  void OnGet(size_t num) {
+    total_get_num_.fetch_add(num, std::memory_order_relaxed);
+    size_t in_use = in_use_num_.fetch_add(num, std::memory_order_relaxed) + num;
+    size_t peak = peak_in_use_num_.load(std::memory_order_relaxed);
+    while (in_use > peak && !peak_in_use_num_.compare_exchange_weak(
+                                peak, in_use, std::memory_order_relaxed)) {
+    }
+  }
+  // @brief account for num objects returned by their deleters
+  void OnRelease(size_t num) {
+    in_use_num_.fetch_sub(num, std::memory_order_relaxed);
+  }
+
   std::mutex mutex_;
   std::queue<ObjectType*> queue_;
   // @brief point to a continuous memory of default pool size
@@ -241,9 +290,17 @@ class ConcurrentObjectPool : public BaseObjectPool<ObjectType> {
   const size_t kDefaultCacheSize;
   // @brief list to store extended memory, not as efficient
   std::list<ObjectType*> extended_cache_;
+  // @brief occupancy counters, valid in both pooled and heap mode
+  std::atomic<size_t> in_use_num_{0};
+  std::atomic<size_t> peak_in_use_num_{0};
+  std::atomic<uint64_t> total_get_num_{0};
   static const Initializer kInitializer;
 };
 
+template <class ObjectType, size_t N, class Initializer>
+const Initializer ConcurrentObjectPool<ObjectType, N, Initializer>::
+    kInitializer;
+
 }  // namespace base
 }  // namespace perception
 }  // namespace apollo
@@ -0,0 +1,120 @@
+/******************************************************************************
+ * Copyright 2020 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+#include "modules/perception/base/gpu_memory_pool.h"
+
+#include "cyber/common/log.h"
+
+namespace apollo {
+namespace perception {
+namespace base {
+
+namespace {
+// Requests below the smallest bucket share one bucket, so tiny tensors do
+// not each occupy a free list.
+constexpr size_t kMinBucketSize = 512;
+}  // namespace
+
+GPUMemoryPool::GPUMemoryPool() {}
+
+size_t GPUMemoryPool::BucketSize(size_t size) {
+  size_t bucket = kMinBucketSize;
+  while (bucket < size) {
+    bucket <<= 1;
+  }
+  return bucket;
+}
+
+bool GPUMemoryPool::Alloc(size_t size, void** ptr) {
+  if (size == 0 || ptr == nullptr) {
+    return false;
+  }
+#ifndef PERCEPTION_CPU_ONLY
+  const size_t bucket = BucketSize(size);
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto& free_list = free_blocks_[bucket];
+  if (!free_list.empty()) {
+    *ptr = free_list.back();
+    free_list.pop_back();
+    ++stat_.hit_count;
+    stat_.cached_bytes -= bucket;
+  } else {
+    cudaError_t err = cudaMalloc(ptr, bucket);
+    if (err != cudaSuccess) {
+      // Fragmentation or true OOM: give the cache back and retry once.
+      for (auto& entry : free_blocks_) {
+        for (void* block : entry.second) {
+          BASE_CUDA_CHECK(cudaFree(block));
+          stat_.cached_bytes -= entry.first;
+        }
+        entry.second.clear();
+      }
+      cudaGetLastError();
+      BASE_CUDA_CHECK(cudaMalloc(ptr, bucket));
+    }
+    ++stat_.miss_count;
+  }
+  block_sizes_[*ptr] = bucket;
+  stat_.in_use_bytes += bucket;
+  return true;
+#else
+  NO_GPU;
+  return false;
+#endif
+}
+
+void GPUMemoryPool::Free(void* ptr) {
+  if (ptr == nullptr) {
+    return;
+  }
+#ifndef PERCEPTION_CPU_ONLY
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto itr = block_sizes_.find(ptr);
+  if (itr == block_sizes_.end()) {
+    AERROR << "Freeing block not owned by the pool: " << ptr;
+    BASE_CUDA_CHECK(cudaFree(ptr));
+    return;
+  }
+  const size_t bucket = itr->second;
+  block_sizes_.erase(itr);
+  free_blocks_[bucket].push_back(ptr);
+  stat_.in_use_bytes -= bucket;
+  stat_.cached_bytes += bucket;
+#else
+  NO_GPU;
+#endif
+}
+
+void GPUMemoryPool::Clear() {
+#ifndef PERCEPTION_CPU_ONLY
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (auto& entry : free_blocks_) {
+    for (void* block : entry.second) {
+      BASE_CUDA_CHECK(cudaFree(block));
+      stat_.cached_bytes -= entry.first;
+    }
+    entry.second.clear();
+  }
+#endif
+}
+
+GPUMemoryPool::Stat GPUMemoryPool::GetStat() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return stat_;
+}
+
+}  // namespace base
+}  // namespace perception
+}  // namespace apollo
@@ -0,0 +1,92 @@
+/******************************************************************************
+ * Copyright 2020 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+#pragma once
+
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "cyber/common/macros.h"
+#include "modules/perception/base/common.h"
+
+namespace apollo {
+namespace perception {
+namespace base {
+
+/**
+ * @brief Caching allocator for device memory, shared by all SyncedMemory
+ *        instances of the process.
+ *
+ * cudaMalloc/cudaFree synchronize the device and take multiple milliseconds
+ * under fragmentation, which shows up as pipeline stalls during warm-up and
+ * resolution switches. The pool rounds each request up to a power-of-two
+ * bucket and keeps freed blocks in per-bucket free lists, so steady-state
+ * inference is served entirely from the cache. Blocks must only be returned
+ * after the device work using them has completed; SyncedMemory satisfies
+ * this because it frees in its destructor.
+ */
+class GPUMemoryPool {
+ public:
+  /**
+   * @brief Statistics of the pool since process start.
+   */
+  struct Stat {
+    size_t hit_count = 0;       // allocations served from the cache
+    size_t miss_count = 0;      // allocations that hit cudaMalloc
+    size_t cached_bytes = 0;    // bytes currently sitting in free lists
+    size_t in_use_bytes = 0;    // bytes currently handed out
+  };
+
+  /**
+   * @brief Allocate at least size bytes of device memory.
+   * @return true on success, with *ptr set to the block.
+   */
+  bool Alloc(size_t size, void** ptr);
+
+  /**
+   * @brief Return a block obtained from Alloc to the pool. The caller must
+   *        guarantee that no device work on the block is still pending.
+   */
+  void Free(void* ptr);
+
+  /**
+   * @brief Release all cached blocks back to the CUDA allocator. Blocks in
+   *        use are unaffected.
+   */
+  void Clear();
+
+  /**
+   * @brief Get a snapshot of the pool statistics.
+   */
+  Stat GetStat();
+
+ private:
+  // Round size up to the bucket it is served from.
+  static size_t BucketSize(size_t size);
+
+  std::mutex mutex_;
+  // bucket size -> blocks of exactly that size available for reuse
+  std::unordered_map<size_t, std::vector<void*>> free_blocks_;
+  // live block -> its bucket size, needed to refile the block on Free
+  std::unordered_map<void*, size_t> block_sizes_;
+  Stat stat_;
+
+  DECLARE_SINGLETON(GPUMemoryPool)
+};
+
+}  // namespace base
+}  // namespace perception
+}  // namespace apollo
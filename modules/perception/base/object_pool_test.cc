@@ -252,6 +252,10 @@ TEST(ObjectPoolTest, concurrent_object_pool_initializer_test) {
     }
   }
 #endif
+// With the freelist enabled, the default no-op initializer hands back
+// recycled objects whose members keep their previous values, so the
+// default-constructed state can only be checked in heap mode.
+#ifdef PERCEPTION_BASE_DISABLE_POOL
   {
     typedef ConcurrentObjectPool<Object> TestObjectPool;
     std::shared_ptr<Object> ptr = TestObjectPool::Instance().Get();
@@ -280,6 +284,7 @@ TEST(ObjectPoolTest, concurrent_object_pool_initializer_test) {
       }
     }
   }
+#endif
 }
 
 TEST(ObjectPoolTest, light_object_pool_capacity_test) {
@@ -0,0 +1,152 @@
+/******************************************************************************
+ * Copyright 2020 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+#pragma once
+
+#include <utility>
+#include <vector>
+
+#include "Eigen/Dense"
+
+#include "modules/perception/base/point.h"
+#include "modules/perception/base/point_cloud.h"
+
+namespace apollo {
+namespace perception {
+namespace base {
+
+// @brief structure-of-arrays storage for point clouds. Each channel (x, y,
+// z, intensity) lives in its own contiguous, 16-byte aligned array, so SIMD
+// kernels in ground detection and cnnseg feature generation can use packed
+// loads instead of the strided access the AoS PointCloud forces. Converts
+// losslessly from and to PointCloud for the channels it stores; extra
+// attributes of richer point types (timestamp, height, ...) are not kept.
+template <class PointT>
+class SoAPointCloud {
+ public:
+  using PointType = PointT;
+  using Type = typename PointT::Type;
+  using ChannelType = std::vector<Type, Eigen::aligned_allocator<Type>>;
+
+  // @brief default constructor
+  SoAPointCloud() = default;
+
+  // @brief construct from an AoS point cloud
+  explicit SoAPointCloud(const PointCloud<PointT>& cloud) { CopyFrom(cloud); }
+
+  // @brief size accessors, wrappers of the channel vectors
+  inline size_t size() const { return x_.size(); }
+  inline bool empty() const { return x_.empty(); }
+  inline void reserve(size_t size) {
+    x_.reserve(size);
+    y_.reserve(size);
+    z_.reserve(size);
+    intensity_.reserve(size);
+  }
+  inline void resize(size_t size) {
+    x_.resize(size);
+    y_.resize(size);
+    z_.resize(size);
+    intensity_.resize(size);
+  }
+  inline void clear() {
+    x_.clear();
+    y_.clear();
+    z_.clear();
+    intensity_.clear();
+  }
+
+  // @brief append one point, scattering it across the channels
+  inline void push_back(const PointT& point) {
+    x_.push_back(point.x);
+    y_.push_back(point.y);
+    z_.push_back(point.z);
+    intensity_.push_back(point.intensity);
+  }
+
+  // @brief gather one point out of the channels
+  inline PointT at(size_t n) const {
+    PointT point;
+    point.x = x_[n];
+    point.y = y_[n];
+    point.z = z_[n];
+    point.intensity = intensity_[n];
+    return point;
+  }
+  inline PointT operator[](size_t n) const { return at(n); }
+
+  // @brief scatter one point into the channels
+  inline void set(size_t n, const PointT& point) {
+    x_[n] = point.x;
+    y_[n] = point.y;
+    z_[n] = point.z;
+    intensity_[n] = point.intensity;
+  }
+
+  // @brief rebuild the channels from an AoS point cloud
+  void CopyFrom(const PointCloud<PointT>& cloud) {
+    resize(cloud.size());
+    for (size_t i = 0; i < cloud.size(); ++i) {
+      const PointT& point = cloud[i];
+      x_[i] = point.x;
+      y_[i] = point.y;
+      z_[i] = point.z;
+      intensity_[i] = point.intensity;
+    }
+  }
+
+  // @brief write the stored channels back into an AoS point cloud
+  void CopyTo(PointCloud<PointT>* cloud) const {
+    cloud->resize(size());
+    for (size_t i = 0; i < size(); ++i) {
+      PointT& point = cloud->at(i);
+      point.x = x_[i];
+      point.y = y_[i];
+      point.z = z_[i];
+      point.intensity = intensity_[i];
+    }
+  }
+
+  // @brief contiguous channel accessors for SIMD kernels
+  inline const Type* x_data() const { return x_.data(); }
+  inline Type* mutable_x_data() { return x_.data(); }
+  inline const Type* y_data() const { return y_.data(); }
+  inline Type* mutable_y_data() { return y_.data(); }
+  inline const Type* z_data() const { return z_.data(); }
+  inline Type* mutable_z_data() { return z_.data(); }
+  inline const Type* intensity_data() const { return intensity_.data(); }
+  inline Type* mutable_intensity_data() { return intensity_.data(); }
+
+  // @brief swap with another SoA cloud
+  inline void SwapPointCloud(SoAPointCloud<PointT>* rhs) {
+    x_.swap(rhs->x_);
+    y_.swap(rhs->y_);
+    z_.swap(rhs->z_);
+    intensity_.swap(rhs->intensity_);
+  }
+
+ protected:
+  ChannelType x_;
+  ChannelType y_;
+  ChannelType z_;
+  ChannelType intensity_;
+};
+
+using SoAPointFCloud = SoAPointCloud<PointF>;
+using SoAPointDCloud = SoAPointCloud<PointD>;
+
+}  // namespace base
+}  // namespace perception
+}  // namespace apollo
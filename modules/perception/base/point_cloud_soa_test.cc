@@ -0,0 +1,93 @@
+/******************************************************************************
+ * Copyright 2020 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "modules/perception/base/point_cloud_soa.h"
+
+#include "gtest/gtest.h"
+
+namespace apollo {
+namespace perception {
+namespace base {
+
+TEST(SoAPointCloudTest, basic_test) {
+  SoAPointFCloud cloud;
+  EXPECT_TRUE(cloud.empty());
+  cloud.reserve(4);
+  for (size_t i = 0; i < 4; ++i) {
+    PointF point;
+    point.x = static_cast<float>(i);
+    point.y = static_cast<float>(i) * 2.f;
+    point.z = static_cast<float>(i) * 3.f;
+    point.intensity = static_cast<float>(i) * 4.f;
+    cloud.push_back(point);
+  }
+  EXPECT_EQ(cloud.size(), 4u);
+  EXPECT_FALSE(cloud.empty());
+  for (size_t i = 0; i < cloud.size(); ++i) {
+    PointF point = cloud[i];
+    EXPECT_FLOAT_EQ(point.x, static_cast<float>(i));
+    EXPECT_FLOAT_EQ(point.y, static_cast<float>(i) * 2.f);
+    EXPECT_FLOAT_EQ(point.z, static_cast<float>(i) * 3.f);
+    EXPECT_FLOAT_EQ(point.intensity, static_cast<float>(i) * 4.f);
+  }
+  PointF point;
+  point.x = 10.f;
+  cloud.set(0, point);
+  EXPECT_FLOAT_EQ(cloud.at(0).x, 10.f);
+  cloud.clear();
+  EXPECT_TRUE(cloud.empty());
+}
+
+TEST(SoAPointCloudTest, channel_alignment_test) {
+  SoAPointFCloud cloud;
+  cloud.resize(16);
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(cloud.x_data()) % 16, 0u);
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(cloud.y_data()) % 16, 0u);
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(cloud.z_data()) % 16, 0u);
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(cloud.intensity_data()) % 16, 0u);
+  cloud.mutable_x_data()[3] = 7.f;
+  EXPECT_FLOAT_EQ(cloud.at(3).x, 7.f);
+}
+
+TEST(SoAPointCloudTest, conversion_test) {
+  PointFCloud aos_cloud;
+  for (size_t i = 0; i < 8; ++i) {
+    PointF point;
+    point.x = static_cast<float>(i);
+    point.y = -static_cast<float>(i);
+    point.z = static_cast<float>(i) * 0.5f;
+    point.intensity = 1.f;
+    aos_cloud.push_back(point);
+  }
+  SoAPointFCloud soa_cloud(aos_cloud);
+  EXPECT_EQ(soa_cloud.size(), aos_cloud.size());
+  for (size_t i = 0; i < soa_cloud.size(); ++i) {
+    EXPECT_FLOAT_EQ(soa_cloud.at(i).x, aos_cloud[i].x);
+    EXPECT_FLOAT_EQ(soa_cloud.at(i).y, aos_cloud[i].y);
+    EXPECT_FLOAT_EQ(soa_cloud.at(i).z, aos_cloud[i].z);
+  }
+  PointFCloud back_cloud;
+  soa_cloud.CopyTo(&back_cloud);
+  EXPECT_EQ(back_cloud.size(), aos_cloud.size());
+  for (size_t i = 0; i < back_cloud.size(); ++i) {
+    EXPECT_FLOAT_EQ(back_cloud[i].x, aos_cloud[i].x);
+    EXPECT_FLOAT_EQ(back_cloud[i].intensity, aos_cloud[i].intensity);
+  }
+}
+
+}  // namespace base
+}  // namespace perception
+}  // namespace apollo
@@ -62,10 +62,69 @@ license and copyright terms herein.
  *****************************************************************************/
 #include "modules/perception/base/syncedmem.h"
 
+#include <sstream>
+
+#include "modules/perception/base/gpu_memory_pool.h"
+
 namespace apollo {
 namespace perception {
 namespace base {
 
+namespace {
+// innermost SyncedMemoryTraceScope tag of the calling thread
+thread_local const char* g_trace_tag = "untagged";
+}  // namespace
+
+SyncedMemoryStats::SyncedMemoryStats() {}
+
+void SyncedMemoryStats::RecordSyncTransfer(bool host_to_device, size_t bytes) {
+  if (!enabled()) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  Counters& counters = counters_[g_trace_tag];
+  if (host_to_device) {
+    ++counters.sync_h2d_count;
+    counters.sync_h2d_bytes += bytes;
+  } else {
+    ++counters.sync_d2h_count;
+    counters.sync_d2h_bytes += bytes;
+  }
+}
+
+std::map<std::string, SyncedMemoryStats::Counters>
+SyncedMemoryStats::GetCounters() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return counters_;
+}
+
+void SyncedMemoryStats::Reset() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  counters_.clear();
+}
+
+std::string SyncedMemoryStats::Summary() {
+  std::ostringstream oss;
+  oss << "SyncedMemory forced synchronous transfers:";
+  for (const auto& entry : GetCounters()) {
+    const Counters& counters = entry.second;
+    oss << "\n  " << entry.first << ": h2d " << counters.sync_h2d_count
+        << " (" << counters.sync_h2d_bytes << " bytes), d2h "
+        << counters.sync_d2h_count << " (" << counters.sync_d2h_bytes
+        << " bytes)";
+  }
+  return oss.str();
+}
+
+SyncedMemoryTraceScope::SyncedMemoryTraceScope(const char* tag)
+    : previous_tag_(g_trace_tag) {
+  g_trace_tag = tag;
+}
+
+SyncedMemoryTraceScope::~SyncedMemoryTraceScope() {
+  g_trace_tag = previous_tag_;
+}
+
 SyncedMemory::SyncedMemory(bool use_cuda)
     : cpu_ptr_(NULL),
       gpu_ptr_(NULL),
@@ -106,7 +165,7 @@ SyncedMemory::~SyncedMemory() {
 
 #ifndef PERCEPTION_CPU_ONLY
   if (gpu_ptr_ && own_gpu_data_) {
-    BASE_CUDA_CHECK(cudaFree(gpu_ptr_));
+    GPUMemoryPool::Instance()->Free(gpu_ptr_);
   }
 #endif  // PERCEPTION_CPU_ONLY
 }
@@ -131,6 +190,7 @@ inline void SyncedMemory::to_cpu() {
         own_cpu_data_ = true;
       }
       BASE_CUDA_CHECK(cudaMemcpy(cpu_ptr_, gpu_ptr_, size_, cudaMemcpyDefault));
+      SyncedMemoryStats::Instance()->RecordSyncTransfer(false, size_);
       head_ = SYNCED;
 #else
       NO_GPU;
@@ -147,17 +207,18 @@ inline void SyncedMemory::to_gpu() {
 #ifndef PERCEPTION_CPU_ONLY
   switch (head_) {
     case UNINITIALIZED:
-      BASE_CUDA_CHECK(cudaMalloc(&gpu_ptr_, size_));
+      GPUMemoryPool::Instance()->Alloc(size_, &gpu_ptr_);
       BASE_CUDA_CHECK(cudaMemset(gpu_ptr_, 0, size_));
       head_ = HEAD_AT_GPU;
       own_gpu_data_ = true;
       break;
     case HEAD_AT_CPU:
       if (gpu_ptr_ == nullptr) {
-        BASE_CUDA_CHECK(cudaMalloc(&gpu_ptr_, size_));
+        GPUMemoryPool::Instance()->Alloc(size_, &gpu_ptr_);
         own_gpu_data_ = true;
       }
       BASE_CUDA_CHECK(cudaMemcpy(gpu_ptr_, cpu_ptr_, size_, cudaMemcpyDefault));
+      SyncedMemoryStats::Instance()->RecordSyncTransfer(true, size_);
       head_ = SYNCED;
       break;
     case HEAD_AT_GPU:
@@ -202,7 +263,7 @@ void SyncedMemory::set_gpu_data(void* data) {
 #ifndef PERCEPTION_CPU_ONLY
   ACHECK(data);
   if (own_gpu_data_) {
-    BASE_CUDA_CHECK(cudaFree(gpu_ptr_));
+    GPUMemoryPool::Instance()->Free(gpu_ptr_);
   }
   gpu_ptr_ = data;
   head_ = HEAD_AT_GPU;
@@ -236,7 +297,7 @@ void SyncedMemory::async_gpu_push(const cudaStream_t& stream) {
   check_device();
   CHECK_EQ(head_, HEAD_AT_CPU);
   if (gpu_ptr_ == nullptr) {
-    BASE_CUDA_CHECK(cudaMalloc(&gpu_ptr_, size_));
+    GPUMemoryPool::Instance()->Alloc(size_, &gpu_ptr_);
     own_gpu_data_ = true;
   }
   const cudaMemcpyKind put = cudaMemcpyHostToDevice;
@@ -244,6 +305,19 @@ void SyncedMemory::async_gpu_push(const cudaStream_t& stream) {
   // Assume caller will synchronize on the stream before use
   head_ = SYNCED;
 }
+
+void SyncedMemory::async_cpu_pull(const cudaStream_t& stream) {
+  check_device();
+  CHECK_EQ(head_, HEAD_AT_GPU);
+  if (cpu_ptr_ == nullptr) {
+    PerceptionMallocHost(&cpu_ptr_, size_, cpu_malloc_use_cuda_);
+    own_cpu_data_ = true;
+  }
+  const cudaMemcpyKind get = cudaMemcpyDeviceToHost;
+  BASE_CUDA_CHECK(cudaMemcpyAsync(cpu_ptr_, gpu_ptr_, size_, get, stream));
+  // Assume caller will synchronize on the stream before use
+  head_ = SYNCED;
+}
 #endif
 
 void SyncedMemory::check_device() {
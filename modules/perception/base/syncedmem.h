@@ -62,13 +62,85 @@ license and copyright terms herein.
  *****************************************************************************/
 #pragma once
 
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <string>
+
 #include "cyber/common/log.h"
+#include "cyber/common/macros.h"
 #include "modules/perception/base/common.h"
 
 namespace apollo {
 namespace perception {
 namespace base {
 
+/**
+ * @brief Process-wide accounting of SyncedMemory transfers, keyed by the
+ *        pipeline stage named through SyncedMemoryTraceScope.
+ *
+ * Synchronous transfers triggered lazily from cpu_data()/gpu_data() block
+ * the calling thread, so knowing which stage forces them tells where an
+ * async prefetch hint would pay off. Recording is off by default and is a
+ * single relaxed atomic load on the transfer path when disabled.
+ */
+class SyncedMemoryStats {
+ public:
+  struct Counters {
+    uint64_t sync_h2d_count = 0;
+    uint64_t sync_h2d_bytes = 0;
+    uint64_t sync_d2h_count = 0;
+    uint64_t sync_d2h_bytes = 0;
+  };
+
+  void set_enabled(bool enabled) {
+    enabled_.store(enabled, std::memory_order_relaxed);
+  }
+  bool enabled() const { return enabled_.load(std::memory_order_relaxed); }
+
+  /**
+   * @brief Record one synchronous transfer under the current trace tag.
+   *        Called by SyncedMemory, no-op unless enabled.
+   */
+  void RecordSyncTransfer(bool host_to_device, size_t bytes);
+
+  /**
+   * @brief Get a snapshot of the counters per trace tag.
+   */
+  std::map<std::string, Counters> GetCounters();
+
+  void Reset();
+
+  /**
+   * @brief Human readable per-tag summary for logging.
+   */
+  std::string Summary();
+
+ private:
+  std::atomic<bool> enabled_{false};
+  std::mutex mutex_;
+  std::map<std::string, Counters> counters_;
+
+  DECLARE_SINGLETON(SyncedMemoryStats)
+};  // class SyncedMemoryStats
+
+/**
+ * @brief RAII scope naming the pipeline stage for transfer accounting,
+ *        e.g. SyncedMemoryTraceScope scope("camera_preprocess");
+ *        Scopes nest per thread, the innermost tag wins.
+ */
+class SyncedMemoryTraceScope {
+ public:
+  explicit SyncedMemoryTraceScope(const char* tag);
+  ~SyncedMemoryTraceScope();
+
+  SyncedMemoryTraceScope(const SyncedMemoryTraceScope&) = delete;
+  void operator=(const SyncedMemoryTraceScope&) = delete;
+
+ private:
+  const char* previous_tag_;
+};  // class SyncedMemoryTraceScope
+
 inline void PerceptionMallocHost(void** ptr, size_t size, bool use_cuda) {
 #ifndef PERCEPTION_CPU_ONLY
   if (use_cuda) {
@@ -121,6 +193,10 @@ class SyncedMemory {
 
 #ifndef PERCEPTION_CPU_ONLY
   void async_gpu_push(const cudaStream_t& stream);
+  // @brief hint that the data is next needed on the host; issues the
+  //        device to host copy on the given stream so it overlaps other
+  //        work, the caller synchronizes the stream before reading
+  void async_cpu_pull(const cudaStream_t& stream);
 #endif
 
  private:
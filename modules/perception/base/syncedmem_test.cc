@@ -202,6 +202,30 @@ TEST_F(SyncedMemoryTest, TestGPUWrite) {
 
 #endif
 
+TEST_F(SyncedMemoryTest, transfer_stats_test) {
+  SyncedMemoryStats* stats = SyncedMemoryStats::Instance();
+  stats->Reset();
+  // disabled by default, records are dropped
+  stats->RecordSyncTransfer(true, 100);
+  EXPECT_TRUE(stats->GetCounters().empty());
+
+  stats->set_enabled(true);
+  stats->RecordSyncTransfer(true, 100);
+  {
+    SyncedMemoryTraceScope scope("camera_preprocess");
+    stats->RecordSyncTransfer(false, 50);
+    stats->RecordSyncTransfer(false, 50);
+  }
+  auto counters = stats->GetCounters();
+  EXPECT_EQ(counters["untagged"].sync_h2d_count, 1u);
+  EXPECT_EQ(counters["untagged"].sync_h2d_bytes, 100u);
+  EXPECT_EQ(counters["camera_preprocess"].sync_d2h_count, 2u);
+  EXPECT_EQ(counters["camera_preprocess"].sync_d2h_bytes, 100u);
+  EXPECT_FALSE(stats->Summary().empty());
+  stats->set_enabled(false);
+  stats->Reset();
+}
+
 }  // namespace base
 }  // namespace perception
 }  // namespace apollo
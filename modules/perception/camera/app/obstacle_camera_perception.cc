@@ -15,6 +15,8 @@
  *****************************************************************************/
 #include "modules/perception/camera/app/obstacle_camera_perception.h"
 
+#include <future>
+#include <sstream>
 #include <utility>
 
 #include "absl/strings/str_cat.h"
@@ -306,6 +308,40 @@ bool ObstacleCameraPerception::GetCalibrationService(
   return true;
 }
 
+void ObstacleCameraPerception::RecordStageLatency(
+    const std::string &stage,
+    std::chrono::steady_clock::time_point *stage_start) {
+  auto now = std::chrono::steady_clock::now();
+  uint64_t ms = static_cast<uint64_t>(
+      std::chrono::duration_cast<std::chrono::milliseconds>(now - *stage_start)
+          .count());
+  *stage_start = now;
+  std::lock_guard<std::mutex> lock(latency_mutex_);
+  StageLatency &latency = stage_latency_map_[stage];
+  latency.sum_ms += ms;
+  if (ms > latency.max_ms) {
+    latency.max_ms = ms;
+  }
+  ++latency.count;
+}
+
+void ObstacleCameraPerception::ReportPipelineLatency() {
+  std::lock_guard<std::mutex> lock(latency_mutex_);
+  std::stringstream ss;
+  ss << "camera pipeline stage latency, last " << kLatencyReportInterval
+     << " frames:";
+  for (const auto &entry : stage_latency_map_) {
+    const StageLatency &latency = entry.second;
+    if (latency.count == 0) {
+      continue;
+    }
+    ss << " " << entry.first << " avg:" << latency.sum_ms / latency.count
+       << "ms max:" << latency.max_ms << "ms";
+  }
+  AINFO << ss.str();
+  stage_latency_map_.clear();
+}
+
 bool ObstacleCameraPerception::Perception(
     const CameraPerceptionOptions &options, CameraFrame *frame) {
   PERCEPTION_PERF_FUNCTION();
@@ -323,53 +359,79 @@ bool ObstacleCameraPerception::Perception(
     return false;
   }
 
-  LaneDetectorOptions lane_detetor_options;
-  LanePostprocessorOptions lane_postprocessor_options;
-  if (!lane_detector_->Detect(lane_detetor_options, frame)) {
-    AERROR << "Failed to detect lane.";
-    return false;
-  }
-  PERCEPTION_PERF_BLOCK_END_WITH_INDICATOR(frame->data_provider->sensor_name(),
-                                           "LaneDetector");
-
-  if (!lane_postprocessor_->Process2D(lane_postprocessor_options, frame)) {
-    AERROR << "Failed to postprocess lane 2D.";
-    return false;
-  }
-  PERCEPTION_PERF_BLOCK_END_WITH_INDICATOR(frame->data_provider->sensor_name(),
-                                           "LanePostprocessor2D");
-
-  // Calibration service
-  frame->calibration_service->Update(frame);
-  PERCEPTION_PERF_BLOCK_END_WITH_INDICATOR(frame->data_provider->sensor_name(),
-                                           "CalibrationService");
-
-  if (!lane_postprocessor_->Process3D(lane_postprocessor_options, frame)) {
-    AERROR << "Failed to postprocess lane 3D.";
-    return false;
-  }
-  PERCEPTION_PERF_BLOCK_END_WITH_INDICATOR(frame->data_provider->sensor_name(),
-                                           "LanePostprocessor3D");
-
-  if (write_out_lane_file_) {
-    std::string lane_file_path =
-        absl::StrCat(out_lane_dir_, "/", frame->frame_id, ".txt");
-    WriteLanelines(write_out_lane_file_, lane_file_path, frame->lane_objects);
-  }
-
-  if (write_out_calib_file_) {
-    std::string calib_file_path =
-        absl::StrCat(out_calib_dir_, "/", frame->frame_id, ".txt");
-    WriteCalibrationOutput(write_out_calib_file_, calib_file_path, frame);
-  }
-
+  // Materialize the color images both branches read before forking, the
+  // data provider converts them lazily and is not thread safe
+  frame->data_provider->to_bgr_image();
+  frame->data_provider->to_rgb_image();
+
+  // The lane branch and the obstacle branch are independent until
+  // Associate2D, and the lane and obstacle detectors each own a CUDA
+  // stream, so running the lane branch on a side thread keeps both
+  // streams busy instead of serializing the two networks
+  std::future<bool> lane_future =
+      std::async(std::launch::async, [&]() -> bool {
+        inference::CudaUtil::set_device_id(perception_param_.gpu_id());
+        auto lane_start = std::chrono::steady_clock::now();
+        PERCEPTION_PERF_BLOCK_START();
+        LaneDetectorOptions lane_detetor_options;
+        LanePostprocessorOptions lane_postprocessor_options;
+        if (!lane_detector_->Detect(lane_detetor_options, frame)) {
+          AERROR << "Failed to detect lane.";
+          return false;
+        }
+        PERCEPTION_PERF_BLOCK_END_WITH_INDICATOR(
+            frame->data_provider->sensor_name(), "LaneDetector");
+        RecordStageLatency("LaneDetector", &lane_start);
+
+        if (!lane_postprocessor_->Process2D(lane_postprocessor_options,
+                                            frame)) {
+          AERROR << "Failed to postprocess lane 2D.";
+          return false;
+        }
+        PERCEPTION_PERF_BLOCK_END_WITH_INDICATOR(
+            frame->data_provider->sensor_name(), "LanePostprocessor2D");
+        RecordStageLatency("LanePostprocessor2D", &lane_start);
+
+        // Calibration service
+        frame->calibration_service->Update(frame);
+        PERCEPTION_PERF_BLOCK_END_WITH_INDICATOR(
+            frame->data_provider->sensor_name(), "CalibrationService");
+        RecordStageLatency("CalibrationService", &lane_start);
+
+        if (!lane_postprocessor_->Process3D(lane_postprocessor_options,
+                                            frame)) {
+          AERROR << "Failed to postprocess lane 3D.";
+          return false;
+        }
+        PERCEPTION_PERF_BLOCK_END_WITH_INDICATOR(
+            frame->data_provider->sensor_name(), "LanePostprocessor3D");
+        RecordStageLatency("LanePostprocessor3D", &lane_start);
+
+        if (write_out_lane_file_) {
+          std::string lane_file_path =
+              absl::StrCat(out_lane_dir_, "/", frame->frame_id, ".txt");
+          WriteLanelines(write_out_lane_file_, lane_file_path,
+                         frame->lane_objects);
+        }
+
+        if (write_out_calib_file_) {
+          std::string calib_file_path =
+              absl::StrCat(out_calib_dir_, "/", frame->frame_id, ".txt");
+          WriteCalibrationOutput(write_out_calib_file_, calib_file_path, frame);
+        }
+        return true;
+      });
+
+  auto stage_start = std::chrono::steady_clock::now();
   // Obstacle prediction
   if (!tracker_->Predict(tracker_options, frame)) {
     AERROR << "Failed to predict.";
+    // the future's destructor joins the lane branch on early returns
     return false;
   }
   PERCEPTION_PERF_BLOCK_END_WITH_INDICATOR(frame->data_provider->sensor_name(),
                                            "Predict");
+  RecordStageLatency("Predict", &stage_start);
 
   std::shared_ptr<BaseObstacleDetector> detector =
       name_detector_map_.at(frame->data_provider->sensor_name());
@@ -380,6 +442,7 @@ bool ObstacleCameraPerception::Perception(
   }
   PERCEPTION_PERF_BLOCK_END_WITH_INDICATOR(frame->data_provider->sensor_name(),
                                            "detect");
+  RecordStageLatency("detect", &stage_start);
 
   // Save all detections results as kitti format
   WriteDetections(
@@ -393,6 +456,7 @@ bool ObstacleCameraPerception::Perception(
   }
   PERCEPTION_PERF_BLOCK_END_WITH_INDICATOR(frame->data_provider->sensor_name(),
                                            "external_feature");
+  RecordStageLatency("external_feature", &stage_start);
 
   // Save detection results with bbox, detection_feature
   WriteDetections(
@@ -405,12 +469,19 @@ bool ObstacleCameraPerception::Perception(
     frame->detected_objects[i]->camera_supplement.sensor_name =
         frame->data_provider->sensor_name();
   }
+  // Associate2D and everything after it reads lane and calibration
+  // results, join the lane branch here
+  if (!lane_future.get()) {
+    return false;
+  }
+  stage_start = std::chrono::steady_clock::now();
   if (!tracker_->Associate2D(tracker_options, frame)) {
     AERROR << "Failed to associate2d.";
     return false;
   }
   PERCEPTION_PERF_BLOCK_END_WITH_INDICATOR(frame->data_provider->sensor_name(),
                                            "Associate2D");
+  RecordStageLatency("Associate2D", &stage_start);
 
   if (!transformer_->Transform(transformer_options, frame)) {
     AERROR << "Failed to transform.";
@@ -418,6 +489,7 @@ bool ObstacleCameraPerception::Perception(
   }
   PERCEPTION_PERF_BLOCK_END_WITH_INDICATOR(frame->data_provider->sensor_name(),
                                            "Transform");
+  RecordStageLatency("Transform", &stage_start);
 
   // Obstacle postprocessor
   obstacle_postprocessor_options.do_refinement_with_calibration_service =
@@ -429,6 +501,7 @@ bool ObstacleCameraPerception::Perception(
   }
   PERCEPTION_PERF_BLOCK_END_WITH_INDICATOR(frame->data_provider->sensor_name(),
                                            "PostprocessObsacle");
+  RecordStageLatency("PostprocessObsacle", &stage_start);
 
   if (!tracker_->Associate3D(tracker_options, frame)) {
     AERROR << "Failed to Associate3D.";
@@ -436,6 +509,7 @@ bool ObstacleCameraPerception::Perception(
   }
   PERCEPTION_PERF_BLOCK_END_WITH_INDICATOR(frame->data_provider->sensor_name(),
                                            "Associate3D");
+  RecordStageLatency("Associate3D", &stage_start);
 
   if (!tracker_->Track(tracker_options, frame)) {
     AERROR << "Failed to track.";
@@ -443,6 +517,7 @@ bool ObstacleCameraPerception::Perception(
   }
   PERCEPTION_PERF_BLOCK_END_WITH_INDICATOR(frame->data_provider->sensor_name(),
                                            "Track");
+  RecordStageLatency("Track", &stage_start);
 
   if (perception_param_.has_debug_param()) {
     if (perception_param_.debug_param().has_camera2world_out_file()) {
@@ -465,6 +540,10 @@ bool ObstacleCameraPerception::Perception(
     obj->anchor_point = obj->center;
   }
 
+  ++latency_frame_count_;
+  if (latency_frame_count_ % kLatencyReportInterval == 0) {
+    ReportPipelineLatency();
+  }
   return true;
 }
 }  // namespace camera
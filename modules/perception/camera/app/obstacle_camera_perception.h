@@ -15,9 +15,11 @@
  *****************************************************************************/
 #pragma once
 
+#include <chrono>
 #include <fstream>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 
 #include "modules/perception/camera/app/proto/perception.pb.h"
@@ -70,6 +72,24 @@ class ObstacleCameraPerception : public BaseCameraPerception {
   std::string Name() const override { return "ObstacleCameraPerception"; }
 
  private:
+  // accumulated wall time per pipeline stage, reported every
+  // kLatencyReportInterval frames
+  struct StageLatency {
+    uint64_t sum_ms = 0;
+    uint64_t max_ms = 0;
+    uint64_t count = 0;
+  };
+  // record the time since *stage_start under the stage name and restart
+  // *stage_start, safe to call from the lane branch thread
+  void RecordStageLatency(const std::string &stage,
+                          std::chrono::steady_clock::time_point *stage_start);
+  void ReportPipelineLatency();
+
+ private:
+  static constexpr int kLatencyReportInterval = 100;
+  std::mutex latency_mutex_;
+  std::map<std::string, StageLatency> stage_latency_map_;
+  int latency_frame_count_ = 0;
   std::map<std::string, Eigen::Matrix3f> name_intrinsic_map_;
   std::map<std::string, std::shared_ptr<BaseObstacleDetector>>
       name_detector_map_;
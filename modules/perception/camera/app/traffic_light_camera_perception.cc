@@ -15,9 +15,12 @@
  *****************************************************************************/
 #include "modules/perception/camera/app/traffic_light_camera_perception.h"
 
+#include <cstdlib>
+
 #include "cyber/common/file.h"
 #include "cyber/common/log.h"
 #include "modules/perception/camera/common/util.h"
+#include "modules/perception/common/perception_gflags.h"
 #include "modules/perception/camera/lib/traffic_light/detector/detection/detection.h"
 #include "modules/perception/camera/lib/traffic_light/detector/recognition/recognition.h"
 #include "modules/perception/camera/lib/traffic_light/tracker/semantic_decision.h"
@@ -92,10 +95,18 @@ bool TrafficLightCameraPerception::Perception(
     const CameraPerceptionOptions &options, CameraFrame *frame) {
   PERCEPTION_PERF_FUNCTION();
   PERCEPTION_PERF_BLOCK_START();
-  TrafficLightDetectorOptions detector_options;
-  if (!detector_->Detect(detector_options, frame)) {
-    AERROR << "tl failed to detect.";
-    return false;
+  bool run_detector = true;
+  if (FLAGS_tl_temporal_tracking) {
+    run_detector = !ApplyTrackedDetections(frame);
+  }
+  if (run_detector) {
+    TrafficLightDetectorOptions detector_options;
+    if (!detector_->Detect(detector_options, frame)) {
+      AERROR << "tl failed to detect.";
+      return false;
+    }
+  } else {
+    ADEBUG << "tl detector skipped, reused tracked rois.";
   }
   const auto traffic_light_detect_time =
       PERCEPTION_PERF_BLOCK_END_WITH_INDICATOR(
@@ -110,6 +121,10 @@ bool TrafficLightCameraPerception::Perception(
       PERCEPTION_PERF_BLOCK_END_WITH_INDICATOR(
           frame->data_provider->sensor_name(), "traffic_light_recognize");
 
+  if (FLAGS_tl_temporal_tracking) {
+    UpdateTrackedDetections(*frame, run_detector);
+  }
+
   TrafficLightTrackerOptions tracker_options;
   if (!tracker_->Track(tracker_options, frame)) {
     AERROR << "tl failed to track.";
@@ -127,6 +142,88 @@ bool TrafficLightCameraPerception::Perception(
   return true;
 }
 
+bool TrafficLightCameraPerception::ApplyTrackedDetections(CameraFrame *frame) {
+  if (frames_since_detection_ + 1 >= FLAGS_tl_detection_duty_cycle) {
+    return false;
+  }
+  if (frame->traffic_lights.empty() || tracked_lights_.empty()) {
+    return false;
+  }
+  // First pass: every projected light must have a confident cached
+  // detection whose projection has not shifted too far, otherwise run the
+  // full detector.
+  for (const auto &light : frame->traffic_lights) {
+    if (light->region.outside_image) {
+      return false;
+    }
+    const auto it = tracked_lights_.find(light->id);
+    if (it == tracked_lights_.end()) {
+      return false;
+    }
+    const TrackedLight &tracked = it->second;
+    if (tracked.confidence < FLAGS_tl_track_min_confidence) {
+      return false;
+    }
+    const base::RectI &proj = light->region.projection_roi;
+    const base::RectI &cached_proj = tracked.projection_roi;
+    const int shift_x = (proj.x + proj.width / 2) -
+                        (cached_proj.x + cached_proj.width / 2);
+    const int shift_y = (proj.y + proj.height / 2) -
+                        (cached_proj.y + cached_proj.height / 2);
+    if (std::abs(shift_x) > FLAGS_tl_track_max_projection_shift ||
+        std::abs(shift_y) > FLAGS_tl_track_max_projection_shift) {
+      return false;
+    }
+  }
+  // Second pass: transfer the cached boxes, translated by the projection
+  // shift, so the recognizer refreshes the color on the reused rois.
+  for (auto &light : frame->traffic_lights) {
+    const TrackedLight &tracked = tracked_lights_.at(light->id);
+    const base::RectI &proj = light->region.projection_roi;
+    const base::RectI &cached_proj = tracked.projection_roi;
+    light->region.detection_roi = tracked.detection_roi;
+    light->region.detection_roi.x += (proj.x + proj.width / 2) -
+                                     (cached_proj.x + cached_proj.width / 2);
+    light->region.detection_roi.y += (proj.y + proj.height / 2) -
+                                     (cached_proj.y + cached_proj.height / 2);
+    light->region.is_detected = true;
+    light->region.is_selected = true;
+    light->region.detect_class_id = tracked.detect_class_id;
+    light->region.detect_score = tracked.detect_score;
+  }
+  return true;
+}
+
+void TrafficLightCameraPerception::UpdateTrackedDetections(
+    const CameraFrame &frame, bool detected) {
+  if (detected) {
+    frames_since_detection_ = 0;
+    tracked_lights_.clear();
+    for (const auto &light : frame.traffic_lights) {
+      if (!light->region.is_detected || !light->region.is_selected) {
+        continue;
+      }
+      TrackedLight tracked;
+      tracked.detection_roi = light->region.detection_roi;
+      tracked.projection_roi = light->region.projection_roi;
+      tracked.detect_class_id = light->region.detect_class_id;
+      tracked.detect_score = light->region.detect_score;
+      tracked.confidence = light->status.confidence;
+      tracked_lights_[light->id] = tracked;
+    }
+    return;
+  }
+  // Skipped frame: keep the detection-time anchors, but let the latest
+  // recognition confidence decide whether the next frame may skip too.
+  ++frames_since_detection_;
+  for (const auto &light : frame.traffic_lights) {
+    auto it = tracked_lights_.find(light->id);
+    if (it != tracked_lights_.end()) {
+      it->second.confidence = light->status.confidence;
+    }
+  }
+}
+
 }  // namespace camera
 }  // namespace perception
 }  // namespace apollo
@@ -17,6 +17,7 @@
 
 #include <memory>
 #include <string>
+#include <unordered_map>
 
 #include "modules/perception/camera/app/proto/perception.pb.h"
 #include "modules/perception/camera/common/camera_frame.h"
@@ -41,10 +42,32 @@ class TrafficLightCameraPerception : public BaseCameraPerception {
   std::string Name() const override { return "TrafficLightCameraPerception"; }
 
  private:
+  // Detection state cached for temporal ROI reuse
+  // (FLAGS_tl_temporal_tracking), keyed by light id in tracked_lights_.
+  struct TrackedLight {
+    base::RectI detection_roi;
+    base::RectI projection_roi;
+    base::TLDetectionClass detect_class_id =
+        base::TLDetectionClass::TL_UNKNOWN_CLASS;
+    float detect_score = 0.0f;
+    double confidence = 0.0;
+  };
+
+  // @brief: transfer the cached detections onto the current frame when the
+  // duty cycle, confidence and projection shift allow skipping the detector.
+  // @return: true if the detector can be skipped for this frame.
+  bool ApplyTrackedDetections(CameraFrame *frame);
+
+  // @brief: refresh the cache after detection/recognition; rebuilds it on
+  // detection frames and only updates confidences on skipped frames.
+  void UpdateTrackedDetections(const CameraFrame &frame, bool detected);
+
   std::shared_ptr<BaseTrafficLightDetector> detector_;
   std::shared_ptr<BaseTrafficLightDetector> recognizer_;
   std::shared_ptr<BaseTrafficLightTracker> tracker_;
   app::TrafficLightParam tl_param_;
+  std::unordered_map<std::string, TrackedLight> tracked_lights_;
+  int frames_since_detection_ = 0;
 };
 
 }  // namespace camera
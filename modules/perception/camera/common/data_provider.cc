@@ -18,6 +18,7 @@
 #include <nppi.h>
 
 #include "cyber/common/log.h"
+#include "modules/perception/camera/common/image_preprocess.h"
 
 namespace apollo {
 namespace perception {
@@ -142,6 +143,10 @@ bool DataProvider::FillImageData(int rows, int cols, const uint8_t *data,
     memcpy(gray_->mutable_cpu_data(), data, gray_->count() * sizeof(data[0]));
     gray_ready_ = true;
     success = true;
+  } else if (encoding == "yuyv") {
+    YUYVToRGBCpu(data, cols, rows, rgb_->mutable_cpu_data());
+    rgb_ready_ = true;
+    success = true;
   } else {
     AERROR << "Unrecognized image encoding: " << encoding;
   }
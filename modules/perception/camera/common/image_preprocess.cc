@@ -0,0 +1,290 @@
+/******************************************************************************
+ * Copyright 2021 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the License);
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+#include "modules/perception/camera/common/image_preprocess.h"
+
+#include <algorithm>
+#include <vector>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+#include "cyber/common/log.h"
+
+namespace apollo {
+namespace perception {
+namespace camera {
+
+namespace {
+
+// BT.601 full-swing YUV -> RGB in 8.8 fixed point:
+//   R = Y + 1.402 (V - 128)
+//   G = Y - 0.344 (U - 128) - 0.714 (V - 128)
+//   B = Y + 1.772 (U - 128)
+constexpr int kVToR = 359;  // 1.402 * 256
+constexpr int kUToG = 88;   // 0.344 * 256
+constexpr int kVToG = 183;  // 0.714 * 256
+constexpr int kUToB = 454;  // 1.772 * 256
+
+// Bilinear interpolation weights in Q16.
+constexpr int kWeightShift = 16;
+constexpr int kWeightOne = 1 << kWeightShift;
+
+inline uint8_t ClampToByte(int value) {
+  return static_cast<uint8_t>(std::min(255, std::max(0, value)));
+}
+
+// Converts one YUYV row (YUYV macropixels, two pixels each) to one RGB row.
+void ConvertYUYVRow(const uint8_t *src, int width, uint8_t *dst) {
+  for (int x = 0; x < width; x += 2) {
+    const int y0 = src[0];
+    const int u = src[1] - 128;
+    const int y1 = src[2];
+    const int v = src[3] - 128;
+    const int r_off = kVToR * v;
+    const int g_off = kUToG * u + kVToG * v;
+    const int b_off = kUToB * u;
+    dst[0] = ClampToByte(y0 + (r_off >> 8));
+    dst[1] = ClampToByte(y0 - (g_off >> 8));
+    dst[2] = ClampToByte(y0 + (b_off >> 8));
+    dst[3] = ClampToByte(y1 + (r_off >> 8));
+    dst[4] = ClampToByte(y1 - (g_off >> 8));
+    dst[5] = ClampToByte(y1 + (b_off >> 8));
+    src += 4;
+    dst += 6;
+  }
+}
+
+// Precomputes, for every destination column, the left source column and the
+// Q16 weight of the right source column.
+void BuildResizeTables(int src_size, int dst_size, std::vector<int> *index,
+                       std::vector<int> *weight) {
+  index->resize(dst_size);
+  weight->resize(dst_size);
+  const double step = static_cast<double>(src_size) / dst_size;
+  for (int i = 0; i < dst_size; ++i) {
+    double pos = (i + 0.5) * step - 0.5;
+    pos = std::max(0.0, std::min(pos, static_cast<double>(src_size - 1)));
+    const int left = std::min(static_cast<int>(pos), src_size - 2);
+    (*index)[i] = std::max(left, 0);
+    (*weight)[i] = static_cast<int>((pos - (*index)[i]) * kWeightOne);
+  }
+}
+
+// Horizontal pass of the bilinear filter for one source row: produces Q16
+// intermediate values so the vertical pass can blend two rows without
+// losing precision.
+void ResizeRowHorizontal(const uint8_t *src, int channels,
+                         const std::vector<int> &x_index,
+                         const std::vector<int> &x_weight, int32_t *dst) {
+  const int dst_width = static_cast<int>(x_index.size());
+  for (int x = 0; x < dst_width; ++x) {
+    const uint8_t *p0 = src + x_index[x] * channels;
+    const int w1 = x_weight[x];
+    const int w0 = kWeightOne - w1;
+    for (int c = 0; c < channels; ++c) {
+      dst[x * channels + c] = w0 * p0[c] + w1 * p0[channels + c];
+    }
+  }
+}
+
+}  // namespace
+
+void YUYVToRGBCpu(const uint8_t *yuyv, int width, int height, uint8_t *rgb) {
+  for (int y = 0; y < height; ++y) {
+    ConvertYUYVRow(yuyv + y * width * 2, width, rgb + y * width * 3);
+  }
+}
+
+void ResizeBilinearCpu(const uint8_t *src, int src_width, int src_height,
+                       int channels, uint8_t *dst, int dst_width,
+                       int dst_height) {
+  if (src_width < 2 || src_height < 2 || dst_width <= 0 || dst_height <= 0 ||
+      (channels != 1 && channels != 3)) {
+    AERROR << "Invalid resize arguments: " << src_width << "x" << src_height
+           << " -> " << dst_width << "x" << dst_height << " channels "
+           << channels;
+    return;
+  }
+  std::vector<int> x_index;
+  std::vector<int> x_weight;
+  std::vector<int> y_index;
+  std::vector<int> y_weight;
+  BuildResizeTables(src_width, dst_width, &x_index, &x_weight);
+  BuildResizeTables(src_height, dst_height, &y_index, &y_weight);
+
+  const int row_count = dst_width * channels;
+  std::vector<int32_t> row0(row_count);
+  std::vector<int32_t> row1(row_count);
+  int cached_row0 = -1;
+  int cached_row1 = -1;
+  for (int y = 0; y < dst_height; ++y) {
+    const int sy = y_index[y];
+    if (cached_row0 != sy) {
+      if (cached_row1 == sy) {
+        row0.swap(row1);
+        cached_row0 = cached_row1;
+        cached_row1 = -1;
+      } else {
+        ResizeRowHorizontal(src + sy * src_width * channels, channels, x_index,
+                            x_weight, row0.data());
+        cached_row0 = sy;
+      }
+    }
+    if (cached_row1 != sy + 1) {
+      ResizeRowHorizontal(src + (sy + 1) * src_width * channels, channels,
+                          x_index, x_weight, row1.data());
+      cached_row1 = sy + 1;
+    }
+    const int64_t w1 = y_weight[y];
+    const int64_t w0 = kWeightOne - w1;
+    uint8_t *dst_row = dst + y * row_count;
+    for (int i = 0; i < row_count; ++i) {
+      const int64_t value = w0 * row0[i] + w1 * row1[i];
+      dst_row[i] = static_cast<uint8_t>(
+          (value + (1LL << (2 * kWeightShift - 1))) >> (2 * kWeightShift));
+    }
+  }
+}
+
+void NormalizeCpu(const uint8_t *src, int width, int height, int channels,
+                  const float *mean, const float *scale, float *dst) {
+  const int count = width * height * channels;
+  int i = 0;
+#if defined(__AVX2__)
+  if (channels == 3) {
+    // 3-channel pattern repeats every 24 elements: tile mean/scale into
+    // three 8-wide registers.
+    float mean_tile[24];
+    float scale_tile[24];
+    for (int j = 0; j < 24; ++j) {
+      mean_tile[j] = mean[j % 3];
+      scale_tile[j] = scale[j % 3];
+    }
+    for (; i + 24 <= count; i += 24) {
+      for (int j = 0; j < 24; j += 8) {
+        const __m128i bytes =
+            _mm_loadl_epi64(reinterpret_cast<const __m128i *>(src + i + j));
+        const __m256 pixels = _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(bytes));
+        const __m256 result = _mm256_mul_ps(
+            _mm256_sub_ps(pixels, _mm256_loadu_ps(mean_tile + j)),
+            _mm256_loadu_ps(scale_tile + j));
+        _mm256_storeu_ps(dst + i + j, result);
+      }
+    }
+  }
+#elif defined(__ARM_NEON)
+  if (channels == 3) {
+    // 3-channel pattern repeats every 12 elements: tile mean/scale into
+    // three 4-wide registers.
+    float mean_tile[12];
+    float scale_tile[12];
+    for (int j = 0; j < 12; ++j) {
+      mean_tile[j] = mean[j % 3];
+      scale_tile[j] = scale[j % 3];
+    }
+    for (; i + 16 <= count; i += 12) {
+      const uint8x16_t bytes = vld1q_u8(src + i);
+      const uint16x8_t low = vmovl_u8(vget_low_u8(bytes));
+      const uint16x8_t high = vmovl_u8(vget_high_u8(bytes));
+      float32x4_t pixels[3];
+      pixels[0] = vcvtq_f32_u32(vmovl_u16(vget_low_u16(low)));
+      pixels[1] = vcvtq_f32_u32(vmovl_u16(vget_high_u16(low)));
+      pixels[2] = vcvtq_f32_u32(vmovl_u16(vget_low_u16(high)));
+      for (int j = 0; j < 3; ++j) {
+        vst1q_f32(dst + i + j * 4,
+                  vmulq_f32(vsubq_f32(pixels[j], vld1q_f32(mean_tile + j * 4)),
+                            vld1q_f32(scale_tile + j * 4)));
+      }
+    }
+  }
+#endif
+  for (; i < count; ++i) {
+    const int c = i % channels;
+    dst[i] = (static_cast<float>(src[i]) - mean[c]) * scale[c];
+  }
+}
+
+bool ConvertResizeNormalizeCpu(const uint8_t *yuyv, int src_width,
+                               int src_height, int dst_width, int dst_height,
+                               const float *mean, const float *scale,
+                               base::Blob<float> *blob) {
+  if (yuyv == nullptr || blob == nullptr || src_width <= 1 ||
+      src_height <= 1 || dst_width <= 0 || dst_height <= 0 ||
+      (src_width & 1) != 0) {
+    AERROR << "Invalid fused preprocessing arguments: " << src_width << "x"
+           << src_height << " -> " << dst_width << "x" << dst_height;
+    return false;
+  }
+  blob->Reshape({1, dst_height, dst_width, 3});
+  float *dst = blob->mutable_cpu_data();
+
+  std::vector<int> x_index;
+  std::vector<int> x_weight;
+  std::vector<int> y_index;
+  std::vector<int> y_weight;
+  BuildResizeTables(src_width, dst_width, &x_index, &x_weight);
+  BuildResizeTables(src_height, dst_height, &y_index, &y_weight);
+
+  // Only the two source rows feeding the current output row are converted
+  // to RGB; consecutive output rows usually share one of them.
+  std::vector<uint8_t> row0(src_width * 3);
+  std::vector<uint8_t> row1(src_width * 3);
+  int cached_row0 = -1;
+  int cached_row1 = -1;
+  const int src_row_bytes = src_width * 2;
+  for (int y = 0; y < dst_height; ++y) {
+    const int sy = y_index[y];
+    if (cached_row0 != sy) {
+      if (cached_row1 == sy) {
+        row0.swap(row1);
+        cached_row0 = cached_row1;
+        cached_row1 = -1;
+      } else {
+        ConvertYUYVRow(yuyv + sy * src_row_bytes, src_width, row0.data());
+        cached_row0 = sy;
+      }
+    }
+    if (cached_row1 != sy + 1) {
+      ConvertYUYVRow(yuyv + (sy + 1) * src_row_bytes, src_width, row1.data());
+      cached_row1 = sy + 1;
+    }
+    const float fy1 =
+        static_cast<float>(y_weight[y]) / static_cast<float>(kWeightOne);
+    const float fy0 = 1.0f - fy1;
+    float *dst_row = dst + y * dst_width * 3;
+    for (int x = 0; x < dst_width; ++x) {
+      const int offset = x_index[x] * 3;
+      const float fx1 =
+          static_cast<float>(x_weight[x]) / static_cast<float>(kWeightOne);
+      const float fx0 = 1.0f - fx1;
+      for (int c = 0; c < 3; ++c) {
+        const float top = fx0 * row0[offset + c] + fx1 * row0[offset + 3 + c];
+        const float bottom =
+            fx0 * row1[offset + c] + fx1 * row1[offset + 3 + c];
+        dst_row[x * 3 + c] =
+            (fy0 * top + fy1 * bottom - mean[c]) * scale[c];
+      }
+    }
+  }
+  return true;
+}
+
+}  // namespace camera
+}  // namespace perception
+}  // namespace apollo
@@ -0,0 +1,66 @@
+/******************************************************************************
+ * Copyright 2021 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the License);
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+#pragma once
+
+#include <cstdint>
+
+#include "modules/perception/base/blob.h"
+
+namespace apollo {
+namespace perception {
+namespace camera {
+
+// CPU image preprocessing kernels for the camera pipeline, used when the
+// GPU path is unavailable. The color conversion and resize kernels are
+// fixed-point integer loops over contiguous rows so the compiler can
+// vectorize them (AVX2 on x86_64, NEON on aarch64); the normalization
+// kernel additionally carries explicit intrinsic paths.
+
+// @brief: convert a packed YUYV (YUV 4:2:2) image to RGB using BT.601
+// full-swing fixed-point coefficients.
+// @param [in]: yuyv, width (must be even), height
+// @param [out]: rgb, width * height * 3 bytes
+void YUYVToRGBCpu(const uint8_t *yuyv, int width, int height, uint8_t *rgb);
+
+// @brief: bilinear resize of an interleaved 8-bit image.
+// @param [in]: src, src_width, src_height, channels (1 or 3)
+// @param [out]: dst, dst_width * dst_height * channels bytes
+void ResizeBilinearCpu(const uint8_t *src, int src_width, int src_height,
+                       int channels, uint8_t *dst, int dst_width,
+                       int dst_height);
+
+// @brief: per-channel normalization dst = (src - mean[c]) * scale[c] of an
+// interleaved 8-bit image into float, layout preserved (NHWC).
+// @param [in]: src, width, height, channels (1 or 3), mean, scale
+// @param [out]: dst, width * height * channels floats
+void NormalizeCpu(const uint8_t *src, int width, int height, int channels,
+                  const float *mean, const float *scale, float *dst);
+
+// @brief: fused YUYV -> RGB -> bilinear resize -> normalization writing
+// straight into an NHWC float inference input blob, so full-size
+// intermediate images are never materialized. Only the two source rows
+// needed per output row are converted, and each is converted once.
+// @param [in]: yuyv, src_width (must be even), src_height, dst_width,
+// dst_height, mean[3], scale[3]
+// @param [out]: blob, reshaped to {1, dst_height, dst_width, 3}
+bool ConvertResizeNormalizeCpu(const uint8_t *yuyv, int src_width,
+                               int src_height, int dst_width, int dst_height,
+                               const float *mean, const float *scale,
+                               base::Blob<float> *blob);
+
+}  // namespace camera
+}  // namespace perception
+}  // namespace apollo
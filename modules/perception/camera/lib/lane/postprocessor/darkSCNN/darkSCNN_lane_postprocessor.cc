@@ -23,6 +23,7 @@
 
 #include "modules/perception/base/object_types.h"
 #include "modules/perception/camera/common/math_functions.h"
+#include "modules/perception/common/perception_gflags.h"
 #include "modules/perception/lib/utils/timer.h"
 
 namespace apollo {
@@ -61,6 +62,10 @@ std::map<base::LaneLinePositionType, int> spatialLUTind = {
     {base::LaneLinePositionType::CURB_LEFT, 11},
     {base::LaneLinePositionType::CURB_RIGHT, 12}};
 
+// capacity of the device-side candidate buffer; a frame yields a few
+// hundred edge points at most
+constexpr int kMaxLaneSamplePoints = 4096;
+
 // @brief: evaluating y value of given x for a third-order polynomial function
 template <typename T = float>
 T GetPolyValue(T a, T b, T c, T d, T x) {
@@ -113,19 +118,52 @@ bool DarkSCNNLanePostprocessor::Init(
 
   lane_type_num_ = static_cast<int>(spatialLUTind.size());
   AINFO << "lane_type_num_: " << lane_type_num_;
+
+  if (FLAGS_lane_gpu_postprocess) {
+    lane_map_sampler_ready_ = lane_map_sampler_.Init(
+        lane_map_width_, lane_map_height_, lane_type_num_,
+        kMaxLaneSamplePoints);
+    if (!lane_map_sampler_ready_) {
+      AWARN << "Lane map sampler init failed, using CPU mask scan";
+    }
+  }
   return true;
 }
 
+void DarkSCNNLanePostprocessor::AddEdgePoint(int x, int y, int value) {
+  Eigen::Matrix<float, 3, 1> img_point(
+      static_cast<float>(x * roi_width_ / lane_map_width_),
+      static_cast<float>(y * roi_height_ / lane_map_height_ + roi_start_),
+      1.0);
+  Eigen::Matrix<float, 3, 1> xy_p = trans_mat_ * img_point;
+  if (std::fabs(xy_p(2)) < 1e-6) {
+    return;
+  }
+  Eigen::Matrix<float, 2, 1> xy_point;
+  xy_point << xy_p(0) / xy_p(2), xy_p(1) / xy_p(2);
+
+  // Filter out lane line points
+  if (xy_point(0) < 0.0 ||  // This condition is only for front camera
+      xy_point(0) > max_longitudinal_distance_ ||
+      std::abs(xy_point(1)) > 30.0) {
+    return;
+  }
+  Eigen::Matrix<float, 2, 1> uv_point;
+  uv_point << static_cast<float>(x * roi_width_ / lane_map_width_),
+      static_cast<float>(y * roi_height_ / lane_map_height_ + roi_start_);
+  if (xy_points[value].size() < minNumPoints_ || xy_point(0) < 50.0f ||
+      std::fabs(xy_point(1) - xy_points[value].back()(1)) < 1.0f) {
+    xy_points[value].push_back(xy_point);
+    uv_points[value].push_back(uv_point);
+  }
+}
+
 bool DarkSCNNLanePostprocessor::Process2D(
     const LanePostprocessorOptions& options, CameraFrame* frame) {
   ADEBUG << "Begin to Process2D.";
   frame->lane_objects.clear();
   auto start = std::chrono::high_resolution_clock::now();
 
-  cv::Mat lane_map(lane_map_height_, lane_map_width_, CV_32FC1);
-  memcpy(lane_map.data, frame->lane_detected_blob->cpu_data(),
-         lane_map_width_ * lane_map_height_ * sizeof(float));
-
   // if (options.use_lane_history &&
   //     (!use_history_ || time_stamp_ > options.timestamp)) {
   //   InitLaneHistory();
@@ -134,7 +172,7 @@ bool DarkSCNNLanePostprocessor::Process2D(
   // 1. Sample points on lane_map and project them onto world coordinate
 
   // TODO(techoe): Should be fixed
-  int y = static_cast<int>(lane_map.rows * 0.9 - 1);
+  int y = static_cast<int>(lane_map_height_ * 0.9 - 1);
   // TODO(techoe): Should be fixed
   int step_y = (y - 40) * (y - 40) / 6400 + 1;
 
@@ -143,73 +181,48 @@ bool DarkSCNNLanePostprocessor::Process2D(
   uv_points.clear();
   uv_points.resize(lane_type_num_);
 
-  while (y > 0) {
-    for (int x = 1; x < lane_map.cols - 1; ++x) {
-      int value = static_cast<int>(round(lane_map.at<float>(y, x)));
-      // lane on left
-
-      if ((value > 0 && value < 5) || value == 11) {
-        // right edge (inner) of the lane
-        if (value != static_cast<int>(round(lane_map.at<float>(y, x + 1)))) {
-          Eigen::Matrix<float, 3, 1> img_point(
-              static_cast<float>(x * roi_width_ / lane_map.cols),
-              static_cast<float>(y * roi_height_ / lane_map.rows + roi_start_),
-              1.0);
-          Eigen::Matrix<float, 3, 1> xy_p;
-          xy_p = trans_mat_ * img_point;
-          Eigen::Matrix<float, 2, 1> xy_point;
-          Eigen::Matrix<float, 2, 1> uv_point;
-          if (std::fabs(xy_p(2)) < 1e-6) continue;
-          xy_point << xy_p(0) / xy_p(2), xy_p(1) / xy_p(2);
-
-          // Filter out lane line points
-          if (xy_point(0) < 0.0 ||  // This condition is only for front camera
-              xy_point(0) > max_longitudinal_distance_ ||
-              std::abs(xy_point(1)) > 30.0) {
-            continue;
-          }
-          uv_point << static_cast<float>(x * roi_width_ / lane_map.cols),
-              static_cast<float>(y * roi_height_ / lane_map.rows + roi_start_);
-          if (xy_points[value].size() < minNumPoints_ || xy_point(0) < 50.0f ||
-              std::fabs(xy_point(1) - xy_points[value].back()(1)) < 1.0f) {
-            xy_points[value].push_back(xy_point);
-            uv_points[value].push_back(uv_point);
-          }
-        }
-      } else if (value >= 5 && value < lane_type_num_) {
-        // Left edge (inner) of the lane
-        if (value != static_cast<int>(round(lane_map.at<float>(y, x - 1)))) {
-          Eigen::Matrix<float, 3, 1> img_point(
-              static_cast<float>(x * roi_width_ / lane_map.cols),
-              static_cast<float>(y * roi_height_ / lane_map.rows + roi_start_),
-              1.0);
-          Eigen::Matrix<float, 3, 1> xy_p;
-          xy_p = trans_mat_ * img_point;
-          Eigen::Matrix<float, 2, 1> xy_point;
-          Eigen::Matrix<float, 2, 1> uv_point;
-          if (std::fabs(xy_p(2)) < 1e-6) continue;
-          xy_point << xy_p(0) / xy_p(2), xy_p(1) / xy_p(2);
-          // Filter out lane line points
-          if (xy_point(0) < 0.0 ||  // This condition is only for front camera
-              xy_point(0) > max_longitudinal_distance_ ||
-              std::abs(xy_point(1)) > 30.0) {
-            continue;
+  bool gpu_sampled = false;
+  if (lane_map_sampler_ready_) {
+    std::vector<int> rows;
+    for (int row = y; row > 0; row -= (row - 45) * (row - 45) / 6400 + 1) {
+      rows.push_back(row);
+    }
+    std::vector<LaneMapSamplePoint> sampled_points;
+    gpu_sampled = lane_map_sampler_.Sample(
+        frame->lane_detected_blob->gpu_data(), rows, &sampled_points);
+    if (gpu_sampled) {
+      for (const auto& point : sampled_points) {
+        AddEdgePoint(point.x, point.y, point.value);
+      }
+    } else {
+      AWARN << "GPU lane map sampling failed, falling back to CPU scan";
+    }
+  }
+
+  if (!gpu_sampled) {
+    cv::Mat lane_map(lane_map_height_, lane_map_width_, CV_32FC1);
+    memcpy(lane_map.data, frame->lane_detected_blob->cpu_data(),
+           lane_map_width_ * lane_map_height_ * sizeof(float));
+
+    while (y > 0) {
+      for (int x = 1; x < lane_map.cols - 1; ++x) {
+        int value = static_cast<int>(round(lane_map.at<float>(y, x)));
+        // lane on left
+        if ((value > 0 && value < 5) || value == 11) {
+          // right edge (inner) of the lane
+          if (value != static_cast<int>(round(lane_map.at<float>(y, x + 1)))) {
+            AddEdgePoint(x, y, value);
           }
-          uv_point << static_cast<float>(x * roi_width_ / lane_map.cols),
-              static_cast<float>(y * roi_height_ / lane_map.rows + roi_start_);
-          if (xy_points[value].size() < minNumPoints_ || xy_point(0) < 50.0f ||
-              std::fabs(xy_point(1) - xy_points[value].back()(1)) < 1.0f) {
-            xy_points[value].push_back(xy_point);
-            uv_points[value].push_back(uv_point);
+        } else if (value >= 5 && value < lane_type_num_) {
+          // Left edge (inner) of the lane
+          if (value != static_cast<int>(round(lane_map.at<float>(y, x - 1)))) {
+            AddEdgePoint(x, y, value);
           }
-        } else if (value >= lane_type_num_) {
-          AWARN << "Lane line value shouldn't be equal or more than: "
-                << lane_type_num_;
         }
       }
+      step_y = (y - 45) * (y - 45) / 6400 + 1;
+      y -= step_y;
     }
-    step_y = (y - 45) * (y - 45) / 6400 + 1;
-    y -= step_y;
   }
 
   auto elapsed_1 = std::chrono::high_resolution_clock::now() - start;
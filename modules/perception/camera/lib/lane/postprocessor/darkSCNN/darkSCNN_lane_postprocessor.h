@@ -25,6 +25,7 @@
 #include "modules/perception/camera/lib/interface/base_calibration_service.h"
 #include "modules/perception/camera/lib/interface/base_lane_postprocessor.h"
 #include "modules/perception/camera/lib/lane/common/common_functions.h"
+#include "modules/perception/camera/lib/lane/postprocessor/darkSCNN/lane_map_sampler.h"
 #include "modules/perception/camera/lib/lane/common/proto/darkSCNN.pb.h"
 #include "modules/perception/camera/lib/lane/postprocessor/darkSCNN/proto/darkSCNN_postprocessor.pb.h"
 #include "modules/perception/lib/registerer/registerer.h"
@@ -71,6 +72,9 @@ class DarkSCNNLanePostprocessor : public BaseLanePostprocessor {
   void ConvertImagePoint2Camera(CameraFrame* frame);
   // @brief: fit camera lane line using polynomial
   void PolyFitCameraLaneline(CameraFrame* frame);
+  // @brief: project one sampled mask edge point onto the ground plane and
+  // collect it for fitting; shared by the CPU scan and the GPU sampler
+  void AddEdgePoint(int x, int y, int value);
 
  private:
   int input_offset_x_ = 0;
@@ -105,6 +109,10 @@ class DarkSCNNLanePostprocessor : public BaseLanePostprocessor {
   // xy points for the ground plane, uv points for image plane
   std::vector<std::vector<Eigen::Matrix<float, 2, 1>>> xy_points;
   std::vector<std::vector<Eigen::Matrix<float, 2, 1>>> uv_points;
+
+  // device-side mask sampling (FLAGS_lane_gpu_postprocess)
+  LaneMapSampler lane_map_sampler_;
+  bool lane_map_sampler_ready_ = false;
 };
 
 }  // namespace camera
@@ -0,0 +1,154 @@
+/******************************************************************************
+ * Copyright 2021 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the License);
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+#include "modules/perception/camera/lib/lane/postprocessor/darkSCNN/lane_map_sampler.h"
+
+#include <algorithm>
+
+#include <cuda_runtime.h>
+
+#include "cyber/common/log.h"
+
+namespace apollo {
+namespace perception {
+namespace camera {
+
+namespace {
+
+constexpr int kThreadsPerBlock = 256;
+
+// One thread per (sampled row, inner column). A pixel is a candidate when
+// its rounded label changes against the inner neighbor, with the same
+// left/right split as the scalar scan: labels 1..4 and 11 mark lanes left
+// of the ego lane (compare against x + 1), labels 5..lane_type_num - 1
+// mark lanes on the right (compare against x - 1).
+__global__ void SampleLaneEdgePointsKernel(
+    const float *mask, const int width, const int *rows, const int num_rows,
+    const int lane_type_num, const int max_points, LaneMapSamplePoint *points,
+    int *count) {
+  const int total = num_rows * (width - 2);
+  for (int idx = blockIdx.x * blockDim.x + threadIdx.x; idx < total;
+       idx += blockDim.x * gridDim.x) {
+    const int x = idx % (width - 2) + 1;
+    const int y = rows[idx / (width - 2)];
+    const float *mask_row = mask + y * width;
+    const int value = __float2int_rn(mask_row[x]);
+    bool is_edge = false;
+    if ((value > 0 && value < 5) || value == 11) {
+      is_edge = value != __float2int_rn(mask_row[x + 1]);
+    } else if (value >= 5 && value < lane_type_num) {
+      is_edge = value != __float2int_rn(mask_row[x - 1]);
+    }
+    if (is_edge) {
+      const int slot = atomicAdd(count, 1);
+      if (slot < max_points) {
+        points[slot].x = x;
+        points[slot].y = y;
+        points[slot].value = value;
+      }
+    }
+  }
+}
+
+}  // namespace
+
+LaneMapSampler::~LaneMapSampler() {
+  if (rows_dev_ != nullptr) {
+    cudaFree(rows_dev_);
+  }
+  if (count_dev_ != nullptr) {
+    cudaFree(count_dev_);
+  }
+  if (points_dev_ != nullptr) {
+    cudaFree(points_dev_);
+  }
+}
+
+bool LaneMapSampler::Init(int map_width, int map_height, int lane_type_num,
+                          int max_points) {
+  if (map_width < 3 || map_height < 1 || lane_type_num < 2 ||
+      max_points < 1) {
+    AERROR << "Invalid lane map sampler parameters: " << map_width << "x"
+           << map_height << " lane_type_num " << lane_type_num
+           << " max_points " << max_points;
+    return false;
+  }
+  width_ = map_width;
+  height_ = map_height;
+  lane_type_num_ = lane_type_num;
+  max_points_ = max_points;
+  max_rows_ = map_height;
+  if (cudaMalloc(&rows_dev_, max_rows_ * sizeof(int)) != cudaSuccess ||
+      cudaMalloc(&count_dev_, sizeof(int)) != cudaSuccess ||
+      cudaMalloc(&points_dev_, max_points_ * sizeof(LaneMapSamplePoint)) !=
+          cudaSuccess) {
+    AERROR << "Failed to allocate lane map sampler device buffers";
+    return false;
+  }
+  return true;
+}
+
+bool LaneMapSampler::Sample(const float *mask_gpu_data,
+                            const std::vector<int> &rows,
+                            std::vector<LaneMapSamplePoint> *points) {
+  if (mask_gpu_data == nullptr || points == nullptr || rows.empty() ||
+      static_cast<int>(rows.size()) > max_rows_) {
+    return false;
+  }
+  const int num_rows = static_cast<int>(rows.size());
+  if (cudaMemcpy(rows_dev_, rows.data(), num_rows * sizeof(int),
+                 cudaMemcpyHostToDevice) != cudaSuccess) {
+    AERROR << "Failed to upload sampled rows";
+    return false;
+  }
+  cudaMemset(count_dev_, 0, sizeof(int));
+
+  const int total = num_rows * (width_ - 2);
+  const int blocks = (total + kThreadsPerBlock - 1) / kThreadsPerBlock;
+  SampleLaneEdgePointsKernel<<<blocks, kThreadsPerBlock>>>(
+      mask_gpu_data, width_, rows_dev_, num_rows, lane_type_num_, max_points_,
+      points_dev_, count_dev_);
+  if (cudaGetLastError() != cudaSuccess) {
+    AERROR << "Lane map sampling kernel launch failed";
+    return false;
+  }
+
+  int count = 0;
+  if (cudaMemcpy(&count, count_dev_, sizeof(int), cudaMemcpyDeviceToHost) !=
+      cudaSuccess) {
+    AERROR << "Failed to download candidate count";
+    return false;
+  }
+  count = std::min(count, max_points_);
+  points->resize(count);
+  if (count > 0 &&
+      cudaMemcpy(points->data(), points_dev_,
+                 count * sizeof(LaneMapSamplePoint),
+                 cudaMemcpyDeviceToHost) != cudaSuccess) {
+    AERROR << "Failed to download candidate points";
+    return false;
+  }
+  // The kernel appends in arbitrary order; restore the scalar scan order
+  // (bottom-up rows, then left-to-right) expected by the fitting stage.
+  std::sort(points->begin(), points->end(),
+            [](const LaneMapSamplePoint &a, const LaneMapSamplePoint &b) {
+              return a.y != b.y ? a.y > b.y : a.x < b.x;
+            });
+  return true;
+}
+
+}  // namespace camera
+}  // namespace perception
+}  // namespace apollo
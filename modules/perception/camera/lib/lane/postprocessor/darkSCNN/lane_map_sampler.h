@@ -0,0 +1,69 @@
+/******************************************************************************
+ * Copyright 2021 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the License);
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+#pragma once
+
+#include <vector>
+
+namespace apollo {
+namespace perception {
+namespace camera {
+
+// One lane edge candidate extracted from the segmentation mask.
+struct LaneMapSamplePoint {
+  int x = 0;
+  int y = 0;
+  int value = 0;
+};
+
+// Extracts lane edge candidates from the DarkSCNN segmentation mask while
+// it is still resident on the device, so only a compact point list (a few
+// hundred entries) is copied back to the host instead of the full float
+// mask. The edge conditions mirror the scalar scan in
+// DarkSCNNLanePostprocessor::Process2D.
+class LaneMapSampler {
+ public:
+  LaneMapSampler() = default;
+  ~LaneMapSampler();
+
+  LaneMapSampler(const LaneMapSampler &) = delete;
+  LaneMapSampler &operator=(const LaneMapSampler &) = delete;
+
+  // @brief: allocate the device buffers.
+  // @param [in]: mask size, number of lane types, candidate capacity
+  bool Init(int map_width, int map_height, int lane_type_num, int max_points);
+
+  // @brief: scan the given mask rows on the device.
+  // @param [in]: mask_gpu_data, device pointer of the lane_detected_blob
+  // @param [in]: rows, mask row indices to scan
+  // @param [out]: points, candidates sorted bottom-up then left-to-right,
+  // matching the order of the scalar scan
+  bool Sample(const float *mask_gpu_data, const std::vector<int> &rows,
+              std::vector<LaneMapSamplePoint> *points);
+
+ private:
+  int width_ = 0;
+  int height_ = 0;
+  int lane_type_num_ = 0;
+  int max_points_ = 0;
+  int max_rows_ = 0;
+  int *rows_dev_ = nullptr;
+  int *count_dev_ = nullptr;
+  LaneMapSamplePoint *points_dev_ = nullptr;
+};
+
+}  // namespace camera
+}  // namespace perception
+}  // namespace apollo
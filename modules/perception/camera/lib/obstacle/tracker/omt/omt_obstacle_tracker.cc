@@ -20,6 +20,7 @@
 
 #include "cyber/common/file.h"
 #include "modules/perception/base/point.h"
+#include "modules/perception/inference/utils/gemm.h"
 #include "modules/perception/camera/common/global_config.h"
 #include "modules/perception/camera/common/math_functions.h"
 #include "modules/perception/camera/common/util.h"
@@ -50,8 +51,6 @@ bool OMTObstacleTracker::Init(const ObstacleTrackerInitOptions &options) {
   frame_num_ = 0;
   frame_list_.Init(omt_param_.img_capability());
   gpu_id_ = options.gpu_id;
-  similar_map_.Init(omt_param_.img_capability(), gpu_id_);
-  similar_.reset(new GPUSimilar);
   width_ = options.image_width;
   height_ = options.image_height;
   reference_.Init(omt_param_.reference(), width_, height_);
@@ -172,7 +171,7 @@ void OMTObstacleTracker::GenerateHypothesis(const TrackObjectPtrs &objects) {
     for (size_t j = 0; j < objects.size(); ++j) {
       hypo.target = static_cast<int>(i);
       hypo.object = static_cast<int>(j);
-      float sa = ScoreAppearance(targets_[i], objects[j]);
+      float sa = ScoreAppearance(i, j);
       float sm = ScoreMotion(targets_[i], objects[j]);
       float ss = ScoreShape(targets_[i], objects[j]);
       float so = ScoreOverlap(targets_[i], objects[j]);
@@ -240,23 +239,58 @@ float OMTObstacleTracker::ScoreShape(const Target &target,
   return -std::abs(s);
 }
 
-float OMTObstacleTracker::ScoreAppearance(const Target &target,
-                                          TrackObjectPtr track_obj) {
-  float energy = 0.0f;
-  int count = 0;
-  auto sensor_name = track_obj->indicator.sensor_name;
-  for (int i = target.Size() - 1; i >= 0; --i) {
-    if (target[i]->indicator.sensor_name != sensor_name) {
+bool OMTObstacleTracker::CalcAppearanceSimilarity(
+    const TrackObjectPtrs &objects, CameraFrame *frame) {
+  appearance_valid_ = false;
+  int n = static_cast<int>(targets_.size());
+  int m = static_cast<int>(objects.size());
+  if (n == 0 || m == 0 || frame->track_feature_blob == nullptr) {
+    return false;
+  }
+  int dim = frame->track_feature_blob->count(1);
+  const std::string &sensor_name = frame->data_provider->sensor_name();
+  target_features_.Reshape({n, dim});
+  appearance_counts_.resize(n);
+  bool has_feature = false;
+  for (int i = 0; i < n; ++i) {
+    int count = 0;
+    const std::vector<float> &feature =
+        targets_[i].AppearanceFeature(sensor_name, &count);
+    float *row = target_features_.mutable_cpu_data() +
+                 target_features_.offset(i);
+    std::fill(row, row + dim, 0.0f);
+    if (count == 0 || static_cast<int>(feature.size()) != dim) {
+      appearance_counts_[i] = 0;
       continue;
     }
-    PatchIndicator p1 = target[i]->indicator;
-    PatchIndicator p2 = track_obj->indicator;
-
-    energy += similar_map_.sim(p1, p2);
-    count += 1;
+    std::copy(feature.begin(), feature.end(), row);
+    appearance_counts_[i] = count;
+    has_feature = true;
   }
+  if (!has_feature) {
+    return false;
+  }
+  appearance_sim_.Reshape({n, m});
+  // one GEMM covers every track-detection pair
+  inference::GPUGemmFloat(CblasNoTrans, CblasTrans, n, m, dim, 1.0f,
+                          target_features_.gpu_data(),
+                          frame->track_feature_blob->gpu_data(), 0.0f,
+                          appearance_sim_.mutable_gpu_data());
+  appearance_valid_ = true;
+  return true;
+}
 
-  return energy / (0.1f + static_cast<float>(count) * 0.9f);
+float OMTObstacleTracker::ScoreAppearance(size_t target_index,
+                                          size_t object_index) {
+  if (!appearance_valid_ || appearance_counts_[target_index] == 0) {
+    return 0.0f;
+  }
+  // the summed cached feature makes this the same accumulated energy the
+  // per-pair similarities used to produce
+  float energy = appearance_sim_.cpu_data()[appearance_sim_.offset(
+      static_cast<int>(target_index), static_cast<int>(object_index))];
+  return energy /
+         (0.1f + static_cast<float>(appearance_counts_[target_index]) * 0.9f);
 }
 
 // [new]
@@ -351,13 +385,6 @@ bool OMTObstacleTracker::Associate2D(const ObstacleTrackerOptions &options,
                                      CameraFrame *frame) {
   inference::CudaUtil::set_device_id(gpu_id_);
   frame_list_.Add(frame);
-  for (int t = 0; t < frame_list_.Size(); t++) {
-    int frame1 = frame_list_[t]->frame_id;
-    int frame2 = frame_list_[-1]->frame_id;
-    similar_->Calc(frame_list_[frame1], frame_list_[frame2],
-                   similar_map_.get(frame1, frame2).get());
-  }
-
   for (auto &target : targets_) {
     target.RemoveOld(frame_list_.OldestFrameId());
     ++target.lost_age;
@@ -374,6 +401,17 @@ bool OMTObstacleTracker::Associate2D(const ObstacleTrackerOptions &options,
                                           frame->data_provider->sensor_name());
     track_ptr->object->camera_supplement.sensor_name =
         frame->data_provider->sensor_name();
+    // keep a copy of the appearance feature with the detection, it
+    // feeds the per-track caches after association
+    if (frame->track_feature_blob != nullptr &&
+        track_ptr->object->camera_supplement.object_feature.empty()) {
+      const int dim = frame->track_feature_blob->count(1);
+      const float *feature =
+          frame->track_feature_blob->cpu_data() +
+          frame->track_feature_blob->offset(static_cast<int>(i));
+      track_ptr->object->camera_supplement.object_feature.assign(feature,
+                                                                 feature + dim);
+    }
     ProjectBox(frame->detected_objects[i]->camera_supplement.box,
                frame->project_matrix, &(track_ptr->projected_box));
     track_objects.push_back(track_ptr);
@@ -381,6 +419,7 @@ bool OMTObstacleTracker::Associate2D(const ObstacleTrackerOptions &options,
   reference_.CorrectSize(frame);
   used_.clear();
   used_.resize(frame->detected_objects.size(), false);
+  CalcAppearanceSimilarity(track_objects, frame);
   GenerateHypothesis(track_objects);
   int new_count = CreateNewTarget(track_objects);
   AINFO << "Create " << new_count << " new target";
@@ -21,7 +21,6 @@
 
 #include "modules/perception/camera/common/object_template_manager.h"
 #include "modules/perception/camera/lib/interface/base_obstacle_tracker.h"
-#include "modules/perception/camera/lib/obstacle/tracker/common/similar.h"
 #include "modules/perception/camera/lib/obstacle/tracker/omt/frame_list.h"
 #include "modules/perception/camera/lib/obstacle/tracker/omt/obstacle_reference.h"
 #include "modules/perception/camera/lib/obstacle/tracker/omt/proto/omt.pb.h"
@@ -98,7 +97,13 @@ class OMTObstacleTracker : public BaseObstacleTracker {
   std::string Name() const override;
 
  private:
-  float ScoreAppearance(const Target &target, TrackObjectPtr object);
+  // @brief batched appearance similarity between every target and every
+  //        detection of the current frame in one GEMM, consumed by
+  //        ScoreAppearance. Target features come from the per-track
+  //        cache, see Target::AppearanceFeature.
+  bool CalcAppearanceSimilarity(const TrackObjectPtrs &objects,
+                                CameraFrame *frame);
+  float ScoreAppearance(size_t target_index, size_t object_index);
 
   float ScoreMotion(const Target &target, TrackObjectPtr object);
   float ScoreShape(const Target &target, TrackObjectPtr object);
@@ -111,8 +116,12 @@ class OMTObstacleTracker : public BaseObstacleTracker {
  private:
   omt::OmtParam omt_param_;
   FrameList frame_list_;
-  SimilarMap similar_map_;
-  std::shared_ptr<BaseSimilar> similar_ = nullptr;
+  // per-frame track-detection appearance similarity, row per target,
+  // column per detection
+  base::Blob<float> appearance_sim_;
+  base::Blob<float> target_features_;
+  std::vector<int> appearance_counts_;
+  bool appearance_valid_ = false;
   std::vector<Target> targets_;
   std::vector<bool> used_;
   ObstacleReference reference_;
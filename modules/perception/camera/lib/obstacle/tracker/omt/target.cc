@@ -53,6 +53,46 @@ void Target::Add(TrackObjectPtr object) {
   lost_age = 0;
   tracked_objects.push_back(object);
 }
+const std::vector<float> &Target::AppearanceFeature(
+    const std::string &sensor_name, int *count) {
+  static const std::vector<float> kEmptyFeature;
+  int latest_frame =
+      tracked_objects.empty() ? -1 : tracked_objects.back()->indicator.frame_id;
+  int oldest_frame = tracked_objects.empty()
+                         ? -1
+                         : tracked_objects.front()->indicator.frame_id;
+  if (feature_cache_size_ != static_cast<int>(tracked_objects.size()) ||
+      feature_cache_oldest_frame_ != oldest_frame ||
+      feature_cache_latest_frame_ != latest_frame) {
+    feature_cache_.clear();
+    for (auto &obj : tracked_objects) {
+      const auto &feature = obj->object->camera_supplement.object_feature;
+      if (feature.empty()) {
+        continue;
+      }
+      auto &entry = feature_cache_[obj->indicator.sensor_name];
+      if (entry.first.empty()) {
+        entry.first.assign(feature.size(), 0.0f);
+      }
+      size_t dim = std::min(feature.size(), entry.first.size());
+      for (size_t k = 0; k < dim; ++k) {
+        entry.first[k] += feature[k];
+      }
+      ++entry.second;
+    }
+    feature_cache_size_ = static_cast<int>(tracked_objects.size());
+    feature_cache_oldest_frame_ = oldest_frame;
+    feature_cache_latest_frame_ = latest_frame;
+  }
+  auto iter = feature_cache_.find(sensor_name);
+  if (iter == feature_cache_.end()) {
+    *count = 0;
+    return kEmptyFeature;
+  }
+  *count = iter->second.second;
+  return iter->second.first;
+}
+
 void Target::RemoveOld(int frame_id) {
   size_t index = 0;
   while (index < tracked_objects.size() &&
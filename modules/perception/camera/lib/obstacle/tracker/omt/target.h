@@ -15,6 +15,9 @@
  *****************************************************************************/
 #pragma once
 
+#include <map>
+#include <string>
+#include <utility>
 #include <vector>
 
 #include <boost/circular_buffer.hpp>
@@ -55,6 +58,13 @@ struct Target {
   bool isTracked() const;
   bool isLost() const;
 
+  // @brief sum of the appearance features of this target's observations
+  //        from the given sensor, count receives how many observations
+  //        were summed. The cache behind it is only rebuilt when the
+  //        track composition changed since the last call.
+  const std::vector<float> &AppearanceFeature(const std::string &sensor_name,
+                                              int *count);
+
  public:
   int lost_age = 0;
   int id = 0;
@@ -90,6 +100,12 @@ struct Target {
 
   boost::circular_buffer<base::Object> history_world_states_;
 
+  // appearance feature cache, see AppearanceFeature()
+  std::map<std::string, std::pair<std::vector<float>, int>> feature_cache_;
+  int feature_cache_size_ = -1;
+  int feature_cache_oldest_frame_ = -1;
+  int feature_cache_latest_frame_ = -1;
+
  protected:
   ObjectTemplateManager *object_template_manager_ = nullptr;
 };
@@ -17,6 +17,8 @@
 
 #include <algorithm>
 #include <cfloat>
+#include <thread>
+#include <vector>
 
 namespace apollo {
 namespace perception {
@@ -44,6 +46,7 @@ void PlaneFitGroundDetectorParam::SetDefault() {
   nr_ransac_iter_threshold = 32;
   candidate_filter_threshold = 1.0f;  // 1 meter
   nr_smooth_iter = 1;
+  nr_detect_threads = 1;
 }
 
 bool PlaneFitGroundDetectorParam::Validate() const {
@@ -392,6 +395,35 @@ void PlaneFitGroundDetector::ComputeSignedGroundHeight(
   for (r = 0; r < nr_points; ++r) {
     height_above_ground[r] = FLT_MAX;
   }
+  if (param_.nr_detect_threads > 1) {
+    //  rows are independent: each one only writes heights of the points
+    //  binned into its own voxels and reads the fitted planes
+    const unsigned int nr_threads =
+        static_cast<unsigned int>(param_.nr_detect_threads);
+    std::vector<std::thread> threads;
+    threads.reserve(nr_threads);
+    for (unsigned int t = 0; t < nr_threads; ++t) {
+      threads.emplace_back([this, t, nr_threads, nm1, point_cloud,
+                            height_above_ground, nr_points,
+                            nr_point_elements]() {
+        for (unsigned int row = 0; row <= nm1; ++row) {
+          if (row * nr_threads / param_.nr_grids_coarse != t) {
+            continue;
+          }
+          const GroundPlaneLiDAR *up = ground_planes_[row > 0 ? row - 1 : 0];
+          const GroundPlaneLiDAR *dn =
+              ground_planes_[row < nm1 ? row + 1 : nm1];
+          ComputeSignedGroundHeightLine(point_cloud, up, ground_planes_[row],
+                                        dn, height_above_ground, row,
+                                        nr_points, nr_point_elements);
+        }
+      });
+    }
+    for (auto &thread : threads) {
+      thread.join();
+    }
+    return;
+  }
   ComputeSignedGroundHeightLine(
       point_cloud, ground_planes_[0], ground_planes_[0], ground_planes_[1],
       height_above_ground, 0, nr_points, nr_point_elements);
@@ -539,11 +571,11 @@ void PlaneFitGroundDetector::ComputeSignedGroundHeightLine(
   }
 }
 
-int PlaneFitGroundDetector::FilterGrid(const Voxel<float> &vx,
-                                       const float *point_cloud,
-                                       PlaneFitPointCandIndices *candi,
-                                       unsigned int nr_points,
-                                       unsigned int nr_point_element) {
+int PlaneFitGroundDetector::FilterGrid(
+    const Voxel<float> &vx, const float *point_cloud,
+    PlaneFitPointCandIndices *candi, unsigned int nr_points,
+    unsigned int nr_point_element, float *sampled_z_values,
+    int *sampled_indices) {
   int pos = 0;
   int rseed = I_DEFAULT_SEED;
   int nr_candis = 0;
@@ -559,25 +591,27 @@ int PlaneFitGroundDetector::FilterGrid(const Voxel<float> &vx,
     for (i = 0; i < vx.NrPoints(); ++i) {
       pos = vx.indices_[i] * nr_point_element;
       //  requires the Z element to be in the third position, i.e., after X, Y
-      sampled_z_values_[i] = (point_cloud + pos)[2];
+      sampled_z_values[i] = (point_cloud + pos)[2];
     }
   } else {
-    IRandomSample(sampled_indices_, static_cast<int>(param_.nr_z_comp_candis),
+    IRandomSample(sampled_indices, static_cast<int>(param_.nr_z_comp_candis),
                   static_cast<int>(vx.NrPoints()), &rseed);
     //  sampled z values
     for (i = 0; i < nr_samples; ++i) {
-      pos = vx.indices_[sampled_indices_[i]] * nr_point_element;
+      pos = vx.indices_[sampled_indices[i]] * nr_point_element;
       // requires the Z element to be in the third position, i.e., after X, Y
-      sampled_z_values_[i] = (point_cloud + pos)[2];
+      sampled_z_values[i] = (point_cloud + pos)[2];
     }
   }
   // Filter points and get plane fitting candidates
-  nr_candis = CompareZ(point_cloud, vx.indices_, sampled_z_values_, candi,
+  nr_candis = CompareZ(point_cloud, vx.indices_, sampled_z_values, candi,
                        nr_points, nr_point_element, nr_samples);
   return nr_candis;
 }
 
-int PlaneFitGroundDetector::FilterLine(unsigned int r) {
+int PlaneFitGroundDetector::FilterLine(unsigned int r,
+                                       float *sampled_z_values,
+                                       int *sampled_indices) {
   int nr_candis = 0;
   unsigned int c = 0;
   const float *point_cloud = vg_fine_->const_data();
@@ -589,7 +623,8 @@ int PlaneFitGroundDetector::FilterLine(unsigned int r) {
     parent = map_fine_to_coarse_[begin + c];
     nr_candis +=
         FilterGrid((*vg_fine_)(r, c), point_cloud, &local_candis_[0][parent],
-                   nr_points, nr_point_element);
+                   nr_points, nr_point_element, sampled_z_values,
+                   sampled_indices);
   }
   return nr_candis;
 }
@@ -605,8 +640,47 @@ int PlaneFitGroundDetector::Filter() {
     local_candis_[0][i].Clear();
   }
   //  Filter plane fitting candidates
-  for (r = 0; r < param_.nr_grids_fine; ++r) {
-    nr_candis += FilterLine(r);
+  if (param_.nr_detect_threads > 1) {
+    nr_candis = FilterParallel();
+  } else {
+    for (r = 0; r < param_.nr_grids_fine; ++r) {
+      nr_candis += FilterLine(r, sampled_z_values_, sampled_indices_);
+    }
+  }
+  return nr_candis;
+}
+
+int PlaneFitGroundDetector::FilterParallel() {
+  const unsigned int nr_threads =
+      static_cast<unsigned int>(param_.nr_detect_threads);
+  std::vector<int> nr_candis_of_thread(nr_threads, 0);
+  std::vector<std::thread> threads;
+  threads.reserve(nr_threads);
+  for (unsigned int t = 0; t < nr_threads; ++t) {
+    threads.emplace_back([this, t, nr_threads, &nr_candis_of_thread]() {
+      //  per-thread scratch keeps FilterGrid free of data races
+      std::vector<float> sampled_z_values(param_.nr_z_comp_candis);
+      std::vector<int> sampled_indices(param_.nr_z_comp_candis);
+      int nr_candis = 0;
+      for (unsigned int r = 0; r < param_.nr_grids_fine; ++r) {
+        //  fine rows are partitioned by their parent coarse row, so two
+        //  threads never append to the same candidate list
+        unsigned int parent_row =
+            map_fine_to_coarse_[r * param_.nr_grids_fine] /
+            param_.nr_grids_coarse;
+        if (parent_row * nr_threads / param_.nr_grids_coarse != t) {
+          continue;
+        }
+        nr_candis += FilterLine(r, sampled_z_values.data(),
+                                sampled_indices.data());
+      }
+      nr_candis_of_thread[t] = nr_candis;
+    });
+  }
+  int nr_candis = 0;
+  for (unsigned int t = 0; t < nr_threads; ++t) {
+    threads[t].join();
+    nr_candis += nr_candis_of_thread[t];
   }
   return nr_candis;
 }
@@ -189,6 +189,10 @@ struct PlaneFitGroundDetectorParam {
   float candidate_filter_threshold;
   int nr_ransac_iter_threshold;
   int nr_smooth_iter;
+  // number of worker threads for the data parallel phases of Detect
+  // (candidate filtering and signed height computation); 1 keeps the
+  // original single threaded path
+  int nr_detect_threads;
 };
 
 struct PlaneFitPointCandIndices {
@@ -276,10 +280,12 @@ class PlaneFitGroundDetector : public BaseGroundDetector {
   float CalculateAngleDist(const GroundPlaneLiDAR &plane,
                            const std::vector<std::pair<int, int> > &neighbors);
   int Filter();
-  int FilterLine(unsigned int r);
+  int FilterParallel();
+  int FilterLine(unsigned int r, float *sampled_z_values, int *sampled_indices);
   int FilterGrid(const Voxel<float> &vg, const float *point_cloud,
                  PlaneFitPointCandIndices *candi, unsigned int nr_points,
-                 unsigned int nr_point_element);
+                 unsigned int nr_point_element, float *sampled_z_values,
+                 int *sampled_indices);
   int Smooth();
   int SmoothLine(unsigned int up, unsigned int r, unsigned int dn);
   int CompleteGrid(const GroundPlaneSpherical &lt,
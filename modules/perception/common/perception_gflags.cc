@@ -37,6 +37,13 @@ DEFINE_bool(enable_base_object_pool, false, "Enable base object pool.");
 DEFINE_string(config_manager_path, "./conf", "The ModelConfig config paths.");
 DEFINE_string(work_root, "", "Project work root direcotry.");
 
+// scene_manager
+DEFINE_string(scene_service_prewarm, "",
+              "Comma-separated scene service names to construct and "
+              "initialize on a background thread right after "
+              "SceneManager::Init. Services not listed are initialized "
+              "lazily on first use.");
+
 // lidar_point_pillars
 DEFINE_int32(gpu_id, 0, "The id of gpu used for inference.");
 DEFINE_string(pfe_onnx_file,
@@ -78,5 +85,26 @@ DEFINE_double(score_threshold, 0.5, "Classification score threshold.");
 DEFINE_double(nms_overlap_threshold, 0.5, "Nms overlap threshold.");
 DEFINE_int32(num_output_box_feature, 7, "Length of output box feature.");
 
+DEFINE_double(lidar_roi_cache_distance, 0.0,
+              "Meters the lidar pose may move before the cached hdmap ROI is "
+              "refreshed. Zero queries the hdmap every frame.");
+
+DEFINE_bool(tl_temporal_tracking, false,
+            "Reuse traffic light detections across frames and skip the "
+            "detector on high-confidence frames.");
+DEFINE_int32(tl_detection_duty_cycle, 3,
+             "Run the full traffic light detector at least every Nth frame "
+             "when temporal tracking is enabled.");
+DEFINE_double(tl_track_min_confidence, 0.6,
+              "Minimum recognized confidence required to keep skipping the "
+              "traffic light detector.");
+DEFINE_int32(tl_track_max_projection_shift, 32,
+             "Projection roi center shift in pixels that forces a full "
+             "traffic light detection.");
+
+DEFINE_bool(lane_gpu_postprocess, false,
+            "Sample lane segmentation mask edge points on the GPU instead "
+            "of downloading the full mask to the CPU.");
+
 }  // namespace perception
 }  // namespace apollo
@@ -31,6 +31,9 @@ DECLARE_bool(enable_base_object_pool);
 DECLARE_string(config_manager_path);
 DECLARE_string(work_root);
 
+// scene_manager
+DECLARE_string(scene_service_prewarm);
+
 // lidar_point_pillars
 DECLARE_int32(gpu_id);
 DECLARE_string(pfe_onnx_file);
@@ -53,5 +56,14 @@ DECLARE_double(score_threshold);
 DECLARE_double(nms_overlap_threshold);
 DECLARE_int32(num_output_box_feature);
 
+DECLARE_double(lidar_roi_cache_distance);
+
+DECLARE_bool(tl_temporal_tracking);
+DECLARE_int32(tl_detection_duty_cycle);
+DECLARE_double(tl_track_min_confidence);
+DECLARE_int32(tl_track_max_projection_shift);
+
+DECLARE_bool(lane_gpu_postprocess);
+
 }  // namespace perception
 }  // namespace apollo
@@ -17,6 +17,7 @@
 
 #include "cyber/common/file.h"
 #include "modules/common/time/time_util.h"
+#include "modules/perception/common/sensor_manager/sensor_manager.h"
 #include "modules/perception/fusion/lib/data_fusion/existance_fusion/dst_existance_fusion/dst_existance_fusion.h"
 #include "modules/perception/fusion/lib/data_fusion/motion_fusion/kalman_motion_fusion/kalman_motion_fusion.h"
 #include "modules/perception/fusion/lib/data_fusion/shape_fusion/pbf_shape_fusion/pbf_shape_fusion.h"
@@ -129,6 +130,20 @@ void PbfTracker::UpdateWithoutMeasurement(const TrackerOptions& options,
                                           const std::string& sensor_id,
                                           double measurement_timestamp,
                                           double target_timestamp) {
+  // A non-camera sensor that has never observed this track contributes no
+  // evidence on a miss: the existence decay only fires when the track's
+  // latest object came from this sensor, type fusion only updates on camera
+  // misses, and shape fusion ignores misses entirely. Such tracks only need
+  // the motion predict roll-forward and the invisible-period bookkeeping,
+  // which keeps per-frame fusion cost bounded by the measurement count
+  // instead of the track count.
+  if (!common::SensorManager::Instance()->IsCamera(sensor_id) &&
+      track_->GetSensorObject(sensor_id) == nullptr) {
+    motion_fusion_->UpdateWithoutMeasurement(sensor_id, measurement_timestamp,
+                                             target_timestamp);
+    track_->UpdateWithoutSensorObject(sensor_id, measurement_timestamp);
+    return;
+  }
   existance_fusion_->UpdateWithoutMeasurement(sensor_id, measurement_timestamp,
                                               target_timestamp,
                                               options.match_distance);
@@ -153,7 +153,10 @@ bool ProbabilisticFusion::Fuse(const FusionOptions& options,
 
   // 3. perform fusion on related frames
   for (const auto& frame : frames) {
+    PERCEPTION_PERF_BLOCK_START();
     FuseFrame(frame);
+    PERCEPTION_PERF_BLOCK_END_WITH_INDICATOR("fusion_" + frame->GetSensorId(),
+                                             "fuse_frame");
   }
 
   // 4. collect fused objects
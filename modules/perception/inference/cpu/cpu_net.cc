@@ -0,0 +1,705 @@
+/******************************************************************************
+ * Copyright 2020 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "modules/perception/inference/cpu/cpu_net.h"
+
+#include <fcntl.h>
+
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+#include "google/protobuf/io/coded_stream.h"
+#include "google/protobuf/io/zero_copy_stream_impl.h"
+#include "google/protobuf/text_format.h"
+
+#include "cyber/common/log.h"
+
+namespace apollo {
+namespace perception {
+namespace inference {
+
+namespace {
+
+bool ReadProtoFromText(const std::string &filename,
+                       google::protobuf::Message *proto) {
+  int fd = open(filename.c_str(), O_RDONLY);
+  if (fd < 0) {
+    AERROR << "cannot open file " << filename;
+    return false;
+  }
+  google::protobuf::io::FileInputStream raw_input(fd);
+  bool success = google::protobuf::TextFormat::Parse(&raw_input, proto);
+  close(fd);
+  return success;
+}
+
+bool ReadProtoFromBinary(const std::string &filename,
+                         google::protobuf::Message *proto) {
+  int fd = open(filename.c_str(), O_RDONLY);
+  if (fd < 0) {
+    AERROR << "cannot open file " << filename;
+    return false;
+  }
+  google::protobuf::io::FileInputStream raw_input(fd);
+  google::protobuf::io::CodedInputStream coded_input(&raw_input);
+  coded_input.SetTotalBytesLimit(INT_MAX, 536870912);
+  bool success = proto->ParseFromCodedStream(&coded_input);
+  close(fd);
+  return success;
+}
+
+// quantize a tensor to int8 with a symmetric per tensor scale; returns
+// the dequantization scale, zero for an all-zero tensor
+float QuantizeTensor(const float *data, int count, std::vector<int8_t> *out) {
+  float max_abs = 0.f;
+  for (int i = 0; i < count; ++i) {
+    max_abs = std::max(max_abs, std::fabs(data[i]));
+  }
+  out->resize(count);
+  if (max_abs == 0.f) {
+    std::fill(out->begin(), out->end(), static_cast<int8_t>(0));
+    return 0.f;
+  }
+  const float scale = max_abs / 127.f;
+  const float inv_scale = 127.f / max_abs;
+  for (int i = 0; i < count; ++i) {
+    (*out)[i] = static_cast<int8_t>(std::round(data[i] * inv_scale));
+  }
+  return scale;
+}
+
+int PooledSize(int size, int kernel, int pad, int stride, bool floor_mode) {
+  double raw = static_cast<double>(size + 2 * pad - kernel) / stride;
+  int pooled =
+      static_cast<int>(floor_mode ? std::floor(raw) : std::ceil(raw)) + 1;
+  if (pad > 0 && (pooled - 1) * stride >= size + pad) {
+    --pooled;
+  }
+  return pooled;
+}
+
+}  // namespace
+
+// replicate the kernel/pad/stride normalization of the caffe schema,
+// covering both the scalar and the h/w specific fields
+bool CpuNet::ParseConvParam(const ConvolutionParameter &conv,
+                            ConvDesc *param) {
+  if (conv.has_kernel_h() || conv.has_kernel_w()) {
+    param->kernel_h = conv.kernel_h();
+    param->kernel_w = conv.kernel_w();
+  } else {
+    if (conv.kernel_size_size() < 1) {
+      return false;
+    }
+    param->kernel_h = conv.kernel_size(0);
+    param->kernel_w = (conv.kernel_size_size() > 1 ? conv.kernel_size(1)
+                                                   : conv.kernel_size(0));
+  }
+  if (param->kernel_h < 1 || param->kernel_w < 1) {
+    return false;
+  }
+  if (conv.has_pad_h() || conv.has_pad_w()) {
+    param->padding_h = conv.pad_h();
+    param->padding_w = conv.pad_w();
+  } else {
+    param->padding_h = (conv.pad().empty() ? 0 : conv.pad(0));
+    param->padding_w = (conv.pad_size() > 1 ? conv.pad(1) : param->padding_h);
+  }
+  if (conv.has_stride_h() || conv.has_stride_w()) {
+    param->stride_h = conv.stride_h();
+    param->stride_w = conv.stride_w();
+  } else {
+    param->stride_h = (conv.stride().empty() ? 1 : conv.stride(0));
+    param->stride_w =
+        (conv.stride_size() > 1 ? conv.stride(1) : param->stride_h);
+  }
+  if (param->stride_h < 1 || param->stride_w < 1) {
+    return false;
+  }
+  param->group = std::max(1u, conv.group());
+  param->dilation = conv.dilation().empty() ? 1 : conv.dilation(0);
+  param->num_output = conv.num_output();
+  return true;
+}
+
+CpuNet::CpuNet(const std::string &net_file, const std::string &model_file,
+               const std::vector<std::string> &outputs,
+               const std::vector<std::string> &inputs)
+    : net_file_(net_file),
+      model_file_(model_file),
+      output_names_(outputs),
+      input_names_(inputs) {}
+
+bool CpuNet::LoadWeights(const std::string &model_file) {
+  if (!ReadProtoFromBinary(model_file, &weight_param_)) {
+    AERROR << "open file " << model_file << " failed";
+    return false;
+  }
+  for (int i = 0; i < weight_param_.layer_size(); ++i) {
+    weight_layer_map_[weight_param_.layer(i).name()] = &weight_param_.layer(i);
+  }
+  return true;
+}
+
+bool CpuNet::QuantizeLayerWeights(const LayerParameter &layer_param,
+                                  int num_output) {
+  auto iter = weight_layer_map_.find(layer_param.name());
+  if (iter == weight_layer_map_.end() || iter->second->blobs_size() < 1) {
+    AERROR << "missing weights for layer " << layer_param.name();
+    return false;
+  }
+  const BlobProto &weight_blob = iter->second->blobs(0);
+  if (num_output < 1 || weight_blob.data_size() % num_output != 0) {
+    AERROR << "invalid weight size for layer " << layer_param.name();
+    return false;
+  }
+  Int8Weights weights;
+  weights.rows = num_output;
+  weights.cols = weight_blob.data_size() / num_output;
+  weights.values.resize(weight_blob.data_size());
+  weights.scales.resize(num_output);
+  // symmetric per output channel quantization keeps the dequantization
+  // a single multiply and needs no zero point handling
+  for (int r = 0; r < weights.rows; ++r) {
+    const float *row = weight_blob.data().data() + r * weights.cols;
+    std::vector<int8_t> q_row;
+    weights.scales[r] = QuantizeTensor(row, weights.cols, &q_row);
+    std::copy(q_row.begin(), q_row.end(),
+              weights.values.begin() + r * weights.cols);
+  }
+  weights.bias.assign(num_output, 0.f);
+  if (iter->second->blobs_size() > 1) {
+    const BlobProto &bias_blob = iter->second->blobs(1);
+    for (int r = 0; r < std::min(num_output, bias_blob.data_size()); ++r) {
+      weights.bias[r] = bias_blob.data(r);
+    }
+  }
+  weights_[layer_param.name()] = weights;
+  return true;
+}
+
+bool CpuNet::FoldChannelAffine(const LayerParameter &layer_param) {
+  auto iter = weight_layer_map_.find(layer_param.name());
+  if (iter == weight_layer_map_.end() || iter->second->blobs_size() < 1) {
+    AERROR << "missing weights for layer " << layer_param.name();
+    return false;
+  }
+  const LayerParameter &weight_layer = *iter->second;
+  ChannelAffine affine;
+  if (layer_param.type() == "BatchNorm") {
+    if (weight_layer.blobs_size() < 3) {
+      AERROR << "invalid BatchNorm weights for layer " << layer_param.name();
+      return false;
+    }
+    const BlobProto &mean = weight_layer.blobs(0);
+    const BlobProto &variance = weight_layer.blobs(1);
+    const BlobProto &scale = weight_layer.blobs(2);
+    const float scale_factor =
+        scale.data(0) == 0 ? 0.f : 1.f / scale.data(0);
+    const float epsilon = layer_param.batch_norm_param().eps();
+    affine.scale.resize(mean.data_size());
+    affine.shift.resize(mean.data_size());
+    for (int c = 0; c < mean.data_size(); ++c) {
+      affine.scale[c] = 1.f / static_cast<float>(std::sqrt(
+                                  variance.data(c) * scale_factor + epsilon));
+      affine.shift[c] = -mean.data(c) * scale_factor * affine.scale[c];
+    }
+  } else {  // Scale
+    const BlobProto &scale = weight_layer.blobs(0);
+    affine.scale.assign(scale.data().begin(), scale.data().end());
+    affine.shift.assign(scale.data_size(), 0.f);
+    if (weight_layer.blobs_size() > 1) {
+      const BlobProto &bias = weight_layer.blobs(1);
+      for (int c = 0; c < std::min(scale.data_size(), bias.data_size()); ++c) {
+        affine.shift[c] = bias.data(c);
+      }
+    }
+  }
+  affines_[layer_param.name()] = affine;
+  return true;
+}
+
+bool CpuNet::BuildLayer(const LayerParameter &layer_param,
+                        std::map<std::string, std::vector<int>> *shape_map) {
+  const std::string &type = layer_param.type();
+  if (type == "Input") {
+    return true;
+  }
+  if (layer_param.bottom_size() < 1 ||
+      shape_map->find(layer_param.bottom(0)) == shape_map->end()) {
+    AERROR << "unknown bottom shape for layer " << layer_param.name();
+    return false;
+  }
+  const std::vector<int> &bottom = shape_map->at(layer_param.bottom(0));
+  if (type == "Convolution") {
+    ConvDesc desc;
+    if (!ParseConvParam(layer_param.convolution_param(), &desc)) {
+      AERROR << "invalid convolution param of layer " << layer_param.name();
+      return false;
+    }
+    if (bottom.size() != 4 || bottom[1] % desc.group != 0 ||
+        desc.num_output % desc.group != 0) {
+      AERROR << "invalid input of convolution layer " << layer_param.name();
+      return false;
+    }
+    if (!QuantizeLayerWeights(layer_param, desc.num_output)) {
+      return false;
+    }
+    conv_descs_[layer_param.name()] = desc;
+    const int extent_h = (desc.kernel_h - 1) * desc.dilation + 1;
+    const int extent_w = (desc.kernel_w - 1) * desc.dilation + 1;
+    std::vector<int> top = bottom;
+    top[1] = desc.num_output;
+    top[2] = (bottom[2] + 2 * desc.padding_h - extent_h) / desc.stride_h + 1;
+    top[3] = (bottom[3] + 2 * desc.padding_w - extent_w) / desc.stride_w + 1;
+    (*shape_map)[layer_param.top(0)] = top;
+  } else if (type == "InnerProduct") {
+    const int num_output = layer_param.inner_product_param().num_output();
+    if (!QuantizeLayerWeights(layer_param, num_output)) {
+      return false;
+    }
+    (*shape_map)[layer_param.top(0)] = {bottom[0], num_output};
+  } else if (type == "Pooling") {
+    PoolingParameter pool_param = layer_param.pooling_param();
+    if (pool_param.has_kernel_size()) {
+      pool_param.set_kernel_h(pool_param.kernel_size());
+      pool_param.set_kernel_w(pool_param.kernel_size());
+    }
+    if (pool_param.has_pad()) {
+      pool_param.set_pad_h(pool_param.pad());
+      pool_param.set_pad_w(pool_param.pad());
+    }
+    if (pool_param.has_stride()) {
+      pool_param.set_stride_h(pool_param.stride());
+      pool_param.set_stride_w(pool_param.stride());
+    }
+    if (pool_param.global_pooling()) {
+      pool_param.set_kernel_h(bottom[2]);
+      pool_param.set_kernel_w(bottom[3]);
+      pool_param.set_pad_h(0);
+      pool_param.set_pad_w(0);
+      pool_param.set_stride_h(1);
+      pool_param.set_stride_w(1);
+    }
+    if (pool_param.kernel_h() < 1 || pool_param.kernel_w() < 1 ||
+        pool_param.stride_h() < 1 || pool_param.stride_w() < 1) {
+      AERROR << "invalid pooling param of layer " << layer_param.name();
+      return false;
+    }
+    const bool floor_mode = pool_param.cmp_out_shape_floor_as_conv();
+    std::vector<int> top = bottom;
+    top[2] = PooledSize(bottom[2], pool_param.kernel_h(), pool_param.pad_h(),
+                        pool_param.stride_h(), floor_mode);
+    top[3] = PooledSize(bottom[3], pool_param.kernel_w(), pool_param.pad_w(),
+                        pool_param.stride_w(), floor_mode);
+    (*shape_map)[layer_param.top(0)] = top;
+    // keep the normalized param, Infer uses it as is
+    *layers_.back().mutable_pooling_param() = pool_param;
+  } else if (type == "Concat") {
+    const int axis = layer_param.concat_param().axis();
+    std::vector<int> top = bottom;
+    for (int i = 1; i < layer_param.bottom_size(); ++i) {
+      auto iter = shape_map->find(layer_param.bottom(i));
+      if (iter == shape_map->end() ||
+          iter->second.size() != bottom.size()) {
+        AERROR << "invalid input of concat layer " << layer_param.name();
+        return false;
+      }
+      top[axis] += iter->second[axis];
+    }
+    (*shape_map)[layer_param.top(0)] = top;
+  } else if (type == "BatchNorm" || type == "Scale") {
+    if (!FoldChannelAffine(layer_param)) {
+      return false;
+    }
+    (*shape_map)[layer_param.top(0)] = bottom;
+  } else if (type == "ReLU" || type == "Softmax" || type == "Eltwise" ||
+             type == "Dropout") {
+    (*shape_map)[layer_param.top(0)] = bottom;
+  } else {
+    AERROR << "unsupported layer type " << type << " of layer "
+           << layer_param.name();
+    return false;
+  }
+  return true;
+}
+
+bool CpuNet::Init(const std::map<std::string, std::vector<int>> &shapes) {
+  NetParameter net_param;
+  if (!ReadProtoFromText(net_file_, &net_param)) {
+    AERROR << "open file " << net_file_ << " failed";
+    return false;
+  }
+  if (!LoadWeights(model_file_)) {
+    return false;
+  }
+
+  std::map<std::string, std::vector<int>> shape_map;
+  layers_.reserve(net_param.layer_size());
+  for (int i = 0; i < net_param.layer_size(); ++i) {
+    const LayerParameter &layer_param = net_param.layer(i);
+    if (layer_param.type() == "Input") {
+      for (int j = 0; j < layer_param.top_size(); ++j) {
+        const std::string &name = layer_param.top(j);
+        auto iter = shapes.find(name);
+        if (iter != shapes.end()) {
+          shape_map[name] = iter->second;
+        } else if (j < layer_param.input_param().shape_size()) {
+          const BlobShape &shape = layer_param.input_param().shape(j);
+          std::vector<int> dims(shape.dim().begin(), shape.dim().end());
+          shape_map[name] = dims;
+        } else {
+          AERROR << "unknown shape of input " << name;
+          return false;
+        }
+      }
+      continue;
+    }
+    layers_.push_back(layer_param);
+    if (!BuildLayer(layers_.back(), &shape_map)) {
+      return false;
+    }
+  }
+
+  for (const auto &shape : shape_map) {
+    blobs_[shape.first].reset(new base::Blob<float>(shape.second));
+  }
+  for (const auto &name : output_names_) {
+    if (blobs_.find(name) == blobs_.end()) {
+      AERROR << "unknown output blob " << name;
+      return false;
+    }
+  }
+  for (const auto &name : input_names_) {
+    if (blobs_.find(name) == blobs_.end()) {
+      AERROR << "unknown input blob " << name;
+      return false;
+    }
+  }
+  return true;
+}
+
+void CpuNet::ForwardConvolution(const LayerParameter &layer_param) {
+  const base::Blob<float> &bottom = *blobs_[layer_param.bottom(0)];
+  base::Blob<float> *top = blobs_[layer_param.top(0)].get();
+  const ConvDesc &desc = conv_descs_[layer_param.name()];
+  const Int8Weights &weights = weights_[layer_param.name()];
+
+  const int num = bottom.shape(0);
+  const int channels = bottom.shape(1);
+  const int height = bottom.shape(2);
+  const int width = bottom.shape(3);
+  const int top_height = top->shape(2);
+  const int top_width = top->shape(3);
+  const int spatial = top_height * top_width;
+  const int group_channels = channels / desc.group;
+  const int group_outputs = desc.num_output / desc.group;
+  const int kernel_dim = group_channels * desc.kernel_h * desc.kernel_w;
+
+  std::vector<int8_t> q_bottom;
+  const float bottom_scale =
+      QuantizeTensor(bottom.cpu_data(), bottom.count(), &q_bottom);
+  float *top_data = top->mutable_cpu_data();
+
+  std::vector<int8_t> col(kernel_dim * spatial);
+  std::vector<int32_t> acc(spatial);
+  for (int n = 0; n < num; ++n) {
+    const int8_t *image = q_bottom.data() + n * channels * height * width;
+    for (int g = 0; g < desc.group; ++g) {
+      // unfold the input patches, padding contributes exact zeros under
+      // symmetric quantization
+      int col_index = 0;
+      for (int c = 0; c < group_channels; ++c) {
+        const int8_t *channel =
+            image + (g * group_channels + c) * height * width;
+        for (int kh = 0; kh < desc.kernel_h; ++kh) {
+          for (int kw = 0; kw < desc.kernel_w; ++kw) {
+            for (int th = 0; th < top_height; ++th) {
+              const int ih = th * desc.stride_h - desc.padding_h +
+                             kh * desc.dilation;
+              for (int tw = 0; tw < top_width; ++tw) {
+                const int iw = tw * desc.stride_w - desc.padding_w +
+                               kw * desc.dilation;
+                col[col_index++] =
+                    (ih >= 0 && ih < height && iw >= 0 && iw < width)
+                        ? channel[ih * width + iw]
+                        : 0;
+              }
+            }
+          }
+        }
+      }
+      for (int o = 0; o < group_outputs; ++o) {
+        const int out_channel = g * group_outputs + o;
+        const int8_t *weight_row =
+            weights.values.data() + out_channel * kernel_dim;
+        std::fill(acc.begin(), acc.end(), 0);
+        for (int k = 0; k < kernel_dim; ++k) {
+          const int32_t weight = weight_row[k];
+          if (weight == 0) {
+            continue;
+          }
+          const int8_t *col_row = col.data() + k * spatial;
+          for (int p = 0; p < spatial; ++p) {
+            acc[p] += weight * col_row[p];
+          }
+        }
+        const float scale = weights.scales[out_channel] * bottom_scale;
+        const float bias = weights.bias[out_channel];
+        float *out = top_data + (n * desc.num_output + out_channel) * spatial;
+        for (int p = 0; p < spatial; ++p) {
+          out[p] = static_cast<float>(acc[p]) * scale + bias;
+        }
+      }
+    }
+  }
+}
+
+void CpuNet::ForwardInnerProduct(const LayerParameter &layer_param) {
+  const base::Blob<float> &bottom = *blobs_[layer_param.bottom(0)];
+  base::Blob<float> *top = blobs_[layer_param.top(0)].get();
+  const Int8Weights &weights = weights_[layer_param.name()];
+
+  const int num = bottom.shape(0);
+  const int dim = bottom.count(1);
+  CHECK_EQ(dim, weights.cols);
+
+  std::vector<int8_t> q_bottom;
+  const float bottom_scale =
+      QuantizeTensor(bottom.cpu_data(), bottom.count(), &q_bottom);
+  float *top_data = top->mutable_cpu_data();
+  for (int n = 0; n < num; ++n) {
+    const int8_t *sample = q_bottom.data() + n * dim;
+    for (int r = 0; r < weights.rows; ++r) {
+      const int8_t *weight_row = weights.values.data() + r * dim;
+      int32_t acc = 0;
+      for (int k = 0; k < dim; ++k) {
+        acc += static_cast<int32_t>(weight_row[k]) * sample[k];
+      }
+      top_data[n * weights.rows + r] =
+          static_cast<float>(acc) * weights.scales[r] * bottom_scale +
+          weights.bias[r];
+    }
+  }
+}
+
+void CpuNet::ForwardReLU(const LayerParameter &layer_param) {
+  const base::Blob<float> &bottom = *blobs_[layer_param.bottom(0)];
+  base::Blob<float> *top = blobs_[layer_param.top(0)].get();
+  const float slope = layer_param.relu_param().negative_slope();
+  const float *bottom_data = bottom.cpu_data();
+  float *top_data = top->mutable_cpu_data();
+  for (int i = 0; i < bottom.count(); ++i) {
+    top_data[i] = bottom_data[i] > 0.f ? bottom_data[i]
+                                       : bottom_data[i] * slope;
+  }
+}
+
+void CpuNet::ForwardPooling(const LayerParameter &layer_param) {
+  const base::Blob<float> &bottom = *blobs_[layer_param.bottom(0)];
+  base::Blob<float> *top = blobs_[layer_param.top(0)].get();
+  const PoolingParameter &pool_param = layer_param.pooling_param();
+
+  const int num = bottom.shape(0);
+  const int channels = bottom.shape(1);
+  const int height = bottom.shape(2);
+  const int width = bottom.shape(3);
+  const int top_height = top->shape(2);
+  const int top_width = top->shape(3);
+  const bool is_max = pool_param.pool() == PoolingParameter::MAX;
+  const float *bottom_data = bottom.cpu_data();
+  float *top_data = top->mutable_cpu_data();
+
+  for (int n = 0; n < num; ++n) {
+    for (int c = 0; c < channels; ++c) {
+      const float *in = bottom_data + (n * channels + c) * height * width;
+      float *out = top_data + (n * channels + c) * top_height * top_width;
+      for (int th = 0; th < top_height; ++th) {
+        for (int tw = 0; tw < top_width; ++tw) {
+          int hstart = th * pool_param.stride_h() - pool_param.pad_h();
+          int wstart = tw * pool_param.stride_w() - pool_param.pad_w();
+          int hend = std::min(hstart + static_cast<int>(pool_param.kernel_h()),
+                              height + static_cast<int>(pool_param.pad_h()));
+          int wend = std::min(wstart + static_cast<int>(pool_param.kernel_w()),
+                              width + static_cast<int>(pool_param.pad_w()));
+          const int pool_size = (hend - hstart) * (wend - wstart);
+          hstart = std::max(hstart, 0);
+          wstart = std::max(wstart, 0);
+          hend = std::min(hend, height);
+          wend = std::min(wend, width);
+          float value = is_max ? -std::numeric_limits<float>::max() : 0.f;
+          for (int h = hstart; h < hend; ++h) {
+            for (int w = wstart; w < wend; ++w) {
+              if (is_max) {
+                value = std::max(value, in[h * width + w]);
+              } else {
+                value += in[h * width + w];
+              }
+            }
+          }
+          out[th * top_width + tw] =
+              is_max ? value : value / static_cast<float>(pool_size);
+        }
+      }
+    }
+  }
+}
+
+void CpuNet::ForwardSoftmax(const LayerParameter &layer_param) {
+  const base::Blob<float> &bottom = *blobs_[layer_param.bottom(0)];
+  base::Blob<float> *top = blobs_[layer_param.top(0)].get();
+  const int axis = layer_param.softmax_param().axis();
+  const int outer = bottom.count(0, axis);
+  const int channels = bottom.shape(axis);
+  const int inner = bottom.count(axis + 1);
+  const float *bottom_data = bottom.cpu_data();
+  float *top_data = top->mutable_cpu_data();
+  for (int o = 0; o < outer; ++o) {
+    for (int i = 0; i < inner; ++i) {
+      const float *in = bottom_data + o * channels * inner + i;
+      float *out = top_data + o * channels * inner + i;
+      float max_value = -std::numeric_limits<float>::max();
+      for (int c = 0; c < channels; ++c) {
+        max_value = std::max(max_value, in[c * inner]);
+      }
+      float sum = 0.f;
+      for (int c = 0; c < channels; ++c) {
+        const float value = std::exp(in[c * inner] - max_value);
+        out[c * inner] = value;
+        sum += value;
+      }
+      for (int c = 0; c < channels; ++c) {
+        out[c * inner] /= sum;
+      }
+    }
+  }
+}
+
+void CpuNet::ForwardConcat(const LayerParameter &layer_param) {
+  base::Blob<float> *top = blobs_[layer_param.top(0)].get();
+  const int axis = layer_param.concat_param().axis();
+  const int outer = top->count(0, axis);
+  const int top_inner = top->count(axis);
+  float *top_data = top->mutable_cpu_data();
+  int offset = 0;
+  for (int i = 0; i < layer_param.bottom_size(); ++i) {
+    const base::Blob<float> &bottom = *blobs_[layer_param.bottom(i)];
+    const int bottom_inner = bottom.count(axis);
+    const float *bottom_data = bottom.cpu_data();
+    for (int o = 0; o < outer; ++o) {
+      memcpy(top_data + o * top_inner + offset,
+             bottom_data + o * bottom_inner, bottom_inner * sizeof(float));
+    }
+    offset += bottom_inner;
+  }
+}
+
+void CpuNet::ForwardEltwise(const LayerParameter &layer_param) {
+  base::Blob<float> *top = blobs_[layer_param.top(0)].get();
+  const EltwiseParameter &eltwise_param = layer_param.eltwise_param();
+  const int count = top->count();
+  float *top_data = top->mutable_cpu_data();
+  const float *first = blobs_[layer_param.bottom(0)]->cpu_data();
+  const float first_coeff =
+      eltwise_param.coeff_size() > 0 ? eltwise_param.coeff(0) : 1.f;
+  for (int i = 0; i < count; ++i) {
+    top_data[i] = first[i] * first_coeff;
+  }
+  for (int b = 1; b < layer_param.bottom_size(); ++b) {
+    const float *bottom_data = blobs_[layer_param.bottom(b)]->cpu_data();
+    const float coeff =
+        eltwise_param.coeff_size() > b ? eltwise_param.coeff(b) : 1.f;
+    for (int i = 0; i < count; ++i) {
+      switch (eltwise_param.operation()) {
+        case EltwiseParameter::PROD:
+          top_data[i] *= bottom_data[i];
+          break;
+        case EltwiseParameter::MAX:
+          top_data[i] = std::max(top_data[i], bottom_data[i]);
+          break;
+        case EltwiseParameter::SUM:
+        default:
+          top_data[i] += bottom_data[i] * coeff;
+          break;
+      }
+    }
+  }
+}
+
+void CpuNet::ForwardChannelAffine(const LayerParameter &layer_param) {
+  const base::Blob<float> &bottom = *blobs_[layer_param.bottom(0)];
+  base::Blob<float> *top = blobs_[layer_param.top(0)].get();
+  const ChannelAffine &affine = affines_[layer_param.name()];
+  const int num = bottom.shape(0);
+  const int channels = bottom.shape(1);
+  const int inner = bottom.count(2);
+  const float *bottom_data = bottom.cpu_data();
+  float *top_data = top->mutable_cpu_data();
+  for (int n = 0; n < num; ++n) {
+    for (int c = 0; c < channels; ++c) {
+      const float scale = affine.scale[c];
+      const float shift = affine.shift[c];
+      const int base = (n * channels + c) * inner;
+      for (int i = 0; i < inner; ++i) {
+        top_data[base + i] = bottom_data[base + i] * scale + shift;
+      }
+    }
+  }
+}
+
+void CpuNet::Infer() {
+  for (const auto &layer_param : layers_) {
+    const std::string &type = layer_param.type();
+    if (type == "Convolution") {
+      ForwardConvolution(layer_param);
+    } else if (type == "InnerProduct") {
+      ForwardInnerProduct(layer_param);
+    } else if (type == "ReLU") {
+      ForwardReLU(layer_param);
+    } else if (type == "Pooling") {
+      ForwardPooling(layer_param);
+    } else if (type == "Softmax") {
+      ForwardSoftmax(layer_param);
+    } else if (type == "Concat") {
+      ForwardConcat(layer_param);
+    } else if (type == "Eltwise") {
+      ForwardEltwise(layer_param);
+    } else if (type == "BatchNorm" || type == "Scale") {
+      ForwardChannelAffine(layer_param);
+    } else if (type == "Dropout") {
+      if (layer_param.bottom(0) != layer_param.top(0)) {
+        const base::Blob<float> &bottom = *blobs_[layer_param.bottom(0)];
+        memcpy(blobs_[layer_param.top(0)]->mutable_cpu_data(),
+               bottom.cpu_data(), bottom.count() * sizeof(float));
+      }
+    }
+  }
+}
+
+std::shared_ptr<base::Blob<float>> CpuNet::get_blob(const std::string &name) {
+  auto iter = blobs_.find(name);
+  if (iter == blobs_.end()) {
+    return nullptr;
+  }
+  return iter->second;
+}
+
+}  // namespace inference
+}  // namespace perception
+}  // namespace apollo
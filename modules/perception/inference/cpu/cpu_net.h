@@ -0,0 +1,115 @@
+/******************************************************************************
+ * Copyright 2020 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "modules/perception/inference/inference.h"
+#include "modules/perception/proto/rt.pb.h"
+
+namespace apollo {
+namespace perception {
+namespace inference {
+
+// A dependency-free CPU backend for the small perception models, meant
+// for degraded-mode deployment on targets without CUDA, TensorRT or
+// Caffe. The network is parsed from the same prototxt/caffemodel pair
+// used by the other backends; convolution and inner product weights are
+// quantized to int8 per output channel at load time and executed with
+// int32 accumulation, activations are quantized per tensor on the fly.
+// Only the layer types used by the small models (lane postprocess and
+// traffic light recognition nets) are supported; Init fails on others.
+class CpuNet : public Inference {
+ public:
+  CpuNet(const std::string &net_file, const std::string &model_file,
+         const std::vector<std::string> &outputs,
+         const std::vector<std::string> &inputs);
+
+  virtual ~CpuNet() = default;
+
+  bool Init(const std::map<std::string, std::vector<int>> &shapes) override;
+
+  void Infer() override;
+
+  std::shared_ptr<base::Blob<float>> get_blob(const std::string &name) override;
+
+ protected:
+  // int8 weights of one convolution or inner product layer, one row per
+  // output channel, with per channel dequantization scales
+  struct Int8Weights {
+    std::vector<int8_t> values;
+    std::vector<float> scales;
+    std::vector<float> bias;
+    int rows = 0;
+    int cols = 0;
+  };
+  // per channel affine transform folded from BatchNorm or Scale layers
+  struct ChannelAffine {
+    std::vector<float> scale;
+    std::vector<float> shift;
+  };
+  struct ConvDesc {
+    int kernel_h = 1;
+    int kernel_w = 1;
+    int padding_h = 0;
+    int padding_w = 0;
+    int stride_h = 1;
+    int stride_w = 1;
+    int group = 1;
+    int dilation = 1;
+    int num_output = 0;
+  };
+
+  static bool ParseConvParam(const ConvolutionParameter &conv_param,
+                             ConvDesc *desc);
+
+  bool LoadWeights(const std::string &model_file);
+  bool BuildLayer(const LayerParameter &layer_param,
+                  std::map<std::string, std::vector<int>> *shape_map);
+  bool QuantizeLayerWeights(const LayerParameter &layer_param, int num_output);
+  bool FoldChannelAffine(const LayerParameter &layer_param);
+
+  void ForwardConvolution(const LayerParameter &layer_param);
+  void ForwardInnerProduct(const LayerParameter &layer_param);
+  void ForwardReLU(const LayerParameter &layer_param);
+  void ForwardPooling(const LayerParameter &layer_param);
+  void ForwardSoftmax(const LayerParameter &layer_param);
+  void ForwardConcat(const LayerParameter &layer_param);
+  void ForwardEltwise(const LayerParameter &layer_param);
+  void ForwardChannelAffine(const LayerParameter &layer_param);
+
+ private:
+  std::string net_file_;
+  std::string model_file_;
+  std::vector<std::string> output_names_;
+  std::vector<std::string> input_names_;
+
+  std::vector<LayerParameter> layers_;
+  std::map<std::string, const LayerParameter *> weight_layer_map_;
+  NetParameter weight_param_;
+  std::map<std::string, Int8Weights> weights_;
+  std::map<std::string, ChannelAffine> affines_;
+  std::map<std::string, ConvDesc> conv_descs_;
+  BlobMap blobs_;
+};
+
+}  // namespace inference
+}  // namespace perception
+}  // namespace apollo
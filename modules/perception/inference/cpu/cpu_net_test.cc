@@ -0,0 +1,88 @@
+/******************************************************************************
+ * Copyright 2020 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "modules/perception/inference/cpu/cpu_net.h"
+
+#include "gtest/gtest.h"
+
+namespace apollo {
+namespace perception {
+namespace inference {
+
+class TestableCpuNet : public CpuNet {
+ public:
+  TestableCpuNet(const std::string &net_file, const std::string &model_file,
+                 const std::vector<std::string> &outputs,
+                 const std::vector<std::string> &inputs)
+      : CpuNet(net_file, model_file, outputs, inputs) {}
+  using CpuNet::ConvDesc;
+  using CpuNet::ParseConvParam;
+};
+
+TEST(CpuNetTest, parse_conv_param) {
+  ConvolutionParameter conv_param;
+  TestableCpuNet::ConvDesc desc;
+  // missing kernel size
+  EXPECT_FALSE(TestableCpuNet::ParseConvParam(conv_param, &desc));
+
+  conv_param.set_num_output(16);
+  conv_param.add_kernel_size(3);
+  EXPECT_TRUE(TestableCpuNet::ParseConvParam(conv_param, &desc));
+  EXPECT_EQ(desc.kernel_h, 3);
+  EXPECT_EQ(desc.kernel_w, 3);
+  EXPECT_EQ(desc.padding_h, 0);
+  EXPECT_EQ(desc.stride_h, 1);
+  EXPECT_EQ(desc.group, 1);
+  EXPECT_EQ(desc.dilation, 1);
+  EXPECT_EQ(desc.num_output, 16);
+
+  conv_param.add_pad(1);
+  conv_param.add_stride(2);
+  conv_param.set_group(16);
+  EXPECT_TRUE(TestableCpuNet::ParseConvParam(conv_param, &desc));
+  EXPECT_EQ(desc.padding_h, 1);
+  EXPECT_EQ(desc.padding_w, 1);
+  EXPECT_EQ(desc.stride_h, 2);
+  EXPECT_EQ(desc.stride_w, 2);
+  EXPECT_EQ(desc.group, 16);
+
+  ConvolutionParameter hw_param;
+  hw_param.set_num_output(8);
+  hw_param.set_kernel_h(1);
+  hw_param.set_kernel_w(5);
+  hw_param.set_pad_h(0);
+  hw_param.set_pad_w(2);
+  hw_param.set_stride_h(1);
+  hw_param.set_stride_w(1);
+  EXPECT_TRUE(TestableCpuNet::ParseConvParam(hw_param, &desc));
+  EXPECT_EQ(desc.kernel_h, 1);
+  EXPECT_EQ(desc.kernel_w, 5);
+  EXPECT_EQ(desc.padding_h, 0);
+  EXPECT_EQ(desc.padding_w, 2);
+}
+
+TEST(CpuNetTest, init_missing_model) {
+  std::vector<std::string> outputs{"prob"};
+  std::vector<std::string> inputs{"data"};
+  CpuNet net("not_exist.prototxt", "not_exist.caffemodel", outputs, inputs);
+  std::map<std::string, std::vector<int>> shapes;
+  EXPECT_FALSE(net.Init(shapes));
+  EXPECT_EQ(net.get_blob("prob"), nullptr);
+}
+
+}  // namespace inference
+}  // namespace perception
+}  // namespace apollo
@@ -36,6 +36,14 @@ typedef std::map<std::string,
 class Inference {
  public:
   virtual void Infer() = 0;
+
+  // Issue the forward pass without waiting for it to finish; backends
+  // without asynchronous execution fall back to a blocking Infer().
+  virtual void InferAsync() { Infer(); }
+
+  // Wait for the forward pass issued by InferAsync to finish.
+  virtual void Synchronize() {}
+
   Inference() = default;
 
   virtual ~Inference() = default;
@@ -0,0 +1,38 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "modules/perception/inference/inference_scheduler.h"
+
+namespace apollo {
+namespace perception {
+namespace inference {
+
+void InferenceScheduler::AddNetwork(std::shared_ptr<Inference> network) {
+  networks_.push_back(network);
+}
+
+void InferenceScheduler::Infer() {
+  for (auto &network : networks_) {
+    network->InferAsync();
+  }
+  for (auto &network : networks_) {
+    network->Synchronize();
+  }
+}
+
+}  // namespace inference
+}  // namespace perception
+}  // namespace apollo
@@ -0,0 +1,48 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "modules/perception/inference/inference.h"
+
+namespace apollo {
+namespace perception {
+namespace inference {
+
+// Runs a group of networks concurrently: all forward passes are issued
+// with InferAsync before any of them is waited on with Synchronize, so
+// networks with their own streams (e.g. one RTNet per camera channel)
+// overlap on the device instead of serializing.
+class InferenceScheduler {
+ public:
+  InferenceScheduler() = default;
+
+  ~InferenceScheduler() = default;
+
+  void AddNetwork(std::shared_ptr<Inference> network);
+
+  void Infer();
+
+ private:
+  std::vector<std::shared_ptr<Inference>> networks_;
+};
+
+}  // namespace inference
+}  // namespace perception
+}  // namespace apollo
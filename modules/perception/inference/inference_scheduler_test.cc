@@ -0,0 +1,75 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "modules/perception/inference/inference_scheduler.h"
+
+#include <string>
+
+#include "gtest/gtest.h"
+
+namespace apollo {
+namespace perception {
+namespace inference {
+
+namespace {
+
+class RecordingNet : public Inference {
+ public:
+  explicit RecordingNet(std::vector<std::string> *calls, const std::string &id)
+      : calls_(calls), id_(id) {}
+
+  bool Init(const std::map<std::string, std::vector<int>> &shapes) override {
+    return true;
+  }
+
+  void Infer() override { calls_->push_back(id_ + ":infer"); }
+
+  void InferAsync() override { calls_->push_back(id_ + ":async"); }
+
+  void Synchronize() override { calls_->push_back(id_ + ":sync"); }
+
+  std::shared_ptr<apollo::perception::base::Blob<float>> get_blob(
+      const std::string &name) override {
+    return nullptr;
+  }
+
+ private:
+  std::vector<std::string> *calls_;
+  std::string id_;
+};
+
+}  // namespace
+
+TEST(InferenceSchedulerTest, issue_all_before_wait) {
+  std::vector<std::string> calls;
+  InferenceScheduler scheduler;
+  scheduler.AddNetwork(std::make_shared<RecordingNet>(&calls, "a"));
+  scheduler.AddNetwork(std::make_shared<RecordingNet>(&calls, "b"));
+  scheduler.AddNetwork(std::make_shared<RecordingNet>(&calls, "c"));
+  scheduler.Infer();
+  std::vector<std::string> expected = {"a:async", "b:async", "c:async",
+                                       "a:sync",  "b:sync",  "c:sync"};
+  EXPECT_EQ(expected, calls);
+}
+
+TEST(InferenceSchedulerTest, empty) {
+  InferenceScheduler scheduler;
+  scheduler.Infer();
+}
+
+}  // namespace inference
+}  // namespace perception
+}  // namespace apollo
@@ -43,6 +43,28 @@ BatchStream::BatchStream(int batchSize, int maxBatches, std::string dataPath)
 
 BatchStream::BatchStream() : mPath("") {}
 
+BatchStream::BatchStream(const BatchStream &other) { *this = other; }
+
+BatchStream &BatchStream::operator=(const BatchStream &other) {
+  if (this == &other) {
+    return *this;
+  }
+  stopPrefetch();
+  mBatchSize = other.mBatchSize;
+  mMaxBatches = other.mMaxBatches;
+  mBatchCount = other.mBatchCount;
+  mFileCount = other.mFileCount;
+  mFileBatchPos = other.mFileBatchPos;
+  mImageSize = other.mImageSize;
+  mDims = other.mDims;
+  mBatch = other.mBatch;
+  mFileBatch = other.mFileBatch;
+  mPath = other.mPath;
+  return *this;
+}
+
+BatchStream::~BatchStream() { stopPrefetch(); }
+
 void BatchStream::reset(int firstBatch) {
   if (mPath != "") {
     mBatchCount = 0;
@@ -91,7 +113,39 @@ void BatchStream::skip(int skipCount) {
 }
 
 bool BatchStream::update() {
-  std::string inputFileName = absl::StrCat(mPath, "Batch", mFileCount++);
+  while (true) {
+    {
+      std::unique_lock<std::mutex> lock(mPrefetchMutex);
+      if (mPrefetchActive || !mPrefetched.empty()) {
+        mPrefetchCond.wait(lock, [this] {
+          return !mPrefetched.empty() || !mPrefetchActive;
+        });
+        if (!mPrefetched.empty() &&
+            mPrefetched.front().fileIndex == mFileCount) {
+          FileBlock block = std::move(mPrefetched.front());
+          mPrefetched.pop_front();
+          mPrefetchCond.notify_all();
+          if (!block.valid) {
+            return false;
+          }
+          mFileBatch.swap(block.data);
+          ++mFileCount;
+          mFileBatchPos = 0;
+          return true;
+        }
+        // the buffered data is stale after a reset or skip, or the
+        // worker exited, reload from the current position
+      }
+    }
+    stopPrefetch();
+    startPrefetch();
+  }
+}
+
+bool BatchStream::readFileBlock(int fileIndex, FileBlock *block) {
+  block->fileIndex = fileIndex;
+  block->valid = false;
+  std::string inputFileName = absl::StrCat(mPath, "Batch", fileIndex);
   FILE *file = fopen(inputFileName.c_str(), "rb");
   if (file == nullptr) {
     return false;
@@ -103,14 +157,73 @@ bool BatchStream::update() {
   ACHECK(mDims.n() == d[0] && mDims.c() == d[1] && mDims.h() == d[2] &&
          mDims.w() == d[3]);
 
+  block->data.resize(mDims.n() * mImageSize);
   size_t readInputCount =
-      fread(getFileBatch(), sizeof(float), mDims.n() * mImageSize, file);
+      fread(block->data.data(), sizeof(float), mDims.n() * mImageSize, file);
   CHECK_EQ(readInputCount, size_t(mDims.n() * mImageSize));
   fclose(file);
-  mFileBatchPos = 0;
+  block->valid = true;
   return true;
 }
 
+void BatchStream::startPrefetch() {
+  std::lock_guard<std::mutex> lock(mPrefetchMutex);
+  mPrefetchFileCount = mFileCount;
+  mPrefetchStop = false;
+  mPrefetchActive = true;
+  mPrefetchThread = std::thread(&BatchStream::prefetchLoop, this);
+}
+
+void BatchStream::stopPrefetch() {
+  {
+    std::lock_guard<std::mutex> lock(mPrefetchMutex);
+    mPrefetchStop = true;
+  }
+  mPrefetchCond.notify_all();
+  if (mPrefetchThread.joinable()) {
+    mPrefetchThread.join();
+  }
+  std::lock_guard<std::mutex> lock(mPrefetchMutex);
+  mPrefetched.clear();
+  mPrefetchStop = false;
+  mPrefetchActive = false;
+}
+
+void BatchStream::prefetchLoop() {
+  while (true) {
+    int fileIndex = 0;
+    {
+      std::unique_lock<std::mutex> lock(mPrefetchMutex);
+      mPrefetchCond.wait(lock, [this] {
+        return mPrefetchStop ||
+               mPrefetched.size() < static_cast<size_t>(kPrefetchDepth);
+      });
+      if (mPrefetchStop) {
+        mPrefetchActive = false;
+        mPrefetchCond.notify_all();
+        return;
+      }
+      fileIndex = mPrefetchFileCount++;
+    }
+    FileBlock block;
+    readFileBlock(fileIndex, &block);
+    const bool valid = block.valid;
+    {
+      std::lock_guard<std::mutex> lock(mPrefetchMutex);
+      mPrefetched.push_back(std::move(block));
+      if (!valid) {
+        // a missing file marks the end of the data set, the worker
+        // exits and is restarted on the next reset
+        mPrefetchActive = false;
+      }
+    }
+    mPrefetchCond.notify_all();
+    if (!valid) {
+      return;
+    }
+  }
+}
+
 }  // namespace inference
 }  // namespace perception
 }  // namespace apollo
@@ -16,7 +16,11 @@
 
 #pragma once
 
+#include <condition_variable>
+#include <deque>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "NvInfer.h"
@@ -29,6 +33,11 @@ class BatchStream {
  public:
   BatchStream(int batchSize, int maxBatches, std::string data_path);
   BatchStream();
+  // copies transfer the read position only, the prefetch worker is
+  // restarted lazily on the next read
+  BatchStream(const BatchStream &other);
+  BatchStream &operator=(const BatchStream &other);
+  ~BatchStream();
 
   // @brief reset current batch id
   void reset(int firstBatch);
@@ -45,9 +54,20 @@ class BatchStream {
   nvinfer1::DimsNCHW getDims() const { return mDims; }
 
  private:
+  // one file worth of calibration data, read ahead by the worker
+  struct FileBlock {
+    std::vector<float> data;
+    int fileIndex{0};
+    bool valid{false};
+  };
+
   float *getFileBatch() { return &mFileBatch[0]; }
 
   bool update();
+  bool readFileBlock(int fileIndex, FileBlock *block);
+  void startPrefetch();
+  void stopPrefetch();
+  void prefetchLoop();
 
   int mBatchSize{0};
   int mMaxBatches{0};
@@ -61,6 +81,17 @@ class BatchStream {
   std::vector<float> mBatch;
   std::vector<float> mFileBatch;
   std::string mPath;
+
+  // double buffered prefetch, the worker stays kPrefetchDepth files
+  // ahead of the consumer so disk reads overlap calibration
+  static constexpr int kPrefetchDepth = 2;
+  std::thread mPrefetchThread;
+  std::mutex mPrefetchMutex;
+  std::condition_variable mPrefetchCond;
+  std::deque<FileBlock> mPrefetched;
+  int mPrefetchFileCount{0};
+  bool mPrefetchStop{false};
+  bool mPrefetchActive{false};
 };
 
 }  // namespace inference
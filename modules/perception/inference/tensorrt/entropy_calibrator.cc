@@ -16,6 +16,9 @@
 #include "modules/perception/inference/tensorrt/entropy_calibrator.h"
 
 #include <cuda_runtime_api.h>
+
+#include <cstdio>
+#include <cstring>
 #include <fstream>
 
 namespace nvinfer1 {
@@ -47,6 +50,10 @@ Int8EntropyCalibrator::Int8EntropyCalibrator(
   DimsNCHW dims = stream_.getDims();
   input_count_ = stream_.getBatchSize() * dims.c() * dims.h() * dims.w();
   cudaMalloc(&device_input_, input_count_ * sizeof(float));
+  if (cudaMallocHost(reinterpret_cast<void **>(&pinned_input_),
+                     input_count_ * sizeof(float)) != cudaSuccess) {
+    pinned_input_ = nullptr;
+  }
   stream_.reset(first_batch);
 }
 
@@ -54,6 +61,9 @@ Int8EntropyCalibrator::~Int8EntropyCalibrator() {
   if (device_input_) {
     (cudaFree(device_input_));
   }
+  if (pinned_input_) {
+    (cudaFreeHost(pinned_input_));
+  }
 }
 
 bool Int8EntropyCalibrator::getBatch(void *bindings[], const char *names[],
@@ -62,7 +72,12 @@ bool Int8EntropyCalibrator::getBatch(void *bindings[], const char *names[],
     return false;
   }
 
-  (cudaMemcpy(device_input_, stream_.getBatch(), input_count_ * sizeof(float),
+  const float *host_input = stream_.getBatch();
+  if (pinned_input_ != nullptr) {
+    memcpy(pinned_input_, host_input, input_count_ * sizeof(float));
+    host_input = pinned_input_;
+  }
+  (cudaMemcpy(device_input_, host_input, input_count_ * sizeof(float),
               cudaMemcpyHostToDevice));
   bindings[0] = device_input_;
   return true;
@@ -85,10 +100,17 @@ const void *Int8EntropyCalibrator::readCalibrationCache(size_t &length) {
 
 void Int8EntropyCalibrator::writeCalibrationCache(const void *cache,
                                                   size_t length) {
-  std::ofstream output(
-      apollo::perception::inference::locateFile(network_, "CalibrationTable"),
-      std::ios::binary);
-  output.write(reinterpret_cast<const char *>(cache), length);
+  // write aside and rename, so an interrupted calibration run never
+  // leaves a truncated table behind and the next run can reuse the
+  // last complete one as its checkpoint
+  const std::string table =
+      apollo::perception::inference::locateFile(network_, "CalibrationTable");
+  const std::string temp_table = table + ".tmp";
+  {
+    std::ofstream output(temp_table, std::ios::binary);
+    output.write(reinterpret_cast<const char *>(cache), length);
+  }
+  std::rename(temp_table.c_str(), table.c_str());
 }
 
 }  //  namespace nvinfer1
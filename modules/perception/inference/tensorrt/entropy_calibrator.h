@@ -58,6 +58,8 @@ class Int8EntropyCalibrator : public IInt8EntropyCalibrator {
   std::string network_ = "yolo";
   size_t input_count_;
   void *device_input_ = nullptr;
+  // pinned staging buffer, lets the host to device copy use DMA
+  float *pinned_input_ = nullptr;
   std::vector<char> calibration_cache_;
 };
 
@@ -16,7 +16,13 @@
 
 #include "modules/perception/inference/tensorrt/rt_net.h"
 
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
 #include <algorithm>
+#include <fstream>
 #include <utility>
 
 #include "absl/strings/str_cat.h"
@@ -39,6 +45,27 @@ namespace apollo {
 namespace perception {
 namespace inference {
 
+namespace {
+
+// FNV-1a over the file content, used to key the engine plan cache so a
+// changed prototxt or caffemodel never hits a stale plan.
+uint64_t HashFileContent(const std::string &filename) {
+  std::ifstream input(filename, std::ios::binary);
+  uint64_t hash = 14695981039346656037ULL;
+  char buffer[4096];
+  while (input.good()) {
+    input.read(buffer, sizeof(buffer));
+    const std::streamsize count = input.gcount();
+    for (std::streamsize i = 0; i < count; ++i) {
+      hash ^= static_cast<unsigned char>(buffer[i]);
+      hash *= 1099511628211ULL;
+    }
+  }
+  return hash;
+}
+
+}  // namespace
+
 void RTNet::ConstructMap(const LayerParameter &layer_param,
                          nvinfer1::ILayer *layer, TensorMap *tensor_map,
                          TensorModifyMap *tensor_modify_map) {
@@ -550,6 +577,8 @@ RTNet::RTNet(const std::string &net_file, const std::string &model_file,
   loadWeights(model_file, &weight_map_);
   net_param_.reset(new NetParameter);
   loadNetParams(net_file, net_param_.get());
+  net_file_ = net_file;
+  model_file_ = model_file;
 }
 RTNet::RTNet(const std::string &net_file, const std::string &model_file,
              const std::vector<std::string> &outputs,
@@ -559,6 +588,8 @@ RTNet::RTNet(const std::string &net_file, const std::string &model_file,
   loadWeights(model_file, &weight_map_);
   net_param_.reset(new NetParameter);
   loadNetParams(net_file, net_param_.get());
+  net_file_ = net_file;
+  model_file_ = model_file;
   calibrator_ = calibrator;
   is_own_calibrator_ = false;
 }
@@ -570,6 +601,8 @@ RTNet::RTNet(const std::string &net_file, const std::string &model_file,
   loadWeights(model_file, &weight_map_);
   net_param_.reset(new NetParameter);
   loadNetParams(net_file, net_param_.get());
+  net_file_ = net_file;
+  model_file_ = model_file;
   model_root_ = model_root;
   BatchStream stream;
 
@@ -644,7 +677,20 @@ bool RTNet::Init(const std::map<std::string, std::vector<int>> &shapes) {
 
   builder_->setDebugSync(true);
 
-  nvinfer1::ICudaEngine *engine = builder_->buildCudaEngine(*network_);
+  // Building the engine auto-tunes every layer and dominates cold start,
+  // so a serialized plan is reused whenever one matches the model files,
+  // the GPU and the TensorRT version.
+  const std::string engine_file = engineCachePath(prop.name, int8_mode);
+  nvinfer1::ICudaEngine *engine = nullptr;
+  if (!engine_file.empty()) {
+    engine = deserializeEngineFromFile(engine_file);
+  }
+  if (engine == nullptr) {
+    engine = builder_->buildCudaEngine(*network_);
+    if (!engine_file.empty()) {
+      serializeEngineToFile(engine_file, engine);
+    }
+  }
   context_ = engine->createExecutionContext();
   buffers_.resize(input_names_.size() + output_names_.size());
   init_blob(&input_names_);
@@ -667,6 +713,72 @@ bool RTNet::checkInt8(const std::string &gpu_name,
   calibrator_ = nullptr;
   return false;
 }
+
+std::string RTNet::engineCachePath(const std::string &gpu_name,
+                                   bool int8_mode) {
+  if (model_root_.empty()) {
+    return "";
+  }
+  std::string device_name = gpu_name;
+  std::replace(device_name.begin(), device_name.end(), ' ', '_');
+  return absl::StrCat(model_root_, "/trt_engine_",
+                      HashFileContent(net_file_), "_",
+                      HashFileContent(model_file_), "_", device_name, "_",
+                      getInferLibVersion(), int8_mode ? "_int8" : "_fp32",
+                      ".plan");
+}
+
+nvinfer1::ICudaEngine *RTNet::deserializeEngineFromFile(
+    const std::string &filename) {
+  const int fd = open(filename.c_str(), O_RDONLY);
+  if (fd < 0) {
+    return nullptr;
+  }
+  struct stat file_stat;
+  if (fstat(fd, &file_stat) < 0 || file_stat.st_size <= 0) {
+    close(fd);
+    return nullptr;
+  }
+  const size_t size = static_cast<size_t>(file_stat.st_size);
+  void *data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (data == MAP_FAILED) {
+    AWARN << "Failed to mmap engine plan: " << filename;
+    return nullptr;
+  }
+  runtime_ = nvinfer1::createInferRuntime(rt_gLogger);
+  nvinfer1::ICudaEngine *engine =
+      runtime_->deserializeCudaEngine(data, size, nullptr);
+  munmap(data, size);
+  if (engine == nullptr) {
+    // Plans of networks with custom plugin layers cannot be restored
+    // without a plugin factory; fall back to building the engine.
+    AWARN << "Failed to deserialize engine plan: " << filename;
+    runtime_->destroy();
+    runtime_ = nullptr;
+    return nullptr;
+  }
+  AINFO << "Reused engine plan: " << filename;
+  return engine;
+}
+
+void RTNet::serializeEngineToFile(const std::string &filename,
+                                  nvinfer1::ICudaEngine *engine) {
+  nvinfer1::IHostMemory *plan = engine->serialize();
+  if (plan == nullptr) {
+    AWARN << "Failed to serialize the engine.";
+    return;
+  }
+  std::ofstream output(filename, std::ios::binary);
+  if (output.good()) {
+    output.write(static_cast<const char *>(plan->data()),
+                 static_cast<std::streamsize>(plan->size()));
+    AINFO << "Saved engine plan: " << filename;
+  } else {
+    AWARN << "Failed to write engine plan: " << filename;
+  }
+  plan->destroy();
+}
 bool RTNet::addInput(const TensorDimsMap &tensor_dims_map,
                      const std::map<std::string, std::vector<int>> &shapes,
                      TensorMap *tensor_map) {
@@ -734,6 +846,9 @@ RTNet::~RTNet() {
     network_->destroy();
     builder_->destroy();
     context_->destroy();
+    if (runtime_ != nullptr) {
+      runtime_->destroy();
+    }
     for (auto buf : buffers_) {
       cudaFree(buf);
     }
@@ -741,6 +856,11 @@ RTNet::~RTNet() {
 }
 
 void RTNet::Infer() {
+  InferAsync();
+  Synchronize();
+}
+
+void RTNet::InferAsync() {
   BASE_CUDA_CHECK(cudaSetDevice(gpu_id_));
   BASE_CUDA_CHECK(cudaStreamSynchronize(stream_));
   for (auto name : input_names_) {
@@ -762,6 +882,10 @@ void RTNet::Infer() {
     }
   }
   context_->enqueue(max_batch_size_, &buffers_[0], stream_, nullptr);
+}
+
+void RTNet::Synchronize() {
+  BASE_CUDA_CHECK(cudaSetDevice(gpu_id_));
   BASE_CUDA_CHECK(cudaStreamSynchronize(stream_));
 
   for (auto name : output_names_) {
@@ -72,6 +72,10 @@ class RTNet : public Inference {
 
   void Infer() override;
 
+  void InferAsync() override;
+
+  void Synchronize() override;
+
   std::shared_ptr<apollo::perception::base::Blob<float>> get_blob(
       const std::string &name) override;
 
@@ -168,6 +172,13 @@ class RTNet : public Inference {
                        TensorModifyMap *tensor_modify_map);
   bool checkInt8(const std::string &gpu_name,
                  nvinfer1::IInt8Calibrator *calibrator);
+  // Path of the serialized engine plan, keyed by the model files' hash,
+  // the GPU name, the TensorRT version and the precision mode; empty
+  // when no model root is configured, which disables the plan cache.
+  std::string engineCachePath(const std::string &gpu_name, bool int8_mode);
+  nvinfer1::ICudaEngine *deserializeEngineFromFile(const std::string &filename);
+  void serializeEngineToFile(const std::string &filename,
+                             nvinfer1::ICudaEngine *engine);
   void mergeBN(int index, LayerParameter *layer_param);
   nvinfer1::Weights loadLayerWeights(const float *data, int size);
   nvinfer1::Weights loadLayerWeights(float data, int size);
@@ -193,6 +204,9 @@ class RTNet : public Inference {
   nvinfer1::Int8EntropyCalibrator *calibrator_ = nullptr;
   bool is_own_calibrator_ = true;
   std::string model_root_;
+  std::string net_file_;
+  std::string model_file_;
+  nvinfer1::IRuntime *runtime_ = nullptr;
   nvinfer1::IBuilder *builder_ = nullptr;
   nvinfer1::INetworkDefinition *network_ = nullptr;
   std::vector<std::shared_ptr<float>> weights_mem_;
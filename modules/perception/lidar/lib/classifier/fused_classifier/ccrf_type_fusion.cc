@@ -15,6 +15,8 @@
  *****************************************************************************/
 #include "modules/perception/lidar/lib/classifier/fused_classifier/ccrf_type_fusion.h"
 
+#include <iterator>
+
 #include "cyber/common/file.h"
 #include "cyber/common/log.h"
 #include "modules/perception/base/object_types.h"
@@ -84,6 +86,94 @@ bool CCRFOneShotTypeFusion::TypeFusion(const TypeFusionOption& option,
   return true;
 }
 
+bool CCRFOneShotTypeFusion::TypeFusionBatch(
+    const TypeFusionOption& option, const std::vector<ObjectPtr>& objects) {
+  std::vector<Vectord, Eigen::aligned_allocator<Vectord>> log_probs;
+  const bool all_fused = FuseBatchTypeProbs(objects, &log_probs);
+  for (size_t i = 0; i < objects.size(); ++i) {
+    if (objects[i] == nullptr ||
+        objects[i]->lidar_supplement.raw_probs.empty()) {
+      continue;
+    }
+    util::ToExp(&log_probs[i]);
+    util::Normalize(&log_probs[i]);
+    util::FromEigenToVector(log_probs[i], &(objects[i]->type_probs));
+    objects[i]->type = static_cast<ObjectType>(
+        std::distance(objects[i]->type_probs.begin(),
+                      std::max_element(objects[i]->type_probs.begin(),
+                                       objects[i]->type_probs.end())));
+  }
+  return all_fused;
+}
+
+bool CCRFOneShotTypeFusion::FuseBatchTypeProbs(
+    const std::vector<ObjectPtr>& objects,
+    std::vector<Vectord, Eigen::aligned_allocator<Vectord>>* log_probs) {
+  if (log_probs == nullptr) {
+    return false;
+  }
+  const int num_objects = static_cast<int>(objects.size());
+  log_probs->assign(num_objects, Vectord::Zero());
+
+  // each entry is (object index, raw probability index); all entries of one
+  // batch share the same smooth matrix, the unsmoothed ones go to ""
+  std::map<std::string, std::vector<std::pair<int, int>>> batches;
+  bool all_valid = true;
+  for (int i = 0; i < num_objects; ++i) {
+    if (objects[i] == nullptr) {
+      all_valid = false;
+      continue;
+    }
+    const auto& vecs = objects[i]->lidar_supplement.raw_probs;
+    const auto& names = objects[i]->lidar_supplement.raw_classification_methods;
+    if (vecs.empty()) {
+      all_valid = false;
+      continue;
+    }
+    for (size_t j = 0; j < vecs.size(); ++j) {
+      if (vecs.size() == 1 ||
+          smooth_matrices_.find(names[j]) == smooth_matrices_.end()) {
+        batches[""].emplace_back(i, static_cast<int>(j));
+      } else {
+        batches[names[j]].emplace_back(i, static_cast<int>(j));
+      }
+    }
+  }
+
+  Eigen::Matrix<double, VALID_OBJECT_TYPE, Eigen::Dynamic> probs;
+  Eigen::Matrix<double, VALID_OBJECT_TYPE, Eigen::Dynamic> smoothed;
+  Vectord single_prob;
+  for (const auto& batch : batches) {
+    const auto& entries = batch.second;
+    const int num_cols = static_cast<int>(entries.size());
+    probs.resize(VALID_OBJECT_TYPE, num_cols);
+    for (int c = 0; c < num_cols; ++c) {
+      const auto& vec = objects[entries[c].first]
+                            ->lidar_supplement.raw_probs[entries[c].second];
+      util::FromStdToVector(vec, &single_prob);
+      probs.col(c) = single_prob;
+    }
+    if (!batch.first.empty()) {
+      probs = smooth_matrices_[batch.first] * probs;
+    }
+    probs.array() += 1e-6;
+    for (int c = 0; c < num_cols; ++c) {
+      double sum = probs.col(c).sum();
+      sum = sum < 1e-9 ? 1e-9 : sum;
+      probs.col(c) /= sum;
+    }
+    // p(c|x) = p(c|x,o)p(o|x)+ p(c|x,~o)p(~o|x), one product per batch
+    smoothed = confidence_smooth_matrix_ * probs;
+    for (int c = 0; c < num_cols; ++c) {
+      const double conf = objects[entries[c].first]->confidence;
+      single_prob = conf * probs.col(c) + (1.0 - conf) * smoothed.col(c);
+      util::ToLog(&single_prob);
+      (*log_probs)[entries[c].first] += single_prob;
+    }
+  }
+  return all_valid;
+}
+
 bool CCRFOneShotTypeFusion::FuseOneShotTypeProbs(const ObjectPtr& object,
                                                  Vectord* log_prob) {
   if (object == nullptr) {
@@ -168,18 +258,61 @@ bool CCRFSequenceTypeFusion::TypeFusion(const TypeFusionOption& option,
 bool CCRFSequenceTypeFusion::FuseWithConditionalProbabilityInference(
     TrackedObjects* tracked_objects) {
   // AINFO << "Enter fuse with conditional probability inference";
-  fused_oneshot_probs_.resize(tracked_objects->size());
+  const int track_id = tracked_objects->rbegin()->second->track_id;
+  const double newest_timestamp = tracked_objects->rbegin()->first;
 
-  std::size_t i = 0;
-  for (auto& pair : *tracked_objects) {
-    ObjectPtr& object = pair.second;
-    if (!one_shot_fuser_.FuseOneShotTypeProbs(object,
-                                              &fused_oneshot_probs_[i++])) {
-      AERROR << "Failed to fuse one short probs in sequence.";
-      return false;
+  // The viterbi forward recursion only needs the previous frame's fused
+  // log probability, so when the cached per-track state matches the
+  // second-newest frame, a single transition step replaces the full re-run
+  // over the temporal window.
+  if (tracked_objects->size() > 1) {
+    auto cached = track_states_.find(track_id);
+    auto second_newest = std::next(tracked_objects->rbegin());
+    if (cached != track_states_.end() &&
+        cached->second.timestamp == second_newest->first) {
+      ObjectPtr object = tracked_objects->rbegin()->second;
+      Vectord oneshot_prob;
+      if (!one_shot_fuser_.FuseOneShotTypeProbs(object, &oneshot_prob)) {
+        AERROR << "Failed to fuse one short probs in sequence.";
+        return false;
+      }
+      // a constant shift keeps log values bounded over long tracks and
+      // changes neither the argmax nor the normalized probabilities
+      Vectord prev = cached->second.fused_log_prob;
+      prev -= Vectord::Ones() * prev.maxCoeff();
+      Vectord curr;
+      for (std::size_t right = 0; right < VALID_OBJECT_TYPE; ++right) {
+        double max_prob = -DBL_MAX;
+        for (std::size_t left = 0; left < VALID_OBJECT_TYPE; ++left) {
+          const double prob = prev(left) +
+                              transition_matrix_(left, right) * s_alpha_ +
+                              oneshot_prob(right);
+          if (prob > max_prob) {
+            max_prob = prob;
+          }
+        }
+        curr(right) = max_prob;
+      }
+      cached->second.timestamp = newest_timestamp;
+      cached->second.fused_log_prob = curr;
+      PruneStaleTrackStates(newest_timestamp);
+      return RecoverFromLogProbability(&curr, &object->type_probs,
+                                       &object->type);
     }
   }
 
+  fused_oneshot_probs_.resize(tracked_objects->size());
+  std::vector<ObjectPtr> window_objects;
+  window_objects.reserve(tracked_objects->size());
+  for (auto& pair : *tracked_objects) {
+    window_objects.push_back(pair.second);
+  }
+  if (!one_shot_fuser_.FuseBatchTypeProbs(window_objects,
+                                          &fused_oneshot_probs_)) {
+    AERROR << "Failed to fuse one short probs in sequence.";
+    return false;
+  }
+
   // Use viterbi algorithm to infer the state
   std::size_t length = tracked_objects->size();
   fused_sequence_probs_.resize(length);
@@ -207,12 +340,29 @@ bool CCRFSequenceTypeFusion::FuseWithConditionalProbabilityInference(
       state_back_trace_[i](right) = static_cast<int>(id);
     }
   }
+  TrackState& state = track_states_[track_id];
+  state.timestamp = newest_timestamp;
+  state.fused_log_prob = fused_sequence_probs_.back();
+  PruneStaleTrackStates(newest_timestamp);
+
   ObjectPtr object = tracked_objects->rbegin()->second;
   RecoverFromLogProbability(&fused_sequence_probs_.back(), &object->type_probs,
                             &object->type);
   return true;
 }
 
+void CCRFSequenceTypeFusion::PruneStaleTrackStates(double latest_timestamp) {
+  // keep the cache bounded to the set of recently updated tracks
+  const double kTrackStateTimeout = 10.0;  // seconds
+  for (auto iter = track_states_.begin(); iter != track_states_.end();) {
+    if (iter->second.timestamp + kTrackStateTimeout < latest_timestamp) {
+      iter = track_states_.erase(iter);
+    } else {
+      ++iter;
+    }
+  }
+}
+
 bool CCRFSequenceTypeFusion::RecoverFromLogProbability(Vectord* prob,
                                                        std::vector<float>* dst,
                                                        ObjectType* type) {
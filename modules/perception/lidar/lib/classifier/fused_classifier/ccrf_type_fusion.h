@@ -37,10 +37,20 @@ class CCRFOneShotTypeFusion : public BaseOneShotTypeFusion {
   bool Init(const TypeFusionInitOption& option) override;
   bool TypeFusion(const TypeFusionOption& option,
                   std::shared_ptr<perception::base::Object> object) override;
+  bool TypeFusionBatch(
+      const TypeFusionOption& option,
+      const std::vector<std::shared_ptr<perception::base::Object>>& objects)
+      override;
   std::string Name() const override { return "CCRFOneShotTypeFusion"; }
   bool FuseOneShotTypeProbs(
       const std::shared_ptr<perception::base::Object>& object,
       Vectord* log_prob);
+  // Batched version: all raw probabilities sharing one smooth matrix are
+  // gathered into a matrix so each smoothing pass is a single matrix-matrix
+  // product per frame
+  bool FuseBatchTypeProbs(
+      const std::vector<std::shared_ptr<perception::base::Object>>& objects,
+      std::vector<Vectord, Eigen::aligned_allocator<Vectord>>* log_probs);
 
  protected:
   std::map<std::string, Matrixd, std::less<std::string>,
@@ -76,6 +86,17 @@ class CCRFSequenceTypeFusion : public BaseSequenceTypeFusion {
   bool RecoverFromLogProbability(Vectord* prob, std::vector<float>* dst,
                                  perception::base::ObjectType* type);
 
+ protected:
+  // Cached forward state of the viterbi recursion per track; when the next
+  // frame of a track arrives, inference is one transition step instead of a
+  // full re-run over the temporal window
+  struct TrackState {
+    double timestamp = 0.0;
+    Vectord fused_log_prob;
+  };
+  // drop cached states of tracks that have not been updated recently
+  void PruneStaleTrackStates(double latest_timestamp);
+
  protected:
   CCRFOneShotTypeFusion one_shot_fuser_;
   // Note all in the log space
@@ -85,6 +106,9 @@ class CCRFSequenceTypeFusion : public BaseSequenceTypeFusion {
   std::vector<Vectord, Eigen::aligned_allocator<Vectord>> fused_oneshot_probs_;
   std::vector<Vectord, Eigen::aligned_allocator<Vectord>> fused_sequence_probs_;
   std::vector<Vectori, Eigen::aligned_allocator<Vectori>> state_back_trace_;
+  std::map<int, TrackState, std::less<int>,
+           Eigen::aligned_allocator<std::pair<const int, TrackState>>>
+      track_states_;
 
  protected:
   double s_alpha_ = 1.8;
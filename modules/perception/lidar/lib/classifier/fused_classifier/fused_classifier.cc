@@ -98,6 +98,8 @@ bool FusedClassifier::Classify(const ClassifierOptions& options,
   } else {
     // one shot fusion
     AINFO << "Combined classifier, one shot fusion";
+    std::vector<ObjectPtr> foreground_objects;
+    foreground_objects.reserve(objects->size());
     for (auto& object : *objects) {
       if (object->lidar_supplement.is_background) {
         object->type_probs.assign(static_cast<int>(ObjectType::MAX_OBJECT_TYPE),
@@ -107,9 +109,11 @@ bool FusedClassifier::Classify(const ClassifierOptions& options,
             1.0;
         continue;
       }
-      if (!one_shot_fuser_->TypeFusion(option_, object)) {
-        AERROR << "Failed to fuse types, so continue.";
-      }
+      foreground_objects.push_back(object);
+    }
+    // fuse the whole frame in one batched pass
+    if (!one_shot_fuser_->TypeFusionBatch(option_, foreground_objects)) {
+      AERROR << "Failed to fuse types, so continue.";
     }
   }
   return true;
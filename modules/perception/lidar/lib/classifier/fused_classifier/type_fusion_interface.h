@@ -17,6 +17,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "modules/perception/base/object.h"
 #include "modules/perception/lib/registerer/registerer.h"
@@ -35,6 +36,17 @@ class BaseOneShotTypeFusion {
   virtual bool Init(const TypeFusionInitOption& option) = 0;
   virtual bool TypeFusion(const TypeFusionOption& option,
                           std::shared_ptr<perception::base::Object> object) = 0;
+  // Fuse a whole frame at once; implementations may batch the per-object
+  // work, the default just falls back to sequential fusion
+  virtual bool TypeFusionBatch(
+      const TypeFusionOption& option,
+      const std::vector<std::shared_ptr<perception::base::Object>>& objects) {
+    bool all_fused = true;
+    for (const auto& object : objects) {
+      all_fused = TypeFusion(option, object) && all_fused;
+    }
+    return all_fused;
+  }
   virtual std::string Name() const = 0;
 };
 
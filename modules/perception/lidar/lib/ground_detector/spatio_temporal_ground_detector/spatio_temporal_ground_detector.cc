@@ -60,6 +60,9 @@ bool SpatioTemporalGroundDetector::Init(
   param_->roi_region_rad_z = config_params.roi_rad_z();
   param_->nr_grids_coarse = config_params.grid_size();
   param_->nr_smooth_iter = config_params.nr_smooth_iter();
+  // candidate filtering and signed height computation are data parallel
+  // and dominate the stage; results are identical to the serial path
+  param_->nr_detect_threads = 4;
 
   pfdetector_ = new common::PlaneFitGroundDetector(*param_);
   pfdetector_->Init();
@@ -18,6 +18,7 @@
 #include "cyber/common/file.h"
 #include "cyber/common/log.h"
 
+#include "modules/perception/common/perception_gflags.h"
 #include "modules/perception/lib/config_manager/config_manager.h"
 #include "modules/perception/proto/map_manager_config.pb.h"
 
@@ -70,6 +71,9 @@ bool MapManager::Update(const MapManagerOptions& options, LidarFrame* frame) {
   point.x = frame->lidar2world_pose.translation()(0);
   point.y = frame->lidar2world_pose.translation()(1);
   point.z = frame->lidar2world_pose.translation()(2);
+  if (FLAGS_lidar_roi_cache_distance > 0.0) {
+    return UpdateRoiFromCache(point, frame);
+  }
   if (!hdmap_input_->GetRoiHDMapStruct(point, roi_search_distance_,
                                        frame->hdmap_struct)) {
     frame->hdmap_struct->road_polygons.clear();
@@ -80,6 +84,53 @@ bool MapManager::Update(const MapManagerOptions& options, LidarFrame* frame) {
   }
   return true;
 }
+
+bool MapManager::UpdateRoiFromCache(const base::PointD& point,
+                                    LidarFrame* frame) {
+  {
+    std::lock_guard<std::mutex> lock(roi_cache_mutex_);
+    if (cached_hdmap_struct_ != nullptr) {
+      frame->hdmap_struct = cached_hdmap_struct_;
+      const double diff_x = point.x - cached_roi_center_.x;
+      const double diff_y = point.y - cached_roi_center_.y;
+      const double cache_distance = FLAGS_lidar_roi_cache_distance;
+      if (diff_x * diff_x + diff_y * diff_y >
+              cache_distance * cache_distance &&
+          !roi_refresh_running_.exchange(true)) {
+        roi_refresh_future_ = std::async(
+            std::launch::async, &MapManager::RefreshRoi, this, point);
+      }
+      return true;
+    }
+  }
+  // no cache yet, fill the first frame synchronously
+  if (!hdmap_input_->GetRoiHDMapStruct(point, roi_search_distance_,
+                                       frame->hdmap_struct)) {
+    frame->hdmap_struct->road_polygons.clear();
+    frame->hdmap_struct->road_boundary.clear();
+    frame->hdmap_struct->hole_polygons.clear();
+    frame->hdmap_struct->junction_polygons.clear();
+    AINFO << "Failed to get roi from hdmap.";
+    return true;
+  }
+  std::lock_guard<std::mutex> lock(roi_cache_mutex_);
+  cached_hdmap_struct_ = frame->hdmap_struct;
+  cached_roi_center_ = point;
+  return true;
+}
+
+void MapManager::RefreshRoi(const base::PointD& point) {
+  auto hdmap_struct = std::make_shared<base::HdmapStruct>();
+  if (hdmap_input_->GetRoiHDMapStruct(point, roi_search_distance_,
+                                      hdmap_struct)) {
+    std::lock_guard<std::mutex> lock(roi_cache_mutex_);
+    cached_hdmap_struct_ = hdmap_struct;
+    cached_roi_center_ = point;
+  } else {
+    AINFO << "Failed to refresh roi from hdmap.";
+  }
+  roi_refresh_running_.store(false);
+}
 bool MapManager::QueryPose(Eigen::Affine3d* sensor2world_pose) const {
   // TODO(...): map-based alignment to refine pose
   return false;
@@ -15,6 +15,9 @@
  *****************************************************************************/
 #pragma once
 
+#include <atomic>
+#include <future>
+#include <mutex>
 #include <string>
 
 #include "gtest/gtest_prod.h"
@@ -35,7 +38,11 @@ class MapManager {
  public:
   MapManager() = default;
 
-  ~MapManager() = default;
+  ~MapManager() {
+    if (roi_refresh_future_.valid()) {
+      roi_refresh_future_.wait();
+    }
+  }
 
   bool Init(const MapManagerInitOptions& options = MapManagerInitOptions());
 
@@ -51,11 +58,25 @@ class MapManager {
   std::string Name() const { return "MapManager"; }
 
  private:
+  // @brief: serve the last ROI and trigger an async refresh once the
+  // pose moves beyond FLAGS_lidar_roi_cache_distance, so hdmap access
+  // never blocks the lidar pipeline
+  bool UpdateRoiFromCache(const base::PointD& point, LidarFrame* frame);
+
+  void RefreshRoi(const base::PointD& point);
+
   LidarFrame* cached_frame_ = nullptr;
   map::HDMapInput* hdmap_input_ = nullptr;
   // params
   bool update_pose_ = false;
   double roi_search_distance_ = 80.0;
+  // frame-coherent ROI cache; the cached struct is never mutated after
+  // publication, so it can be shared with frames without copying
+  std::mutex roi_cache_mutex_;
+  base::HdmapStructPtr cached_hdmap_struct_ = nullptr;
+  base::PointD cached_roi_center_;
+  std::atomic<bool> roi_refresh_running_{false};
+  std::future<void> roi_refresh_future_;
 
   FRIEND_TEST(LidarLibMapManagerTest, lidar_map_manager_test);
 };  // class MapManager
@@ -47,27 +47,27 @@ bool ObjectBuilder::Build(const ObjectBuilderOptions& options,
   std::vector<ObjectPtr>* objects = &(frame->segmented_objects);
   for (size_t i = 0; i < objects->size(); ++i) {
     if (objects->at(i)) {
+      Eigen::Vector3f min_pt;
+      Eigen::Vector3f max_pt;
       objects->at(i)->id = static_cast<int>(i);
-      ComputePolygon2D(objects->at(i));
-      ComputePolygonSizeCenter(objects->at(i));
+      ComputePolygon2D(objects->at(i), &min_pt, &max_pt);
+      ComputePolygonSizeCenter(objects->at(i), min_pt, max_pt);
       ComputeOtherObjectInformation(objects->at(i));
     }
   }
   return true;
 }
 
-void ObjectBuilder::ComputePolygon2D(ObjectPtr object) {
-  Eigen::Vector3f min_pt;
-  Eigen::Vector3f max_pt;
+void ObjectBuilder::ComputePolygon2D(ObjectPtr object, Eigen::Vector3f* min_pt,
+                                     Eigen::Vector3f* max_pt) {
   PointFCloud& cloud = object->lidar_supplement.cloud;
-  GetMinMax3D(cloud, &min_pt, &max_pt);
+  GetMinMax3D(cloud, min_pt, max_pt);
   if (cloud.size() < 4u) {
-    SetDefaultValue(min_pt, max_pt, object);
+    SetDefaultValue(*min_pt, *max_pt, object);
     return;
   }
   LinePerturbation(&cloud);
-  common::ConvexHull2D<PointFCloud, PolygonDType> hull;
-  hull.GetConvexHull(cloud, &(object->polygon));
+  hull_.GetConvexHull(cloud, &(object->polygon));
 }
 
 void ObjectBuilder::ComputeOtherObjectInformation(ObjectPtr object) {
@@ -83,13 +83,22 @@ void ObjectBuilder::ComputeOtherObjectInformation(ObjectPtr object) {
   object->latest_tracked_time = timestamp;
 }
 
-void ObjectBuilder::ComputePolygonSizeCenter(ObjectPtr object) {
+void ObjectBuilder::ComputePolygonSizeCenter(ObjectPtr object,
+                                             const Eigen::Vector3f& min_pt,
+                                             const Eigen::Vector3f& max_pt) {
   if (object->lidar_supplement.cloud.size() < 4u) {
     return;
   }
   Eigen::Vector3f dir = object->direction;
-  common::CalculateBBoxSizeCenter2DXY(object->lidar_supplement.cloud, dir,
-                                      &(object->size), &(object->center));
+  // the extreme points in any direction lie on the convex hull, so the
+  // box is computed from the hull vertices instead of rescanning the
+  // whole cloud
+  common::CalculateBBoxSizeCenter2DXY(object->polygon, dir, &(object->size),
+                                      &(object->center));
+  // the hull vertices carry no vertical extent, recover it from the min
+  // and max point of the cloud
+  object->size(2) = max_pt(2) - min_pt(2);
+  object->center(2) = static_cast<double>(min_pt(2));
   if (object->lidar_supplement.is_background) {
     float length = object->size(0);
     float width = object->size(1);
@@ -22,6 +22,7 @@
 #include "modules/perception/base/object.h"
 #include "modules/perception/base/point.h"
 #include "modules/perception/base/point_cloud.h"
+#include "modules/perception/common/geometry/convex_hull_2d.h"
 #include "modules/perception/lib/registerer/registerer.h"
 #include "modules/perception/lidar/common/lidar_frame.h"
 
@@ -56,13 +57,19 @@ class ObjectBuilder {
   // @brief: calculate 2d polygon.
   //         and fill the convex hull vertices in object->polygon.
   // @param [in/out]: ObjectPtr.
+  // @param [out]: 3d min and max point of the cloud.
   void ComputePolygon2D(
-      std::shared_ptr<apollo::perception::base::Object> object);
+      std::shared_ptr<apollo::perception::base::Object> object,
+      Eigen::Vector3f* min_pt, Eigen::Vector3f* max_pt);
 
   // @brief: calculate the size, center of polygon.
+  //         the xy extents come from the hull vertices, the z extent
+  //         from the precomputed min and max point.
   // @param [in/out]: ObjectPtr.
+  // @param [in]: 3d min and max point of the cloud.
   void ComputePolygonSizeCenter(
-      std::shared_ptr<apollo::perception::base::Object> object);
+      std::shared_ptr<apollo::perception::base::Object> object,
+      const Eigen::Vector3f& min_pt, const Eigen::Vector3f& max_pt);
 
   // @brief: calculate and fill timestamp and anchor_point.
   // @param [in/out]: ObjectPtr.
@@ -90,6 +97,13 @@ class ObjectBuilder {
   void GetMinMax3D(const apollo::perception::base::PointCloud<
                        apollo::perception::base::PointF>& cloud,
                    Eigen::Vector3f* min_pt, Eigen::Vector3f* max_pt);
+
+  // reused across objects and frames, so the hull working buffers are
+  // allocated only once
+  common::ConvexHull2D<
+      apollo::perception::base::PointCloud<apollo::perception::base::PointF>,
+      apollo::perception::base::PointCloud<apollo::perception::base::PointD>>
+      hull_;
 };  // class ObjectBuilder
 
 }  // namespace lidar
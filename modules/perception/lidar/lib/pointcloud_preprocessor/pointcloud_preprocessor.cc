@@ -77,7 +77,12 @@ bool PointCloudPreprocessor::Preprocess(
   frame->cloud->set_timestamp(message->measurement_time());
   if (message->point_size() > 0) {
     frame->cloud->reserve(message->point_size());
+    // fill the world cloud in the same pass instead of re-walking the
+    // filtered cloud in TransformCloud
+    frame->world_cloud->clear();
+    frame->world_cloud->reserve(message->point_size());
     base::PointF point;
+    base::PointD world_point;
     for (int i = 0; i < message->point_size(); ++i) {
       const apollo::drivers::PointXYZIT& pt = message->point(i);
       if (filter_naninf_points_) {
@@ -106,10 +111,16 @@ bool PointCloudPreprocessor::Preprocess(
       point.y = pt.y();
       point.z = pt.z();
       point.intensity = static_cast<float>(pt.intensity());
-      frame->cloud->push_back(point, static_cast<double>(pt.timestamp()) * 1e-9,
-                              FLT_MAX, i, 0);
+      const double point_timestamp = static_cast<double>(pt.timestamp()) * 1e-9;
+      frame->cloud->push_back(point, point_timestamp, FLT_MAX, i, 0);
+      Eigen::Vector3d vec3d_world = frame->lidar2world_pose * vec3d_lidar;
+      world_point.x = vec3d_world(0);
+      world_point.y = vec3d_world(1);
+      world_point.z = vec3d_world(2);
+      world_point.intensity = point.intensity;
+      frame->world_cloud->push_back(world_point, point_timestamp, FLT_MAX, i,
+                                    0);
     }
-    TransformCloud(frame->cloud, frame->lidar2world_pose, frame->world_cloud);
   }
   return true;
 }
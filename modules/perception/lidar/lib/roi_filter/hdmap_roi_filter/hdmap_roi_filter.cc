@@ -17,6 +17,7 @@
 #include "modules/perception/lidar/lib/roi_filter/hdmap_roi_filter/hdmap_roi_filter.h"
 
 #include <algorithm>
+#include <functional>
 
 #include "cyber/common/file.h"
 #include "modules/perception/lib/config_manager/config_manager.h"
@@ -36,6 +37,28 @@ using base::PolygonDType;
 template <typename T>
 using Polygon = typename PolygonScanCvter<T>::Polygon;
 
+// the rasterized mask is reused as long as the pose has moved less than
+// this fraction of a cell, so a reused mask is at most sub-cell stale
+static constexpr double kBitmapReuseMaxOffsetRatio = 0.25;
+
+// order-sensitive hash over the polygon vertices, used to detect roi
+// polygon updates between frames
+static size_t FingerprintPolygons(
+    const std::vector<PolygonDType*>& polygons_world) {
+  size_t fingerprint = polygons_world.size();
+  std::hash<double> hasher;
+  for (const auto* polygon : polygons_world) {
+    for (size_t i = 0; i < polygon->size(); ++i) {
+      const auto& point = (*polygon)[i];
+      fingerprint ^= hasher(point.x) + 0x9e3779b9 + (fingerprint << 6) +
+                     (fingerprint >> 2);
+      fingerprint ^= hasher(point.y) + 0x9e3779b9 + (fingerprint << 6) +
+                     (fingerprint >> 2);
+    }
+  }
+  return fingerprint;
+}
+
 bool HdmapROIFilter::Init(const ROIFilterInitOptions& options) {
   // load model config
   auto config_manager = lib::ConfigManager::Instance();
@@ -101,13 +124,29 @@ bool HdmapROIFilter::Filter(const ROIFilterOptions& options,
     polygons_world_[i++] = &polygon;
   }
 
+  // decide whether the mask rasterized in a previous frame is still valid
+  const size_t polygons_fingerprint = FingerprintPolygons(polygons_world_);
+  const Eigen::Vector3d location = frame->lidar2world_pose.translation();
+  const bool reuse_bitmap =
+      bitmap_ready_ && polygons_fingerprint == bitmap_polygons_fingerprint_ &&
+      (location - bitmap_location_).head<2>().norm() <
+          kBitmapReuseMaxOffsetRatio * cell_size_;
+  if (reuse_bitmap) {
+    ADEBUG << " Reuse rasterized roi bitmap from last frame.";
+  }
+
   // transform to local
   base::PointFCloudPtr cloud_local = base::PointFCloudPool::Instance().Get();
   TransformFrame(frame->cloud, frame->lidar2world_pose, polygons_world_,
                  &polygons_local_, &cloud_local);
 
-  bool ret = FilterWithPolygonMask(cloud_local, polygons_local_,
+  bool ret = FilterWithPolygonMask(cloud_local, polygons_local_, reuse_bitmap,
                                    &(frame->roi_indices));
+  if (!reuse_bitmap) {
+    bitmap_ready_ = ret;
+    bitmap_polygons_fingerprint_ = polygons_fingerprint;
+    bitmap_location_ = location;
+  }
 
   // set roi points label
   if (ret) {
@@ -144,43 +183,53 @@ bool HdmapROIFilter::Filter(const ROIFilterOptions& options,
 
 bool HdmapROIFilter::FilterWithPolygonMask(
     const base::PointFCloudPtr& cloud,
-    const std::vector<PolygonDType>& map_polygons,
+    const std::vector<PolygonDType>& map_polygons, const bool reuse_mask,
     base::PointIndices* roi_indices) {
-  std::vector<Polygon<double>> raw_polygons;
-  // convert and obtain the major direction
-  raw_polygons.resize(map_polygons.size());
-  double min_x = range_;
-  double max_x = -min_x;
-  double min_y = min_x;
-  double max_y = max_x;
-
-  for (size_t i = 0; i < map_polygons.size(); ++i) {
-    auto& raw_polygon = raw_polygons[i];
-    const auto& map_polygon = map_polygons[i];
-    raw_polygon.resize(map_polygon.size());
-    for (size_t j = 0; j < map_polygon.size(); ++j) {
-      raw_polygon[j].x() = map_polygon[j].x;
-      raw_polygon[j].y() = map_polygon[j].y;
-      min_x = std::min(raw_polygon[j].x(), min_x);
-      max_x = std::max(raw_polygon[j].x(), max_x);
-      min_y = std::min(raw_polygon[j].y(), min_y);
-      max_y = std::max(raw_polygon[j].y(), max_y);
+  if (!reuse_mask) {
+    std::vector<Polygon<double>> raw_polygons;
+    // convert and obtain the major direction
+    raw_polygons.resize(map_polygons.size());
+    double min_x = range_;
+    double max_x = -min_x;
+    double min_y = min_x;
+    double max_y = max_x;
+
+    for (size_t i = 0; i < map_polygons.size(); ++i) {
+      auto& raw_polygon = raw_polygons[i];
+      const auto& map_polygon = map_polygons[i];
+      raw_polygon.resize(map_polygon.size());
+      for (size_t j = 0; j < map_polygon.size(); ++j) {
+        raw_polygon[j].x() = map_polygon[j].x;
+        raw_polygon[j].y() = map_polygon[j].y;
+        min_x = std::min(raw_polygon[j].x(), min_x);
+        max_x = std::max(raw_polygon[j].x(), max_x);
+        min_y = std::min(raw_polygon[j].y(), min_y);
+        max_y = std::max(raw_polygon[j].y(), max_y);
+      }
     }
+    min_x = std::max(min_x, -range_);
+    max_x = std::min(max_x, range_);
+    min_y = std::max(min_y, -range_);
+    max_y = std::min(max_y, range_);
+
+    DirectionMajor major_dir = DirectionMajor::XMAJOR;
+    if ((max_y - min_y) < (max_x - min_x)) {
+      major_dir = DirectionMajor::YMAJOR;
+    }
+    bitmap_.SetUp(major_dir);
+
+    if (!DrawPolygonsMask<double>(raw_polygons, &bitmap_, extend_dist_,
+                                  no_edge_table_)) {
+      return false;
+    }
+    bitmap_gpu_dirty_ = true;
   }
-  min_x = std::max(min_x, -range_);
-  max_x = std::min(max_x, range_);
-  min_y = std::max(min_y, -range_);
-  max_y = std::min(max_y, range_);
-
-  DirectionMajor major_dir = DirectionMajor::XMAJOR;
-  if ((max_y - min_y) < (max_x - min_x)) {
-    major_dir = DirectionMajor::YMAJOR;
-  }
-  bitmap_.SetUp(major_dir);
 
-  return DrawPolygonsMask<double>(raw_polygons, &bitmap_, extend_dist_,
-                                  no_edge_table_) &&
-         Bitmap2dFilter(cloud, bitmap_, roi_indices);
+#ifndef PERCEPTION_CPU_ONLY
+  return Bitmap2dFilterGPU(cloud, bitmap_, roi_indices);
+#else
+  return Bitmap2dFilter(cloud, bitmap_, roi_indices);
+#endif
 }
 
 void HdmapROIFilter::TransformFrame(
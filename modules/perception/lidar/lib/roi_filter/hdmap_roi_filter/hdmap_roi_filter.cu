@@ -0,0 +1,142 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "modules/perception/lidar/lib/roi_filter/hdmap_roi_filter/hdmap_roi_filter.h"
+
+#include "modules/perception/base/common.h"
+#include "modules/perception/lidar/common/lidar_log.h"
+
+namespace apollo {
+namespace perception {
+namespace lidar {
+
+#define CUDA_KERNEL_LOOP(i, n)                                 \
+  for (int i = blockIdx.x * blockDim.x + threadIdx.x; i < (n); \
+       i += blockDim.x * gridDim.x)
+
+// device replica of Bitmap2D::IsExists, RealToBitmap and CheckBit; the
+// bitmap words are laid out as on the host, one row of 64-cell blocks
+// per major-direction coordinate
+__global__ void CheckPointsInBitmapKernel(
+    const int n, const base::PointF* pc, const uint64_t* bitmap,
+    const double min_range_x, const double min_range_y,
+    const double max_range_x, const double max_range_y,
+    const double cell_size_x, const double cell_size_y, const int dir_major,
+    const int blocks_per_major, char* in_roi) {
+  CUDA_KERNEL_LOOP(i, n) {
+    in_roi[i] = 0;
+    const double px = static_cast<double>(pc[i].x);
+    const double py = static_cast<double>(pc[i].y);
+    if (px < min_range_x || px >= max_range_x || py < min_range_y ||
+        py >= max_range_y) {
+      continue;
+    }
+    const size_t pix_x = static_cast<size_t>((px - min_range_x) / cell_size_x);
+    const size_t pix_y = static_cast<size_t>((py - min_range_y) / cell_size_y);
+    const size_t major_pix = dir_major == 0 ? pix_x : pix_y;
+    const size_t op_major_pix = dir_major == 0 ? pix_y : pix_x;
+    const uint64_t block =
+        bitmap[major_pix * blocks_per_major + (op_major_pix >> 6)];
+    if (block & (static_cast<uint64_t>(1) << (op_major_pix & 63))) {
+      in_roi[i] = 1;
+    }
+  }
+}
+
+void HdmapROIFilter::EnsureDeviceCapacity(size_t cloud_size,
+                                          size_t bitmap_size) {
+  if (cloud_size > pc_gpu_size_) {
+    if (pc_gpu_ != nullptr) {
+      BASE_CUDA_CHECK(cudaFree(pc_gpu_));
+      BASE_CUDA_CHECK(cudaFree(point_in_roi_gpu_));
+    }
+    BASE_CUDA_CHECK(cudaMalloc(reinterpret_cast<void**>(&pc_gpu_),
+                               cloud_size * sizeof(base::PointF)));
+    BASE_CUDA_CHECK(cudaMalloc(reinterpret_cast<void**>(&point_in_roi_gpu_),
+                               cloud_size * sizeof(char)));
+    pc_gpu_size_ = cloud_size;
+  }
+  if (bitmap_size > bitmap_gpu_size_) {
+    if (bitmap_gpu_ != nullptr) {
+      BASE_CUDA_CHECK(cudaFree(bitmap_gpu_));
+    }
+    BASE_CUDA_CHECK(cudaMalloc(reinterpret_cast<void**>(&bitmap_gpu_),
+                               bitmap_size * sizeof(uint64_t)));
+    bitmap_gpu_size_ = bitmap_size;
+    bitmap_gpu_dirty_ = true;
+  }
+}
+
+bool HdmapROIFilter::Bitmap2dFilterGPU(const base::PointFCloudPtr& in_cloud,
+                                       const Bitmap2D& bitmap,
+                                       base::PointIndices* roi_indices) {
+  if (!bitmap.Check(Eigen::Vector2d(0.0, 0.0))) {
+    AWARN << " Car is not in roi!!.";
+    return false;
+  }
+  roi_indices->indices.clear();
+  const size_t cloud_size = in_cloud->size();
+  if (cloud_size == 0) {
+    return true;
+  }
+  const std::vector<uint64_t>& words = bitmap.bitmap();
+  EnsureDeviceCapacity(cloud_size, words.size());
+  // the bitmap is uploaded only after the mask has been redrawn
+  if (bitmap_gpu_dirty_) {
+    BASE_CUDA_CHECK(cudaMemcpy(bitmap_gpu_, words.data(),
+                               words.size() * sizeof(uint64_t),
+                               cudaMemcpyHostToDevice));
+    bitmap_gpu_dirty_ = false;
+  }
+  BASE_CUDA_CHECK(cudaMemcpy(pc_gpu_, &(in_cloud->front()),
+                             cloud_size * sizeof(base::PointF),
+                             cudaMemcpyHostToDevice));
+  const int block_size =
+      (static_cast<int>(cloud_size) + kGPUThreadSize - 1) / kGPUThreadSize;
+  CheckPointsInBitmapKernel<<<block_size, kGPUThreadSize>>>(
+      static_cast<int>(cloud_size), pc_gpu_, bitmap_gpu_,
+      bitmap.min_range().x(), bitmap.min_range().y(), bitmap.max_range().x(),
+      bitmap.max_range().y(), bitmap.cell_size().x(), bitmap.cell_size().y(),
+      bitmap.dir_major(), static_cast<int>(bitmap.map_size()[1]),
+      point_in_roi_gpu_);
+  point_in_roi_flags_.resize(cloud_size);
+  BASE_CUDA_CHECK(cudaMemcpy(point_in_roi_flags_.data(), point_in_roi_gpu_,
+                             cloud_size * sizeof(char),
+                             cudaMemcpyDeviceToHost));
+  roi_indices->indices.reserve(cloud_size);
+  for (size_t i = 0; i < cloud_size; ++i) {
+    if (point_in_roi_flags_[i] != 0) {
+      roi_indices->indices.push_back(static_cast<int>(i));
+    }
+  }
+  return true;
+}
+
+void HdmapROIFilter::ReleaseGPUMemory() {
+  if (pc_gpu_ != nullptr) {
+    BASE_CUDA_CHECK(cudaFree(pc_gpu_));
+  }
+  if (point_in_roi_gpu_ != nullptr) {
+    BASE_CUDA_CHECK(cudaFree(point_in_roi_gpu_));
+  }
+  if (bitmap_gpu_ != nullptr) {
+    BASE_CUDA_CHECK(cudaFree(bitmap_gpu_));
+  }
+}
+
+}  // namespace lidar
+}  // namespace perception
+}  // namespace apollo
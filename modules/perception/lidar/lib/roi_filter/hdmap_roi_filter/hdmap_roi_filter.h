@@ -36,7 +36,11 @@ class HdmapROIFilter : public BaseROIFilter {
         cell_size_(0.25),
         extend_dist_(0.0),
         no_edge_table_(false) {}
-  ~HdmapROIFilter() = default;
+  ~HdmapROIFilter() {
+#ifndef PERCEPTION_CPU_ONLY
+    ReleaseGPUMemory();
+#endif
+  }
 
   bool Init(const ROIFilterInitOptions& options) override;
 
@@ -51,14 +55,27 @@ class HdmapROIFilter : public BaseROIFilter {
                       std::vector<base::PolygonDType>* polygons_local,
                       base::PointFCloudPtr* cloud_local);
 
+  // when reuse_mask is true, the bitmap rasterized in a previous frame is
+  // kept and only the point-in-roi scan runs
   bool FilterWithPolygonMask(
       const base::PointFCloudPtr& cloud,
       const std::vector<base::PolygonDType>& map_polygons,
-      base::PointIndices* roi_indices);
+      const bool reuse_mask, base::PointIndices* roi_indices);
 
   bool Bitmap2dFilter(const base::PointFCloudPtr& in_cloud,
                       const Bitmap2D& bitmap, base::PointIndices* roi_indices);
 
+#ifndef PERCEPTION_CPU_ONLY
+  // device version of Bitmap2dFilter, checking all points against the
+  // rasterized bitmap in one kernel; the bitmap words are re-uploaded
+  // only after the mask has been redrawn
+  bool Bitmap2dFilterGPU(const base::PointFCloudPtr& in_cloud,
+                         const Bitmap2D& bitmap,
+                         base::PointIndices* roi_indices);
+  void EnsureDeviceCapacity(size_t cloud_size, size_t bitmap_size);
+  void ReleaseGPUMemory();
+#endif
+
   // parameters for polygons scans convert
   double range_ = 120.0;
   double cell_size_ = 0.25;
@@ -70,6 +87,22 @@ class HdmapROIFilter : public BaseROIFilter {
   Bitmap2D bitmap_;
   ROIServiceContent roi_service_content_;
 
+  // state of the last rasterized mask, so it can be reused across frames
+  // while the roi polygons are unchanged and the pose barely moves
+  bool bitmap_ready_ = false;
+  size_t bitmap_polygons_fingerprint_ = 0;
+  Eigen::Vector3d bitmap_location_;
+
+  // param for managing gpu memory, only for cuda code
+  base::PointF* pc_gpu_ = nullptr;
+  uint64_t* bitmap_gpu_ = nullptr;
+  char* point_in_roi_gpu_ = nullptr;
+  size_t pc_gpu_size_ = 0;
+  size_t bitmap_gpu_size_ = 0;
+  bool bitmap_gpu_dirty_ = true;
+  std::vector<char> point_in_roi_flags_;
+  const int kGPUThreadSize = 512;
+
   // unit tests only
   friend class HdmapROIFilterTest;
   friend class LidarLibROIServiceTest;
@@ -132,9 +132,7 @@ bool GroundServiceContent::Init(double roi_x, double roi_y, uint32_t rows,
 }
 
 bool GroundService::Init(const SceneServiceInitOptions& options) {
-  self_content_.reset(new GroundServiceContent);
-  ground_content_ref_ =
-      dynamic_cast<GroundServiceContent*>(self_content_.get());
+  GroundServiceContentPtr content(new GroundServiceContent);
   // initialize ground service content from config manager and proto
   // including resolution, grid size, ...
   auto config_manager = lib::ConfigManager::Instance();
@@ -160,17 +158,22 @@ bool GroundService::Init(const SceneServiceInitOptions& options) {
   uint32_t rows = config_params.grid_size();
   uint32_t cols = config_params.grid_size();
 
-  ground_content_ref_->Init(roi_region_rad_x, roi_region_rad_y, rows, cols);
+  content->Init(roi_region_rad_x, roi_region_rad_y, rows, cols);
+  self_content_ = content;
 
   return true;
 }
 
 float GroundService::QueryPointToGroundDistance(
     const Eigen::Vector3d& world_point) {
-  std::lock_guard<std::mutex> lock(mutex_);
-  float distance =
-      QueryPointToGroundDistance(world_point, *ground_content_ref_);
-  return distance;
+  // lock-free read on the current content snapshot
+  GroundServiceContentPtr content =
+      std::dynamic_pointer_cast<GroundServiceContent>(
+          GetServiceContentSnapshot());
+  if (content == nullptr) {
+    return std::numeric_limits<float>::max();
+  }
+  return QueryPointToGroundDistance(world_point, *content);
 }
 
 float GroundService::QueryPointToGroundDistance(
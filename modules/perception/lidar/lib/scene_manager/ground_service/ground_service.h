@@ -68,7 +68,7 @@ class GroundServiceContent : public SceneServiceContent {
 class GroundService : public SceneService {
  public:
   GroundService() = default;
-  ~GroundService() { ground_content_ref_ = nullptr; }
+  ~GroundService() = default;
   // @brief: initialize scene service
   // @param [in]: init options
   bool Init(const SceneServiceInitOptions& options =
@@ -77,8 +77,11 @@ class GroundService : public SceneService {
   // @return: name
   std::string Name() const override { return "GroundService"; }
 
+  // note: the pointer targets the current content snapshot and is
+  // outdated once UpdateServiceContent publishes a new one
   GroundServiceContent* GetGroundServiceContent() const {
-    return ground_content_ref_;
+    return dynamic_cast<GroundServiceContent*>(
+        GetServiceContentSnapshot().get());
   }
 
  public:
@@ -92,9 +95,6 @@ class GroundService : public SceneService {
   // @return: distance
   float QueryPointToGroundDistance(const Eigen::Vector3d& world_point,
                                    const GroundServiceContent& content);
-
- protected:
-  GroundServiceContent* ground_content_ref_ = nullptr;
 };
 
 typedef std::shared_ptr<GroundServiceContent> GroundServiceContentPtr;
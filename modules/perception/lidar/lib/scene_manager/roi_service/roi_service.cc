@@ -82,8 +82,7 @@ bool ROIServiceContent::Check(const Eigen::Vector3d& world_point) const {
 }
 
 bool ROIService::Init(const SceneServiceInitOptions& options) {
-  self_content_.reset(new ROIServiceContent);
-  roi_content_ref_ = dynamic_cast<ROIServiceContent*>(self_content_.get());
+  ROIServiceContentPtr content(new ROIServiceContent);
   auto config_manager = lib::ConfigManager::Instance();
   const lib::ModelConfig* model_config = nullptr;
   ACHECK(config_manager->GetModelConfig(Name(), &model_config));
@@ -95,15 +94,20 @@ bool ROIService::Init(const SceneServiceInitOptions& options) {
   config_file = GetAbsolutePath(config_file, "roi_service.conf");
   ROIServiceConfig config;
   ACHECK(cyber::common::GetProtoFromFile(config_file, &config));
-  roi_content_ref_->cell_size_ = config.cell_size();
-  roi_content_ref_->range_ = config.range();
+  content->cell_size_ = config.cell_size();
+  content->range_ = config.range();
+  self_content_ = content;
   return true;
 }
 
 bool ROIService::QueryIsPointInROI(const Eigen::Vector3d& world_point) {
-  std::lock_guard<std::mutex> lock(mutex_);
-  bool status = QueryIsPointInROI(world_point, *roi_content_ref_);
-  return status;
+  // lock-free read on the current content snapshot
+  ROIServiceContentPtr content =
+      std::dynamic_pointer_cast<ROIServiceContent>(GetServiceContentSnapshot());
+  if (content == nullptr) {
+    return false;
+  }
+  return QueryIsPointInROI(world_point, *content);
 }
 
 bool ROIService::QueryIsPointInROI(const Eigen::Vector3d& world_point,
@@ -67,7 +67,7 @@ class ROIServiceContent : public SceneServiceContent {
 class ROIService : public SceneService {
  public:
   ROIService() = default;
-  ~ROIService() { roi_content_ref_ = nullptr; }
+  ~ROIService() = default;
 
   // @brief: initialize scene service
   // @param [in]: init options
@@ -81,9 +81,6 @@ class ROIService : public SceneService {
   bool QueryIsPointInROI(const Eigen::Vector3d& world_point);
   bool QueryIsPointInROI(const Eigen::Vector3d& world_point,
                          const ROIServiceContent& content);
-
- protected:
-  ROIServiceContent* roi_content_ref_ = nullptr;
 };
 
 typedef std::shared_ptr<ROIServiceContent> ROIServiceContentPtr;
@@ -15,7 +15,11 @@
  *****************************************************************************/
 #include "modules/perception/lidar/lib/scene_manager/scene_manager.h"
 
+#include <algorithm>
+
+#include "absl/strings/str_split.h"
 #include "cyber/common/file.h"
+#include "modules/perception/common/perception_gflags.h"
 #include "modules/perception/lib/config_manager/config_manager.h"
 #include "modules/perception/lidar/lib/scene_manager/proto/scene_manager_config.pb.h"
 #include "modules/perception/lidar/lib/scene_manager/scene_service.h"
@@ -27,6 +31,12 @@ namespace lidar {
 
 using cyber::common::GetAbsolutePath;
 
+SceneManager::~SceneManager() {
+  if (prewarm_thread_.joinable()) {
+    prewarm_thread_.join();
+  }
+}
+
 bool SceneManager::InitInternal(const SceneManagerInitOptions& options) {
   if (initialized_) {
     return true;
@@ -42,19 +52,18 @@ bool SceneManager::InitInternal(const SceneManagerInitOptions& options) {
   config_file = GetAbsolutePath(config_file, "scene_manager.conf");
   SceneManagerConfig config;
   ACHECK(cyber::common::GetProtoFromFile(config_file, &config));
+  // Services are only recorded here; each one is constructed and
+  // initialized on its first Service() call, so variants configured but
+  // never requested do not load their data.
   services_.clear();
+  service_names_.clear();
   for (int i = 0; i < config.service_name_size(); ++i) {
     const auto& name = config.service_name(i);
-    SceneServicePtr service(SceneServiceRegisterer::GetInstanceByName(name));
-    if (service == nullptr) {
+    if (!SceneServiceRegisterer::IsValid(name)) {
       AINFO << "Failed to find scene service: " << name << ", skipped";
       continue;
     }
-    if (!service->Init()) {
-      AINFO << "Failed to init scene service: " << name << ", skipped";
-      continue;
-    }
-    services_.emplace(name, service);
+    service_names_.push_back(name);
     AINFO << "Scene manager add service: " << name;
   }
   initialized_ = true;
@@ -62,24 +71,71 @@ bool SceneManager::InitInternal(const SceneManagerInitOptions& options) {
 }
 
 bool SceneManager::Init(const SceneManagerInitOptions& options) {
-  std::lock_guard<std::mutex> lock(mutex_);
-  bool status = InitInternal(options);
+  bool status = false;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    status = InitInternal(options);
+  }
+  if (status) {
+    PrewarmServices();
+  }
   return status;
 }
 
 bool SceneManager::Reset(const SceneManagerInitOptions& options) {
-  std::lock_guard<std::mutex> lock(mutex_);
-  initialized_ = false;
-  bool status = InitInternal(options);
+  bool status = false;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    initialized_ = false;
+    status = InitInternal(options);
+  }
+  if (status) {
+    PrewarmServices();
+  }
   return status;
 }
 
 SceneServicePtr SceneManager::Service(const std::string& name) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return GetOrCreateService(name);
+}
+
+SceneServicePtr SceneManager::GetOrCreateService(const std::string& name) {
   auto iter = services_.find(name);
-  if (iter == services_.end()) {
+  if (iter != services_.end()) {
+    return iter->second;
+  }
+  auto name_iter =
+      std::find(service_names_.begin(), service_names_.end(), name);
+  if (name_iter == service_names_.end()) {
+    return nullptr;
+  }
+  SceneServicePtr service(SceneServiceRegisterer::GetInstanceByName(name));
+  if (service == nullptr || !service->Init()) {
+    AINFO << "Failed to init scene service: " << name << ", skipped";
+    service_names_.erase(name_iter);
     return nullptr;
   }
-  return iter->second;
+  services_.emplace(name, service);
+  AINFO << "Scene manager init service: " << name;
+  return service;
+}
+
+void SceneManager::PrewarmServices() {
+  if (prewarm_thread_.joinable()) {
+    prewarm_thread_.join();
+  }
+  const std::vector<std::string> prewarm_names =
+      absl::StrSplit(FLAGS_scene_service_prewarm, ',', absl::SkipEmpty());
+  if (prewarm_names.empty()) {
+    return;
+  }
+  prewarm_thread_ = std::thread([this, prewarm_names]() {
+    for (const auto& name : prewarm_names) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      GetOrCreateService(name);
+    }
+  });
 }
 
 }  // namespace lidar
@@ -17,6 +17,8 @@
 
 #include <map>
 #include <string>
+#include <thread>
+#include <vector>
 
 #include "modules/perception/lidar/lib/scene_manager/scene_service.h"
 
@@ -32,12 +34,14 @@ class SceneManager {
     static SceneManager manager;
     return manager;
   }
-  ~SceneManager() = default;
+  ~SceneManager();
   // @brief: initialize scene manager with lock
   // @param [in]: initialization options
   // @return: status
   bool Init(const SceneManagerInitOptions& options = SceneManagerInitOptions());
-  // @brief: get service given name
+  // @brief: get service given name; the service is constructed and
+  //         initialized on first use, so variants configured but never
+  //         requested do not load their data
   // @param [in]: service name
   // @return: service pointer
   SceneServicePtr Service(const std::string& name);
@@ -50,7 +54,7 @@ class SceneManager {
   bool Reset(
       const SceneManagerInitOptions& options = SceneManagerInitOptions());
 
-  int GetServiceNum() const { return static_cast<int>(services_.size()); }
+  int GetServiceNum() const { return static_cast<int>(service_names_.size()); }
 
  protected:
   SceneManager() = default;
@@ -59,9 +63,22 @@ class SceneManager {
   // @return: status
   bool InitInternal(
       const SceneManagerInitOptions& options = SceneManagerInitOptions());
+  // @brief: construct and initialize a configured service, must be
+  //         called with mutex_ held
+  // @param [in]: service name
+  // @return: service pointer
+  SceneServicePtr GetOrCreateService(const std::string& name);
+  // @brief: construct the services listed in --scene_service_prewarm on
+  //         a background thread, so their data is loaded off the
+  //         critical startup path
+  void PrewarmServices();
 
  protected:
+  // services constructed so far, a subset of service_names_
   std::map<std::string, SceneServicePtr> services_;
+  // service names from config, candidates for lazy construction
+  std::vector<std::string> service_names_;
+  std::thread prewarm_thread_;
   bool initialized_ = false;
   std::mutex mutex_;
 };
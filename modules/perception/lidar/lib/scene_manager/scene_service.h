@@ -69,17 +69,35 @@ class SceneService {
   // @brief: get service name
   // @return: name
   virtual std::string Name() const = 0;
+  // @brief: get the current content snapshot without locking; the
+  //         snapshot stays valid while held, even if a writer publishes
+  //         new content concurrently
+  SceneServiceContentPtr GetServiceContentSnapshot() const {
+    return std::atomic_load_explicit(&self_content_,
+                                     std::memory_order_acquire);
+  }
   // @brief: get a copy of service content
   // @param [in]: service content
   void GetServiceContentCopy(SceneServiceContent* content) {
-    std::lock_guard<std::mutex> lock(mutex_);
-    self_content_->GetCopy(content);
+    SceneServiceContentPtr snapshot = GetServiceContentSnapshot();
+    if (snapshot != nullptr) {
+      snapshot->GetCopy(content);
+    }
   }
-  // @brief: update service content from copy
-  // @param [in]: service content
+  // @brief: update service content from copy; a fresh snapshot is built
+  //         aside and atomically published, so concurrent readers never
+  //         block on the writer
   void UpdateServiceContent(const SceneServiceContent& content) {
+    SceneServiceContentPtr new_content(
+        SceneServiceContentRegisterer::GetInstanceByName(content.Name()));
+    if (new_content == nullptr) {
+      return;
+    }
+    new_content->SetContent(content);
+    // the mutex only serializes writers
     std::lock_guard<std::mutex> lock(mutex_);
-    self_content_->SetContent(content);
+    std::atomic_store_explicit(&self_content_, new_content,
+                               std::memory_order_release);
   }
 
  protected:
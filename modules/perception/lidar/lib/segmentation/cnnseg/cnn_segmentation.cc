@@ -230,31 +230,6 @@ bool CNNSegmentation::InitClusterAndBackgroundSegmentation() {
   return true;
 }
 
-void CNNSegmentation::MapPointToGrid(
-    const std::shared_ptr<AttributePointCloud<PointF>>& pc_ptr) {
-  float inv_res_x = 0.5f * static_cast<float>(width_) / range_;
-  // float inv_res_y = 0.5 * static_cast<float>(height_) / range_;
-  point2grid_.assign(pc_ptr->size(), -1);
-  int pos_x = -1;
-  int pos_y = -1;
-  for (size_t i = 0; i < pc_ptr->size(); ++i) {
-    const auto& pt = pc_ptr->at(i);
-    if (pt.z <= min_height_ || pt.z >= max_height_) {
-      continue;
-    }
-    // the coordinates of x and y are exchanged here
-    // (row <-> x, column <-> y)
-    // int pos_x = F2I(pt.y, range_, inv_res_x);  // col
-    // int pos_y = F2I(pt.x, range_, inv_res_y);  // row
-    // 2018.6.21, switch to axis rotated projection
-    GroupPc2Pixel(pt.x, pt.y, inv_res_x, range_, &pos_x, &pos_y);
-    if (pos_y < 0 || pos_y >= height_ || pos_x < 0 || pos_x >= width_) {
-      continue;
-    }
-    point2grid_[i] = pos_y * width_ + pos_x;
-  }
-}
-
 bool CNNSegmentation::Segment(const SegmentationOptions& options,
                               LidarFrame* frame) {
   // check input
@@ -289,17 +264,16 @@ bool CNNSegmentation::Segment(const SegmentationOptions& options,
 
   // note we should use origninal cloud here, frame->cloud may be exchanged
   Timer timer;
-  // map 3d points to 2d image grids
-  MapPointToGrid(original_cloud_);
-  mapping_time_ = timer.toc(true);
-
   if (cudaSetDevice(gpu_id_) != cudaSuccess) {
     AERROR << "Failed to set device to " << gpu_id_;
     return false;
   }
 
-  // generate features
-  feature_generator_->Generate(original_cloud_, point2grid_);
+  // map 3d points to 2d image grids and generate features in one fused
+  // pass on the device; the mapping is copied back into point2grid_ for
+  // the spp engine, which consumes it on the host
+  mapping_time_ = 0.0;
+  feature_generator_->GenerateFused(original_cloud_, &point2grid_);
   feature_time_ = timer.toc(true);
 
   // model inference
@@ -59,9 +59,6 @@ class CNNSegmentation : public BaseSegmentation {
   void GetObjectsFromSppEngine(
       std::vector<std::shared_ptr<base::Object>>* objects);
 
-  void MapPointToGrid(
-      const std::shared_ptr<base::AttributePointCloud<base::PointF>>& pc_ptr);
-
   CNNSegParam cnnseg_param_;
   std::shared_ptr<inference::Inference> inference_;
   std::shared_ptr<FeatureGenerator> feature_generator_;
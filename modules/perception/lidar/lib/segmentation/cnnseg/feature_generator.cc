@@ -110,6 +110,27 @@ bool FeatureGenerator::Init(const FeatureParam& feature_param,
   return true;
 }
 
+void FeatureGenerator::MapPointToGridCPU(const base::PointFCloudPtr& pc_ptr,
+                                         std::vector<int>* point2grid) {
+  float inv_res_x = 0.5f * static_cast<float>(width_) / range_;
+  point2grid->assign(pc_ptr->size(), -1);
+  int pos_x = -1;
+  int pos_y = -1;
+  for (size_t i = 0; i < pc_ptr->size(); ++i) {
+    const auto& pt = pc_ptr->at(i);
+    if (pt.z <= min_height_ || pt.z >= max_height_) {
+      continue;
+    }
+    // the coordinates of x and y are exchanged here
+    // (row <-> x, column <-> y)
+    GroupPc2Pixel(pt.x, pt.y, inv_res_x, range_, &pos_x, &pos_y);
+    if (pos_y < 0 || pos_y >= height_ || pos_x < 0 || pos_x >= width_) {
+      continue;
+    }
+    point2grid->at(i) = pos_y * width_ + pos_x;
+  }
+}
+
 void FeatureGenerator::GenerateCPU(const base::PointFCloudPtr& pc_ptr,
                                    const std::vector<int>& point2grid) {
   // DO NOT remove this line!!!
@@ -154,8 +154,31 @@ __global__ void SetKernel(const int n, const Dtype alpha, Dtype* y) {
   CUDA_KERNEL_LOOP(i, n) { y[i] = alpha; }
 }
 
-void FeatureGenerator::GenerateGPU(const base::PointFCloudPtr& pc_ptr,
-                                   const std::vector<int>& point2grid) {
+// device version of GroupPc2Pixel from util.h (axis rotated projection),
+// fused with the height filter and the bounds check
+__global__ void Point2GridKernel(const int n, const base::PointF* pc,
+                                 const float min_height,
+                                 const float max_height, const float scale,
+                                 const float range, const int width,
+                                 const int height, int* point2grid) {
+  CUDA_KERNEL_LOOP(i, n) {
+    point2grid[i] = -1;
+    const float pz = pc[i].z;
+    if (pz <= min_height || pz >= max_height) {
+      continue;
+    }
+    const float fx = (range - (0.707107f * (pc[i].x + pc[i].y))) * scale;
+    const float fy = (range - (0.707107f * (pc[i].x - pc[i].y))) * scale;
+    const int pos_x = fx < 0.f ? -1 : static_cast<int>(fx);
+    const int pos_y = fy < 0.f ? -1 : static_cast<int>(fy);
+    if (pos_y < 0 || pos_y >= height || pos_x < 0 || pos_x >= width) {
+      continue;
+    }
+    point2grid[i] = pos_y * width + pos_x;
+  }
+}
+
+void FeatureGenerator::SetInitialFeatureMaps() {
   // fill initial value for feature blob
   int map_size = width_ * height_;
   int block_size = (map_size + kGPUThreadSize - 1) / kGPUThreadSize;
@@ -170,9 +193,9 @@ void FeatureGenerator::GenerateGPU(const base::PointFCloudPtr& pc_ptr,
     BASE_CUDA_CHECK(
         cudaMemset(mean_intensity_data_, 0.f, sizeof(float) * map_size));
   }
+}
 
-  // copy cloud data and point2grid from CPU to GPU memory
-  size_t cloud_size = pc_ptr->size();
+void FeatureGenerator::EnsureDeviceCapacity(size_t cloud_size) {
   if (cloud_size > pc_gpu_size_) {
     // cloud data
     BASE_CUDA_CHECK(cudaFree(pc_gpu_));
@@ -184,15 +207,13 @@ void FeatureGenerator::GenerateGPU(const base::PointFCloudPtr& pc_ptr,
     BASE_CUDA_CHECK(cudaMalloc(reinterpret_cast<void**>(&point2grid_gpu_),
                                cloud_size * sizeof(int)));
   }
-  BASE_CUDA_CHECK(cudaMemcpy(pc_gpu_, &(pc_ptr->front()),
-                             sizeof(base::PointF) * cloud_size,
-                             cudaMemcpyHostToDevice));
-  BASE_CUDA_CHECK(cudaMemcpy(point2grid_gpu_, point2grid.data(),
-                             sizeof(int) * cloud_size, cudaMemcpyHostToDevice));
+}
 
+void FeatureGenerator::LaunchFeatureKernels(size_t cloud_size) {
   // compute features
   // float inv_res_x = 0.5 * width_ / range_;
   // float inv_res_y = 0.5 * height_ / range_;
+  int map_size = width_ * height_;
   {
     int block_size = (cloud_size + kGPUThreadSize - 1) / kGPUThreadSize;
     MapKernel<float><<<block_size, kGPUThreadSize>>>(
@@ -211,6 +232,51 @@ void FeatureGenerator::GenerateGPU(const base::PointFCloudPtr& pc_ptr,
   }
 }
 
+void FeatureGenerator::GenerateGPU(const base::PointFCloudPtr& pc_ptr,
+                                   const std::vector<int>& point2grid) {
+  SetInitialFeatureMaps();
+
+  // copy cloud data and point2grid from CPU to GPU memory
+  size_t cloud_size = pc_ptr->size();
+  EnsureDeviceCapacity(cloud_size);
+  BASE_CUDA_CHECK(cudaMemcpy(pc_gpu_, &(pc_ptr->front()),
+                             sizeof(base::PointF) * cloud_size,
+                             cudaMemcpyHostToDevice));
+  BASE_CUDA_CHECK(cudaMemcpy(point2grid_gpu_, point2grid.data(),
+                             sizeof(int) * cloud_size, cudaMemcpyHostToDevice));
+
+  LaunchFeatureKernels(cloud_size);
+}
+
+void FeatureGenerator::GenerateFusedGPU(const base::PointFCloudPtr& pc_ptr,
+                                        std::vector<int>* point2grid) {
+  SetInitialFeatureMaps();
+
+  // copy cloud data from CPU to GPU memory, the mapping is computed on
+  // the device instead of being uploaded
+  size_t cloud_size = pc_ptr->size();
+  EnsureDeviceCapacity(cloud_size);
+  BASE_CUDA_CHECK(cudaMemcpy(pc_gpu_, &(pc_ptr->front()),
+                             sizeof(base::PointF) * cloud_size,
+                             cudaMemcpyHostToDevice));
+
+  {
+    int block_size = (cloud_size + kGPUThreadSize - 1) / kGPUThreadSize;
+    const float inv_res_x = 0.5f * static_cast<float>(width_) / range_;
+    Point2GridKernel<<<block_size, kGPUThreadSize>>>(
+        cloud_size, pc_gpu_, min_height_, max_height_, inv_res_x, range_,
+        width_, height_, point2grid_gpu_);
+  }
+
+  LaunchFeatureKernels(cloud_size);
+
+  // the spp post-processing consumes the mapping on the host
+  point2grid->resize(cloud_size);
+  BASE_CUDA_CHECK(cudaMemcpy(point2grid->data(), point2grid_gpu_,
+                             sizeof(int) * cloud_size,
+                             cudaMemcpyDeviceToHost));
+}
+
 void FeatureGenerator::ReleaseGPUMemory() {
   if (pc_gpu_ != nullptr) {
     BASE_CUDA_CHECK(cudaFree(pc_gpu_));
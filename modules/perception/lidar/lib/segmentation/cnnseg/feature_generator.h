@@ -59,16 +59,37 @@ class FeatureGenerator {
 #endif
   }
 
+  // @brief: compute the point-to-grid mapping and the feature maps in
+  // one fused pass on the device, writing features directly into the
+  // network input blob; the mapping is copied back into point2grid for
+  // the spp post-processing, which consumes it on the host
+  void GenerateFused(const base::PointFCloudPtr& pc_ptr,
+                     std::vector<int>* point2grid) {
+#ifndef PERCEPTION_CPU_ONLY
+    GenerateFusedGPU(pc_ptr, point2grid);
+#else
+    MapPointToGridCPU(pc_ptr, point2grid);
+    GenerateCPU(pc_ptr, *point2grid);
+#endif
+  }
+
   inline std::string Name() const { return "FeatureGenerator"; }
 
  private:
 #ifndef PERCEPTION_CPU_ONLY
   void GenerateGPU(const base::PointFCloudPtr& pc_ptr,
                    const std::vector<int>& point2grid);
+  void GenerateFusedGPU(const base::PointFCloudPtr& pc_ptr,
+                        std::vector<int>* point2grid);
+  void SetInitialFeatureMaps();
+  void EnsureDeviceCapacity(size_t cloud_size);
+  void LaunchFeatureKernels(size_t cloud_size);
   void ReleaseGPUMemory();
 #endif
   void GenerateCPU(const base::PointFCloudPtr& pc_ptr,
                    const std::vector<int>& point2grid);
+  void MapPointToGridCPU(const base::PointFCloudPtr& pc_ptr,
+                         std::vector<int>* point2grid);
 
   float LogCount(int count) {
     if (count < static_cast<int>(log_table_.size())) {
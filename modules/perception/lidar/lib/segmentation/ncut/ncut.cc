@@ -478,6 +478,9 @@ void NCut::ComputeSkeletonWeights(Eigen::MatrixXf *weights_in) {
   const double hf2 = _sigma_feature * _sigma_feature;
   const double radius2 = _connect_radius * _connect_radius;
   weights.resize(num_clusters, num_clusters);
+// pairs are independent and each (i, j) is visited by exactly one outer
+// iteration, so the rows can be assembled in parallel
+#pragma omp parallel for schedule(dynamic)
   for (int i = 0; i < num_clusters; ++i) {
     weights.coeffRef(i, i) = 1.f;
     for (int j = i + 1; j < num_clusters; ++j) {
@@ -585,69 +588,153 @@ void NCut::LaplacianDecomposition(const Eigen::MatrixXf &weights,
 // std::cout << "laplacian 0:\n " << weights << std::endl << std::endl;
 #endif
   Eigen::MatrixXf &eigenvectors = *eigenvectors_in;
+  const int num_clusters = static_cast<int>(weights.rows());
+  // only the two smallest eigenvectors are used by the split search
+  const int kNumEigenPairs = 2;
   // .1 degree matrix: D = sum(W, 2)
   Eigen::VectorXf diag(weights.rows());
   for (int i = 0; i < weights.rows(); ++i) {
     diag.coeffRef(i) = weights.row(i).sum();
   }
-  // .2 graph laplacian L = D - W
-  Eigen::MatrixXf laplacian(weights.rows(), weights.cols());
-  for (int i = 0; i < laplacian.rows(); ++i) {
-    for (int j = 0; j < laplacian.cols(); ++j) {
-      if (i == j) {
-        laplacian.coeffRef(i, j) = diag.coeffRef(i) - weights.coeffRef(i, j);
-      } else {
-        laplacian.coeffRef(i, j) = 0.f - weights.coeffRef(i, j);
-      }
-    }
-  }
-#ifdef DEBUG_NCUT
-// std::cout << "laplacian 1:\n " << laplacian << std::endl << std::endl;
-#endif
-  // .3 D^(-1/2)
+  // .2 D^(-1/2)
   Eigen::VectorXf diag_halfinv(weights.rows());
   for (int i = 0; i < weights.rows(); ++i) {
     diag_halfinv.coeffRef(i) =
         static_cast<float>(1.0 / std::sqrt(diag.coeffRef(i)));
   }
-  // .4 normalized laplacian D^(-1/2) * L * D^(-1/2)
-  for (int i = 0; i < laplacian.rows(); ++i) {
-    laplacian.row(i) *= diag_halfinv.coeffRef(i);
-  }
-  for (int j = 0; j < laplacian.cols(); ++j) {
-    laplacian.col(j) *= diag_halfinv.coeffRef(j);
-  }
-  // .4.2 for numerical stability, add eps to the diagonal of laplacian
-  float eps = 1e-10f;
-  for (int i = 0; i < laplacian.rows(); ++i) {
-    laplacian.coeffRef(i, i) += eps;
+  // .3 normalized affinity N = D^(-1/2) * W * D^(-1/2), kept sparse since
+  // pairs beyond the connect radius carry exact zeros. The smallest
+  // eigenvectors of the normalized laplacian L = I - N are the largest
+  // eigenvectors of N.
+  std::vector<Eigen::Triplet<float>> triplets;
+  triplets.reserve(num_clusters * 8);
+  for (int i = 0; i < num_clusters; ++i) {
+    for (int j = 0; j < num_clusters; ++j) {
+      const float wij = weights.coeffRef(i, j);
+      if (wij != 0.f) {
+        triplets.emplace_back(
+            i, j, wij * diag_halfinv.coeffRef(i) * diag_halfinv.coeffRef(j));
+      }
+    }
   }
-#ifdef DEBUG_NCUT
-// std::cout << "laplacian 2:\n " << laplacian << std::endl << std::endl;
-#endif
-  // .5 solve eigen decompostion: TODO: lanczos
-  Eigen::EigenSolver<MatrixXf> eig_solver(laplacian);
-#ifdef DEBUG_NCUT
-// std::cout << "eigvec 1:\n " << eig_solver.eigenvectors() << std::endl <<
-// std::endl;
-#endif
-  // .6 sort eigen values
-  std::vector<std::pair<float, int>> eigval(laplacian.rows());
-  for (size_t i = 0; i < eigval.size(); ++i) {
-    eigval[i] = std::make_pair(eig_solver.eigenvalues()[i].real(), i);
-  }
-  std::sort(eigval.begin(), eigval.end(), std::less<std::pair<float, int>>());
-  // .7 get sorted eigen vectors
-  eigenvectors.resize(weights.rows(), weights.cols());
-  for (int i = 0; i < eigenvectors.cols(); ++i) {
-    eigenvectors.col(i) =
-        eig_solver.eigenvectors().col(eigval[i].second).real();
+  Eigen::SparseMatrix<float> normalized_affinity(num_clusters, num_clusters);
+  normalized_affinity.setFromTriplets(triplets.begin(), triplets.end());
+  // .4 eigen decomposition: lanczos on the sparse affinity; small problems
+  // and the rare non-converged case fall back to the exact dense solver
+  const int kMinClustersForLanczos = 50;
+  Eigen::VectorXf lanczos_eigenvalues;
+  Eigen::MatrixXf lanczos_eigenvectors;
+  bool solved = false;
+  if (num_clusters >= kMinClustersForLanczos) {
+    solved = LanczosLargestEigenPairs(normalized_affinity, kNumEigenPairs,
+                                      &lanczos_eigenvalues,
+                                      &lanczos_eigenvectors);
+  }
+  eigenvectors.resize(num_clusters, kNumEigenPairs);
+  if (solved) {
+    // largest eigenvectors of N in descending order are the smallest of L
+    for (int i = 0; i < kNumEigenPairs; ++i) {
+      eigenvectors.col(i) = lanczos_eigenvectors.col(kNumEigenPairs - 1 - i);
+    }
+  } else {
+    Eigen::MatrixXf laplacian = -Eigen::MatrixXf(normalized_affinity);
+    for (int i = 0; i < num_clusters; ++i) {
+      laplacian.coeffRef(i, i) += 1.f;
+    }
+    Eigen::SelfAdjointEigenSolver<MatrixXf> eig_solver(laplacian);
+    // eigenvalues are sorted in increasing order
+    for (int i = 0; i < kNumEigenPairs; ++i) {
+      eigenvectors.col(i) = eig_solver.eigenvectors().col(i);
+    }
   }
+  // .5 back to generalized eigenvectors of (L, D)
   for (int i = 0; i < eigenvectors.rows(); ++i) {
     eigenvectors.row(i) *= diag_halfinv.coeffRef(i);
   }
 }
 
+bool NCut::LanczosLargestEigenPairs(
+    const Eigen::SparseMatrix<float> &affinity, int num_pairs,
+    Eigen::VectorXf *eigenvalues, Eigen::MatrixXf *eigenvectors) {
+  const int n = static_cast<int>(affinity.rows());
+  // degenerate top eigenvalues of disconnected graphs converge slowly, so
+  // allow a generous number of steps; each one is only a sparse matvec plus
+  // reorthogonalization
+  const int num_steps = std::min(n, std::max(8 * num_pairs, 120));
+  const float kBreakdownEps = 1e-8f;
+  const float kResidualTol = 1e-3f;
+  Eigen::MatrixXf basis(n, num_steps);
+  Eigen::VectorXf alpha(num_steps);
+  Eigen::VectorXf beta(num_steps);
+  // the all-ones vector is close to the dominant eigenvector of the
+  // normalized affinity, which speeds up convergence
+  basis.col(0) = Eigen::VectorXf::Constant(n, 1.f).normalized();
+  int num_basis = 0;
+  for (int j = 0; j < num_steps; ++j) {
+    Eigen::VectorXf w = affinity * basis.col(j);
+    alpha.coeffRef(j) = basis.col(j).dot(w);
+    // full reorthogonalization (twice) keeps the basis orthogonal in float
+    w -= basis.leftCols(j + 1) * (basis.leftCols(j + 1).transpose() * w);
+    w -= basis.leftCols(j + 1) * (basis.leftCols(j + 1).transpose() * w);
+    num_basis = j + 1;
+    if (j + 1 == num_steps) {
+      break;
+    }
+    float norm = w.norm();
+    if (norm < kBreakdownEps) {
+      // invariant subspace found: restart with a deterministic vector
+      // orthogonal to the current basis
+      for (int t = 0; t < n; ++t) {
+        w.coeffRef(t) = std::sin(static_cast<float>(t + j + 1));
+      }
+      w -= basis.leftCols(j + 1) * (basis.leftCols(j + 1).transpose() * w);
+      norm = w.norm();
+      if (norm < kBreakdownEps) {
+        break;
+      }
+      beta.coeffRef(j) = 0.f;
+    } else {
+      beta.coeffRef(j) = norm;
+    }
+    basis.col(j + 1) = w / norm;
+  }
+  if (num_basis < num_pairs) {
+    return false;
+  }
+  // Rayleigh quotient matrix is tridiagonal in the lanczos basis
+  Eigen::MatrixXf tridiagonal = Eigen::MatrixXf::Zero(num_basis, num_basis);
+  for (int j = 0; j < num_basis; ++j) {
+    tridiagonal.coeffRef(j, j) = alpha.coeffRef(j);
+    if (j + 1 < num_basis) {
+      tridiagonal.coeffRef(j, j + 1) = beta.coeffRef(j);
+      tridiagonal.coeffRef(j + 1, j) = beta.coeffRef(j);
+    }
+  }
+  Eigen::SelfAdjointEigenSolver<MatrixXf> tri_solver(tridiagonal);
+  if (tri_solver.info() != Eigen::Success) {
+    return false;
+  }
+  // ritz pairs for the num_pairs largest eigenvalues, ascending
+  eigenvalues->resize(num_pairs);
+  eigenvectors->resize(n, num_pairs);
+  for (int i = 0; i < num_pairs; ++i) {
+    const int idx = num_basis - num_pairs + i;
+    eigenvalues->coeffRef(i) = tri_solver.eigenvalues().coeffRef(idx);
+    eigenvectors->col(i) =
+        (basis.leftCols(num_basis) * tri_solver.eigenvectors().col(idx))
+            .normalized();
+    // reject non-converged ritz pairs so the caller can fall back to the
+    // exact dense solver
+    const float residual = (affinity * eigenvectors->col(i) -
+                            eigenvalues->coeffRef(i) * eigenvectors->col(i))
+                               .norm();
+    if (residual > kResidualTol) {
+      return false;
+    }
+  }
+  return true;
+}
+
 bool NCut::ComputeSquaredSkeletonDistance(const Eigen::MatrixXf &in1_points,
                                           const Eigen::MatrixXf &in1_features,
                                           const Eigen::MatrixXf &in2_points,
@@ -26,6 +26,7 @@
 
 #include <opencv2/opencv.hpp>
 #include "Eigen/Core"
+#include "Eigen/SparseCore"
 
 #include "modules/perception/lidar/lib/segmentation/ncut/common/flood_fill.h"
 #include "modules/perception/lidar/lib/segmentation/ncut/common/lr_classifier.h"
@@ -150,6 +151,13 @@ class NCut {
   void LaplacianDecomposition(const Eigen::MatrixXf& weights,
                               Eigen::MatrixXf* eigenvectors);
 
+  // Lanczos iteration with full reorthogonalization for the num_pairs largest
+  // eigenpairs of a symmetric sparse matrix; eigenvalues are returned in
+  // ascending order
+  bool LanczosLargestEigenPairs(const Eigen::SparseMatrix<float>& affinity,
+                                int num_pairs, Eigen::VectorXf* eigenvalues,
+                                Eigen::MatrixXf* eigenvectors);
+
   bool ComputeSquaredSkeletonDistance(const Eigen::MatrixXf& in1_points,
                                       const Eigen::MatrixXf& in1_features,
                                       const Eigen::MatrixXf& in2_points,
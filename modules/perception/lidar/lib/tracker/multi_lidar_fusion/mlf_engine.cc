@@ -119,6 +119,11 @@ bool MlfEngine::Track(const MultiTargetTrackerOptions& options,
   AINFO << "MlfEngine publish objects: " << frame->tracked_objects.size()
         << " sensor_name: " << frame->sensor_info.name
         << " at timestamp: " << frame->timestamp;
+  ADEBUG << "MlfEngine pool occupancy, tracked_object: "
+         << TrackedObjectPool::Instance().InUseNum() << " (peak "
+         << TrackedObjectPool::Instance().PeakInUseNum()
+         << "), mlf_track_data: " << MlfTrackDataPool::Instance().InUseNum()
+         << " (peak " << MlfTrackDataPool::Instance().PeakInUseNum() << ")";
   return true;
 }
 
@@ -16,6 +16,8 @@
 
 #include "modules/perception/lidar/lib/tracker/multi_lidar_fusion/mlf_track_object_distance.h"
 
+#include <utility>
+
 #include "cyber/common/file.h"
 #include "modules/perception/lib/config_manager/config_manager.h"
 #include "modules/perception/lidar/lib/tracker/association/distance_collection.h"
@@ -56,7 +58,7 @@ bool MlfTrackObjectDistance::Init(
   for (int i = 0; i < config.foreground_weights_size(); ++i) {
     const auto& fgws = config.foreground_weights(i);
     const std::string& name = fgws.sensor_name_pair();
-    std::vector<float> weights(7, 0.f);
+    std::vector<float> weights(8, 0.f);
     weights[0] = fgws.location_dist_weight();
     weights[1] = fgws.direction_dist_weight();
     weights[2] = fgws.bbox_size_dist_weight();
@@ -161,6 +163,92 @@ float MlfTrackObjectDistance::ComputeDistance(
   return distance;
 }
 
+float MlfTrackObjectDistance::LocationDistanceWeight(
+    const std::string& key, bool is_background) const {
+  const std::vector<float>* weights = nullptr;
+  if (is_background) {
+    auto iter = background_weight_table_.find(key);
+    weights = iter == background_weight_table_.end() ? &kBackgroundDefaultWeight
+                                                     : &iter->second;
+  } else {
+    auto iter = foreground_weight_table_.find(key);
+    weights = iter == foreground_weight_table_.end() ? &kForegroundDefaultWeight
+                                                     : &iter->second;
+  }
+  if (weights->empty()) {
+    return 0.f;
+  }
+  return weights->at(0);
+}
+
+void MlfTrackObjectDistance::ComputeDistanceMatrix(
+    const std::vector<MlfTrackDataPtr>& tracks,
+    const std::vector<TrackedObjectPtr>& new_objects,
+    float max_match_distance, float bound_value,
+    common::SecureMat<float>* association_mat) const {
+  if (tracks.empty() || new_objects.empty()) {
+    return;
+  }
+  // gather the object state once as struct-of-arrays, so the gate below
+  // is evaluated with vectorized array expressions per track
+  const size_t num_objects = new_objects.size();
+  Eigen::ArrayXd object_x(num_objects);
+  Eigen::ArrayXd object_y(num_objects);
+  Eigen::ArrayXd object_time(num_objects);
+  const std::string& object_sensor_name = new_objects[0]->sensor_info.name;
+  bool same_sensor = true;
+  for (size_t j = 0; j < num_objects; ++j) {
+    object_x(j) = new_objects[j]->anchor_point(0);
+    object_y(j) = new_objects[j]->anchor_point(1);
+    object_time(j) = new_objects[j]->object_ptr->latest_tracked_time;
+    same_sensor =
+        same_sensor && new_objects[j]->sensor_info.name == object_sensor_name;
+  }
+  // sqrt(0.5) is the smallest anisotropic scale LocationDistance applies
+  // to the euclidean anchor distance, so scale * distance is a true
+  // lower bound of the location term
+  static constexpr double kMinLocationScale = 0.70710678;
+  // safety margin against float rounding in the exact computation
+  const double gate_distance = static_cast<double>(max_match_distance) + 1e-2;
+  Eigen::ArrayXd lower_bound(num_objects);
+  for (size_t i = 0; i < tracks.size(); ++i) {
+    const MlfTrackDataPtr& track = tracks[i];
+    const std::pair<double, TrackedObjectPtr> latest =
+        track->GetLatestObject();
+    const TrackedObjectPtr& latest_object = latest.second;
+    float location_weight = 0.f;
+    if (same_sensor && latest_object != nullptr) {
+      location_weight = LocationDistanceWeight(
+          latest_object->sensor_info.name + object_sensor_name,
+          new_objects[0]->is_background);
+    }
+    const bool use_gate = location_weight > 1e-10f;
+    if (use_gate) {
+      const Eigen::Vector3d& anchor = latest_object->belief_anchor_point;
+      const Eigen::Vector3d& velocity = latest_object->output_velocity;
+      const double latest_time = latest.first;
+      const double speed = velocity.head<2>().norm();
+      const double scale = speed > 2 ? kMinLocationScale : 1.0;
+      lower_bound =
+          ((object_x - (anchor(0) + velocity(0) * (object_time - latest_time)))
+               .square() +
+           (object_y - (anchor(1) + velocity(1) * (object_time - latest_time)))
+               .square())
+              .sqrt() *
+          (scale * static_cast<double>(location_weight));
+    }
+    for (size_t j = 0; j < num_objects; ++j) {
+      if (use_gate && lower_bound(j) > gate_distance) {
+        // every other distance term is non-negative, so this pair can
+        // never fall below the match threshold
+        (*association_mat)(i, j) = bound_value;
+      } else {
+        (*association_mat)(i, j) = ComputeDistance(new_objects[j], track);
+      }
+    }
+  }
+}
+
 }  // namespace lidar
 }  // namespace perception
 }  // namespace apollo
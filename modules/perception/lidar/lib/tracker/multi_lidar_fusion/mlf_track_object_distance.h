@@ -19,6 +19,7 @@
 #include <string>
 #include <vector>
 
+#include "modules/perception/common/graph/secure_matrix.h"
 #include "modules/perception/lidar/lib/tracker/common/mlf_track_data.h"
 #include "modules/perception/lidar/lib/tracker/common/tracked_object.h"
 
@@ -43,9 +44,29 @@ class MlfTrackObjectDistance {
   float ComputeDistance(const TrackedObjectConstPtr& object,
                         const MlfTrackDataConstPtr& track) const;
 
+  // @brief: compute the whole track-object association matrix; the
+  //         object state is gathered once as struct-of-arrays and a
+  //         vectorized location lower bound gates the full per-pair
+  //         distance, pairs provably beyond max_match_distance are set
+  //         to bound_value without being evaluated
+  // @params [in]: track data
+  // @params [in]: new objects
+  // @params [in]: distance threshold beyond which a pair cannot match
+  // @params [in]: value stored for gated-out pairs
+  // @params [out]: association matrix, sized by the caller
+  void ComputeDistanceMatrix(const std::vector<MlfTrackDataPtr>& tracks,
+                             const std::vector<TrackedObjectPtr>& new_objects,
+                             float max_match_distance, float bound_value,
+                             common::SecureMat<float>* association_mat) const;
+
   std::string Name() const { return "MlfTrackObjectDistance"; }
 
  protected:
+  // location distance weight of the given sensor-name pair, the only
+  // term used in the association gate
+  float LocationDistanceWeight(const std::string& key,
+                               bool is_background) const;
+
   std::map<std::string, std::vector<float> > foreground_weight_table_;
   std::map<std::string, std::vector<float> > background_weight_table_;
 
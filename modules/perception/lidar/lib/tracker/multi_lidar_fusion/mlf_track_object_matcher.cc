@@ -107,12 +107,10 @@ void MlfTrackObjectMatcher::ComputeAssociateMatrix(
     const std::vector<MlfTrackDataPtr> &tracks,
     const std::vector<TrackedObjectPtr> &new_objects,
     common::SecureMat<float> *association_mat) {
-  for (size_t i = 0; i < tracks.size(); ++i) {
-    for (size_t j = 0; j < new_objects.size(); ++j) {
-      (*association_mat)(i, j) =
-          track_object_distance_->ComputeDistance(new_objects[j], tracks[i]);
-    }
-  }
+  // pairs whose location lower bound already exceeds the match distance
+  // are filled with bound_value without evaluating the full distance
+  track_object_distance_->ComputeDistanceMatrix(
+      tracks, new_objects, max_match_distance_, bound_value_, association_mat);
 }
 
 }  // namespace lidar
@@ -15,6 +15,8 @@
  *****************************************************************************/
 #include "modules/perception/onboard/component/fusion_component.h"
 
+#include "modules/common/adapters/adapter_gflags.h"
+#include "modules/common/latency_recorder/latency_recorder.h"
 #include "modules/common/time/time.h"
 #include "modules/perception/base/object_pool_types.h"
 #include "modules/perception/lib/utils/perf.h"
@@ -54,8 +56,9 @@ bool FusionComponent::Proc(const std::shared_ptr<SensorFrameMessage>& message) {
   if (message->process_stage_ == ProcessStage::SENSOR_FUSION) {
     return true;
   }
-  std::shared_ptr<PerceptionObstacles> out_message(new (std::nothrow)
-                                                       PerceptionObstacles);
+  const auto latency_begin_time = ::apollo::common::time::Clock::Now();
+  std::shared_ptr<PerceptionObstacles> out_message =
+      MsgSerializer::AcquireMessage(writer_->GetChannelName());
   std::shared_ptr<SensorFrameMessage> viz_message(new (std::nothrow)
                                                       SensorFrameMessage);
   bool status = InternalProc(message, out_message, viz_message);
@@ -68,6 +71,13 @@ bool FusionComponent::Proc(const std::shared_ptr<SensorFrameMessage>& message) {
       // Send("/apollo/perception/obstacles", out_message);
       writer_->Write(out_message);
       AINFO << "Send fusion processing output message.";
+      // measure latency; records with message_id 0 are dropped by the
+      // recorder, so camera-only frames do not pollute the lidar trace
+      static ::apollo::common::LatencyRecorder latency_recorder(
+          FLAGS_perception_obstacle_topic);
+      latency_recorder.AppendLatencyRecord(
+          out_message->header().lidar_timestamp(), latency_begin_time,
+          ::apollo::common::time::Clock::Now());
       // send msg for visualization
       if (FLAGS_obs_enable_visualization) {
         // Send("/apollo/perception/inner/PrefusedObjects", viz_message);
@@ -0,0 +1,79 @@
+/******************************************************************************
+ * Copyright 2020 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+#include "modules/perception/onboard/frame_store/frame_store.h"
+
+#include "cyber/common/log.h"
+
+namespace apollo {
+namespace perception {
+namespace onboard {
+
+namespace {
+// Frames outlive their consumers only through leaked references; warn once
+// the store grows beyond what an onboard pipeline legitimately keeps alive.
+constexpr size_t kStoredFrameWarningSize = 64;
+}  // namespace
+
+FrameStore::FrameStore() {}
+
+uint64_t FrameStore::Store(const base::FramePtr& frame) {
+  if (frame == nullptr) {
+    AERROR << "Refuse to store null frame.";
+    return kInvalidHandle;
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  const uint64_t handle = next_handle_++;
+  Slot& slot = slots_[handle];
+  slot.frame = frame;
+  slot.ref_count = 1;
+  if (slots_.size() > kStoredFrameWarningSize) {
+    AWARN << "Frame store holds " << slots_.size()
+          << " frames; a consumer may be leaking references.";
+  }
+  return handle;
+}
+
+base::FramePtr FrameStore::Acquire(uint64_t handle) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto iter = slots_.find(handle);
+  if (iter == slots_.end()) {
+    AERROR << "Unknown frame handle: " << handle;
+    return nullptr;
+  }
+  ++iter->second.ref_count;
+  return iter->second.frame;
+}
+
+void FrameStore::Release(uint64_t handle) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto iter = slots_.find(handle);
+  if (iter == slots_.end()) {
+    AERROR << "Release of unknown frame handle: " << handle;
+    return;
+  }
+  if (--iter->second.ref_count <= 0) {
+    slots_.erase(iter);
+  }
+}
+
+size_t FrameStore::Size() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return slots_.size();
+}
+
+}  // namespace onboard
+}  // namespace perception
+}  // namespace apollo
@@ -0,0 +1,73 @@
+/******************************************************************************
+ * Copyright 2020 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+#pragma once
+
+#include <mutex>
+#include <unordered_map>
+
+#include "cyber/common/macros.h"
+#include "modules/perception/base/frame.h"
+
+namespace apollo {
+namespace perception {
+namespace onboard {
+
+// A ref-counted registry of base::Frame payloads addressed by frame handle.
+// Producers store a frame once and pass the handle downstream, so consumers
+// within the same mainboard process group share the payload instead of
+// copying it. The store owns one reference per handle plus one per
+// outstanding Acquire; the payload is dropped when the last reference is
+// released.
+//
+// NOTE: the registry lives in process-local memory. base::Frame holds
+// pointer-linked payloads (point clouds, images, object graphs) that cannot
+// be mapped into another address space as-is, so handles are only valid for
+// components loaded into the same mainboard process.
+class FrameStore {
+ public:
+  static constexpr uint64_t kInvalidHandle = 0;
+
+  // Registers a frame and returns its handle. The store keeps one reference
+  // until Release() is called with the returned handle.
+  uint64_t Store(const base::FramePtr& frame);
+
+  // Returns the frame of the handle and takes an additional reference, or
+  // nullptr if the handle is unknown. Each successful Acquire() must be
+  // paired with a Release().
+  base::FramePtr Acquire(uint64_t handle);
+
+  // Drops one reference of the handle. The frame is removed from the store
+  // when its reference count reaches zero.
+  void Release(uint64_t handle);
+
+  size_t Size() const;
+
+ private:
+  struct Slot {
+    base::FramePtr frame;
+    int ref_count = 0;
+  };
+
+  mutable std::mutex mutex_;
+  uint64_t next_handle_ = 1;
+  std::unordered_map<uint64_t, Slot> slots_;
+
+  DECLARE_SINGLETON(FrameStore)
+};
+
+}  // namespace onboard
+}  // namespace perception
+}  // namespace apollo
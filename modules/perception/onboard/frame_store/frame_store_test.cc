@@ -0,0 +1,74 @@
+/******************************************************************************
+ * Copyright 2020 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+#include "modules/perception/onboard/frame_store/frame_store.h"
+
+#include "gtest/gtest.h"
+
+namespace apollo {
+namespace perception {
+namespace onboard {
+
+TEST(FrameStoreTest, store_acquire_release) {
+  FrameStore* store = FrameStore::Instance();
+  base::FramePtr frame(new base::Frame);
+  frame->timestamp = 1234.5;
+
+  const uint64_t handle = store->Store(frame);
+  EXPECT_NE(handle, FrameStore::kInvalidHandle);
+  EXPECT_EQ(store->Size(), 1u);
+
+  // Consumers get the stored payload, not a copy.
+  base::FramePtr acquired = store->Acquire(handle);
+  ASSERT_NE(acquired, nullptr);
+  EXPECT_EQ(acquired.get(), frame.get());
+  EXPECT_DOUBLE_EQ(acquired->timestamp, 1234.5);
+
+  // The producer reference alone keeps the frame alive.
+  store->Release(handle);
+  EXPECT_EQ(store->Size(), 1u);
+  store->Release(handle);
+  EXPECT_EQ(store->Size(), 0u);
+
+  EXPECT_EQ(store->Acquire(handle), nullptr);
+}
+
+TEST(FrameStoreTest, invalid_input) {
+  FrameStore* store = FrameStore::Instance();
+  EXPECT_EQ(store->Store(nullptr), FrameStore::kInvalidHandle);
+  EXPECT_EQ(store->Acquire(FrameStore::kInvalidHandle), nullptr);
+  store->Release(FrameStore::kInvalidHandle);
+  EXPECT_EQ(store->Size(), 0u);
+}
+
+TEST(FrameStoreTest, distinct_handles) {
+  FrameStore* store = FrameStore::Instance();
+  base::FramePtr first(new base::Frame);
+  base::FramePtr second(new base::Frame);
+  const uint64_t first_handle = store->Store(first);
+  const uint64_t second_handle = store->Store(second);
+  EXPECT_NE(first_handle, second_handle);
+  EXPECT_EQ(store->Acquire(first_handle).get(), first.get());
+  EXPECT_EQ(store->Acquire(second_handle).get(), second.get());
+  store->Release(first_handle);
+  store->Release(first_handle);
+  store->Release(second_handle);
+  store->Release(second_handle);
+  EXPECT_EQ(store->Size(), 0u);
+}
+
+}  // namespace onboard
+}  // namespace perception
+}  // namespace apollo
@@ -66,6 +66,11 @@ class SensorFrameMessage {
 
   base::FramePtr frame_;
 
+  // Handle of frame_ in the onboard FrameStore. Components deployed as
+  // separate mainboard processes exchange this handle instead of the
+  // pointer-linked frame payload; zero means the frame is not registered.
+  uint64_t frame_store_handle_ = 0;
+
   ProcessStage process_stage_ = ProcessStage::UNKNOWN_STAGE;
 };
 
@@ -16,6 +16,9 @@
 #include "modules/perception/onboard/msg_serializer/msg_serializer.h"
 
 #include <limits>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
 
 #include "cyber/common/log.h"
 
@@ -27,6 +30,58 @@ namespace apollo {
 namespace perception {
 namespace onboard {
 
+namespace {
+
+// A few spare messages per channel cover the messages still referenced by
+// the transport when the next cycle starts.
+constexpr size_t kMaxFreeMessagesPerChannel = 4;
+
+struct ChannelMessagePool {
+  std::mutex mutex;
+  std::unordered_map<std::string,
+                     std::vector<std::unique_ptr<PerceptionObstacles>>>
+      free_messages;
+};
+
+// The pool is shared with the message deleters so that messages released
+// during static destruction do not touch a destroyed pool.
+std::shared_ptr<ChannelMessagePool> GetChannelMessagePool() {
+  static const auto pool = std::make_shared<ChannelMessagePool>();
+  return pool;
+}
+
+}  // namespace
+
+std::shared_ptr<PerceptionObstacles> MsgSerializer::AcquireMessage(
+    const std::string& channel_name) {
+  auto pool = GetChannelMessagePool();
+  std::unique_ptr<PerceptionObstacles> message;
+  {
+    std::lock_guard<std::mutex> lock(pool->mutex);
+    auto& free_list = pool->free_messages[channel_name];
+    if (!free_list.empty()) {
+      message = std::move(free_list.back());
+      free_list.pop_back();
+    }
+  }
+  if (message == nullptr) {
+    message.reset(new PerceptionObstacles());
+  }
+  return std::shared_ptr<PerceptionObstacles>(
+      message.release(), [pool, channel_name](PerceptionObstacles* msg) {
+        // Clear() keeps the allocated repeated-field elements cached inside
+        // the message, so recycling the message reuses their capacity.
+        msg->Clear();
+        std::lock_guard<std::mutex> lock(pool->mutex);
+        auto& free_list = pool->free_messages[channel_name];
+        if (free_list.size() < kMaxFreeMessagesPerChannel) {
+          free_list.emplace_back(msg);
+        } else {
+          delete msg;
+        }
+      });
+}
+
 bool MsgSerializer::SerializeMsg(double timestamp, uint64_t lidar_timestamp,
                                  int seq_num,
                                  const std::vector<base::ObjectPtr> &objects,
@@ -15,6 +15,8 @@
  *****************************************************************************/
 #pragma once
 
+#include <memory>
+#include <string>
 #include <vector>
 
 #include "cyber/time/time.h"
@@ -36,6 +38,12 @@ class MsgSerializer {
                            const apollo::common::ErrorCode& error_code,
                            PerceptionObstacles* obstacles);
 
+  // Get an output message recycled per channel. A returned message keeps
+  // the repeated-field capacity of the previous cycles on its channel, so
+  // steady-state serialization stops allocating per object.
+  static std::shared_ptr<PerceptionObstacles> AcquireMessage(
+      const std::string& channel_name);
+
  private:
   static bool ConvertObjectToPb(const base::ObjectPtr& object_ptr,
                                 PerceptionObstacle* pb_msg);
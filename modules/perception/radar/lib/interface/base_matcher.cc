@@ -15,6 +15,8 @@
  *****************************************************************************/
 #include "modules/perception/radar/lib/interface/base_matcher.h"
 #include <numeric>
+#include <unordered_map>
+#include <vector>
 
 namespace apollo {
 namespace perception {
@@ -53,6 +55,13 @@ void BaseMatcher::IDMatch(const std::vector<RadarTrackPtr> &radar_tracks,
   }
   std::vector<bool> track_used(num_track, false);
   std::vector<bool> object_used(num_obj, false);
+  // Index the detections by sensor track id, so each track only visits the
+  // detections sharing its id instead of the whole frame.
+  std::unordered_map<int, std::vector<size_t>> object_track_ids;
+  object_track_ids.reserve(num_obj);
+  for (size_t j = 0; j < num_obj; ++j) {
+    object_track_ids[objects[j]->track_id].push_back(j);
+  }
   for (size_t i = 0; i < num_track; ++i) {
     const auto &track_object = radar_tracks[i]->GetObsRadar();
     double track_timestamp = radar_tracks[i]->GetTimestamp();
@@ -60,11 +69,12 @@ void BaseMatcher::IDMatch(const std::vector<RadarTrackPtr> &radar_tracks,
       AERROR << "track_object is not available";
       continue;
     }
-    int track_object_track_id = track_object->track_id;
-    for (size_t j = 0; j < num_obj; ++j) {
-      int object_track_id = objects[j]->track_id;
-      if (track_object_track_id == object_track_id &&
-          RefinedTrack(track_object, track_timestamp, objects[j],
+    auto iter = object_track_ids.find(track_object->track_id);
+    if (iter == object_track_ids.end()) {
+      continue;
+    }
+    for (const size_t j : iter->second) {
+      if (RefinedTrack(track_object, track_timestamp, objects[j],
                        object_timestamp)) {
         assignments->push_back(std::pair<size_t, size_t>(i, j));
         track_used[i] = true;
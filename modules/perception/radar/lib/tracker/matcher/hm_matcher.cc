@@ -15,8 +15,12 @@
  *****************************************************************************/
 #include "modules/perception/radar/lib/tracker/matcher/hm_matcher.h"
 
+#include <algorithm>
+#include <cmath>
 #include <string>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "cyber/common/file.h"
 #include "cyber/common/log.h"
@@ -28,6 +32,15 @@ namespace radar {
 
 using cyber::common::GetAbsolutePath;
 
+namespace {
+
+uint64_t GridCellKey(const int64_t cell_x, const int64_t cell_y) {
+  return (static_cast<uint64_t>(static_cast<uint32_t>(cell_x)) << 32) |
+         static_cast<uint64_t>(static_cast<uint32_t>(cell_y));
+}
+
+}  // namespace
+
 HMMatcher::HMMatcher() { name_ = "HMMatcher"; }
 
 HMMatcher::~HMMatcher() {}
@@ -150,20 +163,80 @@ void HMMatcher::ComputeAssociationMat(
     const std::vector<size_t> &unassigned_objects,
     std::vector<std::vector<double> > *association_mat) {
   double frame_timestamp = radar_frame.timestamp;
+  // The gated matcher treats every cost of at least max_match_distance as
+  // disconnected and internally replaces such costs with
+  // bound_match_distance. Since the association cost is the mean of the
+  // forward and backward prediction distances, a pair whose forward distance
+  // reaches 2 * max_match_distance can never pass the gate, so its exact
+  // cost is irrelevant and bound_match_distance is an equivalent fill value.
+  const double gate_radius = 2.0 * BaseMatcher::GetMaxMatchDistance();
+  if (gate_radius <= 0.0) {
+    for (size_t i = 0; i < unassigned_tracks.size(); ++i) {
+      for (size_t j = 0; j < unassigned_objects.size(); ++j) {
+        const base::ObjectPtr &track_object =
+            radar_tracks[unassigned_tracks[i]]->GetObs();
+        const base::ObjectPtr &frame_object =
+            radar_frame.objects[unassigned_objects[j]];
+        double track_timestamp =
+            radar_tracks[unassigned_tracks[i]]->GetTimestamp();
+        double distance_forward = DistanceBetweenObs(
+            track_object, track_timestamp, frame_object, frame_timestamp);
+        double distance_backward = DistanceBetweenObs(
+            frame_object, frame_timestamp, track_object, track_timestamp);
+        association_mat->at(i).at(j) =
+            0.5 * distance_forward + 0.5 * distance_backward;
+      }
+    }
+    return;
+  }
+
+  // Bin the detections into a coarse grid keyed by their 2d center, so each
+  // track only examines the detections within gating range of its predicted
+  // position instead of the whole frame.
+  std::unordered_map<uint64_t, std::vector<size_t>> object_grid;
+  object_grid.reserve(unassigned_objects.size());
+  for (size_t j = 0; j < unassigned_objects.size(); ++j) {
+    const base::ObjectPtr &frame_object =
+        radar_frame.objects[unassigned_objects[j]];
+    const int64_t cell_x =
+        static_cast<int64_t>(std::floor(frame_object->center(0) / gate_radius));
+    const int64_t cell_y =
+        static_cast<int64_t>(std::floor(frame_object->center(1) / gate_radius));
+    object_grid[GridCellKey(cell_x, cell_y)].push_back(j);
+  }
+
+  const double bound_value = BaseMatcher::GetBoundMatchDistance();
   for (size_t i = 0; i < unassigned_tracks.size(); ++i) {
-    for (size_t j = 0; j < unassigned_objects.size(); ++j) {
-      const base::ObjectPtr &track_object =
-          radar_tracks[unassigned_tracks[i]]->GetObs();
-      const base::ObjectPtr &frame_object =
-          radar_frame.objects[unassigned_objects[j]];
-      double track_timestamp =
-          radar_tracks[unassigned_tracks[i]]->GetTimestamp();
-      double distance_forward = DistanceBetweenObs(
-          track_object, track_timestamp, frame_object, frame_timestamp);
-      double distance_backward = DistanceBetweenObs(
-          frame_object, frame_timestamp, track_object, track_timestamp);
-      association_mat->at(i).at(j) =
-          0.5 * distance_forward + 0.5 * distance_backward;
+    const base::ObjectPtr &track_object =
+        radar_tracks[unassigned_tracks[i]]->GetObs();
+    double track_timestamp = radar_tracks[unassigned_tracks[i]]->GetTimestamp();
+    double time_diff = frame_timestamp - track_timestamp;
+    // Motion-compensate the track once per frame instead of once per pair.
+    const Eigen::Vector3d predicted_center =
+        track_object->center +
+        track_object->velocity.cast<double>() * time_diff;
+    std::vector<double> &row = association_mat->at(i);
+    std::fill(row.begin(), row.end(), bound_value);
+    const int64_t cell_x =
+        static_cast<int64_t>(std::floor(predicted_center(0) / gate_radius));
+    const int64_t cell_y =
+        static_cast<int64_t>(std::floor(predicted_center(1) / gate_radius));
+    for (int64_t dx = -1; dx <= 1; ++dx) {
+      for (int64_t dy = -1; dy <= 1; ++dy) {
+        auto iter = object_grid.find(GridCellKey(cell_x + dx, cell_y + dy));
+        if (iter == object_grid.end()) {
+          continue;
+        }
+        for (const size_t j : iter->second) {
+          const base::ObjectPtr &frame_object =
+              radar_frame.objects[unassigned_objects[j]];
+          double distance_forward =
+              (frame_object->center - predicted_center).head(2).norm();
+          double distance_backward = DistanceBetweenObs(
+              frame_object, frame_timestamp, track_object, track_timestamp);
+          row[j] = 0.5 * distance_forward + 0.5 * distance_backward;
+        }
+      }
     }
   }
 }
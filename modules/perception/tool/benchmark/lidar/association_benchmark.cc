@@ -0,0 +1,189 @@
+/******************************************************************************
+ * Copyright 2019 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+// Micro benchmark for the track-object association cost computation of
+// the multi lidar fusion tracker. A synthetic scene with several hundred
+// tracks and detections is associated with the plain per-pair distance
+// loop and with the gated struct-of-arrays matrix computation, then the
+// timings and the fraction of gated-out pairs are reported. The gate is
+// also verified: a gated-out pair must be beyond the match distance in
+// the exact computation as well.
+
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "modules/perception/common/graph/secure_matrix.h"
+#include "modules/perception/lidar/lib/tracker/multi_lidar_fusion/mlf_track_object_distance.h"
+
+namespace apollo {
+namespace perception {
+namespace lidar {
+namespace {
+
+constexpr float kMaxMatchDistance = 4.0f;
+constexpr float kBoundValue = 100.0f;
+constexpr double kSceneHalfWidth = 80.0;
+constexpr int kShapeFeatureSize = 10;
+
+TrackedObjectPtr CreateObject(std::mt19937* gen, double timestamp,
+                              double x, double y) {
+  std::uniform_real_distribution<double> velocity_dist(-8.0, 8.0);
+  std::uniform_real_distribution<float> feature_dist(0.f, 1.f);
+  TrackedObjectPtr object(new TrackedObject);
+  object->object_ptr.reset(new base::Object);
+  object->object_ptr->latest_tracked_time = timestamp;
+  object->object_ptr->lidar_supplement.cloud_world.resize(
+      50 + (*gen)() % 100);
+  object->anchor_point = Eigen::Vector3d(x, y, 0.5);
+  object->belief_anchor_point = object->anchor_point;
+  object->output_velocity =
+      Eigen::Vector3d(velocity_dist(*gen), velocity_dist(*gen), 0.0);
+  object->direction = Eigen::Vector3d(1.0, 0.0, 0.0);
+  object->output_direction = object->direction;
+  object->size = Eigen::Vector3d(4.0, 2.0, 1.5);
+  object->output_size = object->size;
+  object->barycenter = object->anchor_point;
+  object->is_background = false;
+  object->sensor_info.name = "velodyne64";
+  object->shape_features.resize(kShapeFeatureSize);
+  for (auto& feature : object->shape_features) {
+    feature = feature_dist(*gen);
+  }
+  return object;
+}
+
+int BenchmarkAssociation(size_t num_tracks, size_t num_objects,
+                         size_t repeats) {
+  std::mt19937 gen(2019);
+  std::uniform_real_distribution<double> position_dist(-kSceneHalfWidth,
+                                                       kSceneHalfWidth);
+  std::uniform_real_distribution<double> noise_dist(-0.5, 0.5);
+  const double track_time = 1000.0;
+  const double object_time = 1000.1;
+
+  std::vector<MlfTrackDataPtr> tracks;
+  tracks.reserve(num_tracks);
+  for (size_t i = 0; i < num_tracks; ++i) {
+    MlfTrackDataPtr track(new MlfTrackData);
+    track->track_id_ = static_cast<int>(i);
+    track->age_ = 1;
+    track->latest_visible_time_ = track_time;
+    TrackedObjectPtr object =
+        CreateObject(&gen, track_time, position_dist(gen), position_dist(gen));
+    track->history_objects_.emplace(track_time, object);
+    tracks.push_back(track);
+  }
+
+  std::vector<TrackedObjectPtr> objects;
+  objects.reserve(num_objects);
+  for (size_t j = 0; j < num_objects; ++j) {
+    double x = position_dist(gen);
+    double y = position_dist(gen);
+    if (j < num_tracks) {
+      // most detections continue an existing track
+      const Eigen::Vector3d& anchor =
+          tracks[j]->GetLatestObject().second->anchor_point;
+      x = anchor(0) + noise_dist(gen);
+      y = anchor(1) + noise_dist(gen);
+    }
+    objects.push_back(CreateObject(&gen, object_time, x, y));
+  }
+
+  // empty weight tables, so the default foreground weights are used
+  MlfTrackObjectDistance distance;
+
+  common::SecureMat<float> baseline_mat;
+  common::SecureMat<float> gated_mat;
+  baseline_mat.Reserve(num_tracks, num_objects);
+  gated_mat.Reserve(num_tracks, num_objects);
+  baseline_mat.Resize(num_tracks, num_objects);
+  gated_mat.Resize(num_tracks, num_objects);
+
+  using Clock = std::chrono::steady_clock;
+  auto start = Clock::now();
+  for (size_t r = 0; r < repeats; ++r) {
+    for (size_t i = 0; i < num_tracks; ++i) {
+      for (size_t j = 0; j < num_objects; ++j) {
+        baseline_mat(i, j) = distance.ComputeDistance(objects[j], tracks[i]);
+      }
+    }
+  }
+  auto baseline_elapsed =
+      std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+
+  start = Clock::now();
+  for (size_t r = 0; r < repeats; ++r) {
+    distance.ComputeDistanceMatrix(tracks, objects, kMaxMatchDistance,
+                                   kBoundValue, &gated_mat);
+  }
+  auto gated_elapsed =
+      std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+
+  size_t num_gated = 0;
+  size_t num_mismatch = 0;
+  for (size_t i = 0; i < num_tracks; ++i) {
+    for (size_t j = 0; j < num_objects; ++j) {
+      if (gated_mat(i, j) == baseline_mat(i, j)) {
+        continue;
+      }
+      ++num_gated;
+      // a gated-out pair must be invalid in the exact computation too
+      if (baseline_mat(i, j) < kMaxMatchDistance) {
+        ++num_mismatch;
+      }
+    }
+  }
+
+  std::cout << "tracks: " << num_tracks << " objects: " << num_objects
+            << " repeats: " << repeats << std::endl;
+  std::cout << "per-pair loop: " << baseline_elapsed / repeats
+            << " ms/frame" << std::endl;
+  std::cout << "gated matrix:  " << gated_elapsed / repeats << " ms/frame"
+            << std::endl;
+  std::cout << "gated-out pairs: " << num_gated << " / "
+            << num_tracks * num_objects << std::endl;
+  if (num_mismatch > 0) {
+    std::cout << "ERROR: " << num_mismatch
+              << " gated-out pairs were below the match distance" << std::endl;
+    return -1;
+  }
+  return 0;
+}
+
+}  // namespace
+}  // namespace lidar
+}  // namespace perception
+}  // namespace apollo
+
+int main(int argc, char** argv) {
+  size_t num_tracks = 300;
+  size_t num_objects = 350;
+  size_t repeats = 20;
+  if (argc > 1) {
+    num_tracks = std::stoul(argv[1]);
+  }
+  if (argc > 2) {
+    num_objects = std::stoul(argv[2]);
+  }
+  if (argc > 3) {
+    repeats = std::stoul(argv[3]);
+  }
+  return apollo::perception::lidar::BenchmarkAssociation(num_tracks,
+                                                         num_objects, repeats);
+}
@@ -20,9 +20,11 @@
 #include "modules/planning/common/frame.h"
 
 #include <algorithm>
+#include <future>
 #include <limits>
 
 #include "cyber/common/log.h"
+#include "cyber/task/task.h"
 #include "modules/common/configs/vehicle_config_helper.h"
 #include "modules/common/math/vec2d.h"
 #include "modules/common/time/time.h"
@@ -189,11 +191,30 @@ bool Frame::CreateReferenceLineInfo(
   }
 
   bool has_valid_reference_line = false;
-  for (auto &ref_info : reference_line_info_) {
-    if (!ref_info.Init(obstacles())) {
-      AERROR << "Failed to init reference line";
-    } else {
-      has_valid_reference_line = true;
+  if (FLAGS_enable_parallel_reference_line_init &&
+      reference_line_info_.size() > 1) {
+    // Each reference line info projects the shared obstacle list into its
+    // own frame; the projections are independent, so they run concurrently.
+    std::vector<std::future<bool>> results;
+    for (auto &ref_info : reference_line_info_) {
+      auto *ref_info_ptr = &ref_info;
+      results.push_back(cyber::Async(
+          [this, ref_info_ptr]() { return ref_info_ptr->Init(obstacles()); }));
+    }
+    for (auto &result : results) {
+      if (!result.get()) {
+        AERROR << "Failed to init reference line";
+      } else {
+        has_valid_reference_line = true;
+      }
+    }
+  } else {
+    for (auto &ref_info : reference_line_info_) {
+      if (!ref_info.Init(obstacles())) {
+        AERROR << "Failed to init reference line";
+      } else {
+        has_valid_reference_line = true;
+      }
     }
   }
   return has_valid_reference_line;
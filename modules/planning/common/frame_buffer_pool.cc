@@ -0,0 +1,59 @@
+/******************************************************************************
+ * Copyright 2020 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+/**
+ * @file
+ **/
+
+#include "modules/planning/common/frame_buffer_pool.h"
+
+#include <utility>
+
+namespace apollo {
+namespace planning {
+
+FrameBufferPool::FrameBufferPool() {}
+
+std::vector<common::TrajectoryPoint>
+FrameBufferPool::AcquireTrajectoryBuffer() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (trajectory_buffers_.empty()) {
+    return std::vector<common::TrajectoryPoint>();
+  }
+  std::vector<common::TrajectoryPoint> buffer =
+      std::move(trajectory_buffers_.back());
+  trajectory_buffers_.pop_back();
+  return buffer;
+}
+
+void FrameBufferPool::ReleaseTrajectoryBuffer(
+    std::vector<common::TrajectoryPoint>* const buffer) {
+  if (buffer->capacity() == 0) {
+    return;
+  }
+  // The retired points are kept as-is: overwriting them in the next cycle
+  // reuses their heap storage, which clearing would throw away.
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (trajectory_buffers_.size() < kMaxFreeBuffers) {
+    trajectory_buffers_.emplace_back(std::move(*buffer));
+  } else {
+    buffer->clear();
+    buffer->shrink_to_fit();
+  }
+}
+
+}  // namespace planning
+}  // namespace apollo
@@ -0,0 +1,71 @@
+/******************************************************************************
+ * Copyright 2020 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+/**
+ * @file
+ **/
+
+#pragma once
+
+#include <mutex>
+#include <vector>
+
+#include "cyber/common/macros.h"
+#include "modules/common/proto/pnc_point.pb.h"
+
+namespace apollo {
+namespace planning {
+
+/**
+ * @class FrameBufferPool
+ *
+ * @brief Recycles the large trajectory buffers of the planning loop across
+ * frames. The planning cycle rebuilds its trajectory containers every
+ * iteration; handing retired buffers back to the pool lets the next cycle
+ * refill them in place, reusing both the vector capacity and the heap
+ * storage of the recycled points instead of reallocating at the loop rate.
+ */
+class FrameBufferPool {
+ public:
+  /**
+   * @brief Returns a recycled trajectory buffer if one is available,
+   * otherwise an empty one. The contents of a recycled buffer are stale
+   * points from a previous cycle kept alive so that their heap storage can
+   * be reused; callers must overwrite the buffer (e.g. with assign) before
+   * reading it.
+   */
+  std::vector<common::TrajectoryPoint> AcquireTrajectoryBuffer();
+
+  /**
+   * @brief Hands a retired trajectory buffer back for reuse. At most a
+   * fixed number of buffers are retained; the rest are destroyed.
+   */
+  void ReleaseTrajectoryBuffer(
+      std::vector<common::TrajectoryPoint>* const buffer);
+
+ private:
+  // Upper bound on the retained buffers; anything beyond it is simply
+  // destroyed so the pool cannot grow without bound.
+  static constexpr size_t kMaxFreeBuffers = 8;
+
+  std::mutex mutex_;
+  std::vector<std::vector<common::TrajectoryPoint>> trajectory_buffers_;
+
+  DECLARE_SINGLETON(FrameBufferPool)
+};
+
+}  // namespace planning
+}  // namespace apollo
@@ -0,0 +1,59 @@
+/******************************************************************************
+ * Copyright 2020 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "modules/planning/common/frame_buffer_pool.h"
+
+#include "gtest/gtest.h"
+
+namespace apollo {
+namespace planning {
+
+TEST(FrameBufferPoolTest, RecyclesTrajectoryBuffers) {
+  auto* pool = FrameBufferPool::Instance();
+
+  auto buffer = pool->AcquireTrajectoryBuffer();
+  buffer.resize(100);
+  for (size_t i = 0; i < buffer.size(); ++i) {
+    buffer[i].set_relative_time(static_cast<double>(i));
+  }
+  const auto* storage = buffer.data();
+  pool->ReleaseTrajectoryBuffer(&buffer);
+
+  // The most recently released buffer comes back with its storage intact.
+  auto recycled = pool->AcquireTrajectoryBuffer();
+  EXPECT_EQ(storage, recycled.data());
+  EXPECT_GE(recycled.capacity(), 100U);
+
+  // Overwriting a recycled buffer yields exactly the assigned contents.
+  common::TrajectoryPoint point;
+  point.set_relative_time(-1.0);
+  recycled.assign(3, point);
+  EXPECT_EQ(3U, recycled.size());
+  for (const auto& p : recycled) {
+    EXPECT_DOUBLE_EQ(-1.0, p.relative_time());
+  }
+  pool->ReleaseTrajectoryBuffer(&recycled);
+}
+
+TEST(FrameBufferPoolTest, IgnoresEmptyBuffers) {
+  auto* pool = FrameBufferPool::Instance();
+  std::vector<common::TrajectoryPoint> empty;
+  pool->ReleaseTrajectoryBuffer(&empty);
+  EXPECT_TRUE(empty.empty());
+}
+
+}  // namespace planning
+}  // namespace apollo
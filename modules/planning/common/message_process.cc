@@ -20,7 +20,10 @@
 #include <memory>
 #include <sstream>
 #include <string>
+#include <thread>
 
+#include "cyber/base/bounded_queue.h"
+#include "cyber/base/wait_strategy.h"
 #include "cyber/common/file.h"
 #include "cyber/record/record_reader.h"
 #include "modules/common/adapters/adapter_gflags.h"
@@ -334,8 +337,29 @@ void MessageProcess::ProcessOfflineData(const std::string& record_file) {
     return;
   }
 
+  // A reader thread streams messages ahead through a bounded queue while
+  // this thread decodes and processes them, so record IO overlaps feature
+  // generation. A message with an empty channel name marks end of record.
+  static constexpr uint64_t kReadaheadQueueSize = 256;
+  cyber::base::BoundedQueue<RecordMessage> message_queue;
+  if (!message_queue.Init(kReadaheadQueueSize,
+                          new cyber::base::BlockWaitStrategy())) {
+    AERROR << "Fail to init readahead queue for " << record_file;
+    return;
+  }
+  std::thread read_thread([&reader, &message_queue]() {
+    RecordMessage message;
+    while (reader.ReadMessage(&message)) {
+      if (!message_queue.WaitEnqueue(std::move(message))) {
+        return;
+      }
+    }
+    message_queue.WaitEnqueue(RecordMessage());
+  });
+
   RecordMessage message;
-  while (reader.ReadMessage(&message)) {
+  while (message_queue.WaitDequeue(&message) &&
+         !message.channel_name.empty()) {
     if (message.channel_name ==
         planning_config_.topic_config().chassis_topic()) {
       Chassis chassis;
@@ -380,6 +404,7 @@ void MessageProcess::ProcessOfflineData(const std::string& record_file) {
       }
     }
   }
+  read_thread.join();
 }
 
 bool MessageProcess::GetADCCurrentRoutingIndex(int* road_index,
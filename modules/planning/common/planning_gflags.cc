@@ -152,6 +152,11 @@ DEFINE_double(reference_line_stitch_overlap_distance, 20,
 DEFINE_bool(enable_smooth_reference_line, true,
             "enable smooth the map reference line");
 
+DEFINE_double(spiral_smoother_max_cpu_time_seconds, 0.2,
+              "CPU time budget (seconds) for one online spiral smoothing "
+              "solve; the best iterate found so far is returned when it is "
+              "exceeded.");
+
 DEFINE_bool(prioritize_change_lane, false,
             "change lane strategy has higher priority, always use a valid "
             "change lane path if such path exists");
@@ -320,6 +325,18 @@ DEFINE_bool(use_multi_thread_to_add_obstacles, false,
             "use multiple thread to add obstacles.");
 DEFINE_bool(enable_multi_thread_in_dp_st_graph, false,
             "Enable multiple thread to calculation curve cost in dp_st_graph.");
+DEFINE_bool(enable_multi_thread_in_lattice_evaluation, false,
+            "Enable multiple thread to score candidate trajectory pairs in "
+            "the lattice planner.");
+DEFINE_bool(enable_parallel_hybrid_a, false,
+            "Enable multiple thread to run the collision checks of hybrid a "
+            "star node expansion.");
+DEFINE_bool(enable_parallel_task_execution, false,
+            "Enable running declared-independent planning tasks of one stage "
+            "concurrently.");
+DEFINE_bool(enable_parallel_reference_line_init, false,
+            "Enable initializing the reference line infos of one frame "
+            "concurrently.");
 
 /// Lattice Planner
 DEFINE_double(numerical_epsilon, 1e-6, "Epsilon in lattice planner.");
@@ -411,6 +428,13 @@ DEFINE_double(nudge_buffer, 0.3, "buffer to nudge for lateral optimization");
 DEFINE_double(fallback_total_time, 3.0, "total fallback trajectory time");
 DEFINE_double(fallback_time_unit, 0.1,
               "fallback trajectory unit time in seconds");
+DEFINE_bool(enable_fallback_trajectory_cache, true,
+            "publish a time-shifted copy of the last successful trajectory "
+            "instead of stopping when a planning cycle overruns or fails");
+DEFINE_double(fallback_cache_max_drift, 0.2,
+              "maximum age (seconds) of the cached trajectory, roughly one "
+              "planning cycle beyond the nominal latency, before it is "
+              "considered stale for fallback publishing");
 
 DEFINE_double(speed_bump_speed_limit, 4.4704,
               "the speed limit when passing a speed bump, m/s. The default "
@@ -473,6 +497,10 @@ DEFINE_bool(use_osqp_optimizer_for_reference_line, true,
             "Use OSQP optimizer for reference line optimization.");
 DEFINE_bool(enable_osqp_debug, false,
             "True to turn on OSQP verbose debug output in log.");
+DEFINE_bool(enable_piecewise_jerk_warm_start, false,
+            "True to reuse the OSQP workspace of the piecewise jerk path and "
+            "speed problems between planning cycles, warm-starting from the "
+            "previous solution.");
 
 DEFINE_bool(export_chart, false, "export chart in planning");
 DEFINE_bool(enable_record_debug, true,
@@ -540,6 +568,10 @@ DEFINE_string(planning_data_dir, "/apollo/modules/planning/data/",
 DEFINE_string(planning_offline_bags, "",
               "a list of source files or directories for offline mode. "
               "The items need to be separated by colon ':'. ");
+DEFINE_int32(planning_offline_worker_num, 1,
+             "number of parallel worker processes for offline learning data "
+             "extraction. Records are sharded across workers; each worker "
+             "writes its own <record file>.<n>.bin output files.");
 DEFINE_int32(planning_learning_mode, 0,
              "0: no learning "
              "1: offline learning. read record files and dump learning_data "
@@ -550,6 +582,9 @@ DEFINE_int32(learning_data_obstacle_history_time_sec, 3.0,
              "time sec (second) of history trajectory points for a obstacle");
 DEFINE_int32(learning_data_frame_num_per_file, 100,
              "number of learning_data_frame to write out in one data file.");
+DEFINE_double(learning_model_inference_timeout_ms, 50.0,
+              "Budget in milliseconds for the learning model inference before "
+              "the planning cycle falls back to the rule-based path.");
 DEFINE_string(
     planning_birdview_img_feature_renderer_config_file,
     "/apollo/modules/planning/conf/planning_semantic_map_config.pb.txt",
@@ -64,6 +64,8 @@ DECLARE_double(reference_line_stitch_overlap_distance);
 
 DECLARE_bool(enable_smooth_reference_line);
 
+DECLARE_double(spiral_smoother_max_cpu_time_seconds);
+
 DECLARE_bool(prioritize_change_lane);
 DECLARE_double(change_lane_min_length);
 
@@ -154,6 +156,10 @@ DECLARE_bool(enable_sqp_solver);
 /// thread pool
 DECLARE_bool(use_multi_thread_to_add_obstacles);
 DECLARE_bool(enable_multi_thread_in_dp_st_graph);
+DECLARE_bool(enable_multi_thread_in_lattice_evaluation);
+DECLARE_bool(enable_parallel_hybrid_a);
+DECLARE_bool(enable_parallel_task_execution);
+DECLARE_bool(enable_parallel_reference_line_init);
 
 DECLARE_double(numerical_epsilon);
 DECLARE_double(default_cruise_speed);
@@ -207,6 +213,8 @@ DECLARE_double(nudge_buffer);
 
 DECLARE_double(fallback_total_time);
 DECLARE_double(fallback_time_unit);
+DECLARE_bool(enable_fallback_trajectory_cache);
+DECLARE_double(fallback_cache_max_drift);
 
 DECLARE_double(speed_bump_speed_limit);
 DECLARE_double(default_city_road_speed_limit);
@@ -231,6 +239,7 @@ DECLARE_bool(enable_parallel_trajectory_smoothing);
 
 DECLARE_bool(use_osqp_optimizer_for_reference_line);
 DECLARE_bool(enable_osqp_debug);
+DECLARE_bool(enable_piecewise_jerk_warm_start);
 DECLARE_bool(export_chart);
 DECLARE_bool(enable_record_debug);
 
@@ -272,8 +281,10 @@ DECLARE_bool(use_road_boundary_from_map);
 DECLARE_int32(planning_learning_mode);
 DECLARE_string(planning_data_dir);
 DECLARE_string(planning_offline_bags);
+DECLARE_int32(planning_offline_worker_num);
 DECLARE_int32(learning_data_obstacle_history_time_sec);
 DECLARE_int32(learning_data_frame_num_per_file);
+DECLARE_double(learning_model_inference_timeout_ms);
 DECLARE_string(planning_birdview_img_feature_renderer_config_file);
 DECLARE_int32(min_past_history_points_len);
 
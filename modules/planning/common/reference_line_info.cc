@@ -210,80 +210,61 @@ bool ReferenceLineInfo::GetNeighborLaneInfo(
   return true;
 }
 
-bool ReferenceLineInfo::GetFirstOverlap(
+void ReferenceLineInfo::IndexOverlaps(
     const std::vector<hdmap::PathOverlap>& path_overlaps,
-    hdmap::PathOverlap* path_overlap) {
-  CHECK_NOTNULL(path_overlap);
-  const double start_s = adc_sl_boundary_.end_s();
-  static constexpr double kMaxOverlapRange = 500.0;
-  double overlap_min_s = kMaxOverlapRange;
-
-  auto overlap_min_s_iter = path_overlaps.end();
-  for (auto iter = path_overlaps.begin(); iter != path_overlaps.end(); ++iter) {
-    if (iter->end_s < start_s) {
-      continue;
-    }
-    if (overlap_min_s > iter->start_s) {
-      overlap_min_s_iter = iter;
-      overlap_min_s = iter->start_s;
+    const OverlapType type) {
+  auto& index = overlap_index_[type];
+  for (const auto& path_overlap : path_overlaps) {
+    index[path_overlap.object_id] = &path_overlap;
+    if (path_overlap.end_s >= adc_sl_boundary_.start_s()) {
+      overlap_schedule_.emplace_back(type, path_overlap);
     }
   }
+}
 
-  // Ensure that the path_overlaps is not empty.
-  if (overlap_min_s_iter != path_overlaps.end()) {
-    *path_overlap = *overlap_min_s_iter;
+const hdmap::PathOverlap* ReferenceLineInfo::GetOverlapById(
+    const OverlapType type, const std::string& object_id) const {
+  const auto type_itr = overlap_index_.find(type);
+  if (type_itr == overlap_index_.end()) {
+    return nullptr;
   }
-
-  return overlap_min_s < kMaxOverlapRange;
+  const auto overlap_itr = type_itr->second.find(object_id);
+  return overlap_itr == type_itr->second.end() ? nullptr : overlap_itr->second;
 }
 
 void ReferenceLineInfo::InitFirstOverlaps() {
   const auto& map_path = reference_line_.map_path();
-  // clear_zone
-  hdmap::PathOverlap clear_area_overlap;
-  if (GetFirstOverlap(map_path.clear_area_overlaps(), &clear_area_overlap)) {
-    first_encounter_overlaps_.emplace_back(CLEAR_AREA, clear_area_overlap);
-  }
-
-  // crosswalk
-  hdmap::PathOverlap crosswalk_overlap;
-  if (GetFirstOverlap(map_path.crosswalk_overlaps(), &crosswalk_overlap)) {
-    first_encounter_overlaps_.emplace_back(CROSSWALK, crosswalk_overlap);
-  }
-
-  // pnc_junction
-  hdmap::PathOverlap pnc_junction_overlap;
-  if (GetFirstOverlap(map_path.pnc_junction_overlaps(),
-                      &pnc_junction_overlap)) {
-    first_encounter_overlaps_.emplace_back(PNC_JUNCTION, pnc_junction_overlap);
-  }
-
-  // signal
-  hdmap::PathOverlap signal_overlap;
-  if (GetFirstOverlap(map_path.signal_overlaps(), &signal_overlap)) {
-    first_encounter_overlaps_.emplace_back(SIGNAL, signal_overlap);
-  }
-
-  // stop_sign
-  hdmap::PathOverlap stop_sign_overlap;
-  if (GetFirstOverlap(map_path.stop_sign_overlaps(), &stop_sign_overlap)) {
-    first_encounter_overlaps_.emplace_back(STOP_SIGN, stop_sign_overlap);
-  }
-
-  // yield_sign
-  hdmap::PathOverlap yield_sign_overlap;
-  if (GetFirstOverlap(map_path.yield_sign_overlaps(), &yield_sign_overlap)) {
-    first_encounter_overlaps_.emplace_back(YIELD_SIGN, yield_sign_overlap);
-  }
+  // build the overlap schedule and the by-id index in one pass per type
+  IndexOverlaps(map_path.clear_area_overlaps(), CLEAR_AREA);
+  IndexOverlaps(map_path.crosswalk_overlaps(), CROSSWALK);
+  IndexOverlaps(map_path.pnc_junction_overlaps(), PNC_JUNCTION);
+  IndexOverlaps(map_path.signal_overlaps(), SIGNAL);
+  IndexOverlaps(map_path.stop_sign_overlaps(), STOP_SIGN);
+  IndexOverlaps(map_path.yield_sign_overlaps(), YIELD_SIGN);
 
   // sort by start_s
-  if (!first_encounter_overlaps_.empty()) {
-    std::sort(first_encounter_overlaps_.begin(),
-              first_encounter_overlaps_.end(),
-              [](const std::pair<OverlapType, hdmap::PathOverlap>& a,
-                 const std::pair<OverlapType, hdmap::PathOverlap>& b) {
-                return a.second.start_s < b.second.start_s;
-              });
+  std::sort(overlap_schedule_.begin(), overlap_schedule_.end(),
+            [](const std::pair<OverlapType, hdmap::PathOverlap>& a,
+               const std::pair<OverlapType, hdmap::PathOverlap>& b) {
+              return a.second.start_s < b.second.start_s;
+            });
+
+  // derive the first encountered overlap of each type from the schedule;
+  // the schedule is sorted, so the first qualifying entry per type is the
+  // one with the minimum start_s
+  const double start_s = adc_sl_boundary_.end_s();
+  static constexpr double kMaxOverlapRange = 500.0;
+  std::unordered_map<int, bool> type_encountered;
+  for (const auto& overlap : overlap_schedule_) {
+    if (overlap.second.end_s < start_s ||
+        overlap.second.start_s >= kMaxOverlapRange) {
+      continue;
+    }
+    if (type_encountered[overlap.first]) {
+      continue;
+    }
+    type_encountered[overlap.first] = true;
+    first_encounter_overlaps_.push_back(overlap);
   }
 }
 
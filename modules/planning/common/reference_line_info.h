@@ -234,6 +234,24 @@ class ReferenceLineInfo {
     return first_encounter_overlaps_;
   }
 
+  /**
+   * @brief Ordered timeline of the overlaps not yet passed by the vehicle,
+   * sorted by start_s. Built once per reference line so that scenario and
+   * traffic-rule code can consume it without rescanning the map-path
+   * overlap vectors in every cycle.
+   */
+  const std::vector<std::pair<OverlapType, hdmap::PathOverlap>>&
+  OverlapSchedule() const {
+    return overlap_schedule_;
+  }
+
+  /**
+   * @brief look up an overlap on this reference line by type and object id.
+   * @return the overlap, or nullptr if no such overlap exists.
+   */
+  const hdmap::PathOverlap* GetOverlapById(const OverlapType type,
+                                           const std::string& object_id) const;
+
   int GetPnCJunction(const double s,
                      hdmap::PathOverlap* pnc_junction_overlap) const;
 
@@ -251,6 +269,9 @@ class ReferenceLineInfo {
  private:
   void InitFirstOverlaps();
 
+  void IndexOverlaps(const std::vector<hdmap::PathOverlap>& path_overlaps,
+                     const OverlapType type);
+
   bool CheckChangeLane() const;
 
   void SetTurnSignalBasedOnLaneTurnType(
@@ -274,9 +295,6 @@ class ReferenceLineInfo {
 
   bool AddObstacleHelper(const std::shared_ptr<Obstacle>& obstacle);
 
-  bool GetFirstOverlap(const std::vector<hdmap::PathOverlap>& path_overlaps,
-                       hdmap::PathOverlap* path_overlap);
-
  private:
   static std::unordered_map<std::string, bool> junction_right_of_way_map_;
   const common::VehicleState vehicle_state_;
@@ -338,6 +356,17 @@ class ReferenceLineInfo {
   std::vector<std::pair<OverlapType, hdmap::PathOverlap>>
       first_encounter_overlaps_;
 
+  /**
+   * Ordered timeline of overlaps not yet passed by the vehicle, and an index
+   * of all overlaps on this reference line by type and object id. The index
+   * points into the map-path overlap vectors, which stay alive as long as
+   * this reference line info.
+   */
+  std::vector<std::pair<OverlapType, hdmap::PathOverlap>> overlap_schedule_;
+  std::unordered_map<
+      int, std::unordered_map<std::string, const hdmap::PathOverlap*>>
+      overlap_index_;
+
   /**
    * @brief Data generated by speed_bounds_decider for constructing st_graph for
    * different st optimizer
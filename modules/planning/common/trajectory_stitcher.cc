@@ -28,6 +28,7 @@
 #include "modules/common/math/quaternion.h"
 #include "modules/common/util/util.h"
 #include "modules/common/vehicle_model/vehicle_model.h"
+#include "modules/planning/common/frame_buffer_pool.h"
 #include "modules/planning/common/planning_gflags.h"
 
 namespace apollo {
@@ -72,7 +73,10 @@ TrajectoryStitcher::ComputeReinitStitchingTrajectory(
         planning_cycle_time, predicted_vehicle_state);
   }
 
-  return std::vector<TrajectoryPoint>(1, reinit_point);
+  auto reinit_trajectory =
+      FrameBufferPool::Instance()->AcquireTrajectoryBuffer();
+  reinit_trajectory.assign(1, reinit_point);
+  return reinit_trajectory;
 }
 
 // only used in navigation mode
@@ -223,7 +227,9 @@ std::vector<TrajectoryPoint> TrajectoryStitcher::ComputeStitchingTrajectory(
 
   auto matched_index = std::min(time_matched_index, position_matched_index);
 
-  std::vector<TrajectoryPoint> stitching_trajectory(
+  auto stitching_trajectory =
+      FrameBufferPool::Instance()->AcquireTrajectoryBuffer();
+  stitching_trajectory.assign(
       prev_trajectory->begin() +
           std::max(0, static_cast<int>(matched_index - preserved_points_num)),
       prev_trajectory->begin() + forward_time_index + 1);
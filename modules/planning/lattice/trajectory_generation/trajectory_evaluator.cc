@@ -21,9 +21,11 @@
 #include "modules/planning/lattice/trajectory_generation/trajectory_evaluator.h"
 
 #include <algorithm>
+#include <future>
 #include <limits>
 
 #include "cyber/common/log.h"
+#include "cyber/task/task.h"
 #include "modules/common/math/path_matcher.h"
 #include "modules/planning/common/planning_gflags.h"
 #include "modules/planning/common/trajectory1d/piecewise_acceleration_trajectory1d.h"
@@ -64,6 +66,8 @@ TrajectoryEvaluator::TrajectoryEvaluator(
   if (planning_target.has_stop_point()) {
     stop_point = planning_target.stop_point().s();
   }
+  std::vector<LonEvaluation> lon_evaluations;
+  lon_evaluations.reserve(lon_trajectories.size());
   for (const auto& lon_trajectory : lon_trajectories) {
     double lon_end_s = lon_trajectory->Evaluate(0, end_time);
     if (init_s[0] < stop_point &&
@@ -74,17 +78,66 @@ TrajectoryEvaluator::TrajectoryEvaluator(
     if (!ConstraintChecker1d::IsValidLongitudinalTrajectory(*lon_trajectory)) {
       continue;
     }
-    for (const auto& lat_trajectory : lat_trajectories) {
-      /**
-       * The validity of the code needs to be verified.
-      if (!ConstraintChecker1d::IsValidLateralTrajectory(*lat_trajectory,
-                                                         *lon_trajectory)) {
-        continue;
-      }
-      */
-      double cost = Evaluate(planning_target, lon_trajectory, lat_trajectory);
-      cost_queue_.emplace(Trajectory1dPair(lon_trajectory, lat_trajectory),
-                          cost);
+    /**
+     * The validity of the code needs to be verified.
+    if (!ConstraintChecker1d::IsValidLateralTrajectory(*lat_trajectory,
+                                                       *lon_trajectory)) {
+      continue;
+    }
+    */
+    lon_evaluations.emplace_back();
+    lon_evaluations.back().trajectory = lon_trajectory;
+  }
+
+  // Stage 1: per-candidate costs and samples; every term here depends
+  // on one trajectory only, so it is computed once instead of once per
+  // pair, and candidates are independent tasks.
+  if (FLAGS_enable_multi_thread_in_lattice_evaluation) {
+    std::vector<std::future<void>> results;
+    for (auto& lon_evaluation : lon_evaluations) {
+      results.emplace_back(
+          cyber::Async(&TrajectoryEvaluator::EvaluateLonTrajectory, this,
+                       planning_target, &lon_evaluation));
+    }
+    for (auto& result : results) {
+      result.get();
+    }
+  } else {
+    for (auto& lon_evaluation : lon_evaluations) {
+      EvaluateLonTrajectory(planning_target, &lon_evaluation);
+    }
+  }
+
+  size_t max_s_samples = 0;
+  for (const auto& lon_evaluation : lon_evaluations) {
+    max_s_samples = std::max(max_s_samples, lon_evaluation.num_s_samples);
+  }
+  std::vector<LatEvaluation> lat_evaluations(lat_trajectories.size());
+  for (size_t i = 0; i < lat_trajectories.size(); ++i) {
+    lat_evaluations[i].trajectory = lat_trajectories[i];
+    EvaluateLatTrajectory(max_s_samples, &lat_evaluations[i]);
+  }
+
+  // Stage 2: pair scoring over the materialized arrays.
+  std::vector<std::vector<PairCost>> pair_costs(lon_evaluations.size());
+  if (FLAGS_enable_multi_thread_in_lattice_evaluation) {
+    std::vector<std::future<void>> results;
+    for (size_t i = 0; i < lon_evaluations.size(); ++i) {
+      results.emplace_back(cyber::Async(&TrajectoryEvaluator::ScorePairs, this,
+                                        &lon_evaluations[i], &lat_evaluations,
+                                        &pair_costs[i]));
+    }
+    for (auto& result : results) {
+      result.get();
+    }
+  } else {
+    for (size_t i = 0; i < lon_evaluations.size(); ++i) {
+      ScorePairs(&lon_evaluations[i], &lat_evaluations, &pair_costs[i]);
+    }
+  }
+  for (auto& costs : pair_costs) {
+    for (auto& pair_cost : costs) {
+      cost_queue_.emplace(std::move(pair_cost));
     }
   }
   ADEBUG << "Number of valid 1d trajectory pairs: " << cost_queue_.size();
@@ -162,6 +215,109 @@ double TrajectoryEvaluator::Evaluate(
          lat_comfort_cost * FLAGS_weight_lat_comfort;
 }
 
+void TrajectoryEvaluator::EvaluateLonTrajectory(
+    const PlanningTarget& planning_target,
+    LonEvaluation* const lon_evaluation) const {
+  const auto& lon_trajectory = lon_evaluation->trajectory;
+
+  double lon_objective_cost =
+      LonObjectiveCost(lon_trajectory, planning_target, reference_s_dot_);
+  double lon_jerk_cost = LonComfortCost(lon_trajectory);
+  double lon_collision_cost = LonCollisionCost(lon_trajectory);
+  double centripetal_acc_cost = CentripetalAccelerationCost(lon_trajectory);
+  lon_evaluation->lon_cost =
+      lon_objective_cost * FLAGS_weight_lon_objective +
+      lon_jerk_cost * FLAGS_weight_lon_jerk +
+      lon_collision_cost * FLAGS_weight_lon_collision +
+      centripetal_acc_cost * FLAGS_weight_centripetal_acceleration;
+
+  // materialize the time grid samples reused by every lateral pairing
+  for (double t = 0.0; t < FLAGS_trajectory_time_length;
+       t += FLAGS_trajectory_time_resolution) {
+    lon_evaluation->s.emplace_back(lon_trajectory->Evaluate(0, t));
+    lon_evaluation->s_dot.emplace_back(lon_trajectory->Evaluate(1, t));
+    lon_evaluation->s_ddot.emplace_back(lon_trajectory->Evaluate(2, t));
+  }
+
+  // decides the longitudinal evaluation horizon for lateral trajectories.
+  double evaluation_horizon =
+      std::min(FLAGS_speed_lon_decision_horizon,
+               lon_trajectory->Evaluate(0, lon_trajectory->ParamLength()));
+  size_t num_s_samples = 0;
+  for (double s = 0.0; s < evaluation_horizon;
+       s += FLAGS_trajectory_space_resolution) {
+    ++num_s_samples;
+  }
+  lon_evaluation->num_s_samples = num_s_samples;
+}
+
+void TrajectoryEvaluator::EvaluateLatTrajectory(
+    size_t num_s_samples, LatEvaluation* const lat_evaluation) const {
+  const auto& lat_trajectory = lat_evaluation->trajectory;
+  double lat_offset_start = lat_trajectory->Evaluate(0, 0.0);
+  lat_evaluation->cost_sqr_prefix.reserve(num_s_samples + 1);
+  lat_evaluation->cost_abs_prefix.reserve(num_s_samples + 1);
+  lat_evaluation->cost_sqr_prefix.emplace_back(0.0);
+  lat_evaluation->cost_abs_prefix.emplace_back(0.0);
+  double s = 0.0;
+  for (size_t i = 0; i < num_s_samples; ++i) {
+    double lat_offset = lat_trajectory->Evaluate(0, s);
+    double cost = lat_offset / FLAGS_lat_offset_bound;
+    double weight = lat_offset * lat_offset_start < 0.0
+                        ? FLAGS_weight_opposite_side_offset
+                        : FLAGS_weight_same_side_offset;
+    lat_evaluation->cost_sqr_prefix.emplace_back(
+        lat_evaluation->cost_sqr_prefix.back() + cost * cost * weight);
+    lat_evaluation->cost_abs_prefix.emplace_back(
+        lat_evaluation->cost_abs_prefix.back() + std::fabs(cost) * weight);
+    s += FLAGS_trajectory_space_resolution;
+  }
+}
+
+double TrajectoryEvaluator::LatOffsetCostFromPrefix(
+    const LatEvaluation& lat_evaluation, size_t num_s_samples) const {
+  size_t n =
+      std::min(num_s_samples, lat_evaluation.cost_sqr_prefix.size() - 1);
+  return lat_evaluation.cost_sqr_prefix[n] /
+         (lat_evaluation.cost_abs_prefix[n] + FLAGS_numerical_epsilon);
+}
+
+double TrajectoryEvaluator::LatComfortCost(
+    const LonEvaluation& lon_evaluation,
+    const PtrTrajectory1d& lat_trajectory) const {
+  double max_cost = 0.0;
+  const size_t num_t_samples = lon_evaluation.s.size();
+  for (size_t i = 0; i < num_t_samples; ++i) {
+    double relative_s = lon_evaluation.s[i] - init_s_[0];
+    double l_prime = lat_trajectory->Evaluate(1, relative_s);
+    double l_primeprime = lat_trajectory->Evaluate(2, relative_s);
+    double cost = l_primeprime * lon_evaluation.s_dot[i] *
+                      lon_evaluation.s_dot[i] +
+                  l_prime * lon_evaluation.s_ddot[i];
+    max_cost = std::max(max_cost, std::fabs(cost));
+  }
+  return max_cost;
+}
+
+void TrajectoryEvaluator::ScorePairs(
+    const LonEvaluation* lon_evaluation,
+    const std::vector<LatEvaluation>* lat_evaluations,
+    std::vector<PairCost>* results) const {
+  results->reserve(lat_evaluations->size());
+  for (const auto& lat_evaluation : *lat_evaluations) {
+    double lat_offset_cost =
+        LatOffsetCostFromPrefix(lat_evaluation, lon_evaluation->num_s_samples);
+    double lat_comfort_cost =
+        LatComfortCost(*lon_evaluation, lat_evaluation.trajectory);
+    double cost = lon_evaluation->lon_cost +
+                  lat_offset_cost * FLAGS_weight_lat_offset +
+                  lat_comfort_cost * FLAGS_weight_lat_comfort;
+    results->emplace_back(
+        Trajectory1dPair(lon_evaluation->trajectory, lat_evaluation.trajectory),
+        cost);
+  }
+}
+
 double TrajectoryEvaluator::LatOffsetCost(
     const PtrTrajectory1d& lat_trajectory,
     const std::vector<double>& s_values) const {
@@ -74,6 +74,49 @@ class TrajectoryEvaluator {
                   const std::shared_ptr<Curve1d>& lat_trajectory,
                   std::vector<double>* cost_components = nullptr) const;
 
+  // Per-candidate data materialized once so pair scoring touches only
+  // contiguous arrays instead of re-evaluating the polynomials.
+  struct LonEvaluation {
+    std::shared_ptr<Curve1d> trajectory;
+    // weighted sum of all cost terms that depend on the longitudinal
+    // trajectory alone
+    double lon_cost = 0.0;
+    // samples on the trajectory time grid
+    std::vector<double> s;
+    std::vector<double> s_dot;
+    std::vector<double> s_ddot;
+    // number of space grid points within this trajectory's evaluation
+    // horizon, used to cut the lateral prefix sums
+    size_t num_s_samples = 0;
+  };
+
+  struct LatEvaluation {
+    std::shared_ptr<Curve1d> trajectory;
+    // prefix sums of the offset cost terms over the space grid;
+    // element k covers the first k grid points
+    std::vector<double> cost_sqr_prefix;
+    std::vector<double> cost_abs_prefix;
+  };
+
+  void EvaluateLonTrajectory(const PlanningTarget& planning_target,
+                             LonEvaluation* const lon_evaluation) const;
+
+  void EvaluateLatTrajectory(size_t num_s_samples,
+                             LatEvaluation* const lat_evaluation) const;
+
+  double LatOffsetCostFromPrefix(const LatEvaluation& lat_evaluation,
+                                 size_t num_s_samples) const;
+
+  double LatComfortCost(const LonEvaluation& lon_evaluation,
+                        const std::shared_ptr<Curve1d>& lat_trajectory) const;
+
+  // Scores one longitudinal candidate against every lateral candidate
+  // using the materialized evaluations; one task per longitudinal
+  // trajectory when multi-threaded scoring is enabled.
+  void ScorePairs(const LonEvaluation* lon_evaluation,
+                  const std::vector<LatEvaluation>* lat_evaluations,
+                  std::vector<PairCost>* results) const;
+
   double LatOffsetCost(const std::shared_ptr<Curve1d>& lat_trajectory,
                        const std::vector<double>& s_values) const;
 
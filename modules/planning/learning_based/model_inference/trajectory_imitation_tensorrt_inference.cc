@@ -16,6 +16,7 @@
 
 #include "modules/planning/learning_based/model_inference/trajectory_imitation_tensorrt_inference.h"
 
+#include <cstring>
 #include <iostream>
 #include <string>
 #include <utility>
@@ -62,31 +63,20 @@ TrajectoryImitationTensorRTInference::TrajectoryImitationTensorRTInference(
     : ModelInference(config) {}
 
 TrajectoryImitationTensorRTInference::~TrajectoryImitationTensorRTInference() {
-  switch (config_.model_type()) {
-    case LearningModelInferenceTaskConfig::CONV_RNN: {
-      GPU_CHECK(cudaFree(trt_buffers_[0]));
-      GPU_CHECK(cudaFree(trt_buffers_[1]));
-      GPU_CHECK(cudaFree(trt_buffers_[2]));
-      GPU_CHECK(cudaFree(trt_buffers_[3]));
-      break;
-    }
-    case LearningModelInferenceTaskConfig::CNN: {
-      GPU_CHECK(cudaFree(trt_buffers_[0]));
-      GPU_CHECK(cudaFree(trt_buffers_[1]));
-      break;
+  for (int i = 0; i < kMaxBindingsNum; ++i) {
+    if (trt_buffers_[i] != nullptr) {
+      GPU_CHECK(cudaFree(trt_buffers_[i]));
     }
-    case LearningModelInferenceTaskConfig::CNN_LSTM: {
-      GPU_CHECK(cudaFree(trt_buffers_[0]));
-      GPU_CHECK(cudaFree(trt_buffers_[1]));
-      GPU_CHECK(cudaFree(trt_buffers_[2]));
-      GPU_CHECK(cudaFree(trt_buffers_[3]));
-      break;
-    }
-    default: {
-      AERROR << "Configured model type not defined and implemented";
-      break;
+    if (pinned_buffers_[i] != nullptr) {
+      GPU_CHECK(cudaFreeHost(pinned_buffers_[i]));
     }
   }
+  if (trt_graph_exec_ != nullptr) {
+    GPU_CHECK(cudaGraphExecDestroy(trt_graph_exec_));
+  }
+  if (trt_stream_ != nullptr) {
+    GPU_CHECK(cudaStreamDestroy(trt_stream_));
+  }
 
   trt_context_->destroy();
   trt_engine_->destroy();
@@ -95,42 +85,32 @@ TrajectoryImitationTensorRTInference::~TrajectoryImitationTensorRTInference() {
 void TrajectoryImitationTensorRTInference::DeviceMemoryMalloc() {
   switch (config_.model_type()) {
     case LearningModelInferenceTaskConfig::CONV_RNN: {
-      GPU_CHECK(cudaMalloc(&trt_buffers_[0], BATCH_SIZE * FEATURE_CHANNELS_NUM *
-                                                 IMG_SIZE * IMG_SIZE *
-                                                 sizeof(float)));
-      GPU_CHECK(cudaMalloc(&trt_buffers_[1],
-                           BATCH_SIZE * INITIAL_STATES_CHANNELS_NUM * IMG_SIZE *
-                               IMG_SIZE * sizeof(float)));
-      GPU_CHECK(cudaMalloc(&trt_buffers_[2],
-                           BATCH_SIZE * INITIAL_STATES_CHANNELS_NUM * IMG_SIZE *
-                               IMG_SIZE * sizeof(float)));
-      GPU_CHECK(cudaMalloc(&trt_buffers_[3], BATCH_SIZE * PREDICTION_HORIZON *
-                                                 PREDICTION_STATES_NUM *
-                                                 sizeof(float)));
+      trt_buffer_sizes_[0] = BATCH_SIZE * FEATURE_CHANNELS_NUM * IMG_SIZE *
+                             IMG_SIZE * sizeof(float);
+      trt_buffer_sizes_[1] = BATCH_SIZE * INITIAL_STATES_CHANNELS_NUM *
+                             IMG_SIZE * IMG_SIZE * sizeof(float);
+      trt_buffer_sizes_[2] = BATCH_SIZE * INITIAL_STATES_CHANNELS_NUM *
+                             IMG_SIZE * IMG_SIZE * sizeof(float);
+      trt_buffer_sizes_[3] = BATCH_SIZE * PREDICTION_HORIZON *
+                             PREDICTION_STATES_NUM * sizeof(float);
       break;
     }
     case LearningModelInferenceTaskConfig::CNN: {
-      GPU_CHECK(cudaMalloc(&trt_buffers_[0], BATCH_SIZE * FEATURE_CHANNELS_NUM *
-                                                 IMG_SIZE * IMG_SIZE *
-                                                 sizeof(float)));
-      GPU_CHECK(cudaMalloc(&trt_buffers_[1], BATCH_SIZE * PREDICTION_HORIZON *
-                                                 PREDICTION_STATES_NUM *
-                                                 sizeof(float)));
+      trt_buffer_sizes_[0] = BATCH_SIZE * FEATURE_CHANNELS_NUM * IMG_SIZE *
+                             IMG_SIZE * sizeof(float);
+      trt_buffer_sizes_[1] = BATCH_SIZE * PREDICTION_HORIZON *
+                             PREDICTION_STATES_NUM * sizeof(float);
       break;
     }
     case LearningModelInferenceTaskConfig::CNN_LSTM: {
-      GPU_CHECK(cudaMalloc(&trt_buffers_[0], BATCH_SIZE * FEATURE_CHANNELS_NUM *
-                                                 IMG_SIZE * IMG_SIZE *
-                                                 sizeof(float)));
-      GPU_CHECK(cudaMalloc(
-          &trt_buffers_[1],
-          BATCH_SIZE * PAST_HISTORY_SIZE * PAST_STATES_NUM * sizeof(float)));
-      GPU_CHECK(cudaMalloc(
-          &trt_buffers_[2],
-          BATCH_SIZE * PAST_HISTORY_SIZE * PAST_STATES_NUM * sizeof(float)));
-      GPU_CHECK(cudaMalloc(&trt_buffers_[3], BATCH_SIZE * PREDICTION_HORIZON *
-                                                 PREDICTION_STATES_NUM *
-                                                 sizeof(float)));
+      trt_buffer_sizes_[0] = BATCH_SIZE * FEATURE_CHANNELS_NUM * IMG_SIZE *
+                             IMG_SIZE * sizeof(float);
+      trt_buffer_sizes_[1] =
+          BATCH_SIZE * PAST_HISTORY_SIZE * PAST_STATES_NUM * sizeof(float);
+      trt_buffer_sizes_[2] =
+          BATCH_SIZE * PAST_HISTORY_SIZE * PAST_STATES_NUM * sizeof(float);
+      trt_buffer_sizes_[3] = BATCH_SIZE * PREDICTION_HORIZON *
+                             PREDICTION_STATES_NUM * sizeof(float);
       break;
     }
     default: {
@@ -138,6 +118,51 @@ void TrajectoryImitationTensorRTInference::DeviceMemoryMalloc() {
       break;
     }
   }
+
+  // allocate the device bindings and pinned host staging buffers once; the
+  // model shapes are fixed so per-cycle inference reuses them
+  for (int i = 0; i < kMaxBindingsNum; ++i) {
+    if (trt_buffer_sizes_[i] == 0) {
+      continue;
+    }
+    GPU_CHECK(cudaMalloc(&trt_buffers_[i], trt_buffer_sizes_[i]));
+    GPU_CHECK(cudaHostAlloc(&pinned_buffers_[i], trt_buffer_sizes_[i],
+                            cudaHostAllocDefault));
+  }
+}
+
+void TrajectoryImitationTensorRTInference::CaptureCudaGraph() {
+  // warm-up run so lazy initialization inside the engine does not end up in
+  // the captured graph; the buffer contents are irrelevant here
+  if (!trt_context_->enqueueV2(trt_buffers_, trt_stream_, nullptr)) {
+    AWARN << "TensorRT warm-up enqueue failed, skipping CUDA graph capture";
+    return;
+  }
+  GPU_CHECK(cudaStreamSynchronize(trt_stream_));
+
+  cudaGraph_t graph = nullptr;
+  if (cudaStreamBeginCapture(trt_stream_, cudaStreamCaptureModeThreadLocal) !=
+      cudaSuccess) {
+    AWARN << "Failed to begin CUDA graph capture, falling back to per-cycle "
+             "enqueue";
+    return;
+  }
+  const bool enqueued = trt_context_->enqueueV2(trt_buffers_, trt_stream_,
+                                                nullptr);
+  if (cudaStreamEndCapture(trt_stream_, &graph) != cudaSuccess || !enqueued ||
+      graph == nullptr) {
+    AWARN << "Failed to capture CUDA graph, falling back to per-cycle enqueue";
+    return;
+  }
+  if (cudaGraphInstantiate(&trt_graph_exec_, graph, nullptr, nullptr, 0) !=
+      cudaSuccess) {
+    AWARN << "Failed to instantiate CUDA graph, falling back to per-cycle "
+             "enqueue";
+    trt_graph_exec_ = nullptr;
+  }
+  GPU_CHECK(cudaGraphDestroy(graph));
+  use_cuda_graph_ = (trt_graph_exec_ != nullptr);
+  ADEBUG << "CUDA graph capture " << (use_cuda_graph_ ? "done" : "skipped");
 }
 
 bool TrajectoryImitationTensorRTInference::LoadModel() {
@@ -188,6 +213,11 @@ bool TrajectoryImitationTensorRTInference::LoadModel() {
 
   DeviceMemoryMalloc();
 
+  // a single persistent stream serves every inference cycle instead of
+  // creating and destroying one per call
+  GPU_CHECK(cudaStreamCreate(&trt_stream_));
+  CaptureCudaGraph();
+
   return true;
 }
 
@@ -258,28 +288,29 @@ bool TrajectoryImitationTensorRTInference::DoCONVRNNMODELInference(
          << preprocessing_diff.count() * 1000 << " ms.";
 
   auto inference_start_time = std::chrono::system_clock::now();
-  cudaStream_t stream;
-  GPU_CHECK(cudaStreamCreate(&stream));
-  GPU_CHECK(cudaMemcpyAsync(
-      trt_buffers_[0], input_feature_tensor.data_ptr(),
-      BATCH_SIZE * FEATURE_CHANNELS_NUM * IMG_SIZE * IMG_SIZE * sizeof(float),
-      cudaMemcpyHostToDevice, stream));
-  GPU_CHECK(cudaMemcpyAsync(trt_buffers_[1], initial_point_tensor.data_ptr(),
-                            BATCH_SIZE * INITIAL_STATES_CHANNELS_NUM *
-                                IMG_SIZE * IMG_SIZE * sizeof(float),
-                            cudaMemcpyHostToDevice, stream));
-  GPU_CHECK(cudaMemcpyAsync(trt_buffers_[2], initial_box_tensor.data_ptr(),
-                            BATCH_SIZE * INITIAL_STATES_CHANNELS_NUM *
-                                IMG_SIZE * IMG_SIZE * sizeof(float),
-                            cudaMemcpyHostToDevice, stream));
-  trt_context_->enqueueV2(trt_buffers_, stream, nullptr);
-  float pred_point[BATCH_SIZE * PREDICTION_HORIZON * PREDICTION_STATES_NUM] = {
-      0};
-  GPU_CHECK(cudaMemcpyAsync(
-      pred_point, trt_buffers_[3],
-      BATCH_SIZE * PREDICTION_HORIZON * PREDICTION_STATES_NUM * sizeof(float),
-      cudaMemcpyDeviceToHost, stream));
-  cudaStreamSynchronize(stream);
+  // stage the inputs through pinned host memory so the H2D copies are truly
+  // asynchronous on the persistent stream
+  std::memcpy(pinned_buffers_[0], input_feature_tensor.data_ptr(),
+              trt_buffer_sizes_[0]);
+  std::memcpy(pinned_buffers_[1], initial_point_tensor.data_ptr(),
+              trt_buffer_sizes_[1]);
+  std::memcpy(pinned_buffers_[2], initial_box_tensor.data_ptr(),
+              trt_buffer_sizes_[2]);
+  for (int i = 0; i < 3; ++i) {
+    GPU_CHECK(cudaMemcpyAsync(trt_buffers_[i], pinned_buffers_[i],
+                              trt_buffer_sizes_[i], cudaMemcpyHostToDevice,
+                              trt_stream_));
+  }
+  if (use_cuda_graph_) {
+    GPU_CHECK(cudaGraphLaunch(trt_graph_exec_, trt_stream_));
+  } else {
+    trt_context_->enqueueV2(trt_buffers_, trt_stream_, nullptr);
+  }
+  GPU_CHECK(cudaMemcpyAsync(pinned_buffers_[3], trt_buffers_[3],
+                            trt_buffer_sizes_[3], cudaMemcpyDeviceToHost,
+                            trt_stream_));
+  GPU_CHECK(cudaStreamSynchronize(trt_stream_));
+  const float* pred_point = static_cast<const float*>(pinned_buffers_[3]);
   auto inference_end_time = std::chrono::system_clock::now();
   std::chrono::duration<double> inference_diff =
       inference_end_time - inference_start_time;
@@ -330,8 +361,6 @@ bool TrajectoryImitationTensorRTInference::DoCONVRNNMODELInference(
                                                               (i + 1));
   }
 
-  // release the stream and the buffers
-  cudaStreamDestroy(stream);
   return true;
 }
 
@@ -377,20 +406,21 @@ bool TrajectoryImitationTensorRTInference::DoCNNMODELInference(
          << preprocessing_diff.count() * 1000 << " ms.";
 
   auto inference_start_time = std::chrono::system_clock::now();
-  cudaStream_t stream;
-  GPU_CHECK(cudaStreamCreate(&stream));
-  GPU_CHECK(cudaMemcpyAsync(
-      trt_buffers_[0], input_feature_tensor.data_ptr(),
-      BATCH_SIZE * FEATURE_CHANNELS_NUM * IMG_SIZE * IMG_SIZE * sizeof(float),
-      cudaMemcpyHostToDevice, stream));
-  trt_context_->enqueueV2(trt_buffers_, stream, nullptr);
-  float pred_point[BATCH_SIZE * PREDICTION_HORIZON * PREDICTION_STATES_NUM] = {
-      0};
-  GPU_CHECK(cudaMemcpyAsync(
-      pred_point, trt_buffers_[1],
-      BATCH_SIZE * PREDICTION_HORIZON * PREDICTION_STATES_NUM * sizeof(float),
-      cudaMemcpyDeviceToHost, stream));
-  cudaStreamSynchronize(stream);
+  std::memcpy(pinned_buffers_[0], input_feature_tensor.data_ptr(),
+              trt_buffer_sizes_[0]);
+  GPU_CHECK(cudaMemcpyAsync(trt_buffers_[0], pinned_buffers_[0],
+                            trt_buffer_sizes_[0], cudaMemcpyHostToDevice,
+                            trt_stream_));
+  if (use_cuda_graph_) {
+    GPU_CHECK(cudaGraphLaunch(trt_graph_exec_, trt_stream_));
+  } else {
+    trt_context_->enqueueV2(trt_buffers_, trt_stream_, nullptr);
+  }
+  GPU_CHECK(cudaMemcpyAsync(pinned_buffers_[1], trt_buffers_[1],
+                            trt_buffer_sizes_[1], cudaMemcpyDeviceToHost,
+                            trt_stream_));
+  GPU_CHECK(cudaStreamSynchronize(trt_stream_));
+  const float* pred_point = static_cast<const float*>(pinned_buffers_[1]);
   auto inference_end_time = std::chrono::system_clock::now();
   std::chrono::duration<double> inference_diff =
       inference_end_time - inference_start_time;
@@ -441,8 +471,6 @@ bool TrajectoryImitationTensorRTInference::DoCNNMODELInference(
                                                               (i + 1));
   }
 
-  // release the stream and the buffers
-  cudaStreamDestroy(stream);
   return true;
 }
 
@@ -541,28 +569,27 @@ bool TrajectoryImitationTensorRTInference::DoCNNLSTMMODELInference(
          << preprocessing_diff.count() * 1000 << " ms.";
 
   auto inference_start_time = std::chrono::system_clock::now();
-  cudaStream_t stream;
-  GPU_CHECK(cudaStreamCreate(&stream));
-  GPU_CHECK(cudaMemcpyAsync(
-      trt_buffers_[0], input_feature_tensor.data_ptr(),
-      BATCH_SIZE * FEATURE_CHANNELS_NUM * IMG_SIZE * IMG_SIZE * sizeof(float),
-      cudaMemcpyHostToDevice, stream));
-  GPU_CHECK(cudaMemcpyAsync(
-      trt_buffers_[1], past_points_tensor.data_ptr(),
-      BATCH_SIZE * PAST_HISTORY_SIZE * PAST_STATES_NUM * sizeof(float),
-      cudaMemcpyHostToDevice, stream));
-  GPU_CHECK(cudaMemcpyAsync(
-      trt_buffers_[2], past_points_step_tensor.data_ptr(),
-      BATCH_SIZE * PAST_HISTORY_SIZE * PAST_STATES_NUM * sizeof(float),
-      cudaMemcpyHostToDevice, stream));
-  trt_context_->enqueueV2(trt_buffers_, stream, nullptr);
-  float pred_point[BATCH_SIZE * PREDICTION_HORIZON * PREDICTION_STATES_NUM] = {
-      0};
-  GPU_CHECK(cudaMemcpyAsync(
-      pred_point, trt_buffers_[3],
-      BATCH_SIZE * PREDICTION_HORIZON * PREDICTION_STATES_NUM * sizeof(float),
-      cudaMemcpyDeviceToHost, stream));
-  cudaStreamSynchronize(stream);
+  std::memcpy(pinned_buffers_[0], input_feature_tensor.data_ptr(),
+              trt_buffer_sizes_[0]);
+  std::memcpy(pinned_buffers_[1], past_points_tensor.data_ptr(),
+              trt_buffer_sizes_[1]);
+  std::memcpy(pinned_buffers_[2], past_points_step_tensor.data_ptr(),
+              trt_buffer_sizes_[2]);
+  for (int i = 0; i < 3; ++i) {
+    GPU_CHECK(cudaMemcpyAsync(trt_buffers_[i], pinned_buffers_[i],
+                              trt_buffer_sizes_[i], cudaMemcpyHostToDevice,
+                              trt_stream_));
+  }
+  if (use_cuda_graph_) {
+    GPU_CHECK(cudaGraphLaunch(trt_graph_exec_, trt_stream_));
+  } else {
+    trt_context_->enqueueV2(trt_buffers_, trt_stream_, nullptr);
+  }
+  GPU_CHECK(cudaMemcpyAsync(pinned_buffers_[3], trt_buffers_[3],
+                            trt_buffer_sizes_[3], cudaMemcpyDeviceToHost,
+                            trt_stream_));
+  GPU_CHECK(cudaStreamSynchronize(trt_stream_));
+  const float* pred_point = static_cast<const float*>(pinned_buffers_[3]);
   auto inference_end_time = std::chrono::system_clock::now();
   std::chrono::duration<double> inference_diff =
       inference_end_time - inference_start_time;
@@ -613,8 +640,6 @@ bool TrajectoryImitationTensorRTInference::DoCNNLSTMMODELInference(
                                                               (i + 1));
   }
 
-  // release the stream and the buffers
-  cudaStreamDestroy(stream);
   return true;
 }
 
@@ -24,6 +24,8 @@
 #include <string>
 #include <iostream>
 
+#include <cuda_runtime_api.h>
+
 #include "NvInfer.h"
 #include "NvOnnxParser.h"
 #include "modules/planning/learning_based/model_inference/model_inference.h"
@@ -119,10 +121,26 @@ class TrajectoryImitationTensorRTInference : public ModelInference {
    */
   bool DoCNNLSTMMODELInference(LearningDataFrame* learning_data_frame);
 
+  /**
+   * @brief capture the fixed-shape engine execution into a CUDA graph so
+   * per-cycle inference is a single graph launch; falls back to regular
+   * enqueue when capture is not supported
+   */
+  void CaptureCudaGraph();
+
+  static constexpr int kMaxBindingsNum = 4;
+
   Logger g_logger_;
   nvinfer1::IExecutionContext* trt_context_;
   nvinfer1::ICudaEngine* trt_engine_;
-  void* trt_buffers_[4]{0};
+  void* trt_buffers_[kMaxBindingsNum]{0};
+  // pinned host staging buffers mirroring the device bindings, allocated
+  // once at model load
+  void* pinned_buffers_[kMaxBindingsNum]{0};
+  size_t trt_buffer_sizes_[kMaxBindingsNum]{0};
+  cudaStream_t trt_stream_ = nullptr;
+  cudaGraphExec_t trt_graph_exec_ = nullptr;
+  bool use_cuda_graph_ = false;
 };
 
 }  // namespace planning
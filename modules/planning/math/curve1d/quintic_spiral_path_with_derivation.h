@@ -20,6 +20,7 @@
 
 #pragma once
 
+#include <cmath>
 #include <unordered_map>
 #include <utility>
 
@@ -70,27 +71,7 @@ class QuinticSpiralPathWithDerivation : public QuinticPolynomialCurve1d {
 
   static const size_t INDEX_MAX = 7;
 
-  double ComputeCartesianDeviationX(const double s) const {
-    auto cos_theta = [this](const double s) {
-      const auto a = Evaluate(0, s);
-      return std::cos(a);
-    };
-    return common::math::IntegrateByGaussLegendre<N>(cos_theta, 0.0, s);
-  }
-
-  double ComputeCartesianDeviationY(const double s) const {
-    auto sin_theta = [this](const double s) {
-      const auto a = Evaluate(0, s);
-      return std::sin(a);
-    };
-    return common::math::IntegrateByGaussLegendre<N>(sin_theta, 0.0, s);
-  }
-
  private:
-  double DeriveCosTheta(const size_t param_index, const double r) const;
-
-  double DeriveSinTheta(const size_t param_index, const double r) const;
-
   double DeriveThetaDerivative(const size_t param_index, const double r) const;
 
   std::array<std::array<double, 7>, 6> coef_deriv_;
@@ -110,6 +91,14 @@ class QuinticSpiralPathWithDerivation : public QuinticPolynomialCurve1d {
   std::array<double, N> gauss_points_;
 
   std::array<double, N> gauss_point_weights_;
+
+  // Quadrature node tables computed once at construction; every quadrature
+  // in this class integrates over the same nodes of the same spiral.
+  std::array<double, N> node_ratios_;
+
+  std::array<double, N> node_cos_theta_;
+
+  std::array<double, N> node_sin_theta_;
 };
 
 template <size_t N>
@@ -123,9 +112,18 @@ QuinticSpiralPathWithDerivation<N>::QuinticSpiralPathWithDerivation(
   gauss_points_ = gauss_points.first;
   gauss_point_weights_ = gauss_points.second;
 
-  dx_ = ComputeCartesianDeviationX(s);
+  for (size_t i = 0; i < N; ++i) {
+    const double r = 0.5 * gauss_points_[i] + 0.5;
+    const double theta = Evaluate(0, r * s);
+    node_ratios_[i] = r;
+    node_cos_theta_[i] = std::cos(theta);
+    node_sin_theta_[i] = std::sin(theta);
 
-  dy_ = ComputeCartesianDeviationY(s);
+    dx_ += gauss_point_weights_[i] * node_cos_theta_[i];
+    dy_ += gauss_point_weights_[i] * node_sin_theta_[i];
+  }
+  dx_ *= 0.5 * s;
+  dy_ *= 0.5 * s;
 
   double s2 = s * s;
   double s3 = s2 * s;
@@ -217,35 +215,23 @@ QuinticSpiralPathWithDerivation<N>::DeriveCartesianDeviation(
     return cache_cartesian_deriv_[param_index];
   }
 
-  const auto& g = gauss_points_;
   const auto& w = gauss_point_weights_;
 
   std::pair<double, double> cartesian_deviation = {0.0, 0.0};
-  if (param_index != DELTA_S) {
-    for (size_t i = 0; i < N; ++i) {
-      double r = 0.5 * g[i] + 0.5;
-      cartesian_deviation.first += w[i] * DeriveCosTheta(param_index, r);
-      cartesian_deviation.second += w[i] * DeriveSinTheta(param_index, r);
-    }
-
-    cartesian_deviation.first *= param_ * 0.5;
-    cartesian_deviation.second *= param_ * 0.5;
-  } else {
-    for (size_t i = 0; i < N; ++i) {
-      double r = 0.5 * g[i] + 0.5;
-      cartesian_deviation.first += w[i] * DeriveCosTheta(param_index, r);
-      cartesian_deviation.second += w[i] * DeriveSinTheta(param_index, r);
-    }
+  for (size_t i = 0; i < N; ++i) {
+    const double theta_deriv =
+        DeriveThetaDerivative(param_index, node_ratios_[i]);
+    cartesian_deviation.first += w[i] * (-node_sin_theta_[i]) * theta_deriv;
+    cartesian_deviation.second += w[i] * node_cos_theta_[i] * theta_deriv;
+  }
 
-    cartesian_deviation.first *= param_ * 0.5;
-    cartesian_deviation.second *= param_ * 0.5;
+  cartesian_deviation.first *= param_ * 0.5;
+  cartesian_deviation.second *= param_ * 0.5;
 
+  if (param_index == DELTA_S) {
     for (size_t i = 0; i < N; ++i) {
-      double r = 0.5 * g[i] + 0.5;
-      auto theta = Evaluate(0, r * param_);
-
-      cartesian_deviation.first += 0.5 * w[i] * std::cos(theta);
-      cartesian_deviation.second += 0.5 * w[i] * std::sin(theta);
+      cartesian_deviation.first += 0.5 * w[i] * node_cos_theta_[i];
+      cartesian_deviation.second += 0.5 * w[i] * node_sin_theta_[i];
     }
   }
   cache_cartesian_deriv_[param_index] = cartesian_deviation;
@@ -330,25 +316,5 @@ double QuinticSpiralPathWithDerivation<N>::DeriveThetaDerivative(
   return derivative;
 }
 
-template <size_t N>
-double QuinticSpiralPathWithDerivation<N>::DeriveCosTheta(
-    const size_t param_index, const double r) const {
-  double g = param_ * r;
-  double theta = Evaluate(0, g);
-
-  double derivative = -std::sin(theta) * DeriveThetaDerivative(param_index, r);
-  return derivative;
-}
-
-template <size_t N>
-double QuinticSpiralPathWithDerivation<N>::DeriveSinTheta(
-    const size_t param_index, const double r) const {
-  double g = param_ * r;
-  double theta = Evaluate(0, g);
-
-  double derivative = std::cos(theta) * DeriveThetaDerivative(param_index, r);
-  return derivative;
-}
-
 }  // namespace planning
 }  // namespace apollo
@@ -27,6 +27,10 @@
 namespace apollo {
 namespace planning {
 
+FemPosDeviationOsqpInterface::~FemPosDeviationOsqpInterface() {
+  FreeOsqpProblem();
+}
+
 bool FemPosDeviationOsqpInterface::Solve() {
   // Sanity Check
   if (ref_points_.empty()) {
@@ -54,56 +58,34 @@ bool FemPosDeviationOsqpInterface::Solve() {
   num_of_variables_ = num_of_points_ * 2;
   num_of_constraints_ = num_of_variables_;
 
-  // Calculate kernel
-  std::vector<c_float> P_data;
-  std::vector<c_int> P_indices;
-  std::vector<c_int> P_indptr;
-  CalculateKernel(&P_data, &P_indices, &P_indptr);
-
-  // Calculate affine constraints
-  std::vector<c_float> A_data;
-  std::vector<c_int> A_indices;
-  std::vector<c_int> A_indptr;
-  std::vector<c_float> lower_bounds;
-  std::vector<c_float> upper_bounds;
-  CalculateAffineConstraint(&A_data, &A_indices, &A_indptr, &lower_bounds,
-                            &upper_bounds);
-
-  // Calculate offset
-  std::vector<c_float> q;
-  CalculateOffset(&q);
-
-  // Set primal warm start
-  std::vector<c_float> primal_warm_start;
-  SetPrimalWarmStart(&primal_warm_start);
+  if (CanUpdateInPlace()) {
+    // Same structure as the workspace set up by the previous solve: only the
+    // linear cost and the bounds depend on the reference points, so refresh
+    // them in place and keep the factorization.
+    q_.clear();
+    CalculateOffset(&q_);
+    lower_bounds_.clear();
+    upper_bounds_.clear();
+    CalculateBounds(&lower_bounds_, &upper_bounds_);
+    primal_warm_start_.clear();
+    SetPrimalWarmStart(&primal_warm_start_);
+    osqp_update_lin_cost(work_, q_.data());
+    osqp_update_bounds(work_, lower_bounds_.data(), upper_bounds_.data());
+  } else if (!SetupOsqpProblem()) {
+    AERROR << "Failed to setup osqp problem.";
+    FreeOsqpProblem();
+    return false;
+  }
 
-  OSQPData* data = reinterpret_cast<OSQPData*>(c_malloc(sizeof(OSQPData)));
-  OSQPSettings* settings =
-      reinterpret_cast<OSQPSettings*>(c_malloc(sizeof(OSQPSettings)));
+  osqp_warm_start_x(work_, primal_warm_start_.data());
 
-  // Define Solver settings
-  osqp_set_default_settings(settings);
-  settings->max_iter = max_iter_;
-  settings->time_limit = time_limit_;
-  settings->verbose = verbose_;
-  settings->scaled_termination = scaled_termination_;
-  settings->warm_start = warm_start_;
-
-  OSQPWorkspace* work = nullptr;
-
-  bool res = OptimizeWithOsqp(num_of_variables_, lower_bounds.size(), &P_data,
-                              &P_indices, &P_indptr, &A_data, &A_indices,
-                              &A_indptr, &lower_bounds, &upper_bounds, &q,
-                              &primal_warm_start, data, &work, settings);
-  if (res == false || work == nullptr || work->solution == nullptr) {
-    AERROR << "Failed to find solution.";
-    // Cleanup
-    osqp_cleanup(work);
-    c_free(data->A);
-    c_free(data->P);
-    c_free(data);
-    c_free(settings);
+  // Solve Problem
+  osqp_solve(work_);
 
+  auto status = work_->info->status_val;
+  if ((status != 1 && status != 2) || work_->solution == nullptr) {
+    AERROR << "failed optimization status:\t" << work_->info->status;
+    FreeOsqpProblem();
     return false;
   }
 
@@ -112,17 +94,10 @@ bool FemPosDeviationOsqpInterface::Solve() {
   y_.resize(num_of_points_);
   for (int i = 0; i < num_of_points_; ++i) {
     int index = i * 2;
-    x_.at(i) = work->solution->x[index];
-    y_.at(i) = work->solution->x[index + 1];
+    x_.at(i) = work_->solution->x[index];
+    y_.at(i) = work_->solution->x[index + 1];
   }
 
-  // Cleanup
-  osqp_cleanup(work);
-  c_free(data->A);
-  c_free(data->P);
-  c_free(data);
-  c_free(settings);
-
   return true;
 }
 
@@ -245,6 +220,11 @@ void FemPosDeviationOsqpInterface::CalculateAffineConstraint(
   }
   A_indptr->push_back(ind_A);
 
+  CalculateBounds(lower_bounds, upper_bounds);
+}
+
+void FemPosDeviationOsqpInterface::CalculateBounds(
+    std::vector<c_float>* lower_bounds, std::vector<c_float>* upper_bounds) {
   for (int i = 0; i < num_of_points_; ++i) {
     const auto& ref_point_xy = ref_points_[i];
     upper_bounds->push_back(ref_point_xy.first + bounds_around_refs_[i]);
@@ -263,48 +243,99 @@ void FemPosDeviationOsqpInterface::SetPrimalWarmStart(
   }
 }
 
-bool FemPosDeviationOsqpInterface::OptimizeWithOsqp(
-    const size_t kernel_dim, const size_t num_affine_constraint,
-    std::vector<c_float>* P_data, std::vector<c_int>* P_indices,
-    std::vector<c_int>* P_indptr, std::vector<c_float>* A_data,
-    std::vector<c_int>* A_indices, std::vector<c_int>* A_indptr,
-    std::vector<c_float>* lower_bounds, std::vector<c_float>* upper_bounds,
-    std::vector<c_float>* q, std::vector<c_float>* primal_warm_start,
-    OSQPData* data, OSQPWorkspace** work, OSQPSettings* settings) {
-  CHECK_EQ(lower_bounds->size(), upper_bounds->size());
-
-  data->n = kernel_dim;
-  data->m = num_affine_constraint;
-  data->P = csc_matrix(data->n, data->n, P_data->size(), P_data->data(),
-                       P_indices->data(), P_indptr->data());
-  data->q = q->data();
-  data->A = csc_matrix(data->m, data->n, A_data->size(), A_data->data(),
-                       A_indices->data(), A_indptr->data());
-  data->l = lower_bounds->data();
-  data->u = upper_bounds->data();
-
-  *work = osqp_setup(data, settings);
-  // osqp_setup(work, data, settings);
-
-  osqp_warm_start_x(*work, primal_warm_start->data());
+bool FemPosDeviationOsqpInterface::CanUpdateInPlace() const {
+  return work_ != nullptr && num_of_points_ == setup_num_of_points_ &&
+         weight_fem_pos_deviation_ == setup_weight_fem_pos_deviation_ &&
+         weight_path_length_ == setup_weight_path_length_ &&
+         weight_ref_deviation_ == setup_weight_ref_deviation_ &&
+         max_iter_ == setup_max_iter_ && time_limit_ == setup_time_limit_ &&
+         verbose_ == setup_verbose_ &&
+         scaled_termination_ == setup_scaled_termination_ &&
+         warm_start_ == setup_warm_start_;
+}
 
-  // Solve Problem
-  osqp_solve(*work);
+bool FemPosDeviationOsqpInterface::SetupOsqpProblem() {
+  FreeOsqpProblem();
 
-  auto status = (*work)->info->status_val;
+  // Calculate kernel
+  P_data_.clear();
+  P_indices_.clear();
+  P_indptr_.clear();
+  CalculateKernel(&P_data_, &P_indices_, &P_indptr_);
 
-  if (status < 0) {
-    AERROR << "failed optimization status:\t" << (*work)->info->status;
-    return false;
-  }
+  // Calculate affine constraints
+  A_data_.clear();
+  A_indices_.clear();
+  A_indptr_.clear();
+  lower_bounds_.clear();
+  upper_bounds_.clear();
+  CalculateAffineConstraint(&A_data_, &A_indices_, &A_indptr_, &lower_bounds_,
+                            &upper_bounds_);
+  CHECK_EQ(lower_bounds_.size(), upper_bounds_.size());
+
+  // Calculate offset
+  q_.clear();
+  CalculateOffset(&q_);
 
-  if (status != 1 && status != 2) {
-    AERROR << "failed optimization status:\t" << (*work)->info->status;
+  // Set primal warm start
+  primal_warm_start_.clear();
+  SetPrimalWarmStart(&primal_warm_start_);
+
+  data_ = reinterpret_cast<OSQPData*>(c_malloc(sizeof(OSQPData)));
+  settings_ = reinterpret_cast<OSQPSettings*>(c_malloc(sizeof(OSQPSettings)));
+
+  // Define Solver settings
+  osqp_set_default_settings(settings_);
+  settings_->max_iter = max_iter_;
+  settings_->time_limit = time_limit_;
+  settings_->verbose = verbose_;
+  settings_->scaled_termination = scaled_termination_;
+  settings_->warm_start = warm_start_;
+
+  data_->n = num_of_variables_;
+  data_->m = static_cast<c_int>(lower_bounds_.size());
+  data_->P = csc_matrix(data_->n, data_->n, P_data_.size(), P_data_.data(),
+                        P_indices_.data(), P_indptr_.data());
+  data_->q = q_.data();
+  data_->A = csc_matrix(data_->m, data_->n, A_data_.size(), A_data_.data(),
+                        A_indices_.data(), A_indptr_.data());
+  data_->l = lower_bounds_.data();
+  data_->u = upper_bounds_.data();
+
+  work_ = osqp_setup(data_, settings_);
+  if (work_ == nullptr) {
     return false;
   }
 
+  setup_num_of_points_ = num_of_points_;
+  setup_weight_fem_pos_deviation_ = weight_fem_pos_deviation_;
+  setup_weight_path_length_ = weight_path_length_;
+  setup_weight_ref_deviation_ = weight_ref_deviation_;
+  setup_max_iter_ = max_iter_;
+  setup_time_limit_ = time_limit_;
+  setup_verbose_ = verbose_;
+  setup_scaled_termination_ = scaled_termination_;
+  setup_warm_start_ = warm_start_;
   return true;
 }
 
+void FemPosDeviationOsqpInterface::FreeOsqpProblem() {
+  if (work_ != nullptr) {
+    osqp_cleanup(work_);
+    work_ = nullptr;
+  }
+  if (data_ != nullptr) {
+    c_free(data_->A);
+    c_free(data_->P);
+    c_free(data_);
+    data_ = nullptr;
+  }
+  if (settings_ != nullptr) {
+    c_free(settings_);
+    settings_ = nullptr;
+  }
+  setup_num_of_points_ = -1;
+}
+
 }  // namespace planning
 }  // namespace apollo
@@ -32,7 +32,12 @@ class FemPosDeviationOsqpInterface {
  public:
   FemPosDeviationOsqpInterface() = default;
 
-  virtual ~FemPosDeviationOsqpInterface() = default;
+  // The osqp workspace owned by this interface cannot be shared
+  FemPosDeviationOsqpInterface(const FemPosDeviationOsqpInterface&) = delete;
+  FemPosDeviationOsqpInterface& operator=(const FemPosDeviationOsqpInterface&) =
+      delete;
+
+  virtual ~FemPosDeviationOsqpInterface();
 
   void set_ref_points(
       const std::vector<std::pair<double, double>>& ref_points) {
@@ -86,16 +91,18 @@ class FemPosDeviationOsqpInterface {
                                  std::vector<c_float>* lower_bounds,
                                  std::vector<c_float>* upper_bounds);
 
+  void CalculateBounds(std::vector<c_float>* lower_bounds,
+                       std::vector<c_float>* upper_bounds);
+
   void SetPrimalWarmStart(std::vector<c_float>* primal_warm_start);
 
-  bool OptimizeWithOsqp(
-      const size_t kernel_dim, const size_t num_affine_constraint,
-      std::vector<c_float>* P_data, std::vector<c_int>* P_indices,
-      std::vector<c_int>* P_indptr, std::vector<c_float>* A_data,
-      std::vector<c_int>* A_indices, std::vector<c_int>* A_indptr,
-      std::vector<c_float>* lower_bounds, std::vector<c_float>* upper_bounds,
-      std::vector<c_float>* q, std::vector<c_float>* primal_warm_start,
-      OSQPData* data, OSQPWorkspace** work, OSQPSettings* settings);
+  // Whether the current workspace can be refreshed in place instead of being
+  // set up from scratch
+  bool CanUpdateInPlace() const;
+
+  bool SetupOsqpProblem();
+
+  void FreeOsqpProblem();
 
  private:
   // Reference points and deviation bounds
@@ -122,6 +129,37 @@ class FemPosDeviationOsqpInterface {
   // Optimized_result
   std::vector<double> x_;
   std::vector<double> y_;
+
+  // Osqp problem kept across Solve() calls. The constraint matrix is a pure
+  // identity and the kernel depends only on the weights and the number of
+  // points, so repeated solves over equally sized windows only need the
+  // linear cost and the bounds refreshed in place.
+  OSQPWorkspace* work_ = nullptr;
+  OSQPData* data_ = nullptr;
+  OSQPSettings* settings_ = nullptr;
+
+  // Backing storage referenced by data_; must stay alive as long as work_
+  std::vector<c_float> P_data_;
+  std::vector<c_int> P_indices_;
+  std::vector<c_int> P_indptr_;
+  std::vector<c_float> A_data_;
+  std::vector<c_int> A_indices_;
+  std::vector<c_int> A_indptr_;
+  std::vector<c_float> q_;
+  std::vector<c_float> lower_bounds_;
+  std::vector<c_float> upper_bounds_;
+  std::vector<c_float> primal_warm_start_;
+
+  // Problem structure behind the current workspace
+  int setup_num_of_points_ = -1;
+  double setup_weight_fem_pos_deviation_ = 0.0;
+  double setup_weight_path_length_ = 0.0;
+  double setup_weight_ref_deviation_ = 0.0;
+  int setup_max_iter_ = 0;
+  double setup_time_limit_ = 0.0;
+  bool setup_verbose_ = false;
+  bool setup_scaled_termination_ = false;
+  bool setup_warm_start_ = false;
 };
 }  // namespace planning
 }  // namespace apollo
@@ -20,12 +20,14 @@
 
 #include "modules/planning/math/discretized_points_smoothing/fem_pos_deviation_smoother.h"
 
+#include <future>
+
 #include <coin/IpIpoptApplication.hpp>
 #include <coin/IpSolveStatistics.hpp>
 
 #include "cyber/common/log.h"
+#include "cyber/task/task.h"
 #include "modules/planning/math/discretized_points_smoothing/fem_pos_deviation_ipopt_interface.h"
-#include "modules/planning/math/discretized_points_smoothing/fem_pos_deviation_osqp_interface.h"
 #include "modules/planning/math/discretized_points_smoothing/fem_pos_deviation_sqp_osqp_interface.h"
 
 namespace apollo {
@@ -59,7 +61,9 @@ bool FemPosDeviationSmoother::QpWithOsqp(
     return false;
   }
 
-  FemPosDeviationOsqpInterface solver;
+  // The interface is a member so that repeated calls on one smoother with
+  // equally sized windows reuse the osqp workspace of the previous call
+  FemPosDeviationOsqpInterface& solver = qp_osqp_interface_;
 
   solver.set_weight_fem_pos_deviation(config_.weight_fem_pos_deviation());
   solver.set_weight_path_length(config_.weight_path_length());
@@ -83,6 +87,46 @@ bool FemPosDeviationSmoother::QpWithOsqp(
   return true;
 }
 
+bool FemPosDeviationSmoother::SolveBatch(
+    const FemPosDeviationSmootherConfig& config,
+    const std::vector<std::vector<std::pair<double, double>>>&
+        raw_point2d_batch,
+    const std::vector<std::vector<double>>& bounds_batch,
+    std::vector<std::vector<double>>* opt_x_batch,
+    std::vector<std::vector<double>>* opt_y_batch) {
+  if (opt_x_batch == nullptr || opt_y_batch == nullptr) {
+    AERROR << "opt_x_batch or opt_y_batch is nullptr";
+    return false;
+  }
+
+  if (raw_point2d_batch.size() != bounds_batch.size()) {
+    AERROR << "raw_point2d_batch and bounds_batch size not equal";
+    return false;
+  }
+
+  const size_t batch_size = raw_point2d_batch.size();
+  opt_x_batch->assign(batch_size, {});
+  opt_y_batch->assign(batch_size, {});
+
+  std::vector<std::future<bool>> results;
+  results.reserve(batch_size);
+  for (size_t i = 0; i < batch_size; ++i) {
+    results.emplace_back(cyber::Async([&config, &raw_point2d_batch,
+                                       &bounds_batch, opt_x_batch, opt_y_batch,
+                                       i]() {
+      FemPosDeviationSmoother smoother(config);
+      return smoother.Solve(raw_point2d_batch[i], bounds_batch[i],
+                            &(*opt_x_batch)[i], &(*opt_y_batch)[i]);
+    }));
+  }
+
+  bool all_solved = true;
+  for (auto& result : results) {
+    all_solved = result.get() && all_solved;
+  }
+  return all_solved;
+}
+
 bool FemPosDeviationSmoother::SqpWithOsqp(
     const std::vector<std::pair<double, double>>& raw_point2d,
     const std::vector<double>& bounds, std::vector<double>* opt_x,
@@ -23,6 +23,7 @@
 #include <utility>
 #include <vector>
 
+#include "modules/planning/math/discretized_points_smoothing/fem_pos_deviation_osqp_interface.h"
 #include "modules/planning/proto/math/fem_pos_deviation_smoother_config.pb.h"
 
 namespace apollo {
@@ -64,8 +65,26 @@ class FemPosDeviationSmoother {
                    const std::vector<double>& bounds,
                    std::vector<double>* opt_x, std::vector<double>* opt_y);
 
+  /*
+   * @brief:
+   * Smooth several candidate lines concurrently, one solver per line on the
+   * cyber task pool. Batch entry i of opt_x_batch/opt_y_batch holds the
+   * result for raw_point2d_batch[i]; returns false if any line fails.
+   */
+  static bool SolveBatch(
+      const FemPosDeviationSmootherConfig& config,
+      const std::vector<std::vector<std::pair<double, double>>>&
+          raw_point2d_batch,
+      const std::vector<std::vector<double>>& bounds_batch,
+      std::vector<std::vector<double>>* opt_x_batch,
+      std::vector<std::vector<double>>* opt_y_batch);
+
  private:
   FemPosDeviationSmootherConfig config_;
+
+  // Kept across Solve() calls so equally sized problems reuse the osqp
+  // workspace set up by the previous call
+  FemPosDeviationOsqpInterface qp_osqp_interface_;
 };
 }  // namespace planning
 }  // namespace apollo
@@ -16,6 +16,11 @@
 
 #include "modules/planning/math/piecewise_jerk/piecewise_jerk_problem.h"
 
+#include <mutex>
+#include <string>
+#include <typeinfo>
+#include <unordered_map>
+
 #include "cyber/common/log.h"
 #include "modules/planning/common/planning_gflags.h"
 
@@ -24,6 +29,24 @@ namespace planning {
 
 namespace {
 constexpr double kMaxVariableRange = 1.0e10;
+
+// One persistent OSQP workspace per problem signature. Problem objects are
+// re-created every planning cycle, so the workspaces are cached here for the
+// process lifetime. The OSQPData is kept alongside since the workspace
+// borrows its csc matrices.
+struct CachedWorkspace {
+  OSQPWorkspace* work = nullptr;
+  OSQPData* data = nullptr;
+  std::vector<c_float> P_data;
+  std::vector<c_float> A_data;
+};
+
+std::mutex workspace_cache_mutex;
+
+std::unordered_map<std::string, CachedWorkspace>& WorkspaceCache() {
+  static auto* cache = new std::unordered_map<std::string, CachedWorkspace>();
+  return *cache;
+}
 }  // namespace
 
 PiecewiseJerkProblem::PiecewiseJerkProblem(
@@ -88,6 +111,10 @@ OSQPData* PiecewiseJerkProblem::FormulateProblem() {
 }
 
 bool PiecewiseJerkProblem::Optimize(const int max_iter) {
+  if (enable_warm_start_) {
+    return OptimizeWithWarmStart(max_iter);
+  }
+
   OSQPData* data = FormulateProblem();
 
   OSQPSettings* settings = SolverDefaultSettings();
@@ -99,19 +126,102 @@ bool PiecewiseJerkProblem::Optimize(const int max_iter) {
 
   osqp_solve(osqp_work);
 
+  if (!ExtractSolution(osqp_work)) {
+    osqp_cleanup(osqp_work);
+    FreeData(data);
+    c_free(settings);
+    return false;
+  }
+
+  // Cleanup
+  osqp_cleanup(osqp_work);
+  FreeData(data);
+  c_free(settings);
+  return true;
+}
+
+bool PiecewiseJerkProblem::OptimizeWithWarmStart(const int max_iter) {
+  // calculate kernel
+  std::vector<c_float> P_data;
+  std::vector<c_int> P_indices;
+  std::vector<c_int> P_indptr;
+  CalculateKernel(&P_data, &P_indices, &P_indptr);
+
+  // calculate affine constraints
+  std::vector<c_float> A_data;
+  std::vector<c_int> A_indices;
+  std::vector<c_int> A_indptr;
+  std::vector<c_float> lower_bounds;
+  std::vector<c_float> upper_bounds;
+  CalculateAffineConstraint(&A_data, &A_indices, &A_indptr, &lower_bounds,
+                            &upper_bounds);
+
+  // calculate offset
+  std::vector<c_float> q;
+  CalculateOffset(&q);
+
+  // The sparsity pattern is fully determined by the concrete problem type and
+  // the number of knots, so workspaces are cached under that signature.
+  const std::string key =
+      std::string(typeid(*this).name()) + "_" + std::to_string(num_of_knots_);
+
+  std::lock_guard<std::mutex> lock(workspace_cache_mutex);
+  auto& entry = WorkspaceCache()[key];
+  const bool structure_unchanged =
+      entry.work != nullptr && entry.P_data.size() == P_data.size() &&
+      entry.A_data.size() == A_data.size() &&
+      entry.data->m == static_cast<c_int>(lower_bounds.size());
+  if (structure_unchanged) {
+    // Re-upload only what changed; OSQP keeps the KKT factorization when the
+    // matrices are untouched and warm-starts from last cycle's solution.
+    if (entry.P_data != P_data) {
+      osqp_update_P(entry.work, P_data.data(), OSQP_NULL,
+                    static_cast<c_int>(P_data.size()));
+    }
+    if (entry.A_data != A_data) {
+      osqp_update_A(entry.work, A_data.data(), OSQP_NULL,
+                    static_cast<c_int>(A_data.size()));
+    }
+    osqp_update_lin_cost(entry.work, q.data());
+    osqp_update_bounds(entry.work, lower_bounds.data(), upper_bounds.data());
+    osqp_update_max_iter(entry.work, max_iter);
+  } else {
+    if (entry.work != nullptr) {
+      osqp_cleanup(entry.work);
+      FreeData(entry.data);
+      c_free(entry.data);
+    }
+    entry.data = FormulateProblem();
+    OSQPSettings* settings = SolverDefaultSettings();
+    settings->max_iter = max_iter;
+    entry.work = osqp_setup(entry.data, settings);
+    c_free(settings);
+    if (entry.work == nullptr) {
+      AERROR << "Failed to set up OSQP workspace";
+      FreeData(entry.data);
+      c_free(entry.data);
+      entry = CachedWorkspace();
+      return false;
+    }
+  }
+  entry.P_data = std::move(P_data);
+  entry.A_data = std::move(A_data);
+
+  osqp_solve(entry.work);
+
+  // The workspace stays cached even if this cycle's solve failed; its
+  // structure is still valid for the next cycle.
+  return ExtractSolution(entry.work);
+}
+
+bool PiecewiseJerkProblem::ExtractSolution(OSQPWorkspace* osqp_work) {
   auto status = osqp_work->info->status_val;
 
   if (status < 0 || (status != 1 && status != 2)) {
     AERROR << "failed optimization status:\t" << osqp_work->info->status;
-    osqp_cleanup(osqp_work);
-    FreeData(data);
-    c_free(settings);
     return false;
   } else if (osqp_work->solution == nullptr) {
     AERROR << "The solution from OSQP is nullptr";
-    osqp_cleanup(osqp_work);
-    FreeData(data);
-    c_free(settings);
     return false;
   }
 
@@ -125,11 +235,6 @@ bool PiecewiseJerkProblem::Optimize(const int max_iter) {
     ddx_.at(i) =
         osqp_work->solution->x[i + 2 * num_of_knots_] / scale_factor_[2];
   }
-
-  // Cleanup
-  osqp_cleanup(osqp_work);
-  FreeData(data);
-  c_free(settings);
   return true;
 }
 
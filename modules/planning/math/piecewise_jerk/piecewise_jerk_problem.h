@@ -108,6 +108,16 @@ class PiecewiseJerkProblem {
   void set_end_state_ref(const std::array<double, 3>& weight_end_state,
                          const std::array<double, 3>& end_state_ref);
 
+  /**
+   * @brief Keep the OSQP workspace alive between planning cycles. The cached
+   *        workspace skips the cold csc/KKT setup and warm-starts from last
+   *        cycle's solution; only bounds, linear cost, and changed matrix
+   *        values are re-uploaded. Requires the problem structure (number of
+   *        knots) to stay constant between cycles, which is re-checked and
+   *        falls back to a full setup otherwise.
+   */
+  void set_enable_warm_start(const bool enable) { enable_warm_start_ = enable; }
+
   virtual bool Optimize(const int max_iter = 4000);
 
   const std::vector<double>& opt_x() const { return x_; }
@@ -134,6 +144,10 @@ class PiecewiseJerkProblem {
 
   OSQPData* FormulateProblem();
 
+  bool OptimizeWithWarmStart(const int max_iter);
+
+  bool ExtractSolution(OSQPWorkspace* osqp_work);
+
   void FreeData(OSQPData* data);
 
   template <typename T>
@@ -175,6 +189,8 @@ class PiecewiseJerkProblem {
   bool has_end_state_ref_ = false;
   std::array<double, 3> weight_end_state_ = {{0.0, 0.0, 0.0}};
   std::array<double, 3> end_state_ref_;
+
+  bool enable_warm_start_ = false;
 };
 
 }  // namespace planning
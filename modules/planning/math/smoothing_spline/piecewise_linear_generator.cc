@@ -61,13 +61,23 @@ bool PiecewiseLinearGenerator::Solve() {
   const Eigen::MatrixXd& equality_constraint_boundary =
       constraint_.equality_constraint_boundary();
 
-  qp_solver_.reset(new apollo::common::math::ActiveSetQpSolver(
-      kernel_matrix, offset, inequality_constraint_matrix,
-      inequality_constraint_boundary, equality_constraint_matrix,
-      equality_constraint_boundary));
+  // Keep the solver across cycles when possible: with an unchanged problem
+  // structure, ActiveSetQpSolver hotstarts from the previous factorization
+  // and active set instead of a cold init.
+  if (qp_solver_ == nullptr ||
+      !qp_solver_->UpdateProblem(kernel_matrix, offset,
+                                 inequality_constraint_matrix,
+                                 inequality_constraint_boundary,
+                                 equality_constraint_matrix,
+                                 equality_constraint_boundary)) {
+    qp_solver_.reset(new apollo::common::math::ActiveSetQpSolver(
+        kernel_matrix, offset, inequality_constraint_matrix,
+        inequality_constraint_boundary, equality_constraint_matrix,
+        equality_constraint_boundary));
 
-  qp_solver_->EnableCholeskyRefactorisation(1);
-  qp_solver_->set_pos_definite_hessian();
+    qp_solver_->EnableCholeskyRefactorisation(1);
+    qp_solver_->set_pos_definite_hessian();
+  }
 
   if (!qp_solver_->Solve()) {
     return false;
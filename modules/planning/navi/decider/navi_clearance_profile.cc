@@ -0,0 +1,125 @@
+/******************************************************************************
+ * Copyright 2021 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+/**
+ * @file
+ * @brief This file provides the implementation of the class
+ * "NaviClearanceProfile".
+ */
+#include "modules/planning/navi/decider/navi_clearance_profile.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "modules/common/math/path_matcher.h"
+#include "modules/common/math/vec2d.h"
+
+namespace apollo {
+namespace planning {
+
+using apollo::common::PathPoint;
+using apollo::common::math::PathMatcher;
+using apollo::common::math::Vec2d;
+
+namespace {
+constexpr double kClearanceSStep = 0.4;
+}  // namespace
+
+void NaviClearanceProfile::Build(
+    const std::vector<common::PathPoint>& path_data_points,
+    const std::vector<const Obstacle*>& obstacles) {
+  projections_.clear();
+  clearance_.clear();
+  path_length_ = 0.0;
+  if (path_data_points.size() < 2) {
+    return;
+  }
+  path_length_ = path_data_points.back().s();
+  auto sample_num =
+      static_cast<size_t>(std::max(path_length_, 0.0) / kClearanceSStep) + 1;
+  clearance_.assign(sample_num, std::numeric_limits<double>::max());
+
+  vehicle_projection_ = PathMatcher::MatchToPath(path_data_points, 0, 0);
+
+  for (const auto* obstacle : obstacles) {
+    const auto& position = obstacle->Perception().position();
+    NaviObstacleProjection projection;
+    projection.point =
+        PathMatcher::MatchToPath(path_data_points, position.x(), position.y());
+
+    double dx = projection.point.x() - position.x();
+    double dy = projection.point.y() - position.y();
+    double dist = std::sqrt(dx * dx + dy * dy);
+
+    // The sign is determined by the relation between the obstacle and the
+    // path direction. Take positive on the left and negative on the right.
+    Vec2d p1(projection.point.x(), projection.point.y());
+    Vec2d p2(0.0, 0.0);
+    auto proj_len = projection.point.s();
+    if ((proj_len + 1) > path_data_points.back().s()) {
+      p2.set_x(path_data_points.back().x());
+      p2.set_y(path_data_points.back().y());
+    } else {
+      auto point = PathMatcher::MatchToPath(path_data_points, (proj_len + 1));
+      p2.set_x(point.x());
+      p2.set_y(point.y());
+    }
+    auto d = ((position.x() - p1.x()) * (p2.y() - p1.y())) -
+             ((position.y() - p1.y()) * (p2.x() - p1.x()));
+    projection.signed_distance = d > 0 ? -dist : dist;
+
+    // Mark the clearance profile over the longitudinal footprint of the
+    // obstacle.
+    double half_length = obstacle->Perception().length() / 2.0;
+    double clearance = dist - obstacle->Perception().width() / 2.0;
+    auto start_index = static_cast<size_t>(
+        std::max(proj_len - half_length, 0.0) / kClearanceSStep);
+    auto end_index = static_cast<size_t>(
+        std::min(proj_len + half_length, path_length_) / kClearanceSStep);
+    for (size_t i = start_index; i <= end_index && i < clearance_.size(); ++i) {
+      clearance_[i] = std::min(clearance_[i], clearance);
+    }
+
+    projections_.emplace(obstacle->Id(), projection);
+  }
+}
+
+const NaviObstacleProjection* NaviClearanceProfile::Find(
+    const std::string& obstacle_id) const {
+  auto iter = projections_.find(obstacle_id);
+  if (iter == projections_.end()) {
+    return nullptr;
+  }
+  return &iter->second;
+}
+
+const common::PathPoint& NaviClearanceProfile::VehicleProjection() const {
+  return vehicle_projection_;
+}
+
+double NaviClearanceProfile::GetClearanceAtS(const double s) const {
+  if (clearance_.empty()) {
+    return std::numeric_limits<double>::max();
+  }
+  auto index = static_cast<size_t>(
+      std::min(std::max(s, 0.0), path_length_) / kClearanceSStep);
+  index = std::min(index, clearance_.size() - 1);
+  return clearance_[index];
+}
+
+}  // namespace planning
+}  // namespace apollo
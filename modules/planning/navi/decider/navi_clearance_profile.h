@@ -0,0 +1,103 @@
+/******************************************************************************
+ * Copyright 2021 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+/**
+ * @file
+ * @brief This file provides the declaration of the class
+ * "NaviClearanceProfile".
+ */
+
+#pragma once
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "modules/common/proto/pnc_point.pb.h"
+#include "modules/planning/common/obstacle.h"
+
+/**
+ * @namespace apollo::planning
+ * @brief apollo::planning
+ */
+namespace apollo {
+namespace planning {
+
+/**
+ * @struct NaviObstacleProjection
+ * @brief The projection of one obstacle onto the current path, computed once
+ * per planning cycle.
+ */
+struct NaviObstacleProjection {
+  // Projection of the obstacle center on the path.
+  common::PathPoint point;
+  // Lateral distance between the obstacle center and the path. Take positive
+  // on the left and negative on the right.
+  double signed_distance = 0.0;
+};
+
+/**
+ * @class NaviClearanceProfile
+ * @brief NaviClearanceProfile caches the projections of all obstacles onto
+ * the current path together with a sampled 1D clearance profile along the
+ * path. It is built once per planning cycle so that the navi deciders can
+ * look up obstacle projections and path clearance in O(1) instead of
+ * re-projecting each obstacle with pairwise distance checks.
+ * Note that NaviClearanceProfile is only used in navigation mode (turn on
+ * navigation mode by setting "FLAGS_use_navigation_mode" to "true") and do
+ * not use it in standard mode.
+ */
+class NaviClearanceProfile {
+ public:
+  NaviClearanceProfile() = default;
+
+  ~NaviClearanceProfile() = default;
+
+  /**
+   * @brief Project all obstacles onto the path and sample the clearance
+   * profile. Must be called once per cycle before any query.
+   */
+  void Build(const std::vector<common::PathPoint> &path_data_points,
+             const std::vector<const Obstacle *> &obstacles);
+
+  /**
+   * @brief Get the cached projection of an obstacle.
+   * @return the projection or nullptr if the obstacle was not projected.
+   */
+  const NaviObstacleProjection *Find(const std::string &obstacle_id) const;
+
+  /**
+   * @brief Get the cached projection of the vehicle on the path.
+   * @return the projection point of the vehicle
+   */
+  const common::PathPoint &VehicleProjection() const;
+
+  /**
+   * @brief Get the minimum lateral clearance between the path and the edges
+   * of the obstacles covering the longitudinal position "s".
+   * @return the minimum lateral clearance
+   */
+  double GetClearanceAtS(const double s) const;
+
+ private:
+  std::unordered_map<std::string, NaviObstacleProjection> projections_;
+  common::PathPoint vehicle_projection_;
+  std::vector<double> clearance_;
+  double path_length_ = 0.0;
+};
+
+}  // namespace planning
+}  // namespace apollo
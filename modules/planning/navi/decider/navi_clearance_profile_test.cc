@@ -0,0 +1,103 @@
+/******************************************************************************
+ * Copyright 2021 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+/**
+ * @file
+ * @brief This file provides several unit tests for the class
+ * "NaviClearanceProfile".
+ */
+
+#include "modules/planning/navi/decider/navi_clearance_profile.h"
+
+#include <limits>
+
+#include "gtest/gtest.h"
+#include "modules/common/util/point_factory.h"
+#include "modules/perception/proto/perception_obstacle.pb.h"
+#include "modules/prediction/proto/prediction_obstacle.pb.h"
+
+using apollo::common::util::PointFactory;
+using apollo::perception::PerceptionObstacle;
+using apollo::prediction::ObstaclePriority;
+
+namespace apollo {
+namespace planning {
+
+TEST(NaviClearanceProfileTest, BuildAndQuery) {
+  NaviClearanceProfile clearance_profile;
+  std::vector<const Obstacle*> vec_obstacle;
+  std::vector<common::PathPoint> vec_points;
+  PerceptionObstacle perception_obstacle;
+
+  // obstacle on the left of the path
+  perception_obstacle.set_width(1.0);
+  perception_obstacle.set_length(1.0);
+  perception_obstacle.mutable_position()->set_x(2.0);
+  perception_obstacle.mutable_position()->set_y(3.0);
+  Obstacle b1("1", perception_obstacle, ObstaclePriority::NORMAL, false);
+
+  // obstacle on the right of the path
+  perception_obstacle.set_width(1.0);
+  perception_obstacle.set_length(1.0);
+  perception_obstacle.mutable_position()->set_x(3.0);
+  perception_obstacle.mutable_position()->set_y(0.0);
+  Obstacle b2("2", perception_obstacle, ObstaclePriority::NORMAL, false);
+
+  for (int i = 0; i < 5; ++i) {
+    vec_points.push_back(PointFactory::ToPathPoint(
+        static_cast<double>(i), 2.0, 0.0, static_cast<double>(i)));
+  }
+  vec_obstacle.emplace_back(&b1);
+  vec_obstacle.emplace_back(&b2);
+
+  clearance_profile.Build(vec_points, vec_obstacle);
+
+  EXPECT_DOUBLE_EQ(clearance_profile.VehicleProjection().s(), 0.0);
+
+  const auto* projection1 = clearance_profile.Find("1");
+  ASSERT_NE(projection1, nullptr);
+  EXPECT_DOUBLE_EQ(projection1->point.s(), 2.0);
+  EXPECT_DOUBLE_EQ(projection1->signed_distance, 1.0);
+
+  const auto* projection2 = clearance_profile.Find("2");
+  ASSERT_NE(projection2, nullptr);
+  EXPECT_DOUBLE_EQ(projection2->point.s(), 3.0);
+  EXPECT_DOUBLE_EQ(projection2->signed_distance, -2.0);
+
+  EXPECT_EQ(clearance_profile.Find("3"), nullptr);
+
+  // clearance at the footprint of obstacle "1": 1.0 - 0.5
+  EXPECT_DOUBLE_EQ(clearance_profile.GetClearanceAtS(2.0), 0.5);
+  // clearance at the footprint of obstacle "2": 2.0 - 0.5
+  EXPECT_DOUBLE_EQ(clearance_profile.GetClearanceAtS(3.2), 1.5);
+  // no obstacle covers the beginning of the path
+  EXPECT_DOUBLE_EQ(clearance_profile.GetClearanceAtS(0.0),
+                   std::numeric_limits<double>::max());
+}
+
+TEST(NaviClearanceProfileTest, EmptyProfile) {
+  NaviClearanceProfile clearance_profile;
+  std::vector<const Obstacle*> vec_obstacle;
+  std::vector<common::PathPoint> vec_points;
+
+  clearance_profile.Build(vec_points, vec_obstacle);
+  EXPECT_EQ(clearance_profile.Find("1"), nullptr);
+  EXPECT_DOUBLE_EQ(clearance_profile.GetClearanceAtS(1.0),
+                   std::numeric_limits<double>::max());
+}
+
+}  // namespace planning
+}  // namespace apollo
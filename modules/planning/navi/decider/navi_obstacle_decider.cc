@@ -26,17 +26,12 @@
 #include <utility>
 
 #include "cyber/common/log.h"
-#include "modules/common/math/line_segment2d.h"
-#include "modules/common/math/linear_interpolation.h"
-#include "modules/common/math/path_matcher.h"
 #include "modules/planning/common/planning_gflags.h"
 
 namespace apollo {
 namespace planning {
 
 using apollo::common::PathPoint;
-using apollo::common::math::PathMatcher;
-using apollo::common::math::Vec2d;
 
 namespace {
 constexpr double kEpislon = 1e-6;
@@ -70,41 +65,14 @@ double NaviObstacleDecider::GetMinLaneWidth(
   return min_lane_width;
 }
 
-void NaviObstacleDecider::AddObstacleOffsetDirection(
-    const common::PathPoint& projection_point,
-    const std::vector<common::PathPoint>& path_data_points,
-    const Obstacle* current_obstacle, const double proj_len, double* dist) {
-  Vec2d p1(projection_point.x(), projection_point.y());
-  Vec2d p2(0.0, 0.0);
-  if ((proj_len + 1) > path_data_points.back().s()) {
-    p2.set_x(path_data_points.back().x());
-    p2.set_y(path_data_points.back().y());
-  } else {
-    auto point = PathMatcher::MatchToPath(path_data_points, (proj_len + 1));
-    p2.set_x(point.x());
-    p2.set_y(point.y());
-  }
-  auto d = ((current_obstacle->Perception().position().x() - p1.x()) *
-            (p2.y() - p1.y())) -
-           ((current_obstacle->Perception().position().y() - p1.y()) *
-            (p2.x() - p1.x()));
-  if (d > 0) {
-    *dist = *dist * -1;
-  }
-}
-
 bool NaviObstacleDecider::IsNeedFilterObstacle(
     const Obstacle* current_obstacle, const PathPoint& vehicle_projection_point,
-    const std::vector<common::PathPoint>& path_data_points,
-    const common::VehicleState& vehicle_state,
-    PathPoint* projection_point_ptr) {
+    const PathPoint& projection_point,
+    const common::VehicleState& vehicle_state) {
   bool is_filter = true;
-  *projection_point_ptr = PathMatcher::MatchToPath(
-      path_data_points, current_obstacle->Perception().position().x(),
-      current_obstacle->Perception().position().y());
-  ADEBUG << "obstacle distance : " << projection_point_ptr->s()
+  ADEBUG << "obstacle distance : " << projection_point.s()
          << "vehicle distance : " << vehicle_projection_point.s();
-  if ((projection_point_ptr->s() - vehicle_projection_point.s()) >
+  if ((projection_point.s() - vehicle_projection_point.s()) >
       (config_.judge_dis_coeff() * vehicle_state.linear_velocity() +
        config_.basis_dis_value())) {
     return is_filter;
@@ -114,9 +82,9 @@ bool NaviObstacleDecider::IsNeedFilterObstacle(
   double vehicle_backedge_position = vehicle_projection_point.s();
 
   double obstacle_start_position =
-      projection_point_ptr->s() - current_obstacle->Perception().length() / 2.0;
+      projection_point.s() - current_obstacle->Perception().length() / 2.0;
   double obstacle_end_position =
-      projection_point_ptr->s() + current_obstacle->Perception().length() / 2.0;
+      projection_point.s() + current_obstacle->Perception().length() / 2.0;
   if ((vehicle_backedge_position - obstacle_end_position) >
       config_.safe_distance()) {
     return is_filter;
@@ -138,39 +106,33 @@ void NaviObstacleDecider::ProcessObstacle(
     const std::vector<common::PathPoint>& path_data_points,
     const PathDecision& path_decision, const double min_lane_width,
     const common::VehicleState& vehicle_state) {
-  auto func_distance = [](const PathPoint& point, const double x,
-                          const double y) {
-    double dx = point.x() - x;
-    double dy = point.y() - y;
-    return sqrt(dx * dx + dy * dy);
-  };
-
-  PathPoint projection_point;
-  PathPoint vehicle_projection_point =
-      PathMatcher::MatchToPath(path_data_points, 0, 0);
+  const PathPoint& vehicle_projection_point =
+      clearance_profile_.VehicleProjection();
   for (const auto& current_obstacle : obstacles) {
-    bool is_continue = IsNeedFilterObstacle(
-        current_obstacle, vehicle_projection_point, path_data_points,
-        vehicle_state, &projection_point);
+    const auto* obstacle_projection =
+        clearance_profile_.Find(current_obstacle->Id());
+    if (obstacle_projection == nullptr) {
+      continue;
+    }
+    bool is_continue =
+        IsNeedFilterObstacle(current_obstacle, vehicle_projection_point,
+                             obstacle_projection->point, vehicle_state);
     if (is_continue) {
       continue;
     }
-    auto dist = func_distance(projection_point,
-                              current_obstacle->Perception().position().x(),
-                              current_obstacle->Perception().position().y());
+    auto dist = std::fabs(obstacle_projection->signed_distance);
 
     if (dist <
         (config_.max_nudge_distance() + current_obstacle->Perception().width() +
          VehicleParam().left_edge_to_center())) {
-      auto proj_len = projection_point.s();
+      auto proj_len = obstacle_projection->point.s();
       if (std::fabs(proj_len) <= kEpislon ||
           proj_len >= path_data_points.back().s()) {
         continue;
       }
-      AddObstacleOffsetDirection(projection_point, path_data_points,
-                                 current_obstacle, proj_len, &dist);
       obstacle_lat_dist_.emplace(std::pair<double, double>(
-          current_obstacle->Perception().width(), dist));
+          current_obstacle->Perception().width(),
+          obstacle_projection->signed_distance));
     }
   }
 }
@@ -293,6 +255,7 @@ double NaviObstacleDecider::GetNudgeDistance(
 
   // Calculation of the number of current Lane obstacles
   obstacle_lat_dist_.clear();
+  clearance_profile_.Build(path_data_points, obstacles);
   ProcessObstacle(obstacles, path_data_points, path_decision, min_lane_width,
                   vehicle_state);
   for (auto iter = obstacle_lat_dist_.begin(); iter != obstacle_lat_dist_.end();
@@ -382,15 +345,19 @@ void NaviObstacleDecider::GetUnsafeObstaclesInfo(
   }
   // Get obstacles'ID.
   unsafe_obstacle_info_.clear();
-  PathPoint vehicle_projection_point =
-      PathMatcher::MatchToPath(path_data_points, 0, 0);
+  clearance_profile_.Build(path_data_points, obstacles);
+  const PathPoint& vehicle_projection_point =
+      clearance_profile_.VehicleProjection();
   for (const auto& iter : obstacles) {
     const double obstacle_y = iter->Perception().position().y();
     if ((obstacle_y > unsafe_range.first && obstacle_y < unsafe_range.second) ||
         std::abs(iter->Perception().velocity().y()) >
             config_.lateral_velocity_value()) {
-      auto projection_point = PathMatcher::MatchToPath(
-          path_data_points, iter->Perception().position().x(), obstacle_y);
+      const auto* obstacle_projection = clearance_profile_.Find(iter->Id());
+      if (obstacle_projection == nullptr) {
+        continue;
+      }
+      const auto& projection_point = obstacle_projection->point;
       if (vehicle_projection_point.s() >= projection_point.s()) {
         continue;
       }
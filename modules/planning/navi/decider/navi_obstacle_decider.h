@@ -31,6 +31,7 @@
 #include "modules/common/proto/pnc_point.pb.h"
 #include "modules/planning/common/frame.h"
 #include "modules/planning/common/obstacle.h"
+#include "modules/planning/navi/decider/navi_clearance_profile.h"
 #include "modules/planning/navi/decider/navi_task.h"
 
 /**
@@ -107,26 +108,14 @@ class NaviObstacleDecider : public NaviTask {
                        const double min_lane_width,
                        const common::VehicleState &vehicle_state);
 
-  /**
-   * @brief According to the relation between the obstacle and the path data,
-   * the sign is added to the distance away from the path data.Take positive on
-   * the left and negative on the right
-   */
-  void AddObstacleOffsetDirection(
-      const common::PathPoint &projection_point,
-      const std::vector<common::PathPoint> &path_data_points,
-      const Obstacle *current_obstacle, const double proj_len, double *dist);
-
   /**
    * @brief Remove safe obstacles
    * @return whether filter the obstacle
    */
-  bool IsNeedFilterObstacle(
-      const Obstacle *current_obstacle,
-      const common::PathPoint &vehicle_projection_point,
-      const std::vector<common::PathPoint> &path_data_points,
-      const common::VehicleState &vehicle_state,
-      common::PathPoint *projection_point_ptr);
+  bool IsNeedFilterObstacle(const Obstacle *current_obstacle,
+                            const common::PathPoint &vehicle_projection_point,
+                            const common::PathPoint &projection_point,
+                            const common::VehicleState &vehicle_state);
 
   /**
    * @brief Get the minimum path width
@@ -158,6 +147,7 @@ class NaviObstacleDecider : public NaviTask {
 
  private:
   NaviObstacleDeciderConfig config_;
+  NaviClearanceProfile clearance_profile_;
   std::map<double, double> obstacle_lat_dist_;
   std::vector<std::tuple<std::string, double, double>> unsafe_obstacle_info_;
   double last_nudge_dist_ = 0.0;
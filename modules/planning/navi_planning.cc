@@ -260,9 +260,9 @@ void NaviPlanning::RunOnce(const LocalView& local_view,
     ProcessPadMsg(pad_msg_driving_action);
   }
 
+  TrafficDecider traffic_decider;
+  traffic_decider.Init(traffic_rule_configs_);
   for (auto& ref_line_info : *frame_->mutable_reference_line_info()) {
-    TrafficDecider traffic_decider;
-    traffic_decider.Init(traffic_rule_configs_);
     auto traffic_status =
         traffic_decider.Execute(frame_.get(), &ref_line_info, injector_);
     if (!traffic_status.ok() || !ref_line_info.IsDrivable()) {
@@ -291,7 +291,9 @@ void NaviPlanning::RunOnce(const LocalView& local_view,
   if (!status.ok()) {
     status.Save(trajectory_pb->mutable_header()->mutable_status());
     AERROR << "Planning failed:" << status.ToString();
-    if (FLAGS_publish_estop) {
+    if (GenerateFallbackTrajectoryFromCache(start_timestamp, trajectory_pb)) {
+      AWARN << "Planning overran, published the cached fallback trajectory.";
+    } else if (FLAGS_publish_estop) {
       AERROR << "Planning failed and set estop";
       // Because the function "Control::ProduceControlCommand()" checks the
       // "estop" signal with the following line (Line 170 in control.cc):
@@ -564,6 +566,8 @@ Status NaviPlanning::Plan(
 
   last_publishable_trajectory_->PopulateTrajectoryProtobuf(trajectory_pb);
 
+  CacheFallbackTrajectory(*last_publishable_trajectory_);
+
   best_ref_info->ExportEngageAdvice(trajectory_pb->mutable_engage_advice(),
                                     injector_->planning_context());
 
@@ -30,6 +30,7 @@
 #include "modules/common/vehicle_state/vehicle_state_provider.h"
 #include "modules/map/hdmap/hdmap_util.h"
 #include "modules/planning/common/ego_info.h"
+#include "modules/planning/common/frame_buffer_pool.h"
 #include "modules/planning/common/history.h"
 #include "modules/planning/common/planning_context.h"
 #include "modules/planning/common/planning_gflags.h"
@@ -334,12 +335,13 @@ void OnLanePlanning::RunOnce(const LocalView& local_view,
     frame_->set_current_frame_planned_trajectory(*ptr_trajectory_pb);
     const uint32_t n = frame_->SequenceNum();
     injector_->frame_history()->Add(n, std::move(frame_));
+    FrameBufferPool::Instance()->ReleaseTrajectoryBuffer(&stitching_trajectory);
     return;
   }
 
+  TrafficDecider traffic_decider;
+  traffic_decider.Init(traffic_rule_configs_);
   for (auto& ref_line_info : *frame_->mutable_reference_line_info()) {
-    TrafficDecider traffic_decider;
-    traffic_decider.Init(traffic_rule_configs_);
     auto traffic_status =
         traffic_decider.Execute(frame_.get(), &ref_line_info, injector_);
     if (!traffic_status.ok() || !ref_line_info.IsDrivable()) {
@@ -369,7 +371,10 @@ void OnLanePlanning::RunOnce(const LocalView& local_view,
   if (!status.ok()) {
     status.Save(ptr_trajectory_pb->mutable_header()->mutable_status());
     AERROR << "Planning failed:" << status.ToString();
-    if (FLAGS_publish_estop) {
+    if (GenerateFallbackTrajectoryFromCache(start_timestamp,
+                                            ptr_trajectory_pb)) {
+      AWARN << "Planning overran, published the cached fallback trajectory.";
+    } else if (FLAGS_publish_estop) {
       AERROR << "Planning failed and set estop";
       // "estop" signal check in function "Control::ProduceControlCommand()"
       // estop_ = estop_ || local_view_.trajectory.estop().is_estop();
@@ -384,6 +389,9 @@ void OnLanePlanning::RunOnce(const LocalView& local_view,
   if (ptr_trajectory_pb->is_replan()) {
     ptr_trajectory_pb->set_replan_reason(replan_reason);
   }
+  // The stitching buffer is no longer read below; recycle it for the next
+  // cycle.
+  FrameBufferPool::Instance()->ReleaseTrajectoryBuffer(&stitching_trajectory);
 
   if (frame_->open_space_info().is_on_open_space_trajectory()) {
     FillPlanningPb(start_timestamp, ptr_trajectory_pb);
@@ -636,6 +644,8 @@ Status OnLanePlanning::Plan(
 
     last_publishable_trajectory_->PopulateTrajectoryProtobuf(ptr_trajectory_pb);
 
+    CacheFallbackTrajectory(*last_publishable_trajectory_);
+
     best_ref_info->ExportEngageAdvice(
         ptr_trajectory_pb->mutable_engage_advice(),
         injector_->planning_context());
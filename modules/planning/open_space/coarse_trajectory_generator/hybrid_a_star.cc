@@ -20,6 +20,9 @@
 
 #include "modules/planning/open_space/coarse_trajectory_generator/hybrid_a_star.h"
 
+#include <future>
+
+#include "cyber/task/task.h"
 #include "modules/planning/math/piecewise_jerk/piecewise_jerk_speed_problem.h"
 
 namespace apollo {
@@ -109,6 +112,18 @@ bool HybridAStar::ValidityCheck(std::shared_ptr<Node3d> node) {
         traversed_y[i] > XYbounds_[3] || traversed_y[i] < XYbounds_[2]) {
       return false;
     }
+    // the distance field settles most poses with a few lookups; only poses
+    // within its margin of an obstacle need the exact segment test
+    if (occupancy_grid_valid_) {
+      const auto grid_check = occupancy_grid_.CheckPose(
+          traversed_x[i], traversed_y[i], traversed_phi[i]);
+      if (grid_check == OpenSpaceOccupancyGrid::CheckResult::FREE) {
+        continue;
+      }
+      if (grid_check == OpenSpaceOccupancyGrid::CheckResult::COLLISION) {
+        return false;
+      }
+    }
     Box2d bounding_box = Node3d::GetBoundingBox(
         vehicle_param_, traversed_x[i], traversed_y[i], traversed_phi[i]);
     for (const auto& obstacle_linesegments : obstacles_linesegments_vec_) {
@@ -659,6 +674,9 @@ bool HybridAStar::Plan(
 
   // load XYbounds
   XYbounds_ = XYbounds;
+  // rasterize the obstacles once per episode for fast collision queries
+  occupancy_grid_valid_ = occupancy_grid_.Init(vehicle_param_, XYbounds_,
+                                               obstacles_linesegments_vec_);
   // load nodes and obstacles
   start_node_.reset(
       new Node3d({sx}, {sy}, {sphi}, XYbounds_, planner_open_space_config_));
@@ -685,6 +703,7 @@ bool HybridAStar::Plan(
   double astar_start_time = Clock::NowInSeconds();
   double heuristic_time = 0.0;
   double rs_time = 0.0;
+  size_t expanded_node_num = 0;
   while (!open_pq_.empty()) {
     // take out the lowest cost neighboring node
     const std::string current_id = open_pq_.top().first;
@@ -692,14 +711,30 @@ bool HybridAStar::Plan(
     std::shared_ptr<Node3d> current_node = open_set_[current_id];
     // check if an analystic curve could be connected from current
     // configuration to the end configuration without collision. if so, search
-    // ends.
-    const double rs_start_time = Clock::NowInSeconds();
-    if (AnalyticExpansion(current_node)) {
-      break;
+    // ends. Far from the goal the shot almost never succeeds, so it is only
+    // attempted every N expansions, with N shrinking to one as the holonomic
+    // heuristic distance to the goal approaches zero.
+    const double distance_to_goal = grid_a_star_heuristic_generator_->CheckDpMap(
+        current_node->GetX(), current_node->GetY());
+    const size_t rs_shot_interval = std::max(
+        static_cast<size_t>(1),
+        static_cast<size_t>(distance_to_goal / (4.0 * step_size_)));
+    if (expanded_node_num % rs_shot_interval == 0) {
+      const double rs_start_time = Clock::NowInSeconds();
+      const bool reached = AnalyticExpansion(current_node);
+      const double rs_end_time = Clock::NowInSeconds();
+      rs_time += rs_end_time - rs_start_time;
+      if (reached) {
+        break;
+      }
     }
-    const double rs_end_time = Clock::NowInSeconds();
-    rs_time += rs_end_time - rs_start_time;
+    expanded_node_num++;
     close_set_.emplace(current_node->GetIndex(), current_node);
+
+    // generate successors; only nodes neither closed nor already open need a
+    // collision check, and those checks are independent of each other
+    std::vector<std::shared_ptr<Node3d>> next_nodes;
+    next_nodes.reserve(next_node_num_);
     for (size_t i = 0; i < next_node_num_; ++i) {
       std::shared_ptr<Node3d> next_node = Next_node_generator(current_node, i);
       // boundary check failure handle
@@ -710,19 +745,42 @@ bool HybridAStar::Plan(
       if (close_set_.find(next_node->GetIndex()) != close_set_.end()) {
         continue;
       }
-      // collision check
-      if (!ValidityCheck(next_node)) {
+      if (open_set_.find(next_node->GetIndex()) != open_set_.end()) {
         continue;
       }
-      if (open_set_.find(next_node->GetIndex()) == open_set_.end()) {
-        explored_node_num++;
-        const double start_time = Clock::NowInSeconds();
-        CalculateNodeCost(current_node, next_node);
-        const double end_time = Clock::NowInSeconds();
-        heuristic_time += end_time - start_time;
-        open_set_.emplace(next_node->GetIndex(), next_node);
-        open_pq_.emplace(next_node->GetIndex(), next_node->GetCost());
+      next_nodes.emplace_back(std::move(next_node));
+    }
+
+    // collision check
+    std::vector<bool> is_valid(next_nodes.size(), false);
+    if (FLAGS_enable_parallel_hybrid_a) {
+      std::vector<std::future<bool>> results;
+      results.reserve(next_nodes.size());
+      for (const auto& next_node : next_nodes) {
+        results.emplace_back(
+            cyber::Async(&HybridAStar::ValidityCheck, this, next_node));
+      }
+      for (size_t i = 0; i < results.size(); ++i) {
+        is_valid[i] = results[i].get();
+      }
+    } else {
+      for (size_t i = 0; i < next_nodes.size(); ++i) {
+        is_valid[i] = ValidityCheck(next_nodes[i]);
+      }
+    }
+
+    for (size_t i = 0; i < next_nodes.size(); ++i) {
+      if (!is_valid[i]) {
+        continue;
       }
+      const auto& next_node = next_nodes[i];
+      explored_node_num++;
+      const double start_time = Clock::NowInSeconds();
+      CalculateNodeCost(current_node, next_node);
+      const double end_time = Clock::NowInSeconds();
+      heuristic_time += end_time - start_time;
+      open_set_.emplace(next_node->GetIndex(), next_node);
+      open_pq_.emplace(next_node->GetIndex(), next_node->GetCost());
     }
   }
   if (final_node_ == nullptr) {
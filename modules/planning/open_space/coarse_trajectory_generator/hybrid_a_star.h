@@ -38,6 +38,7 @@
 #include "modules/planning/common/planning_gflags.h"
 #include "modules/planning/open_space/coarse_trajectory_generator/grid_search.h"
 #include "modules/planning/open_space/coarse_trajectory_generator/node3d.h"
+#include "modules/planning/open_space/coarse_trajectory_generator/open_space_occupancy_grid.h"
 #include "modules/planning/open_space/coarse_trajectory_generator/reeds_shepp_path.h"
 #include "modules/planning/proto/planner_open_space_config.pb.h"
 
@@ -113,6 +114,8 @@ class HybridAStar {
   std::shared_ptr<Node3d> final_node_;
   std::vector<std::vector<common::math::LineSegment2d>>
       obstacles_linesegments_vec_;
+  OpenSpaceOccupancyGrid occupancy_grid_;
+  bool occupancy_grid_valid_ = false;
 
   struct cmp {
     bool operator()(const std::pair<std::string, double>& left,
@@ -0,0 +1,195 @@
+/******************************************************************************
+ * Copyright 2020 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+/*
+ * @file
+ */
+
+#include "modules/planning/open_space/coarse_trajectory_generator/open_space_occupancy_grid.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "cyber/common/log.h"
+
+namespace apollo {
+namespace planning {
+
+namespace {
+constexpr double kGridResolution = 0.1;
+// an episode larger than this falls back to exact checks entirely
+constexpr int kMaxGridCellNum = 16 * 1024 * 1024;
+constexpr float kUnreachedDistance = std::numeric_limits<float>::max();
+}  // namespace
+
+bool OpenSpaceOccupancyGrid::Init(
+    const common::VehicleParam& vehicle_param,
+    const std::vector<double>& XYbounds,
+    const std::vector<std::vector<common::math::LineSegment2d>>&
+        obstacles_linesegments_vec) {
+  CHECK_EQ(XYbounds.size(), 4U);
+  resolution_ = kGridResolution;
+  min_x_ = XYbounds[0];
+  min_y_ = XYbounds[2];
+  size_x_ =
+      static_cast<int>(std::ceil((XYbounds[1] - XYbounds[0]) / resolution_)) +
+      1;
+  size_y_ =
+      static_cast<int>(std::ceil((XYbounds[3] - XYbounds[2]) / resolution_)) +
+      1;
+  if (size_x_ <= 0 || size_y_ <= 0 ||
+      static_cast<int64_t>(size_x_) * size_y_ > kMaxGridCellNum) {
+    AWARN << "XY bounds too large for occupancy grid: " << size_x_ << " x "
+          << size_y_;
+    return false;
+  }
+
+  // Cover the vehicle box by circles along the longitudinal axis. The node
+  // {x, y} is the rear axle center; offsets are measured from it.
+  const double length = vehicle_param.length();
+  const double width = vehicle_param.width();
+  const double shift_distance =
+      length / 2.0 - vehicle_param.back_edge_to_center();
+  const int circle_num =
+      std::max(1, static_cast<int>(std::ceil(length / width)));
+  const double spacing = length / static_cast<double>(circle_num);
+  circle_radius_ = std::hypot(spacing / 2.0, width / 2.0);
+  inscribed_radius_ = std::min(spacing, width) / 2.0;
+  circle_center_offsets_.clear();
+  for (int i = 0; i < circle_num; ++i) {
+    circle_center_offsets_.push_back(
+        shift_distance - length / 2.0 + spacing / 2.0 +
+        static_cast<double>(i) * spacing);
+  }
+
+  // Rasterization samples every half cell and the chamfer transform is only
+  // an approximation of the Euclidean distance, so decisions within two cells
+  // of a boundary are delegated to the exact check.
+  margin_ = 2.0 * resolution_;
+
+  distance_field_.assign(static_cast<size_t>(size_x_) * size_y_,
+                         kUnreachedDistance);
+  RasterizeSegments(obstacles_linesegments_vec);
+  ComputeDistanceField();
+  return true;
+}
+
+void OpenSpaceOccupancyGrid::RasterizeSegments(
+    const std::vector<std::vector<common::math::LineSegment2d>>&
+        obstacles_linesegments_vec) {
+  const double sample_step = resolution_ / 2.0;
+  for (const auto& obstacle_linesegments : obstacles_linesegments_vec) {
+    for (const auto& linesegment : obstacle_linesegments) {
+      const int sample_num =
+          static_cast<int>(linesegment.length() / sample_step) + 1;
+      for (int i = 0; i <= sample_num; ++i) {
+        const double ratio =
+            static_cast<double>(i) / static_cast<double>(sample_num);
+        const double x =
+            linesegment.start().x() +
+            ratio * (linesegment.end().x() - linesegment.start().x());
+        const double y =
+            linesegment.start().y() +
+            ratio * (linesegment.end().y() - linesegment.start().y());
+        const int ix = static_cast<int>((x - min_x_) / resolution_ + 0.5);
+        const int iy = static_cast<int>((y - min_y_) / resolution_ + 0.5);
+        if (ix < 0 || ix >= size_x_ || iy < 0 || iy >= size_y_) {
+          continue;
+        }
+        distance_field_[static_cast<size_t>(iy) * size_x_ + ix] = 0.0f;
+      }
+    }
+  }
+}
+
+void OpenSpaceOccupancyGrid::ComputeDistanceField() {
+  // Two-pass chamfer distance transform with an 8-neighborhood.
+  const float straight = static_cast<float>(resolution_);
+  const float diagonal = static_cast<float>(resolution_ * M_SQRT2);
+  auto at = [this](int ix, int iy) -> float& {
+    return distance_field_[static_cast<size_t>(iy) * size_x_ + ix];
+  };
+  for (int iy = 0; iy < size_y_; ++iy) {
+    for (int ix = 0; ix < size_x_; ++ix) {
+      float& d = at(ix, iy);
+      if (ix > 0) {
+        d = std::min(d, at(ix - 1, iy) + straight);
+      }
+      if (iy > 0) {
+        d = std::min(d, at(ix, iy - 1) + straight);
+        if (ix > 0) {
+          d = std::min(d, at(ix - 1, iy - 1) + diagonal);
+        }
+        if (ix + 1 < size_x_) {
+          d = std::min(d, at(ix + 1, iy - 1) + diagonal);
+        }
+      }
+    }
+  }
+  for (int iy = size_y_ - 1; iy >= 0; --iy) {
+    for (int ix = size_x_ - 1; ix >= 0; --ix) {
+      float& d = at(ix, iy);
+      if (ix + 1 < size_x_) {
+        d = std::min(d, at(ix + 1, iy) + straight);
+      }
+      if (iy + 1 < size_y_) {
+        d = std::min(d, at(ix, iy + 1) + straight);
+        if (ix + 1 < size_x_) {
+          d = std::min(d, at(ix + 1, iy + 1) + diagonal);
+        }
+        if (ix > 0) {
+          d = std::min(d, at(ix - 1, iy + 1) + diagonal);
+        }
+      }
+    }
+  }
+}
+
+double OpenSpaceOccupancyGrid::DistanceAt(const double x,
+                                          const double y) const {
+  const int ix = static_cast<int>((x - min_x_) / resolution_ + 0.5);
+  const int iy = static_cast<int>((y - min_y_) / resolution_ + 0.5);
+  if (ix < 0 || ix >= size_x_ || iy < 0 || iy >= size_y_) {
+    return -1.0;
+  }
+  return static_cast<double>(
+      distance_field_[static_cast<size_t>(iy) * size_x_ + ix]);
+}
+
+OpenSpaceOccupancyGrid::CheckResult OpenSpaceOccupancyGrid::CheckPose(
+    const double x, const double y, const double phi) const {
+  const double cos_phi = std::cos(phi);
+  const double sin_phi = std::sin(phi);
+  bool all_clear = true;
+  for (const double offset : circle_center_offsets_) {
+    const double distance =
+        DistanceAt(x + offset * cos_phi, y + offset * sin_phi);
+    if (distance < 0.0) {
+      return CheckResult::UNKNOWN;
+    }
+    if (distance < inscribed_radius_ - margin_) {
+      return CheckResult::COLLISION;
+    }
+    if (distance < circle_radius_ + margin_) {
+      all_clear = false;
+    }
+  }
+  return all_clear ? CheckResult::FREE : CheckResult::UNKNOWN;
+}
+
+}  // namespace planning
+}  // namespace apollo
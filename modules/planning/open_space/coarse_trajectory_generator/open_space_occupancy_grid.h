@@ -0,0 +1,78 @@
+/******************************************************************************
+ * Copyright 2020 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+/*
+ * @file
+ */
+
+#pragma once
+
+#include <vector>
+
+#include "modules/common/configs/proto/vehicle_config.pb.h"
+#include "modules/common/math/line_segment2d.h"
+
+namespace apollo {
+namespace planning {
+
+/*
+ * @brief Rasterized obstacle distance field for open space collision checks.
+ * Built once per planning episode from the obstacle line segments, it answers
+ * most vehicle-pose queries with a few grid lookups: the vehicle footprint is
+ * covered by circles along its axis, and a pose is reported free when every
+ * circle clears the nearest obstacle, or colliding when an obstacle lies
+ * strictly inside a circle inscribed in the footprint. Poses whose clearance
+ * falls inside the rasterization margin return UNKNOWN and must be resolved
+ * by the exact segment test.
+ */
+class OpenSpaceOccupancyGrid {
+ public:
+  enum class CheckResult { FREE, COLLISION, UNKNOWN };
+
+  OpenSpaceOccupancyGrid() = default;
+
+  bool Init(const common::VehicleParam& vehicle_param,
+            const std::vector<double>& XYbounds,
+            const std::vector<std::vector<common::math::LineSegment2d>>&
+                obstacles_linesegments_vec);
+
+  CheckResult CheckPose(const double x, const double y, const double phi) const;
+
+ private:
+  void RasterizeSegments(
+      const std::vector<std::vector<common::math::LineSegment2d>>&
+          obstacles_linesegments_vec);
+  void ComputeDistanceField();
+  double DistanceAt(const double x, const double y) const;
+
+  double min_x_ = 0.0;
+  double min_y_ = 0.0;
+  double resolution_ = 0.1;
+  int size_x_ = 0;
+  int size_y_ = 0;
+  // distance from each cell center to the nearest obstacle cell, in meters
+  std::vector<float> distance_field_;
+
+  // vehicle footprint covered by circles along the longitudinal axis
+  double circle_radius_ = 0.0;
+  double inscribed_radius_ = 0.0;
+  std::vector<double> circle_center_offsets_;
+  // rasterization error bound, half a cell diagonal
+  double margin_ = 0.0;
+};
+
+}  // namespace planning
+}  // namespace apollo
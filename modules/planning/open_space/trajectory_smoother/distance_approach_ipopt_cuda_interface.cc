@@ -2603,62 +2603,9 @@ bool DistanceApproachIPOPTCUDAInterface::eval_constraints(int n, const T* x,
 
   // 4. Three obstacles related equal constraints, one equality constraints,
   // [0, horizon_] * [0, obstacles_num_-1] * 4
-  state_index = state_start_index_;
-  int l_index = l_start_index_;
-  int n_index = n_start_index_;
-
-  for (int i = 0; i < horizon_ + 1; ++i) {
-    int edges_counter = 0;
-    for (int j = 0; j < obstacles_num_; ++j) {
-      int current_edges_num = obstacles_edges_num_(j, 0);
-      Eigen::MatrixXd Aj =
-          obstacles_A_.block(edges_counter, 0, current_edges_num, 2);
-      Eigen::MatrixXd bj =
-          obstacles_b_.block(edges_counter, 0, current_edges_num, 1);
-
-      // norm(A* lambda) <= 1
-      T tmp1 = 0.0;
-      T tmp2 = 0.0;
-      for (int k = 0; k < current_edges_num; ++k) {
-        // TODO(QiL) : replace this one directly with x
-        tmp1 += Aj(k, 0) * x[l_index + k];
-        tmp2 += Aj(k, 1) * x[l_index + k];
-      }
-      g[constraint_index] = tmp1 * tmp1 + tmp2 * tmp2;
-
-      // G' * mu + R' * lambda == 0
-      g[constraint_index + 1] = x[n_index] - x[n_index + 2] +
-                                cos(x[state_index + 2]) * tmp1 +
-                                sin(x[state_index + 2]) * tmp2;
-
-      g[constraint_index + 2] = x[n_index + 1] - x[n_index + 3] -
-                                sin(x[state_index + 2]) * tmp1 +
-                                cos(x[state_index + 2]) * tmp2;
+  eval_obstacle_constraints(x, constraint_index, g);
+  constraint_index += 4 * obstacles_num_ * (horizon_ + 1);
 
-      //  -g'*mu + (A*t - b)*lambda > 0
-      T tmp3 = 0.0;
-      for (int k = 0; k < 4; ++k) {
-        tmp3 += -g_[k] * x[n_index + k];
-      }
-
-      T tmp4 = 0.0;
-      for (int k = 0; k < current_edges_num; ++k) {
-        tmp4 += bj(k, 0) * x[l_index + k];
-      }
-
-      g[constraint_index + 3] =
-          tmp3 + (x[state_index] + cos(x[state_index + 2]) * offset_) * tmp1 +
-          (x[state_index + 1] + sin(x[state_index + 2]) * offset_) * tmp2 -
-          tmp4;
-
-      // Update index
-      edges_counter += current_edges_num;
-      l_index += current_edges_num;
-      n_index += 4;
-      constraint_index += 4;
-    }
-    state_index += 4;
-  }
   ADEBUG << "constraint_index after obstacles avoidance constraints "
             "updated: "
          << constraint_index;
@@ -2667,8 +2614,8 @@ bool DistanceApproachIPOPTCUDAInterface::eval_constraints(int n, const T* x,
   state_index = state_start_index_;
   control_index = control_start_index_;
   time_index = time_start_index_;
-  l_index = l_start_index_;
-  n_index = n_start_index_;
+  int l_index = l_start_index_;
+  int n_index = n_start_index_;
 
   // start configuration
   g[constraint_index] = x[state_index];
@@ -2723,6 +2670,87 @@ bool DistanceApproachIPOPTCUDAInterface::eval_constraints(int n, const T* x,
   return true;
 }
 
+template <class T>
+bool DistanceApproachIPOPTCUDAInterface::eval_obstacle_constraints(
+    const T* x, int constraint_index, T* g) {
+  int state_index = state_start_index_;
+  int l_index = l_start_index_;
+  int n_index = n_start_index_;
+
+  for (int i = 0; i < horizon_ + 1; ++i) {
+    int edges_counter = 0;
+    for (int j = 0; j < obstacles_num_; ++j) {
+      int current_edges_num = obstacles_edges_num_(j, 0);
+      Eigen::MatrixXd Aj =
+          obstacles_A_.block(edges_counter, 0, current_edges_num, 2);
+      Eigen::MatrixXd bj =
+          obstacles_b_.block(edges_counter, 0, current_edges_num, 1);
+
+      // norm(A* lambda) <= 1
+      T tmp1 = 0.0;
+      T tmp2 = 0.0;
+      for (int k = 0; k < current_edges_num; ++k) {
+        // TODO(QiL) : replace this one directly with x
+        tmp1 += Aj(k, 0) * x[l_index + k];
+        tmp2 += Aj(k, 1) * x[l_index + k];
+      }
+      g[constraint_index] = tmp1 * tmp1 + tmp2 * tmp2;
+
+      // G' * mu + R' * lambda == 0
+      g[constraint_index + 1] = x[n_index] - x[n_index + 2] +
+                                cos(x[state_index + 2]) * tmp1 +
+                                sin(x[state_index + 2]) * tmp2;
+
+      g[constraint_index + 2] = x[n_index + 1] - x[n_index + 3] -
+                                sin(x[state_index + 2]) * tmp1 +
+                                cos(x[state_index + 2]) * tmp2;
+
+      //  -g'*mu + (A*t - b)*lambda > 0
+      T tmp3 = 0.0;
+      for (int k = 0; k < 4; ++k) {
+        tmp3 += -g_[k] * x[n_index + k];
+      }
+
+      T tmp4 = 0.0;
+      for (int k = 0; k < current_edges_num; ++k) {
+        tmp4 += bj(k, 0) * x[l_index + k];
+      }
+
+      g[constraint_index + 3] =
+          tmp3 + (x[state_index] + cos(x[state_index + 2]) * offset_) * tmp1 +
+          (x[state_index + 1] + sin(x[state_index + 2]) * offset_) * tmp2 -
+          tmp4;
+
+      // Update index
+      edges_counter += current_edges_num;
+      l_index += current_edges_num;
+      n_index += 4;
+      constraint_index += 4;
+    }
+    state_index += 4;
+  }
+
+  return true;
+}
+
+bool DistanceApproachIPOPTCUDAInterface::eval_obstacle_constraints(
+    const double* x, int constraint_index, double* g) {
+#ifdef USE_GPU
+  if (obstacles_edges_num_.maxCoeff() <= MAX_OBSTACLE_EDGES) {
+    if (obstacle_constraint_eval(
+            horizon_, obstacles_num_, obstacles_edges_sum_, offset_,
+            obstacles_edges_num_.data(), obstacles_A_.data(),
+            obstacles_b_.data(), g_.data(), x + state_start_index_,
+            x + l_start_index_, x + n_start_index_, g + constraint_index)) {
+      return true;
+    }
+    AWARN << "GPU batched obstacle constraint evaluation failed, "
+             "falling back to CPU.";
+  }
+#endif
+  return eval_obstacle_constraints<double>(x, constraint_index, g);
+}
+
 bool DistanceApproachIPOPTCUDAInterface::check_g(int n, const double* x, int m,
                                                  const double* g) {
   int kN = n;
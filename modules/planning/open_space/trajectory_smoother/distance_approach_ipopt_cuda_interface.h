@@ -139,6 +139,17 @@ class DistanceApproachIPOPTCUDAInterface : public DistanceApproachInterface {
   template <class T>
   bool eval_constraints(int n, const T* x, int m, T* g);
 
+  /** Template to compute the obstacle avoidance constraints, four per
+   * (time step, obstacle) pair */
+  template <class T>
+  bool eval_obstacle_constraints(const T* x, int constraint_index, T* g);
+
+  /** Overload of the obstacle avoidance constraints for plain doubles;
+   * evaluates all (time step, obstacle) pairs in one batch on the GPU and
+   * falls back to the templated loop when the batch fails */
+  bool eval_obstacle_constraints(const double* x, int constraint_index,
+                                 double* g);
+
   /** Method to generate the required tapes by ADOL-C*/
   void generate_tapes(int n, int m, int* nnz_h_lag);
   //***************    end   ADOL-C part ***********************************
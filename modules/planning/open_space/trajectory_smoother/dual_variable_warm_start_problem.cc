@@ -26,9 +26,85 @@
 #include "modules/common/time/time.h"
 #include "modules/planning/common/planning_gflags.h"
 
+#ifdef USE_GPU
+#include <vector>
+
+#include "modules/planning/open_space/trajectory_smoother/planning_block.h"
+#endif
+
 namespace apollo {
 namespace planning {
 
+#ifdef USE_GPU
+namespace {
+
+// Solves every (time step, obstacle) dual sub-problem in one kernel launch.
+// Returns false when an obstacle has too many edges for the kernel or when
+// any sub-problem misses the feasibility tolerance, in which case the
+// caller falls back to the configured QP solver.
+bool SolveGpuWarmStart(const size_t horizon, const Eigen::MatrixXd& ego,
+                       const size_t obstacles_num,
+                       const Eigen::MatrixXi& obstacles_edges_num,
+                       const Eigen::MatrixXd& obstacles_A,
+                       const Eigen::MatrixXd& obstacles_b,
+                       const Eigen::MatrixXd& xWS,
+                       const double min_safety_distance,
+                       Eigen::MatrixXd* l_warm_up,
+                       Eigen::MatrixXd* n_warm_up) {
+  const int horizon_int = static_cast<int>(horizon);
+  const int obstacles_num_int = static_cast<int>(obstacles_num);
+  const int obstacles_edges_sum = obstacles_edges_num.sum();
+  if (obstacles_edges_num.maxCoeff() > MAX_OBSTACLE_EDGES) {
+    return false;
+  }
+
+  const double w_ev = ego(1, 0) + ego(3, 0);
+  const double l_ev = ego(0, 0) + ego(2, 0);
+  const std::vector<double> shape_g = {l_ev / 2, w_ev / 2, l_ev / 2,
+                                       w_ev / 2};
+  const double offset = (ego(0, 0) + ego(2, 0)) / 2 - ego(2, 0);
+
+  std::vector<double> pose(3 * (horizon_int + 1), 0.0);
+  for (int i = 0; i < horizon_int + 1; ++i) {
+    pose[3 * i] = xWS(0, i);
+    pose[3 * i + 1] = xWS(1, i);
+    pose[3 * i + 2] = xWS(2, i);
+  }
+
+  std::vector<double> A_flat(2 * obstacles_edges_sum, 0.0);
+  std::vector<double> b_flat(obstacles_edges_sum, 0.0);
+  for (int k = 0; k < obstacles_edges_sum; ++k) {
+    A_flat[k] = obstacles_A(k, 0);
+    A_flat[obstacles_edges_sum + k] = obstacles_A(k, 1);
+    b_flat[k] = obstacles_b(k, 0);
+  }
+
+  std::vector<double> l_result(obstacles_edges_sum * (horizon_int + 1), 0.0);
+  std::vector<double> n_result(4 * obstacles_num_int * (horizon_int + 1),
+                               0.0);
+
+  if (!dual_variable_warm_start(
+          horizon_int, obstacles_num_int, obstacles_edges_sum,
+          min_safety_distance, offset, obstacles_edges_num.data(),
+          A_flat.data(), b_flat.data(), pose.data(), shape_g.data(),
+          l_result.data(), n_result.data())) {
+    return false;
+  }
+
+  for (int i = 0; i < horizon_int + 1; ++i) {
+    for (int j = 0; j < obstacles_edges_sum; ++j) {
+      (*l_warm_up)(j, i) = l_result[i * obstacles_edges_sum + j];
+    }
+    for (int j = 0; j < 4 * obstacles_num_int; ++j) {
+      (*n_warm_up)(j, i) = n_result[i * 4 * obstacles_num_int + j];
+    }
+  }
+  return true;
+}
+
+}  // namespace
+#endif
+
 DualVariableWarmStartProblem::DualVariableWarmStartProblem(
     const PlannerOpenSpaceConfig& planner_open_space_config) {
   planner_open_space_config_ = planner_open_space_config;
@@ -43,6 +119,36 @@ bool DualVariableWarmStartProblem::Solve(
   auto t_start = cyber::Time::Now().ToSecond();
   bool solver_flag = false;
 
+#ifdef USE_GPU
+  const auto qp_format =
+      planner_open_space_config_.dual_variable_warm_start_config().qp_format();
+  if (qp_format == OSQP || qp_format == SLACKQP || qp_format == IPOPTQP ||
+      qp_format == IPOPT) {
+    if (SolveGpuWarmStart(horizon, ego, obstacles_num, obstacles_edges_num,
+                          obstacles_A, obstacles_b, xWS,
+                          planner_open_space_config_
+                              .dual_variable_warm_start_config()
+                              .min_safety_distance(),
+                          l_warm_up, n_warm_up)) {
+      if (qp_format == SLACKQP) {
+        // the GPU solution satisfies the constraints without slack
+        for (int r = 0; r < s_warm_up->rows(); ++r) {
+          for (int c = 0; c < s_warm_up->cols(); ++c) {
+            (*s_warm_up)(r, c) = 0.0;
+          }
+        }
+      }
+
+      auto t_end = cyber::Time::Now().ToSecond();
+      ADEBUG << "Dual variable warm start solving time in second : "
+             << t_end - t_start;
+      return true;
+    }
+    AWARN << "GPU dual variable warm start failed, "
+             "falling back to the QP solver.";
+  }
+#endif
+
   if (planner_open_space_config_.dual_variable_warm_start_config()
           .qp_format() == OSQP) {
     DualVariableWarmStartOSQPInterface ptop =
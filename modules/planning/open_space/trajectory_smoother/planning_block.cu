@@ -15,6 +15,7 @@
  *****************************************************************************/
 
 #include <iostream>
+#include <vector>
 
 #include "planning_block.h"
 
@@ -48,6 +49,196 @@ __global__ void data_transfer_gpu(T *dst, const T *src, const int size) {
   }
 }
 
+__global__ void dual_variable_warm_start_gpu(
+    const int num_sub_problems, const int obstacles_num,
+    const int obstacles_edges_sum, const double min_safety_distance,
+    const double offset, const int *obstacles_edges_num,
+    const int *obstacles_edges_offset, const double *obstacles_A,
+    const double *obstacles_b, const double *pose, const double *shape_g,
+    double *l_warm_up, double *n_warm_up, int *sub_problem_status) {
+  int idx = blockIdx.x * blockDim.x + threadIdx.x;
+
+  if (idx >= num_sub_problems) {
+    return;
+  }
+
+  int i = idx / obstacles_num;
+  int j = idx % obstacles_num;
+  int edges_num = obstacles_edges_num[j];
+  int edges_offset = obstacles_edges_offset[j];
+
+  if (edges_num > MAX_OBSTACLE_EDGES) {
+    sub_problem_status[idx] = 0;
+    return;
+  }
+
+  double cos_phi = cos(pose[3 * i + 2]);
+  double sin_phi = sin(pose[3 * i + 2]);
+  double trans_x = pose[3 * i] + cos_phi * offset;
+  double trans_y = pose[3 * i + 1] + sin_phi * offset;
+
+  double lambda[MAX_OBSTACLE_EDGES];
+  double miu[4];
+  for (int k = 0; k < edges_num; ++k) {
+    lambda[k] = 0.0;
+  }
+  for (int k = 0; k < 4; ++k) {
+    miu[k] = 0.0;
+  }
+
+  // Projected gradient descent on the penalized sub-problem
+  //   min norm(A' * lambda) s.t. G' * mu + R' * A' * lambda == 0,
+  //   -g' * mu + (A * t - b)' * lambda >= d_min, lambda >= 0, mu >= 0.
+  // The penalty weight is tightened as the iterations proceed.
+  double rho = 1.0;
+  double tmp1 = 0.0;
+  double tmp2 = 0.0;
+  double res1 = 0.0;
+  double res2 = 0.0;
+  double viol = 0.0;
+
+  for (int iter = 0; iter < WARM_START_MAX_ITER; ++iter) {
+    if (iter > 0 && iter % 200 == 0) {
+      rho *= 10.0;
+    }
+
+    tmp1 = 0.0;
+    tmp2 = 0.0;
+    double dist = 0.0;
+    for (int k = 0; k < edges_num; ++k) {
+      tmp1 += obstacles_A[edges_offset + k] * lambda[k];
+      tmp2 += obstacles_A[obstacles_edges_sum + edges_offset + k] * lambda[k];
+      dist -= obstacles_b[edges_offset + k] * lambda[k];
+    }
+    res1 = miu[0] - miu[2] + cos_phi * tmp1 + sin_phi * tmp2;
+    res2 = miu[1] - miu[3] - sin_phi * tmp1 + cos_phi * tmp2;
+    dist += trans_x * tmp1 + trans_y * tmp2;
+    for (int k = 0; k < 4; ++k) {
+      dist -= shape_g[k] * miu[k];
+    }
+    viol = dist - min_safety_distance;
+    if (viol > 0.0) {
+      viol = 0.0;
+    }
+
+    double grad_lambda[MAX_OBSTACLE_EDGES];
+    double grad_miu[4];
+    for (int k = 0; k < edges_num; ++k) {
+      double a1 = obstacles_A[edges_offset + k];
+      double a2 = obstacles_A[obstacles_edges_sum + edges_offset + k];
+      grad_lambda[k] =
+          2.0 * (tmp1 * a1 + tmp2 * a2) +
+          2.0 * rho * res1 * (cos_phi * a1 + sin_phi * a2) +
+          2.0 * rho * res2 * (-sin_phi * a1 + cos_phi * a2) +
+          2.0 * rho * viol *
+              (trans_x * a1 + trans_y * a2 - obstacles_b[edges_offset + k]);
+    }
+    grad_miu[0] = 2.0 * rho * (res1 - viol * shape_g[0]);
+    grad_miu[1] = 2.0 * rho * (res2 - viol * shape_g[1]);
+    grad_miu[2] = 2.0 * rho * (-res1 - viol * shape_g[2]);
+    grad_miu[3] = 2.0 * rho * (-res2 - viol * shape_g[3]);
+
+    for (int k = 0; k < edges_num; ++k) {
+      lambda[k] -= WARM_START_STEP * grad_lambda[k];
+      if (lambda[k] < 0.0) {
+        lambda[k] = 0.0;
+      }
+    }
+    for (int k = 0; k < 4; ++k) {
+      miu[k] -= WARM_START_STEP * grad_miu[k];
+      if (miu[k] < 0.0) {
+        miu[k] = 0.0;
+      }
+    }
+  }
+
+  // Re-evaluate the residuals at the final iterate before accepting it.
+  tmp1 = 0.0;
+  tmp2 = 0.0;
+  double dist = 0.0;
+  for (int k = 0; k < edges_num; ++k) {
+    tmp1 += obstacles_A[edges_offset + k] * lambda[k];
+    tmp2 += obstacles_A[obstacles_edges_sum + edges_offset + k] * lambda[k];
+    dist -= obstacles_b[edges_offset + k] * lambda[k];
+  }
+  res1 = miu[0] - miu[2] + cos_phi * tmp1 + sin_phi * tmp2;
+  res2 = miu[1] - miu[3] - sin_phi * tmp1 + cos_phi * tmp2;
+  dist += trans_x * tmp1 + trans_y * tmp2;
+  for (int k = 0; k < 4; ++k) {
+    dist -= shape_g[k] * miu[k];
+  }
+  viol = dist - min_safety_distance;
+  if (viol > 0.0) {
+    viol = 0.0;
+  }
+
+  for (int k = 0; k < edges_num; ++k) {
+    l_warm_up[i * obstacles_edges_sum + edges_offset + k] = lambda[k];
+  }
+  for (int k = 0; k < 4; ++k) {
+    n_warm_up[(i * obstacles_num + j) * 4 + k] = miu[k];
+  }
+
+  sub_problem_status[idx] =
+      (fabs(res1) < WARM_START_TOL && fabs(res2) < WARM_START_TOL &&
+       viol > -WARM_START_TOL &&
+       tmp1 * tmp1 + tmp2 * tmp2 <= 1.0 + WARM_START_TOL)
+          ? 1
+          : 0;
+}
+
+__global__ void obstacle_constraint_eval_gpu(
+    const int num_sub_problems, const int obstacles_num,
+    const int obstacles_edges_sum, const double offset,
+    const int *obstacles_edges_num, const int *obstacles_edges_offset,
+    const double *obstacles_A, const double *obstacles_b,
+    const double *shape_g, const double *states, const double *l,
+    const double *n, double *constraints) {
+  int idx = blockIdx.x * blockDim.x + threadIdx.x;
+
+  if (idx >= num_sub_problems) {
+    return;
+  }
+
+  int i = idx / obstacles_num;
+  int j = idx % obstacles_num;
+  int edges_num = obstacles_edges_num[j];
+  int edges_offset = obstacles_edges_offset[j];
+  int l_index = i * obstacles_edges_sum + edges_offset;
+  int n_index = (i * obstacles_num + j) * 4;
+
+  double cos_phi = cos(states[4 * i + 2]);
+  double sin_phi = sin(states[4 * i + 2]);
+
+  // norm(A * lambda) <= 1
+  double tmp1 = 0.0;
+  double tmp2 = 0.0;
+  double tmp4 = 0.0;
+  for (int k = 0; k < edges_num; ++k) {
+    tmp1 += obstacles_A[edges_offset + k] * l[l_index + k];
+    tmp2 +=
+        obstacles_A[obstacles_edges_sum + edges_offset + k] * l[l_index + k];
+    tmp4 += obstacles_b[edges_offset + k] * l[l_index + k];
+  }
+  constraints[4 * idx] = tmp1 * tmp1 + tmp2 * tmp2;
+
+  // G' * mu + R' * lambda == 0
+  constraints[4 * idx + 1] =
+      n[n_index] - n[n_index + 2] + cos_phi * tmp1 + sin_phi * tmp2;
+  constraints[4 * idx + 2] =
+      n[n_index + 1] - n[n_index + 3] - sin_phi * tmp1 + cos_phi * tmp2;
+
+  // -g' * mu + (A * t - b) * lambda > 0
+  double tmp3 = 0.0;
+  for (int k = 0; k < 4; ++k) {
+    tmp3 += -shape_g[k] * n[n_index + k];
+  }
+  constraints[4 * idx + 3] = tmp3 +
+                             (states[4 * i] + cos_phi * offset) * tmp1 +
+                             (states[4 * i + 1] + sin_phi * offset) * tmp2 -
+                             tmp4;
+}
+
 bool fill_lower_left(int *iRow, int *jCol, unsigned int *rind_L,
                      unsigned int *cind_L, const int nnz_L) {
   if (!InitialCuda()) return false;
@@ -106,6 +297,160 @@ bool data_transfer(T *dst, const T *src, const int size) {
   return true;
 }
 
+bool dual_variable_warm_start(const int horizon, const int obstacles_num,
+                              const int obstacles_edges_sum,
+                              const double min_safety_distance,
+                              const double offset,
+                              const int *obstacles_edges_num,
+                              const double *obstacles_A,
+                              const double *obstacles_b, const double *pose,
+                              const double *shape_g, double *l_warm_up,
+                              double *n_warm_up) {
+  int num_sub_problems = (horizon + 1) * obstacles_num;
+  std::vector<int> obstacles_edges_offset(obstacles_num, 0);
+  for (int j = 0; j < obstacles_num; ++j) {
+    if (obstacles_edges_num[j] > MAX_OBSTACLE_EDGES) {
+      return false;
+    }
+    if (j > 0) {
+      obstacles_edges_offset[j] =
+          obstacles_edges_offset[j - 1] + obstacles_edges_num[j - 1];
+    }
+  }
+
+  if (!InitialCuda()) return false;
+  int *d_edges_num, *d_edges_offset, *d_status;
+  double *d_A, *d_b, *d_pose, *d_shape_g, *d_l, *d_n;
+
+  unsigned int l_size = obstacles_edges_sum * (horizon + 1);
+  unsigned int n_size = 4 * obstacles_num * (horizon + 1);
+  cudaMalloc((void **)&d_edges_num, obstacles_num * sizeof(int));
+  cudaMalloc((void **)&d_edges_offset, obstacles_num * sizeof(int));
+  cudaMalloc((void **)&d_status, num_sub_problems * sizeof(int));
+  cudaMalloc((void **)&d_A, 2 * obstacles_edges_sum * sizeof(double));
+  cudaMalloc((void **)&d_b, obstacles_edges_sum * sizeof(double));
+  cudaMalloc((void **)&d_pose, 3 * (horizon + 1) * sizeof(double));
+  cudaMalloc((void **)&d_shape_g, 4 * sizeof(double));
+  cudaMalloc((void **)&d_l, l_size * sizeof(double));
+  cudaMalloc((void **)&d_n, n_size * sizeof(double));
+
+  cudaMemcpy(d_edges_num, obstacles_edges_num, obstacles_num * sizeof(int),
+             cudaMemcpyHostToDevice);
+  cudaMemcpy(d_edges_offset, obstacles_edges_offset.data(),
+             obstacles_num * sizeof(int), cudaMemcpyHostToDevice);
+  cudaMemcpy(d_A, obstacles_A, 2 * obstacles_edges_sum * sizeof(double),
+             cudaMemcpyHostToDevice);
+  cudaMemcpy(d_b, obstacles_b, obstacles_edges_sum * sizeof(double),
+             cudaMemcpyHostToDevice);
+  cudaMemcpy(d_pose, pose, 3 * (horizon + 1) * sizeof(double),
+             cudaMemcpyHostToDevice);
+  cudaMemcpy(d_shape_g, shape_g, 4 * sizeof(double), cudaMemcpyHostToDevice);
+
+  dim3 block(BLOCK_1);
+  dim3 grid((num_sub_problems + block.x - 1) / block.x);
+
+  dual_variable_warm_start_gpu<<<grid, block>>>(
+      num_sub_problems, obstacles_num, obstacles_edges_sum,
+      min_safety_distance, offset, d_edges_num, d_edges_offset, d_A, d_b,
+      d_pose, d_shape_g, d_l, d_n, d_status);
+  cudaDeviceSynchronize();
+
+  std::vector<int> sub_problem_status(num_sub_problems, 0);
+  cudaMemcpy(l_warm_up, d_l, l_size * sizeof(double), cudaMemcpyDeviceToHost);
+  cudaMemcpy(n_warm_up, d_n, n_size * sizeof(double), cudaMemcpyDeviceToHost);
+  cudaMemcpy(sub_problem_status.data(), d_status,
+             num_sub_problems * sizeof(int), cudaMemcpyDeviceToHost);
+
+  cudaFree(d_edges_num);
+  cudaFree(d_edges_offset);
+  cudaFree(d_status);
+  cudaFree(d_A);
+  cudaFree(d_b);
+  cudaFree(d_pose);
+  cudaFree(d_shape_g);
+  cudaFree(d_l);
+  cudaFree(d_n);
+  cudaDeviceReset();
+
+  for (int idx = 0; idx < num_sub_problems; ++idx) {
+    if (sub_problem_status[idx] == 0) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool obstacle_constraint_eval(const int horizon, const int obstacles_num,
+                              const int obstacles_edges_sum,
+                              const double offset,
+                              const int *obstacles_edges_num,
+                              const double *obstacles_A,
+                              const double *obstacles_b,
+                              const double *shape_g, const double *states,
+                              const double *l, const double *n,
+                              double *constraints) {
+  int num_sub_problems = (horizon + 1) * obstacles_num;
+  std::vector<int> obstacles_edges_offset(obstacles_num, 0);
+  for (int j = 1; j < obstacles_num; ++j) {
+    obstacles_edges_offset[j] =
+        obstacles_edges_offset[j - 1] + obstacles_edges_num[j - 1];
+  }
+
+  if (!InitialCuda()) return false;
+  int *d_edges_num, *d_edges_offset;
+  double *d_A, *d_b, *d_shape_g, *d_states, *d_l, *d_n, *d_constraints;
+
+  unsigned int l_size = obstacles_edges_sum * (horizon + 1);
+  unsigned int n_size = 4 * obstacles_num * (horizon + 1);
+  cudaMalloc((void **)&d_edges_num, obstacles_num * sizeof(int));
+  cudaMalloc((void **)&d_edges_offset, obstacles_num * sizeof(int));
+  cudaMalloc((void **)&d_A, 2 * obstacles_edges_sum * sizeof(double));
+  cudaMalloc((void **)&d_b, obstacles_edges_sum * sizeof(double));
+  cudaMalloc((void **)&d_shape_g, 4 * sizeof(double));
+  cudaMalloc((void **)&d_states, 4 * (horizon + 1) * sizeof(double));
+  cudaMalloc((void **)&d_l, l_size * sizeof(double));
+  cudaMalloc((void **)&d_n, n_size * sizeof(double));
+  cudaMalloc((void **)&d_constraints, 4 * num_sub_problems * sizeof(double));
+
+  cudaMemcpy(d_edges_num, obstacles_edges_num, obstacles_num * sizeof(int),
+             cudaMemcpyHostToDevice);
+  cudaMemcpy(d_edges_offset, obstacles_edges_offset.data(),
+             obstacles_num * sizeof(int), cudaMemcpyHostToDevice);
+  cudaMemcpy(d_A, obstacles_A, 2 * obstacles_edges_sum * sizeof(double),
+             cudaMemcpyHostToDevice);
+  cudaMemcpy(d_b, obstacles_b, obstacles_edges_sum * sizeof(double),
+             cudaMemcpyHostToDevice);
+  cudaMemcpy(d_shape_g, shape_g, 4 * sizeof(double), cudaMemcpyHostToDevice);
+  cudaMemcpy(d_states, states, 4 * (horizon + 1) * sizeof(double),
+             cudaMemcpyHostToDevice);
+  cudaMemcpy(d_l, l, l_size * sizeof(double), cudaMemcpyHostToDevice);
+  cudaMemcpy(d_n, n, n_size * sizeof(double), cudaMemcpyHostToDevice);
+
+  dim3 block(BLOCK_1);
+  dim3 grid((num_sub_problems + block.x - 1) / block.x);
+
+  obstacle_constraint_eval_gpu<<<grid, block>>>(
+      num_sub_problems, obstacles_num, obstacles_edges_sum, offset,
+      d_edges_num, d_edges_offset, d_A, d_b, d_shape_g, d_states, d_l, d_n,
+      d_constraints);
+  cudaDeviceSynchronize();
+
+  cudaMemcpy(constraints, d_constraints, 4 * num_sub_problems * sizeof(double),
+             cudaMemcpyDeviceToHost);
+
+  cudaFree(d_edges_num);
+  cudaFree(d_edges_offset);
+  cudaFree(d_A);
+  cudaFree(d_b);
+  cudaFree(d_shape_g);
+  cudaFree(d_states);
+  cudaFree(d_l);
+  cudaFree(d_n);
+  cudaFree(d_constraints);
+  cudaDeviceReset();
+  return true;
+}
+
 DATA_TRANSFER_INST(int);
 DATA_TRANSFER_INST(double);
 DATA_TRANSFER_INST(float);
@@ -27,6 +27,15 @@ namespace planning {
 
 #define BLOCK_1 256
 
+// Maximum number of edges of a single obstacle handled by the batched
+// dual variable kernels. Obstacles with more edges fall back to the CPU
+// solvers.
+#define MAX_OBSTACLE_EDGES 12
+
+#define WARM_START_MAX_ITER 1000
+#define WARM_START_STEP 0.01
+#define WARM_START_TOL 1e-2
+
 #define TEMPLATE_ROUTINE_INSTANCE(ret, routine) template ret routine
 
 #define DATA_TRANSFER_INST(type) \
@@ -51,10 +60,51 @@ __global__ void fill_lower_left_gpu(int *iRow, int *jCol, unsigned int *rind_L,
 template <typename T>
 __global__ void data_transfer_gpu(T *dst, const T *src, const int size);
 
+// One thread per (time step, obstacle) sub-problem. Obstacle matrices are
+// stored column major, the pose array holds (x, y, phi) per time step.
+__global__ void dual_variable_warm_start_gpu(
+    const int num_sub_problems, const int obstacles_num,
+    const int obstacles_edges_sum, const double min_safety_distance,
+    const double offset, const int *obstacles_edges_num,
+    const int *obstacles_edges_offset, const double *obstacles_A,
+    const double *obstacles_b, const double *pose, const double *shape_g,
+    double *l_warm_up, double *n_warm_up, int *sub_problem_status);
+
+// One thread per (time step, obstacle) pair, writes the four obstacle
+// avoidance constraint values of that pair. The states array is strided
+// by 4 as in the distance approach decision variables.
+__global__ void obstacle_constraint_eval_gpu(
+    const int num_sub_problems, const int obstacles_num,
+    const int obstacles_edges_sum, const double offset,
+    const int *obstacles_edges_num, const int *obstacles_edges_offset,
+    const double *obstacles_A, const double *obstacles_b,
+    const double *shape_g, const double *states, const double *l,
+    const double *n, double *constraints);
+
 bool fill_lower_left(int *iRow, int *jCol, unsigned int *rind_L,
                      unsigned int *cind_L, const int nnz_L);
 template <typename T>
 bool data_transfer(T *dst, const T *src, const int size);
 
+bool dual_variable_warm_start(const int horizon, const int obstacles_num,
+                              const int obstacles_edges_sum,
+                              const double min_safety_distance,
+                              const double offset,
+                              const int *obstacles_edges_num,
+                              const double *obstacles_A,
+                              const double *obstacles_b, const double *pose,
+                              const double *shape_g, double *l_warm_up,
+                              double *n_warm_up);
+
+bool obstacle_constraint_eval(const int horizon, const int obstacles_num,
+                              const int obstacles_edges_sum,
+                              const double offset,
+                              const int *obstacles_edges_num,
+                              const double *obstacles_A,
+                              const double *obstacles_b,
+                              const double *shape_g, const double *states,
+                              const double *l, const double *n,
+                              double *constraints);
+
 }  // namespace planning
 }  // namespace apollo
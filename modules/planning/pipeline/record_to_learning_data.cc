@@ -14,6 +14,11 @@
  * limitations under the License.
  *****************************************************************************/
 
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <algorithm>
+
 #include <boost/filesystem.hpp>
 
 #include "absl/strings/str_split.h"
@@ -29,15 +34,10 @@
 namespace apollo {
 namespace planning {
 
-void GenerateLearningData() {
-  AINFO << "map_dir: " << FLAGS_map_dir;
-  if (FLAGS_planning_offline_bags.empty()) {
-    return;
-  }
-
+bool ProcessBags(const std::vector<std::string>& offline_bags) {
   if (!FeatureOutput::Ready()) {
     AERROR << "Feature output is not ready.";
-    return;
+    return false;
   }
 
   const std::string planning_config_file =
@@ -49,25 +49,82 @@ void GenerateLearningData() {
 
   MessageProcess message_process;
   if (!message_process.Init(planning_config)) {
-    return;
+    return false;
   }
 
+  for (std::size_t i = 0; i < offline_bags.size(); ++i) {
+    AINFO << "\tProcessing: [ " << i + 1 << " / " << offline_bags.size()
+          << " ]: " << offline_bags[i];
+    message_process.ProcessOfflineData(offline_bags[i]);
+    FeatureOutput::WriteRemainderiLearningData(offline_bags[i]);
+  }
+  message_process.Close();
+  return true;
+}
+
+bool GenerateLearningData() {
+  AINFO << "map_dir: " << FLAGS_map_dir;
+  if (FLAGS_planning_offline_bags.empty()) {
+    return true;
+  }
+
+  std::vector<std::string> offline_bags;
   const std::vector<std::string> inputs =
       absl::StrSplit(FLAGS_planning_offline_bags, ':');
   for (const auto& input : inputs) {
-    std::vector<std::string> offline_bags;
-    util::GetFilesByPath(boost::filesystem::path(input), &offline_bags);
-    std::sort(offline_bags.begin(), offline_bags.end());
-    AINFO << "For input " << input << ", found " << offline_bags.size()
+    std::vector<std::string> input_bags;
+    util::GetFilesByPath(boost::filesystem::path(input), &input_bags);
+    AINFO << "For input " << input << ", found " << input_bags.size()
           << " rosbags to process";
-    for (std::size_t i = 0; i < offline_bags.size(); ++i) {
-      AINFO << "\tProcessing: [ " << i + 1 << " / " << offline_bags.size()
-            << " ]: " << offline_bags[i];
-      message_process.ProcessOfflineData(offline_bags[i]);
-      FeatureOutput::WriteRemainderiLearningData(offline_bags[i]);
+    offline_bags.insert(offline_bags.end(), input_bags.begin(),
+                        input_bags.end());
+  }
+  std::sort(offline_bags.begin(), offline_bags.end());
+
+  const int worker_num = std::max(
+      1, std::min(FLAGS_planning_offline_worker_num,
+                  static_cast<int>(offline_bags.size())));
+  if (worker_num == 1) {
+    return ProcessBags(offline_bags);
+  }
+
+  // Records are sharded round-robin across worker processes. Each worker
+  // has its own MessageProcess and FeatureOutput state, and output files
+  // are named after the source record, so the shards never collide; the
+  // per-record <record file>.<n>.bin files together form the merged
+  // dataset.
+  AINFO << "Sharding " << offline_bags.size() << " rosbags across "
+        << worker_num << " workers";
+  std::vector<pid_t> workers;
+  for (int worker = 0; worker < worker_num; ++worker) {
+    const pid_t pid = fork();
+    if (pid < 0) {
+      AERROR << "Failed to fork worker " << worker;
+      break;
     }
+    if (pid == 0) {
+      std::vector<std::string> worker_bags;
+      for (std::size_t i = worker; i < offline_bags.size();
+           i += worker_num) {
+        worker_bags.push_back(offline_bags[i]);
+      }
+      _exit(ProcessBags(worker_bags) ? 0 : 1);
+    }
+    workers.push_back(pid);
   }
-  message_process.Close();
+
+  bool all_succeeded = !workers.empty();
+  for (const pid_t pid : workers) {
+    int status = 0;
+    if (waitpid(pid, &status, 0) != pid || !WIFEXITED(status) ||
+        WEXITSTATUS(status) != 0) {
+      AERROR << "Worker " << pid << " failed with status " << status;
+      all_succeeded = false;
+    }
+  }
+  AINFO << "All workers finished, processed " << offline_bags.size()
+        << " rosbags";
+  return all_succeeded;
 }
 
 }  // namespace planning
@@ -75,6 +132,5 @@ void GenerateLearningData() {
 
 int main(int argc, char* argv[]) {
   google::ParseCommandLineFlags(&argc, &argv, true);
-  apollo::planning::GenerateLearningData();
-  return 0;
+  return apollo::planning::GenerateLearningData() ? 0 : 1;
 }
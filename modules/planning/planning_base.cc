@@ -16,6 +16,7 @@
 
 #include "modules/planning/planning_base.h"
 
+#include "cyber/common/log.h"
 #include "modules/common/time/time.h"
 #include "modules/map/hdmap/hdmap_util.h"
 #include "modules/planning/common/planning_context.h"
@@ -53,5 +54,51 @@ void PlanningBase::FillPlanningPb(const double timestamp,
   trajectory_pb->mutable_routing_header()->CopyFrom(
       local_view_.routing->header());
 }
+
+void PlanningBase::CacheFallbackTrajectory(
+    const PublishableTrajectory& trajectory) {
+  if (!FLAGS_enable_fallback_trajectory_cache || trajectory.empty()) {
+    return;
+  }
+  fallback_trajectory_cache_.reset(new PublishableTrajectory(trajectory));
+}
+
+bool PlanningBase::GenerateFallbackTrajectoryFromCache(
+    const double current_time_stamp, ADCTrajectory* const trajectory_pb) {
+  if (!FLAGS_enable_fallback_trajectory_cache || !fallback_trajectory_cache_ ||
+      fallback_trajectory_cache_->empty()) {
+    return false;
+  }
+  const double drift =
+      current_time_stamp - fallback_trajectory_cache_->header_time();
+  if (drift < 0.0 || drift > FLAGS_fallback_cache_max_drift) {
+    return false;
+  }
+
+  // The cached solution stays valid across a small cycle drift; only the
+  // relative time of every point has to be shifted to the new header time.
+  trajectory_pb->clear_trajectory_point();
+  for (const auto& point : *fallback_trajectory_cache_) {
+    const double relative_time = point.relative_time() - drift;
+    if (relative_time < -FLAGS_fallback_time_unit) {
+      continue;
+    }
+    auto* next_point = trajectory_pb->add_trajectory_point();
+    next_point->CopyFrom(point);
+    next_point->set_relative_time(relative_time);
+  }
+  if (trajectory_pb->trajectory_point().empty()) {
+    return false;
+  }
+
+  const auto& last_tp =
+      trajectory_pb->trajectory_point(trajectory_pb->trajectory_point_size() -
+                                      1);
+  trajectory_pb->set_total_path_length(last_tp.path_point().s());
+  trajectory_pb->set_total_path_time(last_tp.relative_time());
+  AWARN << "Published the cached trajectory shifted by " << drift
+        << " seconds.";
+  return true;
+}
 }  // namespace planning
 }  // namespace apollo
@@ -78,6 +78,22 @@ class PlanningBase {
   virtual void FillPlanningPb(const double timestamp,
                               ADCTrajectory* const trajectory_pb);
 
+  /**
+   * @brief Cache the latest successfully planned trajectory so that a
+   * time-shifted copy can be published when a later cycle overruns or fails.
+   */
+  void CacheFallbackTrajectory(const PublishableTrajectory& trajectory);
+
+  /**
+   * @brief Publish the cached trajectory shifted to the current time. The
+   * cache is used only while it is at most FLAGS_fallback_cache_max_drift
+   * seconds old.
+   * @return true when a fallback trajectory has been written into
+   * trajectory_pb
+   */
+  bool GenerateFallbackTrajectoryFromCache(const double current_time_stamp,
+                                           ADCTrajectory* const trajectory_pb);
+
   LocalView local_view_;
   const hdmap::HDMap* hdmap_ = nullptr;
 
@@ -89,6 +105,7 @@ class PlanningBase {
   std::unique_ptr<Frame> frame_;
   std::unique_ptr<Planner> planner_;
   std::unique_ptr<PublishableTrajectory> last_publishable_trajectory_;
+  std::unique_ptr<PublishableTrajectory> fallback_trajectory_cache_;
   std::unique_ptr<PlannerDispatcher> planner_dispatcher_;
   std::shared_ptr<DependencyInjector> injector_;
 };
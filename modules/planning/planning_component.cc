@@ -18,6 +18,8 @@
 #include "cyber/common/file.h"
 #include "modules/common/adapters/adapter_gflags.h"
 #include "modules/common/configs/config_gflags.h"
+#include "modules/common/latency_recorder/latency_recorder.h"
+#include "modules/common/time/time.h"
 #include "modules/common/util/message_util.h"
 #include "modules/common/util/util.h"
 #include "modules/map/hdmap/hdmap_util.h"
@@ -119,6 +121,8 @@ bool PlanningComponent::Proc(
         localization_estimate) {
   ACHECK(prediction_obstacles != nullptr);
 
+  const auto latency_begin_time = common::time::Clock::Now();
+
   // check and process possible rerouting request
   CheckRerouting();
 
@@ -176,6 +180,15 @@ bool PlanningComponent::Proc(
   }
   planning_writer_->Write(adc_trajectory_pb);
 
+  // measure latency
+  if (adc_trajectory_pb.header().has_lidar_timestamp()) {
+    static apollo::common::LatencyRecorder latency_recorder(
+        FLAGS_planning_trajectory_topic);
+    latency_recorder.AppendLatencyRecord(
+        adc_trajectory_pb.header().lidar_timestamp(), latency_begin_time,
+        common::time::Clock::Now());
+  }
+
   // record in history
   auto* history = injector_->history();
   history->Add(adc_trajectory_pb);
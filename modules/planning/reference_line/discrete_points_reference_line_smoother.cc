@@ -156,7 +156,10 @@ bool DiscretePointsReferenceLineSmoother::FemPosSmooth(
   const auto& fem_pos_config =
       config_.discrete_points().fem_pos_deviation_smoothing();
 
-  FemPosDeviationSmoother smoother(fem_pos_config);
+  if (fem_pos_smoother_ == nullptr) {
+    fem_pos_smoother_.reset(new FemPosDeviationSmoother(fem_pos_config));
+  }
+  FemPosDeviationSmoother& smoother = *fem_pos_smoother_;
 
   // box contraints on pos are used in fem pos smoother, thus shrink the
   // bounds by 1.0 / sqrt(2.0)
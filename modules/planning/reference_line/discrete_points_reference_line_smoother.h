@@ -16,9 +16,11 @@
 
 #pragma once
 
+#include <memory>
 #include <utility>
 #include <vector>
 
+#include "modules/planning/math/discretized_points_smoothing/fem_pos_deviation_smoother.h"
 #include "modules/planning/proto/reference_line_smoother_config.pb.h"
 #include "modules/planning/reference_line/reference_line.h"
 #include "modules/planning/reference_line/reference_line_smoother.h"
@@ -61,6 +63,10 @@ class DiscretePointsReferenceLineSmoother : public ReferenceLineSmoother {
 
   std::vector<AnchorPoint> anchor_points_;
 
+  // Kept across planning cycles so the fem pos smoother can reuse the osqp
+  // workspace of the previous cycle
+  std::unique_ptr<FemPosDeviationSmoother> fem_pos_smoother_;
+
   double zero_x_ = 0.0;
 
   double zero_y_ = 0.0;
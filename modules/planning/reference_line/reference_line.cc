@@ -793,11 +793,46 @@ std::string ReferenceLine::DebugString() const {
 }
 
 double ReferenceLine::GetSpeedLimitFromS(const double s) const {
-  for (const auto& speed_limit : speed_limit_) {
-    if (s >= speed_limit.start_s && s <= speed_limit.end_s) {
-      return speed_limit.speed_limit;
+  // speed_limit_ is kept sorted and non-overlapping by AddSpeedLimit, so
+  // the covering interval, if any, is the last one starting at or before s.
+  auto it = std::upper_bound(speed_limit_.begin(), speed_limit_.end(), s,
+                             [](const double s, const SpeedLimit& limit) {
+                               return s < limit.start_s;
+                             });
+  if (it != speed_limit_.begin() && s <= std::prev(it)->end_s) {
+    return std::prev(it)->speed_limit;
+  }
+  return GetMapSpeedLimitFromS(s);
+}
+
+std::vector<double> ReferenceLine::GetSpeedLimitsFromS(
+    const std::vector<double>& s) const {
+  std::vector<double> speed_limits;
+  speed_limits.reserve(s.size());
+  // walk the sorted interval table once for monotonic queries; restart the
+  // cursor if a query goes backwards
+  size_t index = 0;
+  double last_s = std::numeric_limits<double>::lowest();
+  for (const double query_s : s) {
+    if (query_s < last_s) {
+      index = 0;
+    }
+    last_s = query_s;
+    while (index < speed_limit_.size() &&
+           speed_limit_[index].end_s < query_s) {
+      ++index;
+    }
+    if (index < speed_limit_.size() &&
+        query_s >= speed_limit_[index].start_s) {
+      speed_limits.push_back(speed_limit_[index].speed_limit);
+    } else {
+      speed_limits.push_back(GetMapSpeedLimitFromS(query_s));
     }
   }
+  return speed_limits;
+}
+
+double ReferenceLine::GetMapSpeedLimitFromS(const double s) const {
   const auto& map_path_point = GetReferencePoint(s);
 
   double speed_limit = FLAGS_planning_upper_speed_limit;
@@ -174,6 +174,14 @@ class ReferenceLine {
 
   double GetSpeedLimitFromS(const double s) const;
 
+  /**
+   * @brief Batch version of GetSpeedLimitFromS. The speed-limit interval
+   * table is walked with a single cursor, so querying a whole trajectory of
+   * monotonically non-decreasing s values costs one pass instead of one
+   * search per point.
+   */
+  std::vector<double> GetSpeedLimitsFromS(const std::vector<double>& s) const;
+
   void AddSpeedLimit(double start_s, double end_s, double speed_limit);
 
   uint32_t GetPriority() const { return priority_; }
@@ -212,6 +220,13 @@ class ReferenceLine {
                                      const ReferencePoint& p1, const double s1,
                                      const double x, const double y);
 
+  /**
+   * @brief Speed limit from the underlying map (lane speed limits, or the
+   * road-type default), i.e. the fallback when no interval in speed_limit_
+   * covers s.
+   */
+  double GetMapSpeedLimitFromS(const double s) const;
+
  private:
   struct SpeedLimit {
     double start_s = 0.0;
@@ -884,7 +884,11 @@ bool ReferenceLineProvider::SmoothPrefixedReferenceLine(
   // generate anchor points:
   std::vector<AnchorPoint> anchor_points;
   GetAnchorPoints(raw_ref, &anchor_points);
-  // modify anchor points based on prefix_ref
+  // Pin every anchor point lying on the already smoothed prefix to the prefix
+  // geometry. The pinned variables leave the solver no freedom inside the
+  // overlap, so effectively only the newly appended window is optimized, while
+  // the smoothness terms coupling pinned and free points keep the stitch
+  // continuous.
   for (auto &point : anchor_points) {
     common::SLPoint sl_point;
     if (!prefix_ref.XYToSL(point.path_point, &sl_point)) {
@@ -901,7 +905,6 @@ bool ReferenceLineProvider::SmoothPrefixedReferenceLine(
     point.longitudinal_bound = 1e-6;
     point.lateral_bound = 1e-6;
     point.enforced = true;
-    break;
   }
 
   smoother_->SetAnchorPoints(anchor_points);
@@ -20,6 +20,7 @@
 
 #include "modules/planning/reference_line/spiral_problem_interface.h"
 
+#include <cmath>
 #include <utility>
 
 #include "modules/common/math/math_utils.h"
@@ -259,6 +260,24 @@ bool SpiralProblemInterface::get_starting_point(int n, bool init_x, double* x,
   }
   x[1] = x[6];
 
+  if (has_warm_start_) {
+    // Overlay the previous cycle's solution where available, clamped into
+    // the variable bounds so the seed is always feasible.
+    for (int i = 0; i < num_of_points_; ++i) {
+      if (std::isnan(warm_theta_[i])) {
+        continue;
+      }
+      int index = i * 5;
+      double theta_diff =
+          common::math::AngleDiff(relative_theta_[i], warm_theta_[i]);
+      theta_diff = common::math::Clamp(theta_diff, -M_PI * 0.2 + 0.01,
+                                       M_PI * 0.2 - 0.01);
+      x[index] = relative_theta_[i] + theta_diff;
+      x[index + 1] = common::math::Clamp(warm_kappa_[i], -0.25, 0.25);
+      x[index + 2] = common::math::Clamp(warm_dkappa_[i], -0.02, 0.02);
+    }
+  }
+
   if (has_fixed_start_point_) {
     x[0] = start_theta_;
     x[1] = start_kappa_;
@@ -389,14 +408,13 @@ bool SpiralProblemInterface::eval_g(int n, const double* x, bool new_x, int m,
     int index1 = (i + 1) * 5;
 
     const auto& spiral_curve = piecewise_paths_[i];
-    double delta_s = spiral_curve.ParamLength();
 
     double x_diff = x[index1 + 3] - x[index0 + 3] -
-                    spiral_curve.ComputeCartesianDeviationX(delta_s);
+                    spiral_curve.ComputeCartesianDeviationX();
     g[i * 2] = x_diff * x_diff;
 
     double y_diff = x[index1 + 4] - x[index0 + 4] -
-                    spiral_curve.ComputeCartesianDeviationY(delta_s);
+                    spiral_curve.ComputeCartesianDeviationY();
     g[i * 2 + 1] = y_diff * y_diff;
   }
 
@@ -545,12 +563,11 @@ bool SpiralProblemInterface::eval_jac_g(int n, const double* x, bool new_x,
       int index1 = (i + 1) * 5;
 
       auto& spiral_curve = piecewise_paths_[i];
-      double delta_s = spiral_curve.ParamLength();
 
       double x_diff = x[index1 + 3] - x[index0 + 3] -
-                      spiral_curve.ComputeCartesianDeviationX(delta_s);
+                      spiral_curve.ComputeCartesianDeviationX();
       double y_diff = x[index1 + 4] - x[index0 + 4] -
-                      spiral_curve.ComputeCartesianDeviationY(delta_s);
+                      spiral_curve.ComputeCartesianDeviationY();
 
       auto pos_theta0 = spiral_curve.DeriveCartesianDeviation(THETA0);
       auto pos_kappa0 = spiral_curve.DeriveCartesianDeviation(KAPPA0);
@@ -751,5 +768,17 @@ void SpiralProblemInterface::set_element_weight_dkappa(
   weight_dkappa_ = weight_dkappa;
 }
 
+void SpiralProblemInterface::set_warm_start(const std::vector<double>& theta,
+                                            const std::vector<double>& kappa,
+                                            const std::vector<double>& dkappa) {
+  CHECK_EQ(theta.size(), init_points_.size());
+  CHECK_EQ(kappa.size(), init_points_.size());
+  CHECK_EQ(dkappa.size(), init_points_.size());
+  warm_theta_ = theta;
+  warm_kappa_ = kappa;
+  warm_dkappa_ = dkappa;
+  has_warm_start_ = true;
+}
+
 }  // namespace planning
 }  // namespace apollo
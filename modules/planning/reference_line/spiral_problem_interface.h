@@ -56,6 +56,12 @@ class SpiralProblemInterface : public Ipopt::TNLP {
 
   void set_element_weight_dkappa(const double weight_dkappa);
 
+  // Seeds the starting point from a previous solve. Entries set to NaN in
+  // theta fall back to the default finite-difference initialization.
+  void set_warm_start(const std::vector<double>& theta,
+                      const std::vector<double>& kappa,
+                      const std::vector<double>& dkappa);
+
   void get_optimization_results(std::vector<double>* ptr_theta,
                                 std::vector<double>* ptr_kappa,
                                 std::vector<double>* ptr_dkappa,
@@ -177,6 +183,14 @@ class SpiralProblemInterface : public Ipopt::TNLP {
   double weight_kappa_ = 1.0;
 
   double weight_dkappa_ = 1.0;
+
+  bool has_warm_start_ = false;
+
+  std::vector<double> warm_theta_;
+
+  std::vector<double> warm_kappa_;
+
+  std::vector<double> warm_dkappa_;
 };
 
 }  // namespace planning
@@ -21,6 +21,7 @@
 #include "modules/planning/reference_line/spiral_reference_line_smoother.h"
 
 #include <algorithm>
+#include <limits>
 #include <utility>
 
 #include <coin/IpIpoptApplication.hpp>
@@ -246,7 +247,7 @@ bool SpiralReferenceLineSmoother::Smooth(std::vector<Eigen::Vector2d> point2d,
                                          std::vector<double>* ptr_dkappa,
                                          std::vector<double>* ptr_s,
                                          std::vector<double>* ptr_x,
-                                         std::vector<double>* ptr_y) const {
+                                         std::vector<double>* ptr_y) {
   CHECK_GT(point2d.size(), 1);
 
   SpiralProblemInterface* ptop = new SpiralProblemInterface(point2d);
@@ -262,6 +263,38 @@ bool SpiralReferenceLineSmoother::Smooth(std::vector<Eigen::Vector2d> point2d,
   ptop->set_element_weight_kappa(config_.spiral().weight_kappa());
   ptop->set_element_weight_dkappa(config_.spiral().weight_dkappa());
 
+  // Seed the solve with the previous cycle's spiral parameters. Consecutive
+  // anchor windows overlap almost entirely, so points matched against the
+  // previous solution start near the optimum and Ipopt converges in a few
+  // iterations; unmatched points keep the finite-difference initialization.
+  if (!prev_points_.empty()) {
+    const double match_radius_sqr = config_.spiral().max_deviation() *
+                                    config_.spiral().max_deviation() * 4.0;
+    std::vector<double> warm_theta(point2d.size(),
+                                   std::numeric_limits<double>::quiet_NaN());
+    std::vector<double> warm_kappa(point2d.size(), 0.0);
+    std::vector<double> warm_dkappa(point2d.size(), 0.0);
+    for (size_t i = 0; i < point2d.size(); ++i) {
+      const Eigen::Vector2d abs_point(point2d[i].x() + zero_x_,
+                                      point2d[i].y() + zero_y_);
+      size_t best_index = prev_points_.size();
+      double best_distance_sqr = match_radius_sqr;
+      for (size_t j = 0; j < prev_points_.size(); ++j) {
+        const double distance_sqr = (prev_points_[j] - abs_point).squaredNorm();
+        if (distance_sqr < best_distance_sqr) {
+          best_distance_sqr = distance_sqr;
+          best_index = j;
+        }
+      }
+      if (best_index < prev_points_.size()) {
+        warm_theta[i] = prev_theta_[best_index];
+        warm_kappa[i] = prev_kappa_[best_index];
+        warm_dkappa[i] = prev_dkappa_[best_index];
+      }
+    }
+    ptop->set_warm_start(warm_theta, warm_kappa, warm_dkappa);
+  }
+
   Ipopt::SmartPtr<Ipopt::TNLP> problem = ptop;
 
   // Create an instance of the IpoptApplication
@@ -275,6 +308,10 @@ bool SpiralReferenceLineSmoother::Smooth(std::vector<Eigen::Vector2d> point2d,
   app->Options()->SetNumericValue("tol", config_.spiral().opt_tol());
   app->Options()->SetNumericValue("acceptable_tol",
                                   config_.spiral().opt_acceptable_tol());
+  // Hard deadline for online smoothing; Ipopt returns its current iterate
+  // when the cap is hit, which is accepted below as a best-effort result.
+  app->Options()->SetNumericValue("max_cpu_time",
+                                  FLAGS_spiral_smoother_max_cpu_time_seconds);
 
   Ipopt::ApplicationReturnStatus status = app->Initialize();
   if (status != Ipopt::Solve_Succeeded) {
@@ -293,6 +330,10 @@ bool SpiralReferenceLineSmoother::Smooth(std::vector<Eigen::Vector2d> point2d,
     Ipopt::Number final_obj = app->Statistics()->FinalObjective();
     ADEBUG << "*** The final value of the objective function is " << final_obj
            << '.';
+  } else if (status == Ipopt::Maximum_CpuTime_Exceeded) {
+    AWARN << "Spiral smoothing hit the "
+          << FLAGS_spiral_smoother_max_cpu_time_seconds
+          << "s deadline; returning the best iterate so far.";
   } else {
     ADEBUG << "Return status: " << int(status);
   }
@@ -300,8 +341,24 @@ bool SpiralReferenceLineSmoother::Smooth(std::vector<Eigen::Vector2d> point2d,
   ptop->get_optimization_results(ptr_theta, ptr_kappa, ptr_dkappa, ptr_s, ptr_x,
                                  ptr_y);
 
-  return status == Ipopt::Solve_Succeeded ||
-         status == Ipopt::Solved_To_Acceptable_Level;
+  const bool solved = status == Ipopt::Solve_Succeeded ||
+                      status == Ipopt::Solved_To_Acceptable_Level ||
+                      status == Ipopt::Maximum_CpuTime_Exceeded;
+
+  // Keep the solution for warm-starting the next cycle. Deadline-capped
+  // iterates are kept as well: they still satisfy the deviation bounds and
+  // remain far better seeds than a cold start.
+  if (solved) {
+    prev_points_.clear();
+    prev_theta_ = *ptr_theta;
+    prev_kappa_ = *ptr_kappa;
+    prev_dkappa_ = *ptr_dkappa;
+    for (size_t i = 0; i < ptr_x->size(); ++i) {
+      prev_points_.emplace_back((*ptr_x)[i] + zero_x_, (*ptr_y)[i] + zero_y_);
+    }
+  }
+
+  return solved;
 }
 
 std::vector<common::PathPoint> SpiralReferenceLineSmoother::Interpolate(
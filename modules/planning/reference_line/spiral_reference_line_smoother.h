@@ -63,7 +63,7 @@ class SpiralReferenceLineSmoother : public ReferenceLineSmoother {
   bool Smooth(std::vector<Eigen::Vector2d> point2d,
               std::vector<double>* ptr_theta, std::vector<double>* ptr_kappa,
               std::vector<double>* ptr_dkappa, std::vector<double>* ptr_s,
-              std::vector<double>* ptr_x, std::vector<double>* ptr_y) const;
+              std::vector<double>* ptr_x, std::vector<double>* ptr_y);
 
  private:
   std::vector<common::PathPoint> Interpolate(
@@ -98,6 +98,17 @@ class SpiralReferenceLineSmoother : public ReferenceLineSmoother {
   double zero_x_ = 0.0;
 
   double zero_y_ = 0.0;
+
+  // Solution of the previous cycle in absolute coordinates, used to
+  // warm-start the next Ipopt solve. The smoother lives across planning
+  // cycles, so consecutive anchor windows overlap almost entirely.
+  std::vector<Eigen::Vector2d> prev_points_;
+
+  std::vector<double> prev_theta_;
+
+  std::vector<double> prev_kappa_;
+
+  std::vector<double> prev_dkappa_;
 };
 
 }  // namespace planning
@@ -1053,12 +1053,10 @@ void ScenarioManager::UpdatePlanningContextTrafficLightScenario(
   const auto& reference_line_info = frame.reference_line_info().front();
   const std::vector<PathOverlap>& traffic_light_overlaps =
       reference_line_info.reference_line().map_path().signal_overlaps();
-  auto traffic_light_overlap_itr = std::find_if(
-      traffic_light_overlaps.begin(), traffic_light_overlaps.end(),
-      [&current_traffic_light_overlap_id](const hdmap::PathOverlap& overlap) {
-        return overlap.object_id == current_traffic_light_overlap_id;
-      });
-  if (traffic_light_overlap_itr == traffic_light_overlaps.end()) {
+  const auto* current_traffic_light_overlap =
+      reference_line_info.GetOverlapById(ReferenceLineInfo::SIGNAL,
+                                         current_traffic_light_overlap_id);
+  if (current_traffic_light_overlap == nullptr) {
     injector_->planning_context()
         ->mutable_planning_status()
         ->mutable_traffic_light()
@@ -1068,7 +1066,7 @@ void ScenarioManager::UpdatePlanningContextTrafficLightScenario(
 
   static constexpr double kTrafficLightGroupingMaxDist = 2.0;  // unit: m
   const double current_traffic_light_overlap_start_s =
-      traffic_light_overlap_itr->start_s;
+      current_traffic_light_overlap->start_s;
   for (const auto& traffic_light_overlap : traffic_light_overlaps) {
     const double dist =
         traffic_light_overlap.start_s - current_traffic_light_overlap_start_s;
@@ -1120,12 +1118,9 @@ void ScenarioManager::UpdatePlanningContextYieldSignScenario(
   const auto& reference_line_info = frame.reference_line_info().front();
   const std::vector<PathOverlap>& yield_sign_overlaps =
       reference_line_info.reference_line().map_path().yield_sign_overlaps();
-  auto yield_sign_overlap_itr = std::find_if(
-      yield_sign_overlaps.begin(), yield_sign_overlaps.end(),
-      [&current_yield_sign_overlap_id](const hdmap::PathOverlap& overlap) {
-        return overlap.object_id == current_yield_sign_overlap_id;
-      });
-  if (yield_sign_overlap_itr == yield_sign_overlaps.end()) {
+  const auto* current_yield_sign_overlap = reference_line_info.GetOverlapById(
+      ReferenceLineInfo::YIELD_SIGN, current_yield_sign_overlap_id);
+  if (current_yield_sign_overlap == nullptr) {
     injector_->planning_context()
         ->mutable_planning_status()
         ->mutable_yield_sign()
@@ -1135,7 +1130,7 @@ void ScenarioManager::UpdatePlanningContextYieldSignScenario(
 
   static constexpr double kTrafficLightGroupingMaxDist = 2.0;  // unit: m
   const double current_yield_sign_overlap_start_s =
-      yield_sign_overlap_itr->start_s;
+      current_yield_sign_overlap->start_s;
   for (const auto& yield_sign_overlap : yield_sign_overlaps) {
     const double dist =
         yield_sign_overlap.start_s - current_yield_sign_overlap_start_s;
@@ -20,13 +20,17 @@
 
 #include "modules/planning/scenarios/stage.h"
 
+#include <future>
 #include <unordered_map>
 #include <utility>
 
+#include "cyber/task/task.h"
 #include "modules/common/time/time.h"
 #include "modules/planning/common/planning_context.h"
+#include "modules/planning/common/planning_gflags.h"
 #include "modules/planning/common/speed_profile_generator.h"
 #include "modules/planning/common/trajectory/publishable_trajectory.h"
+#include "modules/planning/tasks/task_dependency.h"
 #include "modules/planning/tasks/task_factory.h"
 
 namespace apollo {
@@ -71,6 +75,7 @@ Stage::Stage(const ScenarioConfig::StageConfig& config,
       task_list_.push_back(iter->second.get());
     }
   }
+  task_groups_ = TaskDependency::PartitionIndependentGroups(task_list_);
 }
 
 const std::string& Stage::Name() const { return name_; }
@@ -92,21 +97,60 @@ bool Stage::ExecuteTaskOnReferenceLine(
       return false;
     }
 
-    for (auto* task : task_list_) {
-      const double start_timestamp = Clock::NowInSeconds();
-
-      const auto ret = task->Execute(frame, &reference_line_info);
-
-      const double end_timestamp = Clock::NowInSeconds();
-      const double time_diff_ms = (end_timestamp - start_timestamp) * 1000;
-      ADEBUG << "after task[" << task->Name()
-             << "]: " << reference_line_info.PathSpeedDebugString();
-      ADEBUG << task->Name() << " time spend: " << time_diff_ms << " ms.";
-      RecordDebugInfo(&reference_line_info, task->Name(), time_diff_ms);
-
-      if (!ret.ok()) {
-        AERROR << "Failed to run tasks[" << task->Name()
-               << "], Error message: " << ret.error_message();
+    bool task_failed = false;
+    for (const auto& task_group : task_groups_) {
+      if (task_group.size() > 1 && FLAGS_enable_parallel_task_execution) {
+        // The tasks in this group are declared independent; run them
+        // concurrently and join before the next group starts.
+        std::vector<double> task_times(task_group.size(), 0.0);
+        std::vector<std::future<common::Status>> futures;
+        for (size_t i = 0; i < task_group.size(); ++i) {
+          auto* task = task_group[i];
+          futures.push_back(
+              cyber::Async([task, frame, &reference_line_info, &task_times,
+                            i]() {
+                const double start_timestamp = Clock::NowInSeconds();
+                const auto ret = task->Execute(frame, &reference_line_info);
+                task_times[i] = (Clock::NowInSeconds() - start_timestamp) *
+                                1000;
+                return ret;
+              }));
+        }
+        for (size_t i = 0; i < futures.size(); ++i) {
+          const auto ret = futures[i].get();
+          auto* task = task_group[i];
+          ADEBUG << "after task[" << task->Name()
+                 << "]: " << reference_line_info.PathSpeedDebugString();
+          ADEBUG << task->Name() << " time spend: " << task_times[i] << " ms.";
+          RecordDebugInfo(&reference_line_info, task->Name(), task_times[i]);
+          if (!ret.ok()) {
+            AERROR << "Failed to run tasks[" << task->Name()
+                   << "], Error message: " << ret.error_message();
+            task_failed = true;
+          }
+        }
+      } else {
+        for (auto* task : task_group) {
+          const double start_timestamp = Clock::NowInSeconds();
+
+          const auto ret = task->Execute(frame, &reference_line_info);
+
+          const double end_timestamp = Clock::NowInSeconds();
+          const double time_diff_ms = (end_timestamp - start_timestamp) * 1000;
+          ADEBUG << "after task[" << task->Name()
+                 << "]: " << reference_line_info.PathSpeedDebugString();
+          ADEBUG << task->Name() << " time spend: " << time_diff_ms << " ms.";
+          RecordDebugInfo(&reference_line_info, task->Name(), time_diff_ms);
+
+          if (!ret.ok()) {
+            AERROR << "Failed to run tasks[" << task->Name()
+                   << "], Error message: " << ret.error_message();
+            task_failed = true;
+            break;
+          }
+        }
+      }
+      if (task_failed) {
         break;
       }
     }
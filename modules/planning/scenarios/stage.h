@@ -97,6 +97,9 @@ class Stage {
  protected:
   std::map<TaskConfig::TaskType, std::unique_ptr<Task>> tasks_;
   std::vector<Task*> task_list_;
+  // task_list_ partitioned into consecutive groups of declared-independent
+  // tasks; tasks inside one group may execute concurrently.
+  std::vector<std::vector<Task*>> task_groups_;
   ScenarioConfig::StageConfig config_;
   ScenarioConfig::StageType next_stage_;
   void* context_ = nullptr;
@@ -34,45 +34,10 @@ using apollo::common::math::Vec2d;
 hdmap::PathOverlap* GetOverlapOnReferenceLine(
     const ReferenceLineInfo& reference_line_info, const std::string& overlap_id,
     const ReferenceLineInfo::OverlapType& overlap_type) {
-  if (overlap_type == ReferenceLineInfo::SIGNAL) {
-    // traffic_light_overlap
-    const auto& traffic_light_overlaps =
-        reference_line_info.reference_line().map_path().signal_overlaps();
-    for (const auto& traffic_light_overlap : traffic_light_overlaps) {
-      if (traffic_light_overlap.object_id == overlap_id) {
-        return const_cast<hdmap::PathOverlap*>(&traffic_light_overlap);
-      }
-    }
-  } else if (overlap_type == ReferenceLineInfo::STOP_SIGN) {
-    // stop_sign_overlap
-    const auto& stop_sign_overlaps =
-        reference_line_info.reference_line().map_path().stop_sign_overlaps();
-    for (const auto& stop_sign_overlap : stop_sign_overlaps) {
-      if (stop_sign_overlap.object_id == overlap_id) {
-        return const_cast<hdmap::PathOverlap*>(&stop_sign_overlap);
-      }
-    }
-  } else if (overlap_type == ReferenceLineInfo::PNC_JUNCTION) {
-    // pnc_junction_overlap
-    const auto& pnc_junction_overlaps =
-        reference_line_info.reference_line().map_path().pnc_junction_overlaps();
-    for (const auto& pnc_junction_overlap : pnc_junction_overlaps) {
-      if (pnc_junction_overlap.object_id == overlap_id) {
-        return const_cast<hdmap::PathOverlap*>(&pnc_junction_overlap);
-      }
-    }
-  } else if (overlap_type == ReferenceLineInfo::YIELD_SIGN) {
-    // yield_sign_overlap
-    const auto& yield_sign_overlaps =
-        reference_line_info.reference_line().map_path().yield_sign_overlaps();
-    for (const auto& yield_sign_overlap : yield_sign_overlaps) {
-      if (yield_sign_overlap.object_id == overlap_id) {
-        return const_cast<hdmap::PathOverlap*>(&yield_sign_overlap);
-      }
-    }
-  }
-
-  return nullptr;
+  // the reference line indexes its overlaps by type and object id, so stage
+  // code does not rescan the map-path overlap vectors in every Proc
+  return const_cast<hdmap::PathOverlap*>(
+      reference_line_info.GetOverlapById(overlap_type, overlap_id));
 }
 
 /**
@@ -291,6 +291,13 @@ void PathBoundsDecider::InitPathBoundsDecider(
   } else {
     adc_lane_width_ = lane_left_width + lane_right_width;
   }
+
+  // Sort the obstacle SL edges once per frame. Regular, fallback, pull-over
+  // and lane-borrow bound generation all sweep the same obstacle set, so in
+  // construction-zone scenes with many virtual obstacles this saves repeated
+  // O(n log n) sorts within one planning cycle.
+  sorted_obstacle_edges_ = SortObstaclesForSweepLine(
+      reference_line_info.path_decision().obstacles());
 }
 
 common::TrajectoryPoint PathBoundsDecider::InferFrontAxeCenterFromRearAxeCenter(
@@ -336,8 +343,8 @@ Status PathBoundsDecider::GenerateRegularPathBound(
 
   // 3. Fine-tune the boundary based on static obstacles
   PathBound temp_path_bound = *path_bound;
-  if (!GetBoundaryFromStaticObstacles(reference_line_info.path_decision(),
-                                      path_bound, blocking_obstacle_id)) {
+  if (!GetBoundaryFromStaticObstacles(sorted_obstacle_edges_, path_bound,
+                                      blocking_obstacle_id)) {
     const std::string msg =
         "Failed to decide fine tune the boundaries after "
         "taking into consideration all static obstacles.";
@@ -390,8 +397,8 @@ Status PathBoundsDecider::GenerateLaneChangePathBound(
 
   PathBound temp_path_bound = *path_bound;
   std::string blocking_obstacle_id;
-  if (!GetBoundaryFromStaticObstacles(reference_line_info.path_decision(),
-                                      path_bound, &blocking_obstacle_id)) {
+  if (!GetBoundaryFromStaticObstacles(sorted_obstacle_edges_, path_bound,
+                                      &blocking_obstacle_id)) {
     const std::string msg =
         "Failed to decide fine tune the boundaries after "
         "taking into consideration all static obstacles.";
@@ -447,8 +454,8 @@ Status PathBoundsDecider::GeneratePullOverPathBound(
   // 3. Fine-tune the boundary based on static obstacles
   PathBound temp_path_bound = *path_bound;
   std::string blocking_obstacle_id;
-  if (!GetBoundaryFromStaticObstacles(reference_line_info.path_decision(),
-                                      path_bound, &blocking_obstacle_id)) {
+  if (!GetBoundaryFromStaticObstacles(sorted_obstacle_edges_, path_bound,
+                                      &blocking_obstacle_id)) {
     const std::string msg =
         "Failed to decide fine tune the boundaries after "
         "taking into consideration all static obstacles.";
@@ -1362,12 +1369,11 @@ void PathBoundsDecider::GetBoundaryFromLaneChangeForbiddenZone(
 // obstacles whose headings differ from road-headings a lot.
 // TODO(all): (future work) this can be improved in the future.
 bool PathBoundsDecider::GetBoundaryFromStaticObstacles(
-    const PathDecision& path_decision, PathBound* const path_boundaries,
+    const std::vector<ObstacleEdge>& sorted_obstacles,
+    PathBound* const path_boundaries,
     std::string* const blocking_obstacle_id) {
-  // Preprocessing.
-  auto indexed_obstacles = path_decision.obstacles();
-  auto sorted_obstacles = SortObstaclesForSweepLine(indexed_obstacles);
   ADEBUG << "There are " << sorted_obstacles.size() << " obstacles.";
+  const double adc_edge_buffer = GetBufferBetweenADCCenterAndEdge();
   double center_line = adc_frenet_l_;
   size_t obs_idx = 0;
   int path_blocked_idx = -1;
@@ -1431,12 +1437,12 @@ bool PathBoundsDecider::GetBoundaryFromStaticObstacles(
           obs_id_to_direction.erase(curr_obstacle_id);
         }
         // Update the bounds and center_line.
-        std::get<1>((*path_boundaries)[i]) = std::fmax(
-            std::get<1>((*path_boundaries)[i]),
-            *right_bounds.begin() + GetBufferBetweenADCCenterAndEdge());
-        std::get<2>((*path_boundaries)[i]) = std::fmin(
-            std::get<2>((*path_boundaries)[i]),
-            *left_bounds.begin() - GetBufferBetweenADCCenterAndEdge());
+        std::get<1>((*path_boundaries)[i]) =
+            std::fmax(std::get<1>((*path_boundaries)[i]),
+                      *right_bounds.begin() + adc_edge_buffer);
+        std::get<2>((*path_boundaries)[i]) =
+            std::fmin(std::get<2>((*path_boundaries)[i]),
+                      *left_bounds.begin() - adc_edge_buffer);
         if (std::get<1>((*path_boundaries)[i]) >
             std::get<2>((*path_boundaries)[i])) {
           ADEBUG << "Path is blocked at s = " << curr_s;
@@ -1457,10 +1463,10 @@ bool PathBoundsDecider::GetBoundaryFromStaticObstacles(
       // If no obstacle change, update the bounds and center_line.
       std::get<1>((*path_boundaries)[i]) =
           std::fmax(std::get<1>((*path_boundaries)[i]),
-                    *right_bounds.begin() + GetBufferBetweenADCCenterAndEdge());
+                    *right_bounds.begin() + adc_edge_buffer);
       std::get<2>((*path_boundaries)[i]) =
           std::fmin(std::get<2>((*path_boundaries)[i]),
-                    *left_bounds.begin() - GetBufferBetweenADCCenterAndEdge());
+                    *left_bounds.begin() - adc_edge_buffer);
       if (std::get<1>((*path_boundaries)[i]) >
           std::get<2>((*path_boundaries)[i])) {
         ADEBUG << "Path is blocked at s = " << curr_s;
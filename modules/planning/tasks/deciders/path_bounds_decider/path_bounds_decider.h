@@ -214,9 +214,13 @@ class PathBoundsDecider : public Decider {
   /** @brief Refine the boundary based on static obstacles. It will make sure
    *   the boundary doesn't contain any static obstacle so that the path
    *   generated by optimizer won't collide with any static obstacle.
+   *   Sweeps the pre-sorted obstacle SL edges while maintaining the active
+   *   left/right bound sets, so the cost is O((n + m) log n) for n obstacles
+   *   and m path samples.
    */
   bool GetBoundaryFromStaticObstacles(
-      const PathDecision& path_decision,
+      const std::vector<std::tuple<int, double, double, double, std::string>>&
+          sorted_obstacles,
       std::vector<std::tuple<double, double, double>>* const path_boundaries,
       std::string* const blocking_obstacle_id);
 
@@ -311,6 +315,10 @@ class PathBoundsDecider : public Decider {
   double adc_frenet_ld_ = 0.0;
   double adc_l_to_lane_center_ = 0.0;
   double adc_lane_width_ = 0.0;
+  // Obstacle SL edges sorted once per frame in InitPathBoundsDecider and
+  // shared by every bound generation pass of that frame.
+  std::vector<std::tuple<int, double, double, double, std::string>>
+      sorted_obstacle_edges_;
 
   FRIEND_TEST(PathBoundsDeciderTest, InitPathBoundary);
   FRIEND_TEST(PathBoundsDeciderTest, GetBoundaryFromLanesAndADC);
@@ -22,6 +22,7 @@
 
 #include <algorithm>
 #include <limits>
+#include <vector>
 
 #include "cyber/common/log.h"
 #include "modules/common/configs/vehicle_config_helper.h"
@@ -51,6 +52,16 @@ Status SpeedLimitDecider::GetSpeedLimits(
   const auto& discretized_path = path_data_.discretized_path();
   const auto& frenet_path = path_data_.frenet_frame_path();
 
+  // batch the per-point map speed-limit lookups; the frenet path s values
+  // are monotone, so the reference line walks its interval table only once
+  std::vector<double> path_reference_s;
+  path_reference_s.reserve(frenet_path.size());
+  for (const auto& frenet_point : frenet_path) {
+    path_reference_s.push_back(frenet_point.s());
+  }
+  const std::vector<double> reference_line_speed_limits =
+      reference_line_.GetSpeedLimitsFromS(path_reference_s);
+
   for (uint32_t i = 0; i < discretized_path.size(); ++i) {
     const double path_s = discretized_path.at(i).s();
     const double reference_line_s = frenet_path.at(i).s();
@@ -62,8 +73,7 @@ Status SpeedLimitDecider::GetSpeedLimits(
     }
 
     // (1) speed limit from map
-    double speed_limit_from_reference_line =
-        reference_line_.GetSpeedLimitFromS(reference_line_s);
+    double speed_limit_from_reference_line = reference_line_speed_limits.at(i);
 
     // (2) speed limit from path curvature
     //  -- 2.1: limit by centripetal force (acceleration)
@@ -47,6 +47,86 @@ using apollo::common::Status;
 using apollo::common::math::Box2d;
 using apollo::common::math::Vec2d;
 
+PathOverlapIndex::PathOverlapIndex(const DiscretizedPath& path,
+                                   const double step_length,
+                                   const double path_length,
+                                   const common::VehicleParam& vehicle_param,
+                                   const double l_buffer) {
+  // Materialize the ADC bounding box on the same coarse grid that used to
+  // be re-walked for every obstacle trajectory point.
+  for (double path_s = 0.0; path_s < path_length; path_s += step_length) {
+    const auto path_point = path.Evaluate(path_s + path.front().s());
+    Vec2d ego_center_map_frame((vehicle_param.front_edge_to_center() -
+                                vehicle_param.back_edge_to_center()) *
+                                   0.5,
+                               (vehicle_param.left_edge_to_center() -
+                                vehicle_param.right_edge_to_center()) *
+                                   0.5);
+    ego_center_map_frame.SelfRotate(path_point.theta());
+    ego_center_map_frame.set_x(ego_center_map_frame.x() + path_point.x());
+    ego_center_map_frame.set_y(ego_center_map_frame.y() + path_point.y());
+    path_s_.push_back(path_s);
+    adc_boxes_.emplace_back(ego_center_map_frame, path_point.theta(),
+                            vehicle_param.length(),
+                            vehicle_param.width() + l_buffer * 2);
+  }
+
+  num_leaves_ = 1;
+  while (num_leaves_ < adc_boxes_.size()) {
+    num_leaves_ <<= 1;
+  }
+  const size_t num_nodes = num_leaves_ * 2;
+  const double inf = std::numeric_limits<double>::infinity();
+  min_x_.assign(num_nodes, inf);
+  max_x_.assign(num_nodes, -inf);
+  min_y_.assign(num_nodes, inf);
+  max_y_.assign(num_nodes, -inf);
+  for (size_t i = 0; i < adc_boxes_.size(); ++i) {
+    const size_t leaf = num_leaves_ + i;
+    min_x_[leaf] = adc_boxes_[i].min_x();
+    max_x_[leaf] = adc_boxes_[i].max_x();
+    min_y_[leaf] = adc_boxes_[i].min_y();
+    max_y_[leaf] = adc_boxes_[i].max_y();
+  }
+  for (size_t node = num_leaves_ - 1; node >= 1; --node) {
+    min_x_[node] = std::fmin(min_x_[node * 2], min_x_[node * 2 + 1]);
+    max_x_[node] = std::fmax(max_x_[node * 2], max_x_[node * 2 + 1]);
+    min_y_[node] = std::fmin(min_y_[node * 2], min_y_[node * 2 + 1]);
+    max_y_[node] = std::fmax(max_y_[node * 2], max_y_[node * 2 + 1]);
+  }
+}
+
+int PathOverlapIndex::QueryFirstOverlap(const Box2d& obs_box) const {
+  if (adc_boxes_.empty()) {
+    return -1;
+  }
+  return Query(1, obs_box.min_x(), obs_box.max_x(), obs_box.min_y(),
+               obs_box.max_y(), obs_box);
+}
+
+int PathOverlapIndex::Query(const size_t node, const double min_x,
+                            const double max_x, const double min_y,
+                            const double max_y, const Box2d& obs_box) const {
+  if (max_x < min_x_[node] || min_x > max_x_[node] || max_y < min_y_[node] ||
+      min_y > max_y_[node]) {
+    return -1;
+  }
+  if (node >= num_leaves_) {
+    const size_t index = node - num_leaves_;
+    if (index >= adc_boxes_.size() || !obs_box.HasOverlap(adc_boxes_[index])) {
+      return -1;
+    }
+    return static_cast<int>(index);
+  }
+  // Descend into the lower-s half first so that the first hit returned is
+  // the one the linear scan would have found.
+  const int left = Query(node * 2, min_x, max_x, min_y, max_y, obs_box);
+  if (left >= 0) {
+    return left;
+  }
+  return Query(node * 2 + 1, min_x, max_x, min_y, max_y, obs_box);
+}
+
 STBoundaryMapper::STBoundaryMapper(
     const SpeedBoundsDeciderConfig& config, const ReferenceLine& reference_line,
     const PathData& path_data, const double planning_distance,
@@ -245,21 +325,30 @@ bool STBoundaryMapper::GetOverlapBoundaryPoints(
     }
   } else {
     // For those with predicted trajectories (moving obstacles):
-    // 1. Subsample to reduce computation time.
+    // 1. Subsample to reduce computation time, and index the sampled ADC
+    //    footprints once; the index is shared by every obstacle mapped in
+    //    this cycle.
     const int default_num_point = 50;
-    DiscretizedPath discretized_path;
-    if (path_points.size() > 2 * default_num_point) {
-      const auto ratio = path_points.size() / default_num_point;
-      std::vector<PathPoint> sampled_path_points;
-      for (size_t i = 0; i < path_points.size(); ++i) {
-        if (i % ratio == 0) {
-          sampled_path_points.push_back(path_points[i]);
+    if (path_overlap_index_ == nullptr) {
+      if (path_points.size() > 2 * default_num_point) {
+        const auto ratio = path_points.size() / default_num_point;
+        std::vector<PathPoint> sampled_path_points;
+        for (size_t i = 0; i < path_points.size(); ++i) {
+          if (i % ratio == 0) {
+            sampled_path_points.push_back(path_points[i]);
+          }
         }
+        sampled_path_ = DiscretizedPath(std::move(sampled_path_points));
+      } else {
+        sampled_path_ = DiscretizedPath(path_points);
       }
-      discretized_path = DiscretizedPath(std::move(sampled_path_points));
-    } else {
-      discretized_path = DiscretizedPath(path_points);
+      const double step_length = vehicle_param_.front_edge_to_center();
+      const auto path_len =
+          std::min(FLAGS_max_trajectory_len, sampled_path_.Length());
+      path_overlap_index_.reset(new PathOverlapIndex(
+          sampled_path_, step_length, path_len, vehicle_param_, l_buffer));
     }
+    const DiscretizedPath& discretized_path = sampled_path_;
     // 2. Go through every point of the predicted obstacle trajectory.
     for (int i = 0; i < trajectory.trajectory_point_size(); ++i) {
       const auto& trajectory_point = trajectory.trajectory_point(i);
@@ -272,62 +361,57 @@ bool STBoundaryMapper::GetOverlapBoundaryPoints(
       }
 
       const double step_length = vehicle_param_.front_edge_to_center();
-      auto path_len =
-          std::min(FLAGS_max_trajectory_len, discretized_path.Length());
-      // Go through every point of the ADC's path.
-      for (double path_s = 0.0; path_s < path_len; path_s += step_length) {
-        const auto curr_adc_path_point =
-            discretized_path.Evaluate(path_s + discretized_path.front().s());
-        if (CheckOverlap(curr_adc_path_point, obs_box, l_buffer)) {
-          // Found overlap, start searching with higher resolution
-          const double backward_distance = -step_length;
-          const double forward_distance = vehicle_param_.length() +
-                                          vehicle_param_.width() +
-                                          obs_box.length() + obs_box.width();
-          const double default_min_step = 0.1;  // in meters
-          const double fine_tuning_step_length = std::fmin(
-              default_min_step, discretized_path.Length() / default_num_point);
-
-          bool find_low = false;
-          bool find_high = false;
-          double low_s = std::fmax(0.0, path_s + backward_distance);
-          double high_s =
-              std::fmin(discretized_path.Length(), path_s + forward_distance);
-
-          // Keep shrinking by the resolution bidirectionally until finally
-          // locating the tight upper and lower bounds.
-          while (low_s < high_s) {
-            if (find_low && find_high) {
-              break;
-            }
-            if (!find_low) {
-              const auto& point_low = discretized_path.Evaluate(
-                  low_s + discretized_path.front().s());
-              if (!CheckOverlap(point_low, obs_box, l_buffer)) {
-                low_s += fine_tuning_step_length;
-              } else {
-                find_low = true;
-              }
-            }
-            if (!find_high) {
-              const auto& point_high = discretized_path.Evaluate(
-                  high_s + discretized_path.front().s());
-              if (!CheckOverlap(point_high, obs_box, l_buffer)) {
-                high_s -= fine_tuning_step_length;
-              } else {
-                find_high = true;
-              }
+      // Probe the index for the lowest overlapping point of the ADC's path.
+      const int first_overlap = path_overlap_index_->QueryFirstOverlap(obs_box);
+      if (first_overlap >= 0) {
+        const double path_s = path_overlap_index_->path_s(first_overlap);
+        // Found overlap, start searching with higher resolution
+        const double backward_distance = -step_length;
+        const double forward_distance = vehicle_param_.length() +
+                                        vehicle_param_.width() +
+                                        obs_box.length() + obs_box.width();
+        const double default_min_step = 0.1;  // in meters
+        const double fine_tuning_step_length = std::fmin(
+            default_min_step, discretized_path.Length() / default_num_point);
+
+        bool find_low = false;
+        bool find_high = false;
+        double low_s = std::fmax(0.0, path_s + backward_distance);
+        double high_s =
+            std::fmin(discretized_path.Length(), path_s + forward_distance);
+
+        // Keep shrinking by the resolution bidirectionally until finally
+        // locating the tight upper and lower bounds.
+        while (low_s < high_s) {
+          if (find_low && find_high) {
+            break;
+          }
+          if (!find_low) {
+            const auto& point_low = discretized_path.Evaluate(
+                low_s + discretized_path.front().s());
+            if (!CheckOverlap(point_low, obs_box, l_buffer)) {
+              low_s += fine_tuning_step_length;
+            } else {
+              find_low = true;
             }
           }
-          if (find_high && find_low) {
-            lower_points->emplace_back(
-                low_s - speed_bounds_config_.point_extension(),
-                trajectory_point_time);
-            upper_points->emplace_back(
-                high_s + speed_bounds_config_.point_extension(),
-                trajectory_point_time);
+          if (!find_high) {
+            const auto& point_high = discretized_path.Evaluate(
+                high_s + discretized_path.front().s());
+            if (!CheckOverlap(point_high, obs_box, l_buffer)) {
+              high_s -= fine_tuning_step_length;
+            } else {
+              find_high = true;
+            }
           }
-          break;
+        }
+        if (find_high && find_low) {
+          lower_points->emplace_back(
+              low_s - speed_bounds_config_.point_extension(),
+              trajectory_point_time);
+          upper_points->emplace_back(
+              high_s + speed_bounds_config_.point_extension(),
+              trajectory_point_time);
         }
       }
     }
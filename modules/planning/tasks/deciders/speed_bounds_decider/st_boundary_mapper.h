@@ -25,9 +25,11 @@
 #include <vector>
 
 #include "modules/common/configs/proto/vehicle_config.pb.h"
+#include "modules/common/math/box2d.h"
 #include "modules/common/status/status.h"
 #include "modules/planning/common/dependency_injector.h"
 #include "modules/planning/common/obstacle.h"
+#include "modules/planning/common/path/discretized_path.h"
 #include "modules/planning/common/path/path_data.h"
 #include "modules/planning/common/path_decision.h"
 #include "modules/planning/common/speed/st_boundary.h"
@@ -38,6 +40,46 @@
 namespace apollo {
 namespace planning {
 
+/**
+ * @brief An interval index over the coarse path sample grid used when
+ * mapping obstacles onto the ST-graph. The ADC bounding box at every
+ * sampled path point is materialized once, together with a binary tree of
+ * merged axis-aligned bounding boxes over the s-ordered samples, so that
+ * each obstacle trajectory point only probes the few path samples whose
+ * footprints can possibly overlap it instead of scanning the whole path.
+ */
+class PathOverlapIndex {
+ public:
+  PathOverlapIndex(const DiscretizedPath& path, const double step_length,
+                   const double path_length,
+                   const common::VehicleParam& vehicle_param,
+                   const double l_buffer);
+
+  /** @brief Returns the index of the first sampled path point whose ADC
+   * bounding box overlaps the given obstacle box, or -1 if none does.
+   */
+  int QueryFirstOverlap(const common::math::Box2d& obs_box) const;
+
+  size_t size() const { return path_s_.size(); }
+
+  double path_s(const size_t index) const { return path_s_[index]; }
+
+ private:
+  int Query(const size_t node, const double min_x, const double max_x,
+            const double min_y, const double max_y,
+            const common::math::Box2d& obs_box) const;
+
+  std::vector<double> path_s_;
+  std::vector<common::math::Box2d> adc_boxes_;
+  // Merged bounding boxes of an implicit binary tree whose leaves are the
+  // ADC boxes above, padded to a power of two.
+  size_t num_leaves_ = 0;
+  std::vector<double> min_x_;
+  std::vector<double> max_x_;
+  std::vector<double> min_y_;
+  std::vector<double> max_y_;
+};
+
 class STBoundaryMapper {
  public:
   STBoundaryMapper(const SpeedBoundsDeciderConfig& config,
@@ -100,6 +142,12 @@ class STBoundaryMapper {
   const double planning_max_distance_;
   const double planning_max_time_;
   std::shared_ptr<DependencyInjector> injector_;
+
+  // The subsampled path and its overlap index depend only on the path and
+  // the lane-change status, both fixed for the lifetime of a mapper, so
+  // they are built on first use and shared by every mapped obstacle.
+  mutable DiscretizedPath sampled_path_;
+  mutable std::unique_ptr<PathOverlapIndex> path_overlap_index_;
 };
 
 }  // namespace planning
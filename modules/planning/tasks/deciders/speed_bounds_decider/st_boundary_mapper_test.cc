@@ -91,5 +91,70 @@ TEST_F(StBoundaryMapperTest, check_overlap_test) {
   EXPECT_TRUE(mapper.CheckOverlap(path_point, box, 0.0));
 }
 
+TEST_F(StBoundaryMapperTest, path_overlap_index_test) {
+  std::vector<common::PathPoint> path_points;
+  for (int i = 0; i <= 100; ++i) {
+    common::PathPoint point;
+    point.set_x(i * 1.0);
+    point.set_y(0.0);
+    point.set_theta(0.0);
+    point.set_s(i * 1.0);
+    path_points.push_back(std::move(point));
+  }
+  DiscretizedPath path(std::move(path_points));
+
+  common::VehicleParam vehicle_param;
+  vehicle_param.set_length(4.6);
+  vehicle_param.set_width(2.0);
+  vehicle_param.set_front_edge_to_center(3.4);
+  vehicle_param.set_back_edge_to_center(1.2);
+  vehicle_param.set_left_edge_to_center(1.0);
+  vehicle_param.set_right_edge_to_center(1.0);
+
+  const double step_length = vehicle_param.front_edge_to_center();
+  const double l_buffer = 0.4;
+  PathOverlapIndex index(path, step_length, path.Length(), vehicle_param,
+                         l_buffer);
+
+  // The index must return exactly what a linear scan over the same sample
+  // grid would have found.
+  auto linear_first_overlap = [&](const common::math::Box2d& obs_box) {
+    for (size_t i = 0; i < index.size(); ++i) {
+      const auto path_point = path.Evaluate(index.path_s(i) + path.front().s());
+      common::math::Vec2d center((vehicle_param.front_edge_to_center() -
+                                  vehicle_param.back_edge_to_center()) *
+                                     0.5,
+                                 (vehicle_param.left_edge_to_center() -
+                                  vehicle_param.right_edge_to_center()) *
+                                     0.5);
+      center.SelfRotate(path_point.theta());
+      center.set_x(center.x() + path_point.x());
+      center.set_y(center.y() + path_point.y());
+      common::math::Box2d adc_box(center, path_point.theta(),
+                                  vehicle_param.length(),
+                                  vehicle_param.width() + l_buffer * 2);
+      if (obs_box.HasOverlap(adc_box)) {
+        return static_cast<int>(i);
+      }
+    }
+    return -1;
+  };
+
+  for (double x = -10.0; x <= 110.0; x += 3.7) {
+    for (double y : {-5.0, -1.5, 0.0, 1.5, 5.0}) {
+      for (double heading : {0.0, 0.6, 1.8}) {
+        common::math::Box2d obs_box(common::math::Vec2d(x, y), heading, 4.0,
+                                    1.8);
+        EXPECT_EQ(linear_first_overlap(obs_box),
+                  index.QueryFirstOverlap(obs_box));
+      }
+    }
+  }
+
+  // Far away from the path on either side.
+  common::math::Box2d far_box(common::math::Vec2d(50.0, 100.0), 0.0, 4.0, 1.8);
+  EXPECT_EQ(-1, index.QueryFirstOverlap(far_box));
+}
+
 }  // namespace planning
 }  // namespace apollo
@@ -20,11 +20,14 @@
 
 #include "modules/planning/tasks/learning_model/learning_model_inference_task.h"
 
+#include <chrono>
 #include <cmath>
 #include <limits>
 #include <string>
+#include <utility>
 
 #include "absl/strings/str_cat.h"
+#include "cyber/task/task.h"
 #include "modules/planning/learning_based/model_inference/trajectory_imitation_libtorch_inference.h"
 #include "modules/planning/proto/learning_data.pb.h"
 #include "modules/planning/proto/planning_config.pb.h"
@@ -55,7 +58,18 @@ Status LearningModelInferenceTask::Execute(
 Status LearningModelInferenceTask::Process(Frame* frame) {
   CHECK_NOTNULL(frame);
 
-  const auto& config = config_.learning_model_inference_task_config();
+  // a job submitted on an earlier cycle may still be running after its
+  // cycle timed out; never race a second job on the same model instance
+  if (inference_future_.valid()) {
+    if (inference_future_.wait_for(std::chrono::seconds(0)) !=
+        std::future_status::ready) {
+      AWARN << "previous learning model inference still running. "
+               "Skip inference and fall back to rule-based path.";
+      return Status::OK();
+    }
+    // drain the stale result; its features belong to an old frame
+    inference_future_.get();
+  }
 
   LearningDataFrame learning_data_frame;
   learning_data_frame.CopyFrom(
@@ -76,6 +90,37 @@ Status LearningModelInferenceTask::Process(Frame* frame) {
     return Status(ErrorCode::PLANNING_ERROR, msg);
   }
 
+  const auto frame_num = learning_data_frame.frame_num();
+  inference_future_ =
+      cyber::Async(&LearningModelInferenceTask::RunInference, this,
+                   std::move(learning_data_frame));
+  if (inference_future_.wait_for(std::chrono::duration<double, std::milli>(
+          FLAGS_learning_model_inference_timeout_ms)) !=
+      std::future_status::ready) {
+    AWARN << "learning model inference exceeded "
+          << FLAGS_learning_model_inference_timeout_ms << " ms. frame_num["
+          << frame_num << "]. Fall back to rule-based path.";
+    return Status::OK();
+  }
+
+  const Status inference_status = inference_future_.get();
+  if (!inference_status.ok()) {
+    return inference_status;
+  }
+
+  ADEBUG << "adc_future_trajectory_size: "
+         << async_adc_future_trajectory_.size();
+  frame->mutable_learning_based_data()
+      ->set_learning_data_adc_future_trajectory_points(
+          async_adc_future_trajectory_);
+
+  return Status::OK();
+}
+
+Status LearningModelInferenceTask::RunInference(
+    LearningDataFrame learning_data_frame) {
+  const auto& config = config_.learning_model_inference_task_config();
+
   const double start_point_timestamp_sec =
       learning_data_frame
           .adc_trajectory_point(
@@ -169,17 +214,12 @@ Status LearningModelInferenceTask::Process(Frame* frame) {
       &evaluated_future_trajectory);
 
   // convert to common::TrajectoryPoint
-  std::vector<common::TrajectoryPoint> adc_future_trajectory;
   ConvertADCFutureTrajectory(evaluated_future_trajectory,
-                             &adc_future_trajectory);
-  ADEBUG << "adc_future_trajectory_size: " << adc_future_trajectory.size();
-  // for (const auto& t : adc_future_trajectory) {
+                             &async_adc_future_trajectory_);
+  // for (const auto& t : async_adc_future_trajectory_) {
   //   AERROR << "FUTURE After: " << t.relative_time();
   // }
 
-  frame->mutable_learning_based_data()
-       ->set_learning_data_adc_future_trajectory_points(adc_future_trajectory);
-
   return Status::OK();
 }
 
@@ -20,6 +20,7 @@
 
 #pragma once
 
+#include <future>
 #include <memory>
 #include <utility>
 #include <vector>
@@ -41,12 +42,26 @@ class LearningModelInferenceTask : public Task {
  private:
   apollo::common::Status Process(Frame *frame);
 
+  /**
+   * @brief The full inference pipeline (trajectory evaluation, model
+   * inference and output post-processing) run on a cyber task thread. The
+   * result is written to async_adc_future_trajectory_, which must only be
+   * read after inference_future_ becomes ready.
+   */
+  apollo::common::Status RunInference(LearningDataFrame learning_data_frame);
+
   void ConvertADCFutureTrajectory(
       const std::vector<TrajectoryPointFeature> &trajectory,
       std::vector<common::TrajectoryPoint> *adc_future_trajectory);
 
   std::unique_ptr<TrajectoryImitationLibtorchInference>
       trajectory_imitation_inference_;
+
+  // at most one inference job is in flight at any time; when a job outlives
+  // FLAGS_learning_model_inference_timeout_ms the cycle proceeds without a
+  // path reference and the job is drained on a later cycle
+  std::future<apollo::common::Status> inference_future_;
+  std::vector<common::TrajectoryPoint> async_adc_future_trajectory_;
 };
 
 }  // namespace planning
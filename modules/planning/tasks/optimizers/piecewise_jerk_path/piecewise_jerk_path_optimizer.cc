@@ -240,6 +240,8 @@ bool PiecewiseJerkPathOptimizer::OptimizePath(
   const size_t kNumKnots = lat_boundaries.size();
   PiecewiseJerkPathProblem piecewise_jerk_problem(kNumKnots, delta_s,
                                                   init_state);
+  piecewise_jerk_problem.set_enable_warm_start(
+      FLAGS_enable_piecewise_jerk_warm_start);
 
   // TODO(Hongyi): update end_state settings
   piecewise_jerk_problem.set_end_state_ref({1000.0, 0.0, 0.0}, end_state);
@@ -75,6 +75,8 @@ Status PiecewiseJerkSpeedOptimizer::Process(const PathData& path_data,
 
   PiecewiseJerkSpeedProblem piecewise_jerk_problem(num_of_knots, delta_t,
                                                    init_s);
+  piecewise_jerk_problem.set_enable_warm_start(
+      FLAGS_enable_piecewise_jerk_warm_start);
 
   const auto& config = config_.piecewise_jerk_speed_optimizer_config();
   piecewise_jerk_problem.set_weight_ddx(config.acc_weight());
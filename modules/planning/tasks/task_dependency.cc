@@ -0,0 +1,81 @@
+/******************************************************************************
+ * Copyright 2020 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+/**
+ * @file
+ **/
+
+#include "modules/planning/tasks/task_dependency.h"
+
+#include <unordered_set>
+
+namespace apollo {
+namespace planning {
+
+namespace {
+
+// Each set lists task types that only read state produced by earlier groups
+// and write outputs none of the others touch. Extend a set only after
+// auditing both the reads and the writes of every member against each other.
+const std::vector<std::unordered_set<int>> kIndependentTaskSets = {
+    // These deciders inspect the previous cycle's result and the obstacle
+    // list, and record their conclusions in disjoint status and decision
+    // fields; none of them consumes another one's output.
+    {TaskConfig::PATH_REUSE_DECIDER, TaskConfig::PATH_LANE_BORROW_DECIDER,
+     TaskConfig::RULE_BASED_STOP_DECIDER},
+};
+
+}  // namespace
+
+bool TaskDependency::AreIndependent(const TaskConfig::TaskType first,
+                                    const TaskConfig::TaskType second) {
+  if (first == second) {
+    return false;
+  }
+  for (const auto& task_set : kIndependentTaskSets) {
+    if (task_set.count(first) > 0 && task_set.count(second) > 0) {
+      return true;
+    }
+  }
+  return false;
+}
+
+std::vector<std::vector<Task*>> TaskDependency::PartitionIndependentGroups(
+    const std::vector<Task*>& task_list) {
+  std::vector<std::vector<Task*>> task_groups;
+  for (Task* const task : task_list) {
+    const auto task_type = task->Config().task_type();
+    bool joins_last_group = false;
+    if (!task_groups.empty()) {
+      joins_last_group = true;
+      for (const Task* const member : task_groups.back()) {
+        if (!AreIndependent(member->Config().task_type(), task_type)) {
+          joins_last_group = false;
+          break;
+        }
+      }
+    }
+    if (joins_last_group) {
+      task_groups.back().push_back(task);
+    } else {
+      task_groups.emplace_back(std::vector<Task*>{task});
+    }
+  }
+  return task_groups;
+}
+
+}  // namespace planning
+}  // namespace apollo
@@ -0,0 +1,63 @@
+/******************************************************************************
+ * Copyright 2020 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+/**
+ * @file
+ **/
+
+#pragma once
+
+#include <vector>
+
+#include "modules/planning/proto/planning_config.pb.h"
+#include "modules/planning/tasks/task.h"
+
+namespace apollo {
+namespace planning {
+
+/**
+ * @class TaskDependency
+ *
+ * @brief Declares which planning tasks are known to touch disjoint state,
+ * so that a stage may run them concurrently. Any pair of task types that is
+ * not explicitly declared independent here is treated as dependent, which
+ * keeps the schedule conservative for tasks nobody has audited yet.
+ */
+class TaskDependency {
+ public:
+  TaskDependency() = delete;
+
+  /**
+   * @brief Returns true if the two task types are declared mutually
+   * independent, i.e. neither one reads state the other writes.
+   */
+  static bool AreIndependent(const TaskConfig::TaskType first,
+                             const TaskConfig::TaskType second);
+
+  /**
+   * @brief Partitions an ordered task list into consecutive groups whose
+   * members are pairwise independent. The configured task order is kept
+   * between groups, so executing the groups in sequence while running the
+   * tasks inside one group concurrently respects every declared
+   * dependency. A task with no declared-independent neighbor forms a group
+   * of its own.
+   */
+  static std::vector<std::vector<Task*>> PartitionIndependentGroups(
+      const std::vector<Task*>& task_list);
+};
+
+}  // namespace planning
+}  // namespace apollo
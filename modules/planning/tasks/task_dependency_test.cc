@@ -0,0 +1,80 @@
+/******************************************************************************
+ * Copyright 2020 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "modules/planning/tasks/task_dependency.h"
+
+#include <memory>
+
+#include "gtest/gtest.h"
+
+namespace apollo {
+namespace planning {
+
+namespace {
+
+std::unique_ptr<Task> MakeTask(const TaskConfig::TaskType task_type) {
+  TaskConfig config;
+  config.set_task_type(task_type);
+  return std::unique_ptr<Task>(new Task(config));
+}
+
+}  // namespace
+
+TEST(TaskDependencyTest, AreIndependent) {
+  EXPECT_TRUE(TaskDependency::AreIndependent(
+      TaskConfig::PATH_REUSE_DECIDER, TaskConfig::PATH_LANE_BORROW_DECIDER));
+  EXPECT_TRUE(TaskDependency::AreIndependent(
+      TaskConfig::RULE_BASED_STOP_DECIDER, TaskConfig::PATH_REUSE_DECIDER));
+  // Unaudited pairs are dependent by default.
+  EXPECT_FALSE(TaskDependency::AreIndependent(
+      TaskConfig::PATH_BOUNDS_DECIDER, TaskConfig::PATH_REUSE_DECIDER));
+  // A task is never independent of another instance of its own type.
+  EXPECT_FALSE(TaskDependency::AreIndependent(
+      TaskConfig::PATH_REUSE_DECIDER, TaskConfig::PATH_REUSE_DECIDER));
+}
+
+TEST(TaskDependencyTest, PartitionIndependentGroups) {
+  std::vector<std::unique_ptr<Task>> tasks;
+  tasks.push_back(MakeTask(TaskConfig::LANE_CHANGE_DECIDER));
+  tasks.push_back(MakeTask(TaskConfig::PATH_REUSE_DECIDER));
+  tasks.push_back(MakeTask(TaskConfig::PATH_LANE_BORROW_DECIDER));
+  tasks.push_back(MakeTask(TaskConfig::RULE_BASED_STOP_DECIDER));
+  tasks.push_back(MakeTask(TaskConfig::PATH_BOUNDS_DECIDER));
+
+  std::vector<Task*> task_list;
+  for (const auto& task : tasks) {
+    task_list.push_back(task.get());
+  }
+
+  const auto groups = TaskDependency::PartitionIndependentGroups(task_list);
+  ASSERT_EQ(3U, groups.size());
+  EXPECT_EQ(1U, groups[0].size());
+  EXPECT_EQ(task_list[0], groups[0][0]);
+  ASSERT_EQ(3U, groups[1].size());
+  EXPECT_EQ(task_list[1], groups[1][0]);
+  EXPECT_EQ(task_list[2], groups[1][1]);
+  EXPECT_EQ(task_list[3], groups[1][2]);
+  EXPECT_EQ(1U, groups[2].size());
+  EXPECT_EQ(task_list[4], groups[2][0]);
+}
+
+TEST(TaskDependencyTest, EmptyTaskList) {
+  const auto groups = TaskDependency::PartitionIndependentGroups({});
+  EXPECT_TRUE(groups.empty());
+}
+
+}  // namespace planning
+}  // namespace apollo
@@ -0,0 +1,205 @@
+/******************************************************************************
+ * Copyright 2021 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+/**
+ * @file
+ * @brief Replays recorded planning inputs through OnLanePlanning::RunOnce in
+ * a loop and reports per-task latency percentiles, using the task names the
+ * stages already record into latency_stats. Intended to quantify
+ * decider/optimizer runtime regressions per commit, e.g.
+ *
+ * planning_cycle_benchmark \
+ *   --benchmark_data_dir=modules/planning/testdata/garage_test \
+ *   --benchmark_routing_response_file=garage_routing.pb.txt \
+ *   --benchmark_localization_file=stop_obstacle_localization.pb.txt \
+ *   --benchmark_chassis_file=stop_obstacle_chassis.pb.txt \
+ *   --benchmark_prediction_file=stop_obstacle_prediction.pb.txt
+ */
+
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "cyber/common/file.h"
+#include "cyber/cyber.h"
+#include "modules/canbus/proto/chassis.pb.h"
+#include "modules/common/configs/config_gflags.h"
+#include "modules/common/time/time.h"
+#include "modules/localization/proto/localization.pb.h"
+#include "modules/perception/proto/traffic_light_detection.pb.h"
+#include "modules/planning/common/dependency_injector.h"
+#include "modules/planning/common/planning_gflags.h"
+#include "modules/planning/on_lane_planning.h"
+#include "modules/planning/proto/planning.pb.h"
+#include "modules/planning/proto/planning_config.pb.h"
+#include "modules/prediction/proto/prediction_obstacle.pb.h"
+#include "modules/routing/proto/routing.pb.h"
+
+DEFINE_string(benchmark_data_dir, "modules/planning/testdata/garage_test",
+              "directory holding the recorded input fixtures");
+DEFINE_string(benchmark_routing_response_file, "garage_routing.pb.txt",
+              "routing response fixture, relative to benchmark_data_dir");
+DEFINE_string(benchmark_localization_file, "", "localization fixture");
+DEFINE_string(benchmark_chassis_file, "", "chassis fixture");
+DEFINE_string(benchmark_prediction_file, "", "prediction fixture");
+DEFINE_string(benchmark_traffic_light_file, "",
+              "optional traffic light fixture");
+DEFINE_string(benchmark_planning_config_file,
+              "/apollo/modules/planning/conf/planning_config.pb.txt",
+              "planning config used for the benchmark");
+DEFINE_string(benchmark_map_dir, "/apollo/modules/planning/testdata",
+              "map directory matching the recorded fixtures");
+DEFINE_int32(benchmark_iterations, 200, "number of measured planning cycles");
+DEFINE_int32(benchmark_warmup_iterations, 10,
+             "cycles run before measurement starts");
+
+namespace apollo {
+namespace planning {
+namespace {
+
+using apollo::common::time::Clock;
+
+template <typename T>
+bool LoadFixture(const std::string& file_name, T* proto) {
+  const std::string path = FLAGS_benchmark_data_dir + "/" + file_name;
+  if (!cyber::common::GetProtoFromFile(path, proto)) {
+    AERROR << "failed to load fixture: " << path;
+    return false;
+  }
+  return true;
+}
+
+double Percentile(std::vector<double>* samples, const double percent) {
+  const size_t index = static_cast<size_t>(
+      percent / 100.0 * static_cast<double>(samples->size() - 1) + 0.5);
+  std::nth_element(samples->begin(), samples->begin() + index, samples->end());
+  return (*samples)[index];
+}
+
+void ReportLatency(const std::string& name, std::vector<double>* samples) {
+  double sum = 0.0;
+  double max = 0.0;
+  for (const double sample : *samples) {
+    sum += sample;
+    max = std::max(max, sample);
+  }
+  std::cout << std::left << std::setw(48) << name << std::right << std::fixed
+            << std::setprecision(3) << std::setw(10)
+            << sum / static_cast<double>(samples->size()) << std::setw(10)
+            << Percentile(samples, 50.0) << std::setw(10)
+            << Percentile(samples, 90.0) << std::setw(10)
+            << Percentile(samples, 99.0) << std::setw(10) << max << std::endl;
+}
+
+bool RunBenchmark() {
+  FLAGS_map_dir = FLAGS_benchmark_map_dir;
+  // keep single-cycle runtime self-contained and repeatable, as the
+  // integration tests do
+  FLAGS_enable_reference_line_provider_thread = false;
+  FLAGS_align_prediction_time = false;
+
+  auto chassis = std::make_shared<canbus::Chassis>();
+  auto localization = std::make_shared<localization::LocalizationEstimate>();
+  auto prediction = std::make_shared<prediction::PredictionObstacles>();
+  auto routing_response = std::make_shared<routing::RoutingResponse>();
+  auto traffic_light = std::make_shared<perception::TrafficLightDetection>();
+  if (!LoadFixture(FLAGS_benchmark_chassis_file, chassis.get()) ||
+      !LoadFixture(FLAGS_benchmark_localization_file, localization.get()) ||
+      !LoadFixture(FLAGS_benchmark_prediction_file, prediction.get()) ||
+      !LoadFixture(FLAGS_benchmark_routing_response_file,
+                   routing_response.get())) {
+    return false;
+  }
+  if (!FLAGS_benchmark_traffic_light_file.empty() &&
+      !LoadFixture(FLAGS_benchmark_traffic_light_file, traffic_light.get())) {
+    return false;
+  }
+
+  LocalView local_view;
+  local_view.chassis = chassis;
+  local_view.localization_estimate = localization;
+  local_view.prediction_obstacles = prediction;
+  local_view.routing = routing_response;
+  local_view.traffic_light = traffic_light;
+
+  PlanningConfig config;
+  if (!cyber::common::GetProtoFromFile(FLAGS_benchmark_planning_config_file,
+                                       &config)) {
+    AERROR << "failed to load planning config: "
+           << FLAGS_benchmark_planning_config_file;
+    return false;
+  }
+
+  auto injector = std::make_shared<DependencyInjector>();
+  OnLanePlanning planning(injector);
+  if (!planning.Init(config).ok()) {
+    AERROR << "failed to init planning";
+    return false;
+  }
+
+  std::vector<double> total_time_ms;
+  std::map<std::string, std::vector<double>> task_time_ms;
+  const int total_iterations =
+      FLAGS_benchmark_warmup_iterations + FLAGS_benchmark_iterations;
+  for (int i = 0; i < total_iterations; ++i) {
+    // move the recorded inputs to "now" so staleness checks and trajectory
+    // stitching behave as they do on the vehicle, while task latencies are
+    // still measured against the real clock
+    const double now = Clock::NowInSeconds();
+    chassis->mutable_header()->set_timestamp_sec(now);
+    localization->mutable_header()->set_timestamp_sec(now);
+    prediction->mutable_header()->set_timestamp_sec(now);
+
+    ADCTrajectory trajectory;
+    planning.RunOnce(local_view, &trajectory);
+    if (i < FLAGS_benchmark_warmup_iterations) {
+      continue;
+    }
+    total_time_ms.push_back(trajectory.latency_stats().total_time_ms());
+    for (const auto& task_stats : trajectory.latency_stats().task_stats()) {
+      task_time_ms[task_stats.name()].push_back(task_stats.time_ms());
+    }
+  }
+  if (total_time_ms.empty()) {
+    AERROR << "no planning cycle was measured";
+    return false;
+  }
+
+  std::cout << std::left << std::setw(48) << "task" << std::right
+            << std::setw(10) << "mean_ms" << std::setw(10) << "p50_ms"
+            << std::setw(10) << "p90_ms" << std::setw(10) << "p99_ms"
+            << std::setw(10) << "max_ms" << std::endl;
+  for (auto& entry : task_time_ms) {
+    ReportLatency(entry.first, &entry.second);
+  }
+  ReportLatency("TOTAL", &total_time_ms);
+  std::cout << "cycles: " << total_time_ms.size() << std::endl;
+  return true;
+}
+
+}  // namespace
+}  // namespace planning
+}  // namespace apollo
+
+int main(int argc, char** argv) {
+  google::ParseCommandLineFlags(&argc, &argv, true);
+  apollo::cyber::Init(argv[0]);
+  return apollo::planning::RunBenchmark() ? 0 : 1;
+}
@@ -38,6 +38,7 @@
 #include "modules/planning/common/util/common.h"
 #include "modules/planning/common/util/util.h"
 #include "modules/planning/proto/planning_status.pb.h"
+#include "modules/planning/traffic_rules/traffic_rule_context.h"
 
 namespace apollo {
 namespace planning {
@@ -131,14 +132,22 @@ void Crosswalk::MakeDecisions(Frame* const frame,
       continue;
     }
 
+    // per-crosswalk quantities, hoisted out of the obstacle loop
+    const double stop_deceleration = util::GetADCStopDeceleration(
+        injector_->vehicle_state(), adc_front_edge_s,
+        crosswalk_overlap->start_s);
+    // expand crosswalk polygon
+    // note: crosswalk expanded area will include sideway area
+    const Polygon2d crosswalk_exp_poly =
+        crosswalk_ptr->polygon().ExpandByDistance(
+            config_.crosswalk().expand_s_distance());
+
     std::vector<std::string> pedestrians;
     for (const auto* obstacle : path_decision->obstacles().Items()) {
-      const double stop_deceleration = util::GetADCStopDeceleration(
-          injector_->vehicle_state(), adc_front_edge_s,
-          crosswalk_overlap->start_s);
-
-      bool stop = CheckStopForObstacle(reference_line_info, crosswalk_ptr,
-                                       *obstacle, stop_deceleration);
+      bool stop =
+          CheckStopForObstacle(reference_line_info, crosswalk_ptr,
+                               crosswalk_exp_poly, *obstacle,
+                               stop_deceleration);
 
       const std::string& obstacle_id = obstacle->Id();
       const PerceptionObstacle& perception_obstacle = obstacle->Perception();
@@ -259,7 +268,8 @@ bool Crosswalk::FindCrosswalks(ReferenceLineInfo* const reference_line_info) {
 
 bool Crosswalk::CheckStopForObstacle(
     ReferenceLineInfo* const reference_line_info,
-    const CrosswalkInfoConstPtr crosswalk_ptr, const Obstacle& obstacle,
+    const CrosswalkInfoConstPtr crosswalk_ptr,
+    const Polygon2d& crosswalk_exp_poly, const Obstacle& obstacle,
     const double stop_deceleration) {
   CHECK_NOTNULL(reference_line_info);
 
@@ -281,13 +291,8 @@ bool Crosswalk::CheckStopForObstacle(
     return false;
   }
 
-  // expand crosswalk polygon
-  // note: crosswalk expanded area will include sideway area
   Vec2d point(perception_obstacle.position().x(),
               perception_obstacle.position().y());
-  const Polygon2d crosswalk_exp_poly =
-      crosswalk_ptr->polygon().ExpandByDistance(
-          config_.crosswalk().expand_s_distance());
   bool in_expanded_crosswalk = crosswalk_exp_poly.IsPointIn(point);
 
   if (!in_expanded_crosswalk) {
@@ -299,8 +304,10 @@ bool Crosswalk::CheckStopForObstacle(
 
   const auto& reference_line = reference_line_info->reference_line();
 
-  common::SLPoint obstacle_sl_point;
-  reference_line.XYToSL(perception_obstacle.position(), &obstacle_sl_point);
+  // shared per-cycle projection; the same obstacle is checked against every
+  // crosswalk on the reference line
+  const common::SLPoint& obstacle_sl_point =
+      context_->GetObstacleSLPosition(obstacle);
   auto& obstacle_sl_boundary = obstacle.PerceptionSLBoundary();
   const double obstacle_l_distance =
       std::min(std::fabs(obstacle_sl_boundary.start_l()),
@@ -24,6 +24,7 @@
 #include <string>
 #include <vector>
 
+#include "modules/common/math/polygon2d.h"
 #include "modules/planning/common/planning_context.h"
 #include "modules/planning/traffic_rules/traffic_rule.h"
 
@@ -45,6 +46,7 @@ class Crosswalk : public TrafficRule {
   bool FindCrosswalks(ReferenceLineInfo* const reference_line_info);
   bool CheckStopForObstacle(ReferenceLineInfo* const reference_line_info,
                             const hdmap::CrosswalkInfoConstPtr crosswalk_ptr,
+                            const common::math::Polygon2d& crosswalk_exp_poly,
                             const Obstacle& obstacle,
                             const double stop_deceleration);
 
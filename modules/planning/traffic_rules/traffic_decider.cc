@@ -22,6 +22,7 @@
 
 #include <limits>
 #include <memory>
+#include <utility>
 
 #include "modules/common/configs/vehicle_config_helper.h"
 #include "modules/planning/common/planning_gflags.h"
@@ -152,12 +153,8 @@ void TrafficDecider::BuildPlanningTarget(
   }
 }
 
-Status TrafficDecider::Execute(
-    Frame *frame, ReferenceLineInfo *reference_line_info,
+void TrafficDecider::BuildRules(
     const std::shared_ptr<DependencyInjector> &injector) {
-  CHECK_NOTNULL(frame);
-  CHECK_NOTNULL(reference_line_info);
-
   for (const auto &rule_config : rule_configs_.config()) {
     if (!rule_config.enabled()) {
       ADEBUG << "Rule " << rule_config.rule_id() << " not enabled";
@@ -169,9 +166,27 @@ Status TrafficDecider::Execute(
       AERROR << "Could not find rule " << rule_config.DebugString();
       continue;
     }
+    rules_.emplace_back(std::move(rule));
+  }
+}
+
+Status TrafficDecider::Execute(
+    Frame *frame, ReferenceLineInfo *reference_line_info,
+    const std::shared_ptr<DependencyInjector> &injector) {
+  CHECK_NOTNULL(frame);
+  CHECK_NOTNULL(reference_line_info);
+
+  // construct the enabled rules once; they are reused for every reference
+  // line instead of being re-created by the factory on each pass
+  if (rules_.empty()) {
+    BuildRules(injector);
+  }
+
+  context_.Reset(reference_line_info);
+  for (const auto &rule : rules_) {
+    rule->SetContext(&context_);
     rule->ApplyRule(frame, reference_line_info);
-    ADEBUG << "Applied rule "
-           << TrafficRuleConfig::RuleId_Name(rule_config.rule_id());
+    ADEBUG << "Applied rule " << TrafficRuleConfig::RuleId_Name(rule->Id());
   }
 
   BuildPlanningTarget(reference_line_info);
@@ -21,6 +21,7 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 
 #include "modules/common/proto/pnc_point.pb.h"
 #include "modules/common/status/status.h"
@@ -28,6 +29,7 @@
 #include "modules/planning/proto/traffic_rule_config.pb.h"
 #include "modules/planning/reference_line/reference_line.h"
 #include "modules/planning/traffic_rules/traffic_rule.h"
+#include "modules/planning/traffic_rules/traffic_rule_context.h"
 
 namespace apollo {
 namespace planning {
@@ -59,9 +61,14 @@ class TrafficDecider {
       s_rule_factory;
 
   void RegisterRules();
+  void BuildRules(const std::shared_ptr<DependencyInjector> &injector);
   void BuildPlanningTarget(ReferenceLineInfo *reference_line_info);
 
   TrafficRuleConfigs rule_configs_;
+  // enabled rules, constructed once and reused for every reference line
+  std::vector<std::unique_ptr<TrafficRule>> rules_;
+  // evaluation context shared by all rules, rebuilt per reference line
+  TrafficRuleContext context_;
 };
 
 }  // namespace planning
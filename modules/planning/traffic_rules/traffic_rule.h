@@ -30,6 +30,8 @@
 namespace apollo {
 namespace planning {
 
+class TrafficRuleContext;
+
 class TrafficRule {
  public:
   explicit TrafficRule(const TrafficRuleConfig& config) : config_(config) {}
@@ -39,12 +41,16 @@ class TrafficRule {
   virtual ~TrafficRule() = default;
   virtual TrafficRuleConfig::RuleId Id() const { return config_.rule_id(); }
   const TrafficRuleConfig& GetConfig() const { return config_; }
+  // shared per-cycle evaluation context, set by TrafficDecider before the
+  // rule is applied
+  void SetContext(TrafficRuleContext* context) { context_ = context; }
   virtual common::Status ApplyRule(
       Frame* const frame, ReferenceLineInfo* const reference_line_info) = 0;
 
  protected:
   TrafficRuleConfig config_;
   std::shared_ptr<DependencyInjector> injector_;
+  TrafficRuleContext* context_ = nullptr;
 };
 
 }  // namespace planning
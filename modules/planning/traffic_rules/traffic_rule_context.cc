@@ -0,0 +1,49 @@
+/******************************************************************************
+ * Copyright 2020 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+/**
+ * @file
+ **/
+
+#include "modules/planning/traffic_rules/traffic_rule_context.h"
+
+#include "cyber/common/log.h"
+
+namespace apollo {
+namespace planning {
+
+void TrafficRuleContext::Reset(const ReferenceLineInfo* reference_line_info) {
+  reference_line_info_ = CHECK_NOTNULL(reference_line_info);
+  adc_front_edge_s_ = reference_line_info->AdcSlBoundary().end_s();
+  adc_back_edge_s_ = reference_line_info->AdcSlBoundary().start_s();
+  obstacle_sl_positions_.clear();
+}
+
+const common::SLPoint& TrafficRuleContext::GetObstacleSLPosition(
+    const Obstacle& obstacle) {
+  const auto itr = obstacle_sl_positions_.find(obstacle.Id());
+  if (itr != obstacle_sl_positions_.end()) {
+    return itr->second;
+  }
+  CHECK_NOTNULL(reference_line_info_);
+  common::SLPoint sl_point;
+  reference_line_info_->reference_line().XYToSL(
+      obstacle.Perception().position(), &sl_point);
+  return obstacle_sl_positions_.emplace(obstacle.Id(), sl_point).first->second;
+}
+
+}  // namespace planning
+}  // namespace apollo
@@ -0,0 +1,68 @@
+/******************************************************************************
+ * Copyright 2020 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+/**
+ * @file
+ **/
+
+#pragma once
+
+#include <string>
+#include <unordered_map>
+
+#include "modules/common/proto/pnc_point.pb.h"
+#include "modules/planning/common/obstacle.h"
+#include "modules/planning/common/reference_line_info.h"
+
+namespace apollo {
+namespace planning {
+
+/**
+ * @class TrafficRuleContext
+ * @brief Evaluation context shared by all traffic rules applied to one
+ * reference line in one cycle. It caches quantities that several rules
+ * would otherwise recompute independently, such as the SL projections of
+ * obstacle positions.
+ */
+class TrafficRuleContext {
+ public:
+  TrafficRuleContext() = default;
+
+  /**
+   * @brief rebind the context to a reference line and drop cached values;
+   * called once per reference line before the traffic-rule pass.
+   */
+  void Reset(const ReferenceLineInfo* reference_line_info);
+
+  double adc_front_edge_s() const { return adc_front_edge_s_; }
+  double adc_back_edge_s() const { return adc_back_edge_s_; }
+
+  /**
+   * @brief SL projection of the obstacle's perception position on the
+   * current reference line; computed on first use and memoized for the
+   * rest of the traffic-rule pass.
+   */
+  const common::SLPoint& GetObstacleSLPosition(const Obstacle& obstacle);
+
+ private:
+  const ReferenceLineInfo* reference_line_info_ = nullptr;
+  double adc_front_edge_s_ = 0.0;
+  double adc_back_edge_s_ = 0.0;
+  std::unordered_map<std::string, common::SLPoint> obstacle_sl_positions_;
+};
+
+}  // namespace planning
+}  // namespace apollo
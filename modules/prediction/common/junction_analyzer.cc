@@ -44,8 +44,19 @@ void JunctionAnalyzer::Init(const std::string& junction_id) {
 void JunctionAnalyzer::Clear() {
   // Clear all data
   junction_info_ptr_ = nullptr;
+  junction_range_ = 0.0;
   junction_exits_.clear();
   junction_features_.clear();
+  merged_junction_features_.clear();
+}
+
+std::shared_ptr<const JunctionInfo> JunctionAnalyzer::GetJunction(
+    const std::string& junction_id) const {
+  if (junction_info_ptr_ != nullptr &&
+      junction_info_ptr_->id().id() == junction_id) {
+    return junction_info_ptr_;
+  }
+  return nullptr;
 }
 
 void JunctionAnalyzer::SetAllJunctionExits() {
@@ -138,6 +149,19 @@ const JunctionFeature& JunctionAnalyzer::GetJunctionFeature(
 
 JunctionFeature JunctionAnalyzer::GetJunctionFeature(
     const std::vector<std::string>& start_lane_ids) {
+  // Obstacles in the same junction often share the same set of start lanes,
+  // so the merged feature is cached under a key built from the sorted IDs.
+  std::vector<std::string> sorted_start_lane_ids = start_lane_ids;
+  std::sort(sorted_start_lane_ids.begin(), sorted_start_lane_ids.end());
+  std::string merged_key;
+  for (const std::string& start_lane_id : sorted_start_lane_ids) {
+    merged_key += start_lane_id;
+    merged_key += ";";
+  }
+  if (merged_junction_features_.find(merged_key) !=
+      merged_junction_features_.end()) {
+    return merged_junction_features_[merged_key];
+  }
   JunctionFeature merged_junction_feature;
   bool initialized = false;
   std::unordered_map<std::string, JunctionExit> junction_exits_map;
@@ -160,6 +184,7 @@ JunctionFeature JunctionAnalyzer::GetJunctionFeature(
     merged_junction_feature.add_start_lane_id(exit.first);
     merged_junction_feature.add_junction_exit()->CopyFrom(exit.second);
   }
+  merged_junction_features_[merged_key] = merged_junction_feature;
   return merged_junction_feature;
 }
 
@@ -174,11 +199,17 @@ const std::string& JunctionAnalyzer::GetJunctionId() {
 
 double JunctionAnalyzer::ComputeJunctionRange() {
   CHECK_NOTNULL(junction_info_ptr_);
+  // The range only depends on the junction polygon, so it is computed once
+  // and shared by every obstacle in the junction.
+  if (junction_range_ > 0.0) {
+    return junction_range_;
+  }
   if (!junction_info_ptr_->junction().has_polygon() ||
       junction_info_ptr_->junction().polygon().point_size() < 3) {
     AERROR << "Junction [" << GetJunctionId()
            << "] has not enough polygon points to compute range";
-    return FLAGS_defualt_junction_range;
+    junction_range_ = FLAGS_defualt_junction_range;
+    return junction_range_;
   }
   double x_min = std::numeric_limits<double>::infinity();
   double x_max = -std::numeric_limits<double>::infinity();
@@ -192,8 +223,8 @@ double JunctionAnalyzer::ComputeJunctionRange() {
   }
   double dx = std::abs(x_max - x_min);
   double dy = std::abs(y_max - y_min);
-  double range = std::sqrt(dx * dx + dy * dy);
-  return range;
+  junction_range_ = std::sqrt(dx * dx + dy * dy);
+  return junction_range_;
 }
 
 }  // namespace prediction
@@ -47,7 +47,16 @@ class JunctionAnalyzer {
   const std::string& GetJunctionId();
 
   /**
-   * @brief Compute junction range
+   * @brief Get the junction info of the analyzed junction, so that callers
+   * sharing the same junction avoid repeated map lookups
+   * @param junction ID
+   * @return Junction info, or nullptr if junction_id is not the analyzed one
+   */
+  std::shared_ptr<const apollo::hdmap::JunctionInfo> GetJunction(
+      const std::string& junction_id) const;
+
+  /**
+   * @brief Compute junction range, cached after the first call
    * @return Junction range
    */
   double ComputeJunctionRange();
@@ -92,10 +101,15 @@ class JunctionAnalyzer {
  private:
   // junction_info pointer associated to the input junction_id
   std::shared_ptr<const apollo::hdmap::JunctionInfo> junction_info_ptr_;
+  // Cached junction range, 0.0 if not computed yet
+  double junction_range_ = 0.0;
   // Hashtable: exit_lane_id -> junction_exit
   std::unordered_map<std::string, JunctionExit> junction_exits_;
   // Hashtable: start_lane_id -> junction_feature
   std::unordered_map<std::string, JunctionFeature> junction_features_;
+  // Hashtable: joined start_lane_ids -> merged junction_feature, shared by
+  // the obstacles entering the junction from the same set of lanes
+  std::unordered_map<std::string, JunctionFeature> merged_junction_features_;
 };
 
 }  // namespace prediction
@@ -93,13 +93,9 @@ bool MessageProcess::InitPredictors(PredictorManager* predictor_manager,
   return true;
 }
 
-void MessageProcess::ContainerProcess(
+void MessageProcess::ContainerBackfill(
     const std::shared_ptr<ContainerManager>& container_manager,
-    const perception::PerceptionObstacles& perception_obstacles,
-    ScenarioManager* scenario_manager) {
-  ADEBUG << "Received a perception message ["
-         << perception_obstacles.ShortDebugString() << "].";
-
+    const perception::PerceptionObstacles& perception_obstacles) {
   // Get obstacles_container
   auto ptr_obstacles_container =
       container_manager->GetContainer<ObstaclesContainer>(
@@ -118,12 +114,6 @@ void MessageProcess::ContainerProcess(
           AdapterConfig::PLANNING_TRAJECTORY);
   CHECK_NOTNULL(ptr_ego_trajectory_container);
 
-  // Get storytelling_container
-  auto ptr_storytelling_container =
-      container_manager->GetContainer<StoryTellingContainer>(
-          AdapterConfig::STORYTELLING);
-  CHECK_NOTNULL(ptr_storytelling_container);
-
   // Insert ADC into the obstacle_container.
   const PerceptionObstacle* ptr_ego_vehicle =
       ptr_ego_pose_container->ToPerceptionObstacle();
@@ -148,6 +138,21 @@ void MessageProcess::ContainerProcess(
 
   // Insert perception_obstacles
   ptr_obstacles_container->Insert(perception_obstacles);
+}
+
+void MessageProcess::ContainerProcess(
+    const std::shared_ptr<ContainerManager>& container_manager,
+    const perception::PerceptionObstacles& perception_obstacles,
+    ScenarioManager* scenario_manager) {
+  ADEBUG << "Received a perception message ["
+         << perception_obstacles.ShortDebugString() << "].";
+
+  ContainerBackfill(container_manager, perception_obstacles);
+
+  auto ptr_obstacles_container =
+      container_manager->GetContainer<ObstaclesContainer>(
+          AdapterConfig::PERCEPTION_OBSTACLES);
+  CHECK_NOTNULL(ptr_obstacles_container);
 
   ObstaclesPrioritizer obstacles_prioritizer(container_manager);
   // Ignore some obstacles
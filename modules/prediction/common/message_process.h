@@ -54,6 +54,15 @@ class MessageProcess {
   static bool InitPredictors(PredictorManager *predictor_manager,
                              const PredictionConf &prediction_conf);
 
+  /**
+   * @brief Insert a perception frame into the containers without running
+   * scenario analysis or lane graph building; used to backfill obstacle
+   * history when backlogged frames are coalesced.
+   */
+  static void ContainerBackfill(
+      const std::shared_ptr<ContainerManager> &container_manager,
+      const perception::PerceptionObstacles &perception_obstacles);
+
   static void ContainerProcess(
       const std::shared_ptr<ContainerManager> &container_manager,
       const perception::PerceptionObstacles &perception_obstacles,
@@ -53,6 +53,13 @@ DEFINE_double(pedestrian_nearby_lane_search_radius, 5.0,
               "Radius to determine if pedestrian-like obstacle is near lane.");
 DEFINE_int32(road_graph_max_search_horizon, 20,
              "Maximal search depth for building road graph");
+DEFINE_bool(enable_lane_graph_cache, false,
+            "If reuse lane graphs built in recent frames, keyed by lane id "
+            "and bucketed start s, instead of re-walking hdmap successors "
+            "for every obstacle each frame.");
+DEFINE_double(lane_graph_cache_s_bucket, 1.0,
+              "Bucket size in meters of the lane start s for lane graph "
+              "reuse; a cached graph may be off by up to one bucket.");
 DEFINE_double(surrounding_lane_search_radius, 3.0,
               "Search radius for surrounding lanes.");
 
@@ -55,6 +55,8 @@ DEFINE_int32(prediction_offline_mode, 0,
              "4: dump frame environment info to frame_env.*.bin"
              "5: dump data for tuning to datatuning.*.bin");
 DEFINE_bool(enable_multi_thread, true, "If enable multi-thread.");
+DEFINE_bool(enable_semantic_lstm_batch_evaluation, false,
+            "If batch semantic LSTM obstacles into one forward pass.");
 DEFINE_int32(max_thread_num, 8, "Maximal number of threads.");
 DEFINE_int32(max_caution_thread_num, 2,
              "Maximal number of threads for caution obstacles.");
@@ -65,6 +67,15 @@ DEFINE_bool(use_cuda, true, "If use cuda for torch.");
 // Bag replay timestamp gap
 DEFINE_double(replay_timestamp_gap, 10.0,
               "Max timestamp gap for rosbag replay");
+
+// Input coalescing under backlog
+DEFINE_bool(enable_perception_msg_coalescing, true,
+            "If coalesce backlogged perception messages: a stale frame only "
+            "backfills obstacle history and the full prediction chain runs "
+            "on the latest frame.");
+DEFINE_double(perception_msg_coalesce_delay, 0.3,
+              "A perception message older than this (in seconds) when its "
+              "processing starts is treated as backlog and coalesced.");
 DEFINE_int32(max_num_dump_feature, 10000, "Max number of features to dump");
 DEFINE_int32(max_num_dump_dataforlearn, 5000,
              "Max number of dataforlearn to dump");
@@ -84,3 +95,11 @@ DEFINE_string(evaluator_submodule_name, "evaluator_submodule",
 DEFINE_string(perception_obstacles_topic_name,
               "/apollo/prediction/perception_obstacles",
               "Internal topic of perception obstacles");
+DEFINE_string(shared_feature_block_name, "",
+              "Name of the shared-memory feature block used to hand feature "
+              "tensors between submodules; empty disables the shared-memory "
+              "handoff.");
+DEFINE_int32(shared_feature_slot_num, 8,
+             "Number of slots in the shared-memory feature block ring.");
+DEFINE_int32(shared_feature_slot_capacity, 8192,
+             "Capacity of one shared feature slot in doubles.");
@@ -33,6 +33,7 @@ DECLARE_double(prediction_test_duration);
 DECLARE_string(prediction_offline_bags);
 DECLARE_int32(prediction_offline_mode);
 DECLARE_bool(enable_multi_thread);
+DECLARE_bool(enable_semantic_lstm_batch_evaluation);
 DECLARE_int32(max_thread_num);
 DECLARE_int32(max_caution_thread_num);
 DECLARE_bool(enable_async_draw_base_image);
@@ -40,6 +41,10 @@ DECLARE_bool(use_cuda);
 
 // Bag replay timestamp gap
 DECLARE_double(replay_timestamp_gap);
+
+// Input coalescing under backlog
+DECLARE_bool(enable_perception_msg_coalescing);
+DECLARE_double(perception_msg_coalesce_delay);
 DECLARE_int32(max_num_dump_feature);
 DECLARE_int32(max_num_dump_dataforlearn);
 
@@ -51,3 +56,6 @@ DECLARE_string(evaluator_topic_name);
 DECLARE_string(container_submodule_name);
 DECLARE_string(evaluator_submodule_name);
 DECLARE_string(perception_obstacles_topic_name);
+DECLARE_string(shared_feature_block_name);
+DECLARE_int32(shared_feature_slot_num);
+DECLARE_int32(shared_feature_slot_capacity);
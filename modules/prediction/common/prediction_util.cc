@@ -208,6 +208,76 @@ double EvaluateCubicPolynomial(const std::array<double, 4>& coefs,
   }
 }
 
+void SampleQuarticPolynomial(const std::array<double, 5>& coeffs,
+                             const double period, const size_t num,
+                             const double end_t, const double end_v,
+                             std::vector<double>* values,
+                             std::vector<double>* first_derivatives,
+                             std::vector<double>* second_derivatives) {
+  values->resize(num);
+  first_derivatives->resize(num);
+  second_derivatives->resize(num);
+  // Split the grid at the extrapolation boundary (t >= end_t) so the
+  // polynomial loop carries no branch and can be vectorized.
+  size_t num_poly = num;
+  if (end_t < static_cast<double>(num) * period) {
+    num_poly = std::min(
+        num, static_cast<size_t>(std::ceil(std::max(0.0, end_t) / period)));
+  }
+  for (size_t i = 0; i < num_poly; ++i) {
+    const double t = static_cast<double>(i) * period;
+    (*values)[i] =
+        (((coeffs[4] * t + coeffs[3]) * t + coeffs[2]) * t + coeffs[1]) * t +
+        coeffs[0];
+    (*first_derivatives)[i] =
+        ((4.0 * coeffs[4] * t + 3.0 * coeffs[3]) * t + 2.0 * coeffs[2]) * t +
+        coeffs[1];
+    (*second_derivatives)[i] =
+        (12.0 * coeffs[4] * t + 6.0 * coeffs[3]) * t + 2.0 * coeffs[2];
+  }
+  if (num_poly < num) {
+    const double end_value =
+        (((coeffs[4] * end_t + coeffs[3]) * end_t + coeffs[2]) * end_t +
+         coeffs[1]) *
+            end_t +
+        coeffs[0];
+    for (size_t i = num_poly; i < num; ++i) {
+      const double t = static_cast<double>(i) * period;
+      (*values)[i] = end_value + (t - end_t) * end_v;
+      (*first_derivatives)[i] = end_v;
+      (*second_derivatives)[i] = 0.0;
+    }
+  }
+}
+
+void SampleCubicPolynomial(const std::array<double, 4>& coefs,
+                           const double period, const size_t num,
+                           const double end_t, const double end_v,
+                           std::vector<double>* values) {
+  values->resize(num);
+  // The cubic extrapolates for t > end_t, so the sample right on the
+  // boundary still belongs to the polynomial part.
+  size_t num_poly = num;
+  if (end_t < static_cast<double>(num) * period) {
+    num_poly = std::min(
+        num,
+        static_cast<size_t>(std::floor(std::max(0.0, end_t) / period)) + 1);
+  }
+  for (size_t i = 0; i < num_poly; ++i) {
+    const double t = static_cast<double>(i) * period;
+    (*values)[i] =
+        ((coefs[3] * t + coefs[2]) * t + coefs[1]) * t + coefs[0];
+  }
+  if (num_poly < num) {
+    const double end_value =
+        ((coefs[3] * end_t + coefs[2]) * end_t + coefs[1]) * end_t + coefs[0];
+    for (size_t i = num_poly; i < num; ++i) {
+      const double t = static_cast<double>(i) * period;
+      (*values)[i] = end_value + (t - end_t) * end_v;
+    }
+  }
+}
+
 double GetSByConstantAcceleration(const double v0, const double acceleration,
                                   const double t) {
   if (acceleration > -FLAGS_double_precision) {
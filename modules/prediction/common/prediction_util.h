@@ -93,6 +93,42 @@ double EvaluateCubicPolynomial(
     const double end_t = std::numeric_limits<double>::infinity(),
     const double end_v = 0.0);
 
+/**
+ * @brief Sample a quartic polynomial and its first two derivatives on a
+ *        uniform time grid; the pre-extrapolation part runs as a
+ *        branch-free Horner pass over the whole grid.
+ * @param coefficients of the quartic polynomial, lower to higher.
+ * @param period time gap between two adjacent samples.
+ * @param num number of samples.
+ * @param end_t ending time for extrapolation.
+ * @param end_v ending velocity for extrapolation.
+ * @param values sampled polynomial values.
+ * @param first_derivatives sampled first order derivatives.
+ * @param second_derivatives sampled second order derivatives.
+ */
+void SampleQuarticPolynomial(const std::array<double, 5>& coeffs,
+                             const double period, const size_t num,
+                             const double end_t, const double end_v,
+                             std::vector<double>* values,
+                             std::vector<double>* first_derivatives,
+                             std::vector<double>* second_derivatives);
+
+/**
+ * @brief Sample a cubic polynomial on a uniform time grid; the
+ *        pre-extrapolation part runs as a branch-free Horner pass over
+ *        the whole grid.
+ * @param coefficients of the cubic polynomial, lower to higher.
+ * @param period time gap between two adjacent samples.
+ * @param num number of samples.
+ * @param end_t ending time for extrapolation.
+ * @param end_v ending velocity for extrapolation.
+ * @param values sampled polynomial values.
+ */
+void SampleCubicPolynomial(const std::array<double, 4>& coefs,
+                           const double period, const size_t num,
+                           const double end_t, const double end_v,
+                           std::vector<double>* values);
+
 template <std::size_t N>
 std::array<double, 2 * N - 2> ComputePolynomial(
     const std::array<double, N - 1>& start_state,
@@ -84,6 +84,40 @@ TEST(PredictionUtilTest, solve_cubic_polynomial_and_evaluate) {
                    end[1]);
 }
 
+TEST(PredictionUtilTest, sample_polynomials_match_pointwise_evaluation) {
+  std::array<double, 5> quartic_coeffs = {1.0, 2.0, -0.5, 0.25, -0.05};
+  const double period = 0.5;
+  const size_t num = 10;
+  const double end_t = 3.2;
+  const double end_v = 1.5;
+  std::vector<double> values;
+  std::vector<double> first_derivatives;
+  std::vector<double> second_derivatives;
+  SampleQuarticPolynomial(quartic_coeffs, period, num, end_t, end_v, &values,
+                          &first_derivatives, &second_derivatives);
+  for (size_t i = 0; i < num; ++i) {
+    const double t = static_cast<double>(i) * period;
+    EXPECT_DOUBLE_EQ(
+        values[i], EvaluateQuarticPolynomial(quartic_coeffs, t, 0, end_t,
+                                             end_v));
+    EXPECT_DOUBLE_EQ(
+        first_derivatives[i],
+        EvaluateQuarticPolynomial(quartic_coeffs, t, 1, end_t, end_v));
+    EXPECT_DOUBLE_EQ(
+        second_derivatives[i],
+        EvaluateQuarticPolynomial(quartic_coeffs, t, 2, end_t, end_v));
+  }
+
+  std::array<double, 4> cubic_coefs = {0.5, -1.0, 0.75, 0.1};
+  std::vector<double> cubic_values;
+  SampleCubicPolynomial(cubic_coefs, period, num, end_t, end_v, &cubic_values);
+  for (size_t i = 0; i < num; ++i) {
+    const double t = static_cast<double>(i) * period;
+    EXPECT_DOUBLE_EQ(cubic_values[i],
+                     EvaluateCubicPolynomial(cubic_coefs, t, 0, end_t, end_v));
+  }
+}
+
 }  // namespace math_util
 
 namespace predictor_util {
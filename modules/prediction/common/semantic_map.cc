@@ -16,6 +16,8 @@
 
 #include "modules/prediction/common/semantic_map.h"
 
+#include <algorithm>
+#include <cmath>
 #include <utility>
 #include <vector>
 
@@ -72,9 +74,9 @@ void SemanticMap::RunCurrFrame(
   if (!FLAGS_enable_async_draw_base_image) {
     double x = ego_feature_.position().x();
     double y = ego_feature_.position().y();
-    curr_base_x_ = x - FLAGS_base_image_half_range;
-    curr_base_y_ = y - FLAGS_base_image_half_range;
-    DrawBaseMap(x, y, curr_base_x_, curr_base_y_);
+    curr_base_x_ = SnapToPixelGrid(x - FLAGS_base_image_half_range);
+    curr_base_y_ = SnapToPixelGrid(y - FLAGS_base_image_half_range);
+    DrawBaseMap(curr_base_x_, curr_base_y_);
     base_img_.copyTo(curr_img_);
   } else {
     base_img_.copyTo(curr_img_);
@@ -107,30 +109,93 @@ void SemanticMap::RunCurrFrame(
   }
 }
 
-void SemanticMap::DrawBaseMap(const double x, const double y,
-                              const double base_x, const double base_y) {
+void SemanticMap::DrawBaseMap(const double base_x, const double base_y) {
   base_img_ = cv::Mat(2000, 2000, CV_8UC3, cv::Scalar(0, 0, 0));
-  common::PointENU center_point = common::util::PointFactory::ToPointENU(x, y);
-  DrawRoads(center_point, base_x, base_y);
-  DrawJunctions(center_point, base_x, base_y);
-  DrawCrosswalks(center_point, base_x, base_y);
-  DrawLanes(center_point, base_x, base_y);
+  // Compose the base image from pre-rendered world-aligned tiles; only
+  // tiles never seen before get rasterized.
+  const double range = 2.0 * FLAGS_base_image_half_range;
+  const int tile_i_start =
+      static_cast<int>(std::floor(base_x / kTileWorldSize));
+  const int tile_i_end =
+      static_cast<int>(std::floor((base_x + range) / kTileWorldSize));
+  const int tile_j_start =
+      static_cast<int>(std::floor(base_y / kTileWorldSize));
+  const int tile_j_end =
+      static_cast<int>(std::floor((base_y + range) / kTileWorldSize));
+  for (int i = tile_i_start; i <= tile_i_end; ++i) {
+    for (int j = tile_j_start; j <= tile_j_end; ++j) {
+      const cv::Mat& tile = GetTile(i, j);
+      const int dest_x = static_cast<int>(
+          std::lround((i * kTileWorldSize - base_x) * 10.0));
+      const int dest_y = static_cast<int>(
+          std::lround(2000.0 - ((j + 1) * kTileWorldSize - base_y) * 10.0));
+      const int dest_x0 = std::max(dest_x, 0);
+      const int dest_y0 = std::max(dest_y, 0);
+      const int dest_x1 = std::min(dest_x + kTileSizePixel, 2000);
+      const int dest_y1 = std::min(dest_y + kTileSizePixel, 2000);
+      if (dest_x0 >= dest_x1 || dest_y0 >= dest_y1) {
+        continue;
+      }
+      const cv::Rect dest_rect(dest_x0, dest_y0, dest_x1 - dest_x0,
+                               dest_y1 - dest_y0);
+      const cv::Rect src_rect(dest_x0 - dest_x, dest_y0 - dest_y,
+                              dest_rect.width, dest_rect.height);
+      tile(src_rect).copyTo(base_img_(dest_rect));
+    }
+  }
 }
 
 void SemanticMap::DrawBaseMapThread() {
   std::lock_guard<std::mutex> lock(draw_base_map_thread_mutex_);
   double x = ego_feature_.position().x();
   double y = ego_feature_.position().y();
-  base_x_ = x - FLAGS_base_image_half_range;
-  base_y_ = y - FLAGS_base_image_half_range;
-  DrawBaseMap(x, y, base_x_, base_y_);
+  base_x_ = SnapToPixelGrid(x - FLAGS_base_image_half_range);
+  base_y_ = SnapToPixelGrid(y - FLAGS_base_image_half_range);
+  DrawBaseMap(base_x_, base_y_);
+}
+
+const cv::Mat& SemanticMap::GetTile(const int tile_i, const int tile_j) {
+  const int64_t key = (static_cast<int64_t>(tile_i) << 32) ^
+                      static_cast<int64_t>(static_cast<uint32_t>(tile_j));
+  auto iter = tile_cache_.find(key);
+  if (iter != tile_cache_.end()) {
+    return iter->second;
+  }
+  if (tile_cache_.size() >= kMaxCachedTiles) {
+    // wholesale eviction keeps the bookkeeping trivial; refilling the
+    // visible tiles once is cheap compared to tracking per-tile recency
+    tile_cache_.clear();
+  }
+  cv::Mat tile_img(kTileSizePixel, kTileSizePixel, CV_8UC3,
+                   cv::Scalar(0, 0, 0));
+  RenderTile(tile_i, tile_j, &tile_img);
+  return tile_cache_.emplace(key, std::move(tile_img)).first->second;
+}
+
+void SemanticMap::RenderTile(const int tile_i, const int tile_j,
+                             cv::Mat* tile_img) {
+  const double tile_base_x = tile_i * kTileWorldSize;
+  const double tile_base_y = tile_j * kTileWorldSize;
+  common::PointENU center_point = common::util::PointFactory::ToPointENU(
+      tile_base_x + kTileWorldSize / 2.0, tile_base_y + kTileWorldSize / 2.0);
+  // same half-diagonal query convention the full-image draw used
+  const double radius = kTileWorldSize / 2.0 * M_SQRT2;
+  DrawRoads(center_point, tile_base_x, tile_base_y, radius, kTileSizePixel,
+            tile_img);
+  DrawJunctions(center_point, tile_base_x, tile_base_y, radius, kTileSizePixel,
+                tile_img);
+  DrawCrosswalks(center_point, tile_base_x, tile_base_y, radius,
+                 kTileSizePixel, tile_img);
+  DrawLanes(center_point, tile_base_x, tile_base_y, radius, kTileSizePixel,
+            tile_img);
 }
 
 void SemanticMap::DrawRoads(const common::PointENU& center_point,
                             const double base_x, const double base_y,
-                            const cv::Scalar& color) {
+                            const double radius, const int height_px,
+                            cv::Mat* img, const cv::Scalar& color) {
   std::vector<apollo::hdmap::RoadInfoConstPtr> roads;
-  apollo::hdmap::HDMapUtil::BaseMap().GetRoads(center_point, 141.4, &roads);
+  apollo::hdmap::HDMapUtil::BaseMap().GetRoads(center_point, radius, &roads);
   for (const auto& road : roads) {
     for (const auto& section : road->road().section()) {
       std::vector<cv::Point> polygon;
@@ -138,8 +203,8 @@ void SemanticMap::DrawRoads(const common::PointENU& center_point,
         if (edge.type() == 2) {  // left edge
           for (const auto& segment : edge.curve().segment()) {
             for (const auto& point : segment.line_segment().point()) {
-              polygon.push_back(std::move(
-                  GetTransPoint(point.x(), point.y(), base_x, base_y)));
+              polygon.push_back(std::move(GetTransPoint(
+                  point.x(), point.y(), base_x, base_y, height_px)));
             }
           }
         } else if (edge.type() == 3) {  // right edge
@@ -147,12 +212,13 @@ void SemanticMap::DrawRoads(const common::PointENU& center_point,
             for (const auto& point : segment.line_segment().point()) {
               polygon.insert(polygon.begin(),
                              std::move(GetTransPoint(point.x(), point.y(),
-                                                     base_x, base_y)));
+                                                     base_x, base_y,
+                                                     height_px)));
             }
           }
         }
       }
-      cv::fillPoly(base_img_,
+      cv::fillPoly(*img,
                    std::vector<std::vector<cv::Point>>({std::move(polygon)}),
                    color);
     }
@@ -161,17 +227,18 @@ void SemanticMap::DrawRoads(const common::PointENU& center_point,
 
 void SemanticMap::DrawJunctions(const common::PointENU& center_point,
                                 const double base_x, const double base_y,
-                                const cv::Scalar& color) {
+                                const double radius, const int height_px,
+                                cv::Mat* img, const cv::Scalar& color) {
   std::vector<apollo::hdmap::JunctionInfoConstPtr> junctions;
-  apollo::hdmap::HDMapUtil::BaseMap().GetJunctions(center_point, 141.4,
+  apollo::hdmap::HDMapUtil::BaseMap().GetJunctions(center_point, radius,
                                                    &junctions);
   for (const auto& junction : junctions) {
     std::vector<cv::Point> polygon;
     for (const auto& point : junction->junction().polygon().point()) {
-      polygon.push_back(
-          std::move(GetTransPoint(point.x(), point.y(), base_x, base_y)));
+      polygon.push_back(std::move(
+          GetTransPoint(point.x(), point.y(), base_x, base_y, height_px)));
     }
-    cv::fillPoly(base_img_,
+    cv::fillPoly(*img,
                  std::vector<std::vector<cv::Point>>({std::move(polygon)}),
                  color);
   }
@@ -179,17 +246,18 @@ void SemanticMap::DrawJunctions(const common::PointENU& center_point,
 
 void SemanticMap::DrawCrosswalks(const common::PointENU& center_point,
                                  const double base_x, const double base_y,
-                                 const cv::Scalar& color) {
+                                 const double radius, const int height_px,
+                                 cv::Mat* img, const cv::Scalar& color) {
   std::vector<apollo::hdmap::CrosswalkInfoConstPtr> crosswalks;
-  apollo::hdmap::HDMapUtil::BaseMap().GetCrosswalks(center_point, 141.4,
+  apollo::hdmap::HDMapUtil::BaseMap().GetCrosswalks(center_point, radius,
                                                     &crosswalks);
   for (const auto& crosswalk : crosswalks) {
     std::vector<cv::Point> polygon;
     for (const auto& point : crosswalk->crosswalk().polygon().point()) {
-      polygon.push_back(
-          std::move(GetTransPoint(point.x(), point.y(), base_x, base_y)));
+      polygon.push_back(std::move(
+          GetTransPoint(point.x(), point.y(), base_x, base_y, height_px)));
     }
-    cv::fillPoly(base_img_,
+    cv::fillPoly(*img,
                  std::vector<std::vector<cv::Point>>({std::move(polygon)}),
                  color);
   }
@@ -197,19 +265,20 @@ void SemanticMap::DrawCrosswalks(const common::PointENU& center_point,
 
 void SemanticMap::DrawLanes(const common::PointENU& center_point,
                             const double base_x, const double base_y,
-                            const cv::Scalar& color) {
+                            const double radius, const int height_px,
+                            cv::Mat* img, const cv::Scalar& color) {
   std::vector<apollo::hdmap::LaneInfoConstPtr> lanes;
-  apollo::hdmap::HDMapUtil::BaseMap().GetLanes(center_point, 141.4, &lanes);
+  apollo::hdmap::HDMapUtil::BaseMap().GetLanes(center_point, radius, &lanes);
   for (const auto& lane : lanes) {
     // Draw lane_central first
     for (const auto& segment : lane->lane().central_curve().segment()) {
       for (int i = 0; i < segment.line_segment().point_size() - 1; ++i) {
-        const auto& p0 =
-            GetTransPoint(segment.line_segment().point(i).x(),
-                          segment.line_segment().point(i).y(), base_x, base_y);
+        const auto& p0 = GetTransPoint(segment.line_segment().point(i).x(),
+                                       segment.line_segment().point(i).y(),
+                                       base_x, base_y, height_px);
         const auto& p1 = GetTransPoint(segment.line_segment().point(i + 1).x(),
                                        segment.line_segment().point(i + 1).y(),
-                                       base_x, base_y);
+                                       base_x, base_y, height_px);
         double theta = atan2(segment.line_segment().point(i + 1).y() -
                                  segment.line_segment().point(i).y(),
                              segment.line_segment().point(i + 1).x() -
@@ -223,7 +292,7 @@ void SemanticMap::DrawLanes(const common::PointENU& center_point,
         //     cv::Scalar(rgb.at<float>(0, 0) * 255, rgb.at<float>(0, 1) * 255,
         //                rgb.at<float>(0, 2) * 255);
 
-        cv::line(base_img_, p0, p1, HSVtoRGB(H), 4);
+        cv::line(*img, p0, p1, HSVtoRGB(H), 4);
       }
     }
     // Not drawing boundary for virtual city_driving lane
@@ -234,26 +303,26 @@ void SemanticMap::DrawLanes(const common::PointENU& center_point,
     // Draw lane's left_boundary
     for (const auto& segment : lane->lane().left_boundary().curve().segment()) {
       for (int i = 0; i < segment.line_segment().point_size() - 1; ++i) {
-        const auto& p0 =
-            GetTransPoint(segment.line_segment().point(i).x(),
-                          segment.line_segment().point(i).y(), base_x, base_y);
+        const auto& p0 = GetTransPoint(segment.line_segment().point(i).x(),
+                                       segment.line_segment().point(i).y(),
+                                       base_x, base_y, height_px);
         const auto& p1 = GetTransPoint(segment.line_segment().point(i + 1).x(),
                                        segment.line_segment().point(i + 1).y(),
-                                       base_x, base_y);
-        cv::line(base_img_, p0, p1, color, 2);
+                                       base_x, base_y, height_px);
+        cv::line(*img, p0, p1, color, 2);
       }
     }
     // Draw lane's right_boundary
     for (const auto& segment :
          lane->lane().right_boundary().curve().segment()) {
       for (int i = 0; i < segment.line_segment().point_size() - 1; ++i) {
-        const auto& p0 =
-            GetTransPoint(segment.line_segment().point(i).x(),
-                          segment.line_segment().point(i).y(), base_x, base_y);
+        const auto& p0 = GetTransPoint(segment.line_segment().point(i).x(),
+                                       segment.line_segment().point(i).y(),
+                                       base_x, base_y, height_px);
         const auto& p1 = GetTransPoint(segment.line_segment().point(i + 1).x(),
                                        segment.line_segment().point(i + 1).y(),
-                                       base_x, base_y);
-        cv::line(base_img_, p0, p1, color, 2);
+                                       base_x, base_y, height_px);
+        cv::line(*img, p0, p1, color, 2);
       }
     }
   }
@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include <cmath>
+#include <cstdint>
 #include <future>
 #include <unordered_map>
 
@@ -42,30 +44,48 @@ class SemanticMap {
 
  private:
   cv::Point2i GetTransPoint(const double x, const double y, const double base_x,
-                            const double base_y) {
+                            const double base_y, const int height_px) {
     return cv::Point2i(static_cast<int>((x - base_x) / 0.1),
-                       static_cast<int>(2000 - (y - base_y) / 0.1));
+                       static_cast<int>(height_px - (y - base_y) / 0.1));
+  }
+
+  cv::Point2i GetTransPoint(const double x, const double y, const double base_x,
+                            const double base_y) {
+    return GetTransPoint(x, y, base_x, base_y, 2000);
   }
 
-  void DrawBaseMap(const double x, const double y, const double base_x,
-                   const double base_y);
+  // snap a base coordinate to the 0.1m pixel grid so tile blits land on
+  // integral pixel offsets
+  static double SnapToPixelGrid(const double value) {
+    return std::round(value * 10.0) / 10.0;
+  }
+
+  void DrawBaseMap(const double base_x, const double base_y);
 
   void DrawBaseMapThread();
 
+  const cv::Mat& GetTile(const int tile_i, const int tile_j);
+
+  void RenderTile(const int tile_i, const int tile_j, cv::Mat* tile_img);
+
   void DrawRoads(const common::PointENU& center_point, const double base_x,
-                 const double base_y,
+                 const double base_y, const double radius, const int height_px,
+                 cv::Mat* img,
                  const cv::Scalar& color = cv::Scalar(64, 64, 64));
 
   void DrawJunctions(const common::PointENU& center_point, const double base_x,
-                     const double base_y,
+                     const double base_y, const double radius,
+                     const int height_px, cv::Mat* img,
                      const cv::Scalar& color = cv::Scalar(128, 128, 128));
 
   void DrawCrosswalks(const common::PointENU& center_point, const double base_x,
-                      const double base_y,
+                      const double base_y, const double radius,
+                      const int height_px, cv::Mat* img,
                       const cv::Scalar& color = cv::Scalar(192, 192, 192));
 
   void DrawLanes(const common::PointENU& center_point, const double base_x,
-                 const double base_y,
+                 const double base_y, const double radius, const int height_px,
+                 cv::Mat* img,
                  const cv::Scalar& color = cv::Scalar(255, 255, 255));
 
   cv::Scalar HSVtoRGB(double H = 1.0, double S = 1.0, double V = 1.0);
@@ -86,6 +106,15 @@ class SemanticMap {
                         const double base_x, const double base_y);
 
  private:
+  // world-aligned tile geometry of the pre-rendered base-map cache
+  static constexpr double kTileWorldSize = 50.0;
+  static constexpr int kTileSizePixel = 500;
+  static constexpr size_t kMaxCachedTiles = 64;
+
+  // pre-rendered base-map tiles keyed by (tile_i << 32) ^ tile_j; each tile
+  // is rasterized once and blitted into the base image every cycle
+  std::unordered_map<int64_t, cv::Mat> tile_cache_;
+
   // base_image, base_x, and base_y to be updated by async thread
   cv::Mat base_img_;
   double base_x_ = 0.0;
@@ -16,6 +16,7 @@
 
 #include "modules/prediction/container/adc_trajectory/adc_trajectory_container.h"
 
+#include <algorithm>
 #include <utility>
 
 #include "modules/prediction/common/prediction_gflags.h"
@@ -34,12 +35,6 @@ ADCTrajectoryContainer::ADCTrajectoryContainer()
 
 void ADCTrajectoryContainer::Insert(
     const ::google::protobuf::Message& message) {
-  adc_lane_ids_.clear();
-  adc_lane_seq_.clear();
-  adc_target_lane_ids_.clear();
-  adc_target_lane_seq_.clear();
-  adc_junction_polygon_ = std::move(Polygon2d());
-
   adc_trajectory_.CopyFrom(dynamic_cast<const ADCTrajectory&>(message));
   ADEBUG << "Received a planning message ["
          << adc_trajectory_.ShortDebugString() << "].";
@@ -79,6 +74,17 @@ bool ADCTrajectoryContainer::IsProtected() const {
 
 void ADCTrajectoryContainer::SetJunction(const std::string& junction_id,
                                          const double distance) {
+  // Same junction as the previous planning message: the polygon is
+  // unchanged, only the distance needs refreshing.
+  if (adc_junction_info_ptr_ != nullptr &&
+      adc_junction_info_ptr_->id().id() == junction_id) {
+    s_dist_to_junction_ = distance;
+    return;
+  }
+  adc_junction_info_ptr_ = nullptr;
+  s_dist_to_junction_ = 0.0;
+  adc_junction_polygon_ = std::move(Polygon2d());
+
   std::shared_ptr<const JunctionInfo> junction_info =
       PredictionMap::JunctionById(junction_id);
   if (junction_info != nullptr && junction_info->junction().has_polygon()) {
@@ -160,26 +166,37 @@ bool ADCTrajectoryContainer::IsLaneIdInTargetReferenceLine(
 }
 
 void ADCTrajectoryContainer::SetLaneSequence() {
+  std::vector<std::string> lane_seq;
   for (const auto& lane : adc_trajectory_.lane_id()) {
     if (!lane.id().empty()) {
-      if (adc_lane_seq_.empty() || lane.id() != adc_lane_seq_.back()) {
-        adc_lane_seq_.emplace_back(lane.id());
+      if (lane_seq.empty() || lane.id() != lane_seq.back()) {
+        lane_seq.emplace_back(lane.id());
       }
     }
   }
+  // Unchanged sequence: keep adc_lane_ids_, which SetPosition may have
+  // already pruned to the lanes ahead of the ADC.
+  if (lane_seq == adc_lane_seq_) {
+    return;
+  }
+  adc_lane_seq_ = std::move(lane_seq);
   adc_lane_ids_.clear();
   adc_lane_ids_.insert(adc_lane_seq_.begin(), adc_lane_seq_.end());
 }
 
 void ADCTrajectoryContainer::SetTargetLaneSequence() {
+  std::vector<std::string> target_lane_seq;
   for (const auto& lane : adc_trajectory_.target_lane_id()) {
     if (!lane.id().empty()) {
-      if (adc_target_lane_seq_.empty() ||
-          lane.id() != adc_target_lane_seq_.back()) {
-        adc_target_lane_seq_.emplace_back(lane.id());
+      if (target_lane_seq.empty() || lane.id() != target_lane_seq.back()) {
+        target_lane_seq.emplace_back(lane.id());
       }
     }
   }
+  if (target_lane_seq == adc_target_lane_seq_) {
+    return;
+  }
+  adc_target_lane_seq_ = std::move(target_lane_seq);
   adc_target_lane_ids_.clear();
   adc_target_lane_ids_.insert(adc_target_lane_seq_.begin(),
                               adc_target_lane_seq_.end());
@@ -225,9 +242,20 @@ bool ADCTrajectoryContainer::HasOverlap(
 }
 
 void ADCTrajectoryContainer::SetPosition(const Vec2d& position) {
-  for (auto it = adc_lane_seq_.begin(); it != adc_lane_seq_.end(); ++it) {
+  // The ADC only moves forward through the lane sequence, so resume the
+  // scan from the lane matched last cycle instead of the sequence head.
+  auto search_begin = adc_lane_seq_.begin();
+  if (!adc_matched_lane_id_.empty()) {
+    auto cached = std::find(adc_lane_seq_.begin(), adc_lane_seq_.end(),
+                            adc_matched_lane_id_);
+    if (cached != adc_lane_seq_.end()) {
+      search_begin = cached;
+    }
+  }
+  for (auto it = search_begin; it != adc_lane_seq_.end(); ++it) {
     auto lane_info = PredictionMap::LaneById(*it);
     if (lane_info != nullptr && lane_info->IsOnLane(position)) {
+      adc_matched_lane_id_ = *it;
       adc_lane_ids_.clear();
       adc_lane_ids_.insert(it, adc_lane_seq_.end());
       break;
@@ -126,6 +126,7 @@ class ADCTrajectoryContainer : public Container {
   double s_dist_to_junction_;
   std::unordered_set<std::string> adc_lane_ids_;
   std::vector<std::string> adc_lane_seq_;
+  std::string adc_matched_lane_id_;
   std::unordered_set<std::string> adc_target_lane_ids_;
   std::vector<std::string> adc_target_lane_seq_;
 };
@@ -19,6 +19,7 @@
 #include <algorithm>
 #include <iomanip>
 #include <limits>
+#include <utility>
 
 #include "modules/common/util/util.h"
 #include "modules/prediction/common/junction_analyzer.h"
@@ -154,7 +155,7 @@ bool Obstacle::Insert(const PerceptionObstacle& perception_obstacle,
   }
 
   // Set ID, Type, and Status of the feature.
-  Feature feature;
+  Feature feature = TakeRecycledFeature();
   if (!SetId(perception_obstacle, &feature, prediction_obstacle_id)) {
     return false;
   }
@@ -180,7 +181,7 @@ bool Obstacle::Insert(const PerceptionObstacle& perception_obstacle,
   }
 
   // Insert obstacle feature to history
-  InsertFeatureToHistory(feature);
+  InsertFeatureToHistory(std::move(feature));
 
   // Set obstacle motion status
   if (FLAGS_use_navigation_mode) {
@@ -228,8 +229,15 @@ bool Obstacle::IsInJunction(const std::string& junction_id) const {
   if (junction_id.empty()) {
     return false;
   }
-  std::shared_ptr<const JunctionInfo> junction_info_ptr =
-      PredictionMap::JunctionById(junction_id);
+  // Reuse the junction info cached by the analyzer; every obstacle in the
+  // frame is checked against the same junction.
+  std::shared_ptr<const JunctionInfo> junction_info_ptr = nullptr;
+  if (junction_analyzer_ != nullptr) {
+    junction_info_ptr = junction_analyzer_->GetJunction(junction_id);
+  }
+  if (junction_info_ptr == nullptr) {
+    junction_info_ptr = PredictionMap::JunctionById(junction_id);
+  }
   if (junction_info_ptr == nullptr) {
     return false;
   }
@@ -1401,6 +1409,22 @@ void Obstacle::InsertFeatureToHistory(const Feature& feature) {
   ADEBUG << "Obstacle [" << id_ << "] inserted a frame into the history.";
 }
 
+void Obstacle::InsertFeatureToHistory(Feature&& feature) {
+  feature_history_.emplace_front(std::move(feature));
+  ADEBUG << "Obstacle [" << id_ << "] inserted a frame into the history.";
+}
+
+Feature Obstacle::TakeRecycledFeature() {
+  if (recycled_features_.empty()) {
+    return Feature();
+  }
+  Feature feature = std::move(recycled_features_.back());
+  recycled_features_.pop_back();
+  // Clear() keeps the message's internal allocations for reuse.
+  feature.Clear();
+  return feature;
+}
+
 std::unique_ptr<Obstacle> Obstacle::Create(
     const PerceptionObstacle& perception_obstacle, const double timestamp,
     const int prediction_id, ObstacleClusters* clusters_ptr) {
@@ -1429,10 +1453,14 @@ bool Obstacle::ReceivedOlderMessage(const double timestamp) const {
 }
 
 void Obstacle::DiscardOutdatedHistory() {
+  static constexpr size_t kMaxRecycledFeatureNum = 10;
   auto num_of_frames = feature_history_.size();
   const double latest_ts = feature_history_.front().timestamp();
   while (latest_ts - feature_history_.back().timestamp() >=
          FLAGS_max_history_time) {
+    if (recycled_features_.size() < kMaxRecycledFeatureNum) {
+      recycled_features_.push_back(std::move(feature_history_.back()));
+    }
     feature_history_.pop_back();
   }
   auto num_of_discarded_frames = num_of_frames - feature_history_.size();
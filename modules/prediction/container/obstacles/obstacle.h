@@ -306,6 +306,13 @@ class Obstacle {
 
   void InsertFeatureToHistory(const Feature& feature);
 
+  void InsertFeatureToHistory(Feature&& feature);
+
+  // Hand out a feature recycled by DiscardOutdatedHistory(). The message is
+  // cleared but keeps its internal allocations, so refilling it does not hit
+  // the heap in steady state.
+  Feature TakeRecycledFeature();
+
   void SetJunctionFeatureWithEnterLane(const std::string& enter_lane_id,
                                        Feature* const feature_ptr);
 
@@ -333,6 +340,8 @@ class Obstacle {
 
   std::deque<Feature> feature_history_;
 
+  std::vector<Feature> recycled_features_;
+
   std::vector<std::shared_ptr<const hdmap::LaneInfo>> current_lanes_;
 
   ObstacleConf obstacle_conf_;
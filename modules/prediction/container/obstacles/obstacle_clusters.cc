@@ -17,8 +17,10 @@
 #include "modules/prediction/container/obstacles/obstacle_clusters.h"
 
 #include <algorithm>
+#include <cmath>
 #include <limits>
 
+#include "modules/prediction/common/prediction_gflags.h"
 #include "modules/prediction/common/road_graph.h"
 
 namespace apollo {
@@ -26,10 +28,48 @@ namespace prediction {
 
 using ::apollo::hdmap::LaneInfo;
 
+namespace {
+
+// Lane graphs cached beyond this count are dropped wholesale to bound the
+// memory of the cache on long drives.
+constexpr size_t kMaxCachedLaneGraphNum = 1000;
+
+}  // namespace
+
+void ObstacleClusters::Init() { lane_graph_cache_.clear(); }
+
+std::string ObstacleClusters::LaneGraphCacheKey(const std::string& lane_id,
+                                               const double start_s,
+                                               const double length,
+                                               const bool consider_lane_split) {
+  const int s_bucket = static_cast<int>(
+      std::floor(start_s / FLAGS_lane_graph_cache_s_bucket));
+  const int length_bucket = static_cast<int>(
+      std::ceil(length / FLAGS_lane_graph_cache_s_bucket));
+  return lane_id + "@" + std::to_string(s_bucket) + "@" +
+         std::to_string(length_bucket) + (consider_lane_split ? "@1" : "@0");
+}
+
 LaneGraph ObstacleClusters::GetLaneGraph(
     const double start_s, const double length, const bool consider_lane_split,
     std::shared_ptr<const LaneInfo> lane_info_ptr) {
   std::string lane_id = lane_info_ptr->id().id();
+  if (FLAGS_enable_lane_graph_cache) {
+    const std::string cache_key =
+        LaneGraphCacheKey(lane_id, start_s, length, consider_lane_split);
+    auto iter = lane_graph_cache_.find(cache_key);
+    if (iter != lane_graph_cache_.end()) {
+      return iter->second;
+    }
+    RoadGraph road_graph(start_s, length, consider_lane_split, lane_info_ptr);
+    LaneGraph lane_graph;
+    road_graph.BuildLaneGraph(&lane_graph);
+    if (lane_graph_cache_.size() >= kMaxCachedLaneGraphNum) {
+      lane_graph_cache_.clear();
+    }
+    lane_graph_cache_[cache_key] = lane_graph;
+    return lane_graph;
+  }
   RoadGraph road_graph(start_s, length, consider_lane_split, lane_info_ptr);
   LaneGraph lane_graph;
   road_graph.BuildLaneGraph(&lane_graph);
@@ -128,8 +128,23 @@ class ObstacleClusters {
   }
 
  private:
+  /**
+   * @brief Build the cache key of a lane graph from the lane id, the
+   *        bucketed start s and if lane split ahead is considered
+   * @param lane id
+   * @param lane start s
+   * @param lane graph search distance
+   * @param if consider lane split ahead
+   * @return the cache key
+   */
+  static std::string LaneGraphCacheKey(const std::string& lane_id,
+                                       const double start_s,
+                                       const double length,
+                                       const bool consider_lane_split);
+
   std::unordered_map<std::string, std::vector<LaneObstacle>> lane_obstacles_;
   std::unordered_map<std::string, StopSign> lane_id_stop_sign_map_;
+  std::unordered_map<std::string, LaneGraph> lane_graph_cache_;
 };
 
 }  // namespace prediction
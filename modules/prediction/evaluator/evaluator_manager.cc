@@ -207,6 +207,11 @@ void EvaluatorManager::Run(ObstaclesContainer* obstacles_container) {
 
   std::vector<Obstacle*> dynamic_env;
 
+  std::unordered_set<int> batch_evaluated_ids;
+  if (FLAGS_enable_semantic_lstm_batch_evaluation && FLAGS_enable_semantic_map) {
+    EvaluateSemanticLSTMObstacles(obstacles_container, &batch_evaluated_ids);
+  }
+
   if (FLAGS_enable_multi_thread) {
     IdObstacleListMap id_obstacle_map;
     GroupObstaclesByObstacleIds(obstacles_container, &id_obstacle_map);
@@ -214,6 +219,9 @@ void EvaluatorManager::Run(ObstaclesContainer* obstacles_container) {
         id_obstacle_map.begin(), id_obstacle_map.end(),
         [&](IdObstacleListMap::iterator::value_type& obstacles_iter) {
           for (auto obstacle_ptr : obstacles_iter.second) {
+            if (batch_evaluated_ids.count(obstacle_ptr->id()) != 0) {
+              continue;
+            }
             EvaluateObstacle(obstacle_ptr, obstacles_container, dynamic_env);
           }
         });
@@ -228,12 +236,74 @@ void EvaluatorManager::Run(ObstaclesContainer* obstacles_container) {
         ADEBUG << "Ignore still obstacle [" << id << "] in evaluator_manager";
         continue;
       }
+      if (batch_evaluated_ids.count(id) != 0) {
+        continue;
+      }
 
       EvaluateObstacle(obstacle, obstacles_container, dynamic_env);
     }
   }
 }
 
+bool EvaluatorManager::IsSemanticLSTMCandidate(Obstacle* obstacle) {
+  switch (obstacle->type()) {
+    case PerceptionObstacle::VEHICLE: {
+      if (!obstacle->IsCaution() || obstacle->IsSlow()) {
+        return false;
+      }
+      ObstacleConf::EvaluatorType type = vehicle_default_caution_evaluator_;
+      if (obstacle->IsNearJunction()) {
+        type = vehicle_in_junction_caution_evaluator_;
+      } else if (obstacle->IsOnLane()) {
+        type = vehicle_on_lane_caution_evaluator_;
+      }
+      return type == ObstacleConf::SEMANTIC_LSTM_EVALUATOR;
+    }
+    case PerceptionObstacle::PEDESTRIAN: {
+      return obstacle->latest_feature().priority().priority() ==
+                 ObstaclePriority::CAUTION &&
+             pedestrian_evaluator_ == ObstacleConf::SEMANTIC_LSTM_EVALUATOR;
+    }
+    default:
+      return false;
+  }
+}
+
+void EvaluatorManager::EvaluateSemanticLSTMObstacles(
+    ObstaclesContainer* obstacles_container,
+    std::unordered_set<int>* evaluated_ids) {
+  Evaluator* evaluator = GetEvaluator(ObstacleConf::SEMANTIC_LSTM_EVALUATOR);
+  if (evaluator == nullptr) {
+    return;
+  }
+  std::vector<Obstacle*> candidates;
+  for (int id : obstacles_container->curr_frame_considered_obstacle_ids()) {
+    Obstacle* obstacle = obstacles_container->GetObstacle(id);
+    if (obstacle == nullptr || obstacle->IsStill()) {
+      continue;
+    }
+    if (IsSemanticLSTMCandidate(obstacle)) {
+      candidates.push_back(obstacle);
+    }
+  }
+  // A single obstacle gains nothing from batching.
+  if (candidates.size() < 2) {
+    return;
+  }
+  std::vector<bool> evaluated;
+  auto* semantic_lstm_evaluator =
+      static_cast<SemanticLSTMEvaluator*>(evaluator);
+  if (!semantic_lstm_evaluator->EvaluateBatch(candidates, obstacles_container,
+                                              &evaluated)) {
+    return;
+  }
+  for (size_t i = 0; i < candidates.size(); ++i) {
+    if (evaluated[i]) {
+      evaluated_ids->insert(candidates[i]->id());
+    }
+  }
+}
+
 void EvaluatorManager::EvaluateObstacle(Obstacle* obstacle,
                                         ObstaclesContainer* obstacles_container,
                                         std::vector<Obstacle*> dynamic_env) {
@@ -25,6 +25,7 @@
 #include <map>
 #include <memory>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #include "cyber/common/macros.h"
@@ -79,6 +80,20 @@ class EvaluatorManager {
   void BuildObstacleIdHistoryMap(ObstaclesContainer* obstacles_container,
                                  size_t max_num_frame);
 
+  /**
+   * @brief Whether the obstacle will be routed to the semantic LSTM
+   * evaluator, so it can join a batched forward pass
+   */
+  bool IsSemanticLSTMCandidate(Obstacle* obstacle);
+
+  /**
+   * @brief Batch all semantic LSTM obstacles of the current frame into one
+   * forward pass per model; ids of obstacles evaluated this way are
+   * recorded so the per-obstacle loop skips them
+   */
+  void EvaluateSemanticLSTMObstacles(ObstaclesContainer* obstacles_container,
+                                     std::unordered_set<int>* evaluated_ids);
+
   void DumpCurrentFrameEnv(ObstaclesContainer* obstacles_container);
 
   /**
@@ -47,13 +47,127 @@ bool SemanticLSTMEvaluator::Evaluate(Obstacle* obstacle_ptr,
 
   Clear();
   CHECK_NOTNULL(obstacle_ptr);
+
+  torch::Tensor img_tensor;
+  torch::Tensor obstacle_pos;
+  torch::Tensor obstacle_pos_step;
+  if (!PrepareTorchInputs(obstacle_ptr, &img_tensor, &obstacle_pos,
+                          &obstacle_pos_step)) {
+    return false;
+  }
+
+  // Build input features for torch
+  std::vector<torch::jit::IValue> torch_inputs;
+
+  torch_inputs.push_back(c10::ivalue::Tuple::create(
+      {std::move(img_tensor.to(device_)), std::move(obstacle_pos.to(device_)),
+       std::move(obstacle_pos_step.to(device_))}));
+
+  // Compute pred_traj
+  std::vector<double> pred_traj;
+
+  auto start_time = std::chrono::system_clock::now();
+  at::Tensor torch_output_tensor = torch_default_output_tensor_;
+  if (obstacle_ptr->IsPedestrian()) {
+    torch_output_tensor = torch_pedestrian_model_.forward(torch_inputs)
+                              .toTensor()
+                              .to(torch::kCPU);
+  } else {
+    torch_output_tensor =
+        torch_vehicle_model_.forward(torch_inputs).toTensor().to(torch::kCPU);
+  }
+
+  auto end_time = std::chrono::system_clock::now();
+  std::chrono::duration<double> diff = end_time - start_time;
+  ADEBUG << "Semantic_LSTM_evaluator used time: " << diff.count() * 1000
+         << " ms.";
+  ParseModelOutput(torch_output_tensor, obstacle_ptr);
+  return true;
+}
+
+bool SemanticLSTMEvaluator::EvaluateBatch(
+    const std::vector<Obstacle*>& obstacle_ptrs,
+    ObstaclesContainer* obstacles_container, std::vector<bool>* evaluated) {
+  omp_set_num_threads(1);
+  CHECK_NOTNULL(evaluated);
+  evaluated->assign(obstacle_ptrs.size(), false);
+  if (!FLAGS_enable_semantic_map) {
+    ADEBUG << "Not enable semantic map, exit semantic_lstm_evaluator.";
+    return false;
+  }
+
+  // Obstacles evaluated by different models cannot share a forward pass.
+  struct BatchGroup {
+    std::vector<size_t> indices;
+    std::vector<torch::Tensor> img_tensors;
+    std::vector<torch::Tensor> obstacle_pos;
+    std::vector<torch::Tensor> obstacle_pos_steps;
+  };
+  BatchGroup vehicle_group;
+  BatchGroup pedestrian_group;
+  for (size_t n = 0; n < obstacle_ptrs.size(); ++n) {
+    Obstacle* obstacle_ptr = obstacle_ptrs[n];
+    CHECK_NOTNULL(obstacle_ptr);
+    torch::Tensor img_tensor;
+    torch::Tensor obstacle_pos;
+    torch::Tensor obstacle_pos_step;
+    if (!PrepareTorchInputs(obstacle_ptr, &img_tensor, &obstacle_pos,
+                            &obstacle_pos_step)) {
+      continue;
+    }
+    BatchGroup& group =
+        obstacle_ptr->IsPedestrian() ? pedestrian_group : vehicle_group;
+    group.indices.push_back(n);
+    group.img_tensors.push_back(img_tensor);
+    group.obstacle_pos.push_back(obstacle_pos);
+    group.obstacle_pos_steps.push_back(obstacle_pos_step);
+  }
+
+  for (BatchGroup* group : {&vehicle_group, &pedestrian_group}) {
+    if (group->indices.empty()) {
+      continue;
+    }
+    std::vector<torch::jit::IValue> torch_inputs;
+    torch_inputs.push_back(c10::ivalue::Tuple::create(
+        {torch::cat(group->img_tensors, 0).to(device_),
+         torch::cat(group->obstacle_pos, 0).to(device_),
+         torch::cat(group->obstacle_pos_steps, 0).to(device_)}));
+
+    auto start_time = std::chrono::system_clock::now();
+    at::Tensor torch_output_tensor;
+    if (group == &pedestrian_group) {
+      torch_output_tensor = torch_pedestrian_model_.forward(torch_inputs)
+                                .toTensor()
+                                .to(torch::kCPU);
+    } else {
+      torch_output_tensor =
+          torch_vehicle_model_.forward(torch_inputs).toTensor().to(torch::kCPU);
+    }
+    auto end_time = std::chrono::system_clock::now();
+    std::chrono::duration<double> diff = end_time - start_time;
+    ADEBUG << "Semantic_LSTM_evaluator batch of " << group->indices.size()
+           << " used time: " << diff.count() * 1000 << " ms.";
+
+    for (size_t i = 0; i < group->indices.size(); ++i) {
+      Obstacle* obstacle_ptr = obstacle_ptrs[group->indices[i]];
+      obstacle_ptr->SetEvaluatorType(evaluator_type_);
+      ParseModelOutput(
+          torch_output_tensor.slice(0, i, static_cast<int64_t>(i) + 1),
+          obstacle_ptr);
+      evaluated->at(group->indices[i]) = true;
+    }
+  }
+  return true;
+}
+
+bool SemanticLSTMEvaluator::PrepareTorchInputs(
+    Obstacle* obstacle_ptr, torch::Tensor* img_tensor,
+    torch::Tensor* obstacle_pos, torch::Tensor* obstacle_pos_step) {
   int id = obstacle_ptr->id();
   if (!obstacle_ptr->latest_feature().IsInitialized()) {
     AERROR << "Obstacle [" << id << "] has no latest feature.";
     return false;
   }
-  Feature* latest_feature_ptr = obstacle_ptr->mutable_latest_feature();
-  CHECK_NOTNULL(latest_feature_ptr);
 
   if (!FLAGS_enable_semantic_map) {
     ADEBUG << "Not enable semantic map, exit semantic_lstm_evaluator.";
@@ -67,11 +181,12 @@ bool SemanticLSTMEvaluator::Evaluate(Obstacle* obstacle_ptr,
   cv::cvtColor(feature_map, feature_map, CV_BGR2RGB);
   cv::Mat img_float;
   feature_map.convertTo(img_float, CV_32F, 1.0 / 255);
-  torch::Tensor img_tensor = torch::from_blob(img_float.data, {1, 224, 224, 3});
-  img_tensor = img_tensor.permute({0, 3, 1, 2});
-  img_tensor[0][0] = img_tensor[0][0].sub(0.485).div(0.229);
-  img_tensor[0][1] = img_tensor[0][1].sub(0.456).div(0.224);
-  img_tensor[0][2] = img_tensor[0][2].sub(0.406).div(0.225);
+  *img_tensor =
+      torch::from_blob(img_float.data, {1, 224, 224, 3}).clone();
+  *img_tensor = img_tensor->permute({0, 3, 1, 2});
+  (*img_tensor)[0][0] = (*img_tensor)[0][0].sub(0.485).div(0.229);
+  (*img_tensor)[0][1] = (*img_tensor)[0][1].sub(0.456).div(0.224);
+  (*img_tensor)[0][2] = (*img_tensor)[0][2].sub(0.406).div(0.225);
 
   // Extract features of pos_history
   std::vector<std::pair<double, double>> pos_history(20, {0.0, 0.0});
@@ -81,45 +196,26 @@ bool SemanticLSTMEvaluator::Evaluate(Obstacle* obstacle_ptr,
   }
   // Process obstacle_history
   // TODO(Hongyi): move magic numbers to parameters and gflags
-  torch::Tensor obstacle_pos = torch::zeros({1, 20, 2});
-  torch::Tensor obstacle_pos_step = torch::zeros({1, 20, 2});
+  *obstacle_pos = torch::zeros({1, 20, 2});
+  *obstacle_pos_step = torch::zeros({1, 20, 2});
   for (int i = 0; i < 20; ++i) {
-    obstacle_pos[0][19 - i][0] = pos_history[i].first;
-    obstacle_pos[0][19 - i][1] = pos_history[i].second;
+    (*obstacle_pos)[0][19 - i][0] = pos_history[i].first;
+    (*obstacle_pos)[0][19 - i][1] = pos_history[i].second;
     if (i == 19 || (i > 0 && pos_history[i].first == 0.0)) {
       break;
     }
-    obstacle_pos_step[0][19 - i][0] =
+    (*obstacle_pos_step)[0][19 - i][0] =
         pos_history[i].first - pos_history[i + 1].first;
-    obstacle_pos_step[0][19 - i][1] =
+    (*obstacle_pos_step)[0][19 - i][1] =
         pos_history[i].second - pos_history[i + 1].second;
   }
+  return true;
+}
 
-  // Build input features for torch
-  std::vector<torch::jit::IValue> torch_inputs;
-
-  torch_inputs.push_back(c10::ivalue::Tuple::create(
-      {std::move(img_tensor.to(device_)), std::move(obstacle_pos.to(device_)),
-       std::move(obstacle_pos_step.to(device_))}));
-
-  // Compute pred_traj
-  std::vector<double> pred_traj;
-
-  auto start_time = std::chrono::system_clock::now();
-  at::Tensor torch_output_tensor = torch_default_output_tensor_;
-  if (obstacle_ptr->IsPedestrian()) {
-    torch_output_tensor = torch_pedestrian_model_.forward(torch_inputs)
-                              .toTensor()
-                              .to(torch::kCPU);
-  } else {
-    torch_output_tensor =
-        torch_vehicle_model_.forward(torch_inputs).toTensor().to(torch::kCPU);
-  }
-
-  auto end_time = std::chrono::system_clock::now();
-  std::chrono::duration<double> diff = end_time - start_time;
-  ADEBUG << "Semantic_LSTM_evaluator used time: " << diff.count() * 1000
-         << " ms.";
+void SemanticLSTMEvaluator::ParseModelOutput(
+    const at::Tensor& torch_output_tensor, Obstacle* obstacle_ptr) {
+  Feature* latest_feature_ptr = obstacle_ptr->mutable_latest_feature();
+  CHECK_NOTNULL(latest_feature_ptr);
   auto torch_output = torch_output_tensor.accessor<float, 3>();
 
   // Get the trajectory
@@ -212,8 +308,6 @@ bool SemanticLSTMEvaluator::Evaluate(Obstacle* obstacle_ptr,
                    FLAGS_prediction_trajectory_time_resolution);
     }
   }
-
-  return true;
 }
 
 bool SemanticLSTMEvaluator::ExtractObstacleHistory(
@@ -54,6 +54,17 @@ class SemanticLSTMEvaluator : public Evaluator {
   bool Evaluate(Obstacle* obstacle_ptr,
                 ObstaclesContainer* obstacles_container) override;
 
+  /**
+   * @brief Evaluate a batch of obstacles with one forward pass per model.
+   *        Obstacles whose inputs cannot be prepared are left untouched.
+   * @param Obstacle pointer vector
+   * @param Obstacles container
+   * @param Output flags marking which obstacles were evaluated
+   */
+  bool EvaluateBatch(const std::vector<Obstacle*>& obstacle_ptrs,
+                     ObstaclesContainer* obstacles_container,
+                     std::vector<bool>* evaluated);
+
   /**
    * @brief Extract obstacle history
    * @param Obstacle pointer
@@ -74,6 +85,20 @@ class SemanticLSTMEvaluator : public Evaluator {
    */
   void LoadModel();
 
+  /**
+   * @brief Build the image and history tensors for one obstacle
+   */
+  bool PrepareTorchInputs(Obstacle* obstacle_ptr, torch::Tensor* img_tensor,
+                          torch::Tensor* obstacle_pos,
+                          torch::Tensor* obstacle_pos_step);
+
+  /**
+   * @brief Convert one model output sample of shape {1, 30, C} into a
+   *        predicted trajectory on the obstacle's latest feature
+   */
+  void ParseModelOutput(const at::Tensor& torch_output_tensor,
+                        Obstacle* obstacle_ptr);
+
  private:
   torch::jit::script::Module torch_vehicle_model_;
   torch::jit::script::Module torch_pedestrian_model_;
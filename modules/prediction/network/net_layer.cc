@@ -138,15 +138,11 @@ void Conv1d::Run(const std::vector<Eigen::MatrixXf>& inputs,
   output->resize(output_num_row, output_num_col);
   for (int i = 0; i < output_num_row; ++i) {
     for (int j = 0; j < output_num_col; ++j) {
-      float output_i_j_unbiased = 0.0f;
-      for (int p = 0; p < inputs[0].rows(); ++p) {
-        for (int q = j * stride_; q < j * stride_ + kernel_size; ++q) {
-          output_i_j_unbiased +=
-              inputs[0](p, q) * kernel_[i](p, q - j * stride_);
-        }
-      }
-
-      (*output)(i, j) = output_i_j_unbiased + bias_(i);
+      (*output)(i, j) =
+          kernel_[i]
+              .cwiseProduct(inputs[0].middleCols(j * stride_, kernel_size))
+              .sum() +
+          bias_(i);
     }
   }
 }
@@ -421,23 +417,37 @@ bool LSTM::Load(const LayerParameter& layer_pb) {
     AERROR << "Fail to Load recurrent output weights!";
     return false;
   }
+  ConcatenateGateWeights();
   ResetState();
   return true;
 }
 
+void LSTM::ConcatenateGateWeights() {
+  w_gates_.resize(wi_.rows(), 4 * units_);
+  w_gates_ << wi_, wf_, wc_, wo_;
+  r_w_gates_.resize(r_wi_.rows(), 4 * units_);
+  r_w_gates_ << r_wi_, r_wf_, r_wc_, r_wo_;
+  b_gates_.resize(4 * units_);
+  b_gates_ << bi_.transpose(), bf_.transpose(), bc_.transpose(),
+      bo_.transpose();
+}
+
 void LSTM::Step(const Eigen::MatrixXf& input, Eigen::MatrixXf* output,
                 Eigen::MatrixXf* ht_1, Eigen::MatrixXf* ct_1) {
-  Eigen::MatrixXf x_i = input * wi_ + bi_.transpose();
-  Eigen::MatrixXf x_f = input * wf_ + bf_.transpose();
-  Eigen::MatrixXf x_c = input * wc_ + bc_.transpose();
-  Eigen::MatrixXf x_o = input * wo_ + bo_.transpose();
+  Eigen::MatrixXf gates = input * w_gates_ + (*ht_1) * r_w_gates_;
+  gates.rowwise() += b_gates_;
 
-  Eigen::MatrixXf i = (x_i + (*ht_1) * r_wi_).unaryExpr(krecurrent_activation_);
-  Eigen::MatrixXf f = (x_f + (*ht_1) * r_wf_).unaryExpr(krecurrent_activation_);
+  Eigen::MatrixXf i =
+      gates.middleCols(0, units_).unaryExpr(krecurrent_activation_);
+  Eigen::MatrixXf f =
+      gates.middleCols(units_, units_).unaryExpr(krecurrent_activation_);
   Eigen::MatrixXf c =
       f.array() * ct_1->array() +
-      i.array() * ((x_c + (*ht_1) * r_wc_).unaryExpr(kactivation_)).array();
-  Eigen::MatrixXf o = (x_o + (*ht_1) * r_wo_).unaryExpr(krecurrent_activation_);
+      i.array() *
+          (gates.middleCols(2 * units_, units_).unaryExpr(kactivation_))
+              .array();
+  Eigen::MatrixXf o =
+      gates.middleCols(3 * units_, units_).unaryExpr(krecurrent_activation_);
   Eigen::MatrixXf h = o.array() * (c.unaryExpr(kactivation_)).array();
 
   *ht_1 = h;
@@ -364,6 +364,13 @@ class LSTM : public Layer {
   void Step(const Eigen::MatrixXf& input, Eigen::MatrixXf* output,
             Eigen::MatrixXf* ht_1, Eigen::MatrixXf* ct_1);
 
+  /**
+   * @brief Concatenate the per-gate weights and biases into [i f c o]
+   *     blocks, so that Step computes all gate pre-activations with one
+   *     matrix product per source instead of eight
+   */
+  void ConcatenateGateWeights();
+
   Eigen::MatrixXf wi_;
   Eigen::MatrixXf wf_;
   Eigen::MatrixXf wc_;
@@ -378,6 +385,10 @@ class LSTM : public Layer {
   Eigen::MatrixXf r_wc_;
   Eigen::MatrixXf r_wo_;
 
+  Eigen::MatrixXf w_gates_;
+  Eigen::MatrixXf r_w_gates_;
+  Eigen::RowVectorXf b_gates_;
+
   Eigen::MatrixXf ht_1_;
   Eigen::MatrixXf ct_1_;
   std::function<float(float)> kactivation_;
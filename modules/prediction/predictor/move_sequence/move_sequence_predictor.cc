@@ -28,8 +28,8 @@ namespace prediction {
 using apollo::common::PathPoint;
 using apollo::common::TrajectoryPoint;
 using apollo::hdmap::LaneInfo;
-using apollo::prediction::math_util::EvaluateCubicPolynomial;
-using apollo::prediction::math_util::EvaluateQuarticPolynomial;
+using apollo::prediction::math_util::SampleCubicPolynomial;
+using apollo::prediction::math_util::SampleQuarticPolynomial;
 
 MoveSequencePredictor::MoveSequencePredictor() {
   predictor_type_ = ObstacleConf::MOVE_SEQUENCE_PREDICTOR;
@@ -174,22 +174,29 @@ bool MoveSequencePredictor::DrawMoveSequenceTrajectoryPoints(
   }
   double prev_lane_l = lane_l;
 
-  // Draw each trajectory point within the total time of prediction
+  // Roll out both polynomials over the whole horizon in one batched pass
+  // each, so the per-point loop below only walks the lane. The previous
+  // step's s is read back from the samples instead of being re-evaluated.
   size_t total_num = static_cast<size_t>(total_time / period);
+  std::vector<double> lat_samples;
+  std::vector<double> lon_samples;
+  std::vector<double> speed_samples;
+  std::vector<double> acc_samples;
+  SampleCubicPolynomial(lateral_coeffs, period, total_num,
+                        time_to_lat_end_state, 0.0, &lat_samples);
+  SampleQuarticPolynomial(longitudinal_coeffs, period, total_num,
+                          lon_end_vt.second, lon_end_vt.first, &lon_samples,
+                          &speed_samples, &acc_samples);
+
+  // Draw each trajectory point within the total time of prediction
   for (size_t i = 0; i < total_num; ++i) {
     double relative_time = static_cast<double>(i) * period;
     Eigen::Vector2d point;
     double theta = M_PI;
 
-    lane_l = EvaluateCubicPolynomial(lateral_coeffs, relative_time, 0,
-                                     time_to_lat_end_state, 0.0);
-    double curr_s =
-        EvaluateQuarticPolynomial(longitudinal_coeffs, relative_time, 0,
-                                  lon_end_vt.second, lon_end_vt.first);
-    double prev_s = (i > 0) ? EvaluateQuarticPolynomial(
-                                  longitudinal_coeffs, relative_time - period,
-                                  0, lon_end_vt.second, lon_end_vt.first)
-                            : 0.0;
+    lane_l = lat_samples[i];
+    double curr_s = lon_samples[i];
+    double prev_s = (i > 0) ? lon_samples[i - 1] : 0.0;
     lane_s += std::max(0.0, (curr_s - prev_s));
     if (curr_s + FLAGS_double_precision < prev_s) {
       lane_l = prev_lane_l;
@@ -202,12 +209,8 @@ bool MoveSequencePredictor::DrawMoveSequenceTrajectoryPoints(
     }
 
     prev_lane_l = lane_l;
-    double lane_speed =
-        EvaluateQuarticPolynomial(longitudinal_coeffs, relative_time, 1,
-                                  lon_end_vt.second, lon_end_vt.first);
-    double lane_acc =
-        EvaluateQuarticPolynomial(longitudinal_coeffs, relative_time, 2,
-                                  lon_end_vt.second, lon_end_vt.first);
+    double lane_speed = speed_samples[i];
+    double lane_acc = acc_samples[i];
 
     TrajectoryPoint trajectory_point;
     PathPoint path_point;
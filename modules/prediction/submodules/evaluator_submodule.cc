@@ -16,6 +16,8 @@
 
 #include "modules/prediction/submodules/evaluator_submodule.h"
 
+#include <vector>
+
 #include "modules/common/adapters/adapter_gflags.h"
 #include "modules/common/adapters/proto/adapter_config.pb.h"
 #include "modules/common/time/time.h"
@@ -25,6 +27,32 @@
 namespace apollo {
 namespace prediction {
 
+namespace {
+
+// Fixed layout of the shared feature tensor, consumed by the predictor
+// submodule: [obstacle_num, {id, sequence_num, probabilities...}...].
+std::vector<double> PackLaneSequenceProbabilities(
+    const std::vector<Obstacle>& obstacles) {
+  std::vector<double> tensor;
+  tensor.push_back(static_cast<double>(obstacles.size()));
+  for (const Obstacle& obstacle : obstacles) {
+    tensor.push_back(static_cast<double>(obstacle.id()));
+    const Feature& feature = obstacle.latest_feature();
+    const int sequence_num =
+        feature.has_lane() && feature.lane().has_lane_graph()
+            ? feature.lane().lane_graph().lane_sequence_size()
+            : 0;
+    tensor.push_back(static_cast<double>(sequence_num));
+    for (int i = 0; i < sequence_num; ++i) {
+      tensor.push_back(
+          feature.lane().lane_graph().lane_sequence(i).probability());
+    }
+  }
+  return tensor;
+}
+
+}  // namespace
+
 EvaluatorSubmodule::~EvaluatorSubmodule() {}
 
 std::string EvaluatorSubmodule::Name() const {
@@ -48,6 +76,15 @@ bool EvaluatorSubmodule::Init() {
   // TODO(kechxu) change topic name when finalized
   evaluator_writer_ = node_->CreateWriter<SubmoduleOutput>(
       prediction_conf.topic_conf().evaluator_topic_name());
+  if (!FLAGS_shared_feature_block_name.empty()) {
+    shared_feature_enabled_ = shared_feature_block_.Init(
+        FLAGS_shared_feature_block_name, FLAGS_shared_feature_slot_num,
+        FLAGS_shared_feature_slot_capacity);
+    if (!shared_feature_enabled_) {
+      AWARN << "Shared feature block unavailable, falling back to in-message "
+               "feature handoff";
+    }
+  }
   return true;
 }
 
@@ -59,6 +96,14 @@ bool EvaluatorSubmodule::Proc(
   evaluator_manager_->Run(&obstacles_container);
   SubmoduleOutput submodule_output =
       obstacles_container.GetSubmoduleOutput(kHistorySize, frame_start_time);
+  if (shared_feature_enabled_) {
+    SharedFeatureHandle handle;
+    const std::vector<double> feature_tensor =
+        PackLaneSequenceProbabilities(submodule_output.curr_frame_obstacles());
+    if (shared_feature_block_.Write(feature_tensor, &handle)) {
+      submodule_output.set_feature_handle(handle);
+    }
+  }
   evaluator_writer_->Write(submodule_output);
   return true;
 }
@@ -28,6 +28,7 @@
 
 #include "modules/prediction/container/obstacles/obstacles_container.h"
 #include "modules/prediction/evaluator/evaluator_manager.h"
+#include "modules/prediction/submodules/shared_feature_block.h"
 #include "modules/prediction/submodules/submodule_output.h"
 
 namespace apollo {
@@ -62,6 +63,11 @@ class EvaluatorSubmodule : public cyber::Component<SubmoduleOutput> {
   std::shared_ptr<cyber::Writer<SubmoduleOutput>> evaluator_writer_;
 
   std::unique_ptr<EvaluatorManager> evaluator_manager_;
+
+  // shared-memory block for the evaluated feature tensors; only used when
+  // FLAGS_shared_feature_block_name is set
+  SharedFeatureBlock shared_feature_block_;
+  bool shared_feature_enabled_ = false;
 };
 
 CYBER_REGISTER_COMPONENT(EvaluatorSubmodule)
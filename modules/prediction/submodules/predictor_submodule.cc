@@ -16,6 +16,8 @@
 
 #include "modules/prediction/submodules/predictor_submodule.h"
 
+#include <vector>
+
 #include "absl/time/time.h"
 
 #include "modules/common/adapters/adapter_gflags.h"
@@ -30,6 +32,49 @@ namespace prediction {
 using apollo::common::time::Clock;
 using apollo::perception::PerceptionObstacles;
 
+namespace {
+
+// Apply a tensor written by the evaluator submodule, with the fixed layout
+// [obstacle_num, {id, sequence_num, probabilities...}...], onto the
+// reconstructed container. Returns false if the tensor is malformed.
+bool ApplyLaneSequenceProbabilities(const std::vector<double>& tensor,
+                                    ObstaclesContainer* obstacles_container) {
+  size_t offset = 0;
+  if (tensor.size() < 1) {
+    return false;
+  }
+  const int obstacle_num = static_cast<int>(tensor[offset++]);
+  for (int i = 0; i < obstacle_num; ++i) {
+    if (offset + 2 > tensor.size()) {
+      return false;
+    }
+    const int id = static_cast<int>(tensor[offset++]);
+    const int sequence_num = static_cast<int>(tensor[offset++]);
+    if (offset + static_cast<size_t>(sequence_num) > tensor.size()) {
+      return false;
+    }
+    Obstacle* obstacle = obstacles_container->GetObstacle(id);
+    if (obstacle == nullptr) {
+      offset += static_cast<size_t>(sequence_num);
+      continue;
+    }
+    Feature* feature = obstacle->mutable_latest_feature();
+    if (feature->mutable_lane()->mutable_lane_graph()->lane_sequence_size() ==
+        sequence_num) {
+      for (int j = 0; j < sequence_num; ++j) {
+        feature->mutable_lane()
+            ->mutable_lane_graph()
+            ->mutable_lane_sequence(j)
+            ->set_probability(tensor[offset + j]);
+      }
+    }
+    offset += static_cast<size_t>(sequence_num);
+  }
+  return true;
+}
+
+}  // namespace
+
 std::string PredictorSubmodule::Name() const {
   return FLAGS_evaluator_submodule_name;
 }
@@ -51,6 +96,15 @@ bool PredictorSubmodule::Init() {
   }
   predictor_writer_ = node_->CreateWriter<PredictionObstacles>(
       prediction_conf.topic_conf().prediction_topic());
+  if (!FLAGS_shared_feature_block_name.empty()) {
+    shared_feature_enabled_ = shared_feature_block_.Init(
+        FLAGS_shared_feature_block_name, FLAGS_shared_feature_slot_num,
+        FLAGS_shared_feature_slot_capacity);
+    if (!shared_feature_enabled_) {
+      AWARN << "Shared feature block unavailable, falling back to in-message "
+               "feature handoff";
+    }
+  }
   return true;
 }
 
@@ -64,6 +118,20 @@ bool PredictorSubmodule::Proc(
       perception_obstacles->error_code();
   const absl::Time& frame_start_time = submodule_output->frame_start_time();
   ObstaclesContainer obstacles_container(*submodule_output);
+  if (shared_feature_enabled_ && submodule_output->feature_handle().valid()) {
+    // Evaluated feature tensors ride in shared memory; a stale or torn slot
+    // just means we keep the in-message state, which stays authoritative.
+    std::vector<double> feature_tensor;
+    if (shared_feature_block_.Read(submodule_output->feature_handle(),
+                                   &feature_tensor)) {
+      if (!ApplyLaneSequenceProbabilities(feature_tensor,
+                                          &obstacles_container)) {
+        AWARN << "Malformed shared feature tensor, ignored";
+      }
+    } else {
+      AWARN << "Shared feature slot overwritten before it was consumed";
+    }
+  }
   predictor_manager_->Run(*perception_obstacles, adc_trajectory_container.get(),
                           &obstacles_container);
   PredictionObstacles prediction_obstacles =
@@ -28,6 +28,7 @@
 #include "modules/prediction/common/message_process.h"
 #include "modules/prediction/container/adc_trajectory/adc_trajectory_container.h"
 #include "modules/prediction/predictor/predictor_manager.h"
+#include "modules/prediction/submodules/shared_feature_block.h"
 #include "modules/prediction/submodules/submodule_output.h"
 
 namespace apollo {
@@ -67,6 +68,11 @@ class PredictorSubmodule
   std::shared_ptr<cyber::Writer<PredictionObstacles>> predictor_writer_;
 
   std::unique_ptr<PredictorManager> predictor_manager_;
+
+  // shared-memory block the evaluator submodule writes feature tensors to;
+  // only attached when FLAGS_shared_feature_block_name is set
+  SharedFeatureBlock shared_feature_block_;
+  bool shared_feature_enabled_ = false;
 };
 
 CYBER_REGISTER_COMPONENT(PredictorSubmodule)
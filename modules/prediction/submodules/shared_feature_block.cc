@@ -0,0 +1,143 @@
+/******************************************************************************
+ * Copyright 2020 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "modules/prediction/submodules/shared_feature_block.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+
+#include "cyber/common/log.h"
+
+namespace apollo {
+namespace prediction {
+
+SharedFeatureBlock::~SharedFeatureBlock() {
+  if (shm_addr_ != nullptr) {
+    munmap(shm_addr_, shm_size_);
+  }
+  if (owner_ && !name_.empty()) {
+    shm_unlink(name_.c_str());
+  }
+}
+
+bool SharedFeatureBlock::Init(const std::string& name, const int slot_num,
+                              const int slot_capacity) {
+  if (name.empty() || slot_num <= 0 || slot_capacity <= 0) {
+    AERROR << "Invalid shared feature block parameters: name [" << name
+           << "], slot_num [" << slot_num << "], slot_capacity ["
+           << slot_capacity << "]";
+    return false;
+  }
+  name_ = name;
+  slot_num_ = slot_num;
+  slot_capacity_ = slot_capacity;
+  slot_stride_ =
+      sizeof(SlotHeader) + static_cast<size_t>(slot_capacity) * sizeof(double);
+  shm_size_ = static_cast<size_t>(slot_num) * slot_stride_;
+
+  // Attach to an existing block, or create and zero it as the owner.
+  int fd = shm_open(name_.c_str(), O_RDWR, 0644);
+  if (fd < 0 && errno == ENOENT) {
+    fd = shm_open(name_.c_str(), O_RDWR | O_CREAT | O_EXCL, 0644);
+    owner_ = (fd >= 0);
+  }
+  if (fd < 0) {
+    AERROR << "Failed to open shared feature block [" << name_ << "]: "
+           << std::strerror(errno);
+    return false;
+  }
+  if (ftruncate(fd, static_cast<off_t>(shm_size_)) < 0) {
+    AERROR << "Failed to size shared feature block [" << name_ << "]: "
+           << std::strerror(errno);
+    close(fd);
+    return false;
+  }
+  shm_addr_ =
+      mmap(nullptr, shm_size_, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  close(fd);
+  if (shm_addr_ == MAP_FAILED) {
+    shm_addr_ = nullptr;
+    AERROR << "Failed to map shared feature block [" << name_ << "]: "
+           << std::strerror(errno);
+    return false;
+  }
+  return true;
+}
+
+bool SharedFeatureBlock::Write(const std::vector<double>& payload,
+                               SharedFeatureHandle* handle) {
+  CHECK_NOTNULL(handle);
+  if (shm_addr_ == nullptr) {
+    return false;
+  }
+  if (payload.empty() ||
+      payload.size() > static_cast<size_t>(slot_capacity_)) {
+    AERROR << "Feature tensor of size [" << payload.size()
+           << "] does not fit a slot of capacity [" << slot_capacity_ << "]";
+    return false;
+  }
+  const int slot = next_slot_;
+  next_slot_ = (next_slot_ + 1) % slot_num_;
+  SlotHeader* header = slot_header(slot);
+  const uint64_t sequence = header->sequence.load(std::memory_order_relaxed);
+  header->sequence.store(sequence + 1, std::memory_order_release);
+  std::memcpy(slot_payload(slot), payload.data(),
+              payload.size() * sizeof(double));
+  header->sequence.store(sequence + 2, std::memory_order_release);
+  handle->sequence = sequence + 2;
+  handle->slot = slot;
+  handle->size = static_cast<uint32_t>(payload.size());
+  return true;
+}
+
+bool SharedFeatureBlock::Read(const SharedFeatureHandle& handle,
+                              std::vector<double>* payload) const {
+  CHECK_NOTNULL(payload);
+  if (shm_addr_ == nullptr || !handle.valid() || handle.slot >= slot_num_ ||
+      handle.size > static_cast<uint32_t>(slot_capacity_)) {
+    return false;
+  }
+  const SlotHeader* header = slot_header(handle.slot);
+  if (header->sequence.load(std::memory_order_acquire) != handle.sequence) {
+    // the writer has moved on; the slot no longer holds this tensor
+    return false;
+  }
+  payload->resize(handle.size);
+  std::memcpy(payload->data(), slot_payload(handle.slot),
+              static_cast<size_t>(handle.size) * sizeof(double));
+  return header->sequence.load(std::memory_order_acquire) == handle.sequence;
+}
+
+SharedFeatureBlock::SlotHeader* SharedFeatureBlock::slot_header(
+    const int slot) const {
+  return reinterpret_cast<SlotHeader*>(static_cast<char*>(shm_addr_) +
+                                       static_cast<size_t>(slot) *
+                                           slot_stride_);
+}
+
+double* SharedFeatureBlock::slot_payload(const int slot) const {
+  return reinterpret_cast<double*>(static_cast<char*>(shm_addr_) +
+                                   static_cast<size_t>(slot) * slot_stride_ +
+                                   sizeof(SlotHeader));
+}
+
+}  // namespace prediction
+}  // namespace apollo
@@ -0,0 +1,104 @@
+/******************************************************************************
+ * Copyright 2020 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+/**
+ * @file
+ * @brief Shared-memory feature block for the split-submodule deployment
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace apollo {
+namespace prediction {
+
+/**
+ * @brief Handle to one slot of a SharedFeatureBlock. The handle is small
+ *        enough to ride in the submodule channel message while the feature
+ *        tensor itself stays in shared memory.
+ */
+struct SharedFeatureHandle {
+  uint64_t sequence = 0;
+  int32_t slot = -1;
+  uint32_t size = 0;  // number of doubles in the payload
+
+  bool valid() const { return slot >= 0 && size > 0; }
+};
+
+/**
+ * @brief A named POSIX shared-memory ring of fixed-layout feature slots with
+ *        a single writer and any number of readers. Each slot is guarded by
+ *        a seqlock so a reader detects torn or overwritten payloads and can
+ *        fall back to the in-message state.
+ */
+class SharedFeatureBlock {
+ public:
+  SharedFeatureBlock() = default;
+
+  ~SharedFeatureBlock();
+
+  /**
+   * @brief Create the named block or attach to it if it already exists.
+   * @param name name of the POSIX shared-memory object.
+   * @param slot_num number of slots in the ring.
+   * @param slot_capacity capacity of one slot in doubles.
+   * @return If the block is ready for use.
+   */
+  bool Init(const std::string& name, const int slot_num,
+            const int slot_capacity);
+
+  /**
+   * @brief Write a feature tensor into the next slot of the ring.
+   * @param payload the tensor to write.
+   * @param handle output handle identifying the written slot.
+   * @return If the tensor fits and was written.
+   */
+  bool Write(const std::vector<double>& payload, SharedFeatureHandle* handle);
+
+  /**
+   * @brief Read the feature tensor a handle points to.
+   * @param handle handle received through the channel message.
+   * @param payload output tensor.
+   * @return If the slot still holds the handed-off tensor.
+   */
+  bool Read(const SharedFeatureHandle& handle,
+            std::vector<double>* payload) const;
+
+ private:
+  struct SlotHeader {
+    // even: stable; odd: writer in progress
+    std::atomic<uint64_t> sequence;
+  };
+
+  SlotHeader* slot_header(const int slot) const;
+  double* slot_payload(const int slot) const;
+
+  std::string name_;
+  int slot_num_ = 0;
+  int slot_capacity_ = 0;
+  size_t slot_stride_ = 0;
+  int next_slot_ = 0;
+  void* shm_addr_ = nullptr;
+  size_t shm_size_ = 0;
+  bool owner_ = false;
+};
+
+}  // namespace prediction
+}  // namespace apollo
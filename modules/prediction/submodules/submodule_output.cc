@@ -51,6 +51,11 @@ void SubmoduleOutput::set_curr_scenario(const Scenario& scenario) {
   curr_scenario_ = scenario;
 }
 
+void SubmoduleOutput::set_feature_handle(
+    const SharedFeatureHandle& feature_handle) {
+  feature_handle_ = feature_handle;
+}
+
 const std::vector<Obstacle>& SubmoduleOutput::curr_frame_obstacles() const {
   return curr_frame_obstacles_;
 }
@@ -28,6 +28,7 @@
 #include "modules/common/util/lru_cache.h"
 #include "modules/perception/proto/perception_obstacle.pb.h"
 #include "modules/prediction/container/obstacles/obstacle.h"
+#include "modules/prediction/submodules/shared_feature_block.h"
 
 namespace apollo {
 namespace prediction {
@@ -61,6 +62,8 @@ class SubmoduleOutput {
 
   void set_curr_scenario(const Scenario& scenario);
 
+  void set_feature_handle(const SharedFeatureHandle& feature_handle);
+
   const std::vector<Obstacle>& curr_frame_obstacles() const;
 
   const Obstacle& GetEgoVehicle() const;
@@ -78,6 +81,8 @@ class SubmoduleOutput {
 
   const Scenario& curr_scenario() const { return curr_scenario_; }
 
+  const SharedFeatureHandle& feature_handle() const { return feature_handle_; }
+
  protected:
   std::vector<Obstacle> curr_frame_obstacles_;
   Obstacle ego_vehicle_;
@@ -86,6 +91,9 @@ class SubmoduleOutput {
   std::vector<int> curr_frame_considered_obstacle_ids_;
   absl::Time frame_start_time_;
   Scenario curr_scenario_;
+  // handle of the shared-memory feature tensor written for this frame;
+  // invalid when the shared-memory handoff is disabled
+  SharedFeatureHandle feature_handle_;
 };
 
 }  // namespace prediction
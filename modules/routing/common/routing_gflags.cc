@@ -30,5 +30,22 @@ DEFINE_double(min_length_for_lane_change, 1.0,
 DEFINE_bool(enable_change_lane_in_result, true,
             "contain change lane operator in result");
 
+DEFINE_bool(topo_creator_force_rebuild, false,
+            "regenerate the routing topo graph even when the dumped files are "
+            "newer than the base map");
+
+DEFINE_bool(enable_bidirectional_routing_search, false,
+            "search the topo graph from both ends and meet in the middle; "
+            "only takes effect when change lane is disabled in result");
+
+DEFINE_bool(enable_route_cache, false,
+            "reuse previously searched sub-routes between identical waypoint "
+            "pairs; only applies to requests without blacklisted lanes or "
+            "roads");
+
+DEFINE_uint32(route_cache_size, 128,
+              "max number of cached sub-routes, oldest entries are evicted "
+              "first");
+
 DEFINE_uint32(routing_response_history_interval_ms, 1000,
               "ms, emit routing resposne for this time interval");
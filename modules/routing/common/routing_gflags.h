@@ -23,4 +23,8 @@ DECLARE_string(routing_node_name);
 
 DECLARE_double(min_length_for_lane_change);
 DECLARE_bool(enable_change_lane_in_result);
+DECLARE_bool(topo_creator_force_rebuild);
+DECLARE_bool(enable_bidirectional_routing_search);
+DECLARE_bool(enable_route_cache);
+DECLARE_uint32(route_cache_size);
 DECLARE_uint32(routing_response_history_interval_ms);
@@ -16,6 +16,8 @@
 
 #include "modules/routing/core/black_list_range_generator.h"
 
+#include <string>
+
 namespace apollo {
 namespace routing {
 
@@ -58,6 +60,19 @@ void GetOutParallelLane(const TopoNode* node,
   }
 }
 
+std::string BlacklistKey(const RoutingRequest& request) {
+  std::string key;
+  for (const auto& lane : request.blacklisted_lane()) {
+    key += lane.id() + "#" + std::to_string(lane.start_s()) + "#" +
+           std::to_string(lane.end_s()) + "|";
+  }
+  key += "@";
+  for (const auto& road_id : request.blacklisted_road()) {
+    key += road_id + "|";
+  }
+  return key;
+}
+
 void GetInParallelLane(const TopoNode* node,
                        std::unordered_set<const TopoNode*>* const node_set) {
   for (const auto* edge : node->InFromLeftOrRightEdge()) {
@@ -119,9 +134,20 @@ void AddBlackMapFromInParallel(const TopoNode* node, double cut_ratio,
 void BlackListRangeGenerator::GenerateBlackMapFromRequest(
     const RoutingRequest& request, const TopoGraph* graph,
     TopoRangeManager* const range_manager) const {
+  const std::string key = BlacklistKey(request);
+  if (has_cached_ranges_ && graph == cached_graph_ &&
+      key == cached_blacklist_key_) {
+    ADEBUG << "Blacklist range cache hit.";
+    *range_manager = cached_ranges_;
+    return;
+  }
   AddBlackMapFromLane(request, graph, range_manager);
   AddBlackMapFromRoad(request, graph, range_manager);
   range_manager->SortAndMerge();
+  cached_blacklist_key_ = key;
+  cached_graph_ = graph;
+  cached_ranges_ = *range_manager;
+  has_cached_ranges_ = true;
 }
 
 void BlackListRangeGenerator::AddBlackMapFromTerminal(
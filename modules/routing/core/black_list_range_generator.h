@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <string>
 #include <unordered_set>
 
 #include "modules/routing/graph/topo_graph.h"
@@ -38,6 +39,15 @@ class BlackListRangeGenerator {
                                const TopoNode* dest_node, double start_s,
                                double end_s,
                                TopoRangeManager* const range_manager) const;
+
+ private:
+  // ranges generated for the last seen blacklist; fleet-wide road closures
+  // change every few minutes while requests arrive far more often, so
+  // consecutive requests usually share the same blacklist state
+  mutable std::string cached_blacklist_key_;
+  mutable const TopoGraph* cached_graph_ = nullptr;
+  mutable TopoRangeManager cached_ranges_;
+  mutable bool has_cached_ranges_ = false;
 };
 
 }  // namespace routing
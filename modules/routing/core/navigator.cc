@@ -81,6 +81,12 @@ void SetErrorCode(const common::ErrorCode& error_code_id,
   }
 }
 
+std::string SubRouteCacheKey(const TopoNode* way_start, const TopoNode* way_end,
+                             double way_start_s, double way_end_s) {
+  return way_start->LaneId() + "#" + std::to_string(way_start_s) + "#" +
+         way_end->LaneId() + "#" + std::to_string(way_end_s);
+}
+
 void PrintDebugData(const std::vector<NodeWithRange>& nodes) {
   AINFO << "Route lane id\tis virtual\tstart s\tend s";
   for (const auto& node : nodes) {
@@ -148,13 +154,30 @@ bool Navigator::MergeRoute(
   return true;
 }
 
+void Navigator::AddRouteToCache(const std::string& key,
+                                const std::vector<NodeWithRange>& nodes) {
+  route_cache_[key] = nodes;
+  route_cache_order_.push_back(key);
+  while (route_cache_order_.size() > FLAGS_route_cache_size) {
+    route_cache_.erase(route_cache_order_.front());
+    route_cache_order_.pop_front();
+  }
+}
+
 bool Navigator::SearchRouteByStrategy(
     const TopoGraph* graph, const std::vector<const TopoNode*>& way_nodes,
     const std::vector<double>& way_s,
-    std::vector<NodeWithRange>* const result_nodes) const {
+    std::vector<NodeWithRange>* const result_nodes) {
   std::unique_ptr<Strategy> strategy_ptr;
   strategy_ptr.reset(new AStarStrategy(FLAGS_enable_change_lane_in_result));
 
+  // The search of one waypoint pair only depends on the pair itself and
+  // the black list, so cached sub-routes stay valid for requests without
+  // blacklisted lanes or roads. Repeated dispatch legs and the shared
+  // suffix of a reroute hit the cache and skip the graph search.
+  const bool use_cache =
+      FLAGS_enable_route_cache && topo_range_manager_.RangeMap().empty();
+
   result_nodes->clear();
   std::vector<NodeWithRange> node_vec;
   for (size_t i = 1; i < way_nodes.size(); ++i) {
@@ -163,6 +186,18 @@ bool Navigator::SearchRouteByStrategy(
     double way_start_s = way_s[i - 1];
     double way_end_s = way_s[i];
 
+    std::string cache_key;
+    if (use_cache) {
+      cache_key = SubRouteCacheKey(way_start, way_end, way_start_s, way_end_s);
+      const auto cache_iter = route_cache_.find(cache_key);
+      if (cache_iter != route_cache_.end()) {
+        ADEBUG << "Sub-route cache hit: " << cache_key;
+        node_vec.insert(node_vec.end(), cache_iter->second.begin(),
+                        cache_iter->second.end());
+        continue;
+      }
+    }
+
     TopoRangeManager full_range_manager = topo_range_manager_;
     black_list_generator_->AddBlackMapFromTerminal(
         way_start, way_end, way_start_s, way_end_s, &full_range_manager);
@@ -189,6 +224,10 @@ bool Navigator::SearchRouteByStrategy(
       return false;
     }
 
+    if (use_cache) {
+      AddRouteToCache(cache_key, cur_result_nodes);
+    }
+
     node_vec.insert(node_vec.end(), cur_result_nodes.begin(),
                     cur_result_nodes.end());
   }
@@ -16,8 +16,10 @@
 
 #pragma once
 
+#include <list>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "modules/routing/core/black_list_range_generator.h"
@@ -46,11 +48,14 @@ class Navigator {
   bool SearchRouteByStrategy(
       const TopoGraph* graph, const std::vector<const TopoNode*>& way_nodes,
       const std::vector<double>& way_s,
-      std::vector<NodeWithRange>* const result_nodes) const;
+      std::vector<NodeWithRange>* const result_nodes);
 
   bool MergeRoute(const std::vector<NodeWithRange>& node_vec,
                   std::vector<NodeWithRange>* const result_node_vec) const;
 
+  void AddRouteToCache(const std::string& key,
+                       const std::vector<NodeWithRange>& nodes);
+
  private:
   bool is_ready_ = false;
   std::unique_ptr<TopoGraph> graph_;
@@ -59,6 +64,12 @@ class Navigator {
 
   std::unique_ptr<BlackListRangeGenerator> black_list_generator_;
   std::unique_ptr<ResultGenerator> result_generator_;
+
+  // Sub-routes between waypoint pairs, keyed by the terminal lane ids
+  // and s values. Entries reference nodes owned by graph_, which lives
+  // as long as the navigator. Oldest entries are evicted first.
+  std::unordered_map<std::string, std::vector<NodeWithRange>> route_cache_;
+  std::list<std::string> route_cache_order_;
 };
 
 }  // namespace routing
@@ -28,15 +28,15 @@ namespace {
 void merge_block_range(const TopoNode* topo_node,
                        const std::vector<NodeSRange>& origin_range,
                        std::vector<NodeSRange>* block_range) {
-  std::vector<NodeSRange> sorted_origin_range(origin_range);
-  std::sort(sorted_origin_range.begin(), sorted_origin_range.end());
+  // ranges are kept sorted on insert by TopoRangeManager::Add, so merging
+  // is a single linear pass
   size_t cur_index = 0;
-  auto total_size = sorted_origin_range.size();
+  auto total_size = origin_range.size();
   while (cur_index < total_size) {
-    NodeSRange range(sorted_origin_range[cur_index]);
+    NodeSRange range(origin_range[cur_index]);
     ++cur_index;
     while (cur_index < total_size &&
-           range.MergeRangeOverlap(sorted_origin_range[cur_index])) {
+           range.MergeRangeOverlap(origin_range[cur_index])) {
       ++cur_index;
     }
     if (range.EndS() < topo_node->StartS() ||
@@ -78,7 +78,10 @@ void TopoRangeManager::Clear() { range_map_.clear(); }
 
 void TopoRangeManager::Add(const TopoNode* node, double start_s, double end_s) {
   NodeSRange range(start_s, end_s);
-  range_map_[node].push_back(range);
+  auto& ranges = range_map_[node];
+  // keep each node's ranges sorted so SortAndMerge is a linear merge pass
+  auto iter = std::lower_bound(ranges.begin(), ranges.end(), range);
+  ranges.insert(iter, range);
 }
 
 void TopoRangeManager::SortAndMerge() {
@@ -18,6 +18,7 @@
 
 #include <utility>
 
+#include "cyber/transport/qos/qos_profile_conf.h"
 #include "modules/common/adapters/adapter_gflags.h"
 #include "modules/routing/common/routing_gflags.h"
 
@@ -35,28 +36,13 @@ bool RoutingComponent::Init() {
   AINFO << "Config file: " << cyber::ComponentBase::ConfigFilePath()
         << " is loaded.";
 
-  apollo::cyber::proto::RoleAttributes attr;
-  attr.set_channel_name(routing_conf.topic_config().routing_response_topic());
-  auto qos = attr.mutable_qos_profile();
-  qos->set_history(apollo::cyber::proto::QosHistoryPolicy::HISTORY_KEEP_LAST);
-  qos->set_reliability(
-      apollo::cyber::proto::QosReliabilityPolicy::RELIABILITY_RELIABLE);
-  qos->set_durability(
-      apollo::cyber::proto::QosDurabilityPolicy::DURABILITY_TRANSIENT_LOCAL);
-  response_writer_ = node_->CreateWriter<RoutingResponse>(attr);
+  response_writer_ = node_->CreateWriter<RoutingResponse>(
+      routing_conf.topic_config().routing_response_topic(),
+      apollo::cyber::transport::QosProfileConf::QOS_PROFILE_LATCHED);
 
-  apollo::cyber::proto::RoleAttributes attr_history;
-  attr_history.set_channel_name(
-      routing_conf.topic_config().routing_response_history_topic());
-  auto qos_history = attr_history.mutable_qos_profile();
-  qos_history->set_history(
-      apollo::cyber::proto::QosHistoryPolicy::HISTORY_KEEP_LAST);
-  qos_history->set_reliability(
-      apollo::cyber::proto::QosReliabilityPolicy::RELIABILITY_RELIABLE);
-  qos_history->set_durability(
-      apollo::cyber::proto::QosDurabilityPolicy::DURABILITY_TRANSIENT_LOCAL);
-
-  response_history_writer_ = node_->CreateWriter<RoutingResponse>(attr_history);
+  response_history_writer_ = node_->CreateWriter<RoutingResponse>(
+      routing_conf.topic_config().routing_response_history_topic(),
+      apollo::cyber::transport::QosProfileConf::QOS_PROFILE_LATCHED);
   std::weak_ptr<RoutingComponent> self =
       std::dynamic_pointer_cast<RoutingComponent>(shared_from_this());
   timer_.reset(new ::apollo::cyber::Timer(
@@ -175,6 +175,20 @@ bool AdjustLaneChange(std::vector<const TopoNode*>* const result_node_vec) {
   return true;
 }
 
+bool FillResultNodes(std::vector<const TopoNode*>* const result_node_vec,
+                     std::vector<NodeWithRange>* result_nodes) {
+  if (!AdjustLaneChange(result_node_vec)) {
+    AERROR << "Failed to adjust lane change";
+    return false;
+  }
+  result_nodes->clear();
+  for (const auto* node : *result_node_vec) {
+    result_nodes->emplace_back(node->OriginNode(), node->StartS(),
+                               node->EndS());
+  }
+  return true;
+}
+
 bool Reconstruct(
     const std::unordered_map<const TopoNode*, const TopoNode*>& came_from,
     const TopoNode* dest_node, std::vector<NodeWithRange>* result_nodes) {
@@ -187,16 +201,7 @@ bool Reconstruct(
     iter = came_from.find(iter->second);
   }
   std::reverse(result_node_vec.begin(), result_node_vec.end());
-  if (!AdjustLaneChange(&result_node_vec)) {
-    AERROR << "Failed to adjust lane change";
-    return false;
-  }
-  result_nodes->clear();
-  for (const auto* node : result_node_vec) {
-    result_nodes->emplace_back(node->OriginNode(), node->StartS(),
-                               node->EndS());
-  }
-  return true;
+  return FillResultNodes(&result_node_vec, result_nodes);
 }
 
 }  // namespace
@@ -221,11 +226,131 @@ double AStarStrategy::HeuristicCost(const TopoNode* src_node,
   return distance;
 }
 
+bool AStarStrategy::BidirectionalSearch(
+    const SubTopoGraph* sub_graph, const TopoNode* src_node,
+    const TopoNode* dest_node, std::vector<NodeWithRange>* const result_nodes) {
+  AINFO << "Start bidirectional search algorithm.";
+  if (src_node == dest_node) {
+    std::vector<const TopoNode*> result_node_vec{src_node};
+    return FillResultNodes(&result_node_vec, result_nodes);
+  }
+
+  std::priority_queue<SearchNode> forward_queue;
+  std::priority_queue<SearchNode> backward_queue;
+  std::unordered_map<const TopoNode*, double> forward_g;
+  std::unordered_map<const TopoNode*, double> backward_g;
+  std::unordered_map<const TopoNode*, const TopoNode*> forward_came_from;
+  std::unordered_map<const TopoNode*, const TopoNode*> backward_came_from;
+  std::unordered_set<const TopoNode*> forward_closed;
+  std::unordered_set<const TopoNode*> backward_closed;
+
+  SearchNode src_search_node(src_node);
+  src_search_node.f = 0.0;
+  forward_queue.push(src_search_node);
+  forward_g[src_node] = 0.0;
+  SearchNode dest_search_node(dest_node);
+  dest_search_node.f = 0.0;
+  backward_queue.push(dest_search_node);
+  backward_g[dest_node] = 0.0;
+
+  double best_cost = std::numeric_limits<double>::max();
+  const TopoNode* meeting_node = nullptr;
+  std::unordered_set<const TopoEdge*> next_edge_set;
+  std::unordered_set<const TopoEdge*> sub_edge_set;
+  while (!forward_queue.empty() && !backward_queue.empty()) {
+    // Neither front can improve on the best connection found so far.
+    if (forward_queue.top().f + backward_queue.top().f >= best_cost) {
+      break;
+    }
+    const bool expand_forward =
+        forward_queue.top().f <= backward_queue.top().f;
+    auto& queue = expand_forward ? forward_queue : backward_queue;
+    auto& g_score = expand_forward ? forward_g : backward_g;
+    auto& other_g_score = expand_forward ? backward_g : forward_g;
+    auto& closed_set = expand_forward ? forward_closed : backward_closed;
+    auto& came_from = expand_forward ? forward_came_from : backward_came_from;
+
+    const SearchNode current_node = queue.top();
+    queue.pop();
+    const auto* node = current_node.topo_node;
+    if (closed_set.count(node) != 0) {
+      continue;
+    }
+    closed_set.emplace(node);
+
+    next_edge_set.clear();
+    if (expand_forward) {
+      for (const auto* edge : node->OutToSucEdge()) {
+        sub_edge_set.clear();
+        sub_graph->GetSubInEdgesIntoSubGraph(edge, &sub_edge_set);
+        next_edge_set.insert(sub_edge_set.begin(), sub_edge_set.end());
+      }
+    } else {
+      for (const auto* edge : node->InFromPreEdge()) {
+        sub_edge_set.clear();
+        sub_graph->GetSubOutEdgesIntoSubGraph(edge, &sub_edge_set);
+        next_edge_set.insert(sub_edge_set.begin(), sub_edge_set.end());
+      }
+    }
+
+    for (const auto* edge : next_edge_set) {
+      const auto* neighbor = expand_forward ? edge->ToNode() : edge->FromNode();
+      if (closed_set.count(neighbor) != 0) {
+        continue;
+      }
+      // Both directions accumulate the node cost of the edge's to-node, so
+      // forward_g counts every node after src up to (and including) the
+      // meeting node and backward_g counts everything after it.
+      const double tentative_g_score =
+          g_score[node] + GetCostToNeighbor(edge);
+      const auto iter = g_score.find(neighbor);
+      if (iter != g_score.end() && tentative_g_score >= iter->second) {
+        continue;
+      }
+      g_score[neighbor] = tentative_g_score;
+      came_from[neighbor] = node;
+      SearchNode next_node(neighbor);
+      next_node.f = tentative_g_score;
+      queue.push(next_node);
+      const auto other_iter = other_g_score.find(neighbor);
+      if (other_iter != other_g_score.end() &&
+          tentative_g_score + other_iter->second < best_cost) {
+        best_cost = tentative_g_score + other_iter->second;
+        meeting_node = neighbor;
+      }
+    }
+  }
+  if (meeting_node == nullptr) {
+    AERROR << "Failed to find goal lane with id: " << dest_node->LaneId();
+    return false;
+  }
+
+  std::vector<const TopoNode*> result_node_vec;
+  result_node_vec.push_back(meeting_node);
+  auto iter = forward_came_from.find(meeting_node);
+  while (iter != forward_came_from.end()) {
+    result_node_vec.push_back(iter->second);
+    iter = forward_came_from.find(iter->second);
+  }
+  std::reverse(result_node_vec.begin(), result_node_vec.end());
+  iter = backward_came_from.find(meeting_node);
+  while (iter != backward_came_from.end()) {
+    result_node_vec.push_back(iter->second);
+    iter = backward_came_from.find(iter->second);
+  }
+  return FillResultNodes(&result_node_vec, result_nodes);
+}
+
 bool AStarStrategy::Search(const TopoGraph* graph,
                            const SubTopoGraph* sub_graph,
                            const TopoNode* src_node, const TopoNode* dest_node,
                            std::vector<NodeWithRange>* const result_nodes) {
   Clear();
+  if (FLAGS_enable_bidirectional_routing_search && !change_lane_enabled_) {
+    // Lane change bookkeeping (enter_s_) is inherently forward directional,
+    // so the bidirectional fronts are only used on forward-edge searches.
+    return BidirectionalSearch(sub_graph, src_node, dest_node, result_nodes);
+  }
   AINFO << "Start A* search algorithm.";
 
   std::priority_queue<SearchNode> open_set_detail;
@@ -37,6 +37,12 @@ class AStarStrategy : public Strategy {
  private:
   void Clear();
   double HeuristicCost(const TopoNode* src_node, const TopoNode* dest_node);
+  // Dijkstra fronts started from both ends that meet in the middle. Only
+  // valid for forward-edge-only searches, where costs are direction
+  // independent; lane change searches must use the unidirectional code.
+  bool BidirectionalSearch(const SubTopoGraph* sub_graph,
+                           const TopoNode* src_node, const TopoNode* dest_node,
+                           std::vector<NodeWithRange>* const result_nodes);
   double GetResidualS(const TopoNode* node);
   double GetResidualS(const TopoEdge* edge, const TopoNode* to_node);
 
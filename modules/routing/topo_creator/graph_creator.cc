@@ -16,6 +16,11 @@
 
 #include "modules/routing/topo_creator/graph_creator.h"
 
+#include <sys/stat.h>
+
+#include <algorithm>
+#include <future>
+#include <thread>
 #include <vector>
 
 #include "absl/strings/match.h"
@@ -61,6 +66,12 @@ GraphCreator::GraphCreator(const std::string& base_map_file_path,
       routing_conf_(routing_conf) {}
 
 bool GraphCreator::Create() {
+  if (!FLAGS_topo_creator_force_rebuild && IsDumpUpToDate()) {
+    AINFO << "Dumped topo files are newer than base map "
+          << base_map_file_path_ << ", skip regeneration.";
+    return true;
+  }
+
   if (absl::EndsWith(base_map_file_path_, ".xml")) {
     if (!hdmap::adapter::OpendriveAdapter::LoadData(base_map_file_path_,
                                                     &pbmap_)) {
@@ -81,7 +92,6 @@ bool GraphCreator::Create() {
 
   node_index_map_.clear();
   road_id_map_.clear();
-  showed_edge_id_set_.clear();
 
   for (const auto& road : pbmap_.road()) {
     for (const auto& section : road.section()) {
@@ -95,6 +105,10 @@ bool GraphCreator::Create() {
   const double min_turn_radius =
       VehicleConfigHelper::GetConfig().vehicle_param().min_turn_radius();
 
+  // collect valid lanes once, in map order, so node and edge generation can
+  // be sharded over worker threads and merged back deterministically
+  std::vector<const hdmap::Lane*> valid_lanes;
+  valid_lanes.reserve(pbmap_.lane_size());
   for (const auto& lane : pbmap_.lane()) {
     const auto& lane_id = lane.id().id();
     if (forbidden_lane_id_set_.find(lane_id) != forbidden_lane_id_set_.end()) {
@@ -107,37 +121,81 @@ bool GraphCreator::Create() {
       ADEBUG << "The u-turn lane radius is too small for the vehicle to turn";
       continue;
     }
-    AINFO << "Current lane id: " << lane_id;
-    node_index_map_[lane_id] = graph_.node_size();
-    const auto iter = road_id_map_.find(lane_id);
-    if (iter != road_id_map_.end()) {
-      node_creator::GetPbNode(lane, iter->second, routing_conf_,
-                              graph_.add_node());
-    } else {
-      AWARN << "Failed to find road id of lane " << lane_id;
-      node_creator::GetPbNode(lane, "", routing_conf_, graph_.add_node());
-    }
+    ADEBUG << "Current lane id: " << lane_id;
+    node_index_map_[lane_id] = static_cast<int>(valid_lanes.size());
+    valid_lanes.push_back(&lane);
   }
 
-  for (const auto& lane : pbmap_.lane()) {
-    const auto& lane_id = lane.id().id();
-    if (forbidden_lane_id_set_.find(lane_id) != forbidden_lane_id_set_.end()) {
-      ADEBUG << "Ignored lane id: " << lane_id
-             << " because its type is NOT CITY_DRIVING.";
-      continue;
-    }
-    const auto& from_node = graph_.node(node_index_map_[lane_id]);
+  const size_t lane_num = valid_lanes.size();
+  const size_t worker_num = std::max(
+      static_cast<size_t>(1),
+      std::min(static_cast<size_t>(std::thread::hardware_concurrency()),
+               lane_num));
 
-    AddEdge(from_node, lane.successor_id(), Edge::FORWARD);
-    if (lane.length() < FLAGS_min_length_for_lane_change) {
-      continue;
+  std::vector<Node> nodes(lane_num);
+  {
+    std::vector<std::future<void>> futures;
+    for (size_t worker = 0; worker < worker_num; ++worker) {
+      futures.push_back(std::async(std::launch::async, [&, worker]() {
+        for (size_t i = worker; i < lane_num; i += worker_num) {
+          const auto& lane = *valid_lanes[i];
+          const auto iter = road_id_map_.find(lane.id().id());
+          if (iter != road_id_map_.end()) {
+            node_creator::GetPbNode(lane, iter->second, routing_conf_,
+                                    &nodes[i]);
+          } else {
+            AWARN << "Failed to find road id of lane " << lane.id().id();
+            node_creator::GetPbNode(lane, "", routing_conf_, &nodes[i]);
+          }
+        }
+      }));
     }
-    if (lane.has_left_boundary() && IsAllowedToCross(lane.left_boundary())) {
-      AddEdge(from_node, lane.left_neighbor_forward_lane_id(), Edge::LEFT);
+    for (auto& future : futures) {
+      future.get();
     }
+  }
+  for (auto& node : nodes) {
+    graph_.add_node()->Swap(&node);
+  }
+
+  std::vector<std::vector<Edge>> edges(lane_num);
+  {
+    std::vector<std::future<void>> futures;
+    for (size_t worker = 0; worker < worker_num; ++worker) {
+      futures.push_back(std::async(std::launch::async, [&, worker]() {
+        for (size_t i = worker; i < lane_num; i += worker_num) {
+          const auto& lane = *valid_lanes[i];
+          const auto& from_node = graph_.node(static_cast<int>(i));
+          // every edge id is prefixed with the from-lane id, so a per-lane
+          // duplicate set is equivalent to the previous global one
+          std::unordered_set<std::string> showed_edge_id_set;
 
-    if (lane.has_right_boundary() && IsAllowedToCross(lane.right_boundary())) {
-      AddEdge(from_node, lane.right_neighbor_forward_lane_id(), Edge::RIGHT);
+          AddEdge(from_node, lane.successor_id(), Edge::FORWARD,
+                  &showed_edge_id_set, &edges[i]);
+          if (lane.length() < FLAGS_min_length_for_lane_change) {
+            continue;
+          }
+          if (lane.has_left_boundary() &&
+              IsAllowedToCross(lane.left_boundary())) {
+            AddEdge(from_node, lane.left_neighbor_forward_lane_id(),
+                    Edge::LEFT, &showed_edge_id_set, &edges[i]);
+          }
+
+          if (lane.has_right_boundary() &&
+              IsAllowedToCross(lane.right_boundary())) {
+            AddEdge(from_node, lane.right_neighbor_forward_lane_id(),
+                    Edge::RIGHT, &showed_edge_id_set, &edges[i]);
+          }
+        }
+      }));
+    }
+    for (auto& future : futures) {
+      future.get();
+    }
+  }
+  for (auto& lane_edges : edges) {
+    for (auto& edge : lane_edges) {
+      graph_.add_edge()->Swap(&edge);
     }
   }
 
@@ -168,9 +226,30 @@ std::string GraphCreator::GetEdgeID(const std::string& from_id,
   return from_id + "->" + to_id;
 }
 
-void GraphCreator::AddEdge(const Node& from_node,
-                           const RepeatedPtrField<Id>& to_node_vec,
-                           const Edge::DirectionType& type) {
+bool GraphCreator::IsDumpUpToDate() const {
+  struct stat base_map_stat;
+  if (stat(base_map_file_path_.c_str(), &base_map_stat) != 0) {
+    return false;
+  }
+  std::string dump_path = dump_topo_file_path_;
+  const auto type_pos = dump_path.find_last_of(".") + 1;
+  const std::string bin_file = dump_path.replace(type_pos, 3, "bin");
+  const std::string txt_file = dump_path.replace(type_pos, 3, "txt");
+  for (const std::string& file : {bin_file, txt_file}) {
+    struct stat dump_stat;
+    if (stat(file.c_str(), &dump_stat) != 0 ||
+        dump_stat.st_mtime < base_map_stat.st_mtime) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void GraphCreator::AddEdge(
+    const Node& from_node, const RepeatedPtrField<Id>& to_node_vec,
+    const Edge::DirectionType& type,
+    std::unordered_set<std::string>* const showed_edge_id_set,
+    std::vector<Edge>* const edges) {
   for (const auto& to_id : to_node_vec) {
     if (forbidden_lane_id_set_.find(to_id.id()) !=
         forbidden_lane_id_set_.end()) {
@@ -178,17 +257,18 @@ void GraphCreator::AddEdge(const Node& from_node,
       continue;
     }
     const std::string edge_id = GetEdgeID(from_node.lane_id(), to_id.id());
-    if (showed_edge_id_set_.count(edge_id) != 0) {
+    if (showed_edge_id_set->count(edge_id) != 0) {
       continue;
     }
-    showed_edge_id_set_.insert(edge_id);
+    showed_edge_id_set->insert(edge_id);
     const auto& iter = node_index_map_.find(to_id.id());
     if (iter == node_index_map_.end()) {
       continue;
     }
     const auto& to_node = graph_.node(iter->second);
+    edges->emplace_back();
     edge_creator::GetPbEdge(from_node, to_node, type, routing_conf_,
-                            graph_.add_edge());
+                            &edges->back());
   }
 }
 
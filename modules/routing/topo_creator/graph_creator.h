@@ -19,6 +19,7 @@
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 #include "modules/map/proto/map.pb.h"
 #include "modules/routing/proto/routing_config.pb.h"
@@ -41,10 +42,16 @@ class GraphCreator {
   void InitForbiddenLanes();
   std::string GetEdgeID(const std::string& from_id, const std::string& to_id);
 
+  /**@brief Whether the dumped topo files already exist and are newer than
+   * the base map, in which case regeneration can be skipped. */
+  bool IsDumpUpToDate() const;
+
   void AddEdge(
       const Node& from_node,
       const ::google::protobuf::RepeatedPtrField<hdmap::Id>& to_node_vec,
-      const Edge::DirectionType& type);
+      const Edge::DirectionType& type,
+      std::unordered_set<std::string>* const showed_edge_id_set,
+      std::vector<Edge>* const edges);
 
   static bool IsValidUTurn(const hdmap::Lane& lane, const double radius);
 
@@ -55,7 +62,6 @@ class GraphCreator {
   Graph graph_;
   std::unordered_map<std::string, int> node_index_map_;
   std::unordered_map<std::string, std::string> road_id_map_;
-  std::unordered_set<std::string> showed_edge_id_set_;
   std::unordered_set<std::string> forbidden_lane_id_set_;
 
   const RoutingConfig& routing_conf_;
@@ -16,6 +16,9 @@
 
 #include "modules/storytelling/story_tellers/close_to_junction_teller.h"
 
+#include <array>
+#include <cmath>
+#include <utility>
 #include <vector>
 
 #include "modules/common/adapters/adapter_gflags.h"
@@ -143,13 +146,57 @@ bool GetYieldSign(const PathPoint& point, std::string* yield_sign_id) {
   return false;
 }
 
+// A trajectory segment that moved less than this is treated as
+// unchanged, so the cached overlaps keep being served.
+constexpr double kTrajectoryDeltaEpsilon = 0.1;
+
+// Collect the (x, y, rebased s) samples of the trajectory points within
+// the overlap search distance.
+void ExtractSearchSegment(const ADCTrajectory& adc_trajectory,
+                          std::vector<std::array<double, 3>>* segment) {
+  segment->clear();
+  const double s_start = adc_trajectory.trajectory_point(0).path_point().s();
+  for (const auto& point : adc_trajectory.trajectory_point()) {
+    const auto& path_point = point.path_point();
+    if (path_point.s() > FLAGS_adc_trajectory_search_distance) {
+      break;
+    }
+    segment->push_back(
+        {{path_point.x(), path_point.y(), path_point.s() - s_start}});
+  }
+}
+
+bool IsSameSegment(const std::vector<std::array<double, 3>>& lhs,
+                   const std::vector<std::array<double, 3>>& rhs) {
+  if (lhs.size() != rhs.size()) {
+    return false;
+  }
+  for (size_t i = 0; i < lhs.size(); ++i) {
+    for (size_t j = 0; j < lhs[i].size(); ++j) {
+      if (std::fabs(lhs[i][j] - rhs[i][j]) > kTrajectoryDeltaEpsilon) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
 }  // namespace
 
 /**
  * @brief Get overlaps within search radius.
  */
 void CloseToJunctionTeller::GetOverlaps(const ADCTrajectory& adc_trajectory) {
-  static std::string overlapping_junction_id;
+  std::vector<std::array<double, 3>> search_segment;
+  ExtractSearchSegment(adc_trajectory, &search_segment);
+  if (!evaluated_segment_.empty() &&
+      IsSameSegment(search_segment, evaluated_segment_)) {
+    // The overlap-relevant part of the trajectory did not move, e.g.
+    // while waiting at a junction: the cached overlaps and distances are
+    // still the answers, skip re-walking the map.
+    ADEBUG << "Trajectory unchanged, reuse cached overlaps.";
+    return;
+  }
 
   const double s_start = adc_trajectory.trajectory_point(0).path_point().s();
 
@@ -236,6 +283,8 @@ void CloseToJunctionTeller::GetOverlaps(const ADCTrajectory& adc_trajectory) {
       }
     }
   }
+
+  evaluated_segment_ = std::move(search_segment);
 }
 
 void CloseToJunctionTeller::Init(const StorytellingConfig& storytelling_conf) {
@@ -16,8 +16,10 @@
 
 #pragma once
 
+#include <array>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "modules/planning/proto/planning.pb.h"
 #include "modules/storytelling/story_tellers/base_teller.h"
@@ -52,6 +54,10 @@ class CloseToJunctionTeller : public BaseTeller {
   double stop_sign_distance_;
   std::string yield_sign_id_;
   double yield_sign_distance_;
+  // The (x, y, rebased s) samples of the last evaluated trajectory
+  // segment; while the segment does not move, the overlaps above stay
+  // valid and the map is not re-queried.
+  std::vector<std::array<double, 3>> evaluated_segment_;
   StorytellingConfig config_;
 };
 
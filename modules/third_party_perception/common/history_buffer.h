@@ -0,0 +1,97 @@
+/******************************************************************************
+ * Copyright 2020 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+/**
+ * @file
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <deque>
+#include <mutex>
+#include <utility>
+
+/**
+ * @namespace apollo::third_party_perception
+ * @brief apollo::third_party_perception
+ */
+namespace apollo {
+namespace third_party_perception {
+
+/**
+ * @class HistoryBuffer
+ * @brief A bounded per-sensor history of timestamped samples. Lookups
+ * locate the sample nearest a query timestamp by binary search, so a
+ * consumer can align against the sample taken when its own measurement
+ * was made instead of whatever arrived last. The buffer has its own
+ * small lock and is never held across conversion work, keeping sensor
+ * callbacks off the module-wide mutex.
+ */
+template <typename T>
+class HistoryBuffer {
+ public:
+  explicit HistoryBuffer(size_t capacity = 32) : capacity_(capacity) {}
+
+  void Push(const double timestamp, const T& value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!buffer_.empty() && timestamp <= buffer_.back().first) {
+      // Out-of-order sample; keep the history monotonic.
+      return;
+    }
+    buffer_.emplace_back(timestamp, value);
+    if (buffer_.size() > capacity_) {
+      buffer_.pop_front();
+    }
+  }
+
+  bool GetNearest(const double timestamp, T* const value) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (buffer_.empty()) {
+      return false;
+    }
+    auto iter = std::lower_bound(
+        buffer_.begin(), buffer_.end(), timestamp,
+        [](const std::pair<double, T>& sample, const double t) {
+          return sample.first < t;
+        });
+    if (iter == buffer_.end()) {
+      --iter;
+    } else if (iter != buffer_.begin() &&
+               iter->first - timestamp > timestamp - std::prev(iter)->first) {
+      --iter;
+    }
+    *value = iter->second;
+    return true;
+  }
+
+  bool GetLatest(T* const value) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (buffer_.empty()) {
+      return false;
+    }
+    *value = buffer_.back().second;
+    return true;
+  }
+
+ private:
+  size_t capacity_;
+  std::deque<std::pair<double, T>> buffer_;
+  mutable std::mutex mutex_;
+};
+
+}  // namespace third_party_perception
+}  // namespace apollo
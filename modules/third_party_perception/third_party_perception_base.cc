@@ -59,12 +59,14 @@ void ThirdPartyPerception::Stop() {}
 
 void ThirdPartyPerception::OnChassis(const Chassis& message) {
   ADEBUG << "Received chassis data: run chassis callback.";
+  chassis_history_.Push(message.header().timestamp_sec(), message);
   std::lock_guard<std::mutex> lock(third_party_perception_mutex_);
   chassis_.CopyFrom(message);
 }
 
 void ThirdPartyPerception::OnLocalization(const LocalizationEstimate& message) {
   ADEBUG << "Received localization data: run localization callback.";
+  localization_history_.Push(message.header().timestamp_sec(), message);
   std::lock_guard<std::mutex> lock(third_party_perception_mutex_);
   localization_.CopyFrom(message);
 }
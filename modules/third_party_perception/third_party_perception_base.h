@@ -32,6 +32,7 @@
 #include "modules/localization/proto/localization.pb.h"
 #include "modules/perception/proto/perception_obstacle.pb.h"
 #include "modules/third_party_perception/proto/radar_obstacle.pb.h"
+#include "modules/third_party_perception/common/history_buffer.h"
 #include "modules/third_party_perception/common/third_party_perception_gflags.h"
 
 /**
@@ -64,6 +65,12 @@ class ThirdPartyPerception {
   std::mutex third_party_perception_mutex_;
   apollo::localization::LocalizationEstimate localization_;
   apollo::canbus::Chassis chassis_;
+  // Timestamped histories so sensor callbacks can fetch the pose and
+  // chassis state matching their measurement time without taking the
+  // module-wide mutex.
+  HistoryBuffer<apollo::localization::LocalizationEstimate>
+      localization_history_;
+  HistoryBuffer<apollo::canbus::Chassis> chassis_history_;
   RadarObstacles current_radar_obstacles_;
   RadarObstacles last_radar_obstacles_;
   std::shared_ptr<apollo::cyber::Node> node_ = nullptr;
@@ -15,6 +15,8 @@
  *****************************************************************************/
 #include "modules/third_party_perception/third_party_perception_mobileye.h"
 
+#include <utility>
+
 #include "modules/common/adapters/adapter_gflags.h"
 #include "modules/common/util/message_util.h"
 #include "modules/third_party_perception/common/third_party_perception_gflags.h"
@@ -53,19 +55,36 @@ ThirdPartyPerceptionMobileye::ThirdPartyPerceptionMobileye(
 
 void ThirdPartyPerceptionMobileye::OnMobileye(const Mobileye& message) {
   ADEBUG << "Received mobileye data: run mobileye callback.";
+  apollo::localization::LocalizationEstimate localization;
+  apollo::canbus::Chassis chassis;
+  localization_history_.GetNearest(message.header().timestamp_sec(),
+                                   &localization);
+  chassis_history_.GetNearest(message.header().timestamp_sec(), &chassis);
+  // Conversion runs outside the module mutex; only the result swap is
+  // serialized against Process().
+  auto eye_obstacles = conversion_mobileye::MobileyeToPerceptionObstacles(
+      message, localization, chassis);
   std::lock_guard<std::mutex> lock(third_party_perception_mutex_);
-  eye_obstacles_ = conversion_mobileye::MobileyeToPerceptionObstacles(
-      message, localization_, chassis_);
+  eye_obstacles_ = std::move(eye_obstacles);
 }
 
 void ThirdPartyPerceptionMobileye::OnDelphiESR(const DelphiESR& message) {
   ADEBUG << "Received delphi esr data: run delphi esr callback.";
-  std::lock_guard<std::mutex> lock(third_party_perception_mutex_);
-  last_radar_obstacles_.CopyFrom(current_radar_obstacles_);
-  current_radar_obstacles_ = conversion_radar::DelphiToRadarObstacles(
-      message, localization_, last_radar_obstacles_);
+  apollo::localization::LocalizationEstimate localization;
+  localization_history_.GetNearest(message.header().timestamp_sec(),
+                                   &localization);
+  RadarObstacles last_radar_obstacles;
+  {
+    std::lock_guard<std::mutex> lock(third_party_perception_mutex_);
+    last_radar_obstacles.CopyFrom(current_radar_obstacles_);
+  }
+  auto current_radar_obstacles = conversion_radar::DelphiToRadarObstacles(
+      message, localization, last_radar_obstacles);
   RadarObstacles filtered_radar_obstacles =
-      filter::FilterRadarObstacles(current_radar_obstacles_);
+      filter::FilterRadarObstacles(current_radar_obstacles);
+  std::lock_guard<std::mutex> lock(third_party_perception_mutex_);
+  last_radar_obstacles_ = std::move(last_radar_obstacles);
+  current_radar_obstacles_ = std::move(current_radar_obstacles);
   if (FLAGS_enable_radar) {
     radar_obstacles_ = conversion_radar::RadarObstaclesToPerceptionObstacles(
         filtered_radar_obstacles);
@@ -74,12 +93,23 @@ void ThirdPartyPerceptionMobileye::OnDelphiESR(const DelphiESR& message) {
 
 void ThirdPartyPerceptionMobileye::OnContiRadar(const ContiRadar& message) {
   ADEBUG << "Received delphi esr data: run continental radar callback.";
-  std::lock_guard<std::mutex> lock(third_party_perception_mutex_);
-  last_radar_obstacles_.CopyFrom(current_radar_obstacles_);
-  current_radar_obstacles_ = conversion_radar::ContiToRadarObstacles(
-      message, localization_, last_radar_obstacles_, chassis_);
+  apollo::localization::LocalizationEstimate localization;
+  apollo::canbus::Chassis chassis;
+  localization_history_.GetNearest(message.header().timestamp_sec(),
+                                   &localization);
+  chassis_history_.GetNearest(message.header().timestamp_sec(), &chassis);
+  RadarObstacles last_radar_obstacles;
+  {
+    std::lock_guard<std::mutex> lock(third_party_perception_mutex_);
+    last_radar_obstacles.CopyFrom(current_radar_obstacles_);
+  }
+  auto current_radar_obstacles = conversion_radar::ContiToRadarObstacles(
+      message, localization, last_radar_obstacles, chassis);
   RadarObstacles filtered_radar_obstacles =
-      filter::FilterRadarObstacles(current_radar_obstacles_);
+      filter::FilterRadarObstacles(current_radar_obstacles);
+  std::lock_guard<std::mutex> lock(third_party_perception_mutex_);
+  last_radar_obstacles_ = std::move(last_radar_obstacles);
+  current_radar_obstacles_ = std::move(current_radar_obstacles);
   if (FLAGS_enable_radar) {
     radar_obstacles_ = conversion_radar::RadarObstaclesToPerceptionObstacles(
         filtered_radar_obstacles);
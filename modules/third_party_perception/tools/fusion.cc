@@ -68,16 +68,28 @@ PerceptionObstacles EyeRadarFusion(
     const PerceptionObstacles& eye_obstacles,
     const PerceptionObstacles& radar_obstacles) {
   PerceptionObstacles eye_obstacles_fusion = eye_obstacles;
-  PerceptionObstacles radar_obstacles_fusion = radar_obstacles;
 
-  for (auto& eye_obstacle :
-       *(eye_obstacles_fusion.mutable_perception_obstacle())) {
-    for (auto& radar_obstacle :
-         *(radar_obstacles_fusion.mutable_perception_obstacle())) {
-      if (HasOverlap(eye_obstacle, radar_obstacle)) {
-        eye_obstacle.set_confidence(0.99);
-        eye_obstacle.mutable_velocity()->CopyFrom(
-            radar_obstacle.velocity());
+  // Build every polygon once up front instead of reconstructing both
+  // sides of each pair inside the overlap test.
+  std::vector<common::math::Polygon2d> eye_polygons;
+  eye_polygons.reserve(eye_obstacles_fusion.perception_obstacle_size());
+  for (const auto& eye_obstacle : eye_obstacles_fusion.perception_obstacle()) {
+    eye_polygons.emplace_back(PerceptionObstacleToVectorVec2d(eye_obstacle));
+  }
+  std::vector<common::math::Polygon2d> radar_polygons;
+  radar_polygons.reserve(radar_obstacles.perception_obstacle_size());
+  for (const auto& radar_obstacle : radar_obstacles.perception_obstacle()) {
+    radar_polygons.emplace_back(
+        PerceptionObstacleToVectorVec2d(radar_obstacle));
+  }
+
+  for (int i = 0; i < eye_obstacles_fusion.perception_obstacle_size(); ++i) {
+    auto* eye_obstacle = eye_obstacles_fusion.mutable_perception_obstacle(i);
+    for (int j = 0; j < radar_obstacles.perception_obstacle_size(); ++j) {
+      if (eye_polygons[i].HasOverlap(radar_polygons[j])) {
+        eye_obstacle->set_confidence(0.99);
+        eye_obstacle->mutable_velocity()->CopyFrom(
+            radar_obstacles.perception_obstacle(j).velocity());
       }
     }
   }
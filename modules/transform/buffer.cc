@@ -16,6 +16,8 @@
 
 #include "modules/transform/buffer.h"
 
+#include <functional>
+
 #include "absl/strings/str_cat.h"
 #include "cyber/cyber.h"
 #include "modules/common/adapters/adapter_gflags.h"
@@ -105,6 +107,7 @@ void Buffer::SubscriptionCallbackImpl(
         static_msgs_.push_back(trans_stamped);
       }
       setTransform(trans_stamped, authority, is_static);
+      UpdateLatestTransform(trans_stamped);
     } catch (tf2::TransformException& ex) {
       std::string temp = ex.what();
       AERROR << "Failure to set received transform:" << temp.c_str();
@@ -112,6 +115,113 @@ void Buffer::SubscriptionCallbackImpl(
   }
 }
 
+uint64_t Buffer::FramePairKey(const std::string& frame_id,
+                              const std::string& child_frame_id) {
+  const std::hash<std::string> hasher;
+  return hasher(frame_id) * 31 + hasher(child_frame_id);
+}
+
+void Buffer::UpdateLatestTransform(
+    const geometry_msgs::TransformStamped& trans_stamped) {
+  const uint64_t key =
+      FramePairKey(trans_stamped.header.frame_id, trans_stamped.child_frame_id);
+
+  std::lock_guard<std::mutex> lock(latest_transform_mutex_);
+  std::shared_ptr<TransformRing>* ring_ptr = nullptr;
+  if (!latest_transforms_.Get(key, &ring_ptr)) {
+    latest_transforms_.Set(
+        key, std::make_shared<TransformRing>(trans_stamped.header.frame_id,
+                                             trans_stamped.child_frame_id));
+    latest_transforms_.Get(key, &ring_ptr);
+  }
+  TransformRing* ring = ring_ptr->get();
+  if (ring->frame_id != trans_stamped.header.frame_id ||
+      ring->child_frame_id != trans_stamped.child_frame_id) {
+    AWARN << "Frame pair key collision between (" << ring->frame_id << ", "
+          << ring->child_frame_id << ") and (" << trans_stamped.header.frame_id
+          << ", " << trans_stamped.child_frame_id
+          << "); the latest transform snapshot only serves the first pair.";
+    return;
+  }
+
+  const uint64_t head = ring->head.load(std::memory_order_relaxed);
+  TransformRing::Slot& slot =
+      ring->slots[(head + 1) & (TransformRing::kCapacity - 1)];
+  // Seqlock publication: mark the slot busy (odd), fill it, mark it stable
+  // (even), then advance the head so readers move to this slot.
+  slot.sequence.fetch_add(1, std::memory_order_acq_rel);
+  slot.stamp_ns.store(trans_stamped.header.stamp, std::memory_order_relaxed);
+  slot.translation_x.store(trans_stamped.transform.translation.x,
+                           std::memory_order_relaxed);
+  slot.translation_y.store(trans_stamped.transform.translation.y,
+                           std::memory_order_relaxed);
+  slot.translation_z.store(trans_stamped.transform.translation.z,
+                           std::memory_order_relaxed);
+  slot.rotation_qx.store(trans_stamped.transform.rotation.x,
+                         std::memory_order_relaxed);
+  slot.rotation_qy.store(trans_stamped.transform.rotation.y,
+                         std::memory_order_relaxed);
+  slot.rotation_qz.store(trans_stamped.transform.rotation.z,
+                         std::memory_order_relaxed);
+  slot.rotation_qw.store(trans_stamped.transform.rotation.w,
+                         std::memory_order_relaxed);
+  slot.sequence.fetch_add(1, std::memory_order_release);
+  ring->head.store(head + 1, std::memory_order_release);
+}
+
+bool Buffer::GetLatestTransform(const std::string& frame_id,
+                                const std::string& child_frame_id,
+                                TransformStamped* tf) const {
+  const uint64_t key = FramePairKey(frame_id, child_frame_id);
+  std::shared_ptr<TransformRing>* ring_ptr = nullptr;
+  if (!latest_transforms_.Get(key, &ring_ptr)) {
+    return false;
+  }
+  const TransformRing* ring = ring_ptr->get();
+  if (ring->frame_id != frame_id || ring->child_frame_id != child_frame_id) {
+    return false;
+  }
+
+  uint64_t head = ring->head.load(std::memory_order_acquire);
+  // The newest slot only becomes unstable if the writer laps the whole ring
+  // during the copy, so a bounded number of attempts keeps the read
+  // wait-free.
+  for (int attempt = 0; attempt < 2 && head > 0; ++attempt, --head) {
+    const TransformRing::Slot& slot =
+        ring->slots[head & (TransformRing::kCapacity - 1)];
+    const uint64_t seq_begin = slot.sequence.load(std::memory_order_acquire);
+    if ((seq_begin & 1) != 0) {
+      continue;
+    }
+    const uint64_t stamp_ns = slot.stamp_ns.load(std::memory_order_relaxed);
+    const double tx = slot.translation_x.load(std::memory_order_relaxed);
+    const double ty = slot.translation_y.load(std::memory_order_relaxed);
+    const double tz = slot.translation_z.load(std::memory_order_relaxed);
+    const double qx = slot.rotation_qx.load(std::memory_order_relaxed);
+    const double qy = slot.rotation_qy.load(std::memory_order_relaxed);
+    const double qz = slot.rotation_qz.load(std::memory_order_relaxed);
+    const double qw = slot.rotation_qw.load(std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (slot.sequence.load(std::memory_order_relaxed) != seq_begin) {
+      continue;
+    }
+
+    tf->mutable_header()->set_timestamp_sec(static_cast<double>(stamp_ns) /
+                                            1e9);
+    tf->mutable_header()->set_frame_id(frame_id);
+    tf->set_child_frame_id(child_frame_id);
+    tf->mutable_transform()->mutable_translation()->set_x(tx);
+    tf->mutable_transform()->mutable_translation()->set_y(ty);
+    tf->mutable_transform()->mutable_translation()->set_z(tz);
+    tf->mutable_transform()->mutable_rotation()->set_qx(qx);
+    tf->mutable_transform()->mutable_rotation()->set_qy(qy);
+    tf->mutable_transform()->mutable_rotation()->set_qz(qz);
+    tf->mutable_transform()->mutable_rotation()->set_qw(qw);
+    return true;
+  }
+  return false;
+}
+
 bool Buffer::GetLatestStaticTF(const std::string& frame_id,
                                const std::string& child_frame_id,
                                TransformStamped* tf) {
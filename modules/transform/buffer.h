@@ -16,13 +16,16 @@
 
 #pragma once
 
+#include <atomic>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
 #include "tf2/buffer_core.h"
 #include "tf2/convert.h"
 
+#include "cyber/base/atomic_hash_map.h"
 #include "cyber/node/node.h"
 #include "modules/transform/buffer_interface.h"
 
@@ -119,6 +122,20 @@ class Buffer : public BufferInterface, public tf2::BufferCore {
                          const std::string& child_frame_id,
                          TransformStamped* tf);
 
+  /** \brief Wait-free read of the most recent transform of a frame pair.
+   * \param frame_id The parent frame
+   * \param child_frame_id The child frame
+   * \param tf Filled with the latest transform set for the pair
+   * \return True if a transform has been published for the pair
+   *
+   * Unlike lookupTransform, this never touches the tf2 buffer or any lock;
+   * readers copy from a snapshot slot published by the subscription callback,
+   * so high-frequency callers do not contend with the transform writer.
+   */
+  bool GetLatestTransform(const std::string& frame_id,
+                          const std::string& child_frame_id,
+                          TransformStamped* tf) const;
+
  private:
   void SubscriptionCallback(
       const std::shared_ptr<const TransformStampeds>& transform);
@@ -131,6 +148,43 @@ class Buffer : public BufferInterface, public tf2::BufferCore {
   void TF2MsgToCyber(const geometry_msgs::TransformStamped& tf2_trans_stamped,
                      TransformStamped& trans_stamped) const;  // NOLINT
 
+  // Fixed-capacity history ring of one frame pair. The subscription callback
+  // publishes into rotating slots; readers copy the newest slot without
+  // locking and use the per-slot sequence to detect an in-flight writer. A
+  // published slot is only rewritten after the writer laps the whole ring.
+  struct TransformRing {
+    static constexpr uint64_t kCapacity = 8;  // must be a power of two
+
+    struct Slot {
+      // Odd while the writer is filling the slot.
+      std::atomic<uint64_t> sequence = {0};
+      std::atomic<uint64_t> stamp_ns = {0};
+      std::atomic<double> translation_x = {0.0};
+      std::atomic<double> translation_y = {0.0};
+      std::atomic<double> translation_z = {0.0};
+      std::atomic<double> rotation_qx = {0.0};
+      std::atomic<double> rotation_qy = {0.0};
+      std::atomic<double> rotation_qz = {0.0};
+      std::atomic<double> rotation_qw = {1.0};
+    };
+
+    TransformRing(const std::string& frame, const std::string& child_frame)
+        : frame_id(frame), child_frame_id(child_frame) {}
+
+    // Frame ids are fixed at ring creation; only the slots rotate.
+    const std::string frame_id;
+    const std::string child_frame_id;
+    // Number of published slots; the newest is head & (kCapacity - 1).
+    std::atomic<uint64_t> head = {0};
+    Slot slots[kCapacity];
+  };
+
+  static uint64_t FramePairKey(const std::string& frame_id,
+                               const std::string& child_frame_id);
+
+  void UpdateLatestTransform(
+      const geometry_msgs::TransformStamped& trans_stamped);
+
   std::unique_ptr<cyber::Node> node_;
   std::shared_ptr<cyber::Reader<TransformStampeds>> message_subscriber_tf_;
   std::shared_ptr<cyber::Reader<TransformStampeds>>
@@ -139,6 +193,13 @@ class Buffer : public BufferInterface, public tf2::BufferCore {
   cyber::Time last_update_;
   std::vector<geometry_msgs::TransformStamped> static_msgs_;
 
+  // Rings of the latest transforms keyed by hashed frame pair. Entries are
+  // created once and updated in place, so readers never see a ring torn
+  // down; the mutex only serializes ring creation and slot publication.
+  mutable cyber::base::AtomicHashMap<uint64_t, std::shared_ptr<TransformRing>>
+      latest_transforms_;
+  std::mutex latest_transform_mutex_;
+
   DECLARE_SINGLETON(Buffer)
 };  // class
 
@@ -21,6 +21,8 @@
 
 #include "modules/v2x/v2x_proxy/app/v2x_proxy.h"
 
+#include <cmath>
+
 namespace apollo {
 namespace v2x {
 
@@ -88,14 +90,15 @@ V2xProxy::V2xProxy()
 
 bool V2xProxy::InitFlag() { return init_flag_; }
 
-bool V2xProxy::TrafficLightProc(CurrentLaneTrafficLight* msg) {
-  if (!msg->has_gps_x_m() || !msg->has_gps_y_m()) {
-    AERROR << "Error::v2x trafficlight ignore, gps point is null";
-    return false;
+bool V2xProxy::GetRsuSignalIds(const apollo::common::PointENU& point,
+                               std::vector<std::string>* ids) {
+  std::string rsu_key = std::to_string(std::lround(point.x())) + "_" +
+                        std::to_string(std::lround(point.y()));
+  auto iter = rsu_signal_cache_.find(rsu_key);
+  if (iter != rsu_signal_cache_.end()) {
+    *ids = iter->second;
+    return true;
   }
-  apollo::common::PointENU point;
-  point.set_x(msg->gps_x_m());
-  point.set_y(msg->gps_y_m());
   std::vector<apollo::hdmap::SignalInfoConstPtr> signals;
   if (hdmap_->GetForwardNearestSignalsOnLane(point, 1000.0, &signals) != 0) {
     AERROR << "Error::v2x trafficlight ignore, hdmap get no signals";
@@ -107,18 +110,35 @@ bool V2xProxy::TrafficLightProc(CurrentLaneTrafficLight* msg) {
       AERROR << "Error::v2x trafficlight ignore, signals id is empty";
       return false;
     }
+    ids->push_back((*i)->id().id());
   }
-  if (signals.size() == 1) {
+  rsu_signal_cache_[rsu_key] = *ids;
+  return true;
+}
+
+bool V2xProxy::TrafficLightProc(CurrentLaneTrafficLight* msg) {
+  if (!msg->has_gps_x_m() || !msg->has_gps_y_m()) {
+    AERROR << "Error::v2x trafficlight ignore, gps point is null";
+    return false;
+  }
+  apollo::common::PointENU point;
+  point.set_x(msg->gps_x_m());
+  point.set_y(msg->gps_y_m());
+  std::vector<std::string> signal_ids;
+  if (!GetRsuSignalIds(point, &signal_ids)) {
+    return false;
+  }
+  if (signal_ids.size() == 1) {
     auto single = msg->mutable_single_traffic_light(0);
-    single->set_id(signals[0]->id().id());
+    single->set_id(signal_ids[0]);
     return true;
   }
   auto color = msg->single_traffic_light(0).color();
   msg->clear_single_traffic_light();
 
-  for (auto i = signals.begin(); i != signals.end(); i++) {
+  for (const auto& signal_id : signal_ids) {
     auto single = msg->add_single_traffic_light();
-    single->set_id((*i)->id().id());
+    single->set_id(signal_id);
     single->set_color(color);
   }
   return true;
@@ -23,6 +23,7 @@
 
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "modules/common/configs/config_gflags.h"
@@ -62,7 +63,19 @@ class V2xProxy {
   @param output mutable CurrentLaneTrafficLight msg
   */
   bool TrafficLightProc(CurrentLaneTrafficLight *msg);
+
+  /* function get the signal ids bound to the RSU broadcasting from the
+  given point, querying the hdmap only on first contact with that RSU
+  @param input point the gps point carried by the RSU message
+  @param output ids the signal ids of the intersection
+  */
+  bool GetRsuSignalIds(const apollo::common::PointENU &point,
+                       std::vector<std::string> *ids);
   std::unique_ptr<apollo::hdmap::HDMap> hdmap_;
+  // RSUs are static roadside units, so the map binding of each one is
+  // resolved once and reused; the key is its broadcast point quantized
+  // to a meter grid.
+  std::unordered_map<std::string, std::vector<std::string>> rsu_signal_cache_;
 
   bool init_flag_ = false;
 };